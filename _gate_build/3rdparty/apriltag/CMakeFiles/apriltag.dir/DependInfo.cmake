@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/apriltag/apriltag.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/apriltag.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/apriltag.c.o.d"
+  "/root/repo/3rdparty/apriltag/apriltag_pose.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/apriltag_pose.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/apriltag_pose.c.o.d"
+  "/root/repo/3rdparty/apriltag/apriltag_quad_thresh.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/apriltag_quad_thresh.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/apriltag_quad_thresh.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/g2d.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/g2d.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/g2d.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/getopt.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/getopt.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/getopt.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/homography.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/homography.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/homography.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/image_u8.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/image_u8.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/image_u8.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/image_u8x3.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/image_u8x3.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/image_u8x3.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/image_u8x4.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/image_u8x4.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/image_u8x4.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/matd.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/matd.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/matd.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/pam.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/pam.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/pam.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/pjpeg-idct.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/pjpeg-idct.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/pjpeg-idct.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/pjpeg.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/pjpeg.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/pjpeg.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/pnm.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/pnm.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/pnm.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/pthreads_cross.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/pthreads_cross.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/pthreads_cross.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/string_util.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/string_util.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/string_util.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/svd22.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/svd22.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/svd22.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/time_util.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/time_util.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/time_util.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/unionfind.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/unionfind.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/unionfind.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/workerpool.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/workerpool.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/workerpool.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/zarray.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/zarray.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/zarray.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/zhash.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/zhash.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/zhash.c.o.d"
+  "/root/repo/3rdparty/apriltag/common/zmaxheap.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/zmaxheap.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/common/zmaxheap.c.o.d"
+  "/root/repo/3rdparty/apriltag/tag25h9.c" "3rdparty/apriltag/CMakeFiles/apriltag.dir/tag25h9.c.o" "gcc" "3rdparty/apriltag/CMakeFiles/apriltag.dir/tag25h9.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,57 @@
+file(REMOVE_RECURSE
+  "../lib/libapriltag.a"
+  "../lib/libapriltag.pdb"
+  "CMakeFiles/apriltag.dir/apriltag.c.o"
+  "CMakeFiles/apriltag.dir/apriltag.c.o.d"
+  "CMakeFiles/apriltag.dir/apriltag_pose.c.o"
+  "CMakeFiles/apriltag.dir/apriltag_pose.c.o.d"
+  "CMakeFiles/apriltag.dir/apriltag_quad_thresh.c.o"
+  "CMakeFiles/apriltag.dir/apriltag_quad_thresh.c.o.d"
+  "CMakeFiles/apriltag.dir/common/g2d.c.o"
+  "CMakeFiles/apriltag.dir/common/g2d.c.o.d"
+  "CMakeFiles/apriltag.dir/common/getopt.c.o"
+  "CMakeFiles/apriltag.dir/common/getopt.c.o.d"
+  "CMakeFiles/apriltag.dir/common/homography.c.o"
+  "CMakeFiles/apriltag.dir/common/homography.c.o.d"
+  "CMakeFiles/apriltag.dir/common/image_u8.c.o"
+  "CMakeFiles/apriltag.dir/common/image_u8.c.o.d"
+  "CMakeFiles/apriltag.dir/common/image_u8x3.c.o"
+  "CMakeFiles/apriltag.dir/common/image_u8x3.c.o.d"
+  "CMakeFiles/apriltag.dir/common/image_u8x4.c.o"
+  "CMakeFiles/apriltag.dir/common/image_u8x4.c.o.d"
+  "CMakeFiles/apriltag.dir/common/matd.c.o"
+  "CMakeFiles/apriltag.dir/common/matd.c.o.d"
+  "CMakeFiles/apriltag.dir/common/pam.c.o"
+  "CMakeFiles/apriltag.dir/common/pam.c.o.d"
+  "CMakeFiles/apriltag.dir/common/pjpeg-idct.c.o"
+  "CMakeFiles/apriltag.dir/common/pjpeg-idct.c.o.d"
+  "CMakeFiles/apriltag.dir/common/pjpeg.c.o"
+  "CMakeFiles/apriltag.dir/common/pjpeg.c.o.d"
+  "CMakeFiles/apriltag.dir/common/pnm.c.o"
+  "CMakeFiles/apriltag.dir/common/pnm.c.o.d"
+  "CMakeFiles/apriltag.dir/common/pthreads_cross.c.o"
+  "CMakeFiles/apriltag.dir/common/pthreads_cross.c.o.d"
+  "CMakeFiles/apriltag.dir/common/string_util.c.o"
+  "CMakeFiles/apriltag.dir/common/string_util.c.o.d"
+  "CMakeFiles/apriltag.dir/common/svd22.c.o"
+  "CMakeFiles/apriltag.dir/common/svd22.c.o.d"
+  "CMakeFiles/apriltag.dir/common/time_util.c.o"
+  "CMakeFiles/apriltag.dir/common/time_util.c.o.d"
+  "CMakeFiles/apriltag.dir/common/unionfind.c.o"
+  "CMakeFiles/apriltag.dir/common/unionfind.c.o.d"
+  "CMakeFiles/apriltag.dir/common/workerpool.c.o"
+  "CMakeFiles/apriltag.dir/common/workerpool.c.o.d"
+  "CMakeFiles/apriltag.dir/common/zarray.c.o"
+  "CMakeFiles/apriltag.dir/common/zarray.c.o.d"
+  "CMakeFiles/apriltag.dir/common/zhash.c.o"
+  "CMakeFiles/apriltag.dir/common/zhash.c.o.d"
+  "CMakeFiles/apriltag.dir/common/zmaxheap.c.o"
+  "CMakeFiles/apriltag.dir/common/zmaxheap.c.o.d"
+  "CMakeFiles/apriltag.dir/tag25h9.c.o"
+  "CMakeFiles/apriltag.dir/tag25h9.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/apriltag.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,49 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "apriltag" for configuration "Release"
+set_property(TARGET apriltag APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(apriltag PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "C"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/RMVL/3rdparty/libapriltag.a"
+  )
+
+list(APPEND _cmake_import_check_targets apriltag )
+list(APPEND _cmake_import_check_files_for_apriltag "${_IMPORT_PREFIX}/lib/RMVL/3rdparty/libapriltag.a" )
+
+# Import target "rmvl_algorithm" for configuration "Release"
+set_property(TARGET rmvl_algorithm APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(rmvl_algorithm PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/librmvl_algorithm.a"
+  )
+
+list(APPEND _cmake_import_check_targets rmvl_algorithm )
+list(APPEND _cmake_import_check_files_for_rmvl_algorithm "${_IMPORT_PREFIX}/lib/librmvl_algorithm.a" )
+
+# Import target "rmvl_core" for configuration "Release"
+set_property(TARGET rmvl_core APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(rmvl_core PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/librmvl_core.a"
+  )
+
+list(APPEND _cmake_import_check_targets rmvl_core )
+list(APPEND _cmake_import_check_files_for_rmvl_core "${_IMPORT_PREFIX}/lib/librmvl_core.a" )
+
+# Import target "rmvl_hik_light_control" for configuration "Release"
+set_property(TARGET rmvl_hik_light_control APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(rmvl_hik_light_control PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/librmvl_hik_light_control.a"
+  )
+
+list(APPEND _cmake_import_check_targets rmvl_hik_light_control )
+list(APPEND _cmake_import_check_files_for_rmvl_hik_light_control "${_IMPORT_PREFIX}/lib/librmvl_hik_light_control.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
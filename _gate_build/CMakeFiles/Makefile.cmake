@@ -0,0 +1,155 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "/root/repo/3rdparty/apriltag/CMakeLists.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/FindGalaxySDK.cmake"
+  "/root/repo/cmake/FindHikSDK.cmake"
+  "/root/repo/cmake/FindMvSDK.cmake"
+  "/root/repo/cmake/FindOPTCameraSDK.cmake"
+  "/root/repo/cmake/FindOPTLightCtrl.cmake"
+  "/root/repo/cmake/FindOrt.cmake"
+  "/root/repo/cmake/RMVLCompilerOptions.cmake"
+  "/root/repo/cmake/RMVLExtraTarget.cmake"
+  "/root/repo/cmake/RMVLGenConfig.cmake"
+  "/root/repo/cmake/RMVLGenHeaders.cmake"
+  "/root/repo/cmake/RMVLGenPara.cmake"
+  "/root/repo/cmake/RMVLInstall.cmake"
+  "/root/repo/cmake/RMVLModule.cmake"
+  "/root/repo/cmake/RMVLPackaging.cmake"
+  "/root/repo/cmake/RMVLUtils.cmake"
+  "/root/repo/cmake/RMVLVersion.cmake"
+  "/root/repo/cmake/check/cxx17.cpp"
+  "/root/repo/cmake/check/cxx20.cpp"
+  "/root/repo/cmake/check/cxx23.cpp"
+  "/root/repo/cmake/templates/RMVLConfig-version.cmake.in"
+  "/root/repo/cmake/templates/RMVLConfig.cmake.in"
+  "/root/repo/cmake/templates/cmake_uninstall.cmake.in"
+  "/root/repo/cmake/templates/para_generator_header_without_cv.in"
+  "/root/repo/cmake/templates/para_generator_module.in"
+  "/root/repo/cmake/templates/rmvl_modules.hpp.in"
+  "/root/repo/include/CMakeLists.txt"
+  "/root/repo/modules/CMakeLists.txt"
+  "/root/repo/modules/algorithm/CMakeLists.txt"
+  "/root/repo/modules/camera/CMakeLists.txt"
+  "/root/repo/modules/core/CMakeLists.txt"
+  "/root/repo/modules/light/CMakeLists.txt"
+  "/root/repo/modules/ml/CMakeLists.txt"
+  "/root/repo/modules/opcua/CMakeLists.txt"
+  "/root/repo/samples/CMakeLists.txt"
+  "/root/repo/samples/camera/CMakeLists.txt"
+  "/root/repo/samples/camera/hik/CMakeLists.txt"
+  "/root/repo/samples/camera/mv/CMakeLists.txt"
+  "/root/repo/samples/core/CMakeLists.txt"
+  "/root/repo/samples/detector/CMakeLists.txt"
+  "/root/repo/samples/light/CMakeLists.txt"
+  "/root/repo/samples/opcua/CMakeLists.txt"
+  "/root/repo/samples/version/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCUDAToolkit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  "/usr/share/eigen3/cmake/Eigen3Config.cmake"
+  "/usr/share/eigen3/cmake/Eigen3ConfigVersion.cmake"
+  "/usr/share/eigen3/cmake/Eigen3Targets.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "cmake_uninstall.cmake"
+  "rmvl/rmvl_modules.hpp"
+  "config-install/RMVLConfig.cmake"
+  "config-install/RMVLConfig-version.cmake"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/apriltag/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "/root/repo/modules/algorithm/include/rmvlpara/algorithm.hpp"
+  "modules/algorithm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "/root/repo/modules/camera/include/rmvlpara/camera.hpp"
+  "modules/camera/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "/root/repo/modules/light/include/rmvlpara/light/hik_light_control.h"
+  "/root/repo/modules/light/include/rmvlpara/light.hpp"
+  "modules/light/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/ml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/opcua/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/camera/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/camera/hik/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/camera/mv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/detector/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/light/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/opcua/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "samples/version/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "3rdparty/apriltag/CMakeFiles/apriltag.dir/DependInfo.cmake"
+  "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/DependInfo.cmake"
+  "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/DependInfo.cmake"
+  "modules/core/CMakeFiles/rmvl_core.dir/DependInfo.cmake"
+  "modules/core/CMakeFiles/rmvl_core_test.dir/DependInfo.cmake"
+  "modules/light/CMakeFiles/rmvl_hik_light_control.dir/DependInfo.cmake"
+  "samples/core/CMakeFiles/rmvl_trace_decode.dir/DependInfo.cmake"
+  "samples/light/CMakeFiles/rmvl_hik_lightctl.dir/DependInfo.cmake"
+  "samples/version/CMakeFiles/rmvl_version.dir/DependInfo.cmake"
+  )
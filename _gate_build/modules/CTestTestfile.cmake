@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/modules
+# Build directory: /root/repo/_gate_build/modules
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("algorithm")
+subdirs("camera")
+subdirs("core")
+subdirs("light")
+subdirs("ml")
+subdirs("opcua")
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/algorithm/src/camera_model.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/camera_model.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/camera_model.cpp.o.d"
+  "/root/repo/modules/algorithm/src/dsp.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/dsp.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/dsp.cpp.o.d"
+  "/root/repo/modules/algorithm/src/frame_alloc.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/frame_alloc.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/frame_alloc.cpp.o.d"
+  "/root/repo/modules/algorithm/src/mathmodel.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/mathmodel.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/mathmodel.cpp.o.d"
+  "/root/repo/modules/algorithm/src/numcal.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/numcal.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/numcal.cpp.o.d"
+  "/root/repo/modules/algorithm/src/optimal.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/optimal.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/optimal.cpp.o.d"
+  "/root/repo/modules/algorithm/src/pretreat.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/pretreat.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/pretreat.cpp.o.d"
+  "/root/repo/modules/algorithm/src/transform.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/transform.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm.dir/src/transform.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/modules/core/CMakeFiles/rmvl_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
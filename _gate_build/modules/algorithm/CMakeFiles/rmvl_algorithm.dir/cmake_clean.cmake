@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../lib/librmvl_algorithm.a"
+  "../../lib/librmvl_algorithm.pdb"
+  "CMakeFiles/rmvl_algorithm.dir/src/camera_model.cpp.o"
+  "CMakeFiles/rmvl_algorithm.dir/src/camera_model.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm.dir/src/dsp.cpp.o"
+  "CMakeFiles/rmvl_algorithm.dir/src/dsp.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm.dir/src/frame_alloc.cpp.o"
+  "CMakeFiles/rmvl_algorithm.dir/src/frame_alloc.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm.dir/src/mathmodel.cpp.o"
+  "CMakeFiles/rmvl_algorithm.dir/src/mathmodel.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm.dir/src/numcal.cpp.o"
+  "CMakeFiles/rmvl_algorithm.dir/src/numcal.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm.dir/src/optimal.cpp.o"
+  "CMakeFiles/rmvl_algorithm.dir/src/optimal.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm.dir/src/pretreat.cpp.o"
+  "CMakeFiles/rmvl_algorithm.dir/src/pretreat.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm.dir/src/transform.cpp.o"
+  "CMakeFiles/rmvl_algorithm.dir/src/transform.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rmvl_algorithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
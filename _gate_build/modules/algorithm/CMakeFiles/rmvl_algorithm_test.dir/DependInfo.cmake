@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/algorithm/test/test_camera_model.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_camera_model.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_camera_model.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_dsp.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_dsp.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_dsp.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_ew_topsis.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_ew_topsis.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_ew_topsis.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_kalman.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_kalman.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_kalman.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_kdtree.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_kdtree.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_kdtree.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_km.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_km.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_km.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_math.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_math.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_math.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_matx_expr.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_matx_expr.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_matx_expr.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_numcal.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_numcal.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_numcal.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_optimal.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_optimal.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_optimal.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_para.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_para.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_para.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_pretreat.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_pretreat.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_pretreat.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_ra_heap.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_ra_heap.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_ra_heap.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_ring_buffer.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_ring_buffer.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_ring_buffer.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_signal.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_signal.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_signal.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_slot_map.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_slot_map.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_slot_map.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_sparse_set.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_sparse_set.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_sparse_set.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_transform.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_transform.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_transform.cpp.o.d"
+  "/root/repo/modules/algorithm/test/test_union_find.cpp" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_union_find.cpp.o" "gcc" "modules/algorithm/CMakeFiles/rmvl_algorithm_test.dir/test/test_union_find.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/modules/algorithm/CMakeFiles/rmvl_algorithm.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/modules/core/CMakeFiles/rmvl_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
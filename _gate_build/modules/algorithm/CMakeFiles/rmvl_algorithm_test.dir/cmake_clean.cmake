@@ -0,0 +1,48 @@
+file(REMOVE_RECURSE
+  "../../bin/rmvl_algorithm_test"
+  "../../bin/rmvl_algorithm_test.pdb"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_camera_model.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_camera_model.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_dsp.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_dsp.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_ew_topsis.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_ew_topsis.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_kalman.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_kalman.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_kdtree.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_kdtree.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_km.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_km.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_math.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_math.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_matx_expr.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_matx_expr.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_numcal.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_numcal.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_optimal.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_optimal.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_para.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_para.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_pretreat.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_pretreat.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_ra_heap.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_ra_heap.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_ring_buffer.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_ring_buffer.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_signal.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_signal.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_slot_map.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_slot_map.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_sparse_set.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_sparse_set.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_transform.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_transform.cpp.o.d"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_union_find.cpp.o"
+  "CMakeFiles/rmvl_algorithm_test.dir/test/test_union_find.cpp.o.d"
+  "rmvl_algorithm_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rmvl_algorithm_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
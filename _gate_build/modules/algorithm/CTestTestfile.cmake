@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/modules/algorithm
+# Build directory: /root/repo/_gate_build/modules/algorithm
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_gate_build/modules/algorithm/rmvl_algorithm_test[1]_include.cmake")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_gate_build/modules/algorithm/rmvl_algorithm_test[1]_tests.cmake")
+  include("/root/repo/_gate_build/modules/algorithm/rmvl_algorithm_test[1]_tests.cmake")
+else()
+  add_test(rmvl_algorithm_test_NOT_BUILT rmvl_algorithm_test_NOT_BUILT)
+endif()
@@ -0,0 +1,177 @@
+add_test([=[UnionFindTest.int_merge_connected_findRep]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=UnionFindTest.int_merge_connected_findRep]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[UnionFindTest.int_merge_connected_findRep]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UnionFindTest.shared_pointer_extract]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=UnionFindTest.shared_pointer_extract]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[UnionFindTest.shared_pointer_extract]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DenseUnionFindTest.merge_connected_components]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DenseUnionFindTest.merge_connected_components]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DenseUnionFindTest.merge_connected_components]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DenseUnionFindTest.extract]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DenseUnionFindTest.extract]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DenseUnionFindTest.extract]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseSetTest.insert_and_access]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SparseSetTest.insert_and_access]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SparseSetTest.insert_and_access]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseSetTest.erase_keeps_dense]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SparseSetTest.erase_keeps_dense]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SparseSetTest.erase_keeps_dense]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SparseSetTest.dense_iteration]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SparseSetTest.dense_iteration]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SparseSetTest.dense_iteration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SlotMapTest.insert_and_access]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SlotMapTest.insert_and_access]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SlotMapTest.insert_and_access]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SlotMapTest.stable_keys_on_erase]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SlotMapTest.stable_keys_on_erase]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SlotMapTest.stable_keys_on_erase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SlotMapTest.free_list_reuse_and_generation]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SlotMapTest.free_list_reuse_and_generation]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SlotMapTest.free_list_reuse_and_generation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SlotMapTest.iteration_skips_dead_slots]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SlotMapTest.iteration_skips_dead_slots]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SlotMapTest.iteration_skips_dead_slots]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SlotMapTest.erase_releases_resource]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SlotMapTest.erase_releases_resource]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SlotMapTest.erase_releases_resource]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SlotMapTest.clear_invalidates_all_keys]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SlotMapTest.clear_invalidates_all_keys]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SlotMapTest.clear_invalidates_all_keys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SignalTest.push_back_and_access]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SignalTest.push_back_and_access]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SignalTest.push_back_and_access]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SignalTest.ring_push]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SignalTest.ring_push]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SignalTest.ring_push]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SignalTest.data_linearize]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SignalTest.data_linearize]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SignalTest.data_linearize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SignalTest.iterator_and_algorithm]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SignalTest.iterator_and_algorithm]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SignalTest.iterator_and_algorithm]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SignalTest.copy_and_move]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=SignalTest.copy_and_move]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[SignalTest.copy_and_move]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RingBufferTest.push_and_access]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=RingBufferTest.push_and_access]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[RingBufferTest.push_and_access]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RingBufferTest.overwrite_when_full]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=RingBufferTest.overwrite_when_full]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[RingBufferTest.overwrite_when_full]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RingBufferTest.iterator_order]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=RingBufferTest.iterator_order]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[RingBufferTest.iterator_order]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RingBufferTest.release_on_evict]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=RingBufferTest.release_on_evict]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[RingBufferTest.release_on_evict]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RaHeapTest.BasicMethod_int]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=RaHeapTest.BasicMethod_int]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[RaHeapTest.BasicMethod_int]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RaHeapTest.UpdateEraseExport_int]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=RaHeapTest.UpdateEraseExport_int]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[RaHeapTest.UpdateEraseExport_int]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RaHeapTest.CustomData]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=RaHeapTest.CustomData]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[RaHeapTest.CustomData]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RaHeapTest.EraseMiddle]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=RaHeapTest.EraseMiddle]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[RaHeapTest.EraseMiddle]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RaHeap4Test.BasicMethod]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=RaHeap4Test.BasicMethod]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[RaHeap4Test.BasicMethod]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RaHeap4Test.UpdateErase]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=RaHeap4Test.UpdateErase]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[RaHeap4Test.UpdateErase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RaHeap4Test.BatchAssign]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=RaHeap4Test.BatchAssign]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[RaHeap4Test.BatchAssign]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParaSnapshot.immutable_snapshot]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=ParaSnapshot.immutable_snapshot]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[ParaSnapshot.immutable_snapshot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Optimal.derivative]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Optimal.derivative]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Optimal.derivative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Optimal.grad_parallel_and_complex_step]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Optimal.grad_parallel_and_complex_step]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Optimal.grad_parallel_and_complex_step]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Optimal.fminbnd]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Optimal.fminbnd]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Optimal.fminbnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Optimal.fminunc_simplex]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Optimal.fminunc_simplex]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Optimal.fminunc_simplex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Optimal.fminunc_conjgrad]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Optimal.fminunc_conjgrad]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Optimal.fminunc_conjgrad]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Optimal.fminunc_parallel_eval]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Optimal.fminunc_parallel_eval]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Optimal.fminunc_parallel_eval]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Optimal.fminunc_multi_start]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Optimal.fminunc_multi_start]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Optimal.fminunc_multi_start]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Optimal.fmincon_degredate_to_fminunc]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Optimal.fmincon_degredate_to_fminunc]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Optimal.fmincon_degredate_to_fminunc]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Optimal.fmincon_equation_con]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Optimal.fmincon_equation_con]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Optimal.fmincon_equation_con]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Optimal.fmincon_inequality_con]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Optimal.fmincon_inequality_con]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Optimal.fmincon_inequality_con]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.polynomial]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.polynomial]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.polynomial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.static_polynomial]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.static_polynomial]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.static_polynomial]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.function_interpolator]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.function_interpolator]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.function_interpolator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.static_function_interpolator]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.static_function_interpolator]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.static_function_interpolator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.uniform_interpolator]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.uniform_interpolator]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.uniform_interpolator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.curve_fitter_stream]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.curve_fitter_stream]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.curve_fitter_stream]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.curve_fitter_stream_sliding]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.curve_fitter_stream_sliding]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.curve_fitter_stream_sliding]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.recursive_least_squares]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.recursive_least_squares]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.recursive_least_squares]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.recursive_least_squares_reset]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.recursive_least_squares_reset]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.recursive_least_squares_reset]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.nonlinear_solver]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.nonlinear_solver]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.nonlinear_solver]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.nonlinear_equation_analytic_derivative]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.nonlinear_equation_analytic_derivative]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.nonlinear_equation_analytic_derivative]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.nonlinear_equation_batch]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.nonlinear_equation_batch]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.nonlinear_equation_batch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.runge_kutta_ode]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.runge_kutta_ode]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.runge_kutta_ode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.runge_kutta_odes]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.runge_kutta_odes]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.runge_kutta_odes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.runge_kutta_static_odes]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.runge_kutta_static_odes]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.runge_kutta_static_odes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.runge_kutta_45_adaptive]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.runge_kutta_45_adaptive]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.runge_kutta_45_adaptive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NumberCalculation.runge_kutta_45_event]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=NumberCalculation.runge_kutta_45_event]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[NumberCalculation.runge_kutta_45_event]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FastMathTest.sin_cos]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=FastMathTest.sin_cos]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[FastMathTest.sin_cos]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FastMathTest.atan]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=FastMathTest.atan]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[FastMathTest.atan]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FastMathTest.atan2]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=FastMathTest.atan2]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[FastMathTest.atan2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FastMathTest.batch]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=FastMathTest.batch]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[FastMathTest.batch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CircularAccumulatorTest.mean_and_variance]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=CircularAccumulatorTest.mean_and_variance]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[CircularAccumulatorTest.mean_and_variance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CircularAccumulatorTest.custom_period]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=CircularAccumulatorTest.custom_period]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[CircularAccumulatorTest.custom_period]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CircularAccumulatorTest.incremental_consistency]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=CircularAccumulatorTest.incremental_consistency]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[CircularAccumulatorTest.incremental_consistency]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Munkres.test1]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Munkres.test1]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Munkres.test1]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Munkres.test2]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Munkres.test2]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Munkres.test2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Munkres.test3]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=Munkres.test3]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[Munkres.test3]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MunkresEngine.cold_solve]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=MunkresEngine.cold_solve]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[MunkresEngine.cold_solve]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MunkresEngine.warm_start]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=MunkresEngine.warm_start]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[MunkresEngine.warm_start]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MunkresEngine.insert_erase]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=MunkresEngine.insert_erase]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[MunkresEngine.insert_erase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KDTreeTest.nearest_matches_brute_force]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=KDTreeTest.nearest_matches_brute_force]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[KDTreeTest.nearest_matches_brute_force]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KDTreeTest.nearest_with_filter]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=KDTreeTest.nearest_with_filter]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[KDTreeTest.nearest_with_filter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[KDTreeTest.empty_and_rebuild]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=KDTreeTest.empty_and_rebuild]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[KDTreeTest.empty_and_rebuild]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EwTopsisTest.BasicFunction]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=EwTopsisTest.BasicFunction]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[EwTopsisTest.BasicFunction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EwTopsisTest.ReuseWorkspace]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=EwTopsisTest.ReuseWorkspace]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[EwTopsisTest.ReuseWorkspace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EwTopsisTest.CustomData]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=EwTopsisTest.CustomData]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[EwTopsisTest.CustomData]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DSPTest.dft]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DSPTest.dft]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DSPTest.dft]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DSPTest.dft_non_pow2]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DSPTest.dft_non_pow2]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DSPTest.dft_non_pow2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DSPTest.idft]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DSPTest.idft]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DSPTest.idft]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DSPTest.moving_average]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DSPTest.moving_average]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DSPTest.moving_average]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DSPTest.moving_min_max]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DSPTest.moving_min_max]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DSPTest.moving_min_max]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DSPTest.moving_median]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DSPTest.moving_median]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DSPTest.moving_median]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DSPTest.xcorr]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DSPTest.xcorr]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DSPTest.xcorr]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DSPTest.xcorr_lag_recovery]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DSPTest.xcorr_lag_recovery]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DSPTest.xcorr_lag_recovery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DSPTest.psd]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DSPTest.psd]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DSPTest.psd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DSPTest.resample]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DSPTest.resample]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DSPTest.resample]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DSPTest.goertzel]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DSPTest.goertzel]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DSPTest.goertzel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DSPTest.goertzel_detector]=]  /root/repo/_gate_build/bin/rmvl_algorithm_test [==[--gtest_filter=DSPTest.goertzel_detector]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:algorithm-report.xml]==])
+set_tests_properties([=[DSPTest.goertzel_detector]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  rmvl_algorithm_test_TESTS UnionFindTest.int_merge_connected_findRep UnionFindTest.shared_pointer_extract DenseUnionFindTest.merge_connected_components DenseUnionFindTest.extract SparseSetTest.insert_and_access SparseSetTest.erase_keeps_dense SparseSetTest.dense_iteration SlotMapTest.insert_and_access SlotMapTest.stable_keys_on_erase SlotMapTest.free_list_reuse_and_generation SlotMapTest.iteration_skips_dead_slots SlotMapTest.erase_releases_resource SlotMapTest.clear_invalidates_all_keys SignalTest.push_back_and_access SignalTest.ring_push SignalTest.data_linearize SignalTest.iterator_and_algorithm SignalTest.copy_and_move RingBufferTest.push_and_access RingBufferTest.overwrite_when_full RingBufferTest.iterator_order RingBufferTest.release_on_evict RaHeapTest.BasicMethod_int RaHeapTest.UpdateEraseExport_int RaHeapTest.CustomData RaHeapTest.EraseMiddle RaHeap4Test.BasicMethod RaHeap4Test.UpdateErase RaHeap4Test.BatchAssign ParaSnapshot.immutable_snapshot Optimal.derivative Optimal.grad_parallel_and_complex_step Optimal.fminbnd Optimal.fminunc_simplex Optimal.fminunc_conjgrad Optimal.fminunc_parallel_eval Optimal.fminunc_multi_start Optimal.fmincon_degredate_to_fminunc Optimal.fmincon_equation_con Optimal.fmincon_inequality_con NumberCalculation.polynomial NumberCalculation.static_polynomial NumberCalculation.function_interpolator NumberCalculation.static_function_interpolator NumberCalculation.uniform_interpolator NumberCalculation.curve_fitter_stream NumberCalculation.curve_fitter_stream_sliding NumberCalculation.recursive_least_squares NumberCalculation.recursive_least_squares_reset NumberCalculation.nonlinear_solver NumberCalculation.nonlinear_equation_analytic_derivative NumberCalculation.nonlinear_equation_batch NumberCalculation.runge_kutta_ode NumberCalculation.runge_kutta_odes NumberCalculation.runge_kutta_static_odes NumberCalculation.runge_kutta_45_adaptive NumberCalculation.runge_kutta_45_event FastMathTest.sin_cos FastMathTest.atan FastMathTest.atan2 FastMathTest.batch CircularAccumulatorTest.mean_and_variance CircularAccumulatorTest.custom_period CircularAccumulatorTest.incremental_consistency Munkres.test1 Munkres.test2 Munkres.test3 MunkresEngine.cold_solve MunkresEngine.warm_start MunkresEngine.insert_erase KDTreeTest.nearest_matches_brute_force KDTreeTest.nearest_with_filter KDTreeTest.empty_and_rebuild EwTopsisTest.BasicFunction EwTopsisTest.ReuseWorkspace EwTopsisTest.CustomData DSPTest.dft DSPTest.dft_non_pow2 DSPTest.idft DSPTest.moving_average DSPTest.moving_min_max DSPTest.moving_median DSPTest.xcorr DSPTest.xcorr_lag_recovery DSPTest.psd DSPTest.resample DSPTest.goertzel DSPTest.goertzel_detector)
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/core/src/baud.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/baud.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/baud.cpp.o.d"
+  "/root/repo/modules/core/src/core.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/core.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/core.cpp.o.d"
+  "/root/repo/modules/core/src/dataio.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/dataio.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/dataio.cpp.o.d"
+  "/root/repo/modules/core/src/filewatch.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/filewatch.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/filewatch.cpp.o.d"
+  "/root/repo/modules/core/src/governor.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/governor.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/governor.cpp.o.d"
+  "/root/repo/modules/core/src/init.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/init.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/init.cpp.o.d"
+  "/root/repo/modules/core/src/io.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/io.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/io.cpp.o.d"
+  "/root/repo/modules/core/src/link.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/link.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/link.cpp.o.d"
+  "/root/repo/modules/core/src/memstat.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/memstat.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/memstat.cpp.o.d"
+  "/root/repo/modules/core/src/pmu.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/pmu.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/pmu.cpp.o.d"
+  "/root/repo/modules/core/src/serial.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/serial.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/serial.cpp.o.d"
+  "/root/repo/modules/core/src/stats.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/stats.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/stats.cpp.o.d"
+  "/root/repo/modules/core/src/statspage.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/statspage.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/statspage.cpp.o.d"
+  "/root/repo/modules/core/src/telemetry.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/telemetry.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/telemetry.cpp.o.d"
+  "/root/repo/modules/core/src/thread_pool.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/thread_pool.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/thread_pool.cpp.o.d"
+  "/root/repo/modules/core/src/topology.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/topology.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/topology.cpp.o.d"
+  "/root/repo/modules/core/src/trace.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/trace.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/trace.cpp.o.d"
+  "/root/repo/modules/core/src/tuner.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/tuner.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/tuner.cpp.o.d"
+  "/root/repo/modules/core/src/watchdog.cpp" "modules/core/CMakeFiles/rmvl_core.dir/src/watchdog.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core.dir/src/watchdog.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "../../lib/librmvl_core.a"
+  "../../lib/librmvl_core.pdb"
+  "CMakeFiles/rmvl_core.dir/src/baud.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/baud.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/core.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/core.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/dataio.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/dataio.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/filewatch.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/filewatch.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/governor.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/governor.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/init.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/init.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/io.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/io.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/link.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/link.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/memstat.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/memstat.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/pmu.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/pmu.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/serial.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/serial.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/stats.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/stats.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/statspage.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/statspage.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/telemetry.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/telemetry.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/thread_pool.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/thread_pool.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/topology.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/topology.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/trace.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/trace.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/tuner.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/tuner.cpp.o.d"
+  "CMakeFiles/rmvl_core.dir/src/watchdog.cpp.o"
+  "CMakeFiles/rmvl_core.dir/src/watchdog.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rmvl_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/core/test/test_expected.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_expected.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_expected.cpp.o.d"
+  "/root/repo/modules/core/test/test_filewatch.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_filewatch.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_filewatch.cpp.o.d"
+  "/root/repo/modules/core/test/test_governor.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_governor.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_governor.cpp.o.d"
+  "/root/repo/modules/core/test/test_imu_batch.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_imu_batch.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_imu_batch.cpp.o.d"
+  "/root/repo/modules/core/test/test_imu_history.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_imu_history.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_imu_history.cpp.o.d"
+  "/root/repo/modules/core/test/test_init.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_init.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_init.cpp.o.d"
+  "/root/repo/modules/core/test/test_io.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_io.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_io.cpp.o.d"
+  "/root/repo/modules/core/test/test_lineage.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_lineage.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_lineage.cpp.o.d"
+  "/root/repo/modules/core/test/test_memstat.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_memstat.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_memstat.cpp.o.d"
+  "/root/repo/modules/core/test/test_para_cache.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_para_cache.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_para_cache.cpp.o.d"
+  "/root/repo/modules/core/test/test_pipeline.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_pipeline.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_pipeline.cpp.o.d"
+  "/root/repo/modules/core/test/test_pmu.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_pmu.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_pmu.cpp.o.d"
+  "/root/repo/modules/core/test/test_protocol.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_protocol.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_protocol.cpp.o.d"
+  "/root/repo/modules/core/test/test_queue.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_queue.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_queue.cpp.o.d"
+  "/root/repo/modules/core/test/test_record.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_record.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_record.cpp.o.d"
+  "/root/repo/modules/core/test/test_smallvec.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_smallvec.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_smallvec.cpp.o.d"
+  "/root/repo/modules/core/test/test_stats.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_stats.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_stats.cpp.o.d"
+  "/root/repo/modules/core/test/test_statspage.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_statspage.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_statspage.cpp.o.d"
+  "/root/repo/modules/core/test/test_str.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_str.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_str.cpp.o.d"
+  "/root/repo/modules/core/test/test_thread_pool.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_thread_pool.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_thread_pool.cpp.o.d"
+  "/root/repo/modules/core/test/test_timer.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_timer.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_timer.cpp.o.d"
+  "/root/repo/modules/core/test/test_topology.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_topology.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_topology.cpp.o.d"
+  "/root/repo/modules/core/test/test_trace.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_trace.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_trace.cpp.o.d"
+  "/root/repo/modules/core/test/test_tuner.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_tuner.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_tuner.cpp.o.d"
+  "/root/repo/modules/core/test/test_watchdog.cpp" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_watchdog.cpp.o" "gcc" "modules/core/CMakeFiles/rmvl_core_test.dir/test/test_watchdog.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/modules/core/CMakeFiles/rmvl_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,60 @@
+file(REMOVE_RECURSE
+  "../../bin/rmvl_core_test"
+  "../../bin/rmvl_core_test.pdb"
+  "CMakeFiles/rmvl_core_test.dir/test/test_expected.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_expected.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_filewatch.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_filewatch.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_governor.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_governor.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_imu_batch.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_imu_batch.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_imu_history.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_imu_history.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_init.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_init.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_io.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_io.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_lineage.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_lineage.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_memstat.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_memstat.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_para_cache.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_para_cache.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_pipeline.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_pipeline.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_pmu.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_pmu.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_protocol.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_protocol.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_queue.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_queue.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_record.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_record.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_smallvec.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_smallvec.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_stats.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_stats.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_statspage.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_statspage.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_str.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_str.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_thread_pool.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_thread_pool.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_timer.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_timer.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_topology.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_topology.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_trace.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_trace.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_tuner.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_tuner.cpp.o.d"
+  "CMakeFiles/rmvl_core_test.dir/test/test_watchdog.cpp.o"
+  "CMakeFiles/rmvl_core_test.dir/test/test_watchdog.cpp.o.d"
+  "rmvl_core_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rmvl_core_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
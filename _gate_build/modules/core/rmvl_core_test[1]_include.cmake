@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_gate_build/modules/core/rmvl_core_test[1]_tests.cmake")
+  include("/root/repo/_gate_build/modules/core/rmvl_core_test[1]_tests.cmake")
+else()
+  add_test(rmvl_core_test_NOT_BUILT rmvl_core_test_NOT_BUILT)
+endif()
@@ -0,0 +1,197 @@
+add_test([=[WatchdogTest.stall_detect_and_rearm]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=WatchdogTest.stall_detect_and_rearm]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[WatchdogTest.stall_detect_and_rearm]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WatchdogTest.not_armed_before_first_beat]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=WatchdogTest.not_armed_before_first_beat]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[WatchdogTest.not_armed_before_first_beat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WatchdogTest.invalid_argument]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=WatchdogTest.invalid_argument]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[WatchdogTest.invalid_argument]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TunerTest.cpu_model]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=TunerTest.cpu_model]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[TunerTest.cpu_model]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TunerTest.select_fastest]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=TunerTest.select_fastest]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[TunerTest.select_fastest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TunerTest.cache_round_trip]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=TunerTest.cache_round_trip]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[TunerTest.cache_round_trip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TraceTest.emit_and_read]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=TraceTest.emit_and_read]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[TraceTest.emit_and_read]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TraceTest.multi_thread]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=TraceTest.multi_thread]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[TraceTest.multi_thread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TraceTest.inactive_and_restart]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=TraceTest.inactive_and_restart]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[TraceTest.inactive_and_restart]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TraceTest.format]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=TraceTest.format]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[TraceTest.format]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CpuTopologyTest.lane_configuration]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=CpuTopologyTest.lane_configuration]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[CpuTopologyTest.lane_configuration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CpuTopologyTest.bind_unconfigured_lane]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=CpuTopologyTest.bind_unconfigured_lane]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[CpuTopologyTest.bind_unconfigured_lane]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CpuTopologyTest.bind_current_thread]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=CpuTopologyTest.bind_current_thread]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[CpuTopologyTest.bind_current_thread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CpuTopologyTest.bind_other_thread]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=CpuTopologyTest.bind_other_thread]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[CpuTopologyTest.bind_other_thread]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimerTest.now]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=TimerTest.now]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[TimerTest.now]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimerTest.frame]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=TimerTest.frame]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[TimerTest.frame]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreciseWaitTest.guard_band]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=PreciseWaitTest.guard_band]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[PreciseWaitTest.guard_band]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreciseWaitTest.wait_precision]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=PreciseWaitTest.wait_precision]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[PreciseWaitTest.wait_precision]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.submit_tasks]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ThreadPoolTest.submit_tasks]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ThreadPoolTest.submit_tasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.parallel_for_covers_range]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ThreadPoolTest.parallel_for_covers_range]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ThreadPoolTest.parallel_for_covers_range]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.nested_parallel_for]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ThreadPoolTest.nested_parallel_for]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ThreadPoolTest.nested_parallel_for]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.exception_rethrown]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ThreadPoolTest.exception_rethrown]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ThreadPoolTest.exception_rethrown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.global_instance]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ThreadPoolTest.global_instance]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ThreadPoolTest.global_instance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StrTest.split_view]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=StrTest.split_view]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[StrTest.split_view]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StrTest.format_to]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=StrTest.format_to]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[StrTest.format_to]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatsPageTest.set_add_get]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=StatsPageTest.set_add_get]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[StatsPageTest.set_add_get]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatsPageTest.external_layout]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=StatsPageTest.external_layout]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[StatsPageTest.external_layout]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatsTest.record_and_summary]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=StatsTest.record_and_summary]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[StatsTest.record_and_summary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatsTest.inactive_probe_is_empty]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=StatsTest.inactive_probe_is_empty]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[StatsTest.inactive_probe_is_empty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatsTest.scoped_probe_records_once]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=StatsTest.scoped_probe_records_once]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[StatsTest.scoped_probe_records_once]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatsTest.instance_channel_isolated]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=StatsTest.instance_channel_isolated]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[StatsTest.instance_channel_isolated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatsTest.pmu_sampling]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=StatsTest.pmu_sampling]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[StatsTest.pmu_sampling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatsTest.budget_check]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=StatsTest.budget_check]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[StatsTest.budget_check]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatsTest.budget_normalization]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=StatsTest.budget_normalization]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[StatsTest.budget_normalization]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SmallVectorTest.inline_storage]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=SmallVectorTest.inline_storage]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[SmallVectorTest.inline_storage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SmallVectorTest.grow_to_heap]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=SmallVectorTest.grow_to_heap]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[SmallVectorTest.grow_to_heap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SmallVectorTest.insert_and_erase]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=SmallVectorTest.insert_and_erase]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[SmallVectorTest.insert_and_erase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SmallVectorTest.move_and_copy]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=SmallVectorTest.move_and_copy]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[SmallVectorTest.move_and_copy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SmallVectorTest.move_assign_heap_from_inline]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=SmallVectorTest.move_assign_heap_from_inline]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[SmallVectorTest.move_assign_heap_from_inline]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RecordTest.round_trip]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=RecordTest.round_trip]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[RecordTest.round_trip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RecordTest.random_access]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=RecordTest.random_access]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[RecordTest.random_access]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RecordTest.empty_file]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=RecordTest.empty_file]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[RecordTest.empty_file]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RecordTest.invalid_file]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=RecordTest.invalid_file]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[RecordTest.invalid_file]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[JournalTest.round_trip_with_compression]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=JournalTest.round_trip_with_compression]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[JournalTest.round_trip_with_compression]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[JournalTest.incompressible_frames_stored_raw]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=JournalTest.incompressible_frames_stored_raw]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[JournalTest.incompressible_frames_stored_raw]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MpmcQueueTest.basic_push_pop]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=MpmcQueueTest.basic_push_pop]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[MpmcQueueTest.basic_push_pop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MpmcQueueTest.batch_operations]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=MpmcQueueTest.batch_operations]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[MpmcQueueTest.batch_operations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MpmcQueueTest.multi_producer_multi_consumer]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=MpmcQueueTest.multi_producer_multi_consumer]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[MpmcQueueTest.multi_producer_multi_consumer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MpmcQueueTest.close_unblocks_consumer]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=MpmcQueueTest.close_unblocks_consumer]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[MpmcQueueTest.close_unblocks_consumer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpscQueueTest.basic_push_pop]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=SpscQueueTest.basic_push_pop]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[SpscQueueTest.basic_push_pop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpscQueueTest.single_producer_single_consumer]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=SpscQueueTest.single_producer_single_consumer]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[SpscQueueTest.single_producer_single_consumer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProtocolTest.crc32c_known_vector]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ProtocolTest.crc32c_known_vector]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ProtocolTest.crc32c_known_vector]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProtocolTest.encode_decode_round_trip]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ProtocolTest.encode_decode_round_trip]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ProtocolTest.encode_decode_round_trip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProtocolTest.decode_rejects_corruption]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ProtocolTest.decode_rejects_corruption]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ProtocolTest.decode_rejects_corruption]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProtocolTest.scanner_resync_on_corrupted_stream]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ProtocolTest.scanner_resync_on_corrupted_stream]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ProtocolTest.scanner_resync_on_corrupted_stream]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PmuTest.snapshot_monotonic]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=PmuTest.snapshot_monotonic]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[PmuTest.snapshot_monotonic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PmuTest.derived_metrics]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=PmuTest.derived_metrics]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[PmuTest.derived_metrics]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PmuTest.thread_local_instance]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=PmuTest.thread_local_instance]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[PmuTest.thread_local_instance]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PipelineTest.frames_in_order]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=PipelineTest.frames_in_order]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[PipelineTest.frames_in_order]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PipelineTest.drop_frames]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=PipelineTest.drop_frames]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[PipelineTest.drop_frames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PipelineTest.rerun]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=PipelineTest.rerun]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[PipelineTest.rerun]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParaCacheTest.round_trip]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ParaCacheTest.round_trip]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ParaCacheTest.round_trip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParaCacheTest.hash_mismatch]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ParaCacheTest.hash_mismatch]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ParaCacheTest.hash_mismatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParaCacheTest.incomplete_consume]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ParaCacheTest.incomplete_consume]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ParaCacheTest.incomplete_consume]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParaCacheTest.file_hash]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ParaCacheTest.file_hash]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ParaCacheTest.file_hash]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemStatTest.record_and_summary]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=MemStatTest.record_and_summary]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[MemStatTest.record_and_summary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemStatTest.inactive_no_record]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=MemStatTest.inactive_no_record]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[MemStatTest.inactive_no_record]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemStatTest.unknown_channel]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=MemStatTest.unknown_channel]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[MemStatTest.unknown_channel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MemStatTest.export_and_reset]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=MemStatTest.export_and_reset]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[MemStatTest.export_and_reset]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LineageTest.begin_mark_publish]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=LineageTest.begin_mark_publish]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[LineageTest.begin_mark_publish]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LineageTest.trace_record]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=LineageTest.trace_record]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[LineageTest.trace_record]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IOTest.corners_io]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=IOTest.corners_io]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[IOTest.corners_io]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IOTest.corner_writer]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=IOTest.corner_writer]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[IOTest.corner_writer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IOTest.pipe_io]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=IOTest.pipe_io]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[IOTest.pipe_io]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IOTest.tcp_io]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=IOTest.tcp_io]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[IOTest.tcp_io]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IOTest.shm_io]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=IOTest.shm_io]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[IOTest.shm_io]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IOTest.broadcast_io]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=IOTest.broadcast_io]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[IOTest.broadcast_io]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IOTest.broadcast_slow_consumer_skip]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=IOTest.broadcast_slow_consumer_skip]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[IOTest.broadcast_slow_consumer_skip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IOTest.telemetry_multicast]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=IOTest.telemetry_multicast]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[IOTest.telemetry_multicast]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InitTest.registrar_defers_callback]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=InitTest.registrar_defers_callback]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[InitTest.registrar_defers_callback]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InitTest.init_profile_and_idempotent]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=InitTest.init_profile_and_idempotent]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[InitTest.init_profile_and_idempotent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ImuHistoryTest.interpolated_query]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ImuHistoryTest.interpolated_query]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ImuHistoryTest.interpolated_query]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ImuHistoryTest.ring_overwrite]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ImuHistoryTest.ring_overwrite]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ImuHistoryTest.ring_overwrite]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ImuHistoryTest.concurrent_query]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ImuHistoryTest.concurrent_query]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ImuHistoryTest.concurrent_query]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ImuBatchTest.aos_round_trip]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ImuBatchTest.aos_round_trip]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ImuBatchTest.aos_round_trip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ImuBatchTest.binary_codec]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ImuBatchTest.binary_codec]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ImuBatchTest.binary_codec]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ImuBatchTest.file_round_trip]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ImuBatchTest.file_round_trip]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ImuBatchTest.file_round_trip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RateGovernorTest.threshold_validation]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=RateGovernorTest.threshold_validation]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[RateGovernorTest.threshold_validation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RateGovernorTest.level_transition_with_hysteresis]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=RateGovernorTest.level_transition_with_hysteresis]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[RateGovernorTest.level_transition_with_hysteresis]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RateGovernorTest.subscribe_notification]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=RateGovernorTest.subscribe_notification]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[RateGovernorTest.subscribe_notification]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RateGovernorTest.rate_scale]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=RateGovernorTest.rate_scale]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[RateGovernorTest.rate_scale]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileWatchTest.modify_and_unwatch]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=FileWatchTest.modify_and_unwatch]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[FileWatchTest.modify_and_unwatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FileWatchTest.create_and_rename_replace]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=FileWatchTest.create_and_rename_replace]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[FileWatchTest.create_and_rename_replace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExpectedTest.value_and_error]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ExpectedTest.value_and_error]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ExpectedTest.value_and_error]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExpectedTest.void_specialization]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ExpectedTest.void_specialization]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ExpectedTest.void_specialization]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExpectedTest.errc_to_string]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ExpectedTest.errc_to_string]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ExpectedTest.errc_to_string]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExpectedTest.diag_ring]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ExpectedTest.diag_ring]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ExpectedTest.diag_ring]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExpectedTest.diag_ring_overflow]=]  /root/repo/_gate_build/bin/rmvl_core_test [==[--gtest_filter=ExpectedTest.diag_ring_overflow]==] --gtest_also_run_disabled_tests [==[--gtest_output=xml:core-report.xml]==])
+set_tests_properties([=[ExpectedTest.diag_ring_overflow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/test-reports/unit SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  rmvl_core_test_TESTS WatchdogTest.stall_detect_and_rearm WatchdogTest.not_armed_before_first_beat WatchdogTest.invalid_argument TunerTest.cpu_model TunerTest.select_fastest TunerTest.cache_round_trip TraceTest.emit_and_read TraceTest.multi_thread TraceTest.inactive_and_restart TraceTest.format CpuTopologyTest.lane_configuration CpuTopologyTest.bind_unconfigured_lane CpuTopologyTest.bind_current_thread CpuTopologyTest.bind_other_thread TimerTest.now TimerTest.frame PreciseWaitTest.guard_band PreciseWaitTest.wait_precision ThreadPoolTest.submit_tasks ThreadPoolTest.parallel_for_covers_range ThreadPoolTest.nested_parallel_for ThreadPoolTest.exception_rethrown ThreadPoolTest.global_instance StrTest.split_view StrTest.format_to StatsPageTest.set_add_get StatsPageTest.external_layout StatsTest.record_and_summary StatsTest.inactive_probe_is_empty StatsTest.scoped_probe_records_once StatsTest.instance_channel_isolated StatsTest.pmu_sampling StatsTest.budget_check StatsTest.budget_normalization SmallVectorTest.inline_storage SmallVectorTest.grow_to_heap SmallVectorTest.insert_and_erase SmallVectorTest.move_and_copy SmallVectorTest.move_assign_heap_from_inline RecordTest.round_trip RecordTest.random_access RecordTest.empty_file RecordTest.invalid_file JournalTest.round_trip_with_compression JournalTest.incompressible_frames_stored_raw MpmcQueueTest.basic_push_pop MpmcQueueTest.batch_operations MpmcQueueTest.multi_producer_multi_consumer MpmcQueueTest.close_unblocks_consumer SpscQueueTest.basic_push_pop SpscQueueTest.single_producer_single_consumer ProtocolTest.crc32c_known_vector ProtocolTest.encode_decode_round_trip ProtocolTest.decode_rejects_corruption ProtocolTest.scanner_resync_on_corrupted_stream PmuTest.snapshot_monotonic PmuTest.derived_metrics PmuTest.thread_local_instance PipelineTest.frames_in_order PipelineTest.drop_frames PipelineTest.rerun ParaCacheTest.round_trip ParaCacheTest.hash_mismatch ParaCacheTest.incomplete_consume ParaCacheTest.file_hash MemStatTest.record_and_summary MemStatTest.inactive_no_record MemStatTest.unknown_channel MemStatTest.export_and_reset LineageTest.begin_mark_publish LineageTest.trace_record IOTest.corners_io IOTest.corner_writer IOTest.pipe_io IOTest.tcp_io IOTest.shm_io IOTest.broadcast_io IOTest.broadcast_slow_consumer_skip IOTest.telemetry_multicast InitTest.registrar_defers_callback InitTest.init_profile_and_idempotent ImuHistoryTest.interpolated_query ImuHistoryTest.ring_overwrite ImuHistoryTest.concurrent_query ImuBatchTest.aos_round_trip ImuBatchTest.binary_codec ImuBatchTest.file_round_trip RateGovernorTest.threshold_validation RateGovernorTest.level_transition_with_hysteresis RateGovernorTest.subscribe_notification RateGovernorTest.rate_scale FileWatchTest.modify_and_unwatch FileWatchTest.create_and_rename_replace ExpectedTest.value_and_error ExpectedTest.void_specialization ExpectedTest.errc_to_string ExpectedTest.diag_ring ExpectedTest.diag_ring_overflow)
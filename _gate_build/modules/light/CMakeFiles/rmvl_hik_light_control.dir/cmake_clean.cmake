@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/librmvl_hik_light_control.a"
+  "../../lib/librmvl_hik_light_control.pdb"
+  "CMakeFiles/rmvl_hik_light_control.dir/src/hik_light_control/light_control.cpp.o"
+  "CMakeFiles/rmvl_hik_light_control.dir/src/hik_light_control/light_control.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rmvl_hik_light_control.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
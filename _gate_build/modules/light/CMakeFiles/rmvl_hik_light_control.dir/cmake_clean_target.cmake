@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../../lib/librmvl_hik_light_control.a"
+)
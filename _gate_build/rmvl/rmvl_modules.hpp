@@ -0,0 +1,16 @@
+/**
+ * @file rmvl_modules.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief modules definitions (Generated by CMake automatically)
+ * 
+ * @copyright Copyright 2023 (c), zhaoxi
+ * 
+ */
+
+#pragma once
+
+#define HAVE_RMVL_ALGORITHM
+#define HAVE_RMVL_CORE
+#define HAVE_RMVL_LIGHT
+#define HAVE_RMVL_HIK_LIGHT_CONTROL
+
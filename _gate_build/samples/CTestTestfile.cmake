@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/samples
+# Build directory: /root/repo/_gate_build/samples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("camera")
+subdirs("core")
+subdirs("detector")
+subdirs("light")
+subdirs("opcua")
+subdirs("version")
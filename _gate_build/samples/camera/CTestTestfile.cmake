@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/samples/camera
+# Build directory: /root/repo/_gate_build/samples/camera
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("hik")
+subdirs("mv")
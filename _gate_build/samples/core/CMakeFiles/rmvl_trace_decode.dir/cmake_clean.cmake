@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/rmvl_trace_decode"
+  "../../bin/rmvl_trace_decode.pdb"
+  "CMakeFiles/rmvl_trace_decode.dir/trace_decode.cpp.o"
+  "CMakeFiles/rmvl_trace_decode.dir/trace_decode.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rmvl_trace_decode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/rmvl_hik_lightctl"
+  "../../bin/rmvl_hik_lightctl.pdb"
+  "CMakeFiles/rmvl_hik_lightctl.dir/hik_light.cpp.o"
+  "CMakeFiles/rmvl_hik_lightctl.dir/hik_light.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rmvl_hik_lightctl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
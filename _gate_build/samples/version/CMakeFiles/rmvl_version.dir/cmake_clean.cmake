@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/rmvl_version"
+  "../../bin/rmvl_version.pdb"
+  "CMakeFiles/rmvl_version.dir/sample_version.cpp.o"
+  "CMakeFiles/rmvl_version.dir/sample_version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rmvl_version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -292,6 +292,15 @@ else()
   option(WITH_ONNXRUNTIME "Enable onnxruntime support (dep: opencv)" OFF)
 endif()
 
+# cuda toolkit
+find_package(CUDAToolkit QUIET)
+if(CUDAToolkit_FOUND)
+  option(WITH_CUDA "Enable cuda support (dep: opencv)" ON)
+else()
+  unset(WITH_CUDA CACHE)
+  option(WITH_CUDA "Enable cuda support (dep: opencv)" OFF)
+endif()
+
 # Set the "WITH_" and "BUILD_" compilation options of 3rdparty, with "build_default_status"
 # as the default value of "BUILD_". If "BUILD_" is ON, automatically set "WITH_" to ON, otherwise,
 # by default, find the 3rdparty from the system path as the default value of "WITH_".
@@ -438,6 +447,10 @@ endif()
 # Performance tests
 option(BUILD_PERF_TESTS "Build performance tests" OFF)
 if(BUILD_PERF_TESTS)
+  set(RMVL_PERF_BASELINE_DIR "" CACHE PATH
+    "Directory of baseline JSON performance reports compared by rmvl_perf_report")
+  set(RMVL_PERF_REGRESSION_THRESHOLD "1.10" CACHE STRING
+    "Maximum allowed real_time ratio (current / baseline) before rmvl_perf_report fails")
   enable_testing()
   find_package(benchmark QUIET)
   if(NOT benchmark_FOUND)
@@ -9,6 +9,15 @@
 #   1. system_date:   获取系统日期
 # =====================================================================================
 
+# ----------------------------------------------------------------------------
+#   参数烘焙构建模式：列出的 para 目标中，具备默认值的算术与枚举类型参数将生成为
+#   constexpr 编译期常量，供优化器将阈值常量折叠进热循环；未列出的目标保持运行时
+#   可变，调参构建无需开启。取值为目标名列表（分号分隔），或 "all" 表示全部目标
+#   示例:
+#     cmake -DRMVL_PARA_BAKE="armor_detector;gravity_compensator" ..
+# ----------------------------------------------------------------------------
+set(RMVL_PARA_BAKE "" CACHE STRING "Para targets to bake into constexpr constants ('all' for every target)")
+
 # ----------------------------------------------------------------------------
 #   获取系统日期
 #   用法:
@@ -86,13 +95,14 @@ endfunction()
 #     )
 #   示例:
 #     _parse_assign(
-#       line_str         # 传入字符串: 一行的内容
-#       ret_header       # 传出字符串: 头文件内容
-#       ret_source_read  # read 函数传出字符串: 源文件内容
-#       ret_source_write # write 函数传出字符串: 源文件内容
+#       line_str           # 传入字符串: 一行的内容
+#       ret_header         # 传出字符串: 头文件内容
+#       ret_source_read    # read 函数传出字符串: 源文件内容
+#       ret_source_write   # write 函数传出字符串: 源文件内容
+#       ret_source_archive # archive 方法传出字符串: 头文件内容
 #     )
 # ----------------------------------------------------------------------------
-function(_parse_assign content_line header_line source_read_line source_write_line)
+function(_parse_assign content_line header_line source_read_line source_write_line source_archive_line)
   list(LENGTH ${content_line} l)
   if(l GREATER 1)
     # 获取值类型符号
@@ -130,6 +140,25 @@ function(_parse_assign content_line header_line source_read_line source_write_li
   else()
     return()
   endif()
+  # 常量烘焙模式：具备默认值的算术与枚举类型参数生成为 constexpr 常量，运行时加载与
+  # 二进制缓存跳过这些字段，YAML 写出保留以便检视生效值
+  if(para_bake AND NOT "${default_sym}" STREQUAL "" AND NOT type_sym MATCHES "string|vector|Point|Vec|Mat")
+    set(ret_header_line "${ret_header_line}    //! ${comment_sym} @note 已烘焙为编译期常量\n")
+    set(ret_header_line "${ret_header_line}    static constexpr ${type_sym_correct} ${id_sym} = ${default_sym};\n")
+    if(type_sym MATCHES "^bool|uint\\w*|size_t")
+      set(ret_source_write_line "${ret_source_write_line}    int tmp_${id_sym} = static_cast<int>(${id_sym});\n")
+      set(ret_source_write_line "${ret_source_write_line}    fs << \"${id_sym}\" << tmp_${id_sym};\n")
+    elseif(type_sym MATCHES "int|float|double")
+      set(ret_source_write_line "${ret_source_write_line}    fs << \"${id_sym}\" << ${id_sym};\n")
+    else()
+      set(ret_source_write_line "${ret_source_write_line}    fs << \"${id_sym}\" << t2s_${type_sym}.at(${id_sym});\n")
+    endif()
+    set(${header_line} "${ret_header_line}" PARENT_SCOPE)
+    set(${source_read_line} "${ret_source_read_line}" PARENT_SCOPE)
+    set(${source_write_line} "${ret_source_write_line}" PARENT_SCOPE)
+    set(${source_archive_line} "" PARENT_SCOPE)
+    return()
+  endif()
   # 获取 Header 部分的返回值
   set(ret_header_line "${ret_header_line}    //! ${comment_sym}\n")
   if("${default_sym}" STREQUAL "")
@@ -154,10 +183,13 @@ function(_parse_assign content_line header_line source_read_line source_write_li
     set(ret_source_read_line "${ret_source_read_line}        ${id_sym} = s2t_${type_sym}.at(tmp);\n    }\n")
     set(ret_source_write_line "${ret_source_write_line}    fs << \"${id_sym}\" << t2s_${type_sym}.at(${id_sym});\n")
   endif()
+  # 获取 archive 方法的返回值，二进制缓存按字段声明顺序序列化
+  set(ret_source_archive_line "        ar(${id_sym});\n")
   # 作用域提升
   set(${header_line} "${ret_header_line}" PARENT_SCOPE)
   set(${source_read_line} "${ret_source_read_line}" PARENT_SCOPE)
   set(${source_write_line} "${ret_source_write_line}" PARENT_SCOPE)
+  set(${source_archive_line} "${ret_source_archive_line}" PARENT_SCOPE)
 endfunction()
 
 # ----------------------------------------------------------------------------
@@ -228,13 +260,14 @@ endfunction()
 #       para_header_details  # 对应 .h/.hpp 文件的细节
 #       para_source_read     # 对应 .cpp 文件 read 函数的实现细节
 #       para_source_write    # 对应 .cpp 文件 write 函数的实现细节
+#       para_source_archive  # 对应 .h/.hpp 文件 archive 方法的实现细节
 #       para_header_enum     # 对应 .h/.hpp 文件 enum 部分的细节
 #       para_source_enum_s2t # 对应 .cpp 文件 enum 部分 string->tag 的细节
 #       para_source_enum_t2s # 对应 .cpp 文件 enum 部分 tag->string 的细节
 #       status               # 返回值: 解析是否成功，成功返回 TRUE，失败返回 FALSE
 #     )
 # ----------------------------------------------------------------------------
-function(_para_parser file_name header_details source_read source_write header_enum source_enum_s2t source_enum_t2s status)
+function(_para_parser file_name header_details source_read source_write source_archive header_enum source_enum_s2t source_enum_t2s status)
   # 初始化返回值
   file(READ ${file_name} out_val)
   if(NOT out_val)
@@ -283,6 +316,7 @@ function(_para_parser file_name header_details source_read source_write header_e
     unset(ret_header_line)
     unset(ret_source_read_line)
     unset(ret_source_write_line)
+    unset(ret_source_archive_line)
     if(line_str MATCHES "^#")
       continue()
     elseif("${parse_mode}" STREQUAL "enum")
@@ -295,10 +329,11 @@ function(_para_parser file_name header_details source_read source_write header_e
       set(ret_source_enum_s2t "${ret_source_enum_s2t}${ret_source_enum_s2t_line}")
       set(ret_source_enum_t2s "${ret_source_enum_t2s}${ret_source_enum_t2s_line}")
     else()
-      _parse_assign(line_str ret_header_line ret_source_read_line ret_source_write_line)
+      _parse_assign(line_str ret_header_line ret_source_read_line ret_source_write_line ret_source_archive_line)
       set(ret_header "${ret_header}${ret_header_line}")
       set(ret_source_read "${ret_source_read}${ret_source_read_line}")
       set(ret_source_write "${ret_source_write}${ret_source_write_line}")
+      set(ret_source_archive "${ret_source_archive}${ret_source_archive_line}")
     endif()
   endforeach(substr ${out_val})
   set(${header_enum} "${ret_header_enum}" PARENT_SCOPE)
@@ -307,6 +342,7 @@ function(_para_parser file_name header_details source_read source_write header_e
   set(${header_details} "${ret_header}" PARENT_SCOPE)
   set(${source_read} "${ret_source_read}" PARENT_SCOPE)
   set(${source_write} "${ret_source_write}" PARENT_SCOPE)
+  set(${source_archive} "${ret_source_archive}" PARENT_SCOPE)
   set(${status} TRUE PARENT_SCOPE)
 endfunction()
 
@@ -353,10 +389,22 @@ function(rmvl_generate_para target_name)
   if(target_idx EQUAL -1)
     set(RMVLPARA_${module_name} "${RMVLPARA_${module_name}}" "${target_name}" CACHE INTERNAL "${module_name} parameters")
   endif()  
+  # 该目标是否启用参数烘焙（生成 constexpr 常量）
+  if("${RMVL_PARA_BAKE}" STREQUAL "all" OR "${target_name}" IN_LIST RMVL_PARA_BAKE)
+    set(para_bake TRUE)
+    set(para_msg "${para_msg} (baked)")
+    # 标记宏，供调参路径等运行时赋值代码按构建模式条件编译
+    string(TOUPPER "${target_name}" target_upper)
+    set(para_baked_define "//! 本参数模块已烘焙为编译期常量\n#define RMVL_PARA_BAKED_${target_upper}\n\n")
+    unset(target_upper)
+  else()
+    set(para_bake FALSE)
+    set(para_baked_define "")
+  endif()
   # parse *.para file
   _para_parser(
     ${file_name}
-    para_header_details para_source_read para_source_write
+    para_header_details para_source_read para_source_write para_source_archive
     para_header_enum para_source_enum_s2t para_source_enum_t2s
     para_status
   )
@@ -364,6 +412,13 @@ function(rmvl_generate_para target_name)
     message(STATUS "${para_msg} - failed")
     return()
   endif()
+  # 参数规范哈希，用于校验二进制参数缓存与生成代码的二进制布局是否一致
+  file(MD5 "${CMAKE_CURRENT_SOURCE_DIR}/${file_name}" para_schema_md5)
+  # 烘焙模式下 archive 跳过常量字段、二进制布局改变，混入标记使两种模式的缓存互不误用
+  if(para_bake)
+    string(MD5 para_schema_md5 "bake-${para_schema_md5}")
+  endif()
+  string(SUBSTRING "${para_schema_md5}" 0 8 para_schema_hash)
   set(para_include_path)
   # has module
   if(PARA_MODULE)
@@ -391,6 +391,27 @@ function(rmvl_add_test test_name test_kind)
       WORKING_DIRECTORY "${test_report_dir}"
       COMMAND "${the_target}" --benchmark_out=${test_name}-perf-report.txt
     )
+    # JSON 格式基准报告与基线对比，通过 rmvl_perf_report 目标统一生成
+    if(NOT TARGET rmvl_perf_report)
+      add_custom_target(rmvl_perf_report
+        COMMENT "All performance reports generated in ${test_report_dir}"
+      )
+    endif()
+    set(perf_json "${test_report_dir}/${test_name}-perf-report.json")
+    add_custom_target(rmvl_${test_name}_perf_report
+      COMMAND "$<TARGET_FILE:${the_target}>"
+              --benchmark_out_format=json --benchmark_out=${perf_json}
+      COMMAND "${CMAKE_COMMAND}"
+              -DCURRENT=${perf_json}
+              -DBASELINE=${RMVL_PERF_BASELINE_DIR}/${test_name}-perf-report.json
+              -DTHRESHOLD=${RMVL_PERF_REGRESSION_THRESHOLD}
+              -P ${CMAKE_SOURCE_DIR}/cmake/RMVLPerfDiff.cmake
+      WORKING_DIRECTORY "${test_report_dir}"
+      COMMENT "Benchmarking ${the_target} (report: ${perf_json})"
+      VERBATIM
+    )
+    add_dependencies(rmvl_${test_name}_perf_report ${the_target})
+    add_dependencies(rmvl_perf_report rmvl_${test_name}_perf_report)
   endif()
 endfunction(rmvl_add_test test_name test_kind)
 
@@ -0,0 +1,80 @@
+# =====================================================================================
+# 性能基准报告对比脚本，以脚本模式运行：
+#
+#   cmake -DCURRENT=<current.json> -DBASELINE=<baseline.json>
+#         [-DTHRESHOLD=<ratio>] -P RMVLPerfDiff.cmake
+#
+# 将 Google Benchmark 的 JSON 报告与基线报告逐项对比，任一基准的 real_time 超过
+# 基线的 THRESHOLD 倍（默认 1.10，即允许 10% 波动）时以非零状态退出，使性能回归
+# 在 rmvl_perf_report 目标中直接暴露
+# =====================================================================================
+
+if(NOT EXISTS "${CURRENT}")
+  message(FATAL_ERROR "Current performance report not found: ${CURRENT}")
+endif()
+if(NOT EXISTS "${BASELINE}")
+  message(STATUS "No baseline report for comparison, skip: ${BASELINE}")
+  return()
+endif()
+# string(JSON) 自 CMake 3.19 起提供
+if(CMAKE_VERSION VERSION_LESS 3.19)
+  message(WARNING "Baseline comparison requires CMake >= 3.19, skip")
+  return()
+endif()
+if(NOT THRESHOLD)
+  set(THRESHOLD 1.10)
+endif()
+# CMake 不支持浮点运算，阈值放大 100 倍后以整数比较，如 1.10 -> 110
+if(THRESHOLD MATCHES "^([0-9]+)\\.([0-9])([0-9])?$")
+  if(CMAKE_MATCH_3 STREQUAL "")
+    set(CMAKE_MATCH_3 0)
+  endif()
+  math(EXPR threshold_x100 "${CMAKE_MATCH_1} * 100 + ${CMAKE_MATCH_2} * 10 + ${CMAKE_MATCH_3}")
+else()
+  math(EXPR threshold_x100 "${THRESHOLD} * 100")
+endif()
+
+file(READ "${CURRENT}" current_json)
+file(READ "${BASELINE}" baseline_json)
+
+# 建立基线中 name -> real_time 的映射
+string(JSON baseline_num LENGTH "${baseline_json}" benchmarks)
+if(baseline_num GREATER 0)
+  math(EXPR baseline_last "${baseline_num} - 1")
+  foreach(idx RANGE ${baseline_last})
+    string(JSON bench_name GET "${baseline_json}" benchmarks ${idx} name)
+    string(JSON bench_time GET "${baseline_json}" benchmarks ${idx} real_time)
+    string(MD5 bench_key "${bench_name}")
+    set(baseline_time_${bench_key} "${bench_time}")
+  endforeach()
+endif()
+
+# 逐项对比当前报告
+set(regressions "")
+string(JSON current_num LENGTH "${current_json}" benchmarks)
+if(current_num GREATER 0)
+  math(EXPR current_last "${current_num} - 1")
+  foreach(idx RANGE ${current_last})
+    string(JSON bench_name GET "${current_json}" benchmarks ${idx} name)
+    string(JSON bench_time GET "${current_json}" benchmarks ${idx} real_time)
+    string(MD5 bench_key "${bench_name}")
+    if(NOT DEFINED baseline_time_${bench_key})
+      message(STATUS "[new]  ${bench_name}")
+      continue()
+    endif()
+    string(REGEX REPLACE "\\..*" "" cur_int "${bench_time}")
+    string(REGEX REPLACE "\\..*" "" base_int "${baseline_time_${bench_key}}")
+    math(EXPR scaled_base "${base_int} * ${threshold_x100} / 100")
+    if(cur_int GREATER scaled_base)
+      message(STATUS "[FAIL] ${bench_name}: ${bench_time} > ${THRESHOLD} x ${baseline_time_${bench_key}}")
+      list(APPEND regressions "${bench_name}")
+    else()
+      message(STATUS "[ok]   ${bench_name}: ${bench_time} (baseline ${baseline_time_${bench_key}})")
+    endif()
+  endforeach()
+endif()
+
+if(regressions)
+  list(LENGTH regressions regression_num)
+  message(FATAL_ERROR "${regression_num} performance regression(s) against ${BASELINE}")
+endif()
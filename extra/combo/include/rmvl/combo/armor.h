@@ -47,6 +47,46 @@ enum class RobotType : uint8_t
     SENTRY      //!< 哨兵机器人
 };
 
+//! 机器人类型掩码，第 \f$i\f$ 位对应枚举值为 \f$i\f$ 的 RobotType
+using RobotTypeMask = uint16_t;
+
+/**
+ * @brief 由若干机器人类型构造掩码，可在编译期组合交战目标集合
+ * @code {.cpp}
+ * // 不与哨兵、基地交战的目标掩码
+ * constexpr auto mask = make_robot_mask({RobotType::UNKNOWN, RobotType::HERO, RobotType::ENGINEER,
+ *                                        RobotType::INFANTRY_3, RobotType::INFANTRY_4,
+ *                                        RobotType::INFANTRY_5, RobotType::OUTPOST});
+ * @endcode
+ *
+ * @param[in] types 机器人类型列表
+ * @return 机器人类型掩码
+ */
+constexpr RobotTypeMask make_robot_mask(std::initializer_list<RobotType> types)
+{
+    RobotTypeMask mask{};
+    for (auto type : types)
+        mask = static_cast<RobotTypeMask>(mask | (1u << static_cast<uint8_t>(type)));
+    return mask;
+}
+
+/**
+ * @brief 判断掩码是否包含指定机器人类型
+ *
+ * @param[in] mask 机器人类型掩码
+ * @param[in] type 机器人类型
+ * @return 是否包含
+ */
+constexpr bool robot_mask_contains(RobotTypeMask mask, RobotType type)
+{
+    return ((mask >> static_cast<uint8_t>(type)) & 1u) != 0;
+}
+
+//! 包含全部机器人类型的掩码
+constexpr RobotTypeMask ROBOT_MASK_ALL = make_robot_mask({RobotType::UNKNOWN, RobotType::HERO, RobotType::ENGINEER,
+                                                          RobotType::INFANTRY_3, RobotType::INFANTRY_4, RobotType::INFANTRY_5,
+                                                          RobotType::OUTPOST, RobotType::BASE, RobotType::SENTRY});
+
 /**
  * @brief 装甲模块组合特征
  * @note
@@ -136,6 +176,17 @@ public:
      */
     static cv::Mat getNumberROI(cv::Mat src, const_ptr p_armor);
 
+    /**
+     * @brief 根据图像中指定装甲板的信息，截取仅包含数字的 ROI，结果写入指定图像
+     * @note 预先分配好的 `dst`（如 rm::RoiBatch 的槽位视图）尺寸、类型匹配时直接
+     *       原地写入，不产生输出图像的分配与拷贝，角点信息无效时写入全零图像
+     *
+     * @param[in] src 输入图像
+     * @param[in] p_armor 指定的参考装甲板
+     * @param[out] dst ROI，尺寸为 `ROI_SIZE × ROI_SIZE`，类型为 `CV_8UC1`
+     */
+    static void getNumberROI(cv::Mat src, const_ptr p_armor, cv::Mat &dst);
+
     //! 获取组合特征宽高比
     RMVL_W float getComboRatio() { return _combo_ratio; }
     //! 获取左右灯条宽度的比值
@@ -168,6 +219,38 @@ private:
 
 inline cv::Ptr<cv::ml::SVM> Armor::_svm = nullptr;
 
+/**
+ * @brief 装甲板位姿 SoA 表
+ * @note
+ * - 以 SoA（数组结构体）布局存放当前帧所有候选装甲板的角点、平移向量与各类角度，
+ *   角度通过批量核一次性计算，匹配阶段的门控可直接索引连续数组，
+ *   无需逐对重新遍历 `combo::ptr` 指针图
+ * @note
+ * - 各缓冲区跨帧复用，容量不增长时 `build()` 不产生分配
+ */
+struct RMVL_EXPORTS ArmorPoseTable
+{
+    //! @cond
+    std::vector<double> cx, cy;             //!< 装甲板中心像素坐标
+    std::vector<double> corner_x, corner_y; //!< 装甲板角点像素坐标，第 `i` 块装甲板的第 `j` 个角点位于下标 `4i+j` 处
+    std::vector<double> tx, ty, tz;         //!< IMU 坐标系下的平移向量分量
+    std::vector<double> yaw, pitch;         //!< 装甲板中心相对角（角度制）
+    std::vector<double> pose_yaw;           //!< 姿态法向量的偏航角（角度制）
+    std::vector<double> distance;           //!< 平移向量模长
+    //! @endcond
+
+    /**
+     * @brief 从组合体列表构建位姿表
+     * @note 单次遍历指针图收集数据，相对角、姿态偏航角由批量核计算
+     *
+     * @param[in] combos 装甲板组合体列表，动态类型需为 `rm::Armor`
+     */
+    void build(const std::vector<combo::ptr> &combos);
+
+    //! 获取装甲板数目
+    std::size_t size() const { return cx.size(); }
+};
+
 /**
  * @brief 装甲板大小类型转为字符串
  *
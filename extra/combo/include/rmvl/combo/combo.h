@@ -128,7 +128,7 @@ public:
      * @param[in] tick 当前时间点，可用 `rm::Timer::now()` 获取
      * @return DefaultCombo 共享指针
      */
-    RMVL_W static inline ptr make_combo(feature::ptr p_feature, double tick) { return std::make_shared<DefaultCombo>(p_feature, tick); }
+    RMVL_W static inline ptr make_combo(feature::ptr p_feature, double tick) { return make_frame_shared<DefaultCombo>(p_feature, tick); }
 
     /**
      * @brief 从另一个组合体进行构造
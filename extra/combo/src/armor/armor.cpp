@@ -14,6 +14,8 @@
 #include "rmvl/algorithm/transform.hpp"
 #include "rmvl/combo/armor.h"
 
+#include "armor_pnp.h"
+
 #include "rmvlpara/camera/camera.h"
 #include "rmvlpara/combo/armor.h"
 
@@ -150,9 +152,9 @@ std::shared_ptr<Armor> Armor::make_combo(LightBlob::ptr p_left, LightBlob::ptr p
             return nullptr;
     }
 
-    return std::make_shared<Armor>(p_left, p_right, imu_data, tick,
-                                   width_ratio, length_ratio, corner_angle, match_error,
-                                   combo_height, combo_width, combo_ratio, armor_size_type);
+    return make_frame_shared<Armor>(p_left, p_right, imu_data, tick,
+                                    width_ratio, length_ratio, corner_angle, match_error,
+                                    combo_height, combo_width, combo_ratio, armor_size_type);
 }
 
 /**
@@ -168,15 +170,19 @@ std::shared_ptr<Armor> Armor::make_combo(LightBlob::ptr p_left, LightBlob::ptr p
 static CameraExtrinsics calculateExtrinsic(const cv::Matx33f &cameraMatrix, const cv::Matx51f &distCoeffs, const ImuData &imu_data,
                                            ArmorSizeType type, const std::vector<cv::Point2f> &corners)
 {
-    cv::Vec3f rvec;             // 旋转向量
+    cv::Matx33f rmat;           // 旋转矩阵
     cv::Vec3f tvec;             // 平移向量
     CameraExtrinsics extrinsic; // 存储相机外参
-    type == ArmorSizeType::SMALL
-        ? cv::solvePnP(para::armor_param.SMALL_ARMOR, corners, cameraMatrix, distCoeffs, rvec, tvec, false, cv::SOLVEPNP_IPPE)
-        : cv::solvePnP(para::armor_param.BIG_ARMOR, corners, cameraMatrix, distCoeffs, rvec, tvec, false, cv::SOLVEPNP_IPPE);
+    // 物方几何固定，使用预计算的闭式求解器，几何退化时回退至通用 IPPE
+    if (!ArmorPnPSolver::get(type).solve(corners, cameraMatrix, distCoeffs, rmat, tvec))
+    {
+        cv::Vec3f rvec;
+        type == ArmorSizeType::SMALL
+            ? cv::solvePnP(para::armor_param.SMALL_ARMOR, corners, cameraMatrix, distCoeffs, rvec, tvec, false, cv::SOLVEPNP_IPPE)
+            : cv::solvePnP(para::armor_param.BIG_ARMOR, corners, cameraMatrix, distCoeffs, rvec, tvec, false, cv::SOLVEPNP_IPPE);
+        cv::Rodrigues(rvec, rmat);
+    }
     // 变换为 IMU 坐标系下
-    cv::Matx33f rmat;
-    cv::Rodrigues(rvec, rmat);
     cv::Matx33f gyro_rmat;
     cv::Vec3f gyro_tvec;
     Armor::cameraConvertToImu(rmat, tvec, imu_data, gyro_rmat, gyro_tvec);
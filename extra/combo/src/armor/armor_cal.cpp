@@ -12,8 +12,10 @@
 #include <opencv2/imgproc.hpp>
 
 #include "rmvl/combo/armor.h"
+#include "rmvl/algorithm/math.hpp"
 #include "rmvl/algorithm/transform.hpp"
 
+#include "rmvlpara/camera/camera.h"
 #include "rmvlpara/combo/armor.h"
 
 namespace rm
@@ -49,9 +51,10 @@ ArmorSizeType Armor::matchArmorType()
 void Armor::imuConvertToCamera(const cv::Matx33f &gyro_rmat, const cv::Vec3f &gyro_tvec,
                                const ImuData &imu_data, cv::Matx33f &cam_rmat, cv::Vec3f &cam_tvec)
 {
-    auto rot = euler2Mat(deg2rad(imu_data.rotation.yaw), EulerAxis::Y) *
-               euler2Mat(deg2rad(-imu_data.rotation.pitch), EulerAxis::X);
-    rot = rot.inv();
+    // 以四元数组合云台姿态，单位四元数取共轭即完成求逆，避免一般矩阵求逆运算
+    auto q = euler2Quat(deg2rad(imu_data.rotation.yaw), EulerAxis::Y) *
+             euler2Quat(deg2rad(-imu_data.rotation.pitch), EulerAxis::X);
+    auto rot = q.conj().toMat();
     cam_rmat = rot * gyro_rmat;
     cam_tvec = rot * gyro_tvec;
 }
@@ -59,8 +62,9 @@ void Armor::imuConvertToCamera(const cv::Matx33f &gyro_rmat, const cv::Vec3f &gy
 void Armor::cameraConvertToImu(const cv::Matx33f &cam_rmat, const cv::Vec3f &cam_tvec,
                                const ImuData &imu_data, cv::Matx33f &gyro_rmat, cv::Vec3f &gyro_tvec)
 {
-    auto rot = euler2Mat(deg2rad(imu_data.rotation.yaw), EulerAxis::Y) *   // yaw 方向与 Y 轴欧拉角方向相同
-               euler2Mat(deg2rad(-imu_data.rotation.pitch), EulerAxis::X); // pitch 方向与 X 轴欧拉角方向相反
+    auto q = euler2Quat(deg2rad(imu_data.rotation.yaw), EulerAxis::Y) *   // yaw 方向与 Y 轴欧拉角方向相同
+             euler2Quat(deg2rad(-imu_data.rotation.pitch), EulerAxis::X); // pitch 方向与 X 轴欧拉角方向相反
+    auto rot = q.toMat();
     gyro_rmat = rot * cam_rmat;
     gyro_tvec = rot * cam_tvec;
 }
@@ -97,7 +101,74 @@ bool Armor::isContainBlob(LightBlob::ptr blob, Armor::ptr armor)
         return false;
 }
 
+void ArmorPoseTable::build(const std::vector<combo::ptr> &combos)
+{
+    std::size_t n = combos.size();
+    cx.resize(n);
+    cy.resize(n);
+    corner_x.resize(4 * n);
+    corner_y.resize(4 * n);
+    tx.resize(n);
+    ty.resize(n);
+    tz.resize(n);
+    yaw.resize(n);
+    pitch.resize(n);
+    pose_yaw.resize(n);
+    distance.resize(n);
+    if (n == 0)
+        return;
+    // 单次遍历指针图，角点、平移向量与姿态法向量收集至连续数组
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        auto p_armor = Armor::cast(combos[i]);
+        if (p_armor == nullptr)
+            RMVL_Error(RMVL_BadDynamicType, "Dynamic type of the input combo isn\'t equal to \"Armor\"");
+        cx[i] = p_armor->center().x;
+        cy[i] = p_armor->center().y;
+        const auto &corners = p_armor->corners();
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            corner_x[4 * i + j] = corners[j].x;
+            corner_y[4 * i + j] = corners[j].y;
+        }
+        const auto &tvec = p_armor->extrinsic().tvec();
+        tx[i] = tvec(0);
+        ty[i] = tvec(1);
+        tz[i] = tvec(2);
+        const auto &pose = p_armor->getPose();
+        pose_yaw[i] = pose(0);
+        distance[i] = pose(1);
+    }
+    // 相对角：中心点经逆内参矩阵变换至归一化平面，正切值批量求反正切
+    cv::Matx33f M = para::camera_param.cameraMatrix.inv();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double u = cx[i], v = cy[i];
+        yaw[i] = M(0, 0) * u + M(0, 1) * v + M(0, 2);
+        pitch[i] = M(1, 0) * u + M(1, 1) * v + M(1, 2);
+    }
+    fastmath::atan(yaw.data(), yaw.data(), n);
+    fastmath::atan(pitch.data(), pitch.data(), n);
+    // 姿态偏航角：法向量分量暂存于 pose_yaw / distance，批量求二参数反正切
+    fastmath::atan2(pose_yaw.data(), distance.data(), pose_yaw.data(), n);
+    // 角度制换算与距离计算，循环体内不含间接访问，可被编译器自动向量化
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        yaw[i] = rad2deg(yaw[i]);
+        pitch[i] = rad2deg(pitch[i]);
+        pose_yaw[i] = rad2deg(pose_yaw[i]);
+        distance[i] = std::sqrt(tx[i] * tx[i] + ty[i] * ty[i] + tz[i] * tz[i]);
+    }
+}
+
 cv::Mat Armor::getNumberROI(cv::Mat src, const_ptr p_armor)
+{
+    cv::Mat roi;
+    getNumberROI(src, p_armor, roi);
+    return roi;
+}
+
+void Armor::getNumberROI(cv::Mat src, const_ptr p_armor, cv::Mat &dst)
 {
     // 计算装甲板之间距离,该距离为获得的roi的边长
     double h_dis = p_armor->height() * para::armor_param.ROI_HEIGHT_RATIO;
@@ -105,8 +176,13 @@ cv::Mat Armor::getNumberROI(cv::Mat src, const_ptr p_armor)
 
     // 图像中的 4 个角点
     std::vector<cv::Point2f> corners = p_armor->corners();
+    // 角点信息无效时写入全零图像，预分配的 dst（如批量缓冲区槽位）不引入未初始化数据
     if (corners.size() != 4)
-        return cv::Mat();
+    {
+        if (!dst.empty())
+            dst.setTo(0);
+        return;
+    }
 
     // 从左灯条上顶点指向下顶点的单位向量
     cv::Point2f e_ver_left = (corners[0] - corners[1]) / getDistance(corners[0], corners[1]);
@@ -143,9 +219,9 @@ cv::Mat Armor::getNumberROI(cv::Mat src, const_ptr p_armor)
     // 进行透视变换
     cv::warpPerspective(src, roi, cv::getPerspectiveTransform(src_corners, goal_corners), cv::Size(w_dis, h_dis));
     cv::cvtColor(roi, roi, cv::COLOR_BGR2GRAY);
-    cv::resize(roi, roi, cv::Size(para::armor_param.ROI_SIZE, para::armor_param.ROI_SIZE));
-    cv::threshold(roi, roi, 0, 255, cv::THRESH_OTSU);
-    return roi;
+    // 缩放与二值化直接写入 dst，尺寸、类型匹配的预分配 dst 原地复用，不产生重新分配
+    cv::resize(roi, dst, cv::Size(para::armor_param.ROI_SIZE, para::armor_param.ROI_SIZE));
+    cv::threshold(dst, dst, 0, 255, cv::THRESH_OTSU);
 }
 
 } // namespace rm
@@ -0,0 +1,185 @@
+/**
+ * @file armor_pnp.cpp
+ * @author RoboMaster Vision Community
+ * @brief 固定几何平面四点 PnP 求解器
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), RoboMaster Vision Community
+ *
+ */
+
+#include <limits>
+#include <memory>
+
+#include <opencv2/calib3d.hpp>
+
+#include "armor_pnp.h"
+
+#include "rmvl/algorithm/camera_model.hpp"
+
+#include "rmvlpara/combo/armor.h"
+
+namespace rm
+{
+
+ArmorPnPSolver::ArmorPnPSolver(const std::vector<cv::Point3f> &object_points)
+{
+    if (object_points.size() != 4)
+        return;
+    for (std::size_t i = 0; i < 4; ++i)
+        _obj_pts[i] = {object_points[i].x, object_points[i].y};
+    // 物方角点需位于 z = 0 平面，且构成平行四边形（对角点之和相等），否则无法使用仿射预计算
+    for (const auto &p : object_points)
+        if (std::abs(p.z) > 1e-6f)
+            return;
+    cv::Point2d diff = _obj_pts[0] + _obj_pts[2] - _obj_pts[1] - _obj_pts[3];
+    if (std::abs(diff.x) > 1e-6 || std::abs(diff.y) > 1e-6)
+        return;
+    // 单位正方形 (0,0) (1,0) (1,1) (0,1) 到物方平行四边形的仿射映射及其逆
+    cv::Matx33d obj(_obj_pts[1].x - _obj_pts[0].x, _obj_pts[3].x - _obj_pts[0].x, _obj_pts[0].x,
+                    _obj_pts[1].y - _obj_pts[0].y, _obj_pts[3].y - _obj_pts[0].y, _obj_pts[0].y,
+                    0., 0., 1.);
+    if (std::abs(cv::determinant(obj)) < 1e-9)
+        return;
+    _iobj = obj.inv();
+    _valid = true;
+}
+
+//! 绕单位轴旋转，将 z 轴对齐至单位向量 s 的旋转矩阵（Rodrigues 闭式）
+static cv::Matx33d alignZAxis(const cv::Vec3d &s)
+{
+    // 轴为 e_z × s，转角满足 cosθ = s_z
+    cv::Vec3d axis(-s(1), s(0), 0.);
+    double sin_theta = cv::norm(axis);
+    if (sin_theta < 1e-12)
+        return s(2) > 0 ? cv::Matx33d::eye() : cv::Matx33d(-1, 0, 0, 0, -1, 0, 0, 0, 1);
+    axis /= sin_theta;
+    double cos_theta = s(2);
+    cv::Matx33d k(0., -axis(2), axis(1),
+                  axis(2), 0., -axis(0),
+                  -axis(1), axis(0), 0.);
+    return cv::Matx33d::eye() + sin_theta * k + (1. - cos_theta) * k * k;
+}
+
+//! 由归一化平面上的前两列旋转分量构造正交化的完整旋转矩阵
+static cv::Matx33d completeRotation(double a, double b, double c, double d, double r31, double r32)
+{
+    // 第一列归一化，第二列 Gram-Schmidt 正交化，第三列由叉积给出
+    cv::Vec3d c1(a, c, r31), c2(b, d, r32);
+    c1 /= cv::norm(c1);
+    c2 -= c1.dot(c2) * c1;
+    c2 /= cv::norm(c2);
+    cv::Vec3d c3 = c1.cross(c2);
+    return {c1(0), c2(0), c3(0),
+            c1(1), c2(1), c3(1),
+            c1(2), c2(2), c3(2)};
+}
+
+bool ArmorPnPSolver::solve(const std::vector<cv::Point2f> &corners, const cv::Matx33f &camera_matrix, const cv::Matx51f &dist_coeffs,
+                           cv::Matx33f &rmat, cv::Vec3f &tvec, const cv::Matx33f *prev_rmat) const
+{
+    if (!_valid || corners.size() != 4)
+        return false;
+    // 去畸变并归一化至相机平面，通过预计算的查找表完成
+    std::vector<cv::Point2f> und;
+    CameraModel::get(camera_matrix, dist_coeffs).undistort(corners, und);
+    // 单位正方形到图像四边形的单应（闭式）
+    double x0 = und[0].x, y0 = und[0].y, x1 = und[1].x, y1 = und[1].y;
+    double x2 = und[2].x, y2 = und[2].y, x3 = und[3].x, y3 = und[3].y;
+    double dx1 = x1 - x2, dx2 = x3 - x2, dy1 = y1 - y2, dy2 = y3 - y2;
+    double sx = x0 - x1 + x2 - x3, sy = y0 - y1 + y2 - y3;
+    double den = dx1 * dy2 - dy1 * dx2;
+    if (std::abs(den) < 1e-12)
+        return false;
+    double g = (sx * dy2 - sy * dx2) / den;
+    double h = (dx1 * sy - dy1 * sx) / den;
+    cv::Matx33d h_img(x1 - x0 + g * x1, x3 - x0 + h * x3, x0,
+                      y1 - y0 + g * y1, y3 - y0 + h * y3, y0,
+                      g, h, 1.);
+    // 物方平面到归一化相机平面的单应
+    cv::Matx33d H = h_img * _iobj;
+    if (std::abs(H(2, 2)) < 1e-12)
+        return false;
+    // 物方原点的投影及该点处的单应雅可比
+    double iw = 1. / H(2, 2);
+    double ux = H(0, 2) * iw, uy = H(1, 2) * iw;
+    cv::Matx22d jac((H(0, 0) - H(2, 0) * ux) * iw, (H(0, 1) - H(2, 1) * ux) * iw,
+                    (H(1, 0) - H(2, 0) * uy) * iw, (H(1, 1) - H(2, 1) * uy) * iw);
+    // --------------------------【IPPE 分解】--------------------------
+    // 将光轴旋转至原点视线方向
+    double nrm = std::sqrt(ux * ux + uy * uy + 1.);
+    cv::Matx33d rv = alignZAxis({ux / nrm, uy / nrm, 1. / nrm});
+    cv::Matx22d b_mat(rv(0, 0) - ux * rv(2, 0), rv(0, 1) - ux * rv(2, 1),
+                      rv(1, 0) - uy * rv(2, 0), rv(1, 1) - uy * rv(2, 1));
+    double det_b = b_mat(0, 0) * b_mat(1, 1) - b_mat(0, 1) * b_mat(1, 0);
+    if (std::abs(det_b) < 1e-12)
+        return false;
+    cv::Matx22d c_mat = cv::Matx22d(b_mat(1, 1), -b_mat(0, 1), -b_mat(1, 0), b_mat(0, 0)) * (1. / det_b) * jac;
+    // 尺度为 C 的最大奇异值，即物方原点深度的倒数
+    double fro = c_mat(0, 0) * c_mat(0, 0) + c_mat(0, 1) * c_mat(0, 1) + c_mat(1, 0) * c_mat(1, 0) + c_mat(1, 1) * c_mat(1, 1);
+    double det_c = c_mat(0, 0) * c_mat(1, 1) - c_mat(0, 1) * c_mat(1, 0);
+    double gamma = std::sqrt((fro + std::sqrt(std::max(fro * fro - 4. * det_c * det_c, 0.))) * 0.5);
+    if (gamma < 1e-12)
+        return false;
+    double a = c_mat(0, 0) / gamma, b = c_mat(0, 1) / gamma;
+    double c = c_mat(1, 0) / gamma, d = c_mat(1, 1) / gamma;
+    // 双解：第三行分量仅相差符号
+    double r31 = std::sqrt(std::max(1. - a * a - c * c, 0.));
+    double r32 = r31 > 1e-9 ? -(a * b + c * d) / r31 : std::sqrt(std::max(1. - b * b - d * d, 0.));
+    cv::Matx33d r_cand1 = rv * completeRotation(a, b, c, d, r31, r32);
+    cv::Matx33d r_cand2 = rv * completeRotation(a, b, c, d, -r31, -r32);
+    cv::Vec3d t(ux / gamma, uy / gamma, 1. / gamma);
+    // --------------------------【消除二义性】--------------------------
+    cv::Matx33d r_best;
+    if (prev_rmat != nullptr)
+    {
+        // 热启动：选择与上一帧旋转差异更小的解
+        const cv::Matx33d prev((*prev_rmat)(0, 0), (*prev_rmat)(0, 1), (*prev_rmat)(0, 2),
+                               (*prev_rmat)(1, 0), (*prev_rmat)(1, 1), (*prev_rmat)(1, 2),
+                               (*prev_rmat)(2, 0), (*prev_rmat)(2, 1), (*prev_rmat)(2, 2));
+        double trace1 = cv::trace(prev.t() * r_cand1);
+        double trace2 = cv::trace(prev.t() * r_cand2);
+        r_best = trace1 >= trace2 ? r_cand1 : r_cand2;
+    }
+    else
+    {
+        // 比较 4 个角点的重投影误差
+        auto reprojError = [&](const cv::Matx33d &r) {
+            double err{};
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                cv::Vec3d p = r * cv::Vec3d(_obj_pts[i].x, _obj_pts[i].y, 0.) + t;
+                if (p(2) < 1e-9)
+                    return std::numeric_limits<double>::max();
+                double du = p(0) / p(2) - und[i].x, dv = p(1) / p(2) - und[i].y;
+                err += du * du + dv * dv;
+            }
+            return err;
+        };
+        r_best = reprojError(r_cand1) <= reprojError(r_cand2) ? r_cand1 : r_cand2;
+    }
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            rmat(i, j) = static_cast<float>(r_best(i, j));
+    tvec = {static_cast<float>(t(0)), static_cast<float>(t(1)), static_cast<float>(t(2))};
+    return true;
+}
+
+const ArmorPnPSolver &ArmorPnPSolver::get(ArmorSizeType type)
+{
+    // 求解器为线程局部并以参数快照为代：热路径仅比较快照指针，参数热更新发布新快照后
+    // 各线程在下次调用时各自重新预计算，返回的引用在本线程内持续有效，不与其他线程共享
+    thread_local std::shared_ptr<const para::ArmorParam> snap;
+    thread_local ArmorPnPSolver small_solver({}), big_solver({});
+    auto cur = para::armor_snapshot();
+    if (snap != cur)
+    {
+        small_solver = ArmorPnPSolver(cur->SMALL_ARMOR);
+        big_solver = ArmorPnPSolver(cur->BIG_ARMOR);
+        snap = std::move(cur);
+    }
+    return type == ArmorSizeType::SMALL ? small_solver : big_solver;
+}
+
+} // namespace rm
@@ -0,0 +1,70 @@
+/**
+ * @file armor_pnp.h
+ * @author RoboMaster Vision Community
+ * @brief 固定几何平面四点 PnP 求解器
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), RoboMaster Vision Community
+ *
+ */
+
+#pragma once
+
+#include <array>
+
+#include "rmvl/combo/armor.h"
+
+namespace rm
+{
+
+/**
+ * @brief 固定几何平面四点 PnP 求解器
+ * @note
+ * - 装甲板的物方角点固定不变，物方侧的解算（单位正方形到物方矩形映射的逆）按装甲板尺寸
+ *   预计算一次，每帧仅需闭式求解图像四边形的单应，并作 IPPE 分解得到位姿
+ * @note
+ * - 提供由上一帧位姿热启动的求解变体，直接以旋转差异消除 IPPE 的双解二义性，
+ *   省去重投影误差比较
+ */
+class ArmorPnPSolver
+{
+public:
+    /**
+     * @brief 由物方角点构造求解器，完成物方侧的预计算
+     *
+     * @param[in] object_points 物方角点列表，需为位于 z = 0 平面的平行四边形的 4 个顶点
+     */
+    explicit ArmorPnPSolver(const std::vector<cv::Point3f> &object_points);
+
+    /**
+     * @brief 闭式求解位姿
+     *
+     * @param[in] corners 图像中的装甲板角点，与物方角点一一对应
+     * @param[in] camera_matrix 相机内参
+     * @param[in] dist_coeffs 相机畸变参数
+     * @param[out] rmat 旋转矩阵
+     * @param[out] tvec 平移向量
+     * @param[in] prev_rmat 上一帧位姿的旋转矩阵，非空时以其消除双解二义性（热启动）
+     * @return 是否求解成功，几何退化时返回 false
+     */
+    bool solve(const std::vector<cv::Point2f> &corners, const cv::Matx33f &camera_matrix, const cv::Matx51f &dist_coeffs,
+               cv::Matx33f &rmat, cv::Vec3f &tvec, const cv::Matx33f *prev_rmat = nullptr) const;
+
+    /**
+     * @brief 按装甲板尺寸获取线程局部求解器
+     * @note 物方几何仅在首次使用或参数快照更新后重新预计算，返回的引用在本线程内
+     *       持续有效，不与其他线程共享
+     *
+     * @param[in] type 装甲板尺寸类型
+     * @return 求解器
+     */
+    static const ArmorPnPSolver &get(ArmorSizeType type);
+
+private:
+    bool _valid{};                         //!< 物方几何是否满足平行四边形假设
+    cv::Matx33d _iobj;                     //!< 单位正方形到物方矩形映射的逆（预计算）
+    std::array<cv::Point2d, 4> _obj_pts{}; //!< 物方角点的平面坐标
+};
+
+} // namespace rm
@@ -52,7 +52,7 @@ Rune::ptr Rune::make_combo(RuneTarget::ptr p_target, RuneCenter::ptr p_center,
         DEBUG_PASS_("rune 2.rune_radius_ratio : pass");
     }
 
-    return std::make_shared<Rune>(p_target, p_center, imu_data, tick);
+    return make_frame_shared<Rune>(p_target, p_center, imu_data, tick);
 }
 
 Rune::Rune(RuneTarget::ptr p_target, RuneCenter::ptr p_center, const ImuData &imu_data, double tick)
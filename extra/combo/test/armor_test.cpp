@@ -100,6 +100,36 @@ TEST_F(BuildArmorTest, different_blob_tiltAngle)
     EXPECT_EQ(armor2, nullptr);
 }
 
+TEST_F(BuildArmorTest, pose_table_consistency)
+{
+    // 构造两块装甲板，批量核结果应与逐个装甲板的标量接口一致
+    LightBlob::ptr right_blob = buildBlob(0, cv::Point2f(200, 0));
+    Armor::ptr armor1 = Armor::make_combo(left_blob, right_blob, ImuData(), Timer::now());
+    Armor::ptr armor2 = Armor::make_combo(buildBlob(5), buildBlob(5, cv::Point(200, 10)), ImuData(), Timer::now());
+    ASSERT_NE(armor1, nullptr);
+    ASSERT_NE(armor2, nullptr);
+    std::vector<combo::ptr> combos = {armor1, armor2};
+    ArmorPoseTable table;
+    table.build(combos);
+    ASSERT_EQ(table.size(), 2u);
+    for (std::size_t i = 0; i < combos.size(); ++i)
+    {
+        auto p_armor = Armor::cast(combos[i]);
+        EXPECT_NEAR(table.cx[i], p_armor->center().x, 1e-4);
+        EXPECT_NEAR(table.cy[i], p_armor->center().y, 1e-4);
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            EXPECT_NEAR(table.corner_x[4 * i + j], p_armor->corners()[j].x, 1e-4);
+            EXPECT_NEAR(table.corner_y[4 * i + j], p_armor->corners()[j].y, 1e-4);
+        }
+        EXPECT_NEAR(table.yaw[i], p_armor->getRelativeAngle().x, 1e-3);
+        EXPECT_NEAR(table.pitch[i], p_armor->getRelativeAngle().y, 1e-3);
+        const auto &pose = p_armor->getPose();
+        EXPECT_NEAR(table.pose_yaw[i], rad2deg(std::atan2(pose(0), pose(1))), 1e-3);
+        EXPECT_NEAR(table.distance[i], cv::norm(p_armor->extrinsic().tvec()), 1e-3);
+    }
+}
+
 TEST_F(BuildArmorTest, different_blob_angle)
 {
     LightBlob::ptr right_blob;
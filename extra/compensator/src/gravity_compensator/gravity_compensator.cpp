@@ -9,6 +9,8 @@
  *
  */
 
+#include <algorithm>
+
 #include "rmvlpara/compensator/gravity_compensator.h"
 
 #include "gravity_impl.h"
@@ -30,40 +32,27 @@ GravityCompensator::Impl::Impl() : _yaw_static_com(para::gravity_compensator_par
 {
     using para::gravity_compensator_param;
     double tmp = gravity_compensator_param.rho * gravity_compensator_param.A * gravity_compensator_param.V / (2 * gravity_compensator_param.m);
-    double a22 = -tmp * gravity_compensator_param.Cd;
-    double a24 = -tmp * gravity_compensator_param.Cl;
-    double a42 = -a24, a44 = a22;
-
-    Odes fs(4);
-    fs[0] = [](double, const std::valarray<double> &x) { return x[1]; };
-    fs[1] = [=](double, const std::valarray<double> &x) { return a22 * x[1] + a24 * x[3]; };
-    fs[2] = [](double, const std::valarray<double> &x) { return x[3]; };
-    fs[3] = [=](double, const std::valarray<double> &x) { return a42 * x[1] + a44 * x[3] - gravity_compensator_param.g; };
-    _rk = std::make_unique<RungeKutta2>(fs);
+    _a22 = -tmp * gravity_compensator_param.Cd;
+    _a24 = -tmp * gravity_compensator_param.Cl;
+    _a42 = -_a24, _a44 = _a22;
 }
 
 std::pair<double, double> GravityCompensator::Impl::bulletModel(double x, double v, double angle)
 {
-    // 预估子弹飞行时间，并延长 15%
+    using para::gravity_compensator_param;
+    // 弹道方程组，状态为 [x, vx, y, vy]，右端函数对象在栈上构造并可被完全内联
+    auto fs = [this](double, const std::array<double, 4> &s) {
+        return std::array<double, 4>{s[1], _a22 * s[1] + _a24 * s[3], s[3],
+                                     _a42 * s[1] + _a44 * s[3] - para::gravity_compensator_param.g};
+    };
+    // 预估子弹飞行时间，并延长 15% 作为积分上限
     double t_pre{x / (v * cos(angle)) * 1.15};
-    // 使用 RK2 方法计算较长一段时间的弹道轨迹
-    _rk->init(0, {0, v * cos(angle), 0, v * sin(angle)});
-    auto res = _rk->solve(para::gravity_compensator_param.h, static_cast<size_t>(std::floor(t_pre / para::gravity_compensator_param.h)));
-    // 在计算出的结果中根据 res[0] 二分查找最接近 x 的解
-    size_t l{res.size() >> 1}, r{res.size() - 1};
-    for (int i = 0; i < 2 * log2(res.size()); i++)
-    {
-        if (l == r)
-            break;
-        size_t m = (l + r) >> 1;
-        res[m][0] < x ? (l = m + 1) : (r = m);
-    }
-    // 线性插值，获取 x 对应的落点高度 y 以及对应的子弹飞行时间 t
-    size_t i1 = res[l][0] < x ? l : l - 1;
-    size_t i2 = res[l][0] < x ? l + 1 : l;
-    double retval_y = res[i1][2] + (res[i2][2] - res[i1][2]) / (res[i2][0] - res[i1][0]) * (x - res[i1][0]);
-    double retval_t = (i1 + (x - res[i1][0]) / (res[i2][0] - res[i1][0])) * para::gravity_compensator_param.h;
-    return {retval_y, retval_t};
+    // 自适应步长积分：弹道平缓段放大步长、接近落点处细化步长，水平位移到达 x 的
+    // 事件在步内由 Hermite 插值定位，无需整条轨迹的稠密解与二分查找
+    RungeKutta45T rk(fs, 0., std::array<double, 4>{0., v * cos(angle), 0., v * sin(angle)},
+                     gravity_compensator_param.ODE_RTOL, gravity_compensator_param.ODE_ATOL);
+    auto [t, s] = rk.solveUntil([x](double, const std::array<double, 4> &s) { return s[0] - x; }, t_pre);
+    return {s[2], t};
 }
 
 std::pair<double, double> GravityCompensator::Impl::calc(double x, double y, double velocity)
@@ -86,6 +75,51 @@ std::pair<double, double> GravityCompensator::Impl::calc(double x, double y, dou
     return {angle, t};
 }
 
+void GravityCompensator::Impl::buildTable()
+{
+    using para::gravity_compensator_param;
+    _lut_dis_num = static_cast<size_t>(std::floor((gravity_compensator_param.LUT_DIS_MAX - gravity_compensator_param.LUT_DIS_MIN) /
+                                                  gravity_compensator_param.LUT_DIS_STEP)) + 1;
+    _lut_speed_num = static_cast<size_t>(std::floor((gravity_compensator_param.LUT_SPEED_MAX - gravity_compensator_param.LUT_SPEED_MIN) /
+                                                    gravity_compensator_param.LUT_SPEED_STEP)) + 1;
+    _lut_angle.assign(_lut_speed_num * _lut_dis_num, 0.);
+    _lut_tof.assign(_lut_speed_num * _lut_dis_num, 0.);
+    // 以水平射击弹道为基准，逐网格点迭代解算补偿角度与子弹飞行时间
+    for (size_t i = 0; i < _lut_speed_num; ++i)
+    {
+        double v = gravity_compensator_param.LUT_SPEED_MIN + static_cast<double>(i) * gravity_compensator_param.LUT_SPEED_STEP;
+        for (size_t j = 0; j < _lut_dis_num; ++j)
+        {
+            double x = gravity_compensator_param.LUT_DIS_MIN + static_cast<double>(j) * gravity_compensator_param.LUT_DIS_STEP;
+            auto [angle, t] = calc(x, 0., v);
+            _lut_angle[i * _lut_dis_num + j] = angle;
+            _lut_tof[i * _lut_dis_num + j] = t;
+        }
+    }
+}
+
+std::pair<double, double> GravityCompensator::Impl::lookup(double x, double velocity) const
+{
+    using para::gravity_compensator_param;
+    // 网格外的查询收缩至边界后插值
+    double fx = std::clamp((x - gravity_compensator_param.LUT_DIS_MIN) / gravity_compensator_param.LUT_DIS_STEP,
+                           0., static_cast<double>(_lut_dis_num - 1));
+    double fv = std::clamp((velocity - gravity_compensator_param.LUT_SPEED_MIN) / gravity_compensator_param.LUT_SPEED_STEP,
+                           0., static_cast<double>(_lut_speed_num - 1));
+    size_t j = std::min(static_cast<size_t>(fx), _lut_dis_num - 1);
+    size_t i = std::min(static_cast<size_t>(fv), _lut_speed_num - 1);
+    size_t j1 = std::min(j + 1, _lut_dis_num - 1);
+    size_t i1 = std::min(i + 1, _lut_speed_num - 1);
+    double ax = fx - static_cast<double>(j), av = fv - static_cast<double>(i);
+    // 双线性插值
+    auto bilerp = [&](const std::vector<double> &lut) {
+        double r0 = (1 - ax) * lut[i * _lut_dis_num + j] + ax * lut[i * _lut_dis_num + j1];
+        double r1 = (1 - ax) * lut[i1 * _lut_dis_num + j] + ax * lut[i1 * _lut_dis_num + j1];
+        return (1 - av) * r0 + av * r1;
+    };
+    return {bilerp(_lut_angle), bilerp(_lut_tof)};
+}
+
 void GravityCompensator::Impl::updateStaticCom(CompensateType com_flag, float &x_st, float &y_st)
 {
     float com_step = para::gravity_compensator_param.MINIMUM_COM;
@@ -117,6 +151,9 @@ CompensateInfo GravityCompensator::Impl::compensate(const std::vector<group::ptr
     CompensateInfo info{};
     // 补偿手动调节
     updateStaticCom(com_flag, _yaw_static_com, _pitch_static_com);
+    // 启用查找表时在首次使用前构建
+    if (para::gravity_compensator_param.ENABLE_LUT && _lut_angle.empty())
+        buildTable();
     // 对每个序列组的每个追踪器按照一种方式进行补偿计算
     for (auto &p_group : groups)
     {
@@ -130,7 +167,16 @@ CompensateInfo GravityCompensator::Impl::compensate(const std::vector<group::ptr
             // 目标与云台转轴的连线与水平方向的夹角
             double angle = gyro_angle.y + p_tracker->getRelativeAngle().y;
             // 计算补偿角度和对应的子弹飞行时间（模型中角度要求向上为正，这里需取反）
-            auto [angle_com, t_com] = calc(dis * cos(deg2rad(-angle)), dis * sin(deg2rad(-angle)), shoot_speed);
+            std::pair<double, double> com{};
+            if (para::gravity_compensator_param.ENABLE_LUT)
+            {
+                // 查找表以水平射击弹道为基准，查询得到相对视线方向的补偿角度后叠加视线仰角
+                com = lookup(dis * cos(deg2rad(-angle)), shoot_speed);
+                com.first += deg2rad(-angle);
+            }
+            else
+                com = calc(dis * cos(deg2rad(-angle)), dis * sin(deg2rad(-angle)), shoot_speed);
+            auto [angle_com, t_com] = com;
             double gp = rad2deg(-angle_com);
             double x_com = _yaw_static_com;
             double y_com = gp - angle + _pitch_static_com;
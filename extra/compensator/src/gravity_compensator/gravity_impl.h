@@ -26,10 +26,29 @@ class GravityCompensator::Impl
 public:
     Impl();
 
-    //! 补偿函数，考虑空气阻力，使用 2 阶龙格库塔方法（中点公式）计算弹道
+    //! 补偿函数，考虑空气阻力，使用自适应步长 Dormand-Prince 5(4) 方法计算弹道
     CompensateInfo compensate(const std::vector<group::ptr> &groups, float shoot_speed, CompensateType com_flag);
 
+    /**
+     * @brief 构建弹道查找表
+     * @note
+     * - 在（水平距离，枪口射速）二维网格上以水平射击弹道为基准预解算（补偿角度，子弹飞行时间），
+     *   网格范围与步长由 `para::gravity_compensator_param` 中的 `LUT_*` 参数给出
+     * @note
+     * - 启用查找表后，单次补偿查询由迭代弹道解算退化为一次双线性插值，适用于逐帧对多个目标进行
+     *   补偿的场合，表格以水平射击弹道为基准，目标俯仰角较大时与迭代解算存在少量偏差
+     */
+    void buildTable();
+
 private:
+    /**
+     * @brief 查找表双线性插值查询
+     *
+     * @param[in] x 目标离相机的水平距离，单位 `m`
+     * @param[in] velocity 枪口射速，单位 `m/s`
+     * @return 补偿角度（向上为正，单位 `rad`）、子弹飞行时间的二元组
+     */
+    std::pair<double, double> lookup(double x, double velocity) const;
     /**
      * @brief 弹道模型
      *
@@ -63,7 +82,16 @@ private:
      */
     std::pair<double, double> calc(double x, double y, double velocity);
 
-    std::unique_ptr<RungeKutta2> _rk; //!< 2 阶龙格库塔求解器
+    // 弹道方程组 [x, vx, y, vy]' 的线性系数，由物理参数在构造时解算
+    double _a22{}; //!< 水平速度的阻力项系数
+    double _a24{}; //!< 水平速度的升力项系数
+    double _a42{}; //!< 铅垂速度的升力项系数
+    double _a44{}; //!< 铅垂速度的阻力项系数
+
+    std::vector<double> _lut_angle; //!< 补偿角度查找表（射速行 × 距离列，行优先）
+    std::vector<double> _lut_tof;   //!< 子弹飞行时间查找表（射速行 × 距离列，行优先）
+    std::size_t _lut_dis_num{};     //!< 查找表距离采样点数
+    std::size_t _lut_speed_num{};   //!< 查找表射速采样点数
 };
 
 } // namespace rm
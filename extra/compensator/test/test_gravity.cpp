@@ -42,6 +42,17 @@ TEST(GravityCompensator, bulletModel)
     EXPECT_NEAR(t, t_fric, 5e-2);
 }
 
+TEST(GravityCompensator, ballisticLUT)
+{
+    rm::GravityCompensator::Impl impl;
+    impl.buildTable();
+    // 网格点外的查询与迭代解算结果一致（双线性插值误差范围内）
+    auto [angle_lut, t_lut] = impl.lookup(6.66, 15.3);
+    auto [angle_ref, t_ref] = impl.calc(6.66, 0., 15.3);
+    EXPECT_NEAR(angle_ref, angle_lut, 1e-3);
+    EXPECT_NEAR(t_ref, t_lut, 1e-3);
+}
+
 } // namespace rm_test
 
 #endif // HAVE_RMVL_GRAVITY_COMPENSATOR
@@ -11,7 +11,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
 #include "rmvl/compensator/compensator.h"
+#include "rmvl/core/stats.hpp"
 #include "rmvl/detector/detector.h"
 #include "rmvl/predictor/predictor.h"
 
@@ -36,6 +41,27 @@ struct DecideInfo
     bool can_shoot = false;   //!< 能否射击
 };
 
+/**
+ * @brief 候选目标评分数据
+ * @note
+ * - 按 SoA 方式组织，同一评分数据在所有候选目标下的取值连续存放，评分核函数可在单次扫描中
+ *   完成全体候选目标的打分，避免各决策模块分别遍历序列组时重复解算目标几何信息
+ */
+struct ScoreDatas
+{
+    std::vector<tracker::ptr> trackers; //!< 候选追踪器
+    std::vector<group::ptr> groups;     //!< 候选追踪器所属的序列组
+    std::vector<float> distances;       //!< 候选追踪器与相机的距离，单位 `mm`
+    std::vector<float> angle_costs;     //!< 预测后相对目标转角的模长（角度制）
+};
+
+/**
+ * @brief 候选目标评分核函数
+ * @note 为每个候选目标写出得分，得分最高的候选目标视为最优目标，传入的得分向量已清零，
+ *       长度与候选追踪器数目一致
+ */
+using ScoreKernel = std::function<void(const ScoreDatas &, std::vector<float> &)>;
+
 //! 目标决策模块
 class decider
 {
@@ -60,6 +86,93 @@ public:
     virtual DecideInfo decide(const std::vector<group::ptr> &groups, const StateInfo &flag,
                               tracker::ptr last_target, const DetectInfo &detect_info,
                               const CompensateInfo &compensate_info, const PredictInfo &predict_info) = 0;
+
+    /**
+     * @brief 收集候选目标评分数据
+     * @note 遍历所有序列组的所有追踪器，统一收集距离、转角代价等评分数据，转角代价在预测模块
+     *       已有结果的基础上叠加动态、静态响应预测增量，不重复进行目标几何解算
+     *
+     * @param[in] groups 所有序列组
+     * @param[in] predict_info 预测模块信息
+     * @return 候选目标评分数据
+     */
+    static ScoreDatas collectScoreDatas(const std::vector<group::ptr> &groups, const PredictInfo &predict_info)
+    {
+        ScoreDatas datas{};
+        for (const auto &p_group : groups)
+        {
+            for (const auto &p_tracker : p_group->data())
+            {
+                datas.trackers.push_back(p_tracker);
+                datas.groups.push_back(p_group);
+                datas.distances.push_back(p_tracker->extrinsic().distance());
+                cv::Point2f angle = p_tracker->getRelativeAngle();
+                if (auto it = predict_info.dynamic_prediction.find(p_tracker); it != predict_info.dynamic_prediction.end())
+                    angle += cv::Point2f(static_cast<float>(it->second(YAW)), static_cast<float>(it->second(PITCH)));
+                if (auto it = predict_info.static_prediction.find(p_tracker); it != predict_info.static_prediction.end())
+                    angle += cv::Point2f(static_cast<float>(it->second(YAW)), static_cast<float>(it->second(PITCH)));
+                datas.angle_costs.push_back(std::sqrt(angle.x * angle.x + angle.y * angle.y));
+            }
+        }
+        return datas;
+    }
+
+    /**
+     * @brief 批量评分决策
+     * @note 一次性收集所有候选目标的评分数据，并调用评分核函数在单次扫描中完成打分，
+     *       返回得分最高的候选追踪器
+     *
+     * @param[in] groups 所有序列组
+     * @param[in] predict_info 预测模块信息
+     * @param[in] kernel 候选目标评分核函数
+     * @return 得分最高的候选追踪器，无候选目标时返回空指针
+     */
+    static tracker::ptr decideBatch(const std::vector<group::ptr> &groups, const PredictInfo &predict_info, const ScoreKernel &kernel)
+    {
+        auto datas = collectScoreDatas(groups, predict_info);
+        if (datas.trackers.empty())
+            return nullptr;
+        std::vector<float> scores(datas.trackers.size());
+        kernel(datas, scores);
+        return datas.trackers[std::max_element(scores.begin(), scores.end()) - scores.begin()];
+    }
+
+    /**
+     * @brief 默认评分核函数
+     * @note 按距离（以 `m` 计）与转角代价（角度制）等权相加取负作为得分，即距离更近、
+     *       预测后更接近准星的候选目标优先
+     *
+     * @param[in] datas 候选目标评分数据
+     * @param[out] scores 候选目标得分
+     */
+    static void defaultScoreKernel(const ScoreDatas &datas, std::vector<float> &scores)
+    {
+        size_t candidate_num = scores.size();
+        for (size_t i = 0; i < candidate_num; ++i)
+            scores[i] = -datas.distances[i] * 1e-3f;
+        for (size_t i = 0; i < candidate_num; ++i)
+            scores[i] -= datas.angle_costs[i];
+    }
+
+protected:
+    /**
+     * @brief 创建作用域耗时探针，供派生类在 `decide` 入口处使用
+     * @note 统计通道按实例区分，统计未启动时返回空探针，仅付出一次原子读的开销
+     *
+     * @param[in] depth 当前队列深度，一般为序列组数目
+     * @return 作用域耗时探针
+     */
+    stats::Probe probe(std::size_t depth = 0) const
+    {
+        if (!stats::active())
+            return {};
+        if (_stage_stats == nullptr)
+            _stage_stats = &stats::instanceChannel("decider", this);
+        return {*_stage_stats, depth};
+    }
+
+private:
+    mutable stats::StageStats *_stage_stats{}; //!< 实例级统计通道
 };
 
 //! @} decider
@@ -53,6 +53,16 @@ public:
     //! 构造 GyroDecider
     static inline std::unique_ptr<GyroDecider> make_decider() { return std::make_unique<GyroDecider>(); }
 
+    /**
+     * @brief 考虑旋转状态的评分核函数
+     * @note 在默认评分核函数的基础上，对处于高速旋转状态的序列组按旋转速度施加额外的评分
+     *       惩罚，即同等距离、转角代价下优先选择旋转更慢、更易命中的目标
+     *
+     * @param[in] datas 候选目标评分数据
+     * @param[out] scores 候选目标得分
+     */
+    static void rotationScoreKernel(const ScoreDatas &datas, std::vector<float> &scores);
+
 private:
     /**
      * @brief 在指定的 group 中获取最近的目标追踪器
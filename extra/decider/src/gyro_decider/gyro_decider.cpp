@@ -105,10 +105,24 @@ static cv::Point2f calculateHighSpeedBasicResponse(group::ptr target_group, trac
                                                                           pitch_min * (1 - para::gyro_decider_param.PITCH_RESPONSE_AMP))};
 }
 
+void GyroDecider::rotationScoreKernel(const ScoreDatas &datas, std::vector<float> &scores)
+{
+    decider::defaultScoreKernel(datas, scores);
+    // 高速旋转的序列组按旋转速度施加额外惩罚
+    size_t candidate_num = scores.size();
+    for (size_t i = 0; i < candidate_num; ++i)
+    {
+        auto p_gyro_group = GyroGroup::cast(datas.groups[i]);
+        if (p_gyro_group != nullptr && p_gyro_group->getRotStatus() == RotStatus::HIGH_ROT_SPEED)
+            scores[i] -= std::abs(p_gyro_group->getRotatedSpeed());
+    }
+}
+
 DecideInfo GyroDecider::decide(const std::vector<group::ptr> &groups, const StateInfo &,
                                tracker::ptr last_target, const DetectInfo &,
                                const CompensateInfo &compensate_info, const PredictInfo &predict_info)
 {
+    auto stats_probe = probe(groups.size());
     // 决策信息
     DecideInfo info{};
     // 若没有序列组，则返回
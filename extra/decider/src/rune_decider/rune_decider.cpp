@@ -51,6 +51,7 @@ DecideInfo RuneDecider::decide(const std::vector<group::ptr> &groups, const Stat
                                tracker::ptr last_target, const DetectInfo &,
                                const CompensateInfo &compensate_info, const PredictInfo &predict_info)
 {
+    auto stats_probe = probe(groups.size());
     // 决策信息
     DecideInfo info{};
     if (groups.size() != 1)
@@ -22,6 +22,7 @@ DecideInfo TranslationDecider::decide(const std::vector<group::ptr> &groups, con
                                       const DetectInfo &detect_info, const CompensateInfo &compensate_info,
                                       const PredictInfo &predict_info)
 {
+    auto stats_probe = probe(groups.size());
     // 决策信息
     DecideInfo info{};
     std::vector<tracker::ptr> trackers;
@@ -13,6 +13,7 @@
 
 #include "detector.h"
 
+#include "rmvl/core/smallvec.hpp"
 #include "rmvl/ml/ort.h"
 #include "rmvl/tracker/planar_tracker.h"
 
@@ -28,8 +29,18 @@ namespace rm
 //! 装甲板识别模块
 class RMVL_EXPORTS_W_DEU ArmorDetector final : public detector
 {
+    //! 已确认类型的追踪目标提示，用于分类缓存
+    struct TypeHint
+    {
+        cv::Point2f center; //!< 追踪目标最近一帧的中心
+        RobotType robot;    //!< 已确认的装甲板类型
+    };
+
     std::unique_ptr<OnnxNet> _ort;
     std::unordered_map<int, RobotType> _robot_t;
+    int _frame_cnt{};    //!< 帧计数，用于增量搜索的周期性全图扫描
+    RoiBatch _roi_batch; //!< 数字 ROI 批量缓冲区，跨帧复用，容量不增长时不产生分配
+    std::vector<TypeHint> _type_hints; //!< 当前帧的分类缓存提示，由稳定追踪器逐帧重建
 
 public:
     //! @cond
@@ -51,6 +62,9 @@ public:
      */
     RMVL_W DetectInfo detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick) override;
 
+    //! @brief 识别接口（写入式），参见 rm::detector::detect
+    void detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick, DetectInfo &info) override;
+
     //! 构建 ArmorDetector
     RMVL_W static inline auto make_detector() { return std::make_unique<ArmorDetector>(); }
 
@@ -69,8 +83,9 @@ private:
      * @param[out] features 找到的特征列表
      * @param[out] combos 找到的组合体列表
      * @param[out] rois 找到的组合体对应的 ROI 列表
+     * @param[in] seeds 增量搜索的候选区域，为空时全图搜索
      */
-    void find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos, std::vector<cv::Mat> &rois);
+    void find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos, std::vector<cv::Mat> &rois, const std::vector<cv::Rect> &seeds = {});
 
     /**
      * @brief 匹配、更新时间序列
@@ -80,6 +95,15 @@ private:
      */
     void match(std::vector<group::ptr> &groups, const std::vector<combo::ptr> &combos);
 
+    /**
+     * @brief 从稳定追踪器收集已确认类型的分类缓存提示
+     * @note 追踪器最近 `armor_detector_param.CLASSIFY_CONFIRM_FRAMES` 帧的分类结果一致时类型视为已确认，
+     *       命中提示的装甲板在 @ref find 中跳过数字分类，直接沿用追踪器类型
+     *
+     * @param[in] groups 所有序列组
+     */
+    void collectTypeHints(const std::vector<group::ptr> &groups);
+
     /**
      * @brief 寻找灯条
      *
@@ -87,7 +111,16 @@ private:
      *
      * @return 找到的灯条
      */
-    std::vector<LightBlob::ptr> findLightBlobs(cv::Mat &bin);
+    SmallVector<LightBlob::ptr, 32> findLightBlobs(cv::Mat &bin);
+
+    /**
+     * @brief 在候选区域内寻找灯条
+     *
+     * @param[in] bin 二值图
+     * @param[in] seeds 候选搜索区域
+     * @return 找到的灯条
+     */
+    SmallVector<LightBlob::ptr, 32> findLightBlobs(cv::Mat &bin, const std::vector<cv::Rect> &seeds);
 
     /**
      * @brief 匹配装甲板
@@ -95,14 +128,14 @@ private:
      * @param[in] light_blobs 找到的灯条（函数内部会对此进行排序）
      * @return 当前帧找到的所有装甲板
      */
-    std::vector<Armor::ptr> findArmors(std::vector<LightBlob::ptr> &light_blobs);
+    SmallVector<Armor::ptr, 8> findArmors(SmallVector<LightBlob::ptr, 32> &light_blobs);
 
     /**
      * @brief 在多个装甲板共享同一个灯条时，根据匹配误差移除装甲板
      *
      * @param[in out] armors 待筛选的所有装甲板
      */
-    void eraseErrorArmors(std::vector<Armor::ptr> &armors);
+    void eraseErrorArmors(SmallVector<Armor::ptr, 8> &armors);
 
     /**
      * @brief 删除强光误识别的灯条
@@ -110,14 +143,14 @@ private:
      * @param[in] src 原图像
      * @param[in out] blobs 所有灯条
      */
-    void eraseBrightBlobs(cv::Mat src, std::vector<LightBlob::ptr> &blobs);
+    void eraseBrightBlobs(cv::Mat src, SmallVector<LightBlob::ptr, 32> &blobs);
 
     /**
      * @brief 删除因数字识别未正确识别导致的假装甲板
      *
      * @param[in out] armors 所有装甲板
      */
-    void eraseFakeArmors(std::vector<Armor::ptr> &armors);
+    void eraseFakeArmors(SmallVector<Armor::ptr, 8> &armors);
 
     /**
      * @brief 装甲板匹配至时间序列
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "rmvl/core/stats.hpp"
 #include "rmvl/group/group.h"
 
 #include "rmvl/algorithm/pretreat.hpp"
@@ -33,19 +34,66 @@ struct RMVL_EXPORTS_W_AG DetectInfo
     RMVL_W_RW cv::Mat src;               //!< 原图
     RMVL_W_RW cv::Mat gray;              //!< 灰度图列表
     RMVL_W_RW cv::Mat bin;               //!< 二值图列表
-    RMVL_W_RW std::vector<cv::Mat> rois; //!< ROI 列表
+    RMVL_W_RW std::vector<cv::Mat> rois; //!< ROI 列表，可为批量缓冲区的槽位视图，在下一帧识别前有效
     RMVL_W_RW cv::Mat rendergraph;       //!< 渲染图
 
     RMVL_W_RW std::vector<combo::ptr> combos;     //!< 当前帧所有组合体
     RMVL_W_RW std::vector<feature::ptr> features; //!< 当前帧所有特征
+
+    /**
+     * @brief 清空各列表并保留既有容量
+     * @note 图像成员为引用计数共享，由下一帧识别覆盖，无需显式释放
+     */
+    void clear()
+    {
+        rois.clear();
+        combos.clear();
+        features.clear();
+    }
+};
+
+/**
+ * @brief 识别信息双缓冲
+ * @note
+ * - 用于识别线程与消费线程之间的帧间交接：消费线程读取第 N 帧结果的同时，
+ *   识别线程向写缓冲区填充第 N+1 帧，交接仅翻转缓冲区下标，不发生拷贝
+ * @warning 本身不含同步机制，`swap()` 需在帧边界处、两侧线程均不访问缓冲区时调用
+ */
+class DetectInfoBuffer
+{
+    DetectInfo _infos[2];     //!< 双缓冲区
+    std::size_t _write_idx{}; //!< 写缓冲区下标
+
+public:
+    //! 获取写缓冲区，供识别线程通过写入式 `detect` 填充
+    DetectInfo &writeBuffer() { return _infos[_write_idx]; }
+    //! 获取读缓冲区，供消费线程读取上一帧识别结果
+    const DetectInfo &readBuffer() const { return _infos[_write_idx ^ 1]; }
+    //! 交换读写缓冲区，在帧边界处调用
+    void swap() { _write_idx ^= 1; }
+};
+
+/**
+ * @brief 识别模块帧间复用工作区
+ * @note
+ * - 持有二值图、轮廓缓冲区等每帧临时数据，由识别模块跨帧复用，`cv::Mat::create` 与
+ *   `std::vector` 在尺寸不增长时不会重新分配，逐帧识别不再产生分配释放开销
+ * @warning 工作区缓冲区在下一帧被覆盖，`DetectInfo` 中与之共享存储的图像仅在当帧内有效
+ */
+struct FindWorkspace
+{
+    cv::Mat bin;                                  //!< 二值图像缓冲区
+    std::vector<std::vector<cv::Point>> contours; //!< 轮廓二维向量缓冲区
+    std::vector<cv::Vec4i> hierarchy;             //!< 轮廓等级向量缓冲区
 };
 
 //! 识别检测模块
 class RMVL_EXPORTS_W_ABU detector
 {
 protected:
-    double _tick;      //!< 每一帧对应的时间点
-    ImuData _imu_data; //!< 每一帧对应的 IMU 数据
+    double _tick;        //!< 每一帧对应的时间点
+    ImuData _imu_data;   //!< 每一帧对应的 IMU 数据
+    FrameBudget _budget; //!< 帧预算令牌，参见 rm::FrameBudget
 
 public:
     using ptr = std::unique_ptr<detector>;
@@ -65,6 +113,62 @@ public:
      * @return 识别信息结构体
      */
     RMVL_W virtual DetectInfo detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick) = 0;
+
+    /**
+     * @brief 识别接口（写入式）
+     * @note 结果写入调用方持有的 `info`，各列表清空后复用既有容量，跨帧复用同一
+     *       `DetectInfo`（或配合 rm::DetectInfoBuffer 双缓冲交接）可消除逐帧的
+     *       向量增长与管线边界处的拷贝
+     *
+     * @param[in out] groups 序列组容器
+     * @param[in] src 原图像
+     * @param[in] color 待处理的颜色通道，可参考 rm::PixChannel
+     * @param[in] imu_data IMU 数据
+     * @param[in] tick 当前时间点
+     * @param[out] info 识别信息结构体
+     */
+    virtual void detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick, DetectInfo &info)
+    {
+        info = detect(groups, src, color, imu_data, tick);
+    }
+
+    /**
+     * @brief 设置每帧识别预算，启用截止期调度
+     * @note
+     * - 每次 `detect` 调用在入口处以帧起点时间装载预算，各识别阶段按剩余预算动态降级
+     *   （跳过分类网络、截断灯条数量等），使单帧最坏耗时有界而非尽力而为，降级策略由
+     *   各派生类在对应阶段的边界处实现
+     * @note
+     * - 序列组同步阶段可将 `frameBudget()` 传入 rm::parallelSync 以启用追踪器降采样
+     *
+     * @param[in] budget_ms 每帧预算（毫秒），为 `0` 时关闭截止期调度
+     */
+    RMVL_W void setFrameBudget(double budget_ms) { _budget.setBudget(budget_ms); }
+
+    //! 获取帧预算令牌，供消费线程在序列组同步等后续阶段查询剩余预算
+    const FrameBudget &frameBudget() const { return _budget; }
+
+    RMVL_W_SUBST("DetectorBatch")
+
+protected:
+    /**
+     * @brief 创建作用域耗时探针，供派生类在 `detect` 入口处使用
+     * @note 统计通道按实例区分，统计未启动时返回空探针，仅付出一次原子读的开销
+     *
+     * @param[in] depth 当前队列深度，一般为序列组数目
+     * @return 作用域耗时探针
+     */
+    stats::Probe probe(std::size_t depth = 0) const
+    {
+        if (!stats::active())
+            return {};
+        if (_stage_stats == nullptr)
+            _stage_stats = &stats::instanceChannel("detector", this);
+        return {*_stage_stats, depth};
+    }
+
+private:
+    mutable stats::StageStats *_stage_stats{}; //!< 实例级统计通道
 };
 
 //! @} detector
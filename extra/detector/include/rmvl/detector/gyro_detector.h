@@ -15,6 +15,8 @@
 
 #include "detector.h"
 
+#include "rmvl/algorithm/math.hpp"
+#include "rmvl/core/smallvec.hpp"
 #include "rmvl/ml/ort.h"
 #include "rmvl/tracker/gyro_tracker.h"
 
@@ -31,6 +33,24 @@ class RMVL_EXPORTS_W_DEU GyroDetector final : public detector
 
     std::unique_ptr<OnnxNet> _ort;
     std::unordered_map<int, RobotType> _robot_t;
+    int _frame_cnt{};  //!< 帧计数，用于增量搜索的周期性全图扫描
+    FindWorkspace _ws; //!< 帧间复用工作区
+
+    /**
+     * @brief 熵权推理帧间复用工作区
+     * @note 样本指标矩阵缓冲区在行列数不增长时不会重新分配，行列数与上一帧一致时
+     *       TOPSIS 工作区通过 EwTopsis::updateSamples 整体复用
+     */
+    struct EwInferenceWorkspace
+    {
+        std::vector<std::vector<double>> samples; //!< 样本指标矩阵缓冲区
+        std::unique_ptr<EwTopsis> topsis;         //!< 熵权 TOPSIS 工作区
+        std::size_t rows{};                       //!< 上一帧样本矩阵的行数
+        ArmorPoseTable combo_table;               //!< 装甲板位姿 SoA 表
+        ArmorPoseTable tracker_table;             //!< 追踪器首帧装甲板位姿 SoA 表
+        std::vector<combo::ptr> fronts;           //!< 追踪器首帧组合体缓冲区
+    };
+    EwInferenceWorkspace _ew_ws; //!< 熵权推理帧间复用工作区
 
 public:
     using ptr = std::unique_ptr<GyroDetector>;
@@ -53,6 +73,9 @@ public:
      */
     RMVL_W DetectInfo detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick) override;
 
+    //! @brief 识别接口（写入式），参见 rm::detector::detect
+    void detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick, DetectInfo &info) override;
+
     /**
      * @brief 构建 GyroDetector
      * 
@@ -78,8 +101,9 @@ private:
      * @param[out] features 找到的特征列表
      * @param[out] combos 找到的组合体列表
      * @param[out] rois 找到的组合体对应的 ROI 列表
+     * @param[in] seeds 增量搜索的候选区域，为空时全图搜索
      */
-    void find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos, std::vector<cv::Mat> &rois);
+    void find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos, std::vector<cv::Mat> &rois, const std::vector<cv::Rect> &seeds = {});
 
     /**
      * @brief 匹配、更新时间序列
@@ -95,7 +119,16 @@ private:
      * @param[in] bin 二值图
      * @return 找到的灯条
      */
-    std::vector<LightBlob::ptr> findLightBlobs(cv::Mat &bin);
+    SmallVector<LightBlob::ptr, 32> findLightBlobs(cv::Mat &bin);
+
+    /**
+     * @brief 在候选区域内寻找灯条
+     *
+     * @param[in] bin 二值图
+     * @param[in] seeds 候选搜索区域
+     * @return 找到的灯条
+     */
+    SmallVector<LightBlob::ptr, 32> findLightBlobs(cv::Mat &bin, const std::vector<cv::Rect> &seeds);
 
     /**
      * @brief 匹配装甲板
@@ -103,14 +136,14 @@ private:
      * @param[in out] light_blobs 灯条列表，内部进行从左到右排序
      * @return 当前帧找到的所有装甲板
      */
-    std::vector<Armor::ptr> findArmors(std::vector<LightBlob::ptr> &light_blobs);
+    SmallVector<Armor::ptr, 8> findArmors(SmallVector<LightBlob::ptr, 32> &light_blobs);
 
     /**
      * @brief 在多个装甲板共享同一个灯条时，根据匹配误差移除装甲板
      *
      * @param[in out] armors 待筛选的所有装甲板
      */
-    void eraseErrorArmors(std::vector<Armor::ptr> &armors);
+    void eraseErrorArmors(SmallVector<Armor::ptr, 8> &armors);
 
     /**
      * @brief 删除强光误识别的灯条
@@ -118,14 +151,14 @@ private:
      * @param[in] src 原图像
      * @param[in out] blobs 所有灯条
      */
-    void eraseBrightBlobs(cv::Mat src, std::vector<LightBlob::ptr> &blobs);
+    void eraseBrightBlobs(cv::Mat src, SmallVector<LightBlob::ptr, 32> &blobs);
 
     /**
      * @brief 删除假装甲板
      *
      * @param[in out] armors 所有装甲板
      */
-    void eraseFakeArmors(std::vector<Armor::ptr> &armors);
+    void eraseFakeArmors(SmallVector<Armor::ptr, 8> &armors);
 
     /**
      * @brief 将指定装甲板匹配至单一 GyroGroup 的 tracker 中
@@ -42,6 +42,9 @@ public:
      */
     RMVL_W DetectInfo detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick) override;
 
+    //! @brief 识别接口（写入式），参见 rm::detector::detect
+    void detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick, DetectInfo &info) override;
+
     //! 构建 RuneDetector
     RMVL_W static inline ptr make_detector() { return std::make_unique<RuneDetector>(); }
 
@@ -62,6 +65,8 @@ private:
      * @param[in] combos 每一帧的所有目标
      */
     void match(std::vector<tracker::ptr> &rune_trackers, const std::vector<combo::ptr> &combos);
+
+    FindWorkspace _ws; //!< 帧间复用工作区
 };
 
 //! @} rune_detector
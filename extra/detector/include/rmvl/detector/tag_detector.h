@@ -41,6 +41,7 @@ class RMVL_EXPORTS_W_DEU TagDetector final : public detector
 {
     apriltag_family_t *_tf{};
     apriltag_detector_t *_td{};
+    cv::Mat _gray; //!< 灰度图缓冲区，帧间复用，尺寸不变时不重新分配
 
 public:
     using ptr = std::unique_ptr<TagDetector>;
@@ -61,6 +62,8 @@ public:
     /**
      * @brief 识别接口
      * @note 提取出所有角点以及对应的类型，通过 `type` 和 `corners` 方法可以获取
+     * @note 支持 BGR 三通道与单通道灰度输入，相机配置为 `Mono8` 等单通道像素格式时
+     *       可省去整幅灰度转换，`DetectInfo::gray` 与输入图像或内部缓冲区共享存储，仅在当帧内有效
      *
      * @param[in out] groups 所有序列组
      * @param[in] src 原图像
@@ -69,6 +72,9 @@ public:
      * @param[in] tick 当前时间点
      */
     RMVL_W DetectInfo detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick) override;
+
+    //! @brief 识别接口（写入式），参见 rm::detector::detect
+    void detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick, DetectInfo &info) override;
 };
 
 //! @} tag_detector
@@ -0,0 +1,108 @@
+/**
+ * @file golden_replay.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 金准轨迹回放与各阶段耗时预算核对
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+#include "rmvl/core/io.hpp"
+#include "rmvl/core/stats.hpp"
+#include "rmvl/detector/armor_detector.h"
+
+#include "scene_gen.h"
+
+namespace rm_test
+{
+
+//! 帧图像负载头部，随像素数据一同写入记录负载
+struct FrameHeader
+{
+    int32_t rows{}; //!< 行数
+    int32_t cols{}; //!< 列数
+    int32_t type{}; //!< 像素类型（cv::Mat::type）
+};
+
+/**
+ * @brief 生成确定性的金准轨迹：合成场景逐帧序列化为二进制记录
+ *
+ * @param[in] path 记录文件路径
+ * @param[in] frames 帧数
+ */
+static void buildGoldenTrace(const std::string &path, int frames)
+{
+    rm::RecordWriter writer(path);
+    SceneOptions options{};
+    options.targets = 3;
+    options.clutter = 20;
+    options.noise = 200;
+    for (int i = 0; i < frames; ++i)
+    {
+        // 每帧独立种子，干扰光斑与噪声逐帧变化，目标位置保持稳定以维持序列组
+        options.seed = 7 + static_cast<uint64_t>(i);
+        cv::Mat src = buildArmorScene(options);
+        FrameHeader header{src.rows, src.cols, src.type()};
+        std::vector<uint8_t> payload(sizeof(header) + src.total() * src.elemSize());
+        std::memcpy(payload.data(), &header, sizeof(header));
+        std::memcpy(payload.data() + sizeof(header), src.data, payload.size() - sizeof(header));
+        writer.write(i * 5e-3, rm::ImuData(), {}, payload.data(), payload.size());
+    }
+}
+
+/**
+ * @brief 回放记录：逐帧还原图像并运行完整识别流水线
+ *
+ * @param[in] path 记录文件路径
+ */
+static void replay(const std::string &path)
+{
+    rm::RecordReader reader(path);
+    auto p_detector = rm::ArmorDetector::make_detector();
+    std::vector<rm::group::ptr> groups;
+    for (std::size_t i = 0; i < reader.size(); ++i)
+    {
+        auto view = reader.at(i);
+        const auto *header = reinterpret_cast<const FrameHeader *>(view.payload);
+        // 负载为只读映射，流水线不写入输入帧，零拷贝包装为 cv::Mat
+        cv::Mat src(header->rows, header->cols, header->type,
+                    const_cast<uint8_t *>(view.payload + sizeof(FrameHeader)));
+        auto info = p_detector->detect(groups, src, rm::RED, view.imu, view.tick);
+        (void)info;
+    }
+}
+
+} // namespace rm_test
+
+int main()
+{
+    // 金准轨迹优先取自 RMVL_GOLDEN_TRACE 指向的实录文件，未设置时确定性生成合成轨迹
+    std::string trace;
+    if (const char *env = std::getenv("RMVL_GOLDEN_TRACE"); env != nullptr)
+        trace = env;
+    else
+    {
+        trace = (std::filesystem::temp_directory_path() / "rmvl_armor_pipeline.rec").string();
+        rm_test::buildGoldenTrace(trace, 100);
+    }
+    // 预热一遍使缓存与统计通道就绪，再启动统计完成计量回放
+    rm_test::replay(trace);
+    rm::stats::start();
+    rm_test::replay(trace);
+    rm::stats::stop();
+    // 按既定预算核对各阶段 p90 耗时，超出时输出对比报告并以非零状态退出
+    auto diffs = rm::stats::checkBudget(RMVL_BUDGET_FILE);
+    std::printf("%s", rm::stats::budgetReport(diffs).c_str());
+    if (diffs.empty())
+        return 1;
+    for (const auto &diff : diffs)
+        if (diff.over)
+            return 1;
+    return 0;
+}
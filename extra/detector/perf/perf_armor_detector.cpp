@@ -0,0 +1,84 @@
+/**
+ * @file perf_armor_detector.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 装甲板识别基准测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "rmvl/core/timer.hpp"
+#include "rmvl/detector/armor_detector.h"
+
+#include "rmvlpara/detector/armor_detector.h"
+
+#include "scene_gen.h"
+
+namespace rm_test
+{
+
+// 端到端识别：在合成帧上逐帧运行 detect，序列组跨帧持续维护
+// 参数：[目标个数, 干扰光斑个数]，用于量化识别耗时随目标数与杂乱程度的扩展
+static void armor_detector_detect(benchmark::State &state)
+{
+    auto p_detector = rm::ArmorDetector::make_detector();
+    std::vector<rm::group::ptr> groups;
+    SceneOptions options{};
+    options.targets = static_cast<int>(state.range(0));
+    options.clutter = static_cast<int>(state.range(1));
+    options.noise = 200;
+    // 场景确定性生成，每帧内容一致
+    cv::Mat src = buildArmorScene(options);
+    for (auto _ : state)
+    {
+        auto info = p_detector->detect(groups, src, rm::RED, rm::ImuData(), rm::Timer::now());
+        benchmark::DoNotOptimize(info);
+    }
+}
+
+// 运动模糊下的端到端识别，参数：[运动模糊核长度]
+static void armor_detector_detect_blur(benchmark::State &state)
+{
+    auto p_detector = rm::ArmorDetector::make_detector();
+    std::vector<rm::group::ptr> groups;
+    SceneOptions options{};
+    options.targets = 3;
+    options.clutter = 20;
+    options.blur = static_cast<int>(state.range(0));
+    cv::Mat src = buildArmorScene(options);
+    for (auto _ : state)
+    {
+        auto info = p_detector->detect(groups, src, rm::RED, rm::ImuData(), rm::Timer::now());
+        benchmark::DoNotOptimize(info);
+    }
+}
+
+// 暗场景识别：目标稀少时积分图粗筛在轮廓提取前剔除大部分图像，参数：[粗筛瓦片边长，0 表示关闭粗筛]
+static void armor_detector_detect_dark(benchmark::State &state)
+{
+    auto p_detector = rm::ArmorDetector::make_detector();
+    std::vector<rm::group::ptr> groups;
+    SceneOptions options{};
+    options.targets = 1;
+    options.clutter = 5;
+    options.noise = 50;
+    cv::Mat src = buildArmorScene(options);
+    const auto tile_backup = rm::para::armor_detector_param.PREFILTER_TILE;
+    rm::para::armor_detector_param.PREFILTER_TILE = static_cast<int>(state.range(0));
+    for (auto _ : state)
+    {
+        auto info = p_detector->detect(groups, src, rm::RED, rm::ImuData(), rm::Timer::now());
+        benchmark::DoNotOptimize(info);
+    }
+    rm::para::armor_detector_param.PREFILTER_TILE = tile_backup;
+}
+
+BENCHMARK(armor_detector_detect)->Name("armor detector detect - by rmvl")->ArgsProduct({{1, 3, 6}, {0, 20, 50, 100}});
+BENCHMARK(armor_detector_detect_dark)->Name("armor detector detect (dark) - by rmvl")->Arg(0)->Arg(32)->Arg(64);
+BENCHMARK(armor_detector_detect_blur)->Name("armor detector detect (blur) - by rmvl")->Arg(0)->Arg(9)->Arg(17);
+
+} // namespace rm_test
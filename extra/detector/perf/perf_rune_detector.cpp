@@ -0,0 +1,44 @@
+/**
+ * @file perf_rune_detector.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 神符识别基准测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "rmvl/core/timer.hpp"
+#include "rmvl/detector/rune_detector.h"
+
+#include "scene_gen.h"
+
+namespace rm_test
+{
+
+// 端到端识别：在合成帧上逐帧运行 detect
+// 参数：[扇叶个数, 干扰光斑个数]，用于量化识别耗时随扇叶数与杂乱程度的扩展
+static void rune_detector_detect(benchmark::State &state)
+{
+    auto p_detector = rm::RuneDetector::make_detector();
+    std::vector<rm::group::ptr> groups;
+    SceneOptions options{};
+    options.size = {1278, 1024};
+    options.targets = static_cast<int>(state.range(0));
+    options.clutter = static_cast<int>(state.range(1));
+    options.noise = 200;
+    // 场景确定性生成，每帧内容一致
+    cv::Mat src = buildRuneScene(options);
+    for (auto _ : state)
+    {
+        auto info = p_detector->detect(groups, src, rm::RED, rm::ImuData(), rm::Timer::now());
+        benchmark::DoNotOptimize(info);
+    }
+}
+
+BENCHMARK(rune_detector_detect)->Name("rune detector detect - by rmvl")->ArgsProduct({{1, 3, 5}, {0, 20, 50}});
+
+} // namespace rm_test
@@ -0,0 +1,135 @@
+/**
+ * @file scene_gen.h
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 识别基准测试的合成场景生成
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <opencv2/imgproc.hpp>
+
+#include "rmvl/algorithm/math.hpp"
+
+namespace rm_test
+{
+
+//! 合成场景参数
+struct SceneOptions
+{
+    cv::Size size{1280, 1024}; //!< 帧尺寸
+    int targets{1};            //!< 目标个数（装甲板或神符扇叶）
+    int clutter{};             //!< 干扰光斑个数，模拟场地灯光与反光
+    int noise{};               //!< 椒盐噪声点个数，模拟传感器噪声
+    int blur{};                //!< 运动模糊核长度（像素），`0` 表示无模糊
+    uint64_t seed{7};          //!< 随机种子，相同参数生成相同场景
+};
+
+//! 在图像上绘制单根灯条
+inline void drawBlob(cv::Mat &src, float angle, cv::Point center)
+{
+    cv::Point base_bias(static_cast<int>(-110 * std::sin(rm::deg2rad(angle))),
+                        static_cast<int>(110 * std::cos(rm::deg2rad(angle))));
+    cv::line(src, center - base_bias / 2, center + base_bias / 2, cv::Scalar(0, 0, 255), 12);
+}
+
+//! 在图像上绘制一块装甲板
+inline void drawArmor(cv::Mat &src, cv::Point center, float angle)
+{
+    drawBlob(src, angle, center - cv::Point(static_cast<int>(125 * std::cos(rm::deg2rad(angle))),
+                                            static_cast<int>(125 * std::sin(rm::deg2rad(angle)))));
+    drawBlob(src, angle, center + cv::Point(static_cast<int>(125 * std::cos(rm::deg2rad(angle))),
+                                            static_cast<int>(125 * std::sin(rm::deg2rad(angle)))));
+}
+
+//! 在图像上绘制一片未激活的神符扇叶（靶心、支架与间断臂）
+inline void drawRuneFan(cv::Mat &src, cv::Point target, float theta)
+{
+    double ct = std::cos(theta), st = std::sin(theta);
+    double cn = std::cos(theta + CV_PI / 2), sn = std::sin(theta + CV_PI / 2);
+    auto at = [&](double r, double n) { return target + cv::Point(static_cast<int>(r * ct + n * cn), static_cast<int>(-r * st - n * sn)); };
+    // 神符靶心与辅助瞄准特征
+    cv::circle(src, target, 8, cv::Scalar(0, 0, 255), 2);
+    cv::circle(src, target, 24, cv::Scalar(0, 0, 255), 2);
+    cv::circle(src, target, 44, cv::Scalar(0, 0, 255), 2);
+    cv::line(src, at(20, 0), at(52, 0), cv::Scalar(0, 0, 255), 4);
+    cv::line(src, at(-20, 0), at(-52, 0), cv::Scalar(0, 0, 255), 4);
+    cv::line(src, at(0, 20), at(0, 52), cv::Scalar(0, 0, 255), 4);
+    cv::line(src, at(0, -20), at(0, -52), cv::Scalar(0, 0, 255), 4);
+    // 外支架与内支架
+    cv::line(src, at(70, 60), at(70, -60), cv::Scalar(0, 0, 255), 8);
+    cv::line(src, at(70, 60), at(25, 60), cv::Scalar(0, 0, 255), 8);
+    cv::line(src, at(70, -60), at(25, -60), cv::Scalar(0, 0, 255), 8);
+    cv::line(src, at(-70, 60), at(-70, -60), cv::Scalar(0, 0, 255), 8);
+    cv::line(src, at(-70, 60), at(-25, 60), cv::Scalar(0, 0, 255), 8);
+    cv::line(src, at(-70, -60), at(-25, -60), cv::Scalar(0, 0, 255), 8);
+    // 中心连接臂与未激活的间断特征
+    cv::line(src, at(-78, 0), at(-162, 0), cv::Scalar(0, 0, 255), 16);
+    for (int i = 80; i < 190; i += 10)
+        cv::line(src, at(-i, 25), at(-i, -25), cv::Scalar(0, 0, 0), 4);
+}
+
+//! 叠加干扰光斑、椒盐噪声与运动模糊
+inline void applyDegradations(cv::Mat &src, const SceneOptions &options)
+{
+    cv::RNG rng(options.seed);
+    // 干扰光斑：随机位置、尺寸与倾角的小亮斑，形态与灯条相近，参与候选筛选
+    for (int i = 0; i < options.clutter; ++i)
+    {
+        cv::Point center(rng.uniform(20, options.size.width - 20), rng.uniform(20, options.size.height - 20));
+        cv::Point bias(rng.uniform(-10, 10), rng.uniform(10, 40));
+        cv::line(src, center - bias / 2, center + bias / 2, cv::Scalar(0, 0, 255), rng.uniform(2, 8));
+    }
+    // 椒盐噪声：随机亮点
+    for (int i = 0; i < options.noise; ++i)
+        src.at<cv::Vec3b>(rng.uniform(0, options.size.height), rng.uniform(0, options.size.width)) = cv::Vec3b(0, 0, 255);
+    // 运动模糊：水平方向的归一化均值核
+    if (options.blur > 1)
+    {
+        cv::Mat kernel = cv::Mat::ones(1, options.blur, CV_32F) / static_cast<float>(options.blur);
+        cv::filter2D(src, src, -1, kernel);
+    }
+}
+
+/**
+ * @brief 生成装甲板合成场景
+ *
+ * @param[in] options 合成场景参数
+ * @return 合成帧
+ */
+inline cv::Mat buildArmorScene(const SceneOptions &options)
+{
+    cv::Mat src = cv::Mat::zeros(options.size, CV_8UC3);
+    for (int i = 0; i < options.targets; ++i)
+        drawArmor(src, cv::Point(300 + 340 * (i % 3), 300 + 400 * (i / 3)), 4.f);
+    applyDegradations(src, options);
+    return src;
+}
+
+/**
+ * @brief 生成神符合成场景
+ *
+ * @param[in] options 合成场景参数
+ * @return 合成帧
+ */
+inline cv::Mat buildRuneScene(const SceneOptions &options)
+{
+    cv::Mat src = cv::Mat::zeros(options.size, CV_8UC3);
+    cv::Point center(options.size.width / 2, options.size.height / 2);
+    cv::putText(src, "R", center + cv::Point(-10, 10), cv::FONT_HERSHEY_COMPLEX, 1., cv::Scalar(0, 0, 255), 4);
+    // 各扇叶绕神符中心均匀分布，靶心到中心的距离与场地实物比例一致
+    for (int i = 0; i < options.targets; ++i)
+    {
+        float theta = static_cast<float>(2 * CV_PI * i / std::max(options.targets, 1));
+        cv::Point target = center + cv::Point(static_cast<int>(240 * std::cos(theta)), static_cast<int>(-240 * std::sin(theta)));
+        drawRuneFan(src, target, theta);
+    }
+    applyDegradations(src, options);
+    return src;
+}
+
+} // namespace rm_test
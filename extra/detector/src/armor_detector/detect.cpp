@@ -9,6 +9,10 @@
  *
  */
 
+#include <algorithm>
+
+#include <opencv2/imgproc.hpp>
+
 #include "rmvl/detector/armor_detector.h"
 
 #include "rmvlpara/detector/armor_detector.h"
@@ -23,25 +27,211 @@ ArmorDetector::ArmorDetector(std::string_view model)
         _robot_t[i] = static_cast<RobotType>(i);
 }
 
+//! 合并列表中相交的候选区域，避免重叠部分重复查找轮廓
+static void mergeIntersecting(std::vector<cv::Rect> &seeds)
+{
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (size_t i = 0; !merged && i + 1 < seeds.size(); ++i)
+            for (size_t j = i + 1; !merged && j < seeds.size(); ++j)
+                if ((seeds[i] & seeds[j]).area() > 0)
+                {
+                    seeds[i] |= seeds[j];
+                    seeds.erase(seeds.begin() + j);
+                    merged = true;
+                }
+    }
+}
+
+/**
+ * @brief 按参数中的现有阈值完成二值化，金字塔各层复用同一套阈值参数
+ *
+ * @param[in] src 原图像
+ * @param[out] bin 二值图像
+ * @param[in] color 待识别颜色
+ * @param[in] ch_minus 相减通道
+ */
+static void binarize(const cv::Mat &src, cv::Mat &bin, uint8_t color, uint8_t ch_minus)
+{
+    // 自适应阈值模式下逐分块解算阈值，光照变化时无需重新标定
+    if (para::armor_detector_param.ADAPTIVE_BINARY != 0)
+        binaryAdaptive(src, bin, color, ch_minus, para::armor_detector_param.ADAPTIVE_BINARY_BIAS);
+    else
+    {
+        int thesh = color == RED ? para::armor_detector_param.GRAY_THRESHOLD_RED : para::armor_detector_param.GRAY_THRESHOLD_BLUE;
+        binary(src, bin, color, ch_minus, thesh);
+    }
+}
+
+/**
+ * @brief 金字塔粗筛：在 2 倍降采样图上二值化并粗定位候选区域
+ * @brief
+ * - 降采样层与全分辨率层复用同一套阈值参数，最小轮廓面积按降采样比例同步缩放至
+ *   1/4 后作用于候选包围盒（包围盒面积不小于轮廓面积，筛选为保守的超集）
+ * - 各候选包围盒换算回全分辨率坐标并向四周膨胀，覆盖降采样引起的边界误差
+ *
+ * @param[in] src 原图像
+ * @param[in] color 待识别颜色
+ * @param[in] ch_minus 相减通道
+ * @return 合并相交部分后的候选区域列表（全分辨率坐标），为空表示粗筛层无候选目标
+ */
+static std::vector<cv::Rect> pyramidSeeds(const cv::Mat &src, uint8_t color, uint8_t ch_minus)
+{
+    cv::Mat half, bin;
+    // 2x2 均值降采样保持亮度量级，1 ~ 2 px 宽的灯条在降采样层仍有响应
+    cv::resize(src, half, cv::Size(), 0.5, 0.5, cv::INTER_AREA);
+    binarize(half, bin, color, ch_minus);
+    std::vector<std::vector<cv::Point>> contours;
+    cv::findContours(bin, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+    const int expand = para::armor_detector_param.PYRAMID_EXPAND;
+    std::vector<cv::Rect> seeds;
+    seeds.reserve(contours.size());
+    for (const auto &contour : contours)
+    {
+        cv::Rect rect = cv::boundingRect(contour);
+        if (4. * rect.area() < para::armor_detector_param.MIN_CONTOUR_AREA)
+            continue;
+        rect = {2 * rect.x - expand, 2 * rect.y - expand, 2 * rect.width + 2 * expand, 2 * rect.height + 2 * expand};
+        rect &= cv::Rect({}, src.size());
+        if (rect.area() > 0)
+            seeds.push_back(rect);
+    }
+    mergeIntersecting(seeds);
+    return seeds;
+}
+
+/**
+ * @brief 从上一帧追踪器构造膨胀后的候选搜索区域
+ *
+ * @param[in] groups 序列组容器
+ * @param[in] size 图像尺寸
+ * @param[in] ratio 包围盒向四周膨胀的宽高比例
+ * @return 合并相交部分后的候选区域列表
+ */
+static std::vector<cv::Rect> seedRegions(const std::vector<group::ptr> &groups, const cv::Size &size, double ratio)
+{
+    std::vector<cv::Rect> seeds;
+    for (const auto &p_group : groups)
+        for (const auto &p_tracker : p_group->data())
+        {
+            // 仅使用当前帧仍在稳定追踪的目标
+            if (p_tracker->empty() || p_tracker->getVanishNumber() > 0 || p_tracker->corners().empty())
+                continue;
+            cv::Rect rect = cv::boundingRect(p_tracker->corners());
+            int dw = static_cast<int>(rect.width * ratio);
+            int dh = static_cast<int>(rect.height * ratio);
+            rect -= cv::Point(dw, dh);
+            rect += cv::Size(2 * dw, 2 * dh);
+            rect &= cv::Rect({}, size);
+            if (rect.area() > 0)
+                seeds.push_back(rect);
+        }
+    mergeIntersecting(seeds);
+    return seeds;
+}
+
+void ArmorDetector::collectTypeHints(const std::vector<group::ptr> &groups)
+{
+    _type_hints.clear();
+    const std::size_t confirm = std::max(1, para::armor_detector_param.CLASSIFY_CONFIRM_FRAMES);
+    for (const auto &p_group : groups)
+        for (const auto &p_tracker : p_group->data())
+        {
+            // 仅使用当前帧仍在稳定追踪、且历史帧数足以确认类型的目标
+            if (p_tracker->empty() || p_tracker->getVanishNumber() > 0 || p_tracker->size() < confirm)
+                continue;
+            if (!p_tracker->state().contains("robot"))
+                continue;
+            auto robot = to_robot_type(p_tracker->state().at("robot"));
+            if (robot == RobotType::UNKNOWN)
+                continue;
+            // 最近 confirm 帧的分类结果与追踪器类型全部一致时，类型视为已确认
+            bool consistent = true;
+            for (std::size_t i = 0; consistent && i < confirm; ++i)
+            {
+                const auto &combo_state = p_tracker->at(i)->state();
+                consistent = combo_state.contains("robot") && to_robot_type(combo_state.at("robot")) == robot;
+            }
+            if (consistent)
+                _type_hints.push_back({p_tracker->center(), robot});
+        }
+}
+
 DetectInfo ArmorDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick)
 {
-    DetectInfo info{};
+    DetectInfo info;
+    detect(groups, src, color, imu_data, tick, info);
+    return info;
+}
+
+void ArmorDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick, DetectInfo &info)
+{
+    auto stats_probe = probe(groups.size());
+    info.clear();
     info.src = src;
     _tick = tick;
     _imu_data = imu_data;
+    // 以帧起点时间装载预算，各阶段按剩余预算动态降级
+    _budget.restart(tick);
     // 初始化存储信息
     if (groups.empty())
         groups.emplace_back(DefaultGroup::make_group());
-    // 二值化处理图像
     PixChannel ch_minus = color == RED ? BLUE : RED;
-    int thesh = color == RED ? para::armor_detector_param.GRAY_THRESHOLD_RED : para::armor_detector_param.GRAY_THRESHOLD_BLUE;
-    info.bin = binary(src, color, ch_minus, thesh);
-
-    // 找到所有的灯条和装甲板
-    find(info.bin, info.features, info.combos, info.rois);
+    ++_frame_cnt;
+    // 分类缓存：从稳定追踪器收集已确认类型的提示，命中提示的装甲板在 find 中跳过数字分类；
+    // 周期帧上清空提示以强制全量重新分类，防止错误类型长期沿用
+    if (_ort && para::armor_detector_param.ENABLE_CLASSIFY_CACHE != 0 &&
+        _frame_cnt % std::max(1, para::armor_detector_param.CLASSIFY_REFRESH_INTERVAL) != 0)
+        collectTypeHints(groups);
+    else
+        _type_hints.clear();
+    // 增量搜索：优先在上一帧追踪目标的膨胀区域内查找，周期性全图搜索以捕获新目标
+    std::vector<cv::Rect> seeds;
+    if (para::armor_detector_param.ENABLE_INCREMENTAL_FIND != 0 &&
+        _frame_cnt % std::max(1, para::armor_detector_param.INCREMENTAL_FULL_INTERVAL) != 0)
+        seeds = seedRegions(groups, src.size(), para::armor_detector_param.INCREMENTAL_EXPAND_RATIO);
+    // 金字塔粗到精搜索：无增量候选区域时，先在 2 倍降采样图上粗定位候选区域，
+    // 仅在候选区域内做全分辨率二值化与精提取，稀疏场景下省去全图预处理与轮廓提取开销
+    bool pyramid = false;
+    if (seeds.empty() && para::armor_detector_param.ENABLE_PYRAMID_FIND != 0)
+    {
+        auto pyr_seeds = pyramidSeeds(src, color, ch_minus);
+        std::size_t covered{};
+        for (const auto &roi : pyr_seeds)
+            covered += static_cast<std::size_t>(roi.area());
+        // 候选区域近乎铺满全图时粗筛收益为负，回退至全图二值化
+        if (covered < para::armor_detector_param.PYRAMID_MAX_COVERAGE * src.rows * src.cols)
+        {
+            info.bin = cv::Mat::zeros(src.size(), CV_8UC1);
+            for (const auto &roi : pyr_seeds)
+            {
+                cv::Mat bin_view = info.bin(roi);
+                binarize(src(roi), bin_view, color, ch_minus);
+            }
+            seeds = std::move(pyr_seeds);
+            pyramid = true;
+        }
+    }
+    // 二值化处理图像
+    if (!pyramid)
+        binarize(src, info.bin, color, ch_minus);
+    // 找到所有的灯条和装甲板，金字塔粗筛层无候选时场面为空，直接跳过
+    if (!pyramid || !seeds.empty())
+        find(info.bin, info.features, info.combos, info.rois, seeds);
+    // 候选区域内全部脱靶时，退回全图搜索，预算耗尽时顺延至下一帧的周期性全图搜索
+    if (!seeds.empty() && info.combos.empty() && !_budget.exhausted())
+    {
+        info.features.clear();
+        info.rois.clear();
+        // 金字塔路径下二值图仅在候选区域内有效，退回全图搜索前补全全图二值化
+        if (pyramid)
+            binarize(src, info.bin, color, ch_minus);
+        find(info.bin, info.features, info.combos, info.rois);
+    }
     // 将目标匹配进序列组
     match(groups, info.combos);
-    return info;
 }
 
 } // namespace rm
@@ -9,48 +9,120 @@
  *
  */
 
+#include <algorithm>
+#include <iterator>
+
 #include <opencv2/imgproc.hpp>
 
+#include "rmvl/core/thread_pool.hpp"
 #include "rmvl/detector/armor_detector.h"
 
 #include "rmvlpara/camera/camera.h"
+#include "rmvlpara/combo/armor.h"
 #include "rmvlpara/detector/armor_detector.h"
 
 namespace rm
 {
 
-void ArmorDetector::find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos, std::vector<cv::Mat> &rois)
+void ArmorDetector::find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos, std::vector<cv::Mat> &rois, const std::vector<cv::Rect> &seeds)
 {
     // ----------------------- light_blob -----------------------
-    // 找到所有灯条
-    std::vector<LightBlob::ptr> blobs = findLightBlobs(src);
+    // 找到所有灯条，存在候选区域时仅在区域内查找
+    SmallVector<LightBlob::ptr, 32> blobs = seeds.empty() ? findLightBlobs(src) : findLightBlobs(src, seeds);
     // 删除过亮灯条
     eraseBrightBlobs(src, blobs);
+    // 剩余预算不足以覆盖配对与匹配阶段时，截断灯条数量使 O(n²) 配对复杂度有界，
+    // 优先保留像素高度较大（距离更近、置信度更高）的灯条
+    const std::size_t max_blobs = para::armor_detector_param.BUDGET_MAX_BLOBS;
+    if (_budget.active() && blobs.size() > max_blobs && _budget.remaining() < para::armor_detector_param.BUDGET_MATCH_RESERVE)
+    {
+        std::partial_sort(blobs.begin(), blobs.begin() + max_blobs, blobs.end(), [](LightBlob::const_ptr lhs, LightBlob::const_ptr rhs) {
+            return lhs->height() > rhs->height();
+        });
+        blobs.erase(blobs.begin() + max_blobs, blobs.end());
+    }
     // ------------------------- armor --------------------------
     if (blobs.size() >= 2)
     {
         // 找到所有装甲板
-        std::vector<Armor::ptr> armors = findArmors(blobs);
-        if (_ort)
+        SmallVector<Armor::ptr, 8> armors = findArmors(blobs);
+        // 分类缓存：命中已确认追踪目标提示的装甲板直接沿用追踪器类型，
+        // 仅对新出现或不明确的目标执行推理，稳定追踪时绝大多数分类调用被省去
+        SmallVector<Armor::ptr, 8> pending;
+        const float max_d2 = para::armor_detector_param.CLASSIFY_CACHE_DELTA_DIS * para::armor_detector_param.CLASSIFY_CACHE_DELTA_DIS;
+        for (const auto &armor : armors)
         {
+            const TypeHint *hit{};
+            bool ambiguous{};
+            float best_d2 = max_d2;
+            for (const auto &hint : _type_hints)
+            {
+                float dx = hint.center.x - armor->center().x, dy = hint.center.y - armor->center().y;
+                float d2 = dx * dx + dy * dy;
+                if (d2 > max_d2)
+                    continue;
+                // 多个不同类型的提示同时落入门限内时视为不明确，交由分类网络判定
+                if (hit != nullptr && hint.robot != hit->robot)
+                    ambiguous = true;
+                if (d2 <= best_d2)
+                {
+                    best_d2 = d2;
+                    hit = &hint;
+                }
+            }
+            if (hit != nullptr && !ambiguous)
+                armor->setType(hit->robot);
+            else
+                pending.push_back(armor);
+        }
+        // 剩余预算不足以覆盖分类耗时时跳过分类网络，类型暂记为未知
+        bool degraded = _ort && _budget.remaining() < para::armor_detector_param.BUDGET_CLASSIFY_COST;
+        if (_ort && !degraded)
+        {
+            // ROI 直接写入批量缓冲区槽位，识别与推理的边界上不产生逐 ROI 的图像分配与拷贝，
+            // rois 保存槽位视图，在下一帧写入前有效
+            int roi_size = para::armor_param.ROI_SIZE;
+            _roi_batch.reserve(pending.size(), cv::Size(roi_size, roi_size));
+            _roi_batch.clear();
             rois.clear();
-            rois.reserve(armors.size());
-            for (const auto &armor : armors)
+            rois.reserve(pending.size());
+            for (const auto &armor : pending)
+            {
+                cv::Mat slot = _roi_batch.acquire();
+                Armor::getNumberROI(src, armor, slot);
+                rois.emplace_back(slot);
+            }
+            if (!_roi_batch.empty())
             {
-                cv::Mat roi = Armor::getNumberROI(src, armor);
                 PreprocessOptions preop;
                 preop.means = {para::armor_detector_param.MODEL_MEAN};
                 preop.stds = {para::armor_detector_param.MODEL_STD};
-                int idx = ClassificationNet::cast(_ort->inference({roi}, preop, {})).first;
-                armor->setType(_robot_t[idx]);
-                rois.emplace_back(roi);
+                // 全部 ROI 槽位堆叠为一个批量 Tensor，单次会话调用完成分类
+                auto result = _ort->inference(_roi_batch, preop, {});
+                if (rois.size() == 1)
+                    pending.front()->setType(_robot_t[ClassificationNet::cast(result).first]);
+                else
+                {
+                    auto types = ClassificationNet::castBatch(result);
+                    for (std::size_t i = 0; i < pending.size(); ++i)
+                        pending[i]->setType(_robot_t[types[i].first]);
+                }
             }
             // eraseFakeArmors(armors);
         }
         else
-            for (const auto &armor : armors)
+            for (const auto &armor : pending)
                 armor->setType(RobotType::UNKNOWN);
 
+        // 交战目标过滤：非交战类型在数字分类后立即剔除，不再参与误差筛选、序列组匹配与追踪器更新
+        // 降级跳过分类时类型未知，不执行过滤，避免交战目标被整帧剔除
+        auto engage_mask = static_cast<RobotTypeMask>(para::armor_detector_param.ENGAGE_MASK);
+        if (engage_mask != ROBOT_MASK_ALL && !degraded)
+            armors.erase(remove_if(armors.begin(), armors.end(), [engage_mask](const Armor::ptr &armor) {
+                             return !robot_mask_contains(engage_mask, to_robot_type(armor->state().at("robot")));
+                         }),
+                         armors.end());
+
         // 根据匹配误差筛选
         eraseErrorArmors(armors);
         // 更新至特征容器
@@ -62,36 +134,225 @@ void ArmorDetector::find(cv::Mat &src, std::vector<feature::ptr> &features, std:
     }
 }
 
-std::vector<LightBlob::ptr> ArmorDetector::findLightBlobs(cv::Mat &bin)
+/**
+ * @brief 从轮廓列表中构造灯条
+ *
+ * @param[in] contours 轮廓列表
+ * @param[out] light_blobs 构造出的灯条列表
+ */
+static void buildLightBlobs(std::vector<std::vector<cv::Point>> &contours, SmallVector<LightBlob::ptr, 32> &light_blobs)
 {
-    // 储存找到的灯条
-    std::vector<LightBlob::ptr> light_blobs;
-    // 储存查找出的轮廓
-    std::vector<std::vector<cv::Point>> contours;
-    // 查找最外围轮廓
-    cv::findContours(bin, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE);
-    for (auto &contour : contours)
+    // 逐轮廓访问的参数从快照读取，避免并发调参时发生撕裂
+    const auto param = para::armor_detector_snapshot();
+    // 排除面积过小的误识别
+    contours.erase(std::remove_if(contours.begin(), contours.end(), [&param](const std::vector<cv::Point> &contour) {
+                       return cv::contourArea(contour) < param->MIN_CONTOUR_AREA;
+                   }),
+                   contours.end());
+    // 批量完成几何解算并构造灯条
+    auto blobs = LightBlob::make_features(contours);
+    light_blobs.insert(light_blobs.end(), std::make_move_iterator(blobs.begin()), std::make_move_iterator(blobs.end()));
+}
+
+/**
+ * @brief 积分图瓦片粗筛，生成可能包含有效灯条的候选区域
+ * @brief
+ * - 对二值图做一次积分图并按瓦片求和，零响应瓦片不可能包含灯条像素。连通灯条覆盖的
+ *   瓦片集合在瓦片网格上 8 连通，故将非零瓦片按 8 连通分组，各组瓦片的像素包围盒即
+ *   为候选区域，且每条灯条完整落在其所属组的包围盒内
+ * - 组内响应总和不足 `MIN_CONTOUR_AREA` 个亮像素的组不可能包含面积达标的轮廓
+ *   （由 Pick 定理，轮廓面积不超过连通域像素数），整组剔除，暗场景下大部分瓦片
+ *   在此阶段被排除，轮廓提取仅在剩余候选区域内进行
+ *
+ * @param[in] bin 二值图像
+ * @param[in] tile 瓦片边长
+ * @param[in] min_area 最小轮廓面积
+ * @param[out] group_of 各瓦片所属组号（行优先存储），`-1` 表示瓦片被剔除
+ * @param[out] tiles_x 瓦片列数
+ * @return 候选区域列表（像素坐标），为空表示全图无有效灯条
+ */
+static std::vector<cv::Rect> prefilterTiles(const cv::Mat &bin, int tile, double min_area, std::vector<int> &group_of, int &tiles_x)
+{
+    cv::Mat sum;
+    cv::integral(bin, sum, CV_32S);
+    tiles_x = (bin.cols + tile - 1) / tile;
+    const int tiles_y = (bin.rows + tile - 1) / tile;
+    // 各瓦片的响应由积分图 4 次访存得到
+    std::vector<int32_t> tile_sum(tiles_x * tiles_y);
+    for (int ty = 0; ty < tiles_y; ++ty)
     {
-        // 排除面积过小的误识别
-        if (cv::contourArea(contour) < para::armor_detector_param.MIN_CONTOUR_AREA)
+        const int y0 = ty * tile, y1 = std::min(bin.rows, y0 + tile);
+        const int32_t *row0 = sum.ptr<int32_t>(y0), *row1 = sum.ptr<int32_t>(y1);
+        for (int tx = 0; tx < tiles_x; ++tx)
+        {
+            const int x0 = tx * tile, x1 = std::min(bin.cols, x0 + tile);
+            tile_sum[ty * tiles_x + tx] = row1[x1] - row1[x0] - row0[x1] + row0[x0];
+        }
+    }
+    // 非零瓦片按 8 连通 BFS 分组，逐组累计响应与瓦片包围盒
+    group_of.assign(tile_sum.size(), -1);
+    std::vector<cv::Rect> rois;
+    std::vector<int64_t> group_sum;
+    std::vector<std::size_t> queue;
+    for (int t = 0; t < static_cast<int>(tile_sum.size()); ++t)
+    {
+        if (tile_sum[t] == 0 || group_of[t] >= 0)
             continue;
-        // 构造灯条对象
-        LightBlob::ptr p_light = LightBlob::make_feature(contour);
-        // 将识别出的灯条 push 到 light_blobs 中
-        if (p_light != nullptr)
-            light_blobs.push_back(p_light);
+        const int gid = static_cast<int>(rois.size());
+        int min_tx = tiles_x, max_tx = -1, min_ty = tiles_y, max_ty = -1;
+        int64_t total{};
+        queue.clear();
+        queue.push_back(t);
+        group_of[t] = gid;
+        while (!queue.empty())
+        {
+            const int cur = static_cast<int>(queue.back());
+            queue.pop_back();
+            const int ty = cur / tiles_x, tx = cur % tiles_x;
+            total += tile_sum[cur];
+            min_tx = std::min(min_tx, tx), max_tx = std::max(max_tx, tx);
+            min_ty = std::min(min_ty, ty), max_ty = std::max(max_ty, ty);
+            for (int dy = -1; dy <= 1; ++dy)
+                for (int dx = -1; dx <= 1; ++dx)
+                {
+                    const int ny = ty + dy, nx = tx + dx;
+                    if (ny < 0 || ny >= tiles_y || nx < 0 || nx >= tiles_x)
+                        continue;
+                    const int nb = ny * tiles_x + nx;
+                    if (tile_sum[nb] != 0 && group_of[nb] < 0)
+                        group_of[nb] = gid, queue.push_back(nb);
+                }
+        }
+        group_sum.push_back(total);
+        rois.emplace_back(min_tx * tile, min_ty * tile,
+                          std::min(bin.cols, (max_tx + 1) * tile) - min_tx * tile,
+                          std::min(bin.rows, (max_ty + 1) * tile) - min_ty * tile);
+    }
+    // 响应总和不足的组整体剔除，组号按保留顺序压缩
+    std::vector<int> remap(rois.size(), -1);
+    std::size_t keep{};
+    for (std::size_t g = 0; g < rois.size(); ++g)
+        if (group_sum[g] >= static_cast<int64_t>(min_area) * 255)
+        {
+            remap[g] = static_cast<int>(keep);
+            rois[keep++] = rois[g];
+        }
+    rois.resize(keep);
+    for (auto &gid : group_of)
+        if (gid >= 0)
+            gid = remap[gid];
+    return rois;
+}
+
+SmallVector<LightBlob::ptr, 32> ArmorDetector::findLightBlobs(cv::Mat &bin)
+{
+    const auto param = para::armor_detector_snapshot();
+    // 积分图瓦片粗筛：暗场景下先剔除不可能包含有效灯条的区域，仅在候选区域内提取轮廓
+    const int tile = param->PREFILTER_TILE;
+    if (tile > 0)
+    {
+        std::vector<int> group_of;
+        int tiles_x{};
+        auto rois = prefilterTiles(bin, tile, param->MIN_CONTOUR_AREA, group_of, tiles_x);
+        if (rois.empty())
+            return {};
+        std::size_t covered{};
+        for (const auto &roi : rois)
+            covered += static_cast<std::size_t>(roi.area());
+        // 候选区域近乎铺满全图时粗筛收益为负，回退至下方的分带查找
+        if (covered < param->PREFILTER_MAX_COVERAGE * bin.rows * bin.cols)
+        {
+            SmallVector<LightBlob::ptr, 32> light_blobs;
+            std::vector<std::vector<cv::Point>> contours;
+            for (std::size_t g = 0; g < rois.size(); ++g)
+            {
+                contours.clear();
+                cv::findContours(bin(rois[g]), contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE, rois[g].tl());
+                // 不同组的包围盒可能在像素空间重叠，轮廓由其顶端像素所在瓦片的组完整提取，避免重复构造
+                std::vector<std::vector<cv::Point>> owned;
+                owned.reserve(contours.size());
+                for (auto &contour : contours)
+                {
+                    const auto &top = *std::min_element(contour.begin(), contour.end(), [](const cv::Point &lhs, const cv::Point &rhs) {
+                        return lhs.y < rhs.y;
+                    });
+                    if (group_of[top.y / tile * tiles_x + top.x / tile] == static_cast<int>(g))
+                        owned.emplace_back(std::move(contour));
+                }
+                buildLightBlobs(owned, light_blobs);
+            }
+            return light_blobs;
+        }
+    }
+    int bands = param->PARALLEL_FIND_BANDS;
+    if (bands <= 0)
+        bands = static_cast<int>(ThreadPool::global().size() + 1);
+    const int halo = param->FIND_BAND_HALO;
+    // 分带过窄时并行收益为负，退化为串行查找
+    if (bands <= 1 || bin.rows < 4 * halo * bands)
+    {
+        SmallVector<LightBlob::ptr, 32> light_blobs;
+        std::vector<std::vector<cv::Point>> contours;
+        cv::findContours(bin, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE);
+        buildLightBlobs(contours, light_blobs);
+        return light_blobs;
+    }
+    // 按行分带并行查找，相邻分带间重叠 halo 行，跨分带边界的轮廓由其顶端像素所在分带完整提取
+    const int band_height = (bin.rows + bands - 1) / bands;
+    std::vector<SmallVector<LightBlob::ptr, 32>> band_blobs(bands);
+    // 灯条查找位于识别热路径，分发至共享线程池的高优先级通道
+    ThreadPool::global().parallel_for(0, bands, [&](std::size_t start, std::size_t end) {
+        for (int i = static_cast<int>(start); i < static_cast<int>(end); ++i)
+        {
+            int core_top = i * band_height;
+            int core_bottom = std::min(bin.rows, core_top + band_height);
+            int top = std::max(0, core_top - halo);
+            int bottom = std::min(bin.rows, core_bottom + halo);
+            std::vector<std::vector<cv::Point>> contours;
+            cv::findContours(bin.rowRange(top, bottom), contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE, {0, top});
+            // 仅保留顶端像素落在本分带核心区域内的轮廓，避免相邻分带重复构造
+            std::vector<std::vector<cv::Point>> owned;
+            owned.reserve(contours.size());
+            for (auto &contour : contours)
+            {
+                int top_y = std::min_element(contour.begin(), contour.end(), [](const cv::Point &lhs, const cv::Point &rhs) {
+                                return lhs.y < rhs.y;
+                            })->y;
+                if (top_y >= core_top && top_y < core_bottom)
+                    owned.emplace_back(std::move(contour));
+            }
+            buildLightBlobs(owned, band_blobs[i]);
+        }
+    }, TaskLane::High);
+    // 按分带顺序合并
+    SmallVector<LightBlob::ptr, 32> light_blobs;
+    for (auto &blobs : band_blobs)
+        light_blobs.insert(light_blobs.end(), std::make_move_iterator(blobs.begin()), std::make_move_iterator(blobs.end()));
+    return light_blobs;
+}
+
+SmallVector<LightBlob::ptr, 32> ArmorDetector::findLightBlobs(cv::Mat &bin, const std::vector<cv::Rect> &seeds)
+{
+    SmallVector<LightBlob::ptr, 32> light_blobs;
+    std::vector<std::vector<cv::Point>> contours;
+    // 候选区域在构造时已合并相交部分，逐区域查找不会重复构造灯条
+    for (const auto &seed : seeds)
+    {
+        contours.clear();
+        cv::findContours(bin(seed), contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE, seed.tl());
+        buildLightBlobs(contours, light_blobs);
     }
     return light_blobs;
 }
 
-std::vector<Armor::ptr> ArmorDetector::findArmors(std::vector<LightBlob::ptr> &light_blobs)
+SmallVector<Armor::ptr, 8> ArmorDetector::findArmors(SmallVector<LightBlob::ptr, 32> &light_blobs)
 {
     // 灯条从左到右排序
     sort(light_blobs.begin(), light_blobs.end(), [&](LightBlob::ptr p_left, LightBlob::ptr p_right) {
         return p_left->center().x < p_right->center().x;
     });
     // 储存所有匹配到的装甲板
-    std::vector<Armor::ptr> current_armors;
+    SmallVector<Armor::ptr, 8> current_armors;
     if (light_blobs.size() < 2)
         return current_armors;
     // -------------------------------------【匹配】-------------------------------------
@@ -126,7 +387,7 @@ std::vector<Armor::ptr> ArmorDetector::findArmors(std::vector<LightBlob::ptr> &l
     return current_armors;
 }
 
-void ArmorDetector::eraseErrorArmors(std::vector<Armor::ptr> &armors)
+void ArmorDetector::eraseErrorArmors(SmallVector<Armor::ptr, 8> &armors)
 {
     // 判断大小是否允许被删除
     if (armors.size() < 2)
@@ -154,7 +415,7 @@ void ArmorDetector::eraseErrorArmors(std::vector<Armor::ptr> &armors)
                  armors.end());
 }
 
-void ArmorDetector::eraseFakeArmors(std::vector<Armor::ptr> &armors)
+void ArmorDetector::eraseFakeArmors(SmallVector<Armor::ptr, 8> &armors)
 {
     armors.erase(remove_if(armors.begin(), armors.end(), [&](Armor::ptr &it) {
                      return it->state().at_string("robot") == "unknown";
@@ -162,7 +423,7 @@ void ArmorDetector::eraseFakeArmors(std::vector<Armor::ptr> &armors)
                  armors.end());
 }
 
-void ArmorDetector::eraseBrightBlobs(cv::Mat src, std::vector<LightBlob::ptr> &blobs)
+void ArmorDetector::eraseBrightBlobs(cv::Mat src, SmallVector<LightBlob::ptr, 32> &blobs)
 {
     blobs.erase(remove_if(blobs.begin(), blobs.end(), [&](LightBlob::ptr blob) {
                     int total_brightness = 0;
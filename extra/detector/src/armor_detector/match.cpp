@@ -9,8 +9,11 @@
  *
  */
 
+#include <algorithm>
+#include <unordered_map>
 #include <unordered_set>
 
+#include "rmvl/core/thread_pool.hpp"
 #include "rmvl/detector/armor_detector.h"
 
 #include "rmvlpara/detector/armor_detector.h"
@@ -33,17 +36,76 @@ static inline bool isChange(const combo::ptr &t_combo, const combo::ptr &combo,
     return ((t_combo->angle() * combo->angle() < -80.f) || dis > para::armor_detector_param.MAX_TRACKER_DELTA_DIS);
 }
 
+//! 平面两点间距离的平方，用于粗筛时避免开方
+static inline float getSquaredDistance(const cv::Point2f &pt_1, const cv::Point2f &pt_2)
+{
+    float dx = pt_1.x - pt_2.x, dy = pt_1.y - pt_2.y;
+    return dx * dx + dy * dy;
+}
+
+namespace
+{
+
+/**
+ * @brief 均匀网格空间索引
+ * @note 以最大跟踪距离为格边长，每帧构建一次。查询点 3×3 邻域格内即覆盖所有间距不超过
+ *       格边长的候选，因此邻域内平方距离不超过门限的最近候选必为全局最近，
+ *       无需遍历全部 tracker × combo 组合
+ */
+class UniformGrid
+{
+public:
+    explicit UniformGrid(float cell_size) : _inv_cell(1.f / cell_size) {}
+
+    //! 将下标为 idx 的点登记到所在的格中
+    void insert(const cv::Point2f &pt, std::size_t idx) { _cells[keyOf(pt)].push_back(idx); }
+
+    //! 遍历查询点 3×3 邻域格内的所有下标
+    template <typename Callable>
+    void forEachNeighbor(const cv::Point2f &pt, Callable fn) const
+    {
+        int cx = static_cast<int>(std::floor(pt.x * _inv_cell));
+        int cy = static_cast<int>(std::floor(pt.y * _inv_cell));
+        for (int dx = -1; dx <= 1; ++dx)
+            for (int dy = -1; dy <= 1; ++dy)
+            {
+                auto it = _cells.find(keyOf(cx + dx, cy + dy));
+                if (it == _cells.end())
+                    continue;
+                for (auto idx : it->second)
+                    fn(idx);
+            }
+    }
+
+private:
+    static inline int64_t keyOf(int cx, int cy) { return (static_cast<int64_t>(cx) << 32) | static_cast<uint32_t>(cy); }
+    inline int64_t keyOf(const cv::Point2f &pt) const
+    {
+        return keyOf(static_cast<int>(std::floor(pt.x * _inv_cell)),
+                     static_cast<int>(std::floor(pt.y * _inv_cell)));
+    }
+
+    float _inv_cell;                                         //!< 格边长的倒数
+    std::unordered_map<int64_t, std::vector<std::size_t>> _cells; //!< 格坐标到点下标的映射
+};
+
+} // namespace
+
 void ArmorDetector::match(std::vector<group::ptr> &groups, const std::vector<combo::ptr> &combos)
 {
     auto &trackers = groups.front()->data();
     // combo 匹配 tracker
     matchArmors(trackers, combos);
-    // 删除失效的 tracker
-    trackers.erase(std::remove_if(trackers.begin(), trackers.end(),
-                                  [](tracker::const_ptr p_tracker) {
-                                      return p_tracker->invalid();
-                                  }),
-                   trackers.end());
+    // 删除失效的 tracker：失效追踪器移出容器后移交共享线程池的低优先级通道销毁，
+    // 目标频繁出入时多帧历史队列的堆释放不再发生在识别热路径上
+    auto dead = std::stable_partition(trackers.begin(), trackers.end(),
+                                      [](tracker::const_ptr p_tracker) { return !p_tracker->invalid(); });
+    if (dead != trackers.end())
+    {
+        auto retired = std::make_shared<std::vector<tracker::ptr>>(std::make_move_iterator(dead), std::make_move_iterator(trackers.end()));
+        trackers.erase(dead, trackers.end());
+        ThreadPool::global().submit([retired] { retired->clear(); }, TaskLane::Low);
+    }
 }
 
 void ArmorDetector::matchArmors(std::vector<tracker::ptr> &trackers, const std::vector<combo::ptr> &combos)
@@ -56,21 +118,42 @@ void ArmorDetector::matchArmors(std::vector<tracker::ptr> &trackers, const std::
         return;
     }
 
+    // 以最大跟踪距离为格边长，门限的平方用于平方距离粗筛
+    const float gate = para::armor_detector_param.MAX_TRACKER_DELTA_DIS;
+    const float gate2 = gate * gate;
+    constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
     // 如果当前帧识别到的装甲板数量 > 序列数量
     if (combos.size() > trackers.size())
     {
+        // 每帧构建一次 combo 中心的空间索引
+        UniformGrid grid(gate);
+        for (std::size_t i = 0; i < combos.size(); ++i)
+            grid.insert(combos[i]->center(), i);
         // 初始化装甲板集合
         std::unordered_set<combo::ptr> armor_set(combos.begin(), combos.end());
         // 距离最近的装甲板匹配到相应的序列中, 并 update
         for (auto p_tracker : trackers)
         {
-            // 离 p_tracker 最近的 combo 及其距离
-            auto min_it = std::min_element(combos.begin(), combos.end(), [&](combo::const_ptr lhs, combo::const_ptr rhs) {
-                return getDistance(lhs->center(), p_tracker->front()->center()) <
-                       getDistance(rhs->center(), p_tracker->front()->center());
+            const auto &center = p_tracker->front()->center();
+            // 邻域格内以平方距离粗筛，命中门限内的最近候选即为全局最近
+            std::size_t best = npos;
+            float best_dis2 = FLOAT_MAX;
+            grid.forEachNeighbor(center, [&](std::size_t idx) {
+                float dis2 = getSquaredDistance(combos[idx]->center(), center);
+                if (dis2 < best_dis2)
+                    best_dis2 = dis2, best = idx;
             });
-            p_tracker->update(*min_it);
-            armor_set.erase(*min_it);
+            combo::ptr p_combo{};
+            if (best != npos && best_dis2 <= gate2)
+                p_combo = combos[best];
+            else
+                // 门限内无候选，退化为全量遍历，保持与原实现一致的最近邻语义
+                p_combo = *std::min_element(combos.begin(), combos.end(), [&](combo::const_ptr lhs, combo::const_ptr rhs) {
+                    return getDistance(lhs->center(), center) < getDistance(rhs->center(), center);
+                });
+            p_tracker->update(p_combo);
+            armor_set.erase(p_combo);
         }
         // 没有匹配到的装甲板作为新的序列
         for (const auto &p_combo : armor_set)
@@ -79,17 +162,38 @@ void ArmorDetector::matchArmors(std::vector<tracker::ptr> &trackers, const std::
     // 如果当前帧识别到的装甲板数量 < 序列数量
     else if (combos.size() < trackers.size())
     {
+        // 每帧构建一次 tracker 中心的空间索引
+        UniformGrid grid(gate);
+        for (std::size_t i = 0; i < trackers.size(); ++i)
+            grid.insert(trackers[i]->front()->center(), i);
         // 初始化追踪器集合
         std::unordered_set<tracker::ptr> tracker_set(trackers.begin(), trackers.end());
         for (const auto &p_combo : combos)
         {
-            // 离 armor 最近的 tracker 及其距离
-            auto min_dis_tracker = std::min_element(trackers.begin(), trackers.end(), [&](tracker::const_ptr lhs, tracker::const_ptr rhs) {
-                return getDistance(p_combo->center(), lhs->front()->center()) <
-                       getDistance(p_combo->center(), rhs->front()->center());
+            const auto &center = p_combo->center();
+            // 距离始终以 tracker 当前中心计算，网格只负责缩小候选范围
+            std::size_t best = npos;
+            float best_dis2 = FLOAT_MAX;
+            grid.forEachNeighbor(center, [&](std::size_t idx) {
+                float dis2 = getSquaredDistance(center, trackers[idx]->front()->center());
+                if (dis2 < best_dis2)
+                    best_dis2 = dis2, best = idx;
             });
-            min_dis_tracker->get()->update(p_combo);
-            tracker_set.erase(*min_dis_tracker);
+            tracker::ptr p_tracker{};
+            if (best != npos && best_dis2 <= gate2)
+                p_tracker = trackers[best];
+            else
+            {
+                auto min_dis_tracker = std::min_element(trackers.begin(), trackers.end(), [&](tracker::const_ptr lhs, tracker::const_ptr rhs) {
+                    return getDistance(center, lhs->front()->center()) < getDistance(center, rhs->front()->center());
+                });
+                best = min_dis_tracker - trackers.begin();
+                p_tracker = *min_dis_tracker;
+            }
+            p_tracker->update(p_combo);
+            // 更新后中心移动到当前 combo 处，重新登记以保证后续查询不遗漏
+            grid.insert(p_tracker->front()->center(), best);
+            tracker_set.erase(p_tracker);
         }
         // 没有匹配到的序列传入 nullptr
         for (const auto &p_tracker : tracker_set)
@@ -98,29 +202,52 @@ void ArmorDetector::matchArmors(std::vector<tracker::ptr> &trackers, const std::
     // 如果当前帧识别到的装甲板数量 = 序列数量
     else
     {
+        // 每帧构建一次 combo 中心的空间索引
+        UniformGrid grid(gate);
+        for (std::size_t i = 0; i < combos.size(); ++i)
+            grid.insert(combos[i]->center(), i);
         // 初始化装甲板集合
         std::unordered_set<combo::ptr> armor_set(combos.begin(), combos.end());
         // 防止出现迭代器非法化的情况，此处使用下标访问
         size_t before_size = trackers.size(); // 存储原始 trackers 大小
         for (size_t i = 0; i < before_size; i++)
         {
-            // 离 tracker 最近的 combo
-            auto min_it = std::min_element(armor_set.begin(), armor_set.end(), [&](const combo::ptr &lhs, const combo::ptr &rhs) {
-                return getDistance(lhs->center(), trackers[i]->front()->center()) <
-                       getDistance(rhs->center(), trackers[i]->front()->center());
+            const auto &center = trackers[i]->front()->center();
+            // 仅在尚未匹配的装甲板中粗筛
+            std::size_t best = npos;
+            float best_dis2 = FLOAT_MAX;
+            grid.forEachNeighbor(center, [&](std::size_t idx) {
+                if (armor_set.find(combos[idx]) == armor_set.end())
+                    return;
+                float dis2 = getSquaredDistance(combos[idx]->center(), center);
+                if (dis2 < best_dis2)
+                    best_dis2 = dis2, best = idx;
             });
-            // 最短距离
-            float min_dis = getDistance(min_it->get()->center(), trackers[i]->front()->center());
+            combo::ptr p_combo{};
+            float min_dis{};
+            if (best != npos && best_dis2 <= gate2)
+            {
+                p_combo = combos[best];
+                min_dis = std::sqrt(best_dis2);
+            }
+            else
+            {
+                auto min_it = std::min_element(armor_set.begin(), armor_set.end(), [&](const combo::ptr &lhs, const combo::ptr &rhs) {
+                    return getDistance(lhs->center(), center) < getDistance(rhs->center(), center);
+                });
+                p_combo = *min_it;
+                min_dis = getDistance(p_combo->center(), center);
+            }
             // 判断是否突变
-            if (isChange(trackers[i]->front(), *min_it, min_dis))
+            if (isChange(trackers[i]->front(), p_combo, min_dis))
             {
                 // 创建新序列，原来的序列打入 nullptr
                 trackers[i]->update(_tick, _imu_data);
-                trackers.emplace_back(PlanarTracker::make_tracker(*min_it));
+                trackers.emplace_back(PlanarTracker::make_tracker(p_combo));
             }
             else
-                trackers[i]->update(*min_it);
-            armor_set.erase(*min_it);
+                trackers[i]->update(p_combo);
+            armor_set.erase(p_combo);
         }
     }
 }
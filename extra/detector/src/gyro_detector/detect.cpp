@@ -9,6 +9,10 @@
  *
  */
 
+#include <algorithm>
+
+#include <opencv2/imgproc.hpp>
+
 #include "rmvl/detector/gyro_detector.h"
 #include "rmvl/group/gyro_group.h"
 
@@ -24,10 +28,61 @@ GyroDetector::GyroDetector(std::string_view model, int armor_num) : _armor_num(a
         _robot_t[i] = static_cast<RobotType>(i);
 }
 
+/**
+ * @brief 从上一帧追踪器构造膨胀后的候选搜索区域
+ *
+ * @param[in] groups 序列组容器
+ * @param[in] size 图像尺寸
+ * @param[in] ratio 包围盒向四周膨胀的宽高比例
+ * @return 合并相交部分后的候选区域列表
+ */
+static std::vector<cv::Rect> seedRegions(const std::vector<group::ptr> &groups, const cv::Size &size, double ratio)
+{
+    std::vector<cv::Rect> seeds;
+    for (const auto &p_group : groups)
+        for (const auto &p_tracker : p_group->data())
+        {
+            // 仅使用当前帧仍在稳定追踪的目标
+            if (p_tracker->empty() || p_tracker->getVanishNumber() > 0 || p_tracker->corners().empty())
+                continue;
+            cv::Rect rect = cv::boundingRect(p_tracker->corners());
+            int dw = static_cast<int>(rect.width * ratio);
+            int dh = static_cast<int>(rect.height * ratio);
+            rect -= cv::Point(dw, dh);
+            rect += cv::Size(2 * dw, 2 * dh);
+            rect &= cv::Rect({}, size);
+            if (rect.area() > 0)
+                seeds.push_back(rect);
+        }
+    // 合并相交的候选区域，避免重叠部分重复查找轮廓
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (size_t i = 0; !merged && i + 1 < seeds.size(); ++i)
+            for (size_t j = i + 1; !merged && j < seeds.size(); ++j)
+                if ((seeds[i] & seeds[j]).area() > 0)
+                {
+                    seeds[i] |= seeds[j];
+                    seeds.erase(seeds.begin() + j);
+                    merged = true;
+                }
+    }
+    return seeds;
+}
+
 DetectInfo GyroDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick)
 {
+    DetectInfo info;
+    detect(groups, src, color, imu_data, tick, info);
+    return info;
+}
+
+void GyroDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick, DetectInfo &info)
+{
+    auto stats_probe = probe(groups.size());
     // 识别信息
-    DetectInfo info{};
+    info.clear();
     info.src = src;
     _tick = tick;
     _imu_data = imu_data;
@@ -35,13 +90,25 @@ DetectInfo GyroDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &
     // 二值化处理图像
     PixChannel ch_minus = color == RED ? BLUE : RED;
     int thesh = color == RED ? para::gyro_detector_param.GRAY_THRESHOLD_RED : para::gyro_detector_param.GRAY_THRESHOLD_BLUE;
-    info.bin = binary(info.src, color, ch_minus, thesh);
+    binary(info.src, _ws.bin, color, ch_minus, thesh);
+    info.bin = _ws.bin;
 
+    // 增量搜索：优先在上一帧追踪目标的膨胀区域内查找，周期性全图搜索以捕获新目标
+    std::vector<cv::Rect> seeds;
+    if (para::gyro_detector_param.ENABLE_INCREMENTAL_FIND != 0 &&
+        ++_frame_cnt % std::max(1, para::gyro_detector_param.INCREMENTAL_FULL_INTERVAL) != 0)
+        seeds = seedRegions(groups, info.bin.size(), para::gyro_detector_param.INCREMENTAL_EXPAND_RATIO);
     // 找到所有的灯条和装甲板
-    find(info.bin, info.features, info.combos, info.rois);
+    find(info.bin, info.features, info.combos, info.rois, seeds);
+    // 候选区域内全部脱靶时，退回全图搜索
+    if (!seeds.empty() && info.combos.empty())
+    {
+        info.features.clear();
+        info.rois.clear();
+        find(info.bin, info.features, info.combos, info.rois);
+    }
     // 将目标匹配进序列组
     match(groups, info.combos);
-    return info;
 }
 
 } // namespace rm
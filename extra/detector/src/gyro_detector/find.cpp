@@ -9,6 +9,9 @@
  *
  */
 
+#include <algorithm>
+#include <iterator>
+
 #include <opencv2/imgproc.hpp>
 
 #include "rmvl/detector/gyro_detector.h"
@@ -19,18 +22,18 @@
 namespace rm
 {
 
-void GyroDetector::find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos, std::vector<cv::Mat> &rois)
+void GyroDetector::find(cv::Mat &src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos, std::vector<cv::Mat> &rois, const std::vector<cv::Rect> &seeds)
 {
     // ----------------------- light_blob -----------------------
-    // 找到所有灯条
-    std::vector<LightBlob::ptr> blobs = findLightBlobs(src);
+    // 找到所有灯条，存在候选区域时仅在区域内查找
+    SmallVector<LightBlob::ptr, 32> blobs = seeds.empty() ? findLightBlobs(src) : findLightBlobs(src, seeds);
     // 删除过亮灯条
     eraseBrightBlobs(src, blobs);
     // ------------------------- armor --------------------------
     if (blobs.size() >= 2)
     {
         // 找到所有装甲板
-        std::vector<Armor::ptr> armors = findArmors(blobs);
+        SmallVector<Armor::ptr, 8> armors = findArmors(blobs);
         if (_ort)
         {
             rois.clear();
@@ -62,36 +65,58 @@ void GyroDetector::find(cv::Mat &src, std::vector<feature::ptr> &features, std::
     }
 }
 
-std::vector<LightBlob::ptr> GyroDetector::findLightBlobs(cv::Mat &bin)
+/**
+ * @brief 从轮廓列表中构造灯条
+ *
+ * @param[in] contours 轮廓列表
+ * @param[out] light_blobs 构造出的灯条列表
+ */
+static void buildLightBlobs(std::vector<std::vector<cv::Point>> &contours, SmallVector<LightBlob::ptr, 32> &light_blobs)
+{
+    // 排除面积过小的误识别
+    contours.erase(std::remove_if(contours.begin(), contours.end(), [](const std::vector<cv::Point> &contour) {
+                       return cv::contourArea(contour) < para::gyro_detector_param.MIN_CONTOUR_AREA;
+                   }),
+                   contours.end());
+    // 批量完成几何解算并构造灯条
+    auto blobs = LightBlob::make_features(contours);
+    light_blobs.insert(light_blobs.end(), std::make_move_iterator(blobs.begin()), std::make_move_iterator(blobs.end()));
+}
+
+SmallVector<LightBlob::ptr, 32> GyroDetector::findLightBlobs(cv::Mat &bin)
 {
     // 储存找到的灯条
-    std::vector<LightBlob::ptr> light_blobs;
-    // 储存查找出的轮廓
-    std::vector<std::vector<cv::Point>> contours;
+    SmallVector<LightBlob::ptr, 32> light_blobs;
+    // 储存查找出的轮廓（帧间复用）
+    auto &contours = _ws.contours;
     // 查找最外围轮廓
     cv::findContours(bin, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE);
-    for (auto &contour : contours)
+    buildLightBlobs(contours, light_blobs);
+    return light_blobs;
+}
+
+SmallVector<LightBlob::ptr, 32> GyroDetector::findLightBlobs(cv::Mat &bin, const std::vector<cv::Rect> &seeds)
+{
+    SmallVector<LightBlob::ptr, 32> light_blobs;
+    auto &contours = _ws.contours;
+    // 候选区域在构造时已合并相交部分，逐区域查找不会重复构造灯条
+    for (const auto &seed : seeds)
     {
-        // 排除面积过小的误识别
-        if (cv::contourArea(contour) < para::gyro_detector_param.MIN_CONTOUR_AREA)
-            continue;
-        // 构造灯条对象
-        LightBlob::ptr p_light = LightBlob::make_feature(contour);
-        // 将识别出的灯条 push 到 light_blobs 中
-        if (p_light != nullptr)
-            light_blobs.push_back(p_light);
+        contours.clear();
+        cv::findContours(bin(seed), contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE, seed.tl());
+        buildLightBlobs(contours, light_blobs);
     }
     return light_blobs;
 }
 
-std::vector<Armor::ptr> GyroDetector::findArmors(std::vector<LightBlob::ptr> &light_blobs)
+SmallVector<Armor::ptr, 8> GyroDetector::findArmors(SmallVector<LightBlob::ptr, 32> &light_blobs)
 {
     // 灯条从左到右排序
     sort(light_blobs.begin(), light_blobs.end(), [](LightBlob::const_ptr lhs, LightBlob::const_ptr rhs) {
         return lhs->center().x < rhs->center().x;
     });
     // 储存所有匹配到的装甲板
-    std::vector<Armor::ptr> current_armors;
+    SmallVector<Armor::ptr, 8> current_armors;
     if (light_blobs.size() < 2)
         return current_armors;
     // -------------------------------------【匹配】-------------------------------------
@@ -126,7 +151,7 @@ std::vector<Armor::ptr> GyroDetector::findArmors(std::vector<LightBlob::ptr> &li
     return current_armors;
 }
 
-void GyroDetector::eraseErrorArmors(std::vector<Armor::ptr> &armors)
+void GyroDetector::eraseErrorArmors(SmallVector<Armor::ptr, 8> &armors)
 {
     // 判断大小是否允许被删除
     if (armors.size() < 2)
@@ -153,7 +178,7 @@ void GyroDetector::eraseErrorArmors(std::vector<Armor::ptr> &armors)
                  armors.end());
 }
 
-void GyroDetector::eraseFakeArmors(std::vector<Armor::ptr> &armors)
+void GyroDetector::eraseFakeArmors(SmallVector<Armor::ptr, 8> &armors)
 {
     armors.erase(std::remove_if(armors.begin(), armors.end(), [](Armor::const_ptr it) {
                      return it->state().at_string("robot") == "unknown";
@@ -161,7 +186,7 @@ void GyroDetector::eraseFakeArmors(std::vector<Armor::ptr> &armors)
                  armors.end());
 }
 
-void GyroDetector::eraseBrightBlobs(cv::Mat src, std::vector<LightBlob::ptr> &blobs)
+void GyroDetector::eraseBrightBlobs(cv::Mat src, SmallVector<LightBlob::ptr, 32> &blobs)
 {
     blobs.erase(std::remove_if(blobs.begin(), blobs.end(), [&](LightBlob::const_ptr blob) {
                     int total_brightness = 0;
@@ -22,21 +22,42 @@ std::unordered_map<size_t, size_t> GyroDetector::ewTopsisInference(group::ptr gr
     auto pGyroGroup = GyroGroup::cast(group);
     if (trackers.empty() || combos.empty())
         return {};
-    // (a) 生成样本指标矩阵，（指标：距离，角度差）
-    std::vector<std::vector<double>> samples(trackers.size() * combos.size());
+    // (a) 生成样本指标矩阵（指标：4 个角点距离），缓冲区跨帧复用，尺寸不增长时不产生分配。
+    //     装甲板与追踪器首帧组合体的角点先收集至位姿 SoA 表，距离计算直接索引连续数组，
+    //     无需在 O(CT) 双重循环内重新遍历 combo::ptr 指针图
+    _ew_ws.combo_table.build(combos);
+    _ew_ws.fronts.resize(trackers.size());
+    for (size_t t = 0; t < trackers.size(); ++t)
+        _ew_ws.fronts[t] = trackers[t]->front();
+    _ew_ws.tracker_table.build(_ew_ws.fronts);
+    const auto &ct = _ew_ws.combo_table;
+    const auto &tt = _ew_ws.tracker_table;
+    auto &samples = _ew_ws.samples;
+    size_t rows = trackers.size() * combos.size();
+    samples.resize(rows);
     for (size_t c = 0; c < combos.size(); ++c)
     {
         for (size_t t = 0; t < trackers.size(); ++t)
         {
-            // 2 表示两个指标
-            samples[c * trackers.size() + t].resize(4);
-            for (int i = 0; i < 4; i++)
-                samples[c * trackers.size() + t][i] = -getDistance(combos[c]->corners()[i], trackers[t]->front()->corners()[i]);
+            auto &row = samples[c * trackers.size() + t];
+            row.resize(4);
+            for (size_t i = 0; i < 4; i++)
+            {
+                double dx = ct.corner_x[4 * c + i] - tt.corner_x[4 * t + i];
+                double dy = ct.corner_y[4 * c + i] - tt.corner_y[4 * t + i];
+                row[i] = -std::sqrt(dx * dx + dy * dy);
+            }
         }
     }
-    // (b) 运用熵权法推理
-    EwTopsis ew(samples);
-    auto arr = ew.inference();
+    // (b) 运用熵权法推理，样本行数与上一帧一致时整体复用 TOPSIS 工作区
+    if (_ew_ws.topsis == nullptr || _ew_ws.rows != rows)
+    {
+        _ew_ws.topsis = std::make_unique<EwTopsis>(samples);
+        _ew_ws.rows = rows;
+    }
+    else
+        _ew_ws.topsis->updateSamples(samples);
+    auto arr = _ew_ws.topsis->inference();
     // (c) 数据导出并提取出指定的下标
     std::unordered_map<size_t, size_t> target;
     target.reserve(combos.size());
@@ -87,12 +87,19 @@ void GyroDetector::match(std::vector<group::ptr> &groups, std::vector<combo::ptr
         sort(combos.begin(), combos.end(), [](combo::const_ptr lhs, combo::const_ptr rhs) {
             return lhs->center().x < rhs->center().x;
         });
-        UnionFind<combo::ptr> uf(combos.begin(), combos.end());
+        DenseUnionFind uf(combos.size());
         for (size_t i = 0; i + 1 < combos.size(); ++i)
             for (size_t j = i + 1; j < combos.size(); ++j)
                 if (canBeUnion(combos[i], combos[j]))
-                    uf.merge(combos[i], combos[j]);
-        combo_maps = uf.extract();
+                    uf.merge(i, j);
+        // 以每个集合中最靠左的装甲板为代表元素
+        for (const auto &idxs : uf.extract())
+        {
+            auto &combo_vec = combo_maps[combos[idxs.front()]];
+            combo_vec.reserve(idxs.size());
+            for (auto idx : idxs)
+                combo_vec.emplace_back(combos[idx]);
+        }
     }
     // groups 为空，进行初始化
     if (groups.empty())
@@ -136,72 +143,84 @@ void GyroDetector::match(std::vector<group::ptr> &groups, std::vector<combo::ptr
             groups_center[represent] = group_center;
         }
 
+        // 代表装甲板及其序列组中轴线坐标的 KD 树，用于最近邻匹配
+        std::vector<combo::ptr> represents;
+        represents.reserve(combo_maps.size());
+        std::vector<std::array<float, 3>> represent_points;
+        represent_points.reserve(combo_maps.size());
+        for (const auto &p : combo_maps)
+        {
+            represents.push_back(p.first);
+            const auto &center = groups_center[p.first];
+            represent_points.push_back({center[0], center[1], center[2]});
+        }
+        KDTree<3> represent_kdtree(represent_points);
+
         // combo_maps > groups
         if (combo_maps.size() > groups.size())
         {
-            // 初始化代表装甲板集合
-            std::unordered_set<combo::ptr> represent_set;
-            for (const auto &p : combo_maps)
-                represent_set.insert(p.first); // represent
-            // 距离最近的装甲板组匹配到相应的序列组中
+            std::vector<bool> matched(represents.size());
+            // 距离最近且未被匹配的装甲板组匹配到相应的序列组中
             for (auto &p_group : groups)
             {
                 auto p_gyro_group = GyroGroup::cast(p_group);
-                // 离 p_group 最近的 group_center 及其距离
-                auto min_it = *min_element(represent_set.begin(), represent_set.end(), [&](combo::const_ptr lhs, combo::const_ptr rhs) {
-                    return getDistance(groups_center[lhs], cv::Point3f(p_gyro_group->getCenter3D())) <
-                           getDistance(groups_center[rhs], cv::Point3f(p_gyro_group->getCenter3D()));
-                });
-                matchOneGroup(p_group, combo_maps[min_it]);
-                represent_set.erase(min_it);
+                cv::Vec3f center = p_gyro_group->getCenter3D();
+                size_t min_idx = represent_kdtree.nearest({center[0], center[1], center[2]},
+                                                          [&matched](size_t idx) { return !matched[idx]; });
+                matchOneGroup(p_group, combo_maps[represents[min_idx]]);
+                matched[min_idx] = true;
             }
             // 没有匹配到的装甲板组作为新的序列
-            for (const auto &represent : represent_set)
-                groups.emplace_back(GyroGroup::make_group(combo_maps[represent], _armor_num));
+            for (size_t i = 0; i < represents.size(); i++)
+                if (!matched[i])
+                    groups.emplace_back(GyroGroup::make_group(combo_maps[represents[i]], _armor_num));
         }
         // combo_maps < groups
         else if (combo_maps.size() < groups.size())
         {
-            // 初始化序列组集合
-            std::unordered_set<GyroGroup::ptr> group_set(groups.size());
+            // 序列组中轴线坐标的 KD 树
+            std::vector<GyroGroup::ptr> gyro_groups;
+            gyro_groups.reserve(groups.size());
+            std::vector<std::array<float, 3>> group_points;
+            group_points.reserve(groups.size());
             for (const auto &p_group : groups)
             {
                 auto p_gyro_group = GyroGroup::cast(p_group);
-                group_set.insert(p_gyro_group);
+                cv::Vec3f center = p_gyro_group->getCenter3D();
+                gyro_groups.push_back(p_gyro_group);
+                group_points.push_back({center[0], center[1], center[2]});
             }
-            // 距离最近的装甲板组匹配到相应的序列组中
+            KDTree<3> group_kdtree(group_points);
+            std::vector<bool> matched(gyro_groups.size());
+            // 距离最近且未被匹配的装甲板组匹配到相应的序列组中
             for (const auto &combo_map : combo_maps)
             {
-                // 离 group_center 最近的 group 及其距离
-                auto min_it = min_element(group_set.begin(), group_set.end(), [&](GyroGroup::ptr lhs, GyroGroup::ptr rhs) {
-                    return getDistance(groups_center[combo_map.first], cv::Point3f(lhs->getCenter3D())) <
-                           getDistance(groups_center[combo_map.first], cv::Point3f(rhs->getCenter3D()));
-                });
-                matchOneGroup(*min_it, combo_map.second);
-                group_set.erase(*min_it);
+                const auto &center = groups_center[combo_map.first];
+                size_t min_idx = group_kdtree.nearest({center[0], center[1], center[2]},
+                                                      [&matched](size_t idx) { return !matched[idx]; });
+                matchOneGroup(gyro_groups[min_idx], combo_map.second);
+                matched[min_idx] = true;
             }
             // 没有匹配到的序列组传入空集合
-            for (const auto &p_group : group_set)
-                matchOneGroup(p_group, {});
+            for (size_t i = 0; i < gyro_groups.size(); i++)
+                if (!matched[i])
+                    matchOneGroup(gyro_groups[i], {});
         }
         // combo_maps = groups
         else
         {
-            // 初始化代表装甲板集合
-            std::unordered_set<combo::ptr> represent_set;
-            for (const auto &p : combo_maps)
-                represent_set.insert(p.first); // represent
+            std::vector<bool> matched(represents.size());
             size_t before_size = groups.size();
             for (size_t i = 0; i < before_size; i++)
             {
                 auto p_gyro_group = GyroGroup::cast(groups[i]);
                 if (p_gyro_group == nullptr)
                     RMVL_Error(RMVL_BadDynamicType, "Dynamic type of p_gyro_group isn\'t equal to \"GyroGroup\"");
-                // 离 group 最近的 group_center
-                auto min_it = *min_element(represent_set.begin(), represent_set.end(), [&](combo::const_ptr lhs, combo::const_ptr rhs) {
-                    return getDistance(groups_center[lhs], cv::Point3f(p_gyro_group->getCenter3D())) <
-                           getDistance(groups_center[rhs], cv::Point3f(p_gyro_group->getCenter3D()));
-                });
+                // 离 group 最近且未被匹配的 group_center
+                cv::Vec3f center = p_gyro_group->getCenter3D();
+                size_t min_idx = represent_kdtree.nearest({center[0], center[1], center[2]},
+                                                          [&matched](size_t idx) { return !matched[idx]; });
+                combo::ptr min_it = represents[min_idx];
                 // 最短距离
                 float min_dis = getDistance(groups_center[min_it], cv::Point3f(p_gyro_group->getCenter3D()));
                 // 判断是否突变
@@ -214,23 +233,11 @@ void GyroDetector::match(std::vector<group::ptr> &groups, std::vector<combo::ptr
                 }
                 else
                     matchOneGroup(p_gyro_group, combo_maps[min_it]);
-                represent_set.erase(min_it);
-            }
-        }
-        // 为所有序列组进行同步，并记录出现异常的 group
-        std::unordered_set<group::const_ptr> remove_set;
-        for (const auto &p_group : groups)
-        {
-            try
-            {
-                p_group->sync(_imu_data, _tick);
-            }
-            catch (const rm::Exception &e)
-            {
-                ERROR_("Occurred an exception! %s", e.err.c_str());
-                remove_set.insert(p_group);
+                matched[min_idx] = true;
             }
         }
+        // 为所有序列组并行同步，并记录出现异常的 group
+        std::unordered_set<group::const_ptr> remove_set = parallelSync(groups, _imu_data, _tick);
         // 删除异常 group
         groups.erase(remove_if(groups.begin(), groups.end(), [&remove_set](group::const_ptr val) {
                          return remove_set.find(val) != remove_set.end();
@@ -9,6 +9,7 @@
  *
  */
 
+#include "rmvl/core/lineage.hpp"
 #include "rmvl/detector/rune_detector.h"
 #include "rmvl/group/rune_group.h"
 
@@ -19,9 +20,17 @@ namespace rm
 
 DetectInfo RuneDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick)
 {
+    DetectInfo info;
+    detect(groups, src, color, imu_data, tick, info);
+    return info;
+}
+
+void RuneDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick, DetectInfo &info)
+{
+    auto stats_probe = probe(groups.size());
     if (groups.size() > 1)
         RMVL_Error(RMVL_StsBadArg, "Size of the argument \"groups\" is greater than 1");
-    DetectInfo info{};
+    info.clear();
     info.src = src;
     _tick = tick;
     _imu_data = imu_data;
@@ -32,7 +41,8 @@ DetectInfo RuneDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &
     // 二值化处理图像
     PixChannel ch_minus = color == RED ? BLUE : RED;
     int thesh = color == RED ? para::rune_detector_param.GRAY_THRESHOLD_RED : para::rune_detector_param.GRAY_THRESHOLD_BLUE;
-    info.bin = binary(info.src, color, ch_minus, thesh);
+    binary(info.src, _ws.bin, color, ch_minus, thesh);
+    info.bin = _ws.bin;
     // 寻找神符
     find(info.bin, info.features, info.combos);
     // 匹配
@@ -44,8 +54,7 @@ DetectInfo RuneDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &
         groups = {RuneGroup::make_group()};
     else
         rune_group->sync(_imu_data, _tick);
-
-    return info;
+    lineage::mark(lineage::Stage::Sync);
 }
 
 } // namespace rm
@@ -239,8 +239,8 @@ static std::vector<Rune::ptr> getRune(const std::vector<RuneTarget::ptr> &rune_t
 
 void RuneDetector::find(cv::Mat src, std::vector<feature::ptr> &features, std::vector<combo::ptr> &combos)
 {
-    std::vector<std::vector<cv::Point>> contours; // 轮廓二维向量
-    std::vector<cv::Vec4i> hierarchy;             // 轮廓等级向量
+    auto &contours = _ws.contours;   // 轮廓二维向量（帧间复用）
+    auto &hierarchy = _ws.hierarchy; // 轮廓等级向量（帧间复用）
     // 神符轮廓识别
     findContours(src, contours, hierarchy, cv::RETR_TREE, cv::CHAIN_APPROX_NONE);
     // 神符旋转中心向量
@@ -9,14 +9,20 @@
  *
  */
 
-#include <unordered_set>
-
+#include "rmvl/algorithm/datastruct.hpp"
 #include "rmvl/detector/rune_detector.h"
 #include "rmvl/group/rune_group.h"
 
 namespace rm
 {
 
+//! 将角度嵌入单位圆，弦长与循环角度差单调对应，最近邻查询等效于最小 getDeltaAngle 扫描
+static inline std::array<float, 2> angleEmbed(float angle)
+{
+    float rad = deg2rad(angle);
+    return {std::cos(rad), std::sin(rad)};
+}
+
 static void matchRunes(std::vector<tracker::ptr> &trackers, const std::vector<combo::ptr> &combos, const ImuData &imu_data, double tick)
 {
     // 如果 trackers 为空先为每个识别到的 active_rune 开辟序列
@@ -29,56 +35,62 @@ static void matchRunes(std::vector<tracker::ptr> &trackers, const std::vector<co
     // 如果当前帧识别到的神符数量 > 序列数量
     if (combos.size() > trackers.size())
     {
-        // 初始化哈希表
-        std::unordered_set<combo::ptr> combo_set(combos.begin(), combos.end());
+        // 构建神符角度的 KD 树
+        std::vector<std::array<float, 2>> points(combos.size());
+        for (size_t i = 0; i < combos.size(); i++)
+            points[i] = angleEmbed(combos[i]->angle());
+        KDTree<2> kdtree(points);
+        std::vector<bool> matched(combos.size());
         // 距离最近的神符匹配到相应序列中，并 update
         for (auto p_tracker : trackers)
         {
             // 离 p_tracker 最近的 active_rune
-            combo::ptr closest_rune = *min_element(combos.begin(), combos.end(), [&p_tracker](combo::ptr lhs, combo::ptr rhs) {
-                return getDeltaAngle(lhs->angle(), p_tracker->front()->angle()) <
-                       getDeltaAngle(rhs->angle(), p_tracker->front()->angle());
-            });
-            p_tracker->update(closest_rune);
-            combo_set.erase(closest_rune);
+            size_t closest_idx = kdtree.nearest(angleEmbed(p_tracker->front()->angle()));
+            p_tracker->update(combos[closest_idx]);
+            matched[closest_idx] = true;
         }
         // 没有匹配到的神符作为新的序列，创建新的 tracker
-        for (auto p_combo : combo_set)
-            trackers.emplace_back(RuneTracker::make_tracker(p_combo));
+        for (size_t i = 0; i < combos.size(); i++)
+            if (!matched[i])
+                trackers.emplace_back(RuneTracker::make_tracker(combos[i]));
     }
     // 如果当前帧识别到的神符数量 < 序列数量
     else if (combos.size() < trackers.size())
     {
-        // 初始化哈希表
-        std::unordered_set<tracker::ptr> tracker_set(trackers.begin(), trackers.end());
+        // 构建序列角度的 KD 树
+        std::vector<std::array<float, 2>> points(trackers.size());
+        for (size_t i = 0; i < trackers.size(); i++)
+            points[i] = angleEmbed(trackers[i]->front()->angle());
+        KDTree<2> kdtree(points);
+        std::vector<bool> matched(trackers.size());
         for (auto p_combo : combos)
         {
             // 离 active_rune 最近的 tracker
-            tracker::ptr closest_tracker = *min_element(trackers.begin(), trackers.end(), [&](tracker::const_ptr lhs, tracker::const_ptr rhs) {
-                return getDeltaAngle(p_combo->angle(), lhs->front()->angle()) <
-                       getDeltaAngle(p_combo->angle(), rhs->front()->angle());
-            });
-            closest_tracker->update(p_combo);
-            tracker_set.erase(closest_tracker);
+            size_t closest_idx = kdtree.nearest(angleEmbed(p_combo->angle()));
+            trackers[closest_idx]->update(p_combo);
+            matched[closest_idx] = true;
         }
         // 没有匹配到的序列则执行丢帧操作
-        for (auto p_tracker : tracker_set)
-            p_tracker->update(tick, imu_data);
+        for (size_t i = 0; i < trackers.size(); i++)
+            if (!matched[i])
+                trackers[i]->update(tick, imu_data);
     }
     // 如果当前帧识别到的装甲板数量 = 序列数量
     else
     {
-        // 初始化哈希表
-        std::unordered_set<combo::ptr> combo_set(combos.begin(), combos.end());
-        //! @note 防止出现迭代器非法化的情况，此处使用下标访问
+        // 构建神符角度的 KD 树
+        std::vector<std::array<float, 2>> points(combos.size());
+        for (size_t i = 0; i < combos.size(); i++)
+            points[i] = angleEmbed(combos[i]->angle());
+        KDTree<2> kdtree(points);
+        std::vector<bool> matched(combos.size());
         size_t trackers_size = trackers.size();
         for (size_t i = 0; i < trackers_size; i++)
         {
-            // 离 tracker 最近的 p_combo
-            combo::ptr closest_combo = *min_element(combo_set.begin(), combo_set.end(), [&](combo::const_ptr lhs, combo::const_ptr rhs) {
-                return getDeltaAngle(lhs->angle(), trackers[i]->front()->angle()) <
-                       getDeltaAngle(rhs->angle(), trackers[i]->front()->angle());
-            });
+            // 离 tracker 最近且未被匹配的 p_combo
+            size_t closest_idx = kdtree.nearest(angleEmbed(trackers[i]->front()->angle()),
+                                                [&matched](size_t idx) { return !matched[idx]; });
+            combo::ptr closest_combo = combos[closest_idx];
             // 获取角度差
             float min_delta_angle = getDeltaAngle(closest_combo->angle(), trackers[i]->front()->angle());
             // 判断是否角度差过大
@@ -89,7 +101,7 @@ static void matchRunes(std::vector<tracker::ptr> &trackers, const std::vector<co
                 trackers[i]->update(tick, imu_data);
                 trackers.emplace_back(RuneTracker::make_tracker(closest_combo));
             }
-            combo_set.erase(closest_combo);
+            matched[closest_idx] = true;
         }
     }
 }
@@ -13,6 +13,7 @@
 
 #include <opencv2/imgproc.hpp>
 
+#include "rmvl/core/thread_pool.hpp"
 #include "rmvl/detector/tag_detector.h"
 #include "rmvl/feature/tag.h"
 #include "rmvl/tracker/planar_tracker.h"
@@ -135,9 +136,17 @@ static void match(std::vector<tracker::ptr> &trackers, const std::vector<combo::
     }
 }
 
-DetectInfo TagDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t, const ImuData &imu_data, double tick)
+DetectInfo TagDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick)
 {
     DetectInfo info;
+    detect(groups, src, color, imu_data, tick, info);
+    return info;
+}
+
+void TagDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &src, uint8_t, const ImuData &imu_data, double tick, DetectInfo &info)
+{
+    auto stats_probe = probe(groups.size());
+    info.clear();
     info.src = src;
     _tick = tick;
     _imu_data = imu_data;
@@ -145,10 +154,27 @@ DetectInfo TagDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &s
     if (groups.empty())
         groups.emplace_back(DefaultGroup::make_group());
 
-    cvtColor(src, info.gray, cv::COLOR_BGR2GRAY);
+    // 相机以 Mono8 等单通道格式输出时直接复用原图，省去整幅灰度转换，
+    // 否则转换到帧间复用的灰度缓冲区，尺寸不变时不产生分配
+    if (src.channels() == 1)
+        info.gray = src;
+    else
+    {
+        cvtColor(src, _gray, cv::COLOR_BGR2GRAY);
+        info.gray = _gray;
+    }
     std::vector<std::vector<cv::Point2f>> corners;
     std::vector<char> types;
 
+    // 并行与降采样配置：工作线程数与共享线程池规模保持一致，避免核心超额订阅，
+    // 数目变化时检测器内部的工作线程池在下一次检测前自动重建。四边形候选在降采样
+    // 图像上检测，候选边缘在原分辨率图像上精化（refine_edges），二进制解码不受降采样影响
+    int nthreads = para::tag_detector_param.NTHREADS;
+    if (nthreads <= 0)
+        nthreads = static_cast<int>(ThreadPool::global().size());
+    _td->nthreads = std::max(nthreads, 1);
+    _td->quad_decimate = std::max(para::tag_detector_param.QUAD_DECIMATE, 1.f);
+
     // 格式转换
     image_u8_t apriltag_img = {info.gray.cols,
                                info.gray.rows,
@@ -207,7 +233,6 @@ DetectInfo TagDetector::detect(std::vector<group::ptr> &groups, const cv::Mat &s
                        return p_tracker->invalid();
                    }),
                    trackers.end());
-    return info;
 }
 
 } // namespace rm
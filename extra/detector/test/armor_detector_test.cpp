@@ -15,6 +15,8 @@
 
 #include "armor_detector_test.h"
 
+#include "rmvlpara/detector/armor_detector.h"
+
 using namespace rm;
 
 namespace rm_test
@@ -147,6 +149,58 @@ TEST_F(ArmorDetectorTest, more_armor_disturb)
     EXPECT_EQ(info.combos.size(), 2);
 }
 
+// 交战目标掩码：掩码外的类型在分类后被剔除，不构造组合体
+TEST_F(ArmorDetectorTest, engage_mask_filter)
+{
+    cv::Point center(300, 300);
+    buildArmorImg(center, 5);
+    // 默认掩码包含全部类型
+    auto info = p_detector->detect(groups, src, RED, ImuData(), Timer::now());
+    EXPECT_EQ(info.combos.size(), 1u);
+    // 无分类网络时目标类型为 unknown，从掩码中清除 UNKNOWN 后目标被剔除
+    constexpr auto hero_only = make_robot_mask({RobotType::HERO});
+    para::armor_detector_param.ENGAGE_MASK = hero_only;
+    resetDetector();
+    groups.clear();
+    info = p_detector->detect(groups, src, RED, ImuData(), Timer::now());
+    EXPECT_TRUE(info.combos.empty());
+    para::armor_detector_param.ENGAGE_MASK = ROBOT_MASK_ALL;
+}
+
+// 写入式识别接口：跨帧复用同一 DetectInfo，列表容量不增长
+TEST_F(ArmorDetectorTest, detect_into_reuses_capacity)
+{
+    cv::Point center(300, 300);
+    buildArmorImg(center, 5);
+    DetectInfo info;
+    p_detector->detect(groups, src, RED, ImuData(), Timer::now(), info);
+    ASSERT_EQ(info.combos.size(), 1u);
+    auto cap_combos = info.combos.capacity();
+    auto cap_features = info.features.capacity();
+    // 相同场景再次识别，结果一致且容量复用
+    p_detector->detect(groups, src, RED, ImuData(), Timer::now(), info);
+    EXPECT_EQ(info.combos.capacity(), cap_combos);
+    EXPECT_EQ(info.features.capacity(), cap_features);
+    ASSERT_EQ(info.combos.size(), 1u);
+    EXPECT_LE(getDistance(info.combos.front()->center(), center), 10);
+}
+
+// 双缓冲交接：读缓冲区保持上一帧结果，交接不发生拷贝
+TEST_F(ArmorDetectorTest, detect_info_double_buffer)
+{
+    cv::Point center(300, 300);
+    buildArmorImg(center, 5);
+    DetectInfoBuffer buffer;
+    const auto *write_addr = &buffer.writeBuffer();
+    p_detector->detect(groups, src, RED, ImuData(), Timer::now(), buffer.writeBuffer());
+    buffer.swap();
+    // 交接后上一帧结果位于读缓冲区，写缓冲区为另一块存储
+    EXPECT_EQ(&buffer.readBuffer(), write_addr);
+    EXPECT_NE(&buffer.writeBuffer(), write_addr);
+    ASSERT_EQ(buffer.readBuffer().combos.size(), 1u);
+    EXPECT_LE(getDistance(buffer.readBuffer().combos.front()->center(), center), 10);
+}
+
 } // namespace rm_test
 
 #endif
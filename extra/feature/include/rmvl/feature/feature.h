@@ -12,6 +12,7 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
 
 #include <opencv2/core/types.hpp>
 
@@ -23,6 +24,67 @@ namespace rm
 //! @addtogroup feature
 //! @{
 
+/**
+ * @brief 帧作用域小对象内存池
+ * @note
+ * - 特征、组合体等对象图在每一帧中通过 `make_feature`、`make_combo` 大量构造，
+ *   逐个 `std::make_shared` 会产生数百次零散的堆分配。在当前线程激活帧内存池后，
+ *   这些工厂接口改为在池内集中分配，析构的内存块直接回到池内空闲链表，
+ *   几帧预热后即可完全避免每帧的堆分配
+ * @note
+ * - `clone()` 产生的持久副本（例如追踪器内的历史组合体）不经过帧内存池，仍使用默认堆分配
+ * @warning 池内构造的对象均以池的生命周期为上限，`release()` 仅当池内对象全部析构后才能调用
+ */
+class FrameArena
+{
+public:
+    FrameArena() = default;
+    ~FrameArena()
+    {
+        if (current() == &_pool)
+            current() = nullptr;
+    }
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    //! 在当前线程激活帧内存池，此后 `make_frame_shared` 均在池内分配
+    void activate() { current() = &_pool; }
+    //! 取消激活，恢复默认堆分配
+    void deactivate()
+    {
+        if (current() == &_pool)
+            current() = nullptr;
+    }
+    //! 批量归还全部池内内存
+    void release() { _pool.release(); }
+
+    //! 当前线程激活的内存资源，未激活时为空
+    static std::pmr::memory_resource *&current()
+    {
+        static thread_local std::pmr::memory_resource *res{};
+        return res;
+    }
+
+private:
+    std::pmr::unsynchronized_pool_resource _pool; //!< 分级空闲链表内存池
+};
+
+/**
+ * @brief 构造共享指针，当前线程激活了帧内存池则在池内分配，否则等价于 `std::make_shared`
+ *
+ * @tparam Tp 对象类型
+ * @tparam Args 构造函数参数类型
+ * @param[in] args 构造函数参数
+ * @return 指向新对象的共享指针
+ */
+template <typename Tp, typename... Args>
+inline std::shared_ptr<Tp> make_frame_shared(Args &&...args)
+{
+    if (auto *res = FrameArena::current(); res != nullptr)
+        return std::allocate_shared<Tp>(std::pmr::polymorphic_allocator<Tp>(res), std::forward<Args>(args)...);
+    return std::make_shared<Tp>(std::forward<Args>(args)...);
+}
+
 //! 图像中的轮廓特征
 class RMVL_EXPORTS_W_ABS feature
 {
@@ -84,7 +146,7 @@ public:
      * @param[in] p 孤立的二维点
      * @return DefaultFeature 共享指针
      */
-    RMVL_W static inline ptr make_feature(const cv::Point2f &p) { return std::make_shared<DefaultFeature>(p); }
+    RMVL_W static inline ptr make_feature(const cv::Point2f &p) { return make_frame_shared<DefaultFeature>(p); }
 
     /**
      * @brief 从另一个特征进行构造
@@ -52,6 +52,16 @@ public:
      */
     RMVL_W static ptr make_feature(const std::vector<cv::Point> &contour);
 
+    /**
+     * @brief LightBlob 批量构造接口
+     * @note 基于矩的等效椭圆拟合一次性完成多条轮廓的几何解算，
+     *       替代逐轮廓的 `cv::fitEllipse`，筛选条件与 `make_feature` 一致
+     *
+     * @param[in] contours 特征轮廓列表
+     * @return 构造成功的 LightBlob 共享指针列表
+     */
+    RMVL_W static std::vector<ptr> make_features(const std::vector<std::vector<cv::Point>> &contours);
+
     /**
      * @brief LightBlob 构造接口，使用若干参数
      *
@@ -60,7 +70,7 @@ public:
      * @param[in] width 灯条宽度
      * @return 若构造成功则返回 LightBlob 的共享指针，否则返回 nullptr
      */
-    RMVL_W static inline ptr make_feature(const cv::Point2f &top, const cv::Point2f &bottom, float width) { return std::make_shared<LightBlob>(top, bottom, width); }
+    RMVL_W static inline ptr make_feature(const cv::Point2f &top, const cv::Point2f &bottom, float width) { return make_frame_shared<LightBlob>(top, bottom, width); }
 
     /**
      * @brief 从另一个特征进行构造
@@ -60,7 +60,7 @@ public:
      */
     RMVL_W static inline ptr make_feature(float ref_width, float ref_height, const cv::Point2f &ref_center, float ref_angle, const std::vector<cv::Point2f> &ref_corners)
     {
-        return std::make_shared<Pilot>(ref_width, ref_height, ref_center, ref_angle, ref_corners);
+        return make_frame_shared<Pilot>(ref_width, ref_height, ref_center, ref_angle, ref_corners);
     }
 
     /**
@@ -42,7 +42,7 @@ public:
      * @param[in] center 特征中心点
      * @return 如果成功，返回 RuneCenter 的共享指针，否则返回 nullptr
      */
-    RMVL_W static inline ptr make_feature(const cv::Point2f &center) { return std::make_shared<RuneCenter>(center); }
+    RMVL_W static inline ptr make_feature(const cv::Point2f &center) { return make_frame_shared<RuneCenter>(center); }
 
     /**
      * @brief 使用轮廓和层次结构构造 RuneCenter 的构造接口
@@ -40,7 +40,7 @@ public:
     RMVL_W static inline ptr make_feature(const std::vector<cv::Point2f> &corners, char type)
     {
         if ((type >= 'A' && type <= 'Z') || (type >= '0' && type <= '9'))
-            return std::make_shared<Tag>(corners, type);
+            return make_frame_shared<Tag>(corners, type);
         else
             return nullptr;
     }
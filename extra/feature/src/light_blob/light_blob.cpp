@@ -9,6 +9,7 @@
  *
  */
 
+#include <opencv2/core/hal/intrin.hpp>
 #include <opencv2/imgproc.hpp>
 
 #include "rmvl/algorithm/math.hpp"
@@ -73,12 +74,88 @@ void LightBlob::calcAccurateInfo(float lw_ratio, const std::vector<cv::Point> &c
                 _bottom + cv::Point2f(half_w * cos_angle, half_w * sin_angle)};
 }
 
-std::shared_ptr<LightBlob> LightBlob::make_feature(const std::vector<cv::Point> &contour)
+/**
+ * @brief 基于矩的等效椭圆拟合
+ * @note 使用 SoA 向量化累加轮廓点集的一、二阶矩，由协方差主轴方向与特征值给出等效椭圆
+ *       （均匀圆环模型），输出与 `cv::fitEllipse` 同一角度约定的旋转矩形
+ *
+ * @param[in] contour 轮廓点列表
+ * @return 等效椭圆的旋转矩形
+ */
+static cv::RotatedRect fitEllipseByMoments(const std::vector<cv::Point> &contour)
+{
+    const std::size_t n = contour.size();
+    const cv::Point p0 = contour.front();
+    double sx{}, sy{}, sxx{}, syy{}, sxy{};
+    std::size_t i = 0;
+#if CV_SIMD
+    // 坐标相对首点累加以降低数值量级，分块内使用 float 向量，块间合并至 double 避免精度损失
+    const std::size_t step = cv::v_int32::nlanes;
+    constexpr std::size_t BLOCK = 128;
+    cv::v_int32 x0 = cv::vx_setall_s32(p0.x), y0 = cv::vx_setall_s32(p0.y);
+    while (i + step <= n)
+    {
+        std::size_t blk_end = std::min(n, i + BLOCK);
+        cv::v_float32 vsx = cv::vx_setzero_f32(), vsy = cv::vx_setzero_f32();
+        cv::v_float32 vsxx = cv::vx_setzero_f32(), vsyy = cv::vx_setzero_f32(), vsxy = cv::vx_setzero_f32();
+        for (; i + step <= blk_end; i += step)
+        {
+            cv::v_int32 px, py;
+            cv::v_load_deinterleave(&contour[i].x, px, py);
+            cv::v_float32 fx = cv::v_cvt_f32(px - x0);
+            cv::v_float32 fy = cv::v_cvt_f32(py - y0);
+            vsx += fx;
+            vsy += fy;
+            vsxx = cv::v_fma(fx, fx, vsxx);
+            vsyy = cv::v_fma(fy, fy, vsyy);
+            vsxy = cv::v_fma(fx, fy, vsxy);
+        }
+        sx += cv::v_reduce_sum(vsx), sy += cv::v_reduce_sum(vsy);
+        sxx += cv::v_reduce_sum(vsxx), syy += cv::v_reduce_sum(vsyy), sxy += cv::v_reduce_sum(vsxy);
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        double dx = contour[i].x - p0.x, dy = contour[i].y - p0.y;
+        sx += dx, sy += dy;
+        sxx += dx * dx, syy += dy * dy, sxy += dx * dy;
+    }
+    const double inv_n = 1.0 / static_cast<double>(n);
+    double mx = sx * inv_n, my = sy * inv_n;
+    double cxx = sxx * inv_n - mx * mx;
+    double cyy = syy * inv_n - my * my;
+    double cxy = sxy * inv_n - mx * my;
+    // 协方差特征值（λ1 >= λ2 >= 0）
+    double delta = std::sqrt((cxx - cyy) * (cxx - cyy) * 0.25 + cxy * cxy);
+    double l1 = (cxx + cyy) * 0.5 + delta;
+    double l2 = std::max((cxx + cyy) * 0.5 - delta, 0.0);
+    // λ1 对应的主轴方向，统一朝向图像下方
+    double evx{}, evy{};
+    if (std::abs(cxy) > 1e-9)
+        evx = cxy, evy = l1 - cxx;
+    else
+        cxx >= cyy ? evx = 1. : evy = 1.;
+    if (evy < 0 || (evy == 0 && evx < 0))
+        evx = -evx, evy = -evy;
+    // 与 cv::fitEllipse 同一约定，角度映射至 [0, 180)
+    float angle = static_cast<float>(rad2deg(std::atan2(-evx, evy)));
+    if (angle < 0)
+        angle += 180.f;
+    cv::Point2f center(static_cast<float>(p0.x + mx), static_cast<float>(p0.y + my));
+    // 均匀圆环模型下，轴长为标准差的 2√2 倍
+    cv::Size2f size(static_cast<float>(2 * std::sqrt(2 * l2)), static_cast<float>(2 * std::sqrt(2 * l1)));
+    return {center, size, angle};
+}
+
+/**
+ * @brief 几何参数筛选并构造灯条
+ *
+ * @param[in] contour 特征轮廓
+ * @param[in] rotated_rect 拟合出的旋转矩形
+ * @return 若筛选通过则返回 LightBlob 的共享指针，否则返回 nullptr
+ */
+static std::shared_ptr<LightBlob> buildLightBlob(const std::vector<cv::Point> &contour, cv::RotatedRect &rotated_rect)
 {
-    // init
-    if (contour.size() < 6)
-        return nullptr;
-    cv::RotatedRect rotated_rect = fitEllipse(contour);
     // 统一角度方向
     float angle = (rotated_rect.angle > 90 ? rotated_rect.angle - 180 : rotated_rect.angle);
     // 根据斜率排除误识别
@@ -108,7 +185,31 @@ std::shared_ptr<LightBlob> LightBlob::make_feature(const std::vector<cv::Point>
             return nullptr;
     }
     // 构造返回
-    return std::make_shared<LightBlob>(contour, rotated_rect, lw_ratio, angle);
+    return make_frame_shared<LightBlob>(contour, rotated_rect, lw_ratio, angle);
+}
+
+std::shared_ptr<LightBlob> LightBlob::make_feature(const std::vector<cv::Point> &contour)
+{
+    // init
+    if (contour.size() < 6)
+        return nullptr;
+    cv::RotatedRect rotated_rect = fitEllipse(contour);
+    return buildLightBlob(contour, rotated_rect);
+}
+
+std::vector<std::shared_ptr<LightBlob>> LightBlob::make_features(const std::vector<std::vector<cv::Point>> &contours)
+{
+    std::vector<ptr> blobs;
+    blobs.reserve(contours.size());
+    for (const auto &contour : contours)
+    {
+        if (contour.size() < 6)
+            continue;
+        cv::RotatedRect rotated_rect = fitEllipseByMoments(contour);
+        if (auto p_blob = buildLightBlob(contour, rotated_rect))
+            blobs.push_back(p_blob);
+    }
+    return blobs;
 }
 
 LightBlob::LightBlob(const std::vector<cv::Point> &contour, cv::RotatedRect &rotated_rect, float lw_ratio, float angle)
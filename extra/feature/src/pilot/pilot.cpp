@@ -85,7 +85,7 @@ Pilot::ptr Pilot::make_feature(const std::vector<cv::Point> &contour, cv::Mat &b
     else
         return nullptr;
 
-    return std::make_shared<Pilot>(contour, rotated_rect, width, height);
+    return make_frame_shared<Pilot>(contour, rotated_rect, width, height);
 }
 
 Pilot::Pilot(const std::vector<cv::Point> &contour, cv::RotatedRect &rotated_rect, float width, float height)
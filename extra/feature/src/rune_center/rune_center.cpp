@@ -71,7 +71,7 @@ std::shared_ptr<RuneCenter> RuneCenter::make_feature(const std::vector<cv::Point
     }
     DEBUG_PASS_("center 2.center_ratio : pass");
 
-    return std::make_shared<RuneCenter>(contour, rotated_rect);
+    return make_frame_shared<RuneCenter>(contour, rotated_rect);
 }
 
 } // namespace rm
@@ -70,12 +70,12 @@ std::shared_ptr<RuneTarget> RuneTarget::make_feature(const std::vector<cv::Point
     }
     DEBUG_PASS_("target 4.contour_area : pass");
 
-    return std::make_shared<RuneTarget>(contour, rotated_rect, is_active);
+    return make_frame_shared<RuneTarget>(contour, rotated_rect, is_active);
 }
 
 std::shared_ptr<RuneTarget> RuneTarget::make_feature(const cv::Point &center, bool is_active)
 {
-    return std::make_shared<RuneTarget>(center, is_active);
+    return make_frame_shared<RuneTarget>(center, is_active);
 }
 
 RuneTarget::RuneTarget(const cv::Point &center, bool is_active) : _is_active(is_active)
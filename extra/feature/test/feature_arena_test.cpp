@@ -0,0 +1,73 @@
+/**
+ * @file feature_arena_test.cpp
+ * @author RoboMaster Vision Community
+ * @brief
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), RoboMaster Vision Community
+ *
+ */
+
+#include "rmvl/rmvl_modules.hpp"
+
+#ifdef HAVE_RMVL_FEATURE
+
+#include <gtest/gtest.h>
+
+#include "rmvl/feature/feature.h"
+
+using namespace rm;
+
+namespace rm_test
+{
+
+TEST(FrameArenaTest, activate_deactivate)
+{
+    // 未激活时退化为默认堆分配
+    EXPECT_EQ(FrameArena::current(), nullptr);
+    feature::ptr f1 = DefaultFeature::make_feature({1.f, 2.f});
+    EXPECT_TRUE(f1 != nullptr);
+    // 激活后工厂接口在池内分配
+    FrameArena arena;
+    arena.activate();
+    EXPECT_NE(FrameArena::current(), nullptr);
+    feature::ptr f2 = DefaultFeature::make_feature({3.f, 4.f});
+    EXPECT_TRUE(f2 != nullptr);
+    EXPECT_EQ(f2->center(), cv::Point2f(3.f, 4.f));
+    // 取消激活后恢复默认堆分配
+    arena.deactivate();
+    EXPECT_EQ(FrameArena::current(), nullptr);
+}
+
+TEST(FrameArenaTest, per_frame_reuse)
+{
+    FrameArena arena;
+    arena.activate();
+    // 模拟多帧构造与析构，池内内存块应被循环复用
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        std::vector<feature::ptr> features;
+        for (int i = 0; i < 100; ++i)
+            features.push_back(DefaultFeature::make_feature({static_cast<float>(i), static_cast<float>(frame)}));
+        for (const auto &f : features)
+            EXPECT_TRUE(f != nullptr);
+    }
+    arena.deactivate();
+    // 池内对象均已析构，可批量归还内存
+    arena.release();
+}
+
+TEST(FrameArenaTest, escape_frame_scope)
+{
+    FrameArena arena;
+    arena.activate();
+    feature::ptr escaped = DefaultFeature::make_feature({5.f, 6.f});
+    arena.deactivate();
+    // 池生命周期内，逃逸出帧作用域的对象仍然有效
+    EXPECT_EQ(escaped->center(), cv::Point2f(5.f, 6.f));
+}
+
+} // namespace rm_test
+
+#endif // HAVE_RMVL_FEATURE
@@ -71,6 +71,28 @@ TEST(BuildLightBlobTest, fitEllipse_few_contourSize)
     EXPECT_FALSE(blob != nullptr);
 }
 
+TEST(BuildLightBlobTest, batch_make_features)
+{
+    // 一条竖直灯条与一条大倾角灯条，批量构造仅保留前者
+    cv::Mat src = cv::Mat::zeros(cv::Size(300, 150), CV_8UC1);
+    cv::line(src, cv::Point(75, 20), cv::Point(75, 130), cv::Scalar(255), 25);
+    cv::line(src, cv::Point(180, 30), cv::Point(270, 120), cv::Scalar(255), 25);
+    std::vector<std::vector<cv::Point>> contours;
+    cv::findContours(src, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE);
+    std::vector<LightBlob::ptr> blobs = LightBlob::make_features(contours);
+    EXPECT_EQ(blobs.size(), 1u);
+    // 与逐轮廓构造的几何信息一致
+    for (const auto &contour : contours)
+    {
+        LightBlob::ptr blob = LightBlob::make_feature(contour);
+        if (blob == nullptr)
+            continue;
+        EXPECT_NEAR(blob->center().x, blobs.front()->center().x, 2.f);
+        EXPECT_NEAR(blob->center().y, blobs.front()->center().y, 2.f);
+        EXPECT_NEAR(blob->angle(), blobs.front()->angle(), 3.f);
+    }
+}
+
 TEST(BuildLightBlobTest, fitEllipse_width_contourSize_judgeTable)
 {
     // 数据准备
@@ -11,6 +11,11 @@
 
 #pragma once
 
+#include <limits>
+#include <unordered_set>
+
+#include "rmvl/core/stats.hpp"
+#include "rmvl/core/timer.hpp"
 #include "rmvl/tracker/tracker.h"
 
 namespace rm
@@ -19,6 +24,44 @@ namespace rm
 //! @addtogroup group
 //! @{
 
+/**
+ * @brief 帧预算令牌
+ * @note
+ * - 用于识别管线的截止期调度：每帧识别开始时以帧起点时间装载预算，各阶段通过
+ *   `remaining()` 查询剩余预算并动态选择降级路径（跳过分类网络、截断灯条数量、
+ *   降采样同步等），使单帧最坏耗时有界而非尽力而为
+ * @note
+ * - 预算为 `0` 时截止期调度关闭，`remaining()` 恒为正无穷，各阶段均执行完整路径
+ * @warning 帧起点时间与剩余预算均基于 rm::Timer 时钟，`restart()` 传入的时间点
+ *          需由 `rm::Timer::now()` 获取
+ */
+class FrameBudget
+{
+public:
+    //! 设置每帧预算（毫秒），为 `0` 时关闭截止期调度
+    void setBudget(double budget_ms) { _budget = budget_ms / 1e3; }
+
+    /**
+     * @brief 在帧起点装载预算
+     *
+     * @param[in] tick 帧起点时间，需由 `rm::Timer::now()` 获取
+     */
+    void restart(double tick) { _deadline = _budget > 0. ? tick + _budget : 0.; }
+
+    //! 截止期调度是否启用
+    bool active() const { return _deadline > 0.; }
+
+    //! 获取剩余预算（毫秒），截止期调度未启用时为正无穷
+    double remaining() const { return active() ? (_deadline - Timer::now()) * 1e3 : std::numeric_limits<double>::infinity(); }
+
+    //! 预算是否耗尽
+    bool exhausted() const { return remaining() <= 0.; }
+
+private:
+    double _budget{};   //!< 每帧预算 /s
+    double _deadline{}; //!< 当前帧截止时间点 /s
+};
+
 //! 相关追踪器的空间集合（序列组）
 class RMVL_EXPORTS_W_ABS group
 {
@@ -36,10 +79,12 @@ public:
 
     /**
      * @brief 从另一个序列组进行构造
+     * @warning 写时复制模式下克隆体与原序列组共享各追踪器的历史组合体，参见 rm::tracker::clone
      *
+     * @param[in] policy 克隆策略，默认为深拷贝
      * @return 指向新序列组的共享指针
      */
-    RMVL_W virtual ptr clone() = 0;
+    RMVL_W virtual ptr clone(ClonePolicy policy = ClonePolicy::Deep) = 0;
 
     /**
      * @brief 序列组同步操作
@@ -120,6 +165,26 @@ public:
      * @return 序列组状态
      */
     StateInfo &state() { return _state; }
+
+protected:
+    /**
+     * @brief 创建作用域耗时探针，供派生类在 `sync` 入口处使用
+     * @note 统计通道按实例区分，统计未启动时返回空探针，仅付出一次原子读的开销
+     *
+     * @param[in] depth 当前队列深度，一般为追踪器数目
+     * @return 作用域耗时探针
+     */
+    stats::Probe probe(std::size_t depth = 0) const
+    {
+        if (!stats::active())
+            return {};
+        if (_stage_stats == nullptr)
+            _stage_stats = &stats::instanceChannel("group", this);
+        return {*_stage_stats, depth};
+    }
+
+private:
+    mutable stats::StageStats *_stage_stats{}; //!< 实例级统计通道
 };
 
 #define RMVL_GROUP_CAST(name)                                                                       \
@@ -139,9 +204,10 @@ public:
     /**
      * @brief 从另一个序列组进行构造
      *
+     * @param[in] policy 克隆策略，默认为深拷贝
      * @return 指向新序列组的共享指针
      */
-    RMVL_W group::ptr clone() override;
+    RMVL_W group::ptr clone(ClonePolicy policy = ClonePolicy::Deep) override;
 
     RMVL_GROUP_CAST(DefaultGroup)
 
@@ -154,6 +220,57 @@ public:
     RMVL_W void sync(const ImuData &imu, double tick) override;
 };
 
+/**
+ * @brief 并行执行所有序列组的同步操作
+ * @note
+ * - 序列组之间不共享状态，同步操作被分发至工作线程池，并在返回前完成全部任务（帧同步屏障）
+ * @note
+ * - 单个序列组抛出的异常会被捕获并记录，不会中断其余序列组的同步
+ *
+ * @param[in] groups 序列组容器
+ * @param[in] imu_data 最新 IMU 数据
+ * @param[in] tick 最新时间点
+ * @return 同步过程中发生异常的序列组集合，可供调用方移除
+ */
+std::unordered_set<group::const_ptr> parallelSync(const std::vector<group::ptr> &groups, const ImuData &imu_data, double tick);
+
+/**
+ * @brief 并行执行所有序列组的同步操作（截止期调度）
+ * @note
+ * - 剩余预算充足时与无预算版本完全一致，预算耗尽时降级为追踪器降采样：按帧交替同步
+ *   半数序列组，其余序列组顺延至下一帧，两帧内所有序列组均被同步一次
+ * @note
+ * - 降级判定仅在入口处进行一次，已分发的同步任务不会被中断
+ *
+ * @param[in] groups 序列组容器
+ * @param[in] imu_data 最新 IMU 数据
+ * @param[in] tick 最新时间点
+ * @param[in] budget 帧预算令牌，参见 rm::FrameBudget
+ * @return 同步过程中发生异常的序列组集合，可供调用方移除
+ */
+std::unordered_set<group::const_ptr> parallelSync(const std::vector<group::ptr> &groups, const ImuData &imu_data, double tick, const FrameBudget &budget);
+
+/**
+ * @brief 批量克隆推演：将整个场景的序列组克隆至若干目标时间点并同步
+ * @note
+ * - 用于"50/100/150 ms 后场景如何"之类的假设推演，全部 `序列组 × 时间点` 的克隆与同步任务
+ *   一次性分发至共享线程池，返回前完成全部任务，相比逐个 `clone()` + `sync()`
+ *   可摊销分发开销，克隆在工作线程内进行，分配亦被并行化
+ * @note
+ * - 默认采用写时复制策略，克隆体与原序列组共享各追踪器的历史组合体，推演不会影响原场景
+ * @note
+ * - 单个克隆体推演中抛出的异常会被捕获并记录，对应位置为空指针，不会中断其余推演
+ *
+ * @param[in] groups 序列组容器
+ * @param[in] imu_data 最新 IMU 数据
+ * @param[in] ticks 各推演目标时间点
+ * @param[in] policy 克隆策略，默认为写时复制
+ * @return 推演结果，`retval[k][i]` 为第 `i` 个序列组推演至 `ticks[k]` 的克隆体
+ */
+std::vector<std::vector<group::ptr>> speculativeRollout(const std::vector<group::ptr> &groups, const ImuData &imu_data,
+                                                        const std::vector<double> &ticks,
+                                                        ClonePolicy policy = ClonePolicy::CopyOnWrite);
+
 //! @} group
 
 } // namespace rm
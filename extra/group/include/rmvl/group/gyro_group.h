@@ -13,6 +13,7 @@
 
 #include <unordered_set>
 
+#include "rmvl/algorithm/datastruct.hpp"
 #include "rmvl/algorithm/kalman.hpp"
 #include "rmvl/group/group.h"
 
@@ -90,9 +91,10 @@ public:
     /**
      * @brief 从另一个序列组进行构造
      *
+     * @param[in] policy 克隆策略，默认为深拷贝
      * @return 指向新序列组的共享指针
      */
-    RMVL_W group::ptr clone() override;
+    RMVL_W group::ptr clone(ClonePolicy policy = ClonePolicy::Deep) override;
 
     //! 判断是否为无效序列组
     RMVL_W bool invalid() const override;
@@ -145,12 +147,7 @@ public:
      * @param[in] p_tracker 追踪器指针
      * @return 追踪器信状态
      */
-    inline TrackerState getTrackerState(tracker::ptr p_tracker)
-    {
-        if (_tracker_state.find(p_tracker) == _tracker_state.end())
-            RMVL_Error(RMVL_StsBadArg, "p_tracker in \"_tracker_state\" is not exist.");
-        return _tracker_state[p_tracker];
-    }
+    inline TrackerState getTrackerState(tracker::ptr p_tracker) { return _tracker_state.at(entityOf(p_tracker)); }
 
     //! 获取最新的车组旋转中心点
     RMVL_W inline cv::Vec3f getCenter3D() const { return _center3d; }
@@ -213,12 +210,27 @@ private:
     //! 更新group的旋转状态
     void updateRotStatus();
 
+    /**
+     * @brief 获取追踪器对应的实体编号，即其在 `_trackers` 中的下标
+     *
+     * @param[in] p_tracker 追踪器指针
+     * @return 实体编号
+     */
+    inline uint32_t entityOf(tracker::const_ptr p_tracker) const
+    {
+        for (std::size_t i = 0; i < _trackers.size(); ++i)
+            if (_trackers[i] == p_tracker)
+                return static_cast<uint32_t>(i);
+        RMVL_Error(RMVL_StsBadArg, "p_tracker in \"_tracker_state\" is not exist.");
+        return 0;
+    }
+
     double _tick{};      //!< 时间点
     ImuData _imu_data{}; //!< 当前 IMU 数据
     bool _is_tracked{};  //!< 是否为目标序列组
 
-    //! 追踪器状态哈希表 [追踪器 : 追踪器状态]
-    std::unordered_map<tracker::ptr, TrackerState> _tracker_state{};
+    //! 追踪器状态组件数组，实体编号为追踪器在 `_trackers` 中的下标
+    SparseSet<TrackerState> _tracker_state{};
 
     KF63f _center3d_filter{}; //!< 旋转中心点位置滤波器
 
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "rmvl/algorithm/math.hpp"
 #include "rmvl/group/group.h"
 
 namespace rm
@@ -32,9 +33,10 @@ public:
     /**
      * @brief 从另一个序列组进行构造
      *
+     * @param[in] policy 克隆策略，默认为深拷贝
      * @return 指向新序列组的共享指针
      */
-    RMVL_W group::ptr clone() override;
+    RMVL_W group::ptr clone(ClonePolicy policy = ClonePolicy::Deep) override;
 
     RMVL_GROUP_CAST(RuneGroup)
 
@@ -56,7 +58,8 @@ public:
     inline const std::deque<double> &getRawDatas() const { return _datas; }
 
 private:
-    std::deque<double> _datas; //!< 原始角度数据
+    std::deque<double> _datas;        //!< 原始角度数据
+    CircularAccumulator _angle_acc{}; //!< 各追踪器角度的增量式圆统计累加器，跨帧维护
 };
 
 //! @} rune_group
@@ -0,0 +1,76 @@
+/**
+ * @file perf_gyro_group.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 整车状态序列组基准测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <benchmark/benchmark.h>
+#include <opencv2/calib3d.hpp>
+
+#include "rmvl/core/timer.hpp"
+#include "rmvl/algorithm/transform.hpp"
+#include "rmvl/group/gyro_group.h"
+
+#include "rmvlpara/combo/armor.h"
+
+namespace rm_test
+{
+
+static const std::vector<cv::Point3f> world_points = {{-67, 27, -7},
+                                                      {-67, -27, 7},
+                                                      {67, -27, 7},
+                                                      {67, 27, -7}};
+static const cv::Matx33f camera_matrix = {1250, 0, 640,
+                                          0, 1250, 512,
+                                          0, 0, 1};
+
+//! 按平移向量与绕 Y 轴旋转角构建装甲板
+static rm::combo::ptr createArmor(cv::Vec3f tvec, float angle)
+{
+    auto rmat = rm::euler2Mat(angle, rm::EulerAxis::Y);
+    cv::Vec3f rvec;
+    cv::Rodrigues(rmat, rvec);
+    std::vector<cv::Point2f> image_points;
+    cv::projectPoints(world_points, rvec, tvec, camera_matrix, cv::Matx51f::zeros(), image_points);
+    auto p_left = rm::LightBlob::make_feature(image_points[1], image_points[0], 10);
+    auto p_right = rm::LightBlob::make_feature(image_points[2], image_points[3], 10);
+    return rm::Armor::make_combo(p_left, p_right, rm::ImuData(), rm::Timer::now(), rm::ArmorSizeType::SMALL);
+}
+
+// 由单块装甲板构建 4 装甲整车序列组
+static void gyro_group_make(benchmark::State &state)
+{
+    rm::para::armor_param.SMALL_ARMOR = world_points;
+    for (auto _ : state)
+    {
+        auto p_group = rm::GyroGroup::make_group({createArmor(cv::Vec3f(-50, -50, 1000), -20)}, 4);
+        benchmark::DoNotOptimize(p_group);
+    }
+}
+
+// 单装甲可见场景下的序列组同步
+static void gyro_group_sync(benchmark::State &state)
+{
+    rm::para::armor_param.SMALL_ARMOR = world_points;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto p_group = rm::GyroGroup::make_group({createArmor(cv::Vec3f(-50, -50, 1000), -20)}, 4);
+        // 为可见追踪器补充一帧，满足同步所需的最小序列长度
+        for (auto &p_tracker : p_group->data())
+            if (p_tracker->getVanishNumber() == 0)
+                p_tracker->update(createArmor(cv::Vec3f(-50, -50, 1000), -19.5f));
+        state.ResumeTiming();
+        p_group->sync(rm::ImuData(), rm::Timer::now());
+    }
+}
+
+BENCHMARK(gyro_group_make)->Name("gyro group make_group - by rmvl");
+BENCHMARK(gyro_group_sync)->Name("gyro group sync - by rmvl");
+
+} // namespace rm_test
@@ -14,12 +14,12 @@
 namespace rm
 {
 
-group::ptr DefaultGroup::clone()
+group::ptr DefaultGroup::clone(ClonePolicy policy)
 {
     auto retval = std::make_shared<DefaultGroup>(*this);
-    // 更新内部所有追踪器
+    // 按克隆策略更新内部所有追踪器
     for (auto &p_tracker : retval->_trackers)
-        p_tracker = p_tracker->clone();
+        p_tracker = p_tracker->clone(policy);
     return retval;
 }
 
@@ -9,6 +9,8 @@
  *
  */
 
+#include <array>
+
 #include <opencv2/calib3d.hpp>
 
 #include "rmvl/group/gyro_group.h"
@@ -24,6 +26,39 @@ namespace rm
 
 using namespace numeric_literals;
 
+namespace
+{
+
+//! 按装甲板数目缓存的整车几何先验
+struct GeometryPrior
+{
+    std::array<cv::Matx33f, 4> y_rotates; //!< 相邻各装甲板绕 y 轴的旋转矩阵（俯视图顺时针）
+};
+
+/**
+ * @brief 获取指定装甲板数目的整车几何先验
+ * @note 旋转矩阵只与装甲板数目有关，首次访问时一次性构建全部表项并缓存，
+ *       此后序列组构造退化为查表与状态填充，const 静态表可被并发安全地读取
+ *
+ * @param[in] armor_num 装甲板数目，仅允许 2、3、4
+ * @return 整车几何先验
+ */
+const GeometryPrior &geometryPrior(int armor_num)
+{
+    static const auto cache = [] {
+        std::array<GeometryPrior, 5> retval{};
+        for (int n = 2; n <= 4; ++n)
+            for (int i = 0; i < n - 1; ++i)
+                retval[n].y_rotates[i] = euler2Mat(static_cast<float>(2_PI / n) * (i + 1), EulerAxis::Y);
+        return retval;
+    }();
+    if (armor_num < 2 || armor_num > 4)
+        RMVL_Error_(RMVL_StsBadArg, "Bad number of armor plates: %d", armor_num);
+    return cache[armor_num];
+}
+
+} // namespace
+
 int GyroGroup::calcArmorNum(const std::vector<combo::ptr> &ref_combos)
 {
     // 机器人类型集合
@@ -134,11 +169,11 @@ void GyroGroup::getGroupInfo(const std::vector<combo::ptr> &visible_combos, std:
         group_center2d = cameraConvertToPixel(para::camera_param.cameraMatrix, para::camera_param.distCoeffs, cam_tvec);
 
         // 2、3、4 号追踪器
+        const auto &prior = geometryPrior(_armor_num);
         for (int i = 0; i < _armor_num - 1; i++)
         {
-            // 绕 y 轴旋转 90 * (i + 1) 度 (俯视图顺时针)
-            auto y_rotate = euler2Mat(static_cast<float>(2_PI / _armor_num) * (i + 1), EulerAxis::Y);
-            cv::Matx33f new_R = y_rotate * Rs.front(); // IMU 坐标系下的新旋转矩阵
+            // 绕 y 轴旋转 360 / _armor_num * (i + 1) 度 (俯视图顺时针)，旋转矩阵查先验表获取
+            cv::Matx33f new_R = prior.y_rotates[i] * Rs.front(); // IMU 坐标系下的新旋转矩阵
             // IMU 坐标系下的新装甲板到旋转中心点的方向向量
             cv::Vec3f new_pose = normalize(cv::Vec3f(new_R(0, 2), 0, new_R(2, 2)));
             cv::Vec3f new_gyro_tvec = center_tvec - new_pose * r; // IMU 坐标系下的新装甲板相机坐标系平移向量
@@ -61,7 +61,7 @@ void GyroGroup::initGroup(const std::unordered_set<combo::ptr> &visible_combo_se
         tracker_vec.push_back(GyroTracker::make_tracker(p_combo));
     _trackers = tracker_vec;
     for (int i = 0; i < _armor_num; i++)
-        _tracker_state[tracker_vec[i]] = state_vec[i];
+        _tracker_state.insert(static_cast<uint32_t>(i), state_vec[i]);
     // 旋转中心点坐标初始化
     _center3d = group_center3d;
     _center = group_center2d;
@@ -83,16 +83,13 @@ void GyroGroup::initFilter()
     _center3d_filter.init({_center3d(0), _center3d(1), _center3d(2), 0, 0, 0}, 1e5f);
 }
 
-group::ptr GyroGroup::clone()
+group::ptr GyroGroup::clone(ClonePolicy policy)
 {
     auto retval = std::make_shared<GyroGroup>(*this);
-    // 更新内部所有追踪器
+    // 按克隆策略更新内部所有追踪器
     for (auto &p_tracker : retval->_trackers)
-        p_tracker = p_tracker->clone();
-    // 更新追踪器状态哈希表
-    retval->_tracker_state.clear();
-    for (auto &p_tracker : retval->_trackers)
-        retval->_tracker_state[p_tracker] = _tracker_state[p_tracker];
+        p_tracker = p_tracker->clone(policy);
+    // 追踪器状态以 _trackers 下标为实体编号存储，拷贝构造已完成复制，无需按指针重建
     return retval;
 }
 
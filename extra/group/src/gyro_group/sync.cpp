@@ -23,6 +23,7 @@ using namespace rm::numeric_literals;
 
 void GyroGroup::sync(const ImuData &imu_data, double tick)
 {
+    auto stats_probe = probe(_trackers.size());
     // -----------------【前置错误与边界条件判断】-----------------
     if (static_cast<int>(_trackers.size()) != _armor_num)
         RMVL_Error_(RMVL_StsBadArg, "Bad size of the \"_trackers\", size = %zu", _trackers.size());
@@ -58,14 +59,14 @@ void GyroGroup::sync(const ImuData &imu_data, double tick)
         Rs[i] = visible_trackers[i]->extrinsic().R();
         Ps[i] = GyroTracker::cast(visible_trackers[i])->getPose();
         ts[i] = visible_trackers[i]->extrinsic().tvec();
-        rs[i] = _tracker_state[visible_trackers[i]].radius();
+        rs[i] = _tracker_state.at(entityOf(visible_trackers[i])).radius();
     }
     if (visible_num != 0)
     {
         calcGroupFrom3DMessage(Ps, ts, rs, _center3d);
         // 考虑 delta_y 修正 center3d
         if (visible_num == 1)
-            _center3d(1) -= _tracker_state[visible_trackers.front()].delta_y();
+            _center3d(1) -= _tracker_state.at(entityOf(visible_trackers.front())).delta_y();
     }
     // 获取旋转角速度与平均采样时间
     float rotation_speed{};
@@ -95,16 +96,22 @@ void GyroGroup::sync(const ImuData &imu_data, double tick)
     {
         // 掉帧处理，利用自身历史信息完成强制构造与更新操作
         float theta = _rotspeed * sample_time;
-        for (auto &[p_tracker, current_state] : _tracker_state)
+        // 绕 y 轴旋转，各追踪器共用，提出循环避免逐个重建旋转矩阵
+        auto rot = euler2Mat(theta, EulerAxis::Y);
+        // 组件数组连续存放，按实体编号顺序遍历
+        const auto &ents = _tracker_state.entities();
+        for (std::size_t i = 0; i < ents.size(); ++i)
         {
+            auto p_tracker = _trackers[ents[i]];
+            const auto &current_state = _tracker_state.components()[i];
             auto p_gyro_tracker = GyroTracker::cast(p_tracker);
-            // 绕 y 轴旋转
-            auto rot = euler2Mat(theta, EulerAxis::Y);
             // 旋转中心到组合体的线段向量
             cv::Vec2f tmp = -p_gyro_tracker->getPose() * current_state.radius();
             cv::Vec3f center2combo(tmp(0), 0, tmp(1));
-            cv::Matx33f new_rmat = rot * p_tracker->extrinsic().R();                                        // 新的旋转矩阵
-            cv::Vec3f new_tvec = _center3d + rot * center2combo + cv::Vec3f(0, current_state.delta_y(), 0); // 新的平移向量
+            // 复合 (R, center2combo) 与绕中心的旋转，得到新的旋转矩阵与平移向量
+            cv::Matx33f new_rmat;
+            cv::Vec3f new_tvec;
+            composeRT(p_tracker->extrinsic().R(), center2combo, rot, _center3d + cv::Vec3f(0, current_state.delta_y(), 0), new_rmat, new_tvec);
             auto p_armor = constructComboForced(p_tracker->front(), _imu_data, new_rmat, new_tvec, _tick);
             p_tracker->update(p_armor);
         }
@@ -113,20 +120,23 @@ void GyroGroup::sync(const ImuData &imu_data, double tick)
     else if (visible_num == 1)
     {
         tracker::ptr visible_tracker = visible_trackers.front();
-        auto &visible_state = _tracker_state[visible_tracker];
-        cv::Vec2f tmp = -GyroTracker::cast(visible_tracker)->getPose() * _tracker_state[visible_tracker].radius();
+        auto &visible_state = _tracker_state.at(entityOf(visible_tracker));
+        cv::Vec2f tmp = -GyroTracker::cast(visible_tracker)->getPose() * visible_state.radius();
         cv::Vec3f center2combo(tmp(0), 0, tmp(1));
         for (int i = 0; i < _armor_num - 1; ++i)
         {
-            // 寻找当前不可见追踪器的下标
-            auto p_tracker = _trackers[(visible_state.index() + i + 1) % _armor_num];
+            // 寻找当前不可见追踪器的实体编号，即 _trackers 下标
+            uint32_t ent = static_cast<uint32_t>((visible_state.index() + i + 1) % _armor_num);
+            auto p_tracker = _trackers[ent];
             if (p_tracker == visible_tracker)
                 RMVL_Error(RMVL_StsError, "The \"visible_tracker\" is equal to \"p_tracker\"");
-            auto &current_state = _tracker_state[p_tracker];
+            auto &current_state = _tracker_state.at(ent);
             // 绕 y 轴旋转
             auto rot = euler2Mat(static_cast<float>(2_PI / _armor_num * static_cast<double>((i + 1))), EulerAxis::Y);
-            cv::Matx33f new_rmat = rot * visible_tracker->extrinsic().R();                                  // 新的旋转矩阵
-            cv::Vec3f new_tvec = _center3d + rot * center2combo + cv::Vec3f(0, current_state.delta_y(), 0); // 新的平移向量
+            // 复合 (R, center2combo) 与绕中心的旋转，得到新的旋转矩阵与平移向量
+            cv::Matx33f new_rmat;
+            cv::Vec3f new_tvec;
+            composeRT(visible_tracker->extrinsic().R(), center2combo, rot, _center3d + cv::Vec3f(0, current_state.delta_y(), 0), new_rmat, new_tvec);
             auto p_armor = constructComboForced(visible_tracker->front(), _imu_data, new_rmat, new_tvec, _tick);
             p_tracker->update(p_armor);
         }
@@ -134,34 +144,37 @@ void GyroGroup::sync(const ImuData &imu_data, double tick)
     else // visible_num == 2
     {
         // 判断是否相邻，不相邻则抛出异常
-        size_t idx1 = _tracker_state[visible_trackers.front()].index();
-        size_t idx2 = _tracker_state[visible_trackers.back()].index();
+        size_t idx1 = _tracker_state.at(entityOf(visible_trackers.front())).index();
+        size_t idx2 = _tracker_state.at(entityOf(visible_trackers.back())).index();
         if ((idx1 + 1) % 4 != idx2 && (idx2 + 1) % 4 != idx1)
             RMVL_Error_(RMVL_StsError, "The indexes of the 2 visible trackers are not adjacent. It needs to "
                                        "satisfy the formula \"(idx1 + 1) % 4 == idx2\", but idx1 = %zu, idx2 = %zu.",
                         idx1, idx2);
         // 计算高度差：当前与 3D 中心点 y 轴高度差
         for (size_t i = 0; i < visible_num; ++i)
-            _tracker_state[visible_trackers[i]].delta_y(ts[i](1) - _center3d(1));
+            _tracker_state.at(entityOf(visible_trackers[i])).delta_y(ts[i](1) - _center3d(1));
         std::vector<cv::Vec3f> center2combo(visible_num);
         for (size_t i = 0; i < visible_num; ++i)
         {
             cv::Vec2f tmp = -GyroTracker::cast(visible_trackers[i])->getPose() *
-                            _tracker_state[visible_trackers[i]].radius();
+                            _tracker_state.at(entityOf(visible_trackers[i])).radius();
             center2combo[i] = cv::Vec3f(tmp(0), 0, tmp(1));
         }
         for (size_t i = 0; i < visible_num; ++i)
         {
-            auto p_tracker = _trackers[(_tracker_state[visible_trackers[i]].index() + 2) % 4];
-            auto &current_state = _tracker_state[p_tracker];
+            auto &visible_state = _tracker_state.at(entityOf(visible_trackers[i]));
+            uint32_t ent = static_cast<uint32_t>((visible_state.index() + 2) % 4);
+            auto p_tracker = _trackers[ent];
+            auto &current_state = _tracker_state.at(ent);
             // 绕 y 轴旋转
             auto rot = euler2Mat(static_cast<float>(PI), EulerAxis::Y);
-            // 平移向量的旋转增量
-            cv::Matx33f new_rmat = rot * visible_trackers[i]->extrinsic().R();                                 // 新旋转矩阵
-            cv::Vec3f new_tvec = _center3d + rot * center2combo[i] + cv::Vec3f(0, current_state.delta_y(), 0); // 新平移向量
+            // 复合 (R, center2combo) 与绕中心的旋转，得到新的旋转矩阵与平移向量
+            cv::Matx33f new_rmat;
+            cv::Vec3f new_tvec;
+            composeRT(visible_trackers[i]->extrinsic().R(), center2combo[i], rot, _center3d + cv::Vec3f(0, current_state.delta_y(), 0), new_rmat, new_tvec);
             auto p_armor = constructComboForced(visible_trackers[i]->front(), _imu_data, new_rmat, new_tvec, _tick);
             // 同步高度差
-            current_state.delta_y(_tracker_state[visible_trackers[i]].delta_y());
+            current_state.delta_y(visible_state.delta_y());
             p_tracker->update(p_armor);
         }
     }
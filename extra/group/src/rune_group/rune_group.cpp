@@ -19,6 +19,7 @@ namespace rm
 
 void RuneGroup::sync(const ImuData &, double)
 {
+    auto stats_probe = probe(_trackers.size());
     if (_trackers.empty())
         RMVL_Error(RMVL_StsBadSize, "trackers of the \"rune_group\" is empty!");
     double raw_data{};
@@ -27,23 +28,17 @@ void RuneGroup::sync(const ImuData &, double)
     else
     {
         size_t trackers_num = _trackers.size();
-        // ----------------- 角度连续化处理 -----------------
-        double last_data = _datas.front();
-        std::vector<double> cur_angles(trackers_num);
-        cur_angles[0] = _trackers[0]->angle();
-        // 角度向 cur_angles[0] 对齐
-        for (size_t i = 1; i < trackers_num; ++i)
-        {
-            double cur_angle = _trackers[i]->angle();
-            double n = round((cur_angle - cur_angles[0]) / para::rune_group_param.INTERVAL_ANGLE);
-            cur_angles[i] = cur_angle - n * para::rune_group_param.INTERVAL_ANGLE;
-        }
-        // 取平均得到 cur_data
-        double cur_data{};
-        for (auto cur_angle : cur_angles)
-            cur_data += cur_angle;
-        cur_data /= static_cast<double>(trackers_num);
+        // ------------- 增量维护各追踪器角度的圆统计 -------------
+        // 以扇叶间隔角度为周期的圆均值给出序列组角度，各扇叶角度的模 INTERVAL_ANGLE
+        // 等价性由单位向量的方向直接表达，无需逐个对齐
+        if (_angle_acc.size() != trackers_num)
+            _angle_acc = CircularAccumulator(trackers_num, para::rune_group_param.INTERVAL_ANGLE);
+        // 角度未变化的追踪器在累加器中为空操作，每帧开销为变化追踪器数目
+        for (size_t i = 0; i < trackers_num; ++i)
+            _angle_acc.update(i, _trackers[i]->angle());
+        double cur_data = _angle_acc.mean();
         // cur_data 向 last_data 对齐
+        double last_data = _datas.front();
         double n = round((cur_data - last_data) / para::rune_group_param.INTERVAL_ANGLE);
         raw_data = cur_data - n * para::rune_group_param.INTERVAL_ANGLE;
     }
@@ -52,12 +47,12 @@ void RuneGroup::sync(const ImuData &, double)
         _datas.pop_back();
 }
 
-group::ptr RuneGroup::clone()
+group::ptr RuneGroup::clone(ClonePolicy policy)
 {
     auto retval = std::make_shared<RuneGroup>(*this);
-    // 更新内部所有追踪器
+    // 按克隆策略更新内部所有追踪器
     for (auto &p_tracker : retval->_trackers)
-        p_tracker = p_tracker->clone();
+        p_tracker = p_tracker->clone(policy);
     return retval;
 }
 
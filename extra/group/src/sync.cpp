@@ -0,0 +1,133 @@
+/**
+ * @file sync.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 序列组并行同步
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <atomic>
+#include <mutex>
+
+#include "rmvl/core/lineage.hpp"
+#include "rmvl/core/thread_pool.hpp"
+#include "rmvl/core/util.hpp"
+#include "rmvl/group/group.h"
+
+namespace rm
+{
+
+std::unordered_set<group::const_ptr> parallelSync(const std::vector<group::ptr> &groups, const ImuData &imu_data, double tick)
+{
+    std::unordered_set<group::const_ptr> error_groups;
+    if (groups.empty())
+        return error_groups;
+    // 单个序列组时无需分发至线程池
+    if (groups.size() == 1)
+    {
+        try
+        {
+            groups.front()->sync(imu_data, tick);
+        }
+        catch (const rm::Exception &e)
+        {
+            ERROR_("Occurred an exception! %s", e.err.c_str());
+            error_groups.insert(groups.front());
+        }
+        lineage::mark(lineage::Stage::Sync);
+        return error_groups;
+    }
+    // 序列组间不共享状态，分发至共享线程池，parallel_for 返回时全部同步完成（帧同步屏障）
+    std::mutex mtx;
+    ThreadPool::global().parallel_for(0, groups.size(), [&](std::size_t start, std::size_t end) {
+        for (std::size_t i = start; i < end; ++i)
+        {
+            try
+            {
+                groups[i]->sync(imu_data, tick);
+            }
+            catch (const rm::Exception &e)
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                ERROR_("Occurred an exception! %s", e.err.c_str());
+                error_groups.insert(groups[i]);
+            }
+        }
+    });
+    lineage::mark(lineage::Stage::Sync);
+    return error_groups;
+}
+
+std::unordered_set<group::const_ptr> parallelSync(const std::vector<group::ptr> &groups, const ImuData &imu_data, double tick, const FrameBudget &budget)
+{
+    // 剩余预算充足时执行完整的并行同步
+    if (!budget.active() || !budget.exhausted())
+        return parallelSync(groups, imu_data, tick);
+    // 预算耗尽：追踪器降采样，按帧交替同步半数序列组，其余顺延至下一帧
+    static std::atomic_size_t phase{};
+    std::size_t parity = phase.fetch_add(1) & 1;
+    std::unordered_set<group::const_ptr> error_groups;
+    for (std::size_t i = 0; i < groups.size(); ++i)
+    {
+        // 仅剩单个序列组时不再降采样，避免该序列组永不同步
+        if (groups.size() > 1 && (i & 1) != parity)
+            continue;
+        try
+        {
+            groups[i]->sync(imu_data, tick);
+        }
+        catch (const rm::Exception &e)
+        {
+            ERROR_("Occurred an exception! %s", e.err.c_str());
+            error_groups.insert(groups[i]);
+        }
+    }
+    lineage::mark(lineage::Stage::Sync);
+    return error_groups;
+}
+
+std::vector<std::vector<group::ptr>> speculativeRollout(const std::vector<group::ptr> &groups, const ImuData &imu_data,
+                                                        const std::vector<double> &ticks, ClonePolicy policy)
+{
+    const std::size_t n = groups.size(), k = ticks.size();
+    // 结果存储整体预留，工作线程仅写入各自下标，无需同步
+    std::vector<std::vector<group::ptr>> retval(k);
+    for (auto &snapshot : retval)
+        snapshot.resize(n);
+    if (n == 0 || k == 0)
+        return retval;
+    std::mutex mtx;
+    auto rollout = [&](std::size_t idx) {
+        const auto &p_group = groups[idx % n];
+        double tick = ticks[idx / n];
+        try
+        {
+            auto p_clone = p_group->clone(policy);
+            p_clone->sync(imu_data, tick);
+            retval[idx / n][idx % n] = std::move(p_clone);
+        }
+        catch (const rm::Exception &e)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            ERROR_("Occurred an exception! %s", e.err.c_str());
+        }
+    };
+    // 单个 `序列组 × 时间点` 任务时无需分发至线程池
+    if (n * k == 1)
+    {
+        rollout(0);
+        return retval;
+    }
+    // 全部克隆与同步任务展平后一次性分发至共享线程池，克隆在工作线程内完成，
+    // parallel_for 返回时全部推演完成（帧同步屏障）
+    ThreadPool::global().parallel_for(0, n * k, [&](std::size_t start, std::size_t end) {
+        for (std::size_t i = start; i < end; ++i)
+            rollout(i);
+    });
+    return retval;
+}
+
+} // namespace rm
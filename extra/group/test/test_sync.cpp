@@ -0,0 +1,168 @@
+/**
+ * @file test_sync.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 序列组并行同步单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include "rmvl/rmvl_modules.hpp"
+
+#ifdef HAVE_RMVL_GROUP
+
+#include <atomic>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/util.hpp"
+#include "rmvl/group/group.h"
+
+using namespace rm;
+
+namespace rm_test
+{
+
+//! 记录同步次数的序列组
+class CountGroup final : public group
+{
+public:
+    std::atomic_int sync_count{};
+    bool throw_on_sync{};
+
+    group::ptr clone(ClonePolicy = ClonePolicy::Deep) override { return nullptr; }
+    void sync(const ImuData &, double) override
+    {
+        if (throw_on_sync)
+            RMVL_Error(RMVL_StsError, "sync failed");
+        ++sync_count;
+    }
+};
+
+TEST(ParallelSyncTest, all_groups_synced_once)
+{
+    std::vector<group::ptr> groups;
+    for (int i = 0; i < 7; ++i)
+        groups.push_back(std::make_shared<CountGroup>());
+    auto error_groups = parallelSync(groups, {}, 0.);
+    EXPECT_TRUE(error_groups.empty());
+    for (const auto &p_group : groups)
+        EXPECT_EQ(std::dynamic_pointer_cast<CountGroup>(p_group)->sync_count, 1);
+}
+
+TEST(ParallelSyncTest, exception_collected_without_interrupt)
+{
+    std::vector<group::ptr> groups;
+    for (int i = 0; i < 4; ++i)
+        groups.push_back(std::make_shared<CountGroup>());
+    std::dynamic_pointer_cast<CountGroup>(groups[1])->throw_on_sync = true;
+    auto error_groups = parallelSync(groups, {}, 0.);
+    // 仅异常的序列组被记录，其余序列组正常完成同步
+    EXPECT_EQ(error_groups.size(), 1u);
+    EXPECT_TRUE(error_groups.find(groups[1]) != error_groups.end());
+    for (std::size_t i = 0; i < groups.size(); ++i)
+        if (i != 1)
+            EXPECT_EQ(std::dynamic_pointer_cast<CountGroup>(groups[i])->sync_count, 1);
+}
+
+TEST(ParallelSyncTest, inactive_budget_full_sync)
+{
+    // 未启用截止期调度时与无预算版本行为一致
+    FrameBudget budget;
+    EXPECT_FALSE(budget.active());
+    EXPECT_FALSE(budget.exhausted());
+    std::vector<group::ptr> groups;
+    for (int i = 0; i < 5; ++i)
+        groups.push_back(std::make_shared<CountGroup>());
+    auto error_groups = parallelSync(groups, {}, 0., budget);
+    EXPECT_TRUE(error_groups.empty());
+    for (const auto &p_group : groups)
+        EXPECT_EQ(std::dynamic_pointer_cast<CountGroup>(p_group)->sync_count, 1);
+}
+
+TEST(ParallelSyncTest, exhausted_budget_decimation)
+{
+    // 以过期的帧起点装载预算，预算必然耗尽
+    FrameBudget budget;
+    budget.setBudget(1.);
+    budget.restart(Timer::now() - 1.);
+    EXPECT_TRUE(budget.active());
+    EXPECT_TRUE(budget.exhausted());
+    std::vector<group::ptr> groups;
+    for (int i = 0; i < 6; ++i)
+        groups.push_back(std::make_shared<CountGroup>());
+    // 单帧仅同步半数序列组，两帧内所有序列组均被同步一次
+    EXPECT_TRUE(parallelSync(groups, {}, 0., budget).empty());
+    int total{};
+    for (const auto &p_group : groups)
+        total += std::dynamic_pointer_cast<CountGroup>(p_group)->sync_count;
+    EXPECT_EQ(total, 3);
+    EXPECT_TRUE(parallelSync(groups, {}, 0., budget).empty());
+    for (const auto &p_group : groups)
+        EXPECT_EQ(std::dynamic_pointer_cast<CountGroup>(p_group)->sync_count, 1);
+}
+
+//! 支持克隆推演的序列组
+class RolloutGroup final : public group
+{
+public:
+    int id{};                //!< 序列组编号
+    double synced_tick{-1.}; //!< 最近一次同步的时间点
+    bool throw_on_sync{};
+
+    group::ptr clone(ClonePolicy = ClonePolicy::Deep) override { return std::make_shared<RolloutGroup>(*this); }
+    void sync(const ImuData &, double tick) override
+    {
+        if (throw_on_sync)
+            RMVL_Error(RMVL_StsError, "rollout failed");
+        synced_tick = tick;
+    }
+};
+
+TEST(SpeculativeRolloutTest, clones_advanced_to_each_tick)
+{
+    std::vector<group::ptr> groups;
+    for (int i = 0; i < 5; ++i)
+    {
+        auto p_group = std::make_shared<RolloutGroup>();
+        p_group->id = i;
+        groups.push_back(p_group);
+    }
+    std::vector<double> ticks = {0.05, 0.1, 0.15};
+    auto retval = speculativeRollout(groups, {}, ticks);
+    ASSERT_EQ(retval.size(), ticks.size());
+    for (std::size_t k = 0; k < ticks.size(); ++k)
+    {
+        ASSERT_EQ(retval[k].size(), groups.size());
+        for (std::size_t i = 0; i < groups.size(); ++i)
+        {
+            auto p_clone = std::dynamic_pointer_cast<RolloutGroup>(retval[k][i]);
+            ASSERT_NE(p_clone, nullptr);
+            EXPECT_EQ(p_clone->id, static_cast<int>(i));
+            EXPECT_DOUBLE_EQ(p_clone->synced_tick, ticks[k]);
+        }
+    }
+    // 原序列组不受推演影响
+    for (const auto &p_group : groups)
+        EXPECT_DOUBLE_EQ(std::dynamic_pointer_cast<RolloutGroup>(p_group)->synced_tick, -1.);
+}
+
+TEST(SpeculativeRolloutTest, failed_rollout_is_null)
+{
+    std::vector<group::ptr> groups;
+    for (int i = 0; i < 3; ++i)
+        groups.push_back(std::make_shared<RolloutGroup>());
+    std::dynamic_pointer_cast<RolloutGroup>(groups[1])->throw_on_sync = true;
+    auto retval = speculativeRollout(groups, {}, {0.1});
+    ASSERT_EQ(retval.size(), 1u);
+    // 异常的克隆体为空指针，其余推演正常完成
+    EXPECT_NE(retval[0][0], nullptr);
+    EXPECT_EQ(retval[0][1], nullptr);
+    EXPECT_NE(retval[0][2], nullptr);
+}
+
+} // namespace rm_test
+
+#endif // HAVE_RMVL_GROUP
@@ -0,0 +1,177 @@
+/**
+ * @file pipeline.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 静态组合流水线
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+
+#include "rmvl/core/lineage.hpp"
+#include "rmvl/core/statspage.hpp"
+#include "rmvl/core/timer.hpp"
+#include "rmvl/decider/decider.h"
+
+namespace rm
+{
+
+//! @defgroup pipeline 静态组合流水线（功能模块）
+
+//! @addtogroup pipeline
+//! @{
+
+/**
+ * @brief 静态组合流水线
+ * @brief
+ * - 在编译期绑定识别、补偿、预测、决策各阶段的具体类型，各阶段以值语义集中存放于
+ *   同一对象内并就地构造。经由抽象基类指针的调用在各阶段边界上均为虚表分派，且无法
+ *   被内联，而机器人的流水线构成在构建期即已固定，静态组合后成员调用的静态类型即为
+ *   具体阶段类型，编译器可直接绑定并内联各阶段入口
+ * @brief
+ * - 序列组容器、历史目标与各阶段信息结构体由流水线持有并跨帧复用，识别阶段使用
+ *   写入式接口复用 rm::DetectInfo 的既有容量，逐帧处理不产生信息结构体的重新分配
+ *
+ * @code{.cpp}
+ * rm::StaticPipeline<rm::ArmorDetector, rm::GravityCompensator,
+ *                    rm::ArmorPredictor, rm::TranslationDecider>
+ *     pipeline(std::forward_as_tuple("number.onnx"));
+ * while (auto src = capture())
+ * {
+ *     const auto &info = pipeline.process(src, rm::BLUE, imu_data, rm::Timer::now(), shoot_speed);
+ *     if (info.can_shoot)
+ *         shoot(info.exp_angle);
+ * }
+ * @endcode
+ *
+ * @tparam DetectorT 识别阶段的具体类型，需继承自 rm::detector
+ * @tparam CompensatorT 补偿阶段的具体类型，需继承自 rm::compensator
+ * @tparam PredictorT 预测阶段的具体类型，需继承自 rm::predictor
+ * @tparam DeciderT 决策阶段的具体类型，需继承自 rm::decider
+ */
+template <typename DetectorT, typename CompensatorT, typename PredictorT, typename DeciderT>
+class StaticPipeline final
+{
+    static_assert(std::is_base_of_v<rm::detector, DetectorT>, "\"DetectorT\" must be derived from rm::detector");
+    static_assert(std::is_base_of_v<rm::compensator, CompensatorT>, "\"CompensatorT\" must be derived from rm::compensator");
+    static_assert(std::is_base_of_v<rm::predictor, PredictorT>, "\"PredictorT\" must be derived from rm::predictor");
+    static_assert(std::is_base_of_v<rm::decider, DeciderT>, "\"DeciderT\" must be derived from rm::decider");
+
+public:
+    //! 以各阶段的默认构造函数创建静态组合流水线
+    StaticPipeline() = default;
+
+    /**
+     * @brief 创建静态组合流水线，各阶段在流水线对象内就地构造
+     * @note 各阶段的构造参数以 `std::forward_as_tuple` 包装传入，如
+     *       `StaticPipeline<...> pipeline(std::forward_as_tuple("number.onnx"));`
+     *
+     * @param[in] detector_args 识别阶段的构造参数元组
+     * @param[in] compensator_args 补偿阶段的构造参数元组
+     * @param[in] predictor_args 预测阶段的构造参数元组
+     * @param[in] decider_args 决策阶段的构造参数元组
+     */
+    template <typename DArgs, typename CArgs = std::tuple<>, typename PArgs = std::tuple<>, typename GArgs = std::tuple<>>
+    explicit StaticPipeline(DArgs &&detector_args, CArgs &&compensator_args = {}, PArgs &&predictor_args = {}, GArgs &&decider_args = {})
+        : _detector(std::make_from_tuple<DetectorT>(std::forward<DArgs>(detector_args))),
+          _compensator(std::make_from_tuple<CompensatorT>(std::forward<CArgs>(compensator_args))),
+          _predictor(std::make_from_tuple<PredictorT>(std::forward<PArgs>(predictor_args))),
+          _decider(std::make_from_tuple<DeciderT>(std::forward<GArgs>(decider_args))) {}
+
+    //! @cond
+    StaticPipeline(const StaticPipeline &) = delete;
+    StaticPipeline(StaticPipeline &&) = delete;
+    StaticPipeline &operator=(const StaticPipeline &) = delete;
+    StaticPipeline &operator=(StaticPipeline &&) = delete;
+    //! @endcond
+
+    /**
+     * @brief 处理一帧数据，依次执行识别、补偿、预测、决策阶段
+     *
+     * @param[in] src 原图像
+     * @param[in] color 待识别的颜色
+     * @param[in] imu_data IMU 数据
+     * @param[in] tick 当前时间点
+     * @param[in] shoot_speed 子弹射速（单位：m/s）
+     * @param[in] flag 决策状态模式
+     * @param[in] com_flag 补偿类型，默认为 `CompensateType::UNKNOWN`，即自动判断
+     * @return 决策模块信息，引用在下一次 `process` 调用前有效
+     */
+    const DecideInfo &process(const cv::Mat &src, uint8_t color, const ImuData &imu_data, double tick,
+                              float shoot_speed, const StateInfo &flag = {}, CompensateType com_flag = CompensateType::UNKNOWN)
+    {
+        // 相机层未铸造帧 ID 时（如从文件或测试数据取帧），由流水线补充开启帧血缘跟踪
+        if (lineage::current() == 0)
+            lineage::begin();
+        // 各阶段耗时写入共享内存统计页，供外部监控进程零开销读取
+        double t0 = Timer::now();
+        // 成员调用的静态类型即为具体阶段类型，各阶段入口在编译期绑定并可被内联
+        _detector.detect(_groups, src, color, imu_data, tick, _detect_info);
+        lineage::mark(lineage::Stage::Detect);
+        double t1 = Timer::now();
+        stats::pageSet(stats::PageField::DETECT_TIME, static_cast<uint64_t>((t1 - t0) * 1e6));
+        _compensate_info = _compensator.compensate(_groups, shoot_speed, com_flag);
+        double t2 = Timer::now();
+        stats::pageSet(stats::PageField::COMPENSATE_TIME, static_cast<uint64_t>((t2 - t1) * 1e6));
+        _predict_info = _predictor.predict(_groups, _compensate_info.tof);
+        _predict_info.frame_id = lineage::current();
+        lineage::mark(lineage::Stage::Predict);
+        double t3 = Timer::now();
+        stats::pageSet(stats::PageField::PREDICT_TIME, static_cast<uint64_t>((t3 - t2) * 1e6));
+        _decide_info = _decider.decide(_groups, flag, _last_target, _detect_info, _compensate_info, _predict_info);
+        lineage::mark(lineage::Stage::Decide);
+        double t4 = Timer::now();
+        stats::pageSet(stats::PageField::DECIDE_TIME, static_cast<uint64_t>((t4 - t3) * 1e6));
+        stats::pageSet(stats::PageField::FRAME_TIME, static_cast<uint64_t>((t4 - t0) * 1e6));
+        _last_target = _decide_info.target;
+        lineage::publish();
+        return _decide_info;
+    }
+
+    //! 清空序列组与历史目标，重置流水线状态
+    void reset()
+    {
+        _groups.clear();
+        _last_target = nullptr;
+    }
+
+    //! 获取识别阶段
+    DetectorT &detector() noexcept { return _detector; }
+    //! 获取补偿阶段
+    CompensatorT &compensator() noexcept { return _compensator; }
+    //! 获取预测阶段
+    PredictorT &predictor() noexcept { return _predictor; }
+    //! 获取决策阶段
+    DeciderT &decider() noexcept { return _decider; }
+    //! 获取序列组容器
+    const std::vector<group::ptr> &groups() const noexcept { return _groups; }
+    //! 获取上一帧的识别模块信息
+    const DetectInfo &detectInfo() const noexcept { return _detect_info; }
+    //! 获取上一帧的补偿模块信息
+    const CompensateInfo &compensateInfo() const noexcept { return _compensate_info; }
+    //! 获取上一帧的预测模块信息
+    const PredictInfo &predictInfo() const noexcept { return _predict_info; }
+
+private:
+    // 各阶段状态集中存放于流水线对象内，逐帧访问具有良好的空间局部性
+    DetectorT _detector{};             //!< 识别阶段
+    CompensatorT _compensator{};       //!< 补偿阶段
+    PredictorT _predictor{};           //!< 预测阶段
+    DeciderT _decider{};               //!< 决策阶段
+    std::vector<group::ptr> _groups;   //!< 序列组容器
+    tracker::ptr _last_target{};       //!< 历史目标追踪器
+    DetectInfo _detect_info{};         //!< 识别模块信息
+    CompensateInfo _compensate_info{}; //!< 补偿模块信息
+    PredictInfo _predict_info{};       //!< 预测模块信息
+    DecideInfo _decide_info{};         //!< 决策模块信息
+};
+
+//! @} pipeline
+
+} // namespace rm
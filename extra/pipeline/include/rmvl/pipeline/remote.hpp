@@ -0,0 +1,203 @@
+/**
+ * @file remote.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 流水线跨主机划分：阶段边界数据集编解码
+ * @version 1.0
+ * @date 2025-08-29
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <cstring>
+
+#include "rmvl/detector/detector.h"
+
+namespace rm
+{
+
+//! @addtogroup pipeline
+//! @{
+
+//! 阶段边界数据集类别
+enum class StageKind : uint16_t
+{
+    Frame = 1,    //!< 帧数据集：原图与采集时刻的 IMU 数据，在采集与识别之间划分
+    Features = 2, //!< 特征数据集：各组合体角点与采集时刻的 IMU 数据，在识别与追踪、预测之间划分
+};
+
+/**
+ * @brief 阶段边界数据集
+ * @note 由 @ref decodeStageBoundary 在计算主机上重组得到，`kind` 指明有效载荷为
+ *       `frame` 还是 `corners`
+ */
+struct StageBoundary
+{
+    StageKind kind{};   //!< 数据集类别
+    uint32_t seq{};     //!< 帧序列号，单调递增，用于推算链路上丢失的帧
+    double tick{};      //!< 采集时间点
+    ImuData imu{};      //!< 采集时刻的 IMU 数据
+    cv::Mat frame;      //!< 原图，`kind == StageKind::Frame` 时有效
+    std::vector<std::vector<cv::Point2f>> corners; //!< 各组合体角点，`kind == StageKind::Features` 时有效
+};
+
+//! @cond
+namespace helper
+{
+
+//! 阶段边界数据集头部
+struct StageHeader
+{
+    uint16_t magic;    //!< 魔数
+    uint16_t version;  //!< 格式版本号
+    uint16_t kind;     //!< 数据集类别
+    uint16_t reserved; //!< 保留位
+    uint32_t seq;      //!< 帧序列号
+    double tick;       //!< 采集时间点
+    ImuData imu;       //!< 采集时刻的 IMU 数据
+};
+
+//! 阶段边界数据集魔数 `"SB"`
+constexpr uint16_t STAGE_MAGIC = 0x4253;
+//! 阶段边界数据集格式版本号
+constexpr uint16_t STAGE_VERSION = 1;
+
+//! 向缓冲区追加平凡可拷贝对象
+template <typename Tp>
+inline void stagePut(std::string &buf, const Tp &val) { buf.append(reinterpret_cast<const char *>(&val), sizeof(Tp)); }
+
+//! 从缓冲区读出平凡可拷贝对象并推进偏移，越界时返回 `false`
+template <typename Tp>
+inline bool stageGet(std::string_view data, std::size_t &pos, Tp &val)
+{
+    if (pos + sizeof(Tp) > data.size())
+        return false;
+    std::memcpy(&val, data.data() + pos, sizeof(Tp));
+    pos += sizeof(Tp);
+    return true;
+}
+
+inline void stagePutHeader(std::string &buf, StageKind kind, uint32_t seq, double tick, const ImuData &imu)
+{
+    stagePut(buf, StageHeader{STAGE_MAGIC, STAGE_VERSION, static_cast<uint16_t>(kind), 0, seq, tick, imu});
+}
+
+} // namespace helper
+
+//! @endcond
+
+/**
+ * @brief 将一帧原图编码为帧数据集，追加至缓冲区
+ * @note 缓冲区可直接经 rm::TcpServer 等消息链路发送，编码不含压缩，单帧编码开销为
+ *       一次图像内存拷贝
+ *
+ * @param[out] buf 编码缓冲区，追加前被清空
+ * @param[in] seq 帧序列号
+ * @param[in] tick 采集时间点
+ * @param[in] imu 采集时刻的 IMU 数据
+ * @param[in] frame 原图
+ */
+inline void encodeStageBoundary(std::string &buf, uint32_t seq, double tick, const ImuData &imu, const cv::Mat &frame)
+{
+    buf.clear();
+    helper::stagePutHeader(buf, StageKind::Frame, seq, tick, imu);
+    helper::stagePut(buf, static_cast<int32_t>(frame.rows));
+    helper::stagePut(buf, static_cast<int32_t>(frame.cols));
+    helper::stagePut(buf, static_cast<int32_t>(frame.type()));
+    cv::Mat continuous = frame.isContinuous() ? frame : frame.clone();
+    buf.append(reinterpret_cast<const char *>(continuous.data), continuous.total() * continuous.elemSize());
+}
+
+/**
+ * @brief 将一帧识别结果编码为特征数据集，追加至缓冲区
+ * @note 仅编码各组合体的角点，数据量与组合体数目成正比而与图像尺寸无关，适合在带宽
+ *       受限的链路上划分识别与追踪、预测阶段
+ *
+ * @param[out] buf 编码缓冲区，追加前被清空
+ * @param[in] seq 帧序列号
+ * @param[in] tick 采集时间点
+ * @param[in] imu 采集时刻的 IMU 数据
+ * @param[in] info 识别模块信息
+ */
+inline void encodeStageBoundary(std::string &buf, uint32_t seq, double tick, const ImuData &imu, const DetectInfo &info)
+{
+    buf.clear();
+    helper::stagePutHeader(buf, StageKind::Features, seq, tick, imu);
+    helper::stagePut(buf, static_cast<uint32_t>(info.combos.size()));
+    for (const auto &p_combo : info.combos)
+    {
+        const auto &corners = p_combo->corners();
+        helper::stagePut(buf, static_cast<uint32_t>(corners.size()));
+        buf.append(reinterpret_cast<const char *>(corners.data()), corners.size() * sizeof(cv::Point2f));
+    }
+}
+
+/**
+ * @brief 在对端重组阶段边界数据集
+ * @code{.cpp}
+ * // 采集主机
+ * rm::TcpServer link(9800);
+ * std::string buf;
+ * for (uint32_t seq = 0; auto frame = capture(); ++seq)
+ *     rm::encodeStageBoundary(buf, seq, rm::Timer::now(), imu(), frame),
+ *         link.write(buf);
+ * // 计算主机
+ * rm::TcpClient link("192.168.1.10", 9800);
+ * std::string buf;
+ * rm::StageBoundary boundary;
+ * while (link.read(buf) && rm::decodeStageBoundary(buf, boundary))
+ *     pipeline.process(boundary.frame, rm::BLUE, boundary.imu, boundary.tick, shoot_speed);
+ * @endcode
+ *
+ * @param[in] data 接收到的数据集
+ * @param[out] boundary 阶段边界数据集
+ * @return 是否重组成功，魔数、版本号不匹配或数据不完整时返回 `false`
+ */
+inline bool decodeStageBoundary(std::string_view data, StageBoundary &boundary)
+{
+    std::size_t pos{};
+    helper::StageHeader header{};
+    if (!helper::stageGet(data, pos, header) || header.magic != helper::STAGE_MAGIC || header.version != helper::STAGE_VERSION)
+        return false;
+    boundary.kind = static_cast<StageKind>(header.kind);
+    boundary.seq = header.seq;
+    boundary.tick = header.tick;
+    boundary.imu = header.imu;
+    boundary.corners.clear();
+    if (boundary.kind == StageKind::Frame)
+    {
+        int32_t rows{}, cols{}, type{};
+        if (!helper::stageGet(data, pos, rows) || !helper::stageGet(data, pos, cols) || !helper::stageGet(data, pos, type))
+            return false;
+        boundary.frame.create(rows, cols, type);
+        std::size_t bytes = boundary.frame.total() * boundary.frame.elemSize();
+        if (pos + bytes != data.size())
+            return false;
+        std::memcpy(boundary.frame.data, data.data() + pos, bytes);
+        return true;
+    }
+    if (boundary.kind == StageKind::Features)
+    {
+        uint32_t combo_count{};
+        if (!helper::stageGet(data, pos, combo_count))
+            return false;
+        boundary.corners.reserve(combo_count);
+        for (uint32_t i = 0; i < combo_count; ++i)
+        {
+            uint32_t point_count{};
+            if (!helper::stageGet(data, pos, point_count) || pos + point_count * sizeof(cv::Point2f) > data.size())
+                return false;
+            auto p = reinterpret_cast<const cv::Point2f *>(data.data() + pos);
+            boundary.corners.emplace_back(p, p + point_count);
+            pos += point_count * sizeof(cv::Point2f);
+        }
+        return pos == data.size();
+    }
+    return false;
+}
+
+//! @} pipeline
+
+} // namespace rm
@@ -19,6 +19,20 @@ namespace rm
 //! @addtogroup gyro_predictor
 //! @{
 
+/**
+ * @brief 批量推演信息
+ * @note
+ * - 按 SoA 方式存储整车状态在一组候选击发延迟下的预测增量，同一预测对象在所有
+ *   延迟下的取值连续存放，便于决策模块在单次扫描中挑选最优击发时机
+ */
+struct RolloutInfo
+{
+    std::vector<double> x;     //!< 各候选延迟下的 `POS_X` 预测增量（动态、静态响应之和）
+    std::vector<double> y;     //!< 各候选延迟下的 `POS_Y` 预测增量（动态、静态响应之和）
+    std::vector<double> z;     //!< 各候选延迟下的 `POS_Z` 预测增量（动态、静态响应之和）
+    std::vector<double> angle; //!< 各候选延迟下的 `ANG_Y` 预测增量（含射击延迟预测量）
+};
+
 //! 整车状态预测模块
 class GyroPredictor final : public predictor
 {
@@ -43,6 +57,21 @@ public:
      */
     PredictInfo predict(const std::vector<group::ptr> &groups,
                         const std::unordered_map<tracker::ptr, double> &tof) override;
+
+    /**
+     * @brief 单序列组多假设批量推演
+     * @note
+     * - 将同一序列组的整车状态沿候选击发延迟时间网格批量传播，一次扫描生成所有候选延迟下的
+     *   预测增量，避免决策模块为每个候选延迟单独调用一次 `predict`
+     * @note
+     * - 各预测增量与 `predict` 中单延迟下的结果一致，即位置为 \f$v(Kt_f+B)\f$，角度为
+     *   \f$\omega(Kt_f+B+B_s)\f$
+     *
+     * @param[in] p_group 待推演的序列组
+     * @param[in] tofs 候选击发延迟时间网格（子弹飞行时间）
+     * @return 批量推演信息
+     */
+    RolloutInfo rollout(group::ptr p_group, const std::vector<double> &tofs);
 };
 
 //! @} gyro_predictor
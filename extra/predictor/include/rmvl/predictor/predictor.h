@@ -13,6 +13,8 @@
 
 #include <unordered_map>
 
+#include "rmvl/core/stats.hpp"
+#include "rmvl/core/util.hpp"
 #include "rmvl/group/group.h"
 
 namespace rm
@@ -21,6 +23,167 @@ namespace rm
 //! @addtogroup predictor
 //! @{
 
+/**
+ * @brief 开放寻址扁平哈希表
+ * @note
+ * - 面向以智能指针为键的小容量映射设计，槽位在单块连续内存中线性探测，避免了
+ *   `std::unordered_map` 逐节点分配与跨节点跳转带来的缓存失效
+ * @note
+ * - 不支持删除元素，映射整体构造、整体销毁，与预测、决策模块逐帧重建的使用方式一致
+ *
+ * @tparam KeyT 键类型，需支持 `std::hash` 与 `operator==`
+ * @tparam ValueT 值类型，需可默认构造
+ */
+template <typename KeyT, typename ValueT>
+class FlatMap
+{
+public:
+    //! 键值对槽位
+    struct Slot
+    {
+        KeyT first{};    //!< 键
+        ValueT second{}; //!< 值
+        bool used{};     //!< 槽位是否被占用
+    };
+
+    //! 跳过空槽位的只读迭代器
+    class const_iterator
+    {
+    public:
+        const_iterator(const Slot *cur, const Slot *end) : _cur(cur), _end(end) { skip(); }
+        const Slot &operator*() const { return *_cur; }
+        const Slot *operator->() const { return _cur; }
+        const_iterator &operator++() { ++_cur, skip(); return *this; }
+        bool operator==(const const_iterator &it) const { return _cur == it._cur; }
+        bool operator!=(const const_iterator &it) const { return _cur != it._cur; }
+
+    private:
+        void skip() { while (_cur != _end && !_cur->used) ++_cur; }
+
+        const Slot *_cur; //!< 当前槽位
+        const Slot *_end; //!< 结束槽位
+    };
+
+    FlatMap() = default;
+
+    //! 元素个数
+    std::size_t size() const { return _size; }
+    //! 是否为空
+    bool empty() const { return _size == 0; }
+
+    const_iterator begin() const { return {_slots.data(), _slots.data() + _slots.size()}; }
+    const_iterator end() const { return {_slots.data() + _slots.size(), _slots.data() + _slots.size()}; }
+
+    /**
+     * @brief 预留不少于指定元素个数的槽位
+     *
+     * @param[in] num 元素个数
+     */
+    void reserve(std::size_t num)
+    {
+        std::size_t capacity = MIN_CAPACITY;
+        while (capacity * 3 < num * 4)
+            capacity <<= 1;
+        if (capacity > _slots.size())
+            rehash(capacity);
+    }
+
+    /**
+     * @brief 访问指定键对应的值，若不存在则插入默认构造的值
+     *
+     * @param[in] key 键
+     * @return 值的引用
+     */
+    ValueT &operator[](const KeyT &key)
+    {
+        // 负载因子超过 3/4 时扩容，保证线性探测的探测链足够短
+        if ((_size + 1) * 4 > _slots.size() * 3)
+            rehash(_slots.empty() ? MIN_CAPACITY : _slots.size() << 1);
+        Slot &slot = probe(_slots, key);
+        if (!slot.used)
+        {
+            slot.first = key;
+            slot.used = true;
+            ++_size;
+        }
+        return slot.second;
+    }
+
+    /**
+     * @brief 访问指定键对应的值，若不存在则抛出异常
+     *
+     * @param[in] key 键
+     * @return 值的引用
+     */
+    ValueT &at(const KeyT &key)
+    {
+        return const_cast<ValueT &>(static_cast<const FlatMap &>(*this).at(key));
+    }
+
+    /**
+     * @brief 访问指定键对应的值，若不存在则抛出异常（const 版本）
+     *
+     * @param[in] key 键
+     * @return 值的 const 引用
+     */
+    const ValueT &at(const KeyT &key) const
+    {
+        auto it = find(key);
+        if (it == end())
+            RMVL_Error(RMVL_StsOutOfRange, "Key is not found in the \"FlatMap\"");
+        return it->second;
+    }
+
+    /**
+     * @brief 查找指定键对应的槽位
+     *
+     * @param[in] key 键
+     * @return 指向对应槽位的迭代器，不存在时返回 `end()`
+     */
+    const_iterator find(const KeyT &key) const
+    {
+        if (_size != 0)
+        {
+            const Slot &slot = probe(_slots, key);
+            if (slot.used)
+                return {&slot, _slots.data() + _slots.size()};
+        }
+        return end();
+    }
+
+private:
+    //! 在指定槽位数组中线性探测，返回键所在槽位或首个空槽位
+    static const Slot &probe(const std::vector<Slot> &slots, const KeyT &key)
+    {
+        // 槽位数保持 2 的幂，Fibonacci 散列混淆指针哈希的低位对齐零位
+        std::size_t mask = slots.size() - 1;
+        std::size_t idx = (std::hash<KeyT>{}(key)*static_cast<std::size_t>(0x9e3779b97f4a7c15)) & mask;
+        while (slots[idx].used && !(slots[idx].first == key))
+            idx = (idx + 1) & mask;
+        return slots[idx];
+    }
+
+    static Slot &probe(std::vector<Slot> &slots, const KeyT &key)
+    {
+        return const_cast<Slot &>(probe(static_cast<const std::vector<Slot> &>(slots), key));
+    }
+
+    //! 按指定槽位数重新散列
+    void rehash(std::size_t capacity)
+    {
+        std::vector<Slot> slots(capacity);
+        for (Slot &slot : _slots)
+            if (slot.used)
+                probe(slots, slot.first) = std::move(slot);
+        _slots = std::move(slots);
+    }
+
+    static constexpr std::size_t MIN_CAPACITY = 16; //!< 最小槽位数
+
+    std::vector<Slot> _slots; //!< 槽位数组
+    std::size_t _size{};      //!< 元素个数
+};
+
 //! 预测对象枚举
 enum : std::size_t
 {
@@ -45,12 +208,14 @@ enum : std::size_t
  */
 struct PredictInfo
 {
+    //! 帧 ID，与 rm::lineage 帧血缘跟踪记录对应，`0` 表示未开启帧血缘跟踪
+    uint64_t frame_id{};
     //! 静态响应预测增量 B
-    std::unordered_map<tracker::const_ptr, cv::Vec<double, 9>> static_prediction;
+    FlatMap<tracker::const_ptr, cv::Vec<double, 9>> static_prediction;
     //! 动态响应预测增量 Kt
-    std::unordered_map<tracker::const_ptr, cv::Vec<double, 9>> dynamic_prediction;
+    FlatMap<tracker::const_ptr, cv::Vec<double, 9>> dynamic_prediction;
     //! 射击延迟预测增量 Bs
-    std::unordered_map<tracker::const_ptr, cv::Vec<double, 9>> shoot_delay_prediction;
+    FlatMap<tracker::const_ptr, cv::Vec<double, 9>> shoot_delay_prediction;
 };
 
 //! 目标预测模块
@@ -72,6 +237,26 @@ public:
      */
     virtual PredictInfo predict(const std::vector<group::ptr> &groups,
                                 const std::unordered_map<tracker::ptr, double> &tof) = 0;
+
+protected:
+    /**
+     * @brief 创建作用域耗时探针，供派生类在 `predict` 入口处使用
+     * @note 统计通道按实例区分，统计未启动时返回空探针，仅付出一次原子读的开销
+     *
+     * @param[in] depth 当前队列深度，一般为序列组数目
+     * @return 作用域耗时探针
+     */
+    stats::Probe probe(std::size_t depth = 0) const
+    {
+        if (!stats::active())
+            return {};
+        if (_stage_stats == nullptr)
+            _stage_stats = &stats::instanceChannel("predictor", this);
+        return {*_stage_stats, depth};
+    }
+
+private:
+    mutable stats::StageStats *_stage_stats{}; //!< 实例级统计通道
 };
 
 //! @} predictor
@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <deque>
+#include <future>
+#include <valarray>
 #include <vector>
 
 #include "predictor.h"
@@ -27,6 +30,13 @@ class RunePredictor final : public predictor
 public:
     RunePredictor() = default;
 
+    //! 析构函数，等待进行中的异步拟合任务结束
+    ~RunePredictor() override
+    {
+        if (_fit_result.valid())
+            _fit_result.wait();
+    }
+
     /**
      * @brief 神符预测核心函数
      * @note
@@ -43,6 +53,33 @@ public:
 
     //! 构建 RunePredictor
     static inline std::unique_ptr<RunePredictor> make_predictor() { return std::make_unique<RunePredictor>(); }
+
+private:
+    /**
+     * @brief 启动、回收异步正弦转速模型拟合任务
+     * @note
+     * - 拟合在后台线程上对原始角度数据的快照进行，帧循环不等待拟合完成，继续使用最近一次
+     *   收敛的模型参数外推，新的拟合结果在就绪后的下一帧被回收生效
+     * @note
+     * - 拟合状态仅由调用 `predict` 的线程读写，后台线程只计算纯函数，无需加锁
+     *
+     * @param[in] raw_datas 原始角度数据队列
+     */
+    void updateFitting(const std::deque<double> &raw_datas);
+
+    /**
+     * @brief 利用最近一次收敛的正弦转速模型计算预测角度增量
+     *
+     * @param[in] tf 预测时间跨度，单位 `s`
+     * @return 角度预测增量 \f$\Delta\theta\f$
+     */
+    double sinePredict(double tf) const;
+
+    std::future<std::valarray<double>> _fit_result; //!< 进行中的异步拟合任务
+    std::valarray<double> _params;                  //!< 最近一次收敛的模型参数 \f$(a,\omega,\varphi,b,c)\f$
+    bool _fitted{};                                 //!< 模型参数是否有效
+    std::size_t _frames_since_fit{};                //!< 最近一次生效的拟合快照后经过的帧数
+    std::size_t _frames_since_snapshot{};           //!< 进行中的拟合快照后经过的帧数
 };
 
 //! @} rune_predictor
@@ -13,6 +13,8 @@
 
 #include <vector>
 
+#include "rmvl/algorithm/numcal.hpp"
+
 #include "predictor.h"
 
 namespace rm
@@ -24,10 +26,10 @@ namespace rm
 //! 系统参数辨识神符预测类
 class SpiRunePredictor final : public predictor
 {
-    const size_t _n;        //!< 模型阶数
-    const double _interval; //!< 采样间隔
-    cv::Mat _pm;            //!< 协方差矩阵
-    cv::Mat _xm;            //!< 待求解系数向量
+    const size_t _n;            //!< 模型阶数
+    const double _interval;     //!< 采样间隔
+    RecursiveLeastSquares _rls; //!< 系统参数辨识器
+    std::vector<double> _am;    //!< 回归向量缓存
 
 public:
     //! 构造函数
@@ -19,6 +19,7 @@ namespace rm
 
 PredictInfo ArmorPredictor::predict(const std::vector<group::ptr> &groups, const std::unordered_map<tracker::ptr, double> &tof)
 {
+    auto stats_probe = probe(groups.size());
     // 预测信息
     PredictInfo info{};
     for (auto p_group : groups)
@@ -21,6 +21,7 @@ namespace rm
 PredictInfo GyroPredictor::predict(const std::vector<group::ptr> &groups,
                                    const std::unordered_map<tracker::ptr, double> &tof)
 {
+    auto stats_probe = probe(groups.size());
     // 预测信息
     PredictInfo info{};
     for (auto p_group : groups)
@@ -55,4 +56,28 @@ PredictInfo GyroPredictor::predict(const std::vector<group::ptr> &groups,
     return info;
 }
 
+RolloutInfo GyroPredictor::rollout(group::ptr p_group, const std::vector<double> &tofs)
+{
+    auto p_gyro_group = GyroGroup::cast(p_group);
+    if (p_gyro_group == nullptr)
+        RMVL_Error(RMVL_StsBadArg, "Input argument \"p_group\" is not a \"GyroGroup\".");
+    RolloutInfo info{};
+    size_t tof_num = tofs.size();
+    info.x.resize(tof_num), info.y.resize(tof_num), info.z.resize(tof_num), info.angle.resize(tof_num);
+    // 平移、旋转状态仅需读取一次，随后按预测对象逐列扫描时间网格
+    cv::Vec3d v = p_gyro_group->getSpeed3D();
+    double w = p_gyro_group->getRotatedSpeed();
+    double k = para::gyro_predictor_param.K, b = para::gyro_predictor_param.B;
+    double bs = para::gyro_predictor_param.SHOOT_B;
+    for (size_t i = 0; i < tof_num; ++i)
+        info.x[i] = v(0) * (k * tofs[i] + b);
+    for (size_t i = 0; i < tof_num; ++i)
+        info.y[i] = v(1) * (k * tofs[i] + b);
+    for (size_t i = 0; i < tof_num; ++i)
+        info.z[i] = v(2) * (k * tofs[i] + b);
+    for (size_t i = 0; i < tof_num; ++i)
+        info.angle[i] = w * (k * tofs[i] + b + bs);
+    return info;
+}
+
 } // namespace rm
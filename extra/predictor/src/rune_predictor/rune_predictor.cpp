@@ -9,7 +9,12 @@
  *
  */
 
+#include <cmath>
+
 #include "rmvl/predictor/rune_predictor.h"
+#include "rmvl/algorithm/dsp.hpp"
+#include "rmvl/algorithm/math.hpp"
+#include "rmvl/algorithm/numcal.hpp"
 #include "rmvl/group/rune_group.h"
 #include "rmvl/tracker/rune_tracker.h"
 
@@ -22,25 +27,88 @@ namespace rm
 
 PredictInfo RunePredictor::predict(const std::vector<group::ptr> &groups, const std::unordered_map<tracker::ptr, double> &tof)
 {
+    auto stats_probe = probe(groups.size());
     if (groups.size() != 1)
         RMVL_Error(RMVL_StsBadSize, "Size of the groups is not equal to \'1\'");
     auto rune_group = RuneGroup::cast(groups.front()); // 转换为神符 group 子类
     if (rune_group == nullptr)
         RMVL_Error(RMVL_BadDynamicType, "Dynamic type of the group::ptr is not equal to Runegroup::ptr");
+    // 异步正弦转速模型拟合
+    if (para::rune_predictor_param.ASYNC_FIT)
+        updateFitting(rune_group->getRawDatas());
     // 预测信息
     PredictInfo info{};
     for (auto p_tracker : rune_group->data())
     {
         auto p_rune_tracker = RuneTracker::cast(p_tracker);
         double tf = (tof.find(p_tracker) == tof.end()) ? 0. : tof.at(p_tracker);
-        // Kt + B 预测模型
-        double dKt = p_rune_tracker->getRotatedSpeed() * para::rune_predictor_param.PREDICT_K * tf;
+        // 模型参数收敛后使用正弦转速模型外推，否则使用 Kt + B 预测模型
+        double dKt = _fitted ? sinePredict(para::rune_predictor_param.PREDICT_K * tf)
+                             : p_rune_tracker->getRotatedSpeed() * para::rune_predictor_param.PREDICT_K * tf;
         double dB = p_rune_tracker->getRotatedSpeed() * para::rune_predictor_param.PREDICT_B;
         // 更新预测量
-        info.dynamic_prediction.at(p_tracker)[ANG_Z] = dKt;
-        info.static_prediction.at(p_tracker)[ANG_Z] = dB;
+        info.dynamic_prediction[p_tracker](ANG_Z) = dKt;
+        info.static_prediction[p_tracker](ANG_Z) = dB;
     }
     return info;
 }
 
+void RunePredictor::updateFitting(const std::deque<double> &raw_datas)
+{
+    ++_frames_since_fit, ++_frames_since_snapshot;
+    // 回收已就绪的拟合结果
+    if (_fit_result.valid() && _fit_result.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        _params = _fit_result.get();
+        _fitted = true;
+        _frames_since_fit = _frames_since_snapshot;
+    }
+    // 无进行中的拟合任务且样本充足时，对当前数据快照启动新的拟合任务
+    if (_fit_result.valid() || raw_datas.size() < para::rune_predictor_param.FIT_MIN_SAMPLES)
+        return;
+    std::vector<double> snapshot(raw_datas.begin(), raw_datas.end());
+    double interval = para::rune_predictor_param.SAMPLE_INTERVAL / 1000.;
+    // 初值取自当前窗口：平均转速作为速度偏置，角度模型常数项取最新角度
+    double b0 = (snapshot.front() - snapshot.back()) / (static_cast<double>(snapshot.size() - 1) * interval);
+    _fit_result = std::async(std::launch::async, [snapshot = std::move(snapshot), interval, b0] {
+        constexpr double omega0 = 1.884;
+        const std::size_t n = snapshot.size();
+        std::valarray<double> x0 = {45., omega0, 0., b0, snapshot.front()};
+        // 标称频率对应的 DFT 频点落在窗口内时，以单频点 Goertzel 检测去趋势后的正弦分量，
+        // 用其幅值与相位代替固定初值，减少拟合迭代次数
+        std::size_t k = static_cast<std::size_t>(std::lround(omega0 * static_cast<double>(n) * interval / (2 * PI)));
+        if (k >= 1 && k < n / 2)
+        {
+            RealSignal residual(n);
+            for (std::size_t i = 0; i < n; ++i)
+                residual[i] = snapshot[i] - (b0 * -static_cast<double>(i) * interval + snapshot.front());
+            auto s = goertzel(residual, k);
+            // residual[i] ≈ -(a/ω)cos(-ωiΔt+φ) = (a/ω)cos(ωΔt·i+π-φ)，故 arg s = π-φ
+            x0[0] = 2. * std::abs(s) / static_cast<double>(n) * omega0;
+            x0[2] = PI - std::arg(s);
+        }
+        // 角度模型 θ(t) = -(a/ω)cos(ωt+φ) + bt + c，对应转速模型 a·sin(ωt+φ) + b，
+        // 直接对原始角度拟合，避免差分放大噪声，t = 0 对应快照中最新的样本
+        auto func = [&](const std::valarray<double> &x) {
+            std::valarray<double> res(snapshot.size());
+            for (std::size_t i = 0; i < snapshot.size(); ++i)
+            {
+                double t = -static_cast<double>(i) * interval;
+                res[i] = -(x[0] / x[1]) * std::cos(x[1] * t + x[2]) + x[3] * t + x[4] - snapshot[i];
+            }
+            return res;
+        };
+        return lsqnonlin(func, x0);
+    });
+    _frames_since_snapshot = 0;
+}
+
+double RunePredictor::sinePredict(double tf) const
+{
+    // 以拟合快照中最新样本为时间零点，按经过的帧数折算当前时刻
+    double t0 = static_cast<double>(_frames_since_fit) * para::rune_predictor_param.SAMPLE_INTERVAL / 1000.;
+    auto theta = [this](double t) { return -(_params[0] / _params[1]) * std::cos(_params[1] * t + _params[2]) + _params[3] * t; };
+    return theta(t0 + tf) - theta(t0);
+}
+
 } // namespace rm
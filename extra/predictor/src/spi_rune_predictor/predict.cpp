@@ -19,24 +19,10 @@
 namespace rm
 {
 
-/**
- * @brief 重置、初始化 Pm、xm
- *
- * @param[in] n 模型阶数
- * @param[out] Pm 协方差矩阵
- * @param[out] xm 待求解系数向量
- */
-inline void resetPmxm(size_t n, cv::Mat &Pm, cv::Mat &xm)
-{
-    Pm = para::spi_rune_predictor_param.KP * cv::Mat::eye(n + 1, n + 1, CV_64FC1);
-    xm = cv::Mat::zeros(n + 1, 1, CV_64FC1);
-}
-
 SpiRunePredictor::SpiRunePredictor() : _n(para::spi_rune_predictor_param.DIFF_ORDER),
-                                       _interval(para::spi_rune_predictor_param.SAMPLE_INTERVAL)
-{
-    resetPmxm(_n, _pm, _xm);
-}
+                                       _interval(para::spi_rune_predictor_param.SAMPLE_INTERVAL),
+                                       _rls(_n + 1, para::spi_rune_predictor_param.KP),
+                                       _am(_n + 1) {}
 
 void SpiRunePredictor::identifier(const std::deque<double> &raw_datas)
 {
@@ -46,23 +32,20 @@ void SpiRunePredictor::identifier(const std::deque<double> &raw_datas)
     // 获取 nf: 直接设定为最大值
     size_t nf = para::spi_rune_predictor_param.MAX_NF;
     // 系数提取
-    cv::Mat am = cv::Mat(1, _n + 1, CV_64FC1);
-    am.at<double>(0) = 1;
+    _am[0] = 1;
     for (uint i = 0; i < _n; ++i)
-        am.at<double>(i + 1) = raw_datas[nf + i];
-    cv::Mat amt = am.t();
-    double bm = raw_datas[0];
+        _am[i + 1] = raw_datas[nf + i];
     // 最小二乘递推
-    _pm = _pm - (_pm * amt * am * _pm) / (1 + cv::Mat(am * _pm * amt).at<double>(0));
-    _xm = _xm + _pm * amt * (bm - cv::Mat(am * _xm).at<double>(0));
+    _rls.update(_am, raw_datas[0]);
 }
 
 PredictInfo SpiRunePredictor::predict(const std::vector<group::ptr> &groups, const std::unordered_map<tracker::ptr, double> &tof)
 {
+    auto stats_probe = probe(groups.size());
     PredictInfo info{};
     if (groups.empty() || groups.front()->data().empty())
     {
-        resetPmxm(_n, _pm, _xm);
+        _rls.reset();
         return info;
     }
     if (groups.size() > 1)
@@ -116,18 +99,15 @@ double SpiRunePredictor::anglePredict(const std::deque<double> &raw_datas, doubl
     size_t delay_k2 = max_nf - static_cast<size_t>(nf); // 预测量取 nf 的滞后帧数
     size_t delay_k1 = delay_k2 + 1;                     // 预测量取 nf - 1 的滞后帧数
     // 系数提取
-    cv::Mat am1(1, _n + 1, CV_64FC1);
-    am1.at<double>(0) = 1;
+    _am[0] = 1;
     for (uint i = 0; i < _n; ++i)
-        am1.at<double>(i + 1) = raw_datas[delay_k1 + i];
-    cv::Mat am2(1, _n + 1, CV_64FC1);
-    am2.at<double>(0) = 1;
+        _am[i + 1] = raw_datas[delay_k1 + i];
+    double prediction_k1 = _rls(_am);
     for (uint i = 0; i < _n; ++i)
-        am2.at<double>(i + 1) = raw_datas[delay_k2 + i];
-    // 预测
-    auto x = cv::Mat(am1 * _xm);
+        _am[i + 1] = raw_datas[delay_k2 + i];
+    double prediction_k2 = _rls(_am);
     // 线性插值得到 Δθ
-    return cv::Mat(am1 * _xm).at<double>(0) * k1 + cv::Mat(am2 * _xm).at<double>(0) * k2 - raw_datas[0];
+    return prediction_k1 * k1 + prediction_k2 * k2 - raw_datas[0];
 }
 
 } // namespace rm
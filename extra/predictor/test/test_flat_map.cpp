@@ -0,0 +1,70 @@
+/**
+ * @file test_flat_map.cpp
+ * @author RoboMaster Vision Community
+ * @brief 开放寻址扁平哈希表单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), RoboMaster Vision Community
+ *
+ */
+
+#include "rmvl/rmvl_modules.hpp"
+
+#ifdef HAVE_RMVL_PREDICTOR
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/predictor/predictor.h"
+
+using namespace rm;
+
+namespace rm_test
+{
+
+TEST(FlatMapTest, insert_and_access)
+{
+    FlatMap<std::shared_ptr<int>, cv::Vec<double, 9>> map;
+    EXPECT_TRUE(map.empty());
+    auto key1 = std::make_shared<int>(1);
+    auto key2 = std::make_shared<int>(2);
+    map[key1][ANG_Z] = 1.5;
+    map[key2][YAW] = -2.5;
+    EXPECT_EQ(map.size(), 2u);
+    // operator[] 对已有键返回同一槽位
+    EXPECT_EQ(map[key1](ANG_Z), 1.5);
+    EXPECT_EQ(map.at(key2)(YAW), -2.5);
+    EXPECT_TRUE(map.find(std::make_shared<int>(3)) == map.end());
+}
+
+TEST(FlatMapTest, at_missing_key)
+{
+    FlatMap<std::shared_ptr<int>, cv::Vec<double, 9>> map;
+    EXPECT_THROW(map.at(std::make_shared<int>(0)), rm::Exception);
+}
+
+TEST(FlatMapTest, rehash_keeps_elements)
+{
+    FlatMap<std::shared_ptr<int>, cv::Vec<double, 9>> map;
+    std::vector<std::shared_ptr<int>> keys;
+    // 插入个数超过初始槽位数，触发多次扩容
+    for (int i = 0; i < 100; ++i)
+    {
+        keys.push_back(std::make_shared<int>(i));
+        map[keys.back()][POS_X] = i;
+    }
+    EXPECT_EQ(map.size(), 100u);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(map.at(keys[i])(POS_X), i);
+    // 迭代器遍历到的元素个数与 size() 一致
+    std::size_t count{};
+    for (const auto &slot : map)
+        count += static_cast<std::size_t>(*slot.first >= 0);
+    EXPECT_EQ(count, 100u);
+}
+
+} // namespace rm_test
+
+#endif // HAVE_RMVL_PREDICTOR
@@ -44,9 +44,10 @@ public:
     /**
      * @brief 从另一个追踪器进行构造
      *
+     * @param[in] policy 克隆策略，默认为深拷贝
      * @return 指向新追踪器的共享指针
      */
-    RMVL_W tracker::ptr clone() override;
+    RMVL_W tracker::ptr clone(ClonePolicy policy = ClonePolicy::Deep) override;
 
     RMVL_TRACKER_CAST(GyroTracker)
 
@@ -111,7 +112,7 @@ private:
     KF63f _center3d_filter; //!< 位置滤波器
     KF42f _pose_filter;     //!< 姿态滤波器
 
-    std::deque<RobotType> _type_deque; //!< 装甲板状态队列（数字）
+    RingBuffer<RobotType, 32> _type_deque; //!< 装甲板状态队列（数字）
 };
 
 //! @} gyro_tracker
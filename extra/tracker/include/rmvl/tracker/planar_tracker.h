@@ -43,9 +43,10 @@ public:
     /**
      * @brief 从另一个追踪器进行构造
      *
+     * @param[in] policy 克隆策略，默认为深拷贝
      * @return 指向新追踪器的共享指针
      */
-    RMVL_W tracker::ptr clone() override;
+    RMVL_W tracker::ptr clone(ClonePolicy policy = ClonePolicy::Deep) override;
 
     RMVL_TRACKER_CAST(PlanarTracker)
 
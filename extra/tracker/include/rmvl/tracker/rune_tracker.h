@@ -11,8 +11,6 @@
 
 #pragma once
 
-#include <deque>
-
 #include "rmvl/algorithm/kalman.hpp"
 #include "rmvl/combo/rune.h"
 #include "tracker.h"
@@ -31,9 +29,10 @@ namespace rm
  */
 class RMVL_EXPORTS_W_DES RuneTracker final : public tracker
 {
-    int _round{};         //!< 圈数
-    float _rotated_speed; //!< 神符旋转角速度
-    KF21f _filter;        //!< 神符的角度滤波器
+    int _round{};                  //!< 圈数
+    float _rotated_speed{};        //!< 神符旋转角速度
+    float _pending_vanish_angle{}; //!< 掉帧期间累积的相位外推增量（角度制）
+    KF21f _filter;                 //!< 神符的角度滤波器
 
 public:
     using ptr = std::shared_ptr<RuneTracker>;
@@ -54,9 +53,10 @@ public:
     /**
      * @brief 从另一个追踪器进行构造
      *
+     * @param[in] policy 克隆策略，默认为深拷贝
      * @return 指向新追踪器的共享指针
      */
-    RMVL_W tracker::ptr clone() override;
+    RMVL_W tracker::ptr clone(ClonePolicy policy = ClonePolicy::Deep) override;
 
     RMVL_TRACKER_CAST(RuneTracker)
 
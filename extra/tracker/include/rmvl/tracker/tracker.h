@@ -11,9 +11,9 @@
 
 #pragma once
 
-#include <deque>
-
+#include "rmvl/algorithm/datastruct.hpp"
 #include "rmvl/combo/combo.h"
+#include "rmvl/core/stats.hpp"
 
 namespace rm
 {
@@ -21,12 +21,20 @@ namespace rm
 //! @addtogroup tracker
 //! @{
 
+//! 追踪器、序列组的克隆策略
+enum class ClonePolicy : uint8_t
+{
+    Deep,        //!< 深拷贝，历史组合体逐一克隆，克隆结果与原对象完全独立
+    CopyOnWrite, //!< 写时复制，与原对象共享历史组合体，后续更新产生的新数据互不可见，
+                 //!< 适用于每帧推演假设决策等高频克隆场景
+};
+
 //! 组合体时间序列
 class RMVL_EXPORTS_W_ABS tracker
 {
 protected:
-    std::deque<combo::ptr> _combo_deque; //!< 组合体时间队列
-    uint32_t _vanish_num{};              //!< 消失帧数
+    RingBuffer<combo::ptr, 32> _combo_deque; //!< 组合体时间队列
+    uint32_t _vanish_num{};                  //!< 消失帧数
 
     StateInfo _state{};                //!< 追踪器状态
     float _height{};                   //!< 追踪器高度（可表示修正后）
@@ -44,10 +52,13 @@ public:
 
     /**
      * @brief 从另一个追踪器进行构造
+     * @warning 写时复制模式下克隆体与原追踪器共享历史组合体，二者均不允许在原地修改共享的组合体，
+     *          追踪器的正常更新流程只新增组合体，不受此限制影响
      *
+     * @param[in] policy 克隆策略，默认为深拷贝
      * @return 指向新追踪器的共享指针
      */
-    RMVL_W virtual ptr clone() = 0;
+    RMVL_W virtual ptr clone(ClonePolicy policy = ClonePolicy::Deep) = 0;
 
     /**
      * @brief 使用已捕获的 `combo` 更新追踪器
@@ -75,8 +86,8 @@ public:
     RMVL_W uint32_t getVanishNumber() const { return _vanish_num; }
     //! 获取序列数量信息
     RMVL_W size_t size() const { return _combo_deque.size(); }
-    //! 获取时间序列原始数据
-    RMVL_W const std::deque<combo::ptr> &data() const { return _combo_deque; }
+    //! 获取时间序列数据，按队首到队尾的顺序排列
+    RMVL_W std::vector<combo::ptr> data() const { return {_combo_deque.begin(), _combo_deque.end()}; }
     //! 序列是否为空
     RMVL_W bool empty() const { return _combo_deque.empty(); }
     //! 索引 - 容器仅能通过内部 at 实现访问保证下标安全
@@ -101,6 +112,28 @@ public:
     RMVL_W const CameraExtrinsics &extrinsic() const { return _extrinsic; }
     //! 获取追踪器修正后的目标转角速度（角度制）
     RMVL_W const cv::Point2f &speed() const { return _speed; }
+
+    RMVL_W_SUBST("TrackerBatch")
+
+protected:
+    /**
+     * @brief 创建作用域耗时探针，供派生类在 `update` 入口处使用
+     * @note 统计通道按实例区分，统计未启动时返回空探针，仅付出一次原子读的开销
+     *
+     * @param[in] depth 当前队列深度，一般为时间序列长度
+     * @return 作用域耗时探针
+     */
+    stats::Probe probe(std::size_t depth = 0) const
+    {
+        if (!stats::active())
+            return {};
+        if (_stage_stats == nullptr)
+            _stage_stats = &stats::instanceChannel("tracker", this);
+        return {*_stage_stats, depth};
+    }
+
+private:
+    mutable stats::StageStats *_stage_stats{}; //!< 实例级统计通道
 };
 
 #define RMVL_TRACKER_CAST(name)                                                                           \
@@ -130,9 +163,10 @@ public:
     /**
      * @brief 从另一个追踪器进行构造
      *
+     * @param[in] policy 克隆策略，默认为深拷贝
      * @return 指向新追踪器的共享指针
      */
-    RMVL_W tracker::ptr clone() override;
+    RMVL_W tracker::ptr clone(ClonePolicy policy = ClonePolicy::Deep) override;
 
     /**
      * @brief 使用已捕获的 `combo` 更新追踪器
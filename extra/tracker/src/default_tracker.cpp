@@ -33,21 +33,21 @@ DefaultTracker::DefaultTracker(combo::ptr p_combo) : tracker()
     updateData(p_combo);
 }
 
-tracker::ptr DefaultTracker::clone()
+tracker::ptr DefaultTracker::clone(ClonePolicy policy)
 {
     auto retval = std::make_shared<DefaultTracker>(*this);
-    // 更新内部所有组合体
-    for (auto &p_combo : retval->_combo_deque)
-        p_combo = p_combo->clone(p_combo->tick());
+    // 深拷贝模式下更新内部所有组合体，写时复制模式下历史组合体与原追踪器共享
+    if (policy == ClonePolicy::Deep)
+        for (auto &p_combo : retval->_combo_deque)
+            p_combo = p_combo->clone(p_combo->tick());
     return retval;
 }
 
 void DefaultTracker::update(combo::ptr p_combo)
 {
+    auto stats_probe = probe(size());
     updateData(p_combo);
     _combo_deque.push_front(p_combo);
-    if (_combo_deque.size() > 32U)
-        _combo_deque.pop_back();
     _vanish_num = 0;
 }
 
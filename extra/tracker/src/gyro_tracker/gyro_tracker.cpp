@@ -41,17 +41,19 @@ GyroTracker::GyroTracker(combo::ptr p_armor)
     initFilter();
 }
 
-tracker::ptr GyroTracker::clone()
+tracker::ptr GyroTracker::clone(ClonePolicy policy)
 {
     auto retval = std::make_shared<GyroTracker>(*this);
-    // 更新内部所有组合体
-    for (auto &p_combo : retval->_combo_deque)
-        p_combo = p_combo->clone(p_combo->tick());
+    // 深拷贝模式下更新内部所有组合体，写时复制模式下历史组合体与原追踪器共享
+    if (policy == ClonePolicy::Deep)
+        for (auto &p_combo : retval->_combo_deque)
+            p_combo = p_combo->clone(p_combo->tick());
     return retval;
 }
 
 void GyroTracker::update(combo::ptr p_armor)
 {
+    auto stats_probe = probe(size());
     if (p_armor == nullptr)
         RMVL_Error(RMVL_StsBadArg, "Input argument \"p_armor\" is nullptr.");
     // Reset the vanish number
@@ -76,18 +78,15 @@ void GyroTracker::update(combo::ptr p_armor)
     updatePoseFilter();
     // 计算旋转角速度
     _rotspeed = calcRotationSpeed();
-    // 容量上限 32
-    if (_combo_deque.size() > 32U)
-        _combo_deque.pop_back();
 }
 
 void GyroTracker::updateType(RobotType robot)
 {
-    if (robot == RobotType::UNKNOWN || robot != RobotType::UNKNOWN)
-        _type_deque.push_back(robot);
-    if (_type_deque.size() > 32)
-        _type_deque.pop_back();
-    if (_type_deque.size() < 32)
+    // 类型队列达到容量上限后冻结，不再统计新的类型
+    if (_type_deque.full())
+        return;
+    _type_deque.push_back(robot);
+    if (!_type_deque.full())
         _state["robot"] = to_string(calculateModeNum(_type_deque.begin(), _type_deque.end()));
 }
 
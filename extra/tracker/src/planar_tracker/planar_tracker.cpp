@@ -38,17 +38,19 @@ PlanarTracker::PlanarTracker(combo::ptr p_combo)
 
 bool PlanarTracker::invalid() const { return _vanish_num >= para::planar_tracker_param.TRACK_FRAMES; }
 
-tracker::ptr PlanarTracker::clone()
+tracker::ptr PlanarTracker::clone(ClonePolicy policy)
 {
     auto retval = std::make_shared<PlanarTracker>(*this);
-    // 更新内部所有组合体
-    for (auto &p_combo : retval->_combo_deque)
-        p_combo = p_combo->clone(p_combo->tick());
+    // 深拷贝模式下更新内部所有组合体，写时复制模式下历史组合体与原追踪器共享
+    if (policy == ClonePolicy::Deep)
+        for (auto &p_combo : retval->_combo_deque)
+            p_combo = p_combo->clone(p_combo->tick());
     return retval;
 }
 
 void PlanarTracker::update(combo::ptr p_combo)
 {
+    auto stats_probe = probe(size());
     if (p_combo == nullptr)
         RMVL_Error(RMVL_StsBadArg, "Pointer of the input argument combo::ptr is nullptr");
 
@@ -71,6 +73,9 @@ void PlanarTracker::update(double tick, [[maybe_unused]] const ImuData &imu_data
     if (_combo_deque.empty())
         return;
     _vanish_num++;
+    // 容量已满时先移除最早的组合体，避免环形缓冲区覆盖队首的最新组合体
+    if (_combo_deque.full())
+        _combo_deque.pop_back();
     _combo_deque.push_back(_combo_deque.front()->clone(tick));
 }
 
@@ -42,26 +42,56 @@ RuneTracker::RuneTracker(combo::ptr p_rune)
 
 bool RuneTracker::invalid() const { return _vanish_num >= para::rune_tracker_param.TRACK_FRAMES; }
 
-tracker::ptr RuneTracker::clone()
+tracker::ptr RuneTracker::clone(ClonePolicy policy)
 {
     auto retval = std::make_shared<RuneTracker>(*this);
-    // 更新内部所有组合体
-    for (auto &p_combo : retval->_combo_deque)
-        p_combo = p_combo->clone(p_combo->tick());
+    // 深拷贝模式下更新内部所有组合体，写时复制模式下历史组合体与原追踪器共享
+    if (policy == ClonePolicy::Deep)
+        for (auto &p_combo : retval->_combo_deque)
+            p_combo = p_combo->clone(p_combo->tick());
     return retval;
 }
 
+/**
+ * @brief 角度差修正至 \f$(-180°, 180°]\f$
+ *
+ * @param[in] delta 角度差（角度制）
+ * @return 修正后的角度差
+ */
+static inline float wrapDeltaAngle(float delta)
+{
+    while (delta > 180.f)
+        delta -= 360.f;
+    while (delta <= -180.f)
+        delta += 360.f;
+    return delta;
+}
+
 void RuneTracker::update(combo::ptr p_rune)
 {
+    auto stats_probe = probe(size());
     if (p_rune == nullptr)
         RMVL_Error(RMVL_StsBadArg, "Pointer of the input argument combo::ptr is nullptr");
     else
     {
+        // 遮挡后重捕获时记录外推相位，用于重新锁定
+        bool relock = _vanish_num > 0;
+        float propagated_angle = _angle;
         _combo_deque.push_front(p_rune);
         // 数据更新
         updateFromRune(p_rune);
         // 更新神符转动的圈数，并计算在考虑圈数时的完全值
         _angle = calculateTotalAngle();
+        if (relock)
+        {
+            // 重捕获：复现目标与外推相位匹配则继承外推速度重新播种滤波器状态，
+            // 免去从头收敛；相位失配说明目标已切换，按首帧方式重新初始化
+            _pending_vanish_angle = 0.f;
+            if (std::abs(wrapDeltaAngle(p_rune->angle() - propagated_angle)) < para::rune_tracker_param.RELOCK_MAX_DELTA_ANGLE)
+                _filter.init({_angle, _rotated_speed}, para::rune_tracker_param.RELOCK_ERROR);
+            else
+                _filter.init({_angle, 0.f}, 1e5f);
+        }
         // 更新滤波器
         float t = 0.f;
         if (_combo_deque.size() >= 2)
@@ -9,6 +9,8 @@
  *
  */
 
+#include <algorithm>
+
 #include "rmvl/algorithm/transform.hpp"
 #include "rmvl/tracker/rune_tracker.h"
 
@@ -68,13 +70,19 @@ void RuneTracker::update(double tick, const ImuData &imu_data)
         t = (_combo_deque.front()->tick() - _combo_deque.back()->tick()) / static_cast<double>(_combo_deque.size() - 1);
     else
         t = para::rune_tracker_param.SAMPLE_INTERVAL / 1000.;
-    _filter.setA({1, t,
-                  0, 1});
-    // 旋转状态先验估计
-    auto rotate_pre = _filter.predict();
+    // 降阶预测：遮挡期间不运行完整滤波节拍，仅以常角速度标量模型推进相位，
+    // 保持相位估计存活，滤波器状态在重捕获时由外推相位重新播种
+    float delta_angle = _rotated_speed * t;
+    _angle += delta_angle;
+    _pending_vanish_angle += delta_angle;
+    // 图像平面的强制构造按降采样节拍执行，其余掉帧帧仅推进相位
+    uint32_t decimate = std::max(para::rune_tracker_param.VANISH_DECIMATE, 1u);
+    if (_vanish_num % decimate != 0)
+        return;
 
     auto p_rune = runeConstructForced(Rune::cast(_combo_deque.front()),
-                                      rotate_pre(0) - _angle, tick, imu_data);
+                                      _pending_vanish_angle, tick, imu_data);
+    _pending_vanish_angle = 0.f;
     _angle = p_rune->angle();
 
     float rad_angle = deg2rad(p_rune->angle());
@@ -83,8 +91,6 @@ void RuneTracker::update(double tick, const ImuData &imu_data)
                                    p_rune->at(1)->center().y - std::sin(rad_angle) * feature_dis};
 
     _relative_angle = calculateRelativeAngle(para::camera_param.cameraMatrix, relative_center);
-    // 直接更新后验估计
-    _filter.correct({rotate_pre(0)});
     _combo_deque.emplace_front(p_rune);
 }
 
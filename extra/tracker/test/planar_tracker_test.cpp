@@ -117,6 +117,25 @@ TEST_F(PlanarTrackerTest, tracker_update_with_none)
     EXPECT_EQ(p_tracker->getVanishNumber(), 1);
 }
 
+// 追踪器克隆策略功能验证
+TEST_F(PlanarTrackerTest, tracker_clone_policy)
+{
+    rm::Armor::ptr armor = buildArmor(cv::Point(500, 300), 8);
+    rm::tracker::ptr p_tracker = rm::PlanarTracker::make_tracker(armor);
+    p_tracker->update(buildArmor(cv::Point(505, 300), 8));
+    // 深拷贝，历史组合体互相独立
+    auto p_deep = p_tracker->clone();
+    EXPECT_EQ(p_deep->size(), p_tracker->size());
+    EXPECT_NE(p_deep->at(0), p_tracker->at(0));
+    // 写时复制，历史组合体共享，后续更新互不可见
+    auto p_cow = p_tracker->clone(rm::ClonePolicy::CopyOnWrite);
+    EXPECT_EQ(p_cow->size(), p_tracker->size());
+    EXPECT_EQ(p_cow->at(0), p_tracker->at(0));
+    p_cow->update(buildArmor(cv::Point(510, 300), 8));
+    EXPECT_EQ(p_cow->size(), 3);
+    EXPECT_EQ(p_tracker->size(), 2);
+}
+
 } // namespace rm_test
 
 #endif // HAVE_RMVL_PLANAR_TRACKER
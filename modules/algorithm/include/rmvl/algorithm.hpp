@@ -14,6 +14,7 @@
 //! @defgroup algorithm 数学、算法模块
 
 // 基础数学库
+#include "algorithm/camera_model.hpp"
 #include "algorithm/math.hpp"
 #include "algorithm/transform.hpp"
 
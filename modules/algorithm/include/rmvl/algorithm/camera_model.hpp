@@ -0,0 +1,105 @@
+/**
+ * @file camera_model.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 相机模型查找表服务
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#ifdef HAVE_OPENCV
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <opencv2/core/types.hpp>
+
+#include "rmvl/core/rmvldef.hpp"
+
+namespace rm
+{
+
+//! @addtogroup algorithm
+//! @{
+
+/**
+ * @brief 相机模型查找表服务
+ * @brief
+ * - 按标定参数预计算全图的去畸变查找表，将逐点的迭代畸变求解转化为查表与双线性插值，
+ *   适合对每帧角点集合做批量像素坐标到归一化相机平面坐标的转换
+ * @brief
+ * - 查找表可缓存至磁盘，文件名由内参、畸变参数与图像尺寸的哈希值唯一确定，
+ *   标定参数不变时后续启动直接加载，避免重复预计算
+ * @brief
+ * - 查询点落在查找表覆盖范围之外时回退为逐点迭代求解，结果仍然正确
+ */
+class RMVL_EXPORTS CameraModel
+{
+    RMVL_IMPL;
+
+public:
+    /**
+     * @brief 按标定参数创建相机模型，并预计算去畸变查找表
+     *
+     * @param[in] camera_matrix 相机内参矩阵
+     * @param[in] dist_coeffs 相机畸变参数
+     * @param[in] size 查找表覆盖的图像尺寸
+     * @param[in] cache_dir 查找表磁盘缓存目录，目录需已存在，为空时不启用磁盘缓存
+     */
+    CameraModel(const cv::Matx33f &camera_matrix, const cv::Matx51f &dist_coeffs,
+                const cv::Size &size, std::string_view cache_dir = {});
+
+    //! @cond
+    CameraModel(const CameraModel &) = delete;
+    CameraModel(CameraModel &&) = default;
+    CameraModel &operator=(const CameraModel &) = delete;
+    CameraModel &operator=(CameraModel &&) = default;
+    //! @endcond
+
+    /**
+     * @brief 像素坐标去畸变至归一化相机平面（查表 + 双线性插值）
+     *
+     * @param[in] pixel 像素坐标
+     * @return 归一化相机平面坐标 \f$(\tan\theta_{\text{yaw}}, \tan\theta_{\text{pitch}})\f$
+     */
+    cv::Point2f undistort(const cv::Point2f &pixel) const;
+
+    /**
+     * @brief 批量像素坐标去畸变至归一化相机平面
+     *
+     * @param[in] pixels 像素坐标列表
+     * @param[out] points 归一化相机平面坐标列表
+     */
+    void undistort(const std::vector<cv::Point2f> &pixels, std::vector<cv::Point2f> &points) const;
+
+    /**
+     * @brief 像素坐标转换为相机坐标系下的单位视线向量
+     *
+     * @param[in] pixel 像素坐标
+     * @return 单位视线向量
+     */
+    cv::Vec3f ray(const cv::Point2f &pixel) const;
+
+    /**
+     * @brief 获取指定标定参数对应的相机模型（按参数哈希缓存的进程级服务）
+     *
+     * @param[in] camera_matrix 相机内参矩阵
+     * @param[in] dist_coeffs 相机畸变参数
+     * @param[in] size 查找表覆盖的图像尺寸，为空时按主点位于图像中心推断
+     * @param[in] cache_dir 查找表磁盘缓存目录，目录需已存在，为空时不启用磁盘缓存
+     * @return 相机模型
+     */
+    static const CameraModel &get(const cv::Matx33f &camera_matrix, const cv::Matx51f &dist_coeffs,
+                                  const cv::Size &size = {}, std::string_view cache_dir = {});
+};
+
+//! @} algorithm
+
+} // namespace rm
+
+#endif // HAVE_OPENCV
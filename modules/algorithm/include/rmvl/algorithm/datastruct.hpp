@@ -11,7 +11,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <numeric>
 #include <stack>
+#include <stdexcept>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -120,7 +128,12 @@ public:
         swapNode(idx, _c.size() - 1);
         _indexs.erase(_c.back());
         _c.pop_back();
-        downHeapify(idx);
+        // 末尾补位的元素相对原元素可能偏大或偏小，需双向调整
+        if (idx < _c.size())
+        {
+            downHeapify(idx);
+            upHeapify(idx);
+        }
     }
 
     //! 弹出堆顶
@@ -185,6 +198,200 @@ private:
     std::unordered_map<Tp, std::size_t> _indexs; //!< 下标哈希表（存放数组的下标）
 };
 
+/**
+ * @brief 面向整数键的 4 叉随机访问堆
+ * @brief
+ * - 与 rm::RaHeap 行为对应，但面向键为小范围非负整数（如候选序号）的场景：随机访问经
+ *   稠密下标数组完成，替代哈希表的指针跳转；每个节点的 4 个子节点在元素数组中连续存放，
+ *   下滤的一轮比较只触达相邻内存，树高减半，对数百元素规模的候选排序更为缓存友好
+ * @brief
+ * - 上滤与下滤以"空洞"方式移动元素，每轮一次赋值而非一次交换，支持自底向上的 \f$O(n)\f$
+ *   批量建堆（rm::RaHeap4::assign）
+ *
+ * @tparam Tp 优先级类型
+ * @tparam Compare 比较器可调用对象，默认为 `std::less<Tp>`，即默认为大根堆
+ */
+template <typename Tp, typename Compare = std::less<Tp>>
+class RaHeap4
+{
+public:
+    typedef Tp value_type;
+    typedef std::size_t size_type;
+    typedef Compare value_compare;
+
+    RaHeap4() = default;
+
+    /**
+     * @brief 批量构造堆，键依次为 `0, 1, ...`
+     *
+     * @tparam InputIterator 老式前向迭代器类型
+     * @param[in] first 优先级起始迭代器
+     * @param[in] last 优先级终止迭代器
+     */
+    template <typename InputIterator>
+    RaHeap4(InputIterator first, InputIterator last) { assign(first, last); }
+
+    /**
+     * @brief 批量重建堆，键依次为 `0, 1, ...`，自底向上建堆，总复杂度 \f$O(n)\f$
+     *
+     * @tparam InputIterator 老式前向迭代器类型
+     * @param[in] first 优先级起始迭代器
+     * @param[in] last 优先级终止迭代器
+     */
+    template <typename InputIterator>
+    void assign(InputIterator first, InputIterator last)
+    {
+        _c.clear();
+        uint32_t key{};
+        for (; first != last; ++first)
+            _c.push_back({*first, key++});
+        _pos.assign(_c.size(), NPOS);
+        for (uint32_t i = 0; i < _c.size(); ++i)
+            _pos[_c[i].key] = i;
+        if (_c.size() > 1)
+            for (uint32_t i = (static_cast<uint32_t>(_c.size()) - 2) / 4 + 1; i-- > 0;)
+                downHeapify(i);
+    }
+
+    //! 预分配存储空间
+    void reserve(size_type n) { _c.reserve(n), _pos.reserve(n); }
+
+    /**
+     * @brief 添加元素
+     *
+     * @param[in] key 元素键，重复添加已存在的键时忽略
+     * @param[in] value 元素优先级
+     */
+    void push(size_type key, const Tp &value)
+    {
+        if (key >= _pos.size())
+            _pos.resize(key + 1, NPOS);
+        else if (_pos[key] != NPOS)
+            return;
+        _c.push_back({value, static_cast<uint32_t>(key)});
+        _pos[key] = static_cast<uint32_t>(_c.size()) - 1;
+        upHeapify(static_cast<uint32_t>(_c.size()) - 1);
+    }
+
+    /**
+     * @brief 更新元素优先级
+     *
+     * @param[in] key 元素键，键不存在时忽略
+     * @param[in] value 改动后的优先级
+     */
+    void update(size_type key, const Tp &value)
+    {
+        if (!contains(key))
+            return;
+        uint32_t idx = _pos[key];
+        bool up = _comp(_c[idx].value, value);
+        _c[idx].value = value;
+        up ? upHeapify(idx) : downHeapify(idx);
+    }
+
+    /**
+     * @brief 删除指定元素
+     *
+     * @param[in] key 元素键，键不存在时忽略
+     */
+    void erase(size_type key)
+    {
+        if (!contains(key))
+            return;
+        uint32_t idx = _pos[key];
+        _pos[key] = NPOS;
+        Node last = std::move(_c.back());
+        _c.pop_back();
+        // 末尾补位的元素相对原元素可能偏大或偏小，需双向调整
+        if (idx < _c.size())
+        {
+            _c[idx] = std::move(last);
+            _pos[_c[idx].key] = idx;
+            downHeapify(idx);
+            upHeapify(idx);
+        }
+    }
+
+    //! 弹出堆顶
+    void pop() { erase(_c.front().key); }
+
+    //! 键是否存在
+    inline bool contains(size_type key) const { return key < _pos.size() && _pos[key] != NPOS; }
+
+    /**
+     * @brief 访问指定键的优先级
+     *
+     * @param[in] key 元素键
+     * @return 指向优先级的指针，键不存在时返回 `nullptr`
+     */
+    inline const Tp *at(size_type key) const { return contains(key) ? &_c[_pos[key]].value : nullptr; }
+
+    //! 堆是否为空
+    inline bool empty() const { return _c.empty(); }
+    //! 堆的大小
+    inline size_type size() const { return _c.size(); }
+    //! 获取堆顶元素的优先级
+    inline const Tp &top() const { return _c.front().value; }
+    //! 获取堆顶元素的键
+    inline size_type topKey() const { return _c.front().key; }
+
+private:
+    //! 堆节点
+    struct Node
+    {
+        Tp value;     //!< 优先级
+        uint32_t key; //!< 元素键
+    };
+
+    static constexpr uint32_t NPOS = std::numeric_limits<uint32_t>::max(); //!< 无效下标
+
+    //! 从给定的节点开始往上生成堆，空洞方式移动，每轮一次赋值
+    void upHeapify(uint32_t idx)
+    {
+        Node node = std::move(_c[idx]);
+        while (idx != 0)
+        {
+            uint32_t parent = (idx - 1) / 4;
+            if (!_comp(_c[parent].value, node.value))
+                break;
+            _c[idx] = std::move(_c[parent]);
+            _pos[_c[idx].key] = idx;
+            idx = parent;
+        }
+        _c[idx] = std::move(node);
+        _pos[_c[idx].key] = idx;
+    }
+
+    //! 从给定的节点开始往下生成堆，一轮的 4 个子节点位于相邻内存
+    void downHeapify(uint32_t idx)
+    {
+        Node node = std::move(_c[idx]);
+        uint32_t n = static_cast<uint32_t>(_c.size());
+        for (;;)
+        {
+            uint32_t first = 4 * idx + 1;
+            if (first >= n)
+                break;
+            uint32_t last = first + 4 < n ? first + 4 : n;
+            uint32_t better = first;
+            for (uint32_t i = first + 1; i < last; ++i)
+                if (_comp(_c[better].value, _c[i].value))
+                    better = i;
+            if (!_comp(node.value, _c[better].value))
+                break;
+            _c[idx] = std::move(_c[better]);
+            _pos[_c[idx].key] = idx;
+            idx = better;
+        }
+        _c[idx] = std::move(node);
+        _pos[_c[idx].key] = idx;
+    }
+
+    std::vector<Node> _c;       //!< 元素数组，节点 `i` 的子节点为 `4i+1` 至 `4i+4`
+    std::vector<uint32_t> _pos; //!< 键到元素数组下标的稠密映射
+    Compare _comp;              //!< 可调用对象
+};
+
 /**
  * @brief 并查集
  *
@@ -311,6 +518,1071 @@ private:
     int _connected_component{};                    //!< 连通分量
 };
 
+/**
+ * @brief 稠密索引并查集
+ * @brief
+ * - 元素为 \f$[0, n)\f$ 的连续整数索引，父节点与秩存放在连续数组中，查找使用路径减半，
+ *   合并使用按秩合并，单次操作近似常数
+ * @brief
+ * - 相比基于哈希表的 `UnionFind`，免去了元素哈希与节点分配的开销，适用于分块轮廓合并、
+ *   装甲板同组匹配等以下标标识元素的高频合并场合
+ */
+class DenseUnionFind
+{
+public:
+    /**
+     * @brief 构造稠密索引并查集
+     *
+     * @param[in] n 元素个数，每个元素初始时自成一个集合
+     */
+    explicit DenseUnionFind(std::size_t n) : _parent(n), _rank(n), _components(n)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            _parent[i] = i;
+    }
+
+    //! 寻找代表元素（路径减半）
+    std::size_t find(std::size_t idx)
+    {
+        while (_parent[idx] != idx)
+        {
+            _parent[idx] = _parent[_parent[idx]];
+            idx = _parent[idx];
+        }
+        return idx;
+    }
+
+    /**
+     * @brief 两个元素是否在同一个集合
+     *
+     * @param[in] idx_a 元素 A 的索引
+     * @param[in] idx_b 元素 B 的索引
+     * @return 是否在同一个集合
+     */
+    bool connected(std::size_t idx_a, std::size_t idx_b) { return find(idx_a) == find(idx_b); }
+
+    /**
+     * @brief 将两个元素所在集合合并（按秩合并）
+     *
+     * @param[in] idx_a 元素 A 的索引
+     * @param[in] idx_b 元素 B 的索引
+     * @return 是否发生合并，两元素已在同一集合时返回 `false`
+     */
+    bool merge(std::size_t idx_a, std::size_t idx_b)
+    {
+        idx_a = find(idx_a), idx_b = find(idx_b);
+        if (idx_a == idx_b)
+            return false;
+        if (_rank[idx_a] < _rank[idx_b])
+            std::swap(idx_a, idx_b);
+        _parent[idx_b] = idx_a;
+        if (_rank[idx_a] == _rank[idx_b])
+            ++_rank[idx_a];
+        --_components;
+        return true;
+    }
+
+    /**
+     * @brief 批量导出每个元素的连通分量标号
+     *
+     * @return 与元素一一对应的标号数组，标号取值 \f$[0,\texttt{components()})\f$，
+     *         按各集合首个元素的索引顺序编号
+     */
+    std::vector<std::size_t> labels()
+    {
+        constexpr std::size_t npos = static_cast<std::size_t>(-1);
+        std::vector<std::size_t> retval(_parent.size());
+        std::vector<std::size_t> rep_label(_parent.size(), npos);
+        std::size_t num{};
+        for (std::size_t i = 0; i < _parent.size(); ++i)
+        {
+            auto &label = rep_label[find(i)];
+            if (label == npos)
+                label = num++;
+            retval[i] = label;
+        }
+        return retval;
+    }
+
+    /**
+     * @brief 批量导出连通分量
+     *
+     * @return 连通分量列表，每个连通分量为其元素索引组成的升序数组
+     */
+    std::vector<std::vector<std::size_t>> extract()
+    {
+        auto lbls = labels();
+        std::vector<std::size_t> counts(_components);
+        for (auto label : lbls)
+            ++counts[label];
+        std::vector<std::vector<std::size_t>> datas(_components);
+        for (std::size_t i = 0; i < _components; ++i)
+            datas[i].reserve(counts[i]);
+        for (std::size_t i = 0; i < lbls.size(); ++i)
+            datas[lbls[i]].push_back(i);
+        return datas;
+    }
+
+    //! 获取元素个数
+    std::size_t size() const { return _parent.size(); }
+    //! 获取连通分量个数
+    std::size_t components() const { return _components; }
+
+private:
+    std::vector<std::size_t> _parent; //!< 父节点索引
+    std::vector<uint8_t> _rank;       //!< 集合的秩
+    std::size_t _components{};        //!< 连通分量个数
+};
+
+/**
+ * @brief 连续存储的信号容器
+ * @brief
+ * - 元素存放在一整块连续内存中，短信号（不超过 16 个元素）使用栈上的内置缓冲区，避免堆分配
+ * @brief
+ * - push 操作具备环形缓冲区语义：容量未满时在尾部追加，容量已满时覆盖最早的元素，
+ *   适合滑动窗口场合下以固定容量反复推入新样本
+ *
+ * @tparam Tp 元素类型，需可平凡复制
+ */
+template <typename Tp>
+class Signal
+{
+    static_assert(std::is_trivially_copyable_v<Tp>, "value_type must be trivially copyable");
+
+    //! 内置缓冲区可容纳的元素个数
+    static constexpr std::size_t SBO_SIZE = 16;
+
+public:
+    typedef Tp value_type;
+    typedef Tp &reference;
+    typedef const Tp &const_reference;
+    typedef std::size_t size_type;
+
+    //! 随机访问迭代器，按逻辑下标访问，自动处理环形回绕
+    template <bool Const>
+    class basic_iterator
+    {
+        using signal_pointer = std::conditional_t<Const, const Signal *, Signal *>;
+
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef Tp value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef std::conditional_t<Const, const Tp *, Tp *> pointer;
+        typedef std::conditional_t<Const, const Tp &, Tp &> reference;
+
+        basic_iterator() = default;
+        basic_iterator(signal_pointer sig, size_type idx) : _sig(sig), _idx(idx) {}
+        //! 非 const 迭代器到 const 迭代器的隐式转换
+        operator basic_iterator<true>() const { return {_sig, _idx}; }
+
+        reference operator*() const { return (*_sig)[_idx]; }
+        pointer operator->() const { return &(*_sig)[_idx]; }
+        reference operator[](difference_type n) const { return (*_sig)[_idx + n]; }
+
+        basic_iterator &operator++() { return ++_idx, *this; }
+        basic_iterator operator++(int) { auto retval = *this; return ++_idx, retval; }
+        basic_iterator &operator--() { return --_idx, *this; }
+        basic_iterator operator--(int) { auto retval = *this; return --_idx, retval; }
+        basic_iterator &operator+=(difference_type n) { return _idx += n, *this; }
+        basic_iterator &operator-=(difference_type n) { return _idx -= n, *this; }
+        basic_iterator operator+(difference_type n) const { return {_sig, _idx + n}; }
+        basic_iterator operator-(difference_type n) const { return {_sig, _idx - n}; }
+        difference_type operator-(const basic_iterator &rhs) const { return static_cast<difference_type>(_idx) - static_cast<difference_type>(rhs._idx); }
+
+        bool operator==(const basic_iterator &rhs) const { return _idx == rhs._idx; }
+        bool operator!=(const basic_iterator &rhs) const { return _idx != rhs._idx; }
+        bool operator<(const basic_iterator &rhs) const { return _idx < rhs._idx; }
+        bool operator>(const basic_iterator &rhs) const { return _idx > rhs._idx; }
+        bool operator<=(const basic_iterator &rhs) const { return _idx <= rhs._idx; }
+        bool operator>=(const basic_iterator &rhs) const { return _idx >= rhs._idx; }
+
+    private:
+        signal_pointer _sig{}; //!< 所属信号容器
+        size_type _idx{};      //!< 逻辑下标
+    };
+
+    typedef basic_iterator<false> iterator;
+    typedef basic_iterator<true> const_iterator;
+
+    Signal() = default;
+
+    /**
+     * @brief 创建指定长度的信号容器，元素值初始化
+     *
+     * @param[in] n 信号长度
+     */
+    explicit Signal(size_type n) { resize(n); }
+
+    /**
+     * @brief 创建指定长度的信号容器，元素初始化为指定值
+     *
+     * @param[in] n 信号长度
+     * @param[in] val 元素初始值
+     */
+    Signal(size_type n, const Tp &val)
+    {
+        reserve(n);
+        for (size_type i = 0; i < n; ++i)
+            _data[i] = val;
+        _size = n;
+    }
+
+    /**
+     * @brief 从迭代器区间创建信号容器
+     *
+     * @tparam InputIterator 老式输入迭代器类型
+     * @param[in] first 起始迭代器
+     * @param[in] last 终止迭代器
+     */
+    template <typename InputIterator, typename = typename std::iterator_traits<InputIterator>::iterator_category>
+    Signal(InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    //! 从初始化列表创建信号容器
+    Signal(std::initializer_list<Tp> ils) : Signal(ils.begin(), ils.end()) {}
+
+    Signal(const Signal &sig) { assign(sig); }
+    Signal(Signal &&sig) noexcept { swap(sig); }
+    Signal &operator=(const Signal &sig) { return assign(sig), *this; }
+    Signal &operator=(Signal &&sig) noexcept { return swap(sig), *this; }
+
+    ~Signal()
+    {
+        if (_data != reinterpret_cast<Tp *>(_sbo))
+            delete[] _data;
+    }
+
+    //! 信号长度
+    inline size_type size() const { return _size; }
+    //! 信号是否为空
+    inline bool empty() const { return _size == 0; }
+    //! 不重新分配内存时可容纳的元素个数
+    inline size_type capacity() const { return _cap; }
+
+    //! 访问指定下标的元素
+    inline reference operator[](size_type i) { return _data[offset(i)]; }
+    //! 访问指定下标的元素
+    inline const_reference operator[](size_type i) const { return _data[offset(i)]; }
+    //! 访问第一个元素
+    inline reference front() { return (*this)[0]; }
+    //! 访问第一个元素
+    inline const_reference front() const { return (*this)[0]; }
+    //! 访问最后一个元素
+    inline reference back() { return (*this)[_size - 1]; }
+    //! 访问最后一个元素
+    inline const_reference back() const { return (*this)[_size - 1]; }
+
+    inline iterator begin() { return {this, 0}; }
+    inline const_iterator begin() const { return {this, 0}; }
+    inline iterator end() { return {this, _size}; }
+    inline const_iterator end() const { return {this, _size}; }
+    inline const_iterator cbegin() const { return begin(); }
+    inline const_iterator cend() const { return end(); }
+
+    /**
+     * @brief 预留存储空间，并将元素整理为从头部起连续排布
+     *
+     * @param[in] n 可容纳的元素个数
+     */
+    void reserve(size_type n)
+    {
+        if (n <= _cap && _head == 0)
+            return;
+        size_type new_cap = _cap;
+        while (new_cap < n)
+            new_cap <<= 1;
+        Tp *new_data = new_cap <= SBO_SIZE ? reinterpret_cast<Tp *>(_sbo) : new Tp[new_cap];
+        if (new_data == _data)
+        {
+            // 存储未迁移，原地旋转即可线性化
+            std::rotate(_data, _data + _head, _data + _cap);
+        }
+        else
+        {
+            // 按逻辑顺序线性化，最多两段连续内存
+            if (_size != 0)
+            {
+                size_type first_part = std::min(_size, _cap - _head);
+                std::memcpy(new_data, _data + _head, first_part * sizeof(Tp));
+                std::memcpy(new_data + first_part, _data, (_size - first_part) * sizeof(Tp));
+            }
+            if (_data != reinterpret_cast<Tp *>(_sbo))
+                delete[] _data;
+        }
+        _data = new_data, _cap = new_cap, _head = 0;
+    }
+
+    /**
+     * @brief 修改信号长度，新增元素值初始化
+     *
+     * @param[in] n 信号长度
+     */
+    void resize(size_type n)
+    {
+        reserve(n);
+        for (size_type i = _size; i < n; ++i)
+            _data[i] = Tp{};
+        _size = n;
+    }
+
+    /**
+     * @brief 在尾部追加元素，容量不足时重新分配内存
+     *
+     * @param[in] x 待追加的元素
+     */
+    inline void push_back(const Tp &x)
+    {
+        if (_size == _cap)
+            reserve(_cap << 1);
+        _data[offset(_size)] = x;
+        ++_size;
+    }
+
+    /**
+     * @brief 以环形缓冲区语义推入元素
+     * @brief
+     * - 容量未满时在尾部追加，容量已满时覆盖最早的元素，信号长度保持不变，不分配内存
+     *
+     * @param[in] x 待推入的元素
+     */
+    inline void push(const Tp &x)
+    {
+        if (_size < _cap)
+        {
+            _data[offset(_size)] = x;
+            ++_size;
+        }
+        else
+        {
+            _data[_head] = x;
+            _head = _head + 1 == _cap ? 0 : _head + 1;
+        }
+    }
+
+    //! 弹出第一个元素
+    inline void pop_front()
+    {
+        _head = _head + 1 == _cap ? 0 : _head + 1;
+        --_size;
+    }
+
+    //! 弹出最后一个元素
+    inline void pop_back() { --_size; }
+
+    //! 清空信号容器，不释放内存
+    inline void clear() { _size = 0, _head = 0; }
+
+    /**
+     * @brief 获取连续存储的首地址
+     * @note 若环形推入导致元素在物理上分为两段，会先整理为连续排布
+     *
+     * @return 指向第一个元素的指针
+     */
+    inline Tp *data() { return reserve(_cap), _data; }
+
+    //! 与另一个信号容器交换内容
+    void swap(Signal &sig) noexcept
+    {
+        // 内置缓冲区无法交换指针，逐字节交换内容
+        std::swap_ranges(_sbo, _sbo + sizeof(_sbo), sig._sbo);
+        Tp *tmp_this = _data == reinterpret_cast<Tp *>(_sbo) ? sig.sbo_ptr() : _data;
+        Tp *tmp_sig = sig._data == reinterpret_cast<Tp *>(sig._sbo) ? sbo_ptr() : sig._data;
+        _data = tmp_sig, sig._data = tmp_this;
+        std::swap(_size, sig._size);
+        std::swap(_cap, sig._cap);
+        std::swap(_head, sig._head);
+    }
+
+private:
+    //! 逻辑下标到物理下标的映射
+    inline size_type offset(size_type i) const
+    {
+        size_type j = _head + i;
+        return j < _cap ? j : j - _cap;
+    }
+
+    //! 内置缓冲区首地址
+    inline Tp *sbo_ptr() { return reinterpret_cast<Tp *>(_sbo); }
+
+    //! 复制另一个信号容器的内容
+    void assign(const Signal &sig)
+    {
+        if (this == &sig)
+            return;
+        clear();
+        reserve(sig._size);
+        for (size_type i = 0; i < sig._size; ++i)
+            _data[i] = sig[i];
+        _size = sig._size;
+    }
+
+    alignas(Tp) unsigned char _sbo[SBO_SIZE * sizeof(Tp)]{}; //!< 内置缓冲区
+
+    Tp *_data{reinterpret_cast<Tp *>(_sbo)}; //!< 元素存储首地址
+    size_type _size{};                       //!< 信号长度
+    size_type _cap{SBO_SIZE};                //!< 可容纳的元素个数
+    size_type _head{};                       //!< 第一个元素的物理下标
+};
+
+/**
+ * @brief 定容环形缓冲区
+ * @brief
+ * - 提供与 `std::deque` 一致的 `push_front`、`push_back`、`at` 等访问接口，逻辑下标 `0`
+ *   对应队首，元素存放在定长数组中，进出队仅为下标运算，不发生节点分配与释放
+ * @brief
+ * - 容量已满时继续入队会覆盖另一端最早的元素，被覆盖、弹出的槽位会重置为 `Tp{}`
+ *   以及时释放资源，适合追踪器逐帧维护的历史队列等滑动窗口场合
+ *
+ * @tparam Tp 元素类型
+ * @tparam N 容量
+ */
+template <typename Tp, std::size_t N>
+class RingBuffer
+{
+    static_assert(N > 0, "capacity of \"rm::RingBuffer\" must greater than 0");
+
+public:
+    typedef Tp value_type;
+    typedef Tp &reference;
+    typedef const Tp &const_reference;
+    typedef std::size_t size_type;
+
+    //! 按队首到队尾逻辑顺序遍历的迭代器
+    template <bool Const>
+    class Iterator
+    {
+        using buffer_type = std::conditional_t<Const, const RingBuffer, RingBuffer>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Tp;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const Tp *, Tp *>;
+        using reference = std::conditional_t<Const, const Tp &, Tp &>;
+
+        Iterator(buffer_type *buf, size_type idx) : _buf(buf), _idx(idx) {}
+        reference operator*() const { return (*_buf)[_idx]; }
+        pointer operator->() const { return &(*_buf)[_idx]; }
+        Iterator &operator++() { return ++_idx, *this; }
+        Iterator operator++(int) { auto tmp = *this; return ++_idx, tmp; }
+        Iterator &operator--() { return --_idx, *this; }
+        Iterator operator--(int) { auto tmp = *this; return --_idx, tmp; }
+        bool operator==(const Iterator &rhs) const { return _idx == rhs._idx; }
+        bool operator!=(const Iterator &rhs) const { return _idx != rhs._idx; }
+
+    private:
+        buffer_type *_buf{}; //!< 所属环形缓冲区
+        size_type _idx{};    //!< 逻辑下标
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    RingBuffer() = default;
+
+    //! 使用初始元素列表构造，按从队首到队尾的顺序排列
+    RingBuffer(std::initializer_list<Tp> il)
+    {
+        for (const auto &x : il)
+            push_back(x);
+    }
+
+    //! 元素个数
+    inline size_type size() const { return _size; }
+    //! 容量
+    constexpr size_type capacity() const { return N; }
+    //! 缓冲区是否为空
+    inline bool empty() const { return _size == 0; }
+    //! 缓冲区是否已满
+    inline bool full() const { return _size == N; }
+
+    /**
+     * @brief 在队首添加元素，容量已满时覆盖队尾元素
+     *
+     * @param[in] x 待添加的元素
+     */
+    inline void push_front(const Tp &x) { emplace_front(x); }
+
+    /**
+     * @brief 在队首构造元素，容量已满时覆盖队尾元素
+     *
+     * @param[in] args 元素构造参数
+     */
+    template <typename... Args>
+    inline void emplace_front(Args &&...args)
+    {
+        if (_size == N)
+            pop_back();
+        _head = (_head + N - 1) % N;
+        _data[_head] = Tp(std::forward<Args>(args)...);
+        ++_size;
+    }
+
+    /**
+     * @brief 在队尾添加元素，容量已满时覆盖队首元素
+     *
+     * @param[in] x 待添加的元素
+     */
+    inline void push_back(const Tp &x) { emplace_back(x); }
+
+    /**
+     * @brief 在队尾构造元素，容量已满时覆盖队首元素
+     *
+     * @param[in] args 元素构造参数
+     */
+    template <typename... Args>
+    inline void emplace_back(Args &&...args)
+    {
+        if (_size == N)
+            pop_front();
+        _data[(_head + _size) % N] = Tp(std::forward<Args>(args)...);
+        ++_size;
+    }
+
+    //! 弹出队首元素
+    inline void pop_front()
+    {
+        _data[_head] = Tp{};
+        _head = (_head + 1) % N;
+        --_size;
+    }
+
+    //! 弹出队尾元素
+    inline void pop_back()
+    {
+        _data[(_head + _size - 1) % N] = Tp{};
+        --_size;
+    }
+
+    //! 清空缓冲区
+    inline void clear()
+    {
+        for (size_type i = 0; i < _size; ++i)
+            _data[(_head + i) % N] = Tp{};
+        _head = 0, _size = 0;
+    }
+
+    //! 队首元素
+    inline reference front() { return _data[_head]; }
+    //! 队首元素
+    inline const_reference front() const { return _data[_head]; }
+    //! 队尾元素
+    inline reference back() { return _data[(_head + _size - 1) % N]; }
+    //! 队尾元素
+    inline const_reference back() const { return _data[(_head + _size - 1) % N]; }
+
+    //! 访问指定逻辑下标的元素
+    inline reference operator[](size_type idx) { return _data[(_head + idx) % N]; }
+    //! 访问指定逻辑下标的元素
+    inline const_reference operator[](size_type idx) const { return _data[(_head + idx) % N]; }
+
+    /**
+     * @brief 访问指定逻辑下标的元素，带下标越界检查
+     *
+     * @param[in] idx 逻辑下标
+     * @return 对应元素
+     */
+    inline reference at(size_type idx)
+    {
+        if (idx >= _size)
+            throw std::out_of_range("rm::RingBuffer::at");
+        return (*this)[idx];
+    }
+
+    /**
+     * @brief 访问指定逻辑下标的元素，带下标越界检查
+     *
+     * @param[in] idx 逻辑下标
+     * @return 对应元素
+     */
+    inline const_reference at(size_type idx) const
+    {
+        if (idx >= _size)
+            throw std::out_of_range("rm::RingBuffer::at");
+        return (*this)[idx];
+    }
+
+    //! 队首迭代器
+    inline iterator begin() { return {this, 0}; }
+    //! 队尾迭代器
+    inline iterator end() { return {this, _size}; }
+    //! 队首迭代器
+    inline const_iterator begin() const { return {this, 0}; }
+    //! 队尾迭代器
+    inline const_iterator end() const { return {this, _size}; }
+    //! 队首迭代器
+    inline const_iterator cbegin() const { return begin(); }
+    //! 队尾迭代器
+    inline const_iterator cend() const { return end(); }
+
+private:
+    std::array<Tp, N> _data{}; //!< 元素存储
+    size_type _head{};         //!< 队首元素的物理下标
+    size_type _size{};         //!< 元素个数
+};
+
+/**
+ * @brief 低维最近邻查询的 KD 树
+ * @brief
+ * - 面向特征关联等小规模低维场合：`build` 以中位数切分构建平衡树，节点连续存储，
+ *   `nearest` 单次查询均摊 \f$O(\log n)\f$，将逐对距离扫描的 \f$O(nm)\f$ 关联
+ *   降低至 \f$O(n\log m)\f$
+ * @brief
+ * - `nearest` 可附带过滤器跳过已匹配的点，剪枝仅基于已接受的最优解，过滤不影响
+ *   查询结果的正确性
+ *
+ * @tparam Dim 维数
+ */
+template <std::size_t Dim>
+class KDTree
+{
+    static_assert(Dim > 0, "dimension of \"rm::KDTree\" must greater than 0");
+
+public:
+    typedef std::array<float, Dim> point_type;
+    typedef std::size_t size_type;
+
+    //! 无效下标
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    KDTree() = default;
+
+    //! 使用点集构造 KD 树
+    explicit KDTree(const std::vector<point_type> &points) { build(points); }
+
+    /**
+     * @brief 构建 KD 树，之前的内容被清空
+     *
+     * @param[in] points 点集，`nearest` 返回的下标与该点集对应
+     */
+    void build(const std::vector<point_type> &points)
+    {
+        _nodes.clear();
+        _nodes.reserve(points.size());
+        std::vector<size_type> idxs(points.size());
+        std::iota(idxs.begin(), idxs.end(), size_type{});
+        _root = buildImpl(points, idxs.begin(), idxs.end(), 0);
+    }
+
+    //! 点的个数
+    inline size_type size() const { return _nodes.size(); }
+    //! KD 树是否为空
+    inline bool empty() const { return _nodes.empty(); }
+
+    /**
+     * @brief 查询距离指定点最近的点
+     *
+     * @param[in] query 查询点
+     * @return 最近点在构建点集中的下标，树为空时返回 `npos`
+     */
+    inline size_type nearest(const point_type &query) const
+    {
+        return nearest(query, [](size_type) { return true; });
+    }
+
+    /**
+     * @brief 查询距离指定点最近且满足过滤器的点
+     *
+     * @tparam Filter 过滤器可调用对象类型
+     * @param[in] query 查询点
+     * @param[in] filter 过滤器，传入构建点集中的下标，返回 `false` 的点不参与匹配
+     * @return 最近点在构建点集中的下标，无满足过滤器的点时返回 `npos`
+     */
+    template <typename Filter>
+    size_type nearest(const point_type &query, Filter filter) const
+    {
+        size_type best{npos};
+        float best_d2{std::numeric_limits<float>::max()};
+        searchImpl(_root, query, 0, filter, best, best_d2);
+        return best;
+    }
+
+private:
+    //! KD 树节点
+    struct Node
+    {
+        point_type pt;     //!< 坐标
+        size_type idx;     //!< 构建点集中的下标
+        int32_t left{-1};  //!< 左子树节点下标
+        int32_t right{-1}; //!< 右子树节点下标
+    };
+
+    //! 递归构建指定下标区间的子树，返回子树根节点下标
+    template <typename Iterator>
+    int32_t buildImpl(const std::vector<point_type> &points, Iterator first, Iterator last, std::size_t depth)
+    {
+        if (first == last)
+            return -1;
+        std::size_t axis = depth % Dim;
+        Iterator mid = first + (last - first) / 2;
+        std::nth_element(first, mid, last, [&](size_type lhs, size_type rhs) { return points[lhs][axis] < points[rhs][axis]; });
+        auto retval = static_cast<int32_t>(_nodes.size());
+        _nodes.push_back({points[*mid], *mid, -1, -1});
+        int32_t left = buildImpl(points, first, mid, depth + 1);
+        int32_t right = buildImpl(points, mid + 1, last, depth + 1);
+        _nodes[retval].left = left, _nodes[retval].right = right;
+        return retval;
+    }
+
+    //! 递归查询指定子树，`best_d2` 为当前最优解的距离平方
+    template <typename Filter>
+    void searchImpl(int32_t node, const point_type &query, std::size_t depth, Filter &filter, size_type &best, float &best_d2) const
+    {
+        if (node < 0)
+            return;
+        const Node &cur = _nodes[node];
+        if (filter(cur.idx))
+        {
+            float d2{};
+            for (std::size_t i = 0; i < Dim; ++i)
+                d2 += (cur.pt[i] - query[i]) * (cur.pt[i] - query[i]);
+            if (d2 < best_d2)
+                best_d2 = d2, best = cur.idx;
+        }
+        std::size_t axis = depth % Dim;
+        float diff = query[axis] - cur.pt[axis];
+        int32_t near = diff < 0 ? cur.left : cur.right;
+        int32_t far = diff < 0 ? cur.right : cur.left;
+        searchImpl(near, query, depth + 1, filter, best, best_d2);
+        // 以切分超平面的距离剪枝另一侧子树
+        if (diff * diff < best_d2)
+            searchImpl(far, query, depth + 1, filter, best, best_d2);
+    }
+
+    std::vector<Node> _nodes; //!< 连续存储的节点
+    int32_t _root{-1};        //!< 根节点下标
+};
+
+/**
+ * @brief 带代数校验的槽位映射（slot map）
+ * @brief
+ * - 面向追踪器池等增删频繁的对象池场合：`insert` 优先复用空闲链表中的槽位，返回由槽位
+ *   下标与代数组成的稳定键，增删不会使其余元素的键失效，也不发生元素搬移
+ * @brief
+ * - `erase` 为逻辑删除：槽位元素重置为 `Tp{}` 以及时释放资源，代数自增后槽位进入空闲
+ *   链表等待复用，指向该槽位的旧键因代数不匹配而失效，`at` 返回 `nullptr`，不会误指向
+ *   复用后的新元素
+ *
+ * @tparam Tp 元素类型
+ */
+template <typename Tp>
+class SlotMap
+{
+public:
+    typedef Tp value_type;
+    typedef std::size_t size_type;
+
+    //! 槽位键，由槽位下标与代数组成
+    struct key_type
+    {
+        uint32_t index{};      //!< 槽位下标
+        uint32_t generation{}; //!< 代数
+        bool operator==(const key_type &rhs) const { return index == rhs.index && generation == rhs.generation; }
+        bool operator!=(const key_type &rhs) const { return !(*this == rhs); }
+    };
+
+    //! 按槽位下标顺序遍历存活元素的迭代器
+    template <bool Const>
+    class Iterator
+    {
+        using map_type = std::conditional_t<Const, const SlotMap, SlotMap>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Tp;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const Tp *, Tp *>;
+        using reference = std::conditional_t<Const, const Tp &, Tp &>;
+
+        Iterator(map_type *map, size_type idx) : _map(map), _idx(idx) { skipDead(); }
+        reference operator*() const { return _map->_slots[_idx].value; }
+        pointer operator->() const { return &_map->_slots[_idx].value; }
+        Iterator &operator++() { return ++_idx, skipDead(), *this; }
+        Iterator operator++(int) { auto tmp = *this; return ++*this, tmp; }
+        bool operator==(const Iterator &rhs) const { return _idx == rhs._idx; }
+        bool operator!=(const Iterator &rhs) const { return _idx != rhs._idx; }
+
+    private:
+        //! 跳过已删除的槽位
+        inline void skipDead()
+        {
+            while (_idx < _map->_slots.size() && !_map->_slots[_idx].alive)
+                ++_idx;
+        }
+
+        map_type *_map{}; //!< 所属槽位映射
+        size_type _idx{}; //!< 槽位下标
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    SlotMap() = default;
+
+    //! 存活元素个数
+    inline size_type size() const { return _size; }
+    //! 槽位映射是否为空
+    inline bool empty() const { return _size == 0; }
+    //! 预分配指定个数的槽位
+    inline void reserve(size_type n) { _slots.reserve(n); }
+
+    /**
+     * @brief 添加元素，优先复用空闲链表中的槽位
+     *
+     * @param[in] x 待添加的元素
+     * @return 指向该元素的稳定键
+     */
+    inline key_type insert(const Tp &x) { return emplace(x); }
+
+    /**
+     * @brief 原位构造元素，优先复用空闲链表中的槽位
+     *
+     * @param[in] args 元素构造参数
+     * @return 指向该元素的稳定键
+     */
+    template <typename... Args>
+    key_type emplace(Args &&...args)
+    {
+        uint32_t idx{};
+        if (_free.empty())
+        {
+            idx = static_cast<uint32_t>(_slots.size());
+            _slots.emplace_back();
+        }
+        else
+        {
+            idx = _free.back();
+            _free.pop_back();
+        }
+        auto &slot = _slots[idx];
+        slot.value = Tp(std::forward<Args>(args)...);
+        slot.alive = true;
+        ++_size;
+        return {idx, slot.generation};
+    }
+
+    /**
+     * @brief 逻辑删除指定键对应的元素，其余元素不发生搬移，键均保持有效
+     *
+     * @param[in] key 待删除元素的键
+     * @return 是否删除成功，键已失效时返回 `false`
+     */
+    bool erase(key_type key)
+    {
+        if (!contains(key))
+            return false;
+        auto &slot = _slots[key.index];
+        // 重置槽位元素以及时释放资源，代数自增使指向该槽位的旧键失效
+        slot.value = Tp{};
+        slot.alive = false;
+        ++slot.generation;
+        _free.push_back(key.index);
+        --_size;
+        return true;
+    }
+
+    /**
+     * @brief 判断指定键是否指向存活元素
+     *
+     * @param[in] key 待判断的键
+     * @return 键是否有效
+     */
+    inline bool contains(key_type key) const
+    {
+        return key.index < _slots.size() && _slots[key.index].alive && _slots[key.index].generation == key.generation;
+    }
+
+    /**
+     * @brief 访问指定键对应的元素
+     *
+     * @param[in] key 元素的键
+     * @return 指向元素的指针，键已失效时返回 `nullptr`
+     */
+    inline Tp *at(key_type key) { return contains(key) ? &_slots[key.index].value : nullptr; }
+
+    /**
+     * @brief 访问指定键对应的元素
+     *
+     * @param[in] key 元素的键
+     * @return 指向元素的指针，键已失效时返回 `nullptr`
+     */
+    inline const Tp *at(key_type key) const { return contains(key) ? &_slots[key.index].value : nullptr; }
+
+    //! 清空所有元素，全部槽位代数自增后重新可用
+    void clear()
+    {
+        _free.clear();
+        _free.reserve(_slots.size());
+        for (size_type i = _slots.size(); i > 0; --i)
+        {
+            auto &slot = _slots[i - 1];
+            if (slot.alive)
+                slot.value = Tp{}, slot.alive = false, ++slot.generation;
+            _free.push_back(static_cast<uint32_t>(i - 1));
+        }
+        _size = 0;
+    }
+
+    //! 首个存活元素的迭代器
+    inline iterator begin() { return {this, 0}; }
+    //! 尾后迭代器
+    inline iterator end() { return {this, _slots.size()}; }
+    //! 首个存活元素的迭代器
+    inline const_iterator begin() const { return {this, 0}; }
+    //! 尾后迭代器
+    inline const_iterator end() const { return {this, _slots.size()}; }
+
+private:
+    //! 槽位
+    struct Slot
+    {
+        Tp value{};             //!< 元素
+        uint32_t generation{};  //!< 代数
+        bool alive{};           //!< 是否存活
+    };
+
+    std::vector<Slot> _slots;   //!< 槽位存储
+    std::vector<uint32_t> _free; //!< 空闲槽位下标栈
+    size_type _size{};          //!< 存活元素个数
+};
+
+/**
+ * @brief 以整数实体编号为键的稀疏集合（sparse set）
+ * @brief
+ * - 实体-组件（ECS）式存储的基本构件：实体仅为整数编号，组件紧凑存放于连续数组，
+ *   逐帧批处理遍历组件数组时顺序访问内存，避免指针图遍历的缓存缺失
+ * @brief
+ * - `erase` 将末尾组件搬移至被删槽位，连续数组不留空洞，因此不保证组件的遍历顺序；
+ *   实体编号到组件下标的映射由稠密的辅助数组维护，增删查均为 \f$O(1)\f$
+ *
+ * @tparam Tp 组件类型
+ */
+template <typename Tp>
+class SparseSet
+{
+public:
+    typedef Tp value_type;
+    typedef std::size_t size_type;
+
+    //! 无效组件下标
+    static constexpr uint32_t NPOS = std::numeric_limits<uint32_t>::max();
+
+    SparseSet() = default;
+
+    //! 组件个数
+    inline size_type size() const { return _data.size(); }
+    //! 集合是否为空
+    inline bool empty() const { return _data.empty(); }
+    //! 预分配指定个数组件的存储空间
+    inline void reserve(size_type n) { _data.reserve(n), _ents.reserve(n); }
+
+    /**
+     * @brief 添加或覆盖指定实体的组件
+     *
+     * @param[in] ent 实体编号
+     * @param[in] x 待添加的组件
+     */
+    void insert(uint32_t ent, const Tp &x)
+    {
+        if (ent >= _sparse.size())
+            _sparse.resize(ent + 1, NPOS);
+        if (_sparse[ent] != NPOS)
+        {
+            _data[_sparse[ent]] = x;
+            return;
+        }
+        _sparse[ent] = static_cast<uint32_t>(_data.size());
+        _data.push_back(x);
+        _ents.push_back(ent);
+    }
+
+    /**
+     * @brief 删除指定实体的组件，末尾组件搬移至被删槽位以保持连续
+     *
+     * @param[in] ent 实体编号
+     * @return 是否删除成功，实体不存在时返回 `false`
+     */
+    bool erase(uint32_t ent)
+    {
+        if (!contains(ent))
+            return false;
+        uint32_t idx = _sparse[ent];
+        uint32_t last_ent = _ents.back();
+        _data[idx] = std::move(_data.back());
+        _ents[idx] = last_ent;
+        _sparse[last_ent] = idx;
+        _data.pop_back();
+        _ents.pop_back();
+        _sparse[ent] = NPOS;
+        return true;
+    }
+
+    /**
+     * @brief 判断指定实体是否持有组件
+     *
+     * @param[in] ent 实体编号
+     * @return 实体是否持有组件
+     */
+    inline bool contains(uint32_t ent) const { return ent < _sparse.size() && _sparse[ent] != NPOS; }
+
+    /**
+     * @brief 访问指定实体的组件
+     *
+     * @param[in] ent 实体编号
+     * @return 组件的引用
+     */
+    inline Tp &at(uint32_t ent)
+    {
+        if (!contains(ent))
+            throw std::out_of_range("rm::SparseSet::at");
+        return _data[_sparse[ent]];
+    }
+
+    /**
+     * @brief 访问指定实体的组件
+     *
+     * @param[in] ent 实体编号
+     * @return 组件的引用
+     */
+    inline const Tp &at(uint32_t ent) const
+    {
+        if (!contains(ent))
+            throw std::out_of_range("rm::SparseSet::at");
+        return _data[_sparse[ent]];
+    }
+
+    //! 连续存储的组件数组，与 @ref entities() 下标一一对应
+    inline const std::vector<Tp> &components() const { return _data; }
+    //! 与组件数组下标一一对应的实体编号数组
+    inline const std::vector<uint32_t> &entities() const { return _ents; }
+
+    //! 清空所有组件
+    void clear()
+    {
+        _data.clear();
+        _ents.clear();
+        _sparse.clear();
+    }
+
+    //! 首个组件的迭代器
+    inline typename std::vector<Tp>::iterator begin() { return _data.begin(); }
+    //! 尾后迭代器
+    inline typename std::vector<Tp>::iterator end() { return _data.end(); }
+    //! 首个组件的迭代器
+    inline typename std::vector<Tp>::const_iterator begin() const { return _data.begin(); }
+    //! 尾后迭代器
+    inline typename std::vector<Tp>::const_iterator end() const { return _data.end(); }
+
+private:
+    std::vector<Tp> _data;        //!< 连续存储的组件
+    std::vector<uint32_t> _ents;  //!< 组件下标到实体编号的映射
+    std::vector<uint32_t> _sparse; //!< 实体编号到组件下标的映射
+};
+
 //! @} algorithm_datastruct
 
 } // namespace rm
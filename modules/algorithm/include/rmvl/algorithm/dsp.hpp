@@ -11,8 +11,9 @@
 
 #pragma once
 
-#include <deque>
 #include <complex>
+#include <memory>
+#include <vector>
 
 #ifdef HAVE_OPENCV
 #include <opencv2/core/mat.hpp>
@@ -20,6 +21,8 @@
 
 #include "rmvl/core/rmvldef.hpp"
 
+#include "datastruct.hpp"
+
 namespace rm
 {
 
@@ -35,9 +38,9 @@ namespace rm
 //! @{
 
 //! 实数信号
-using RealSignal = std::deque<double>;
+using RealSignal = Signal<double>;
 //! 复数信号
-using ComplexSignal = std::deque<std::complex<double>>;
+using ComplexSignal = Signal<std::complex<double>>;
 
 //! 信号谱类型
 enum class GxType
@@ -48,9 +51,62 @@ enum class GxType
     LogPower, //!< 对数功率谱
 };
 
+/**
+ * @brief 快速傅里叶变换计划
+ * @brief
+ * - 在构造时一次性完成旋转因子、位逆序表的计算并缓存，适合对同一长度的滑动窗口信号反复执行变换的场合
+ * @brief
+ * - 长度为 2 的幂时使用迭代的基-2 原位算法，其余长度使用 Bluestein 算法转化为 2 的幂长度的循环卷积
+ */
+class RMVL_EXPORTS_W FFT
+{
+public:
+    RMVL_W FFT() = default;
+
+    /**
+     * @brief 创建指定长度的快速傅里叶变换计划，缓存旋转因子
+     *
+     * @param[in] n 信号长度，无需为 2 的幂
+     */
+    RMVL_W explicit FFT(std::size_t n);
+
+    //! 变换计划对应的信号长度
+    RMVL_W inline std::size_t size() const { return _n; }
+
+    /**
+     * @brief 执行离散傅里叶变换
+     *
+     * @param[in] xt 时域复信号，长度需与变换计划一致
+     * @return 频域复信号
+     */
+    RMVL_W ComplexSignal forward(const ComplexSignal &xt) const;
+
+    /**
+     * @brief 执行离散傅里叶逆变换
+     *
+     * @param[in] Xf 频域复信号，长度需与变换计划一致
+     * @return 时域复信号
+     */
+    RMVL_W ComplexSignal inverse(const ComplexSignal &Xf) const;
+
+private:
+    //! 对连续存储的信号执行原位变换，`inv` 表示是否为逆变换
+    void transform(std::vector<std::complex<double>> &data, bool inv) const;
+    //! 基-2 原位蝶形运算，长度为 `data.size()`，需为 2 的幂
+    static void radix2(std::vector<std::complex<double>> &data, const std::vector<std::complex<double>> &w, const std::vector<std::size_t> &rev, bool inv);
+
+    std::size_t _n{};                            //!< 信号长度
+    std::size_t _m{};                            //!< 卷积长度（2 的幂），长度本身为 2 的幂时与 `_n` 一致
+    std::vector<std::complex<double>> _w;        //!< 旋转因子表 \f$w_k=e^{-2\pi ik/m}\f$
+    std::vector<std::size_t> _rev;               //!< 位逆序表
+    std::vector<std::complex<double>> _chirp;    //!< Bluestein 算法的 chirp 序列 \f$e^{-\pi ik^2/n}\f$
+    std::vector<std::complex<double>> _chirp_fm; //!< chirp 共轭序列的频域形式，计划创建时缓存
+};
+
 /**
  * @brief 计算离散傅里叶变换
- * 
+ * @note 内部使用线程局部的 rm::FFT 变换计划，信号长度不变时旋转因子可跨调用复用
+ *
  * @param[in] xt 时域复信号
  * @return 频域复信号
  */
@@ -58,7 +114,8 @@ RMVL_EXPORTS_W ComplexSignal dft(const ComplexSignal &xt);
 
 /**
  * @brief 计算离散傅里叶逆变换
- * 
+ * @note 内部使用线程局部的 rm::FFT 变换计划，信号长度不变时旋转因子可跨调用复用
+ *
  * @param[in] Xf 频域复信号
  * @return 时域复信号
  */
@@ -73,11 +130,284 @@ RMVL_EXPORTS_W ComplexSignal idft(const ComplexSignal &Xf);
  */
 RMVL_EXPORTS_W RealSignal Gx(const ComplexSignal &x, GxType type);
 
+/**
+ * @brief 计算两个实数信号的互相关
+ * @note
+ * - 通过快速傅里叶变换在频域计算 \f$r_{ab}[l]=\sum_na[n]b[n-l]\f$，复杂度为
+ *   \f$O(n\log n)\f$，内部使用线程局部的 rm::FFT 变换计划，信号长度不变时旋转因子可跨调用复用
+ * @note
+ * - 返回信号长度为 \f$N_a+N_b-1\f$，下标 \f$k\f$ 对应滞后 \f$l=k-(N_b-1)\f$，
+ *   即下标 \f$N_b-1\f$ 处为零滞后，峰值位置可用于估计两信号间的时间偏移
+ *
+ * @param[in] a 实数信号
+ * @param[in] b 实数信号
+ * @return 互相关信号
+ */
+RMVL_EXPORTS_W RealSignal xcorr(const RealSignal &a, const RealSignal &b);
+
+//! 窗函数类型
+enum class WindowType
+{
+    Rect,    //!< 矩形窗
+    Hann,    //!< 汉宁窗
+    Hamming, //!< 汉明窗
+};
+
+/**
+ * @brief 计算加窗分段平均的单边功率谱（Welch 法）
+ * @note
+ * - 信号按 `nfft` 长度分段，段间 50% 重叠，各段加窗后的周期图取平均，较单次全长变换
+ *   显著降低谱估计方差；内部使用线程局部的 rm::FFT 变换计划，`nfft` 不变时可跨调用复用
+ * @note
+ * - 谱值按窗函数增益校准，幅度为 \f$A\f$ 的正弦信号在对应频点处的谱值约为 \f$A^2/2\f$
+ *
+ * @param[in] x 实数信号，长度需不小于 `nfft`
+ * @param[in] nfft 分段长度，即变换点数
+ * @param[in] window 窗函数类型，默认汉宁窗
+ * @return 单边功率谱，长度为 `nfft / 2 + 1`，下标 \f$i\f$ 对应归一化频率 \f$i/\texttt{nfft}\f$
+ */
+RMVL_EXPORTS_W RealSignal psd(const RealSignal &x, std::size_t nfft, WindowType window = WindowType::Hann);
+
+/**
+ * @brief 计算实数信号在单一 DFT 频点处的频谱值（Goertzel 算法）
+ * @note 以二阶实系数递推计算单个频点，复杂度 \f$O(n)\f$ 且无需旋转因子表，目标频带已知、
+ *       仅需跟踪少数频点时比全长变换经济得多
+ *
+ * @param[in] x 实数信号
+ * @param[in] bin 频点序号 \f$k\f$，对应归一化频率 \f$k/N\f$（每样本周期数）
+ * @return 频点处的频谱值 \f$X[k]=\sum_nx[n]e^{-2\pi ikn/N}\f$
+ */
+RMVL_EXPORTS_W std::complex<double> goertzel(const RealSignal &x, std::size_t bin);
+
+/**
+ * @brief 滑动窗口单频点检测器
+ * @note
+ * - 维护长度为 \f$N\f$ 的滑动窗口在单一 DFT 频点处的频谱值，每个新样本仅需一次复数乘加，
+ *   单次更新复杂度 \f$O(1)\f$，适合在目标频带已知后连续跟踪正弦分量的幅值与相位，
+ *   代替逐帧的全长变换
+ * @note
+ * - 滑动递推的舍入误差会随样本数累积，检测器每滑动 \f$N\f$ 个样本利用窗口内样本重新
+ *   精确计算一次频谱值，均摊复杂度仍为 \f$O(1)\f$
+ */
+class RMVL_EXPORTS_W GoertzelDetector
+{
+public:
+    RMVL_W GoertzelDetector() = default;
+
+    /**
+     * @brief 创建滑动窗口单频点检测器
+     *
+     * @param[in] window 窗口长度 \f$N\f$（样本数）
+     * @param[in] bin 检测的频点序号 \f$k\f$，需满足 \f$k<N\f$，对应归一化频率 \f$k/N\f$（每样本周期数）
+     */
+    RMVL_W GoertzelDetector(std::size_t window, std::size_t bin);
+
+    /**
+     * @brief 推入新样本并更新频谱值
+     *
+     * @param[in] x 新样本
+     * @return 当前窗口在检测频点处的频谱值
+     */
+    RMVL_W std::complex<double> update(double x);
+
+    //! 当前窗口在检测频点处的频谱值
+    RMVL_W inline std::complex<double> get() const { return _s; }
+    //! 检测频点处正弦分量的幅值估计 \f$2|S|/N\f$，窗口未满时按已有样本数折算
+    RMVL_W double amp() const;
+    //! 检测频点处正弦分量在窗口最旧样本处的相位估计 \f$\arg S\f$
+    RMVL_W double phase() const;
+    //! 当前窗口内的样本数
+    RMVL_W inline std::size_t size() const { return _win.size(); }
+    //! 窗口长度
+    RMVL_W inline std::size_t window() const { return _window; }
+
+private:
+    std::size_t _window{};                //!< 窗口长度
+    std::size_t _slides{};                //!< 距上次精确重算的滑动次数
+    RealSignal _win;                      //!< 窗口样本
+    std::complex<double> _s{};            //!< 检测频点处的频谱值
+    std::complex<double> _w{};            //!< 滑动旋转因子 \f$e^{2\pi ik/N}\f$
+    std::vector<std::complex<double>> _e; //!< 频点系数表 \f$e^{-2\pi ikm/N}\f$
+};
+
+/**
+ * @brief 多相有理倍率重采样器
+ * @note
+ * - 以 \f$\frac{up}{down}\f$ 的有理倍率重采样，原型低通滤波器（汉宁窗 sinc）在构造时
+ *   一次性设计并缓存，重采样按多相分解仅计算输出样本实际用到的抽头，每个输出样本的
+ *   复杂度与倍率无关
+ * @note
+ * - 适合对固定倍率反复执行重采样的场合，如 1 kHz IMU 信号与 200 Hz 视觉信号的对齐
+ */
+class RMVL_EXPORTS_W Resampler
+{
+public:
+    //! 创建恒等重采样器（倍率 1:1）
+    RMVL_W Resampler() : Resampler(1, 1) {}
+
+    /**
+     * @brief 创建指定倍率的重采样器，设计并缓存原型低通滤波器
+     *
+     * @param[in] up 上采样倍数
+     * @param[in] down 下采样倍数
+     */
+    RMVL_W Resampler(std::size_t up, std::size_t down);
+
+    /**
+     * @brief 执行重采样
+     *
+     * @param[in] x 实数信号
+     * @return 重采样后的信号，长度为 \f$\lceil N\cdot\frac{up}{down}\rceil\f$，群延迟已补偿，
+     *         与原信号在时间上对齐
+     */
+    RMVL_W RealSignal resample(const RealSignal &x) const;
+
+    //! 约分后的上采样倍数
+    RMVL_W inline std::size_t up() const { return _up; }
+    //! 约分后的下采样倍数
+    RMVL_W inline std::size_t down() const { return _down; }
+
+private:
+    std::size_t _up{1};     //!< 上采样倍数
+    std::size_t _down{1};   //!< 下采样倍数
+    std::size_t _half{};    //!< 每相位的单侧抽头数
+    std::vector<double> _h; //!< 原型低通滤波器系数（上采样率下）
+};
+
+/**
+ * @brief 有理倍率重采样
+ * @note 内部使用线程局部的 rm::Resampler，倍率不变时原型滤波器可跨调用复用
+ *
+ * @param[in] x 实数信号
+ * @param[in] up 上采样倍数
+ * @param[in] down 下采样倍数
+ * @return 重采样后的信号 @see Resampler::resample
+ */
+RMVL_EXPORTS_W RealSignal resample(const RealSignal &x, std::size_t up, std::size_t down);
+
+/**
+ * @brief 滑动窗口均值滤波器
+ * @note 维护窗口内样本和，每次更新仅做一次加减法，单次更新复杂度 \f$O(1)\f$，
+ *       窗口未满时对已有样本取均值
+ */
+class RMVL_EXPORTS_W MovingAverage
+{
+public:
+    /**
+     * @brief 创建滑动窗口均值滤波器
+     *
+     * @param[in] window 窗口长度（样本数）
+     */
+    RMVL_W explicit MovingAverage(std::size_t window);
+
+    /**
+     * @brief 推入新样本并更新窗口均值
+     *
+     * @param[in] x 新样本
+     * @return 当前窗口均值
+     */
+    RMVL_W double update(double x);
+
+    //! 当前窗口均值，无样本时为 `0`
+    RMVL_W inline double get() const { return _win.empty() ? 0. : _sum / static_cast<double>(_win.size()); }
+
+    //! 当前窗口内的样本数
+    RMVL_W inline std::size_t size() const { return _win.size(); }
+
+private:
+    std::size_t _window{}; //!< 窗口长度
+    RealSignal _win;       //!< 窗口样本
+    double _sum{};         //!< 窗口内样本和
+};
+
+/**
+ * @brief 滑动窗口最值滤波器
+ * @note 基于单调队列维护窗口最小值与最大值，尾部被新样本支配的元素在入队时弹出，
+ *       每个样本至多入队、出队一次，单次更新均摊复杂度 \f$O(1)\f$
+ */
+class RMVL_EXPORTS_W MovingMinMax
+{
+public:
+    /**
+     * @brief 创建滑动窗口最值滤波器
+     *
+     * @param[in] window 窗口长度（样本数）
+     */
+    RMVL_W explicit MovingMinMax(std::size_t window);
+
+    /**
+     * @brief 推入新样本并更新窗口最值
+     *
+     * @param[in] x 新样本
+     */
+    RMVL_W void update(double x);
+
+    //! 当前窗口最小值，无样本时为 `0`
+    RMVL_W inline double min() const { return _min_q.empty() ? 0. : _min_q.front().val; }
+
+    //! 当前窗口最大值，无样本时为 `0`
+    RMVL_W inline double max() const { return _max_q.empty() ? 0. : _max_q.front().val; }
+
+    //! 当前窗口内的样本数
+    RMVL_W inline std::size_t size() const { return static_cast<std::size_t>(_count) < _window ? _count : _window; }
+
+private:
+    //! 带序号的样本
+    struct Sample
+    {
+        double val;   //!< 样本值
+        uint64_t seq; //!< 样本序号
+    };
+
+    std::size_t _window{};  //!< 窗口长度
+    uint64_t _count{};      //!< 已推入的样本总数
+    Signal<Sample> _min_q;  //!< 单调不减队列，队首为窗口最小值
+    Signal<Sample> _max_q;  //!< 单调不增队列，队首为窗口最大值
+};
+
+/**
+ * @brief 滑动窗口中值滤波器
+ * @note 基于双堆维护窗口中值：大根堆存放窗口内较小的一半样本，小根堆存放较大的一半，
+ *       滑出窗口的样本经 rm::RaHeap 的随机删除从对应堆中移除，单次更新复杂度
+ *       \f$O(\log w)\f$，窗口未满时对已有样本取中值
+ */
+class RMVL_EXPORTS_W MovingMedian
+{
+    RMVL_IMPL;
+
+public:
+    /**
+     * @brief 创建滑动窗口中值滤波器
+     *
+     * @param[in] window 窗口长度（样本数）
+     */
+    RMVL_W explicit MovingMedian(std::size_t window);
+
+    MovingMedian(const MovingMedian &) = delete;
+    MovingMedian(MovingMedian &&) = default;
+    MovingMedian &operator=(const MovingMedian &) = delete;
+    MovingMedian &operator=(MovingMedian &&) = default;
+
+    /**
+     * @brief 推入新样本并更新窗口中值
+     *
+     * @param[in] x 新样本
+     * @return 当前窗口中值，窗口内样本数为偶数时取中间两个样本的均值
+     */
+    RMVL_W double update(double x);
+
+    //! 当前窗口中值，无样本时为 `0`
+    RMVL_W double get() const;
+
+    //! 当前窗口内的样本数
+    RMVL_W std::size_t size() const;
+};
+
 #ifdef HAVE_OPENCV
 
 /**
  * @brief 绘制信号
- * 
+ *
  * @param[in] datas 信号数据
  * @param[in] color 颜色
  * @return `cv::Mat` 表示的绘制图像
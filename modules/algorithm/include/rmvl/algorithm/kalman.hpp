@@ -13,10 +13,16 @@
 
 #ifdef HAVE_OPENCV
 
+#include <algorithm>
 #include <functional>
+#include <vector>
 
 #include <opencv2/core.hpp>
 
+#include "rmvl/core/util.hpp"
+
+#include "matx_expr.hpp"
+
 //! @addtogroup algorithm
 //! @{
 //! @defgroup algorithm_kalman 卡尔曼滤波模块
@@ -108,6 +114,225 @@ protected:
     cv::Matx<Tp, StateDim, MeasureDim> K;   //!< 卡尔曼增益 \f$K\f$
 };
 
+namespace helper
+{
+
+//! @cond
+
+/**
+ * @brief 对称正定矩阵求逆，用于卡尔曼增益计算中的新息协方差矩阵
+ * @brief
+ * - 维数在编译期已知，按维数静态分发：维数不超过 3 时使用解析解，4 ~ 8 维使用 LDLT
+ *   分解（循环次数编译期展开），更高维数回退到 `cv::Matx::inv()` 的通用 LU 路径
+ */
+template <typename Tp, int N>
+inline cv::Matx<Tp, N, N> invSym(const cv::Matx<Tp, N, N> &m)
+{
+    if constexpr (N == 1)
+        return {1 / m(0, 0)};
+    else if constexpr (N == 2)
+    {
+        Tp det = m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+        return {m(1, 1) / det, -m(0, 1) / det, -m(1, 0) / det, m(0, 0) / det};
+    }
+    else if constexpr (N == 3)
+    {
+        Tp c00 = m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1);
+        Tp c01 = m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2);
+        Tp c02 = m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1);
+        Tp c10 = m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2);
+        Tp c11 = m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0);
+        Tp c12 = m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2);
+        Tp c20 = m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0);
+        Tp c21 = m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1);
+        Tp c22 = m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+        Tp inv_det = 1 / (m(0, 0) * c00 + m(0, 1) * c10 + m(0, 2) * c20);
+        return cv::Matx<Tp, 3, 3>(c00, c01, c02, c10, c11, c12, c20, c21, c22) * inv_det;
+    }
+    else if constexpr (N <= 8)
+    {
+        // LDLT 分解 m = L D L^T
+        auto L = cv::Matx<Tp, N, N>::eye();
+        cv::Vec<Tp, N> d;
+        for (int j = 0; j < N; ++j)
+        {
+            Tp dj = m(j, j);
+            for (int k = 0; k < j; ++k)
+                dj -= L(j, k) * L(j, k) * d(k);
+            d(j) = dj;
+            for (int i = j + 1; i < N; ++i)
+            {
+                Tp lij = m(i, j);
+                for (int k = 0; k < j; ++k)
+                    lij -= L(i, k) * L(j, k) * d(k);
+                L(i, j) = lij / dj;
+            }
+        }
+        // 对单位阵各列求解 L D L^T x = e_col
+        cv::Matx<Tp, N, N> res;
+        for (int col = 0; col < N; ++col)
+        {
+            Tp y[N];
+            for (int i = 0; i < N; ++i)
+            {
+                Tp v = i == col ? Tp(1) : Tp(0);
+                for (int k = 0; k < i; ++k)
+                    v -= L(i, k) * y[k];
+                y[i] = v;
+            }
+            for (int i = N - 1; i >= 0; --i)
+            {
+                Tp v = y[i] / d(i);
+                for (int k = i + 1; k < N; ++k)
+                    v -= L(k, i) * res(k, col);
+                res(i, col) = v;
+            }
+        }
+        return res;
+    }
+    else
+        return m.inv();
+}
+
+/**
+ * @brief 对称半正定矩阵的 UD 分解 \f$M=UDU^T\f$
+ * @brief
+ * - \f$U\f$ 为单位上三角矩阵，\f$D\f$ 为对角矩阵，对角元出现非正值时置 `0` 并跳过归一化
+ */
+template <typename Tp, int N>
+inline void udFactor(const cv::Matx<Tp, N, N> &m, cv::Matx<Tp, N, N> &U, cv::Vec<Tp, N> &d)
+{
+    cv::Matx<Tp, N, N> P = m;
+    U = U.eye();
+    for (int j = N - 1; j >= 0; --j)
+    {
+        d(j) = P(j, j) > 0 ? P(j, j) : Tp(0);
+        for (int i = 0; i < j; ++i)
+        {
+            U(i, j) = d(j) > 0 ? P(i, j) / d(j) : Tp(0);
+            for (int k = 0; k <= i; ++k)
+                P(k, i) -= U(k, j) * U(i, j) * d(j);
+        }
+    }
+}
+
+//! 由 UD 因子重构对称矩阵 \f$M=UDU^T\f$
+template <typename Tp, int N>
+inline cv::Matx<Tp, N, N> udCompose(const cv::Matx<Tp, N, N> &U, const cv::Vec<Tp, N> &d)
+{
+    cv::Matx<Tp, N, N> res;
+    for (int i = 0; i < N; ++i)
+        for (int j = i; j < N; ++j)
+        {
+            Tp s{};
+            for (int k = j; k < N; ++k)
+                s += (i == k ? Tp(1) : U(i, k)) * d(k) * (j == k ? Tp(1) : U(j, k));
+            res(i, j) = res(j, i) = s;
+        }
+    return res;
+}
+
+/**
+ * @brief Thornton 时间更新（MWGS 正交化）
+ * @brief
+ * - 由后验因子 \f$U,D\f$ 计算先验因子，满足 \f$U^-D^-{U^-}^T=AUDU^TA^T+U_qD_qU_q^T\f$，
+ *   全程不显式构造协方差矩阵，避免非对称舍入误差累积
+ */
+template <typename Tp, int N>
+inline void thornton(cv::Matx<Tp, N, N> &U, cv::Vec<Tp, N> &d, const cv::Matx<Tp, N, N> &A,
+                     const cv::Matx<Tp, N, N> &Uq, const cv::Vec<Tp, N> &dq)
+{
+    cv::Matx<Tp, N, N> PhiU = A * U;
+    Tp W[N][2 * N]{};
+    Tp dw[2 * N]{};
+    for (int i = 0; i < N; ++i)
+    {
+        for (int k = 0; k < N; ++k)
+            W[i][k] = PhiU(i, k), W[i][N + k] = Uq(i, k);
+        dw[i] = d(i), dw[N + i] = dq(i);
+    }
+    auto Unew = cv::Matx<Tp, N, N>::eye();
+    for (int j = N - 1; j >= 0; --j)
+    {
+        Tp sigma{};
+        for (int k = 0; k < 2 * N; ++k)
+            sigma += W[j][k] * W[j][k] * dw[k];
+        d(j) = sigma;
+        for (int i = 0; i < j; ++i)
+        {
+            Tp s{};
+            for (int k = 0; k < 2 * N; ++k)
+                s += W[i][k] * dw[k] * W[j][k];
+            Unew(i, j) = sigma > 0 ? s / sigma : Tp(0);
+            for (int k = 0; k < 2 * N; ++k)
+                W[i][k] -= Unew(i, j) * W[j][k];
+        }
+    }
+    U = Unew;
+}
+
+/**
+ * @brief Bierman 标量观测更新
+ * @brief
+ * - 对先验因子 \f$U,D\f$ 施加单个标量观测 \f$z=\pmb h\pmb x+v,\ v\sim(0,r)\f$ 的校正，
+ *   更新过程只含正数乘除，不出现 \f$(I-KH)P\f$ 形式的大数相消
+ *
+ * @return 卡尔曼增益列向量
+ */
+template <typename Tp, int N>
+inline cv::Matx<Tp, N, 1> bierman(cv::Matx<Tp, N, N> &U, cv::Vec<Tp, N> &d, const cv::Matx<Tp, 1, N> &h, Tp r)
+{
+    Tp f[N], g[N], b[N];
+    for (int j = 0; j < N; ++j)
+    {
+        f[j] = h(j);
+        for (int i = 0; i < j; ++i)
+            f[j] += U(i, j) * h(i);
+        g[j] = d(j) * f[j];
+    }
+    Tp alpha = r + f[0] * g[0];
+    d(0) *= alpha > 0 ? r / alpha : Tp(0);
+    b[0] = g[0];
+    for (int k = 1; k < N; ++k)
+    {
+        Tp beta = alpha;
+        alpha += f[k] * g[k];
+        Tp lambda = beta > 0 ? -f[k] / beta : Tp(0);
+        d(k) *= alpha > 0 ? beta / alpha : Tp(0);
+        for (int i = 0; i < k; ++i)
+        {
+            Tp tmp = U(i, k);
+            U(i, k) = tmp + lambda * b[i];
+            b[i] += g[k] * tmp;
+        }
+        b[k] = g[k];
+    }
+    cv::Matx<Tp, N, 1> K;
+    for (int i = 0; i < N; ++i)
+        K(i) = alpha > 0 ? b[i] / alpha : Tp(0);
+    return K;
+}
+
+//! 单位上三角方程组求解 \f$U\pmb y=\pmb v\f$，用于观测去相关
+template <typename Tp, int N, int M>
+inline cv::Matx<Tp, N, M> unitUpperSolve(const cv::Matx<Tp, N, N> &U, const cv::Matx<Tp, N, M> &v)
+{
+    cv::Matx<Tp, N, M> y;
+    for (int c = 0; c < M; ++c)
+        for (int i = N - 1; i >= 0; --i)
+        {
+            Tp s = v(i, c);
+            for (int k = i + 1; k < N; ++k)
+                s -= U(i, k) * y(k, c);
+            y(i, c) = s;
+        }
+    return y;
+}
+
+//! @endcond
+
+} // namespace helper
+
 /**
  * @brief 卡尔曼滤波器
  *
@@ -147,7 +372,13 @@ public:
      *
      * @param[in] state_tf 状态转移矩阵
      */
-    inline void setA(const cv::Matx<Tp, StateDim, StateDim> &state_tf) { this->A = state_tf, this->At = state_tf.t(); }
+    inline void setA(const cv::Matx<Tp, StateDim, StateDim> &state_tf)
+    {
+        // 矩阵未变化时保留缓存的转移矩阵幂，逐帧以相同 Δt 重设 A 不会使多步预测缓存失效
+        if (!std::equal(state_tf.val, state_tf.val + StateDim * StateDim, A.val))
+            _hor_steps = INVALID_STEPS;
+        this->A = state_tf, this->At = state_tf.t();
+    }
 
     /**
      * @brief 设置观测矩阵 \f$H\f$
@@ -160,6 +391,34 @@ public:
      */
     inline void setH(const cv::Matx<Tp, MeasureDim, StateDim> &observe_tf) { this->H = observe_tf, this->Ht = observe_tf.t(); }
 
+    /**
+     * @brief 多步预测快速路径，返回当前后验状态向前传播 `n` 步的预测，不改变滤波器状态
+     * @brief
+     * - 预测器逐帧将状态外推 50 ~ 150 ms，相当于数十次 `predict` 循环。本接口缓存转移
+     *   矩阵幂 \f$A^n\f$：步数与 \f$A\f$ 均未变化的稳态下，整段外推为一次矩阵应用；
+     *   步数或 \f$A\f$ 变化时以快速幂重建缓存，乘法次数为 \f$O(\log n)\f$
+     * @note 仅外推状态均值，不传播误差协方差，适用于弹道解算等只需状态预测值的场合
+     *
+     * @param[in] n 预测步数，每步对应一次 \f$A\f$ 的应用
+     * @return 向前传播 `n` 步的状态预测
+     */
+    inline auto predictTo(std::size_t n)
+    {
+        if (_hor_steps != n)
+        {
+            // 快速幂重建 A^n
+            auto power = A, an = An.eye();
+            for (std::size_t k = n; k != 0; k >>= 1)
+            {
+                if (k & 1)
+                    an = an * power;
+                power = power * power;
+            }
+            An = an, _hor_steps = n;
+        }
+        return An * this->x;
+    }
+
     /**
      * @brief 卡尔曼滤波的预测部分，包括状态量的先验估计和误差协方差的先验估计
      * @brief 公式如下 \f[\begin{align}\hat{\pmb x}_k^-&=A\hat{\pmb x}_{k-1}\\P_k^-&=AP_{k-1}A^T+Q\end{align}\f]
@@ -170,8 +429,8 @@ public:
     {
         // 先验状态估计
         this->x_ = A * this->x;
-        // 先验误差协方差
-        this->P_ = A * this->P * At + this->Q;
+        // 先验误差协方差（表达式模板融合求值，消除中间临时矩阵）
+        this->P_ = matx(A) * this->P * At + this->Q;
         return this->x_;
     }
 
@@ -187,19 +446,24 @@ public:
     {
         this->z = zk;
         // 计算卡尔曼增益
-        this->K = this->P_ * Ht * (H * this->P_ * Ht + this->R).inv();
+        this->K = matx(this->P_) * Ht * helper::invSym((matx(H) * this->P_ * Ht + this->R).eval());
         // 后验状态估计
         this->x = this->x_ + this->K * (this->z - this->H * this->x_);
         // 后验误差协方差
-        this->P = (this->I - this->K * H) * this->P_;
+        this->P = (matx(this->I) - this->K * H) * this->P_;
         return this->x;
     }
 
 private:
-    cv::Matx<Tp, StateDim, StateDim> A;    //!< 状态转移矩阵 \f$A\f$
-    cv::Matx<Tp, StateDim, StateDim> At;   //!< 状态转移矩阵的转置 \f$A^T\f$
-    cv::Matx<Tp, MeasureDim, StateDim> H;  //!< 观测矩阵 \f$H\f$
-    cv::Matx<Tp, StateDim, MeasureDim> Ht; //!< 观测矩阵的转置 \f$H^T\f$
+    //! 多步预测缓存失效标记
+    static constexpr std::size_t INVALID_STEPS = std::size_t(-1);
+
+    cv::Matx<Tp, StateDim, StateDim> A;      //!< 状态转移矩阵 \f$A\f$
+    cv::Matx<Tp, StateDim, StateDim> At;     //!< 状态转移矩阵的转置 \f$A^T\f$
+    cv::Matx<Tp, MeasureDim, StateDim> H;    //!< 观测矩阵 \f$H\f$
+    cv::Matx<Tp, StateDim, MeasureDim> Ht;   //!< 观测矩阵的转置 \f$H^T\f$
+    cv::Matx<Tp, StateDim, StateDim> An;     //!< 缓存的转移矩阵幂 \f$A^n\f$
+    std::size_t _hor_steps{INVALID_STEPS};   //!< 缓存的转移矩阵幂对应的步数
 };
 
 using KF21f = KalmanFilter<float, 2U, 1U>;  //!< 2 × 1 卡尔曼滤波器
@@ -217,6 +481,226 @@ using KF64d = KalmanFilter<double, 6U, 4U>; //!< 6 × 4 卡尔曼滤波器
 using KF73f = KalmanFilter<float, 7U, 3U>;  //!< 7 × 3 卡尔曼滤波器
 using KF73d = KalmanFilter<double, 7U, 3U>; //!< 7 × 3 卡尔曼滤波器
 
+/**
+ * @brief 平方根（UD 分解）卡尔曼滤波器
+ * @brief
+ * - 误差协方差以 \f$P=UDU^T\f$ 的因子形式传播：预测使用 Thornton 时间更新，校正对去相关后的
+ *   观测逐分量执行 Bierman 标量更新，全程不出现 \f$(I-KH)P^-\f$ 形式的大数相消，
+ *   单精度下长时间运行也能保持 \f$P\f$ 的对称正定性
+ * @brief
+ * - 与 rm::KalmanFilter 具有相同的 rm::KalmanFilterStaticDatas 接口与调用方式，
+ *   `P` 与 `P_` 在每次预测、校正后由因子重构，供外部读取
+ *
+ * @tparam Tp 数据类型
+ * @tparam StateDim 状态量个数
+ * @tparam MeasureDim 观测量个数
+ */
+template <typename Tp, unsigned StateDim, unsigned MeasureDim>
+class UDKalmanFilter : public KalmanFilterStaticDatas<Tp, StateDim, MeasureDim>
+{
+    static_assert(std::is_floating_point_v<Tp>, "\"Tp\" must be floating point value.");
+    static_assert(StateDim > 0, "StateDim of \"rm::UDKalmanFilter\" must greater than 0.");
+    static_assert(MeasureDim > 0, "MeasureDim of \"rm::UDKalmanFilter\" must greater than 0.");
+
+public:
+    //! 构造新的 UDKalmanFilter 对象
+    UDKalmanFilter() : KalmanFilterStaticDatas<Tp, StateDim, MeasureDim>(),
+                       A(A.eye()), At(At.eye()), H(H.eye()), Ht(Ht.eye()) {}
+
+    //! 设置状态转移矩阵 \f$A\f$ @see KalmanFilter::setA
+    inline void setA(const cv::Matx<Tp, StateDim, StateDim> &state_tf) { this->A = state_tf, this->At = state_tf.t(); }
+
+    //! 设置观测矩阵 \f$H\f$ @see KalmanFilter::setH
+    inline void setH(const cv::Matx<Tp, MeasureDim, StateDim> &observe_tf) { this->H = observe_tf, this->Ht = observe_tf.t(); }
+
+    /**
+     * @brief 卡尔曼滤波的预测部分，包括状态量的先验估计和误差协方差因子的先验估计
+     * @brief 对后验协方差 \f$P\f$ 作 UD 分解后执行 Thornton 时间更新，等价于
+     *        \f$P_k^-=AP_{k-1}A^T+Q\f$ 但不显式构造 \f$P_k^-\f$
+     *
+     * @return 先验状态估计
+     */
+    inline auto predict()
+    {
+        this->x_ = A * this->x;
+        helper::udFactor(this->P, U, d);
+        cv::Matx<Tp, StateDim, StateDim> Uq;
+        cv::Vec<Tp, StateDim> dq;
+        helper::udFactor(this->Q, Uq, dq);
+        helper::thornton(U, d, A, Uq, dq);
+        this->P_ = helper::udCompose(U, d);
+        return this->x_;
+    }
+
+    /**
+     * @brief 卡尔曼滤波器校正部分，包含卡尔曼增益的计算、状态量的后验估计和误差协方差因子的后验估计
+     * @brief 先将观测按 \f$R=U_RD_RU_R^T\f$ 去相关，再对每个标量观测执行 Bierman 更新
+     *
+     * @param[in] zk 观测量
+     * @return 后验状态估计
+     */
+    inline auto correct(const cv::Matx<Tp, MeasureDim, 1> &zk)
+    {
+        this->z = zk;
+        // 观测去相关
+        cv::Matx<Tp, MeasureDim, MeasureDim> Ur;
+        cv::Vec<Tp, MeasureDim> dr;
+        helper::udFactor(this->R, Ur, dr);
+        auto zd = helper::unitUpperSolve(Ur, zk);
+        auto Hd = helper::unitUpperSolve(Ur, H);
+        // 逐标量观测校正
+        this->x = this->x_;
+        for (unsigned m = 0; m < MeasureDim; ++m)
+        {
+            auto hm = Hd.row(m);
+            auto Km = helper::bierman(U, d, hm, dr(m));
+            this->x += Km * (zd(m) - (hm * this->x)(0));
+            for (unsigned i = 0; i < StateDim; ++i)
+                this->K(i, m) = Km(i);
+        }
+        this->P = helper::udCompose(U, d);
+        return this->x;
+    }
+
+private:
+    cv::Matx<Tp, StateDim, StateDim> A;    //!< 状态转移矩阵 \f$A\f$
+    cv::Matx<Tp, StateDim, StateDim> At;   //!< 状态转移矩阵的转置 \f$A^T\f$
+    cv::Matx<Tp, MeasureDim, StateDim> H;  //!< 观测矩阵 \f$H\f$
+    cv::Matx<Tp, StateDim, MeasureDim> Ht; //!< 观测矩阵的转置 \f$H^T\f$
+    cv::Matx<Tp, StateDim, StateDim> U;    //!< 误差协方差的单位上三角因子 \f$U\f$
+    cv::Vec<Tp, StateDim> d;               //!< 误差协方差的对角因子 \f$D\f$
+};
+
+using UDKF21f = UDKalmanFilter<float, 2U, 1U>;  //!< 2 × 1 平方根卡尔曼滤波器
+using UDKF21d = UDKalmanFilter<double, 2U, 1U>; //!< 2 × 1 平方根卡尔曼滤波器
+using UDKF42f = UDKalmanFilter<float, 4U, 2U>;  //!< 4 × 2 平方根卡尔曼滤波器
+using UDKF42d = UDKalmanFilter<double, 4U, 2U>; //!< 4 × 2 平方根卡尔曼滤波器
+using UDKF63f = UDKalmanFilter<float, 6U, 3U>;  //!< 6 × 3 平方根卡尔曼滤波器
+using UDKF63d = UDKalmanFilter<double, 6U, 3U>; //!< 6 × 3 平方根卡尔曼滤波器
+using UDKF64f = UDKalmanFilter<float, 6U, 4U>;  //!< 6 × 4 平方根卡尔曼滤波器
+using UDKF64d = UDKalmanFilter<double, 6U, 4U>; //!< 6 × 4 平方根卡尔曼滤波器
+
+/**
+ * @brief 批量卡尔曼滤波器
+ * @brief
+ * - 以 SoA 方式连续存放 \f$N\f$ 组滤波器状态，状态转移矩阵 \f$A\f$、观测矩阵 \f$H\f$
+ *   以及噪声协方差矩阵 \f$Q\f$、\f$R\f$ 由所有滤波器共享，适合同一运动模型下的多目标跟踪
+ * @brief
+ * - 单次 @ref predict / @ref correct 调用即可完成所有滤波器的预测、校正，
+ *   相比逐个调用 rm::KalmanFilter 可摊销函数调用与内存跳转的开销
+ *
+ * @tparam Tp 数据类型
+ * @tparam StateDim 状态量个数
+ * @tparam MeasureDim 观测量个数
+ */
+template <typename Tp, unsigned StateDim, unsigned MeasureDim>
+class KalmanFilterBatch
+{
+    static_assert(std::is_floating_point_v<Tp>, "\"Tp\" must be floating point value.");
+    static_assert(StateDim > 0, "StateDim of \"rm::KalmanFilterBatch\" must greater than 0.");
+    static_assert(MeasureDim > 0, "MeasureDim of \"rm::KalmanFilterBatch\" must greater than 0.");
+
+public:
+    //! 构造空的批量卡尔曼滤波器
+    KalmanFilterBatch() : A(A.eye()), At(At.eye()), H(H.eye()), Ht(Ht.eye()), Q(Q.eye()), R(R.eye()), I(I.eye()) {}
+
+    //! 滤波器个数
+    inline std::size_t size() const { return xs.size(); }
+
+    /**
+     * @brief 追加一个滤波器，初始化状态以及对应的误差协方差矩阵（常数对角矩阵）
+     *
+     * @param[in] x0 初始化的状态向量
+     * @param[in] error 状态误差系数
+     * @return 新滤波器的下标
+     */
+    std::size_t append(const cv::Matx<Tp, StateDim, 1> &x0, Tp error)
+    {
+        xs.push_back(x0), xs_.push_back(x0);
+        Ps.push_back(Ps_.emplace_back(cv::Matx<Tp, StateDim, StateDim>::eye() * error));
+        Ks.emplace_back();
+        return xs.size() - 1;
+    }
+
+    /**
+     * @brief 移除指定下标的滤波器
+     * @note 为保持存储连续，最后一个滤波器会被移动到被移除的位置，下标随之变化
+     *
+     * @param[in] idx 滤波器下标
+     */
+    void remove(std::size_t idx)
+    {
+        xs[idx] = xs.back(), xs.pop_back();
+        xs_[idx] = xs_.back(), xs_.pop_back();
+        Ps[idx] = Ps.back(), Ps.pop_back();
+        Ps_[idx] = Ps_.back(), Ps_.pop_back();
+        Ks[idx] = Ks.back(), Ks.pop_back();
+    }
+
+    //! 设置共享的状态转移矩阵 \f$A\f$ @see KalmanFilter::setA
+    inline void setA(const cv::Matx<Tp, StateDim, StateDim> &state_tf) { A = state_tf, At = state_tf.t(); }
+    //! 设置共享的观测矩阵 \f$H\f$ @see KalmanFilter::setH
+    inline void setH(const cv::Matx<Tp, MeasureDim, StateDim> &observe_tf) { H = observe_tf, Ht = observe_tf.t(); }
+    //! 设置共享的过程噪声协方差矩阵 \f$Q\f$
+    inline void setQ(const cv::Matx<Tp, StateDim, StateDim> &process_err) { Q = process_err; }
+    //! 设置共享的测量噪声协方差矩阵 \f$R\f$
+    inline void setR(const cv::Matx<Tp, MeasureDim, MeasureDim> &measure_err) { R = measure_err; }
+
+    //! 获取指定下标滤波器的后验状态估计
+    inline const cv::Matx<Tp, StateDim, 1> &x(std::size_t idx) const { return xs[idx]; }
+
+    /**
+     * @brief 所有滤波器的预测部分，逐一完成状态量与误差协方差的先验估计
+     *
+     * @return 所有滤波器的先验状态估计
+     */
+    const std::vector<cv::Matx<Tp, StateDim, 1>> &predict()
+    {
+        const std::size_t n = xs.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            xs_[i] = A * xs[i];
+            Ps_[i] = matx(A) * Ps[i] * At + Q;
+        }
+        return xs_;
+    }
+
+    /**
+     * @brief 所有滤波器的校正部分，逐一完成卡尔曼增益计算与状态量、误差协方差的后验估计
+     *
+     * @param[in] zks 所有滤波器的观测量，个数需与滤波器个数一致
+     * @return 所有滤波器的后验状态估计
+     */
+    const std::vector<cv::Matx<Tp, StateDim, 1>> &correct(const std::vector<cv::Matx<Tp, MeasureDim, 1>> &zks)
+    {
+        if (zks.size() != xs.size())
+            RMVL_Error(RMVL_StsBadSize, "The number of measurements is inconsistent with the number of filters.");
+        const std::size_t n = xs.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            Ks[i] = matx(Ps_[i]) * Ht * helper::invSym((matx(H) * Ps_[i] * Ht + R).eval());
+            xs[i] = xs_[i] + Ks[i] * (zks[i] - H * xs_[i]);
+            Ps[i] = (matx(I) - Ks[i] * H) * Ps_[i];
+        }
+        return xs;
+    }
+
+private:
+    cv::Matx<Tp, StateDim, StateDim> A;    //!< 共享的状态转移矩阵 \f$A\f$
+    cv::Matx<Tp, StateDim, StateDim> At;   //!< 状态转移矩阵的转置 \f$A^T\f$
+    cv::Matx<Tp, MeasureDim, StateDim> H;  //!< 共享的观测矩阵 \f$H\f$
+    cv::Matx<Tp, StateDim, MeasureDim> Ht; //!< 观测矩阵的转置 \f$H^T\f$
+    cv::Matx<Tp, StateDim, StateDim> Q;    //!< 共享的过程噪声协方差矩阵 \f$Q\f$
+    cv::Matx<Tp, MeasureDim, MeasureDim> R; //!< 共享的测量噪声协方差矩阵 \f$R\f$
+    cv::Matx<Tp, StateDim, StateDim> I;    //!< 单位矩阵 \f$I\f$
+
+    std::vector<cv::Matx<Tp, StateDim, 1>> xs;          //!< 各滤波器状态的后验估计
+    std::vector<cv::Matx<Tp, StateDim, 1>> xs_;         //!< 各滤波器状态的先验估计
+    std::vector<cv::Matx<Tp, StateDim, StateDim>> Ps;   //!< 各滤波器的后验误差协方差矩阵
+    std::vector<cv::Matx<Tp, StateDim, StateDim>> Ps_;  //!< 各滤波器的先验误差协方差矩阵
+    std::vector<cv::Matx<Tp, StateDim, MeasureDim>> Ks; //!< 各滤波器的卡尔曼增益
+};
+
 /**
  * @brief 扩展卡尔曼滤波器
  *
@@ -289,8 +773,8 @@ public:
     {
         // 先验状态估计
         this->x_ = Fa(this->x);
-        // 先验误差协方差
-        this->P_ = Ja * this->P * Jat + W * this->Q * Wt;
+        // 先验误差协方差（表达式模板融合求值，消除中间临时矩阵）
+        this->P_ = matx(Ja) * this->P * Jat + matx(W) * this->Q * Wt;
         return this->x_;
     }
 
@@ -307,11 +791,11 @@ public:
     {
         this->z = zk;
         // 计算卡尔曼增益
-        this->K = this->P_ * Jht * (Jh * this->P_ * Jht + V * this->R * Vt).inv();
+        this->K = matx(this->P_) * Jht * helper::invSym((matx(Jh) * this->P_ * Jht + matx(V) * this->R * Vt).eval());
         // 后验状态估计
         this->x = this->x_ + this->K * (this->z - Fh(this->x_));
         // 后验误差协方差
-        this->P = (this->I - this->K * Jh) * this->P_;
+        this->P = (matx(this->I) - this->K * Jh) * this->P_;
         return this->x;
     }
 
@@ -356,6 +840,120 @@ using EKF84d = ExtendedKalmanFilter<double, 8U, 4U>; //!< 8 × 4 扩展卡尔曼
 using EKF94f = ExtendedKalmanFilter<float, 9U, 4U>;  //!< 9 × 4 扩展卡尔曼滤波器
 using EKF94d = ExtendedKalmanFilter<double, 9U, 4U>; //!< 9 × 4 扩展卡尔曼滤波器
 
+/**
+ * @brief 平方根（UD 分解）扩展卡尔曼滤波器
+ * @brief
+ * - 误差协方差传播方式与 rm::UDKalmanFilter 一致：Thornton 时间更新配合逐标量的 Bierman
+ *   观测更新，接口与 rm::ExtendedKalmanFilter 完全相同，单精度下可保持长时间数值稳定
+ *
+ * @tparam Tp 数据类型
+ * @tparam StateDim 状态量个数
+ * @tparam MeasureDim 观测量个数
+ */
+template <typename Tp, unsigned StateDim, unsigned MeasureDim>
+class UDExtendedKalmanFilter : public KalmanFilterStaticDatas<Tp, StateDim, MeasureDim>
+{
+    static_assert(std::is_floating_point_v<Tp>, "\"Tp\" must be floating point value.");
+
+public:
+    //! 构造新的 UDExtendedKalmanFilter 对象
+    UDExtendedKalmanFilter() : KalmanFilterStaticDatas<Tp, StateDim, MeasureDim>(), Ja(Ja.eye()), Jat(Jat.eye()),
+                               Jh(Jh.eye()), Jht(Jht.eye()), W(W.eye()), Wt(Wt.eye()), V(V.eye()), Vt(Vt.eye()) {}
+
+    //! 设置状态方程雅可比矩阵 \f$J_A\f$ @see ExtendedKalmanFilter::setJa
+    inline void setJa(const cv::Matx<Tp, StateDim, StateDim> &state_jac) { Ja = state_jac, Jat = state_jac.t(); }
+
+    //! 设置观测方程雅可比矩阵 \f$J_H\f$ @see ExtendedKalmanFilter::setJh
+    inline void setJh(const cv::Matx<Tp, MeasureDim, StateDim> &observe_jac) { Jh = observe_jac, Jht = observe_jac.t(); }
+
+    //! 设置非线性的离散状态方程 \f$\pmb f_A(\pmb x)\f$ @see ExtendedKalmanFilter::setFa
+    inline void setFa(const std::function<cv::Matx<Tp, StateDim, 1>(const cv::Matx<Tp, StateDim, 1> &)> &state_func) { Fa = state_func; }
+
+    //! 设置非线性的离散观测方程 \f$\pmb f_H(\pmb x)\f$ @see ExtendedKalmanFilter::setFh
+    inline void setFh(const std::function<cv::Matx<Tp, MeasureDim, 1>(const cv::Matx<Tp, StateDim, 1> &)> &observe_func) { Fh = observe_func; }
+
+    //! 设置过程噪声协方差雅可比矩阵 \f$W\f$ @see ExtendedKalmanFilter::setW
+    inline void setW(const cv::Matx<Tp, StateDim, StateDim> &process_jac) { W = process_jac, Wt = process_jac.t(); }
+
+    //! 设置测量噪声协方差雅可比矩阵 \f$V\f$ @see ExtendedKalmanFilter::setV
+    inline void setV(const cv::Matx<Tp, MeasureDim, MeasureDim> &measure_jac) { V = measure_jac, Vt = measure_jac.t(); }
+
+    /**
+     * @brief 扩展卡尔曼滤波的预测部分，包括状态量的先验估计和误差协方差因子的先验估计
+     * @brief 等价于 \f$P_k^-=J_AP_{k-1}J_A^T+WQW^T\f$，但协方差以 UD 因子形式传播
+     *
+     * @return 先验状态估计
+     */
+    inline auto predict()
+    {
+        this->x_ = Fa(this->x);
+        helper::udFactor(this->P, U, d);
+        cv::Matx<Tp, StateDim, StateDim> Uq;
+        cv::Vec<Tp, StateDim> dq;
+        helper::udFactor(W * this->Q * Wt, Uq, dq);
+        helper::thornton(U, d, Ja, Uq, dq);
+        this->P_ = helper::udCompose(U, d);
+        return this->x_;
+    }
+
+    /**
+     * @brief 扩展卡尔曼滤波的校正部分，包含卡尔曼增益的计算、状态量的后验估计和误差协方差因子的后验估计
+     * @brief 将观测按 \f$VRV^T=U_RD_RU_R^T\f$ 去相关后，对每个标量观测执行 Bierman 更新，
+     *        非线性观测方程 \f$\pmb f_H\f$ 仅在先验估计处线性化一次
+     *
+     * @param[in] zk 观测量
+     * @return 后验状态估计
+     */
+    inline auto correct(const cv::Matx<Tp, MeasureDim, 1> &zk)
+    {
+        this->z = zk;
+        // 观测去相关，非线性观测的新息在先验处计算
+        cv::Matx<Tp, MeasureDim, MeasureDim> Ur;
+        cv::Vec<Tp, MeasureDim> dr;
+        helper::udFactor(V * this->R * Vt, Ur, dr);
+        auto yd = helper::unitUpperSolve(Ur, cv::Matx<Tp, MeasureDim, 1>(zk - Fh(this->x_)));
+        auto Hd = helper::unitUpperSolve(Ur, Jh);
+        // 逐标量观测校正
+        this->x = this->x_;
+        for (unsigned m = 0; m < MeasureDim; ++m)
+        {
+            auto hm = Hd.row(m);
+            auto Km = helper::bierman(U, d, hm, dr(m));
+            this->x += Km * (yd(m) - (hm * (this->x - this->x_))(0));
+            for (unsigned i = 0; i < StateDim; ++i)
+                this->K(i, m) = Km(i);
+        }
+        this->P = helper::udCompose(U, d);
+        return this->x;
+    }
+
+private:
+    cv::Matx<Tp, StateDim, StateDim> Ja;     //!< 状态方程雅可比矩阵 \f$J_A\f$
+    cv::Matx<Tp, StateDim, StateDim> Jat;    //!< 状态方程雅可比矩阵的转置 \f$J_A^T\f$
+    cv::Matx<Tp, MeasureDim, StateDim> Jh;   //!< 观测方程雅可比矩阵 \f$J_H\f$
+    cv::Matx<Tp, StateDim, MeasureDim> Jht;  //!< 观测方程雅可比矩阵的转置 \f$J_H^T\f$
+    cv::Matx<Tp, StateDim, StateDim> W;      //!< 过程噪声协方差雅可比矩阵 \f$W\f$
+    cv::Matx<Tp, StateDim, StateDim> Wt;     //!< 过程噪声协方差雅可比矩阵的转置 \f$W^T\f$
+    cv::Matx<Tp, MeasureDim, MeasureDim> V;  //!< 测量噪声协方差雅可比矩阵 \f$V\f$
+    cv::Matx<Tp, MeasureDim, MeasureDim> Vt; //!< 测量噪声协方差雅可比矩阵的转置 \f$V^T\f$
+    cv::Matx<Tp, StateDim, StateDim> U;      //!< 误差协方差的单位上三角因子 \f$U\f$
+    cv::Vec<Tp, StateDim> d;                 //!< 误差协方差的对角因子 \f$D\f$
+
+    //! 非线性的离散状态方程
+    std::function<cv::Matx<Tp, StateDim, 1>(const cv::Matx<Tp, StateDim, 1> &)> Fa;
+    //! 非线性的离散观测方程
+    std::function<cv::Matx<Tp, MeasureDim, 1>(const cv::Matx<Tp, StateDim, 1> &)> Fh;
+};
+
+using UDEKF52f = UDExtendedKalmanFilter<float, 5U, 2U>;  //!< 5 × 2 平方根扩展卡尔曼滤波器
+using UDEKF52d = UDExtendedKalmanFilter<double, 5U, 2U>; //!< 5 × 2 平方根扩展卡尔曼滤波器
+using UDEKF53f = UDExtendedKalmanFilter<float, 5U, 3U>;  //!< 5 × 3 平方根扩展卡尔曼滤波器
+using UDEKF53d = UDExtendedKalmanFilter<double, 5U, 3U>; //!< 5 × 3 平方根扩展卡尔曼滤波器
+using UDEKF63f = UDExtendedKalmanFilter<float, 6U, 3U>;  //!< 6 × 3 平方根扩展卡尔曼滤波器
+using UDEKF63d = UDExtendedKalmanFilter<double, 6U, 3U>; //!< 6 × 3 平方根扩展卡尔曼滤波器
+using UDEKF94f = UDExtendedKalmanFilter<float, 9U, 4U>;  //!< 9 × 4 平方根扩展卡尔曼滤波器
+using UDEKF94d = UDExtendedKalmanFilter<double, 9U, 4U>; //!< 9 × 4 平方根扩展卡尔曼滤波器
+
 //! @} algorithm_kalman
 
 } // namespace rm
@@ -402,6 +402,143 @@ typename ForwardIterator::value_type calculateModeNum(ForwardIterator first, For
         ->first;
 }
 
+// ----------------------【快速三角函数近似】----------------------
+
+/**
+ * @brief 快速三角函数近似
+ * @note
+ * - 采用多项式近似计算，最大绝对误差不超过 \f$10^{-6}\f$，标量版本不含分支跳转，
+ *   数组版本的循环可被编译器自动向量化
+ * - 适用于同步、弹道解算等小角度高频调用场景，需要完整精度时仍应使用 `std::sin` 等标准库函数
+ */
+namespace fastmath
+{
+
+/**
+ * @brief 快速正弦 \f$\sin(x)\f$，最大绝对误差约 \f$6\times10^{-8}\f$
+ *
+ * @param[in] x 自变量（弧度制）
+ * @return sin(x)
+ */
+inline double sin(double x)
+{
+    // 规约至 [-π/2, π/2]，规约周期为奇数时反号
+    double q = std::floor(x * (1. / PI) + 0.5);
+    double r = x - q * PI;
+    double sign = 1. - 2. * (q - 2. * std::floor(q * 0.5));
+    // 11 阶泰勒多项式在 [-π/2, π/2] 上的截断误差约 5.7e-8
+    double r2 = r * r;
+    double p = 1. + r2 * (-1. / 6 + r2 * (1. / 120 + r2 * (-1. / 5040 + r2 * (1. / 362880 + r2 * (-1. / 39916800)))));
+    return sign * r * p;
+}
+
+/**
+ * @brief 快速余弦 \f$\cos(x)\f$，最大绝对误差约 \f$6\times10^{-8}\f$
+ *
+ * @param[in] x 自变量（弧度制）
+ * @return cos(x)
+ */
+inline double cos(double x) { return fastmath::sin(x + PI_2); }
+
+/**
+ * @brief 快速反正切 \f$\arctan(x)\f$，最大绝对误差约 \f$9\times10^{-8}\f$
+ *
+ * @param[in] x 自变量
+ * @return atan(x)，范围 \f$\left(-\frac\pi2,\frac\pi2\right)\f$
+ */
+inline double atan(double x)
+{
+    // |x| > 1 时利用 atan(x) = π/2 - atan(1/x) 规约至 [0, 1]
+    double ax = std::abs(x);
+    bool inv = ax > 1.;
+    double z = inv ? 1. / ax : ax;
+    // [0, 1] 上的切比雪夫逼近多项式（x² 的 7 次式）
+    double u = z * z;
+    double p = 9.99999958182256843e-01 +
+               u * (-3.33323026091953967e-01 +
+                    u * (1.99736775754334989e-01 +
+                         u * (-1.40401155793595384e-01 +
+                              u * (9.96785644200667842e-02 +
+                                   u * (-6.02181408642058005e-02 +
+                                        u * (2.47560635303784304e-02 +
+                                             u * -4.83096397181410030e-03))))));
+    double r = z * p;
+    r = inv ? PI_2 - r : r;
+    return std::copysign(r, x);
+}
+
+/**
+ * @brief 快速二参数反正切 \f$\mathrm{atan2}(y,x)\f$，最大绝对误差约 \f$10^{-7}\f$
+ *
+ * @param[in] y 纵坐标
+ * @param[in] x 横坐标
+ * @return 方位角，范围 \f$(-\pi,\pi]\f$
+ */
+inline double atan2(double y, double x)
+{
+    if (x == 0. && y == 0.)
+        return 0.;
+    double r = fastmath::atan(y / x);
+    if (x < 0.)
+        r += y < 0. ? -PI : PI;
+    return r;
+}
+
+/**
+ * @brief 批量快速正弦
+ *
+ * @param[in] x 自变量数组（弧度制）
+ * @param[out] y 结果数组，可与 `x` 相同
+ * @param[in] n 数组长度
+ */
+inline void sin(const double *x, double *y, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        y[i] = fastmath::sin(x[i]);
+}
+
+/**
+ * @brief 批量快速余弦
+ *
+ * @param[in] x 自变量数组（弧度制）
+ * @param[out] y 结果数组，可与 `x` 相同
+ * @param[in] n 数组长度
+ */
+inline void cos(const double *x, double *y, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        y[i] = fastmath::cos(x[i]);
+}
+
+/**
+ * @brief 批量快速反正切
+ *
+ * @param[in] x 自变量数组
+ * @param[out] y 结果数组，可与 `x` 相同
+ * @param[in] n 数组长度
+ */
+inline void atan(const double *x, double *y, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        y[i] = fastmath::atan(x[i]);
+}
+
+/**
+ * @brief 批量快速二参数反正切
+ *
+ * @param[in] y 纵坐标数组
+ * @param[in] x 横坐标数组
+ * @param[out] out 结果数组，可与 `x` 或 `y` 相同
+ * @param[in] n 数组长度
+ */
+inline void atan2(const double *y, const double *x, double *out, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = fastmath::atan2(y[i], x[i]);
+}
+
+} // namespace fastmath
+
 // ------------------------【数学模型算法】------------------------
 
 //! 熵权 TOPSIS 算法
@@ -423,6 +560,15 @@ public:
      * @return 最终指标
      */
     RMVL_W std::vector<double> inference();
+
+    /**
+     * @brief 更新样本指标，保留内部工作区
+     * @note 样本行列数与上一次一致时，更新以及后续的 inference() 均不产生堆内存分配，
+     *       适用于逐帧执行目标决策等高频调用场景
+     *
+     * @param[in] samples 样本指标
+     */
+    RMVL_W void updateSamples(const std::vector<std::vector<double>> &samples);
 };
 
 //! KM 算法求解器
@@ -446,6 +592,158 @@ public:
     RMVL_W std::vector<std::size_t> solve() noexcept;
 };
 
+/**
+ * @brief 增量式 KM 算法求解器
+ * @brief
+ * - 求解结束后保留对偶变量与已匹配的星标，相邻两次求解的代价矩阵变化不大时，
+ *   热启动只需少量增广即可收敛，避免每次从头支付完整的 \f$O(n^3)\f$
+ * @brief
+ * - 支持行、列的插入与删除，适用于跟踪器与目标数目逐帧变化的逐帧分配场景
+ */
+class RMVL_EXPORTS_W MunkresEngine
+{
+    RMVL_IMPL;
+
+public:
+    /**
+     * @brief 创建增量式 KM 算法求解器
+     *
+     * @param[in] cost_matrix 代价矩阵
+     */
+    RMVL_W MunkresEngine(const std::vector<std::vector<double>> &cost_matrix);
+
+    /**
+     * @brief 求解，可重复调用
+     *
+     * @return 最优分配结果，`retval[i]` 表示第 `i` 行分配到的列
+     */
+    RMVL_W std::vector<std::size_t> solve() noexcept;
+
+    /**
+     * @brief 热启动更新代价矩阵，保留既有对偶变量与星标
+     *
+     * @param[in] cost_matrix 新的代价矩阵，尺寸需与当前一致
+     */
+    RMVL_W void updateCosts(const std::vector<std::vector<double>> &cost_matrix);
+
+    /**
+     * @brief 在末尾插入一行
+     *
+     * @param[in] costs 该行的代价，长度需与当前列数一致
+     */
+    RMVL_W void insertRow(const std::vector<double> &costs);
+
+    /**
+     * @brief 删除指定行
+     *
+     * @param[in] idx 行下标
+     */
+    RMVL_W void eraseRow(std::size_t idx);
+
+    /**
+     * @brief 在末尾插入一列
+     *
+     * @param[in] costs 该列的代价，长度需与当前行数一致
+     */
+    RMVL_W void insertCol(const std::vector<double> &costs);
+
+    /**
+     * @brief 删除指定列
+     *
+     * @param[in] idx 列下标
+     */
+    RMVL_W void eraseCol(std::size_t idx);
+};
+
+/**
+ * @brief 增量式圆统计累加器
+ * @brief
+ * - 以单位向量和的形式维护一组周期角度的圆均值与圆方差，逐槽位更新只需替换该槽位的
+ *   单位向量并修正向量和，槽位角度未变化时为空操作，整体开销为 \f$O(\text{变化槽位数})\f$
+ * @brief
+ * - 向量和每累计若干次增量更新后由各槽位单位向量重新求和一次，消除浮点舍入误差的积累，
+ *   可跨帧长期维护
+ */
+class CircularAccumulator
+{
+public:
+    CircularAccumulator() = default;
+
+    /**
+     * @brief 创建增量式圆统计累加器
+     *
+     * @param[in] n 槽位数
+     * @param[in] period 角度周期，即被视为同一角度的间隔，默认为 \f$2\pi\f$
+     */
+    explicit CircularAccumulator(std::size_t n, double period = 2. * PI) : _period(period) { resize(n); }
+
+    /**
+     * @brief 重置为指定槽位数，各槽位回到未设置状态
+     *
+     * @param[in] n 槽位数
+     */
+    void resize(std::size_t n)
+    {
+        _angles.assign(n, 0.), _cosines.assign(n, 0.), _sines.assign(n, 0.);
+        _sum_x = _sum_y = 0., _updates = 0;
+    }
+
+    //! 槽位数
+    std::size_t size() const { return _angles.size(); }
+
+    /**
+     * @brief 更新指定槽位的角度
+     * @note 角度与该槽位当前值相同时为空操作，否则以新角度的单位向量替换该槽位并修正向量和
+     *
+     * @param[in] idx 槽位下标
+     * @param[in] angle 角度，单位与 `period` 一致
+     */
+    void update(std::size_t idx, double angle)
+    {
+        if (idx >= _angles.size())
+            RMVL_Error_(RMVL_StsBadArg, "Index of the slot is out of range, idx = %zu, size = %zu", idx, _angles.size());
+        if (angle == _angles[idx] && (_cosines[idx] != 0. || _sines[idx] != 0.))
+            return;
+        double phase = angle * (2. * PI / _period);
+        _angles[idx] = angle;
+        double c = std::cos(phase), s = std::sin(phase);
+        _sum_x += c - _cosines[idx], _sum_y += s - _sines[idx];
+        _cosines[idx] = c, _sines[idx] = s;
+        // 周期性重新求和，消除增量更新中浮点舍入误差的积累
+        if (++_updates >= RENORM_PERIOD)
+        {
+            _sum_x = std::accumulate(_cosines.begin(), _cosines.end(), 0.);
+            _sum_y = std::accumulate(_sines.begin(), _sines.end(), 0.);
+            _updates = 0;
+        }
+    }
+
+    /**
+     * @brief 圆均值
+     *
+     * @return 圆均值，单位与 `period` 一致，范围 \f$\left(-\frac{\text{period}}2,\frac{\text{period}}2\right]\f$
+     */
+    double mean() const { return std::atan2(_sum_y, _sum_x) * (_period / (2. * PI)); }
+
+    //! 合向量长度 \f$\bar R\in[0,1]\f$，表示角度的集中程度，全部槽位角度一致时为 `1`
+    double resultant() const { return _angles.empty() ? 0. : std::sqrt(_sum_x * _sum_x + _sum_y * _sum_y) / static_cast<double>(_angles.size()); }
+
+    //! 圆方差 \f$1-\bar R\in[0,1]\f$，角度越分散取值越大
+    double variance() const { return 1. - resultant(); }
+
+private:
+    //! 增量更新重新求和周期
+    static constexpr std::size_t RENORM_PERIOD = 4096;
+
+    double _period{2. * PI};      //!< 角度周期
+    std::vector<double> _angles;  //!< 各槽位角度
+    std::vector<double> _cosines; //!< 各槽位单位向量横坐标
+    std::vector<double> _sines;   //!< 各槽位单位向量纵坐标
+    double _sum_x{};              //!< 单位向量和横坐标
+    double _sum_y{};              //!< 单位向量和纵坐标
+    std::size_t _updates{};       //!< 自上次重新求和以来的增量更新次数
+};
+
 //! @} algorithm
 
 } // namespace rm
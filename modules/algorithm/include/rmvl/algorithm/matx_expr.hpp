@@ -0,0 +1,263 @@
+/**
+ * @file matx_expr.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 小型定维矩阵表达式模板
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#ifdef HAVE_OPENCV
+
+#include <type_traits>
+
+#include <opencv2/core/matx.hpp>
+
+//! @addtogroup algorithm
+//! @{
+//! @defgroup algorithm_matx_expr 小型定维矩阵表达式模板
+//! @{
+//! @brief 面向 `cv::Matx` 链式运算的轻量级表达式模板
+//! @brief
+//! - `cv::Matx` 的每个运算符都会立即物化一个临时矩阵，形如 \f$APA^T+Q\f$
+//!   的滤波器更新链会产生多次临时矩阵的构造与拷贝。本模块将链式的乘法、加减法、
+//!   转置与数乘融合到一次求值循环中：逐元素运算全程惰性求值，矩阵乘法的复合操作数
+//!   只物化一次，消除中间临时矩阵
+//! @brief
+//! - 用法：以 rm::matx 包裹链中任意一个 `cv::Matx`，其余运算符照常书写，
+//!   结果可隐式转换回 `cv::Matx`，例如 `P_ = matx(A) * P * At + Q`
+//! @warning 表达式节点以引用方式持有参与运算的矩阵，整条表达式必须在同一条语句内完成求值，
+//!          不能将表达式对象存入变量延迟使用
+//! @} algorithm_matx_expr
+//! @} algorithm
+
+namespace rm
+{
+
+//! @addtogroup algorithm_matx_expr
+//! @{
+
+/**
+ * @brief 矩阵表达式基类（CRTP）
+ *
+ * @tparam E 派生的表达式类型
+ * @tparam Tp 元素数据类型
+ * @tparam M 行数
+ * @tparam N 列数
+ */
+template <typename E, typename Tp, int M, int N>
+class MatxExpr
+{
+public:
+    using value_type = Tp;
+
+    //! 获取派生的表达式对象
+    constexpr const E &derived() const { return static_cast<const E &>(*this); }
+
+    //! 求值为 `cv::Matx`，整条表达式只遍历一次
+    cv::Matx<Tp, M, N> eval() const
+    {
+        cv::Matx<Tp, M, N> res;
+        for (int i = 0; i < M; ++i)
+            for (int j = 0; j < N; ++j)
+                res(i, j) = derived()(i, j);
+        return res;
+    }
+
+    //! 隐式转换为 `cv::Matx`
+    operator cv::Matx<Tp, M, N>() const { return eval(); }
+
+    //! 转置表达式（视图，不物化）
+    inline auto t() const;
+};
+
+//! 持有求值结果的表达式叶子，用于物化矩阵乘法的复合操作数
+template <typename Tp, int M, int N>
+class MatxVal : public MatxExpr<MatxVal<Tp, M, N>, Tp, M, N>
+{
+public:
+    //! 元素访问开销为常数，可作为矩阵乘法的操作数
+    static constexpr bool cheap = true;
+
+    template <typename E>
+    MatxVal(const MatxExpr<E, Tp, M, N> &expr) : _m(expr.eval()) {}
+
+    Tp operator()(int i, int j) const { return _m(i, j); }
+
+private:
+    cv::Matx<Tp, M, N> _m;
+};
+
+//! 引用既有 `cv::Matx` 的表达式叶子
+template <typename Tp, int M, int N>
+class MatxRef : public MatxExpr<MatxRef<Tp, M, N>, Tp, M, N>
+{
+public:
+    static constexpr bool cheap = true;
+
+    explicit MatxRef(const cv::Matx<Tp, M, N> &m) : _m(m) {}
+
+    Tp operator()(int i, int j) const { return _m(i, j); }
+
+private:
+    const cv::Matx<Tp, M, N> &_m;
+};
+
+namespace helper
+{
+
+//! @cond
+
+// 矩阵乘法操作数的存储类型：元素访问为常数开销的表达式直接持有，
+// 复合表达式物化为 MatxVal，避免乘法循环中的重复求值
+template <typename E, typename Tp, int M, int N>
+using product_storage_t = std::conditional_t<E::cheap, E, MatxVal<Tp, M, N>>;
+
+//! @endcond
+
+} // namespace helper
+
+//! 转置表达式（视图）
+template <typename E, typename Tp, int M, int N>
+class MatxTExpr : public MatxExpr<MatxTExpr<E, Tp, M, N>, Tp, N, M>
+{
+public:
+    static constexpr bool cheap = E::cheap;
+
+    explicit MatxTExpr(const E &e) : _e(e) {}
+
+    Tp operator()(int i, int j) const { return _e(j, i); }
+
+private:
+    E _e;
+};
+
+template <typename E, typename Tp, int M, int N>
+inline auto MatxExpr<E, Tp, M, N>::t() const { return MatxTExpr<E, Tp, M, N>(derived()); }
+
+//! 逐元素加法表达式
+template <typename E1, typename E2, typename Tp, int M, int N>
+class MatxAddExpr : public MatxExpr<MatxAddExpr<E1, E2, Tp, M, N>, Tp, M, N>
+{
+public:
+    static constexpr bool cheap = E1::cheap && E2::cheap;
+
+    MatxAddExpr(const E1 &a, const E2 &b) : _a(a), _b(b) {}
+
+    Tp operator()(int i, int j) const { return _a(i, j) + _b(i, j); }
+
+private:
+    E1 _a;
+    E2 _b;
+};
+
+//! 逐元素减法表达式
+template <typename E1, typename E2, typename Tp, int M, int N>
+class MatxSubExpr : public MatxExpr<MatxSubExpr<E1, E2, Tp, M, N>, Tp, M, N>
+{
+public:
+    static constexpr bool cheap = E1::cheap && E2::cheap;
+
+    MatxSubExpr(const E1 &a, const E2 &b) : _a(a), _b(b) {}
+
+    Tp operator()(int i, int j) const { return _a(i, j) - _b(i, j); }
+
+private:
+    E1 _a;
+    E2 _b;
+};
+
+//! 数乘表达式
+template <typename E, typename Tp, int M, int N>
+class MatxScaleExpr : public MatxExpr<MatxScaleExpr<E, Tp, M, N>, Tp, M, N>
+{
+public:
+    static constexpr bool cheap = E::cheap;
+
+    MatxScaleExpr(const E &e, Tp k) : _e(e), _k(k) {}
+
+    Tp operator()(int i, int j) const { return _k * _e(i, j); }
+
+private:
+    E _e;
+    Tp _k;
+};
+
+//! 矩阵乘法表达式，复合操作数在构造时物化一次
+template <typename E1, typename E2, typename Tp, int M, int K, int N>
+class MatxProdExpr : public MatxExpr<MatxProdExpr<E1, E2, Tp, M, K, N>, Tp, M, N>
+{
+public:
+    static constexpr bool cheap = false;
+
+    MatxProdExpr(const E1 &a, const E2 &b) : _a(a), _b(b) {}
+
+    Tp operator()(int i, int j) const
+    {
+        Tp sum{};
+        for (int k = 0; k < K; ++k)
+            sum += _a(i, k) * _b(k, j);
+        return sum;
+    }
+
+private:
+    helper::product_storage_t<E1, Tp, M, K> _a;
+    helper::product_storage_t<E2, Tp, K, N> _b;
+};
+
+/**
+ * @brief 将 `cv::Matx` 包裹为表达式叶子，作为融合求值链的入口
+ *
+ * @tparam Tp 元素数据类型
+ * @tparam M 行数
+ * @tparam N 列数
+ * @param[in] m 待包裹的矩阵
+ * @return 引用该矩阵的表达式叶子
+ */
+template <typename Tp, int M, int N>
+inline MatxRef<Tp, M, N> matx(const cv::Matx<Tp, M, N> &m) { return MatxRef<Tp, M, N>(m); }
+
+////////////// 表达式间以及表达式与 cv::Matx、标量之间的运算符 //////////////
+
+template <typename E1, typename E2, typename Tp, int M, int K, int N>
+inline auto operator*(const MatxExpr<E1, Tp, M, K> &a, const MatxExpr<E2, Tp, K, N> &b) { return MatxProdExpr<E1, E2, Tp, M, K, N>(a.derived(), b.derived()); }
+
+template <typename E, typename Tp, int M, int K, int N>
+inline auto operator*(const MatxExpr<E, Tp, M, K> &a, const cv::Matx<Tp, K, N> &b) { return a.derived() * matx(b); }
+
+template <typename E, typename Tp, int M, int K, int N>
+inline auto operator*(const cv::Matx<Tp, M, K> &a, const MatxExpr<E, Tp, K, N> &b) { return matx(a) * b.derived(); }
+
+template <typename E1, typename E2, typename Tp, int M, int N>
+inline auto operator+(const MatxExpr<E1, Tp, M, N> &a, const MatxExpr<E2, Tp, M, N> &b) { return MatxAddExpr<E1, E2, Tp, M, N>(a.derived(), b.derived()); }
+
+template <typename E, typename Tp, int M, int N>
+inline auto operator+(const MatxExpr<E, Tp, M, N> &a, const cv::Matx<Tp, M, N> &b) { return a.derived() + matx(b); }
+
+template <typename E, typename Tp, int M, int N>
+inline auto operator+(const cv::Matx<Tp, M, N> &a, const MatxExpr<E, Tp, M, N> &b) { return matx(a) + b.derived(); }
+
+template <typename E1, typename E2, typename Tp, int M, int N>
+inline auto operator-(const MatxExpr<E1, Tp, M, N> &a, const MatxExpr<E2, Tp, M, N> &b) { return MatxSubExpr<E1, E2, Tp, M, N>(a.derived(), b.derived()); }
+
+template <typename E, typename Tp, int M, int N>
+inline auto operator-(const MatxExpr<E, Tp, M, N> &a, const cv::Matx<Tp, M, N> &b) { return a.derived() - matx(b); }
+
+template <typename E, typename Tp, int M, int N>
+inline auto operator-(const cv::Matx<Tp, M, N> &a, const MatxExpr<E, Tp, M, N> &b) { return matx(a) - b.derived(); }
+
+template <typename E, typename Tp, int M, int N>
+inline auto operator*(const MatxExpr<E, Tp, M, N> &e, Tp k) { return MatxScaleExpr<E, Tp, M, N>(e.derived(), k); }
+
+template <typename E, typename Tp, int M, int N>
+inline auto operator*(Tp k, const MatxExpr<E, Tp, M, N> &e) { return MatxScaleExpr<E, Tp, M, N>(e.derived(), k); }
+
+//! @} algorithm_matx_expr
+
+} // namespace rm
+
+#endif // HAVE_OPENCV
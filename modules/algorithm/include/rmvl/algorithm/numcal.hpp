@@ -11,8 +11,11 @@
 
 #pragma once
 
+#include <array>
 #include <bitset>
+#include <complex>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <valarray>
 #include <vector>
@@ -66,6 +69,48 @@ private:
     std::vector<double> _coeffs; //!< 多项式系数
 };
 
+/**
+ * @brief 定次数 N 次多项式
+ * @brief
+ * - 系数在编译期固定的多项式，Horner 求值可被完全内联、甚至在编译期完成，
+ *   适用于系数在构建时即已确定的场合，如重力补偿表
+ *
+ * @tparam N 多项式次数
+ */
+template <std::size_t N>
+class PolynomialT
+{
+public:
+    /**
+     * @brief 创建定次数多项式对象
+     * @brief
+     * - 多项式系数 \f$a_0,a_1,\cdots,a_N\f$ 用来表示多项式 \f$f(x)=a_0+a_1x+\cdots+a_Nx^N\f$
+     *
+     * @param[in] coeffs 多项式系数 \f$a_0,a_1,\cdots,a_N\f$
+     */
+    constexpr PolynomialT(const std::array<double, N + 1> &coeffs) : _coeffs(coeffs) {}
+
+    /**
+     * @brief 计算多项式在指定点的函数值
+     *
+     * @param[in] x 指定点的 x 坐标
+     * @return 多项式在指定点的函数值
+     */
+    constexpr double operator()(double x) const noexcept
+    {
+        double y{_coeffs[N]};
+        for (std::size_t i = N; i > 0; --i)
+            y = y * x + _coeffs[i - 1];
+        return y;
+    }
+
+private:
+    std::array<double, N + 1> _coeffs; //!< 多项式系数
+};
+
+template <std::size_t N>
+PolynomialT(const std::array<double, N> &) -> PolynomialT<N - 1>;
+
 ///////////////////// 函数插值 /////////////////////
 
 /**
@@ -112,6 +157,120 @@ private:
     std::vector<std::vector<double>> _diffquot; //!< 差商表
 };
 
+/**
+ * @brief 定节点函数插值器
+ * @brief
+ * - 节点在编译期固定的 Newton 插值多项式，构造时一次性算出差商表对角线，
+ *   求值退化为与 rm::PolynomialT 同量级的 Horner 迭代，可被完全内联
+ *
+ * @tparam N 插值节点数
+ */
+template <std::size_t N>
+class InterpolatorT
+{
+    static_assert(N > 0, "InterpolatorT requires at least 1 node");
+
+public:
+    /**
+     * @brief 创建定节点插值器对象，初始化 Newton 插值多项式系数
+     *
+     * @param[in] xs 已知节点的 x 坐标 \f$x_0,x_1,\cdots,x_{N-1}\f$
+     * @param[in] ys 已知节点的 y 坐标 \f$f(x_0),f(x_1),\cdots,f(x_{N-1})\f$
+     */
+    constexpr InterpolatorT(const std::array<double, N> &xs, const std::array<double, N> &ys) : _xs(xs), _coeffs(ys)
+    {
+        for (std::size_t j = 1; j < N; ++j)
+            for (std::size_t i = N - 1; i >= j; --i)
+                _coeffs[i] = (_coeffs[i] - _coeffs[i - 1]) / (_xs[i] - _xs[i - j]);
+    }
+
+    /**
+     * @brief 计算插值多项式在指定点的函数值
+     *
+     * @param[in] x 指定点的 x 坐标
+     * @return 插值多项式在指定点的函数值
+     */
+    constexpr double operator()(double x) const noexcept
+    {
+        double y{_coeffs[N - 1]};
+        for (std::size_t i = N - 1; i > 0; --i)
+            y = y * (x - _xs[i - 1]) + _coeffs[i - 1];
+        return y;
+    }
+
+private:
+    std::array<double, N> _xs;     //!< 插值节点
+    std::array<double, N> _coeffs; //!< Newton 插值多项式系数（差商表对角线）
+};
+
+template <std::size_t N>
+InterpolatorT(const std::array<double, N> &, const std::array<double, N> &) -> InterpolatorT<N>;
+
+/**
+ * @brief 均匀网格插值器
+ * @brief
+ * - 面向等间距节点表（补偿表、畸变表等）的分段线性插值：区间定位由一次乘法完成
+ *   \f$i=\lfloor(x-x_0)/h\rfloor\f$，无需逐区间查找；各区间的截距与斜率在构造时
+ *   一次性算出并连续存放，单次求值为一次乘加
+ * @brief
+ * - 弹道搜索等场景中每帧求值数百次，提供批量求值接口以复用输出缓冲区
+ * @note 指定点越界时按端部区间的斜率线性外推
+ */
+class RMVL_EXPORTS_W UniformInterpolator
+{
+public:
+    RMVL_W UniformInterpolator() = default;
+
+    /**
+     * @brief 创建均匀网格插值器对象，预计算各区间的截距与斜率
+     *
+     * @param[in] x0 首个节点的 x 坐标
+     * @param[in] step 节点间距 \f$h\f$，需为正数
+     * @param[in] ys 各节点的 y 坐标 \f$f(x_0),f(x_0+h),\cdots\f$，节点数不少于 2
+     */
+    RMVL_W UniformInterpolator(double x0, double step, const std::vector<double> &ys);
+
+    /**
+     * @brief 计算插值函数在指定点的函数值
+     *
+     * @param[in] x 指定点的 x 坐标
+     * @return 插值函数在指定点的函数值
+     */
+    RMVL_W double operator()(double x) const
+    {
+        auto i = static_cast<std::ptrdiff_t>((x - _x0) * _inv_step);
+        std::size_t idx = i < 0 ? 0 : std::min(static_cast<std::size_t>(i), _segments.size() / 2 - 1);
+        return _segments[2 * idx] + _segments[2 * idx + 1] * x;
+    }
+
+    /**
+     * @brief 批量计算插值函数在一组指定点的函数值
+     *
+     * @param[in] xs 指定点的 x 坐标列表
+     * @param[out] ys 各指定点的函数值，复用既有容量
+     */
+    void operator()(const std::vector<double> &xs, std::vector<double> &ys) const
+    {
+        ys.resize(xs.size());
+        for (std::size_t i = 0; i < xs.size(); i++)
+            ys[i] = (*this)(xs[i]);
+    }
+
+    //! @cond
+    RMVL_W inline std::vector<double> batch(const std::vector<double> &xs) const
+    {
+        std::vector<double> ys;
+        (*this)(xs, ys);
+        return ys;
+    }
+    //! @endcond
+
+private:
+    double _x0{};                  //!< 首个节点的 x 坐标
+    double _inv_step{};            //!< 节点间距的倒数
+    std::vector<double> _segments; //!< 各区间的截距与斜率（交替连续存放）
+};
+
 ////////////////// 多项式曲线拟合 //////////////////
 
 /**
@@ -146,12 +305,126 @@ private:
     std::vector<double> _coeffs;   //!< 多项式拟合曲线的系数
 };
 
+/**
+ * @brief 滑动窗口流式曲线拟合器
+ * @brief
+ * - 与 rm::CurveFitter 拟合同一形式的多项式曲线，但面向逐帧追加一个样本、在固定长度
+ *   滑动窗口上重拟合的流式场景：法方程 \f$G=A^TA\f$ 与右端 \f$b=A^Ty\f$ 在样本插入与
+ *   窗口逐出时增量更新（秩 1 修正），每帧重拟合从对全窗口样本的 \f$O(nk^2)\f$ 重建
+ *   降为 \f$O(k^2)\f$ 的修正加一次 \f$k\times k\f$ 求解，\f$k\f$ 为拟合系数个数
+ * @brief
+ * - 系数求解在求值时惰性进行，连续插入多个样本只触发一次求解；求解使用列主元 Gauss
+ *   消去，不依赖 OpenCV
+ * @note 增量逐出以减法下修法方程，长期运行累积的浮点误差远小于窗口内样本的量纲差异，
+ *       对滑动窗口长度在数百以内的逐帧拟合无实际影响
+ */
+class RMVL_EXPORTS_W CurveFitterStream
+{
+public:
+    /**
+     * @brief 创建滑动窗口流式曲线拟合器对象
+     *
+     * @param[in] order 拟合曲线的阶数，位含义与 rm::CurveFitter 一致
+     * @param[in] window 滑动窗口长度，窗口满时插入新样本将逐出最旧样本
+     */
+    RMVL_W CurveFitterStream(std::bitset<8> order, std::size_t window);
+
+    /**
+     * @brief 向滑动窗口插入新样本
+     *
+     * @param[in] x 新样本的 x 坐标
+     * @param[in] y 新样本的 y 坐标
+     */
+    RMVL_W void add(double x, double y);
+
+    /**
+     * @brief 计算拟合的多项式曲线在指定点的函数值
+     * @note 窗口内样本数少于拟合系数个数时法方程欠定，返回值无意义
+     *
+     * @param[in] x 指定点的 x 坐标
+     * @return 拟合的多项式曲线在指定点的函数值
+     */
+    RMVL_W double operator()(double x) const;
+
+    //! 窗口内的样本个数
+    RMVL_W std::size_t size() const { return _samples.size(); }
+
+private:
+    //! 以秩 1 修正更新法方程，`sign` 为 `1` 表示插入，`-1` 表示逐出
+    void rankUpdate(double x, double y, double sign);
+
+    std::vector<std::size_t> _idx;                 //!< 多项式拟合曲线的阶数（从低到高）
+    std::size_t _window{};                         //!< 滑动窗口长度
+    std::deque<std::pair<double, double>> _samples; //!< 窗口内样本
+    std::vector<double> _gram;                     //!< 法方程系数矩阵 \f$G=A^TA\f$（行主序）
+    std::vector<double> _rhs;                      //!< 法方程右端 \f$b=A^Ty\f$
+    mutable std::vector<double> _coeffs;           //!< 多项式拟合曲线的系数
+    mutable bool _dirty{};                         //!< 系数是否待重新求解
+};
+
+/**
+ * @brief 递推最小二乘辨识器
+ * @brief
+ * - 求解线性模型 \f$b=\pmb a^T\pmb x\f$ 的系数 \f$\pmb x\f$，每到达一个样本
+ *   \f$(\pmb a,b)\f$ 以秩 1 修正递推更新，等价于对全部历史样本的最小二乘解：
+ *   \f[\pmb k=\frac{P\pmb a}{1+\pmb a^TP\pmb a},\quad\pmb x\leftarrow\pmb x+
+ *   \pmb k(b-\pmb a^T\pmb x),\quad P\leftarrow P-\pmb k(P\pmb a)^T\tag1\f]
+ * @brief
+ * - 协方差矩阵 \f$P\f$ 以行主序连续存储，更新全程无动态内存分配，不依赖 OpenCV
+ */
+class RMVL_EXPORTS_W RecursiveLeastSquares
+{
+public:
+    /**
+     * @brief 创建递推最小二乘辨识器对象
+     *
+     * @param[in] dim 系数向量 \f$\pmb x\f$ 的维数
+     * @param[in] kp 协方差矩阵初值系数，即 \f$P_0=k_pI\f$，反映对系数初值 \f$\pmb 0\f$ 的不信任程度
+     */
+    RMVL_W RecursiveLeastSquares(std::size_t dim, double kp);
+
+    /**
+     * @brief 使用新样本递推更新系数向量
+     *
+     * @param[in] a 新样本的回归向量 \f$\pmb a\f$，长度必须等于维数
+     * @param[in] b 新样本的观测值 \f$b\f$
+     */
+    RMVL_W void update(const std::vector<double> &a, double b);
+
+    /**
+     * @brief 计算线性模型在指定回归向量处的输出 \f$\pmb a^T\pmb x\f$
+     *
+     * @param[in] a 指定回归向量，长度必须等于维数
+     * @return 模型输出
+     */
+    RMVL_W double operator()(const std::vector<double> &a) const;
+
+    //! 重置辨识器，系数向量清零，协方差矩阵恢复初值 \f$k_pI\f$
+    RMVL_W void reset();
+
+    //! 系数向量 \f$\pmb x\f$
+    RMVL_W const std::vector<double> &x() const { return _x; }
+
+    //! 系数向量的维数
+    RMVL_W std::size_t dim() const { return _dim; }
+
+private:
+    std::size_t _dim{};      //!< 系数向量的维数
+    double _kp{};            //!< 协方差矩阵初值系数
+    std::vector<double> _p;  //!< 协方差矩阵 \f$P\f$（行主序）
+    std::vector<double> _x;  //!< 系数向量 \f$\pmb x\f$
+    std::vector<double> _pa; //!< 增益计算缓存 \f$P\pmb a\f$
+};
+
 ///////////////// 非线性方程数值解 /////////////////
 
 /**
  * @brief 非线性方程求解器
  * @brief
  * - 使用离散 Newton 迭代法求解非线性方程，详见 @ref tutorial_modules_func_iteration
+ * @brief
+ * - 提供解析导数时切换为 Newton 迭代，每步省去一次用于近似求导的函数求值；同时提供
+ *   二阶导数时切换为三阶收敛的 Halley 迭代，进一步减少达到给定精度所需的迭代步数
  */
 class RMVL_EXPORTS_W NonlinearSolver
 {
@@ -168,7 +441,27 @@ public:
     RMVL_W NonlinearSolver(const std::function<double(double)> &f) : func(f) {}
 
     /**
-     * @brief 使用离散 Newton 迭代法求解非线性方程 \f$f(x)=0\f$
+     * @brief 创建非线性方程求解器对象，使用解析导数的 Newton 迭代
+     *
+     * @param[in] f 非线性方程 \f$f(x)=0\f$ 的函数对象 \f$f(x)\f$
+     * @param[in] df 一阶导数 \f$f'(x)\f$ 的函数对象
+     */
+    RMVL_W NonlinearSolver(const std::function<double(double)> &f, const std::function<double(double)> &df) : func(f), dfunc(df) {}
+
+    /**
+     * @brief 创建非线性方程求解器对象，使用解析导数的 Halley 迭代
+     *
+     * @param[in] f 非线性方程 \f$f(x)=0\f$ 的函数对象 \f$f(x)\f$
+     * @param[in] df 一阶导数 \f$f'(x)\f$ 的函数对象
+     * @param[in] d2f 二阶导数 \f$f''(x)\f$ 的函数对象
+     */
+    RMVL_W NonlinearSolver(const std::function<double(double)> &f, const std::function<double(double)> &df,
+                           const std::function<double(double)> &d2f) : func(f), dfunc(df), d2func(d2f) {}
+
+    /**
+     * @brief 求解非线性方程 \f$f(x)=0\f$
+     * @note 根据构造时提供的导数信息自动选择迭代法：无导数时为离散 Newton 迭代，
+     *       提供 \f$f'(x)\f$ 时为 Newton 迭代，同时提供 \f$f''(x)\f$ 时为 Halley 迭代
      *
      * @param[in] x0 迭代初始值
      * @param[in] eps 精度要求
@@ -177,7 +470,62 @@ public:
      */
     RMVL_W double operator()(double x0, double eps = 1e-5, std::size_t max_iter = 50) const;
 
-    RMVL_W_RW std::function<double(double)> func; //!< 非线性方程函数对象
+    RMVL_W_RW std::function<double(double)> func;   //!< 非线性方程函数对象
+    RMVL_W_RW std::function<double(double)> dfunc;  //!< 一阶导数函数对象，为空时使用弦截法近似求导
+    RMVL_W_RW std::function<double(double)> d2func; //!< 二阶导数函数对象，与一阶导数同时提供时启用 Halley 迭代
+};
+
+/**
+ * @brief 批量非线性方程求解器
+ * @brief
+ * - 在一次扫描中求解 \f$N\f$ 个相互独立的同族方程 \f$f(i,x_i)=0\f$，每步迭代以方程为
+ *   内层循环推进全部未收敛的根，按收敛掩码逐个方程退出，适合弹道解算中逐候选目标的
+ *   拦截方程这类逐帧成批出现的求解
+ * @brief
+ * - 上一次求解的根自动作为下一次求解的迭代初始值（暖启动）：目标逐帧连续运动时根的
+ *   帧间变化很小，暖启动通常一两步即收敛，方程数目变化时回退为给定初始值
+ */
+class RMVL_EXPORTS_W NonlinearSolverBatch
+{
+public:
+    RMVL_W NonlinearSolverBatch() = default;
+
+    /**
+     * @brief 创建批量非线性方程求解器对象
+     *
+     * @param[in] f 方程族 \f$f(i,x)=0\f$ 的函数对象，首个参数为方程下标 \f$i\f$
+     */
+    RMVL_W NonlinearSolverBatch(const std::function<double(std::size_t, double)> &f) : func(f) {}
+
+    /**
+     * @brief 创建批量非线性方程求解器对象，使用解析导数的 Newton 迭代
+     *
+     * @param[in] f 方程族 \f$f(i,x)=0\f$ 的函数对象，首个参数为方程下标 \f$i\f$
+     * @param[in] df 一阶导数 \f$\partial f(i,x)/\partial x\f$ 的函数对象
+     */
+    RMVL_W NonlinearSolverBatch(const std::function<double(std::size_t, double)> &f,
+                                const std::function<double(std::size_t, double)> &df) : func(f), dfunc(df) {}
+
+    /**
+     * @brief 在一次扫描中求解 `n` 个非线性方程 \f$f(i,x_i)=0\f$
+     *
+     * @param[in] n 方程个数
+     * @param[in] x0 迭代初始值，暖启动命中（方程个数与上一次一致）时不生效
+     * @param[in] eps 精度要求
+     * @param[in] max_iter 最大迭代次数
+     * @return 全部方程的迭代结果，引用在下一次求解前有效
+     */
+    RMVL_W const std::vector<double> &operator()(std::size_t n, double x0 = 0., double eps = 1e-5, std::size_t max_iter = 50);
+
+    //! 清空暖启动状态，下一次求解从给定初始值开始迭代
+    RMVL_W void reset() { _roots.clear(); }
+
+    RMVL_W_RW std::function<double(std::size_t, double)> func;  //!< 方程族函数对象
+    RMVL_W_RW std::function<double(std::size_t, double)> dfunc; //!< 一阶导数函数对象，为空时使用弦截法近似求导
+
+private:
+    std::vector<double> _roots;    //!< 求解结果，同时作为下一次求解的暖启动初始值
+    std::vector<uint8_t> _actives; //!< 未收敛方程掩码
 };
 
 ////////////// 常微分方程（组）数值解 //////////////
@@ -295,6 +643,347 @@ public:
     RMVL_W RungeKutta4(const Odes &fs);
 };
 
+/**
+ * @brief 定步数常微分方程（组）稠密解
+ * @brief
+ * - 由 rm::RungeKutta4T::solveDense 生成，记录每个步长端点的状态与导数，
+ *   区间内任意点的解由分段三次 Hermite 插值给出，误差与步长三阶同阶
+ *
+ * @tparam N 方程组维数
+ * @tparam M 积分步数
+ */
+template <std::size_t N, std::size_t M>
+struct OdeSolutionT
+{
+    double t0{};                                 //!< 初始位置的自变量
+    double h{};                                  //!< 步长
+    std::array<std::array<double, N>, M + 1> xs; //!< 各步长端点的状态
+    std::array<std::array<double, N>, M + 1> ks; //!< 各步长端点的导数
+
+    /**
+     * @brief 计算稠密解在指定点的状态
+     *
+     * @param[in] t 指定点的自变量，超出 \f$[t_0,t_0+Mh]\f$ 时按端点所在区段外推
+     * @return 指定点的状态 \f$\pmb x(t)\f$
+     */
+    constexpr std::array<double, N> operator()(double t) const noexcept
+    {
+        std::size_t i = t <= t0 ? 0 : static_cast<std::size_t>((t - t0) / h);
+        if (i >= M)
+            i = M - 1;
+        double s = (t - t0 - i * h) / h;
+        // 三次 Hermite 插值基函数
+        double h00 = (1 + 2 * s) * (1 - s) * (1 - s), h10 = s * (1 - s) * (1 - s);
+        double h01 = s * s * (3 - 2 * s), h11 = s * s * (s - 1);
+        std::array<double, N> retval{};
+        for (std::size_t j = 0; j < N; ++j)
+            retval[j] = h00 * xs[i][j] + h10 * h * ks[i][j] + h01 * xs[i + 1][j] + h11 * h * ks[i + 1][j];
+        return retval;
+    }
+};
+
+/**
+ * @brief 定步长 4 阶 4 级 Runge-Kutta 求解器
+ * @brief
+ * - 方程右端以模板函数对象形式传入，状态使用 `std::array` 栈上存储，单步计算可被完全内联，
+ *   求解过程不产生堆内存分配，适用于弹道积分等单帧内反复求解同一方程组的场合
+ *
+ * @tparam Fn 方程右端函数对象类型，签名为 `std::array<double, N>(double, const std::array<double, N> &)`
+ * @tparam N 方程组维数
+ */
+template <typename Fn, std::size_t N>
+class RungeKutta4T
+{
+public:
+    using StateType = std::array<double, N>;
+
+    /**
+     * @brief 创建定步长 4 阶 4 级 Runge-Kutta 常微分方程（组）数值求解器对象
+     *
+     * @param[in] fs 常微分方程（组）\f$\pmb x'=\pmb F(t,\pmb x)\f$ 的函数对象 \f$\pmb F(t,\pmb x)\f$
+     * @param[in] t0 初始位置的自变量 \f$t_0\f$
+     * @param[in] x0 初始位置的因变量 \f$\pmb x(t_0)\f$
+     */
+    constexpr RungeKutta4T(Fn fs, double t0, const StateType &x0) : _fs(std::move(fs)), _t0(t0), _x0(x0) {}
+
+    /**
+     * @brief 设置常微分方程（组）的初值
+     *
+     * @param[in] t0 初始位置的自变量 \f$t_0\f$
+     * @param[in] x0 初始位置的因变量 \f$\pmb x(t_0)\f$
+     */
+    constexpr void init(double t0, const StateType &x0) noexcept { _t0 = t0, _x0 = x0; }
+
+    /**
+     * @brief 计算常微分方程（组）的数值解
+     *
+     * @param[in] h 步长
+     * @param[in] n 迭代次数
+     * @return 从初始位置开始迭代 \f$n\f$ 次后的数值解 \f$\pmb x(t_0+nh)\f$
+     */
+    constexpr StateType solve(double h, std::size_t n) const noexcept
+    {
+        StateType x = _x0;
+        double t = _t0;
+        for (std::size_t i = 0; i < n; ++i)
+            x = step(t, x, h), t += h;
+        return x;
+    }
+
+    /**
+     * @brief 计算常微分方程（组）的稠密数值解
+     *
+     * @tparam M 积分步数
+     * @param[in] h 步长
+     * @return 覆盖 \f$[t_0,t_0+Mh]\f$ 的稠密解，任意点的状态可通过其 `operator()` 插值得到
+     */
+    template <std::size_t M>
+    constexpr OdeSolutionT<N, M> solveDense(double h) const noexcept
+    {
+        OdeSolutionT<N, M> retval{};
+        retval.t0 = _t0, retval.h = h;
+        retval.xs[0] = _x0;
+        retval.ks[0] = _fs(_t0, _x0);
+        double t = _t0;
+        for (std::size_t i = 0; i < M; ++i)
+        {
+            retval.xs[i + 1] = step(t, retval.xs[i], h);
+            t += h;
+            retval.ks[i + 1] = _fs(t, retval.xs[i + 1]);
+        }
+        return retval;
+    }
+
+private:
+    //! 经典 4 阶 4 级 Runge-Kutta 单步迭代
+    constexpr StateType step(double t, const StateType &x, double h) const noexcept
+    {
+        StateType k1 = _fs(t, x), tmp{};
+        for (std::size_t j = 0; j < N; ++j)
+            tmp[j] = x[j] + 0.5 * h * k1[j];
+        StateType k2 = _fs(t + 0.5 * h, tmp);
+        for (std::size_t j = 0; j < N; ++j)
+            tmp[j] = x[j] + 0.5 * h * k2[j];
+        StateType k3 = _fs(t + 0.5 * h, tmp);
+        for (std::size_t j = 0; j < N; ++j)
+            tmp[j] = x[j] + h * k3[j];
+        StateType k4 = _fs(t + h, tmp);
+        StateType retval{};
+        for (std::size_t j = 0; j < N; ++j)
+            retval[j] = x[j] + h / 6 * (k1[j] + 2 * k2[j] + 2 * k3[j] + k4[j]);
+        return retval;
+    }
+
+    Fn _fs;        //!< 一阶常微分方程组的函数对象 \f$\dot{\pmb x}=\pmb F(t,\pmb x)\f$
+    double _t0{};  //!< 初值的自变量 \f$t\f$
+    StateType _x0; //!< 初值的因变量 \f$\pmb x(t)\f$
+};
+
+template <typename Fn, std::size_t N>
+RungeKutta4T(Fn, double, const std::array<double, N> &) -> RungeKutta4T<Fn, N>;
+
+/**
+ * @brief 自适应步长 Dormand-Prince 5(4) 求解器
+ * @brief
+ * - 嵌入式 5 阶 / 4 阶 Runge-Kutta 对，由两解之差估计单步局部误差，PI 控制器在误差
+ *   容限内自适应调节步长：解平缓处放大步长、剧烈处细化步长，长弹道积分在同等精度下
+ *   的右端函数求值次数远少于定步长求解器
+ * @brief
+ * - 末级导数与下一步的首级导数重合（FSAL 性质），接受步不产生额外的右端函数求值；
+ *   状态使用 `std::array` 栈上存储，求解过程不产生堆内存分配
+ *
+ * @tparam Fn 方程右端函数对象类型，签名为 `std::array<double, N>(double, const std::array<double, N> &)`
+ * @tparam N 方程组维数
+ */
+template <typename Fn, std::size_t N>
+class RungeKutta45T
+{
+public:
+    using StateType = std::array<double, N>;
+
+    /**
+     * @brief 创建自适应步长 Dormand-Prince 5(4) 常微分方程（组）数值求解器对象
+     *
+     * @param[in] fs 常微分方程（组）\f$\pmb x'=\pmb F(t,\pmb x)\f$ 的函数对象 \f$\pmb F(t,\pmb x)\f$
+     * @param[in] t0 初始位置的自变量 \f$t_0\f$
+     * @param[in] x0 初始位置的因变量 \f$\pmb x(t_0)\f$
+     * @param[in] rtol 相对误差容限
+     * @param[in] atol 绝对误差容限
+     */
+    constexpr RungeKutta45T(Fn fs, double t0, const StateType &x0, double rtol = 1e-6, double atol = 1e-9)
+        : _fs(std::move(fs)), _t0(t0), _x0(x0), _rtol(rtol), _atol(atol) {}
+
+    /**
+     * @brief 设置常微分方程（组）的初值
+     *
+     * @param[in] t0 初始位置的自变量 \f$t_0\f$
+     * @param[in] x0 初始位置的因变量 \f$\pmb x(t_0)\f$
+     */
+    constexpr void init(double t0, const StateType &x0) noexcept { _t0 = t0, _x0 = x0; }
+
+    /**
+     * @brief 自适应步长积分至指定位置
+     *
+     * @param[in] tf 终止位置的自变量 \f$t_f\f$
+     * @return 终止位置的数值解 \f$\pmb x(t_f)\f$
+     */
+    StateType solve(double tf) const noexcept
+    {
+        double t = _t0, h = (tf - _t0) / 100., err_prev = 1.;
+        StateType x = _x0, k1 = _fs(t, x);
+        while (t < tf)
+        {
+            if (t + h > tf)
+                h = tf - t;
+            StateType xn{}, kn{};
+            double err = tryStep(t, x, k1, h, xn, kn);
+            if (err <= 1.)
+            {
+                t += h, x = xn, k1 = kn;
+                h *= acceptFactor(err, err_prev);
+                err_prev = std::max(err, 1e-4);
+            }
+            else
+                h *= rejectFactor(err);
+        }
+        return x;
+    }
+
+    /**
+     * @brief 自适应步长积分直至事件函数升穿零
+     * @note 事件在接受步内由三次 Hermite 插值与二分定位，定位精度与积分误差同阶，
+     *       无需以小步长逼近事件位置
+     *
+     * @tparam Ev 事件函数对象类型，签名为 `double(double, const std::array<double, N> &)`
+     * @param[in] event 事件函数 \f$g(t,\pmb x)\f$，返回值由负变为非负时积分停止
+     * @param[in] t_max 自变量上限，事件未触发时积分至此处返回
+     * @return 事件位置的自变量与数值解，事件未触发时为 \f$t_{max}\f$ 处的自变量与数值解
+     */
+    template <typename Ev>
+    std::pair<double, StateType> solveUntil(Ev event, double t_max) const noexcept
+    {
+        double t = _t0, h = (t_max - _t0) / 100., err_prev = 1.;
+        StateType x = _x0, k1 = _fs(t, x);
+        double g = event(t, x);
+        while (t < t_max)
+        {
+            if (t + h > t_max)
+                h = t_max - t;
+            StateType xn{}, kn{};
+            double err = tryStep(t, x, k1, h, xn, kn);
+            if (err > 1.)
+            {
+                h *= rejectFactor(err);
+                continue;
+            }
+            double gn = event(t + h, xn);
+            if (g < 0. && gn >= 0.)
+            {
+                // 事件在本步内触发，在 Hermite 插值解上二分定位升穿零点
+                double lo = 0., hi = 1.;
+                StateType xe = xn;
+                for (int i = 0; i < 32; ++i)
+                {
+                    double mid = 0.5 * (lo + hi);
+                    xe = hermite(x, k1, xn, kn, h, mid);
+                    event(t + mid * h, xe) < 0. ? lo = mid : hi = mid;
+                }
+                return {t + hi * h, hermite(x, k1, xn, kn, h, hi)};
+            }
+            t += h, x = xn, k1 = kn, g = gn;
+            h *= acceptFactor(err, err_prev);
+            err_prev = std::max(err, 1e-4);
+        }
+        return {t, x};
+    }
+
+private:
+    /**
+     * @brief Dormand-Prince 5(4) 试探单步
+     *
+     * @param[in] t 当前位置的自变量
+     * @param[in] x 当前位置的因变量
+     * @param[in] k1 当前位置的导数（FSAL 复用上一步的末级导数）
+     * @param[in] h 步长
+     * @param[out] xn 5 阶解
+     * @param[out] kn 步末导数，步被接受时作为下一步的 `k1`
+     * @return 按容限归一化的局部误差估计，不大于 `1` 表示步可被接受
+     */
+    double tryStep(double t, const StateType &x, const StateType &k1, double h, StateType &xn, StateType &kn) const noexcept
+    {
+        constexpr double a21 = 1. / 5;
+        constexpr double a31 = 3. / 40, a32 = 9. / 40;
+        constexpr double a41 = 44. / 45, a42 = -56. / 15, a43 = 32. / 9;
+        constexpr double a51 = 19372. / 6561, a52 = -25360. / 2187, a53 = 64448. / 6561, a54 = -212. / 729;
+        constexpr double a61 = 9017. / 3168, a62 = -355. / 33, a63 = 46732. / 5247, a64 = 49. / 176, a65 = -5103. / 18656;
+        constexpr double b1 = 35. / 384, b3 = 500. / 1113, b4 = 125. / 192, b5 = -2187. / 6784, b6 = 11. / 84;
+        // 5 阶解与 4 阶嵌入解的权系数之差，用于局部误差估计
+        constexpr double e1 = 71. / 57600, e3 = -71. / 16695, e4 = 71. / 1920, e5 = -17253. / 339200, e6 = 22. / 525, e7 = -1. / 40;
+        StateType tmp{};
+        for (std::size_t j = 0; j < N; ++j)
+            tmp[j] = x[j] + h * a21 * k1[j];
+        StateType k2 = _fs(t + h / 5., tmp);
+        for (std::size_t j = 0; j < N; ++j)
+            tmp[j] = x[j] + h * (a31 * k1[j] + a32 * k2[j]);
+        StateType k3 = _fs(t + 3. * h / 10., tmp);
+        for (std::size_t j = 0; j < N; ++j)
+            tmp[j] = x[j] + h * (a41 * k1[j] + a42 * k2[j] + a43 * k3[j]);
+        StateType k4 = _fs(t + 4. * h / 5., tmp);
+        for (std::size_t j = 0; j < N; ++j)
+            tmp[j] = x[j] + h * (a51 * k1[j] + a52 * k2[j] + a53 * k3[j] + a54 * k4[j]);
+        StateType k5 = _fs(t + 8. * h / 9., tmp);
+        for (std::size_t j = 0; j < N; ++j)
+            tmp[j] = x[j] + h * (a61 * k1[j] + a62 * k2[j] + a63 * k3[j] + a64 * k4[j] + a65 * k5[j]);
+        StateType k6 = _fs(t + h, tmp);
+        for (std::size_t j = 0; j < N; ++j)
+            xn[j] = x[j] + h * (b1 * k1[j] + b3 * k3[j] + b4 * k4[j] + b5 * k5[j] + b6 * k6[j]);
+        kn = _fs(t + h, xn);
+        double err{};
+        for (std::size_t j = 0; j < N; ++j)
+        {
+            double e = h * (e1 * k1[j] + e3 * k3[j] + e4 * k4[j] + e5 * k5[j] + e6 * k6[j] + e7 * kn[j]);
+            double scale = _atol + _rtol * std::max(std::abs(x[j]), std::abs(xn[j]));
+            err += (e / scale) * (e / scale);
+        }
+        return std::sqrt(err / N);
+    }
+
+    //! 接受步的 PI 步长调节因子，含上一步误差的积分项以抑制步长振荡
+    static double acceptFactor(double err, double err_prev) noexcept
+    {
+        double factor = SAFETY * std::pow(std::max(err, 1e-4), -0.7 / 5.) * std::pow(err_prev, 0.4 / 5.);
+        return std::clamp(factor, 0.2, 5.);
+    }
+
+    //! 拒绝步的步长收缩因子
+    static double rejectFactor(double err) noexcept { return std::max(0.2, SAFETY * std::pow(err, -1. / 5.)); }
+
+    //! 步内三次 Hermite 插值，\f$s\in[0,1]\f$ 为步内归一化位置
+    static constexpr StateType hermite(const StateType &x0, const StateType &k0, const StateType &x1, const StateType &k1, double h, double s) noexcept
+    {
+        double h00 = (1 + 2 * s) * (1 - s) * (1 - s), h10 = s * (1 - s) * (1 - s);
+        double h01 = s * s * (3 - 2 * s), h11 = s * s * (s - 1);
+        StateType retval{};
+        for (std::size_t j = 0; j < N; ++j)
+            retval[j] = h00 * x0[j] + h10 * h * k0[j] + h01 * x1[j] + h11 * h * k1[j];
+        return retval;
+    }
+
+    static constexpr double SAFETY = 0.9; //!< 步长调节安全系数
+
+    Fn _fs;          //!< 一阶常微分方程组的函数对象 \f$\dot{\pmb x}=\pmb F(t,\pmb x)\f$
+    double _t0{};    //!< 初值的自变量 \f$t\f$
+    StateType _x0;   //!< 初值的因变量 \f$\pmb x(t)\f$
+    double _rtol{};  //!< 相对误差容限
+    double _atol{};  //!< 绝对误差容限
+};
+
+template <typename Fn, std::size_t N>
+RungeKutta45T(Fn, double, const std::array<double, N> &) -> RungeKutta45T<Fn, N>;
+
+template <typename Fn, std::size_t N>
+RungeKutta45T(Fn, double, const std::array<double, N> &, double, double) -> RungeKutta45T<Fn, N>;
+
 //! @} algorithm_numcal
 
 //! @addtogroup algorithm_optimal
@@ -308,6 +997,12 @@ using Func1ds = std::vector<std::function<double(double)>>;
 using FuncNd = std::function<double(const std::valarray<double> &)>;
 //! 多元函数组
 using FuncNds = std::function<std::valarray<double>(const std::valarray<double> &)>;
+//! 支持复数求值的多元函数，用于复步微分
+using FuncNdComplex = std::function<std::complex<double>(const std::valarray<std::complex<double>> &)>;
+//! 多元函数组的雅可比矩阵函数，返回 `m×n` 雅可比矩阵的各行，`m` 为函数值个数，`n` 为自变量个数
+using FuncJac = std::function<std::vector<std::valarray<double>>(const std::valarray<double> &)>;
+//! 雅可比矩阵稀疏结构，`pattern[i]` 为第 `i` 行非零偏导所在的列索引，空表示稠密
+using SparsityPattern = std::vector<std::vector<std::size_t>>;
 
 //! 梯度/导数计算模式
 enum class DiffMode : uint8_t
@@ -341,6 +1036,7 @@ struct RMVL_EXPORTS_W_AG OptimalOptions
     RMVL_W_RW double exterior{1e3}; //!< 外罚函数系数
     RMVL_W_RW double dx{1e-2};      //!< 求解步长
     RMVL_W_RW double tol{1e-6};     //!< 误差容限
+    RMVL_W_RW bool parallel{};      //!< 是否由共享线程池并行求值，适用于目标函数求值开销较大的场合
 };
 
 /**
@@ -361,9 +1057,26 @@ RMVL_EXPORTS_W double derivative(Func1d func, double x, DiffMode mode = DiffMode
  * @param[in] x 指定位置的自变量
  * @param[in] mode 梯度计算模式，默认为中心差商 `DiffMode::Central`
  * @param[in] dx 计算偏导数时，坐标的微小增量，默认为 `1e-3`
+ * @param[in] parallel 是否由共享线程池并行计算各偏导数，各坐标方向的差商求值相互独立，
+ *                     适用于目标函数求值开销较大或维数较高的场合，默认为 `false`
+ * @return 函数在指定点的梯度向量
+ */
+RMVL_EXPORTS_W std::valarray<double> grad(FuncNd func, const std::valarray<double> &x, DiffMode mode = DiffMode::Central, double dx = 1e-3, bool parallel = false);
+
+/**
+ * @brief 计算多元函数的梯度（复步微分）
+ * @brief
+ * - 对支持复数求值的函数对象，以复步微分 \f$\partial f/\partial x_i\approx\mathrm{Im}
+ *   [f(x+\mathrm ih\pmb e_i)]/h\f$ 计算梯度：无差商的相减抵消，步长可取 `1e-100` 而结果
+ *   达到机器精度，且每个偏导数仅需一次函数求值
+ *
+ * @param[in] func 支持复数求值的多元函数
+ * @param[in] x 指定位置的自变量
+ * @param[in] dx 复步长，默认为 `1e-100`
+ * @param[in] parallel 是否由共享线程池并行计算各偏导数，默认为 `false`
  * @return 函数在指定点的梯度向量
  */
-RMVL_EXPORTS_W std::valarray<double> grad(FuncNd func, const std::valarray<double> &x, DiffMode mode = DiffMode::Central, double dx = 1e-3);
+RMVL_EXPORTS std::valarray<double> grad(const FuncNdComplex &func, const std::valarray<double> &x, double dx = 1e-100, bool parallel = false);
 
 /**
  * @brief 采用进退法确定搜索区间
@@ -395,6 +1108,18 @@ RMVL_EXPORTS_W std::pair<double, double> fminbnd(Func1d func, double x1, double
  */
 RMVL_EXPORTS_W std::pair<std::valarray<double>, double> fminunc(FuncNd func, const std::valarray<double> &x0, const OptimalOptions &options = {});
 
+/**
+ * @brief 无约束多维函数的多起点最小值搜索
+ * @brief
+ * - 各起点的搜索由共享线程池并行执行，返回所有起点中的最优结果，适用于存在多个局部极小值的非凸问题
+ *
+ * @param[in] func 多维约束函数
+ * @param[in] x0s 所有初始点
+ * @param[in] options 优化选项，参考 rm::fminunc
+ * @return `[x, fval]` 最小值点和最小值
+ */
+RMVL_EXPORTS std::pair<std::valarray<double>, double> fminunc(FuncNd func, const std::vector<std::valarray<double>> &x0s, const OptimalOptions &options = {});
+
 /**
  * @brief 有约束多维函数的最小值搜索
  *
@@ -418,6 +1143,23 @@ RMVL_EXPORTS_W std::pair<std::valarray<double>, double> fmincon(FuncNd func, con
  */
 RMVL_EXPORTS_W std::valarray<double> lsqnonlin(const FuncNds &func, const std::valarray<double> &x0, const OptimalOptions &options = {});
 
+/**
+ * @brief 非线性最小二乘求解（解析雅可比）
+ * @brief
+ * - 使用用户提供的解析雅可比矩阵函数代替有限差分，每次迭代省去逐参数的目标函数求值
+ * @brief
+ * - 提供稀疏结构时，按非零元素直接装配 \f$J^TWJ\f$ 与 \f$J^TWf\f$
+ *
+ * @param[in] func 最小二乘目标函数，参考 rm::lsqnonlin
+ * @param[in] jac 雅可比矩阵函数，返回各残差对自变量的偏导数行
+ * @param[in] x0 初始点
+ * @param[in] sparsity 雅可比矩阵的稀疏结构，默认为空，即稠密
+ * @param[in] options 优化选项，可供设置的有 `lsq_mode`、`max_iter` 和 `tol`
+ * @return 最小二乘解
+ */
+RMVL_EXPORTS std::valarray<double> lsqnonlin(const FuncNds &func, const FuncJac &jac, const std::valarray<double> &x0,
+                                             const SparsityPattern &sparsity = {}, const OptimalOptions &options = {});
+
 //! Robust 核函数
 enum class RobustMode : uint8_t
 {
@@ -439,6 +1181,20 @@ enum class RobustMode : uint8_t
  */
 RMVL_EXPORTS_W std::valarray<double> lsqnonlinRKF(const FuncNds &func, const std::valarray<double> &x0, RobustMode rb, const OptimalOptions &options = {});
 
+/**
+ * @brief 带 Robust 核函数的非线性最小二乘求解（解析雅可比）
+ *
+ * @param[in] func 最小二乘目标函数，参考 rm::lsqnonlin
+ * @param[in] jac 雅可比矩阵函数，返回各残差对自变量的偏导数行
+ * @param[in] x0 初始点
+ * @param[in] rb Robust 核函数模式，参考 rm::RobustMode ，选择 `rm::RobustMode::L2` 时退化为 `rm::lsqnonlin`
+ * @param[in] sparsity 雅可比矩阵的稀疏结构，默认为空，即稠密
+ * @param[in] options 优化选项，可供设置的有 `lsq_mode`、`max_iter` 和 `tol`
+ * @return 最小二乘解
+ */
+RMVL_EXPORTS std::valarray<double> lsqnonlinRKF(const FuncNds &func, const FuncJac &jac, const std::valarray<double> &x0, RobustMode rb,
+                                                const SparsityPattern &sparsity = {}, const OptimalOptions &options = {});
+
 //! @} algorithm_optimal
 
 } // namespace rm
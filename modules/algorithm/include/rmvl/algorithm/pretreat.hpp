@@ -13,6 +13,14 @@
 
 #ifdef HAVE_OPENCV
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 #include "rmvl/core/rmvldef.hpp"
 
 #include <opencv2/core/mat.hpp>
@@ -40,6 +48,51 @@ enum PixChannel : uint8_t
     AUTOCOLOR //!< 自动处理（未定义通道）
 };
 
+//! 图像预处理执行模式
+enum class PretreatExec : uint8_t
+{
+    Auto,     //!< 跟随全局设置，参考 rm::setPretreatExec
+    Serial,   //!< 单线程执行
+    Parallel, //!< 行分块多线程执行，使用持久的工作线程池
+};
+
+/**
+ * @brief 设置图像预处理的全局执行模式
+ * @note 初始为 `PretreatExec::Parallel`，各二值化函数的 `exec` 形参为
+ *       `PretreatExec::Auto` 时跟随此设置，也可在单次调用中指定执行模式覆盖全局设置
+ *
+ * @param[in] mode 执行模式，`PretreatExec::Serial` 或 `PretreatExec::Parallel`
+ */
+RMVL_EXPORTS_W void setPretreatExec(PretreatExec mode);
+
+/**
+ * @brief 基准测试并设置本机最快的图像预处理全局执行模式
+ * @note
+ * - 在指定尺寸的代表性图像上基准测试串行与并行二值化，将全局执行模式设置为本机最快者，
+ *   适合在启动阶段调用一次。选优结果经由 rm::tuner 选优表按 CPU 型号持久化，配置过
+ *   rm::tuner::setCacheFile 时后续启动直接命中缓存，跳过基准测试
+ *
+ * @param[in] size 代表性图像尺寸，默认为 `1280x1024`，应与实际处理的图像幅面一致
+ */
+RMVL_EXPORTS_W void tunePretreatExec(cv::Size size = cv::Size(1280, 1024));
+
+/**
+ * @brief 获取帧缓冲区分配器
+ * @note
+ * - 透明大页：分配按 2MB 对齐并圆整，且通过 `madvise` 建议内核以透明大页映射，
+ *   全幅面图像（数 MB 量级）的逐像素遍历不再频繁发生 dTLB 缺失
+ * @note
+ * - 缓存着色：各次分配的数据起始地址按页粒度轮转偏移，原图与二值图在被
+ *   rm::binary 同步遍历时不落入相同的 L2 组，避免组冲突引发的相互逐出
+ * @note
+ * - 将返回值赋给 `cv::Mat::allocator` 后，该 `cv::Mat` 的 `create` 即从本分配器
+ *   取得缓冲区，适用于相机帧缓冲区池等长生命周期、反复复用的图像，
+ *   rm::binary 新分配的输出图像亦使用本分配器
+ *
+ * @return 指向帧缓冲区分配器全局单例的指针
+ */
+RMVL_EXPORTS cv::MatAllocator *framePoolAllocator();
+
 /**
  * @brief 通道相减二值化
  *
@@ -51,18 +104,364 @@ enum PixChannel : uint8_t
  * @param[in] ch1 通道 1，可参考 rm::PixChannel
  * @param[in] ch2 通道 2，可参考 rm::PixChannel
  * @param[in] threshold 相减阈值，像素通道相减的值若小于该阈值则置 `0`，大于则置 `255`
+ * @param[in] exec 执行模式，默认为 `PretreatExec::Auto`，即跟随全局设置
  * @return 二值图像
  */
-RMVL_EXPORTS_W cv::Mat binary(cv::Mat src, uint8_t ch1, uint8_t ch2, uint8_t threshold);
+RMVL_EXPORTS_W cv::Mat binary(cv::Mat src, uint8_t ch1, uint8_t ch2, uint8_t threshold, PretreatExec exec = PretreatExec::Auto);
+
+/**
+ * @brief 通道相减二值化，结果写入指定图像
+ * @brief
+ * - 通道相减与阈值判断在一趟遍历中完成，在支持的平台上使用 SIMD 指令（SSE/AVX2/NEON）批量处理
+ * @brief
+ * - `dst` 尺寸、类型不匹配时会重新分配，预先分配好的 `dst` 可在逐帧处理中复用，避免每帧的内存分配
+ *
+ * @param[in] src 通道类型为 BGR 的原图像
+ * @param[out] dst 二值图像，类型为 `CV_8UC1`
+ * @param[in] ch1 通道 1，可参考 rm::PixChannel
+ * @param[in] ch2 通道 2，可参考 rm::PixChannel
+ * @param[in] threshold 相减阈值，像素通道相减的值若小于该阈值则置 `0`，大于则置 `255`
+ * @param[in] exec 执行模式，默认为 `PretreatExec::Auto`，即跟随全局设置
+ */
+RMVL_EXPORTS_W void binary(cv::Mat src, cv::Mat &dst, uint8_t ch1, uint8_t ch2, uint8_t threshold, PretreatExec exec = PretreatExec::Auto);
 
 /**
  * @brief 亮度阈值二值化
  *
  * @param[in] src 通道类型为 BGR 或 Mono8 的原图像
  * @param[in] threshold 亮度阈值，像素亮度小于该阈值则置 `0`，大于则置 `255`
+ * @param[in] exec 执行模式，默认为 `PretreatExec::Auto`，即跟随全局设置
+ * @return 二值图像
+ */
+RMVL_EXPORTS_W cv::Mat binary(cv::Mat src, uint8_t threshold, PretreatExec exec = PretreatExec::Auto);
+
+/**
+ * @brief 亮度阈值二值化，结果写入指定图像
+ * @brief
+ * - 灰度转换与阈值判断融合为一趟遍历，`dst` 尺寸、类型不匹配时会重新分配，
+ *   预先分配好的 `dst` 可在逐帧处理中复用，避免每帧的内存分配
+ *
+ * @param[in] src 通道类型为 BGR 或 Mono8 的原图像
+ * @param[out] dst 二值图像，类型为 `CV_8UC1`
+ * @param[in] threshold 亮度阈值，像素亮度小于该阈值则置 `0`，大于则置 `255`
+ * @param[in] exec 执行模式，默认为 `PretreatExec::Auto`，即跟随全局设置
+ */
+RMVL_EXPORTS_W void binary(cv::Mat src, cv::Mat &dst, uint8_t threshold, PretreatExec exec = PretreatExec::Auto);
+
+/**
+ * @brief 自适应阈值通道相减二值化
+ * @brief
+ * - 将图像划分为 `tiles` 个分块，逐分块统计通道差值直方图并以 Otsu 准则解算分块
+ *   阈值，场地光照变化时无需手动重新标定固定阈值，杂散轮廓明显减少
+ * @brief
+ * - 对比度过低（不含目标）的分块退回全图阈值，整图无对比度时输出全零图像
+ *
+ * @param[in] src 通道类型为 BGR 的原图像
+ * @param[in] ch1 通道 1，可参考 rm::PixChannel
+ * @param[in] ch2 通道 2，可参考 rm::PixChannel
+ * @param[in] bias 阈值偏置，叠加至各分块解算出的阈值上，正值更严格，负值更宽松
+ * @param[in] tiles 分块数（宽 × 高），默认为 `8 × 6`
+ * @param[in] exec 执行模式，默认为 `PretreatExec::Auto`，即跟随全局设置
+ * @return 二值图像
+ */
+RMVL_EXPORTS_W cv::Mat binaryAdaptive(cv::Mat src, uint8_t ch1, uint8_t ch2, double bias = 0., cv::Size tiles = cv::Size(8, 6), PretreatExec exec = PretreatExec::Auto);
+
+/**
+ * @brief 自适应阈值通道相减二值化，结果写入指定图像
+ * @note 预先分配好的 `dst` 可在逐帧处理中复用，参见 rm::binaryAdaptive
+ *
+ * @param[in] src 通道类型为 BGR 的原图像
+ * @param[out] dst 二值图像，类型为 `CV_8UC1`
+ * @param[in] ch1 通道 1，可参考 rm::PixChannel
+ * @param[in] ch2 通道 2，可参考 rm::PixChannel
+ * @param[in] bias 阈值偏置，叠加至各分块解算出的阈值上
+ * @param[in] tiles 分块数（宽 × 高），默认为 `8 × 6`
+ * @param[in] exec 执行模式，默认为 `PretreatExec::Auto`，即跟随全局设置
+ */
+RMVL_EXPORTS_W void binaryAdaptive(cv::Mat src, cv::Mat &dst, uint8_t ch1, uint8_t ch2, double bias = 0., cv::Size tiles = cv::Size(8, 6), PretreatExec exec = PretreatExec::Auto);
+
+/**
+ * @brief 自适应阈值亮度二值化
+ * @brief
+ * - 将图像划分为 `tiles` 个分块，逐分块统计亮度直方图并以 Otsu 准则解算分块阈值，
+ *   参见 rm::binaryAdaptive 通道相减版本
+ *
+ * @param[in] src 通道类型为 BGR 或 Mono8 的原图像
+ * @param[in] bias 阈值偏置，叠加至各分块解算出的阈值上
+ * @param[in] tiles 分块数（宽 × 高），默认为 `8 × 6`
+ * @param[in] exec 执行模式，默认为 `PretreatExec::Auto`，即跟随全局设置
  * @return 二值图像
  */
-RMVL_EXPORTS_W cv::Mat binary(cv::Mat src, uint8_t threshold);
+RMVL_EXPORTS_W cv::Mat binaryAdaptive(cv::Mat src, double bias = 0., cv::Size tiles = cv::Size(8, 6), PretreatExec exec = PretreatExec::Auto);
+
+/**
+ * @brief 自适应阈值亮度二值化，结果写入指定图像
+ * @note 预先分配好的 `dst` 可在逐帧处理中复用，参见 rm::binaryAdaptive
+ *
+ * @param[in] src 通道类型为 BGR 或 Mono8 的原图像
+ * @param[out] dst 二值图像，类型为 `CV_8UC1`
+ * @param[in] bias 阈值偏置，叠加至各分块解算出的阈值上
+ * @param[in] tiles 分块数（宽 × 高），默认为 `8 × 6`
+ * @param[in] exec 执行模式，默认为 `PretreatExec::Auto`，即跟随全局设置
+ */
+RMVL_EXPORTS_W void binaryAdaptive(cv::Mat src, cv::Mat &dst, double bias = 0., cv::Size tiles = cv::Size(8, 6), PretreatExec exec = PretreatExec::Auto);
+
+/**
+ * @brief 1 位/像素的位压缩二值图像
+ * @brief
+ * - 8 位二值掩码中绝大多数字节为零，按位压缩后二值化与连通域标记之间的数据量缩减为
+ *   1/8，扫描阶段的访存带宽随之等比例下降
+ * @brief
+ * - 行内按 64 位字存储，字内低位在前，即字 `w` 的第 `b` 位对应列 `64w + b`，
+ *   行尾不足一字的填充位恒为零
+ * @note 逐帧复用同一对象时，尺寸不变不会产生分配
+ */
+class RMVL_EXPORTS_W PackedBinary final
+{
+public:
+    RMVL_W PackedBinary() = default;
+
+    /**
+     * @brief 重设图像尺寸，尺寸不变时不重新分配
+     * @note 内容未定义，需经 rm::binaryPacked 等写入后方可读取
+     *
+     * @param[in] rows 行数
+     * @param[in] cols 列数
+     */
+    RMVL_W void create(int rows, int cols)
+    {
+        _rows = rows, _cols = cols, _stride = (cols + 63) >> 6;
+        _data.resize(static_cast<std::size_t>(_rows) * _stride);
+    }
+
+    //! 行数
+    RMVL_W int rows() const noexcept { return _rows; }
+    //! 列数
+    RMVL_W int cols() const noexcept { return _cols; }
+    //! 行跨度（行内 64 位字数）
+    RMVL_W int stride() const noexcept { return _stride; }
+    //! 是否为空
+    RMVL_W bool empty() const noexcept { return _data.empty(); }
+
+    //! 第 `y` 行首地址
+    uint64_t *row(int y) { return _data.data() + static_cast<std::size_t>(y) * _stride; }
+    //! 第 `y` 行首地址
+    const uint64_t *row(int y) const { return _data.data() + static_cast<std::size_t>(y) * _stride; }
+
+    //! 读取像素 `(x, y)` 是否为亮像素
+    RMVL_W bool test(int x, int y) const { return (row(y)[x >> 6] >> (x & 63)) & 1; }
+
+private:
+    int _rows{};                 //!< 行数
+    int _cols{};                 //!< 列数
+    int _stride{};               //!< 行跨度（行内 64 位字数）
+    std::vector<uint64_t> _data; //!< 位图数据
+};
+
+//! 返回 64 位字最低置位位的下标（find-first-set），`x` 不得为 `0`
+inline int countrZero64(uint64_t x)
+{
+#if defined(_MSC_VER)
+    unsigned long idx{};
+    _BitScanForward64(&idx, x);
+    return static_cast<int>(idx);
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+/**
+ * @brief 在位压缩二值行中定位下一段连续亮像素行程
+ * @note 行程外逐字跳过全零字、行程内逐字跳过全亮字，字内边界由 find-first-set
+ *       直接定位，每 64 个像素至多访问一个字
+ * @code{.cpp}
+ * int col = 0, cs{}, ce{};
+ * while (rm::nextRun(bin.row(y), bin.cols(), col, cs, ce))
+ *     ... // 处理行程 [cs, ce)
+ * @endcode
+ *
+ * @param[in] row 位压缩二值行首地址，参见 rm::PackedBinary::row
+ * @param[in] cols 行内像素数
+ * @param[in out] col 扫描起始列，返回 `true` 时更新为行程终止列，可直接作为下一次调用的起点
+ * @param[out] cs 行程起始列
+ * @param[out] ce 行程终止列（不含）
+ * @return 是否找到行程，行内无更多行程时返回 `false`
+ */
+inline bool nextRun(const uint64_t *row, int cols, int &col, int &cs, int &ce)
+{
+    if (col >= cols)
+        return false;
+    const int words = (cols + 63) >> 6;
+    // 定位行程起点：行尾填充位恒为零，不会产生越界的行程
+    int w = col >> 6;
+    uint64_t x = row[w] & (~0ull << (col & 63));
+    while (x == 0)
+    {
+        if (++w >= words)
+            return false;
+        x = row[w];
+    }
+    cs = (w << 6) + countrZero64(x);
+    // 定位行程终点：对取反值做 find-first-set
+    uint64_t y = ~row[w] & (~0ull << (cs & 63));
+    while (y == 0)
+    {
+        if (++w >= words)
+        {
+            ce = col = cols;
+            return true;
+        }
+        y = ~row[w];
+    }
+    ce = std::min((w << 6) + countrZero64(y), cols);
+    col = ce;
+    return true;
+}
+
+/**
+ * @brief 通道相减二值化，输出位压缩二值图像
+ * @note 阈值判断与 rm::binary 语义一致，比较以 SIMD 批量执行后按字压位写出，
+ *       参见 rm::PackedBinary
+ *
+ * @param[in] src 原图像，类型为 `CV_8UC3`
+ * @param[out] dst 位压缩二值图像，尺寸不变时逐帧复用不产生分配
+ * @param[in] ch1 通道 1
+ * @param[in] ch2 通道 2
+ * @param[in] threshold 相减阈值，参数范围 `[0, 255]`
+ * @param[in] exec 执行模式，默认跟随全局设置
+ */
+RMVL_EXPORTS_W void binaryPacked(cv::Mat src, PackedBinary &dst, uint8_t ch1, uint8_t ch2, uint8_t threshold, PretreatExec exec = PretreatExec::Auto);
+
+/**
+ * @brief 亮度阈值二值化，输出位压缩二值图像
+ * @note 阈值判断与 rm::binary 语义一致，参见 rm::PackedBinary
+ *
+ * @param[in] src 原图像，类型为 `CV_8UC3` 或 `CV_8UC1`
+ * @param[out] dst 位压缩二值图像，尺寸不变时逐帧复用不产生分配
+ * @param[in] threshold 亮度阈值，参数范围 `[0, 255]`
+ * @param[in] exec 执行模式，默认跟随全局设置
+ */
+RMVL_EXPORTS_W void binaryPacked(cv::Mat src, PackedBinary &dst, uint8_t threshold, PretreatExec exec = PretreatExec::Auto);
+
+/**
+ * @brief 连通域统计信息（SoA 布局）
+ * @note 各成员等长，下标 `i` 对应第 `i` 个连通域，逐帧复用同一对象可避免每帧的向量增长
+ */
+struct RMVL_EXPORTS_W_AG ConnectedComponents
+{
+    RMVL_W_RW std::vector<int> areas;             //!< 各连通域的像素数
+    RMVL_W_RW std::vector<cv::Rect> bboxes;       //!< 各连通域的包围盒
+    RMVL_W_RW std::vector<cv::Point2f> centroids; //!< 各连通域的质心
+    RMVL_W_RW std::vector<float> angles;          //!< 各连通域主轴与 x 轴的夹角（角度制，范围 `(-90, 90]`，图像坐标系 y 轴向下）
+    RMVL_W_RW std::vector<cv::Size2f> sizes;      //!< 各连通域沿主轴、次轴的等效矩形边长（长边在前）
+
+    //! 连通域个数
+    std::size_t size() const { return areas.size(); }
+
+    //! 清空各列表并保留既有容量
+    void clear()
+    {
+        areas.clear(), bboxes.clear(), centroids.clear(), angles.clear(), sizes.clear();
+    }
+};
+
+/**
+ * @brief 两趟扫描连通域标记，直接产出各连通域的统计信息
+ * @brief
+ * - `cv::findContours` 为取得轮廓点链而逐点追踪边界，指针跳转密集且每条轮廓均有点链
+ *   分配。本函数按行程（run）组织两趟扫描：第一趟按行提取行程并以并查集合并相邻行的
+ *   重叠行程（8 连通），第二趟按行程累加各连通域的面积、包围盒、质心与二阶矩，全程
+ *   顺序访存且不物化任何点链，统计量以 SoA 形式写出
+ * @brief
+ * - 行程提取在支持的平台上以 SIMD 批量跳过全零、全亮的向量块，稀疏二值图的扫描开销
+ *   接近按字节读带宽
+ * @note 主轴由二阶中心矩解算，`sizes` 为具有相同二阶矩的等效矩形边长
+ *       \f$\sqrt{12\lambda}\f$，对灯条这类近矩形连通域即为其长宽
+ *
+ * @param[in] bin 二值图像，类型为 `CV_8UC1`
+ * @param[out] stats 连通域统计信息，追加前被清空（保留容量）
+ * @param[in] min_area 面积下限（像素数），小于该值的连通域被过滤，默认为 `1`
+ */
+RMVL_EXPORTS_W void connectedComponents(cv::Mat bin, ConnectedComponents &stats, int min_area = 1);
+
+/**
+ * @brief 两趟扫描连通域标记（位压缩二值图像输入）
+ * @note 语义与 `CV_8UC1` 版本一致，行程提取以 rm::nextRun 逐字扫描完成，
+ *       与 rm::binaryPacked 串联时扫描阶段的访存带宽缩减为字节掩码的 1/8
+ *
+ * @param[in] bin 位压缩二值图像
+ * @param[out] stats 连通域统计信息，追加前被清空（保留容量）
+ * @param[in] min_area 面积下限（像素数），小于该值的连通域被过滤，默认为 `1`
+ */
+RMVL_EXPORTS_W void connectedComponents(const PackedBinary &bin, ConnectedComponents &stats, int min_area = 1);
+
+#ifdef HAVE_CUDA
+
+/**
+ * @brief 分配锁页（pinned）主机内存
+ * @note 锁页内存与设备间的传输经由 DMA 执行，不经过中间的分页暂存缓冲区，适用于
+ *       逐帧上传至设备的主机侧批量缓冲区，分配开销较大，应跨帧复用而非逐帧分配
+ *
+ * @param[in] size 字节数
+ * @return 缓冲区首地址
+ */
+RMVL_EXPORTS void *pinnedAlloc(std::size_t size);
+
+/**
+ * @brief 释放由 rm::pinnedAlloc 分配的锁页主机内存
+ *
+ * @param[in] ptr 缓冲区首地址，可为空指针
+ */
+RMVL_EXPORTS void pinnedFree(void *ptr) noexcept;
+
+/**
+ * @brief CUDA 图像预处理后端
+ * @brief
+ * - 持有锁页（pinned）主机缓冲、设备缓冲与专用 CUDA 流，原图上传按行分片流水化执行，
+ *   分片的核函数与后续分片的上传在设备上重叠，各缓冲区跨帧复用，容量不增长时不产生分配
+ * @brief
+ * - `stream()` 返回底层计算流句柄，可经由 rm::setOrtCudaStream 与 `OrtProvider::CUDA`
+ *   会话共享，预处理与推理在同一 CUDA 流上顺序排队，省去设备级同步
+ */
+class RMVL_EXPORTS CudaPretreat
+{
+    RMVL_IMPL;
+
+public:
+    CudaPretreat();
+
+    //! @cond
+    CudaPretreat(const CudaPretreat &) = delete;
+    CudaPretreat(CudaPretreat &&) = default;
+    CudaPretreat &operator=(const CudaPretreat &) = delete;
+    CudaPretreat &operator=(CudaPretreat &&) = default;
+    //! @endcond
+
+    /**
+     * @brief 通道相减二值化（设备端），语义与 rm::binary 一致
+     *
+     * @param[in] src 通道类型为 BGR 的原图像
+     * @param[out] dst 二值图像，类型为 `CV_8UC1`
+     * @param[in] ch1 通道 1，可参考 rm::PixChannel
+     * @param[in] ch2 通道 2，可参考 rm::PixChannel
+     * @param[in] threshold 相减阈值，像素通道相减的值若小于该阈值则置 `0`，大于则置 `255`
+     */
+    void binary(const cv::Mat &src, cv::Mat &dst, uint8_t ch1, uint8_t ch2, uint8_t threshold);
+
+    /**
+     * @brief 亮度阈值二值化（设备端），语义与 rm::binary 一致
+     *
+     * @param[in] src 通道类型为 BGR 或 Mono8 的原图像
+     * @param[out] dst 二值图像，类型为 `CV_8UC1`
+     * @param[in] threshold 亮度阈值，像素亮度小于该阈值则置 `0`，大于则置 `255`
+     */
+    void binary(const cv::Mat &src, cv::Mat &dst, uint8_t threshold);
+
+    //! 获取底层 CUDA 计算流句柄 `cudaStream_t`
+    void *stream() const noexcept;
+};
+
+#endif // HAVE_CUDA
 
 //! @} algorithm_pretreat
 
@@ -79,6 +79,48 @@ RMVL_EXPORTS_W inline cv::Point2f cameraConvertToPixel(const cv::Matx33f &camera
     return cameraConvertToPixel(cameraMatrix, distCoeffs, cv::Vec3f(center3d));
 }
 
+/**
+ * @brief 批量刚体坐标变换
+ * @note 对一组点施加同一旋转与平移 \f$x_i'=Rx_i+t\f$，旋转系数展开为标量后在连续数组上顺序扫描，
+ *       循环可被编译器自动向量化，适用于角点集合在坐标系之间的批量转换
+ *
+ * @param[in] R 旋转矩阵
+ * @param[in] t 平移向量
+ * @param[in] src 源点数组首地址
+ * @param[out] dst 目标点数组首地址，可与 `src` 相同，即就地变换
+ * @param[in] num 点的个数
+ */
+RMVL_EXPORTS void transformPoints(const cv::Matx33f &R, const cv::Vec3f &t, const cv::Point3f *src, cv::Point3f *dst, std::size_t num);
+
+/**
+ * @brief 批量刚体坐标变换
+ *
+ * @param[in] R 旋转矩阵
+ * @param[in] t 平移向量
+ * @param[in] points 待变换的点集
+ * @return 变换后的点集
+ */
+RMVL_EXPORTS_W std::vector<cv::Point3f> transformPoints(const cv::Matx33f &R, const cv::Vec3f &t, const std::vector<cv::Point3f> &points);
+
+/**
+ * @brief 复合两次刚体变换
+ * @note 先施加 \f$(R_1,t_1)\f$ 再施加 \f$(R_2,t_2)\f$ 的链式变换等价于单次变换
+ *       \f$(R_2R_1,\ R_2t_1+t_2)\f$，相机 → 世界 → 预测等多级坐标转换可先复合为单次变换，
+ *       再对点集做一次批量变换
+ *
+ * @param[in] R1 第一次变换的旋转矩阵
+ * @param[in] t1 第一次变换的平移向量
+ * @param[in] R2 第二次变换的旋转矩阵
+ * @param[in] t2 第二次变换的平移向量
+ * @param[out] R 复合后的旋转矩阵
+ * @param[out] t 复合后的平移向量
+ */
+inline void composeRT(const cv::Matx33f &R1, const cv::Vec3f &t1, const cv::Matx33f &R2, const cv::Vec3f &t2, cv::Matx33f &R, cv::Vec3f &t)
+{
+    R = R2 * R1;
+    t = R2 * t1 + t2;
+}
+
 /**
  * @brief 欧拉角转换为旋转矩阵
  *
@@ -105,6 +147,185 @@ inline cv::Matx<Tp, 3, 3> euler2Mat(Tp val, EulerAxis axis)
     }
 }
 
+/**
+ * @brief 单位四元数 \f$q=w+x\boldsymbol i+y\boldsymbol j+z\boldsymbol k\f$
+ * @note 以四元数表示三维旋转，组合旋转只需 16 次乘法且无需三角函数，链式姿态运算中
+ *       不存在欧拉角在大俯仰角附近的病态问题，需要与 OpenCV 交互时再转换为旋转矩阵
+ */
+struct Quaternion
+{
+    float w = 1.f; //!< 实部
+    float x = 0.f; //!< 虚部 \f$\boldsymbol i\f$ 分量
+    float y = 0.f; //!< 虚部 \f$\boldsymbol j\f$ 分量
+    float z = 0.f; //!< 虚部 \f$\boldsymbol k\f$ 分量
+
+    //! 默认构造单位元，即无旋转
+    constexpr Quaternion() = default;
+
+    /**
+     * @brief 以各分量构造四元数
+     *
+     * @param[in] qw 实部
+     * @param[in] qx 虚部 \f$\boldsymbol i\f$ 分量
+     * @param[in] qy 虚部 \f$\boldsymbol j\f$ 分量
+     * @param[in] qz 虚部 \f$\boldsymbol k\f$ 分量
+     */
+    constexpr Quaternion(float qw, float qx, float qy, float qz) : w(qw), x(qx), y(qy), z(qz) {}
+
+    /**
+     * @brief 从旋转矩阵构造单位四元数
+     * @note 采用 Shepperd 方法，按迹与对角元选取数值最大的分量作为除数，避免接近
+     *       180° 旋转时的精度损失
+     *
+     * @param[in] R 旋转矩阵
+     */
+    explicit Quaternion(const cv::Matx33f &R)
+    {
+        float tr = R(0, 0) + R(1, 1) + R(2, 2);
+        if (tr > 0.f)
+        {
+            float s = std::sqrt(tr + 1.f) * 2.f;
+            w = s / 4.f, x = (R(2, 1) - R(1, 2)) / s, y = (R(0, 2) - R(2, 0)) / s, z = (R(1, 0) - R(0, 1)) / s;
+        }
+        else if (R(0, 0) > R(1, 1) && R(0, 0) > R(2, 2))
+        {
+            float s = std::sqrt(1.f + R(0, 0) - R(1, 1) - R(2, 2)) * 2.f;
+            w = (R(2, 1) - R(1, 2)) / s, x = s / 4.f, y = (R(0, 1) + R(1, 0)) / s, z = (R(0, 2) + R(2, 0)) / s;
+        }
+        else if (R(1, 1) > R(2, 2))
+        {
+            float s = std::sqrt(1.f - R(0, 0) + R(1, 1) - R(2, 2)) * 2.f;
+            w = (R(0, 2) - R(2, 0)) / s, x = (R(0, 1) + R(1, 0)) / s, y = s / 4.f, z = (R(1, 2) + R(2, 1)) / s;
+        }
+        else
+        {
+            float s = std::sqrt(1.f - R(0, 0) - R(1, 1) + R(2, 2)) * 2.f;
+            w = (R(1, 0) - R(0, 1)) / s, x = (R(0, 2) + R(2, 0)) / s, y = (R(1, 2) + R(2, 1)) / s, z = s / 4.f;
+        }
+    }
+
+    /**
+     * @brief 四元数乘法，即旋转的组合
+     * @note 先施加 \f$q_2\f$ 再施加 \f$q_1\f$ 的旋转等价于单次旋转 \f$q_1q_2\f$，
+     *       与旋转矩阵乘法的组合顺序一致
+     *
+     * @param[in] q 右操作数
+     * @return 组合后的四元数
+     */
+    constexpr Quaternion operator*(const Quaternion &q) const
+    {
+        return {w * q.w - x * q.x - y * q.y - z * q.z,
+                w * q.x + x * q.w + y * q.z - z * q.y,
+                w * q.y - x * q.z + y * q.w + z * q.x,
+                w * q.z + x * q.y - y * q.x + z * q.w};
+    }
+
+    //! 共轭四元数，单位四元数的共轭即为其逆，对应反向旋转
+    constexpr Quaternion conj() const { return {w, -x, -y, -z}; }
+
+    //! 四元数的模长
+    float norm() const { return std::sqrt(w * w + x * x + y * y + z * z); }
+
+    //! 归一化，抵消长旋转链中浮点误差引起的模长漂移
+    Quaternion normalized() const
+    {
+        float n = norm();
+        return {w / n, x / n, y / n, z / n};
+    }
+
+    /**
+     * @brief 旋转三维向量
+     * @note 采用两次叉乘展开 \f$v'=v+2w(q_v\times v)+2q_v\times(q_v\times v)\f$，
+     *       其中 \f$q_v=(x,y,z)\f$，无需构造旋转矩阵
+     *
+     * @param[in] v 待旋转的向量
+     * @return 旋转后的向量
+     */
+    cv::Vec3f rotate(const cv::Vec3f &v) const
+    {
+        cv::Vec3f qv{x, y, z};
+        cv::Vec3f t = 2.f * qv.cross(v);
+        return v + w * t + qv.cross(t);
+    }
+
+    //! 转换为旋转矩阵
+    cv::Matx33f toMat() const
+    {
+        float xx = x * x, yy = y * y, zz = z * z;
+        float xy = x * y, xz = x * z, yz = y * z;
+        float wx = w * x, wy = w * y, wz = w * z;
+        return {1 - 2 * (yy + zz), 2 * (xy - wz), 2 * (xz + wy),
+                2 * (xy + wz), 1 - 2 * (xx + zz), 2 * (yz - wx),
+                2 * (xz - wy), 2 * (yz + wx), 1 - 2 * (xx + yy)};
+    }
+};
+
+/**
+ * @brief 欧拉角转换为单位四元数
+ *
+ * @param[in] val 角度数值（弧度制）
+ * @param[in] axis 转轴
+ * @return 绕指定轴旋转的单位四元数
+ */
+inline Quaternion euler2Quat(float val, EulerAxis axis)
+{
+    float s = std::sin(val / 2), c = std::cos(val / 2);
+    switch (axis)
+    {
+    case EulerAxis::X:
+        return {c, s, 0, 0};
+    case EulerAxis::Y:
+        return {c, 0, s, 0};
+    case EulerAxis::Z:
+        return {c, 0, 0, s};
+    default:
+        RMVL_Error_(RMVL_StsBadArg, "Bad argument of the \"axis\": %d", static_cast<int>(axis));
+        return {};
+    }
+}
+
+/**
+ * @brief 批量组合四元数
+ * @note 对一组姿态左乘同一旋转 \f$q_i'=qq_i\f$，循环体内仅含乘加运算，可被编译器自动向量化，
+ *       适用于整车装甲板等多姿态链的同步旋转
+ *
+ * @param[in] q 左乘的旋转四元数
+ * @param[in] src 源四元数数组首地址
+ * @param[out] dst 目标四元数数组首地址，可与 `src` 相同，即就地组合
+ * @param[in] num 四元数的个数
+ */
+RMVL_EXPORTS void composeQuats(const Quaternion &q, const Quaternion *src, Quaternion *dst, std::size_t num);
+
+/**
+ * @brief 批量组合四元数
+ *
+ * @param[in] q 左乘的旋转四元数
+ * @param[in] quats 待组合的四元数集合
+ * @return 组合后的四元数集合
+ */
+RMVL_EXPORTS std::vector<Quaternion> composeQuats(const Quaternion &q, const std::vector<Quaternion> &quats);
+
+/**
+ * @brief 批量旋转三维点
+ * @note 四元数仅展开一次为旋转系数，点集在连续数组上顺序扫描，等价于零平移的
+ *       @ref transformPoints
+ *
+ * @param[in] q 旋转四元数
+ * @param[in] src 源点数组首地址
+ * @param[out] dst 目标点数组首地址，可与 `src` 相同，即就地旋转
+ * @param[in] num 点的个数
+ */
+RMVL_EXPORTS void rotatePoints(const Quaternion &q, const cv::Point3f *src, cv::Point3f *dst, std::size_t num);
+
+/**
+ * @brief 批量旋转三维点
+ *
+ * @param[in] q 旋转四元数
+ * @param[in] points 待旋转的点集
+ * @return 旋转后的点集
+ */
+RMVL_EXPORTS std::vector<cv::Point3f> rotatePoints(const Quaternion &q, const std::vector<cv::Point3f> &points);
+
 //! @} algorithm
 
 } // namespace rm
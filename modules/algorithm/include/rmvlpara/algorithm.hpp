@@ -0,0 +1,92 @@
+/**
+ * @file algorithm.hpp
+ * @author RMVL Community
+ * @brief AlgorithmParam module header file, without opencv (Generated by CMake automatically, DO NOT MODIFY!)
+ * 
+ * @copyright Copyright 2026 (c), RMVL Community
+ * 
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rmvl/core/rmvldef.hpp"
+
+//! @addtogroup para
+//! @{
+//! @defgroup para_algorithm algorithm 的参数模块
+//! @addtogroup para_algorithm
+//! @{
+//! @brief 与 @ref algorithm 相关的参数模块，包含...
+//! @} para_algorithm
+//! @} para
+
+namespace rm::para
+{
+
+//! @addtogroup para_algorithm
+//! @{
+//! @details
+//! - 类名： AlgorithmParam ，对应的全局参数变量： `rm::para::algorithm_param`
+//! @} para_algorithm
+
+//! @addtogroup para_algorithm
+//! @{
+
+////////////////////// 扩展部分 //////////////////////
+
+
+////////////////////// 参数部分 //////////////////////
+
+/**
+ * @brief AlgorithmParam 参数模块
+ * @note
+ * - 不受 OpenCV 支持，无法实现运行时参数加载
+ * @note
+ * - 无法包含 OpenCV 中有关矩阵、向量、点等数据结构
+ */
+class RMVL_EXPORTS_W AlgorithmParam
+{
+public:
+    RMVL_W AlgorithmParam() = default;
+
+    //! 离散Newton弦截法用于近似求导的步长 @note 默认值：`1e-3`
+    RMVL_W_RW double SECANT_STEP = 1e-3;
+
+};
+
+//! AlgorithmParam 参数模块 @note 此参数对象不受 OpenCV 支持
+RMVL_W_RW inline AlgorithmParam algorithm_param;
+
+//! @cond
+inline std::shared_ptr<const AlgorithmParam> _algorithm_snap{std::make_shared<const AlgorithmParam>()};
+//! @endcond
+
+/**
+ * @brief 获取 AlgorithmParam 的不可变参数快照
+ * @note 每帧获取一次快照指针，帧内热路径从快照按字段读取，读取无锁且不会在并发调参时发生撕裂
+ *
+ * @return 最近一次通过 `algorithm_update` 发布的参数快照
+ */
+inline std::shared_ptr<const AlgorithmParam> algorithm_snapshot() { return std::atomic_load_explicit(&_algorithm_snap, std::memory_order_acquire); }
+
+/**
+ * @brief 原子发布新的 AlgorithmParam 参数
+ * @note 供调参界面等写者使用，发布后获取的快照立即可见新参数，同时同步至
+ *       `algorithm_param` 以兼容直接按字段读取的代码
+ *
+ * @param[in] data 待发布的参数
+ */
+inline void algorithm_update(const AlgorithmParam &data)
+{
+    algorithm_param = data;
+    std::atomic_store_explicit(&_algorithm_snap, std::make_shared<const AlgorithmParam>(data), std::memory_order_release);
+}
+
+//! @} para_algorithm
+
+} // namespace rm::para
@@ -0,0 +1,68 @@
+/**
+ * @file perf_munkres.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief KM 算法求解器基准测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "rmvl/algorithm/math.hpp"
+
+namespace rm_test
+{
+
+//! 生成 n×n 随机代价矩阵
+static std::vector<std::vector<double>> randomCosts(std::size_t n, unsigned seed = 42)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dis(0., 100.);
+    std::vector<std::vector<double>> costs(n, std::vector<double>(n));
+    for (auto &row : costs)
+        for (auto &val : row)
+            val = dis(gen);
+    return costs;
+}
+
+// 完整求解：每次从头构造求解器
+static void munkres_cold(benchmark::State &state)
+{
+    auto costs = randomCosts(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        rm::Munkres solver(costs);
+        auto idx = solver.solve();
+        benchmark::DoNotOptimize(idx);
+    }
+}
+
+// 增量求解：代价矩阵逐帧小幅扰动，热启动复用对偶变量
+static void munkres_warm(benchmark::State &state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto costs = randomCosts(n);
+    rm::MunkresEngine engine(costs);
+    benchmark::DoNotOptimize(engine.solve());
+    std::mt19937 gen(123);
+    std::uniform_real_distribution<double> noise(-1., 1.);
+    for (auto _ : state)
+    {
+        for (auto &row : costs)
+            for (auto &val : row)
+                val += noise(gen);
+        engine.updateCosts(costs);
+        auto idx = engine.solve();
+        benchmark::DoNotOptimize(idx);
+    }
+}
+
+BENCHMARK(munkres_cold)->Name("munkres (cold start) - by rmvl")->Arg(8)->Arg(32);
+BENCHMARK(munkres_warm)->Name("munkres (warm start) - by rmvl")->Arg(8)->Arg(32);
+
+} // namespace rm_test
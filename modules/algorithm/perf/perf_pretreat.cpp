@@ -16,10 +16,21 @@
 #include <opencv2/imgproc.hpp>
 
 #include "rmvl/algorithm/pretreat.hpp"
+#include "rmvl/core/pmu.hpp"
 
 namespace rm_test
 {
 
+//! 将区段内的硬件性能计数增量写入基准测试的自定义计数器，用于区分访存受限与计算受限
+static void addPmuCounters(benchmark::State &state, const rm::PmuCounts &delta)
+{
+    if (delta.instructions == 0)
+        return;
+    state.counters["IPC"] = delta.ipc();
+    state.counters["Cache_MPKI"] = delta.cacheMpki();
+    state.counters["Branch_MPKI"] = delta.branchMpki();
+}
+
 // binary 方法通道相减
 void binary_BGR2Binary(benchmark::State &state)
 {
@@ -29,8 +40,10 @@ void binary_BGR2Binary(benchmark::State &state)
     channel[2] = cv::Mat(cv::Size(400, 1024), CV_8UC3, cv::Scalar(0, 0, 255));
     cv::Mat src;
     hconcat(channel, 3, src);
+    auto pmu_start = rm::threadPmu().snapshot();
     for (auto _ : state)
         cv::Mat bin = binary(src, rm::BLUE, rm::RED, 80);
+    addPmuCounters(state, rm::threadPmu().snapshot() - pmu_start);
 }
 
 // threshold 方法通道相减
@@ -42,6 +55,7 @@ void threshold_BGR2Binary(benchmark::State &state)
     channel[2] = cv::Mat(1024, 400, CV_8UC3, {0, 0, 255});
     cv::Mat src;
     hconcat(channel, 3, src);
+    auto pmu_start = rm::threadPmu().snapshot();
     for (auto _ : state)
     {
         cv::Mat chs[3];
@@ -49,6 +63,7 @@ void threshold_BGR2Binary(benchmark::State &state)
         cv::Mat bin = chs[0] - chs[2];
         threshold(bin, bin, 80, 255, cv::THRESH_BINARY);
     }
+    addPmuCounters(state, rm::threadPmu().snapshot() - pmu_start);
 }
 
 // binary 方法三通道亮度二值化
@@ -60,8 +75,10 @@ void binary_brightness(benchmark::State &state)
     channel[2] = cv::Mat(1024, 400, CV_8UC3, cv::Scalar(0, 0, 255));
     cv::Mat src;
     hconcat(channel, 3, src);
+    auto pmu_start = rm::threadPmu().snapshot();
     for (auto _ : state)
         cv::Mat bin = rm::binary(src, 80);
+    addPmuCounters(state, rm::threadPmu().snapshot() - pmu_start);
 }
 
 // threshold 方法单通道亮度二值化
@@ -73,18 +90,74 @@ void threshold_brightness(benchmark::State &state)
     channel[2] = cv::Mat(cv::Size(400, 1024), CV_8UC3, cv::Scalar(0, 0, 255));
     cv::Mat src;
     hconcat(channel, 3, src);
+    auto pmu_start = rm::threadPmu().snapshot();
     for (auto _ : state)
     {
         cv::Mat bin;
         cvtColor(src, bin, cv::COLOR_BGR2GRAY);
         threshold(bin, bin, 80, 255, cv::THRESH_BINARY);
     }
+    addPmuCounters(state, rm::threadPmu().snapshot() - pmu_start);
+}
+
+//! 生成带有若干旋转灯条状连通域的二值测试图
+static cv::Mat makeBlobScene()
+{
+    cv::Mat bin = cv::Mat::zeros(1024, 1200, CV_8UC1);
+    for (int i = 0; i < 24; ++i)
+    {
+        cv::Point2f center(static_cast<float>(100 + 45 * i % 1000), static_cast<float>(100 + 37 * i % 800));
+        cv::RotatedRect rrect(center, cv::Size2f(14, 55), static_cast<float>(i * 7 % 40 - 20));
+        cv::Point2f pts[4];
+        rrect.points(pts);
+        cv::Point ipts[]{pts[0], pts[1], pts[2], pts[3]};
+        cv::fillConvexPoly(bin, ipts, 4, cv::Scalar(255));
+    }
+    return bin;
+}
+
+// 两趟扫描连通域统计，统计对象逐帧复用
+void ccl_stats(benchmark::State &state)
+{
+    cv::Mat bin = makeBlobScene();
+    rm::ConnectedComponents stats;
+    auto pmu_start = rm::threadPmu().snapshot();
+    for (auto _ : state)
+    {
+        rm::connectedComponents(bin, stats, 10);
+        benchmark::DoNotOptimize(stats.areas.data());
+    }
+    addPmuCounters(state, rm::threadPmu().snapshot() - pmu_start);
+}
+
+// findContours + 逐轮廓统计
+void contours_stats(benchmark::State &state)
+{
+    cv::Mat bin = makeBlobScene();
+    auto pmu_start = rm::threadPmu().snapshot();
+    for (auto _ : state)
+    {
+        std::vector<std::vector<cv::Point>> contours;
+        findContours(bin, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE);
+        for (const auto &contour : contours)
+        {
+            double area = contourArea(contour);
+            cv::Rect bbox = boundingRect(contour);
+            cv::RotatedRect rrect = minAreaRect(contour);
+            benchmark::DoNotOptimize(area);
+            benchmark::DoNotOptimize(bbox);
+            benchmark::DoNotOptimize(rrect);
+        }
+    }
+    addPmuCounters(state, rm::threadPmu().snapshot() - pmu_start);
 }
 
 BENCHMARK(binary_BGR2Binary)->Name("Chns Minus -   RMVL")->Iterations(20);
 BENCHMARK(threshold_BGR2Binary)->Name("Chns Minus - OpenCV")->Iterations(20);
 BENCHMARK(binary_brightness)->Name("Brightness -   RMVL")->Iterations(20);
 BENCHMARK(threshold_brightness)->Name("Brightness - OpenCV")->Iterations(20);
+BENCHMARK(ccl_stats)->Name("Blob Stats -   RMVL")->Iterations(20);
+BENCHMARK(contours_stats)->Name("Blob Stats - OpenCV")->Iterations(20);
 
 } // namespace rm_test
 
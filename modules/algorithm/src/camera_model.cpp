@@ -0,0 +1,199 @@
+/**
+ * @file camera_model.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 相机模型查找表服务
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#ifdef HAVE_OPENCV
+
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+
+#include <opencv2/calib3d.hpp>
+
+#include "rmvl/algorithm/camera_model.hpp"
+#include "rmvl/core/thread_pool.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm
+{
+
+//! 查找表缓存文件幻数
+constexpr char LUT_MAGIC[8] = {'R', 'M', 'V', 'L', 'L', 'U', 'T', '\0'};
+//! 查找表缓存文件格式版本号
+constexpr uint32_t LUT_VERSION = 1;
+
+//! 对标定参数整体计算 FNV-1a 哈希
+static uint64_t hashCalibration(const cv::Matx33f &camera_matrix, const cv::Matx51f &dist_coeffs, const cv::Size &size)
+{
+    uint64_t retval{14695981039346656037ull};
+    auto mix = [&retval](const void *data, std::size_t len) {
+        auto bytes = static_cast<const uint8_t *>(data);
+        for (std::size_t i = 0; i < len; ++i)
+            retval = (retval ^ bytes[i]) * 1099511628211ull;
+    };
+    mix(camera_matrix.val, sizeof(camera_matrix.val));
+    mix(dist_coeffs.val, sizeof(dist_coeffs.val));
+    mix(&size, sizeof(size));
+    return retval;
+}
+
+class CameraModel::Impl
+{
+public:
+    Impl(const cv::Matx33f &camera_matrix, const cv::Matx51f &dist_coeffs, const cv::Size &size, std::string_view cache_dir)
+        : _camera_matrix(camera_matrix), _dist_coeffs(dist_coeffs), _size(size)
+    {
+        if (size.width <= 0 || size.height <= 0)
+            RMVL_Error_(RMVL_StsBadArg, "Invalid LUT size: (%d, %d)", size.width, size.height);
+        _lut.resize(static_cast<std::size_t>(size.width) * size.height);
+        uint64_t hash = hashCalibration(camera_matrix, dist_coeffs, size);
+        std::string cache_path{};
+        if (!cache_dir.empty())
+        {
+            char name[32];
+            std::snprintf(name, sizeof(name), "rmvl_cam_%016llx.lut", static_cast<unsigned long long>(hash));
+            cache_path = std::string(cache_dir) + "/" + name;
+            if (load(cache_path, hash))
+                return;
+        }
+        // 逐像素迭代求解仅在首次构建时发生，按行分块分发至共享线程池
+        ThreadPool::global().parallel_for(0, size.height, [this](std::size_t start, std::size_t end) {
+            std::vector<cv::Point2f> row_pixels(_size.width), row_points;
+            for (std::size_t row = start; row < end; ++row)
+            {
+                for (int col = 0; col < _size.width; ++col)
+                    row_pixels[col] = {static_cast<float>(col), static_cast<float>(row)};
+                cv::undistortPoints(row_pixels, row_points, _camera_matrix, _dist_coeffs);
+                std::copy(row_points.begin(), row_points.end(), _lut.begin() + row * _size.width);
+            }
+        });
+        if (!cache_path.empty())
+            save(cache_path, hash);
+    }
+
+    cv::Point2f undistort(const cv::Point2f &pixel) const
+    {
+        // 查找表覆盖范围之外回退为逐点迭代求解
+        if (pixel.x < 0.f || pixel.x > _size.width - 1.f || pixel.y < 0.f || pixel.y > _size.height - 1.f)
+            return undistortIterative(pixel);
+        // 相邻整像素栅格上双线性插值
+        int x0 = static_cast<int>(pixel.x), y0 = static_cast<int>(pixel.y);
+        int x1 = std::min(x0 + 1, _size.width - 1), y1 = std::min(y0 + 1, _size.height - 1);
+        float fx = pixel.x - x0, fy = pixel.y - y0;
+        const auto &p00 = at(x0, y0), &p10 = at(x1, y0), &p01 = at(x0, y1), &p11 = at(x1, y1);
+        return (1.f - fy) * ((1.f - fx) * p00 + fx * p10) + fy * ((1.f - fx) * p01 + fx * p11);
+    }
+
+    cv::Vec3f ray(const cv::Point2f &pixel) const
+    {
+        auto point = undistort(pixel);
+        return cv::normalize(cv::Vec3f(point.x, point.y, 1.f));
+    }
+
+private:
+    //! 访问查找表指定整像素处的归一化坐标
+    const cv::Point2f &at(int x, int y) const { return _lut[static_cast<std::size_t>(y) * _size.width + x]; }
+
+    //! 逐点迭代去畸变，与 `cv::undistortPoints` 的补偿迭代一致
+    cv::Point2f undistortIterative(const cv::Point2f &pixel) const
+    {
+        const auto &a = _camera_matrix;
+        const auto &d = _dist_coeffs;
+        double xd = (pixel.x - a(0, 2)) / a(0, 0), yd = (pixel.y - a(1, 2)) / a(1, 1);
+        double x = xd, y = yd;
+        for (int i = 0; i < 5; ++i)
+        {
+            double r2 = x * x + y * y;
+            double icdist = 1. / (1. + r2 * (d(0) + r2 * (d(1) + r2 * d(4))));
+            double delta_x = 2. * d(2) * x * y + d(3) * (r2 + 2. * x * x);
+            double delta_y = d(2) * (r2 + 2. * y * y) + 2. * d(3) * x * y;
+            x = (xd - delta_x) * icdist;
+            y = (yd - delta_y) * icdist;
+        }
+        return {static_cast<float>(x), static_cast<float>(y)};
+    }
+
+    //! 从磁盘缓存加载查找表，校验失败时返回 `false` 并重新预计算
+    bool load(const std::string &path, uint64_t hash)
+    {
+        std::ifstream ifs(path, std::ios::binary);
+        if (!ifs.is_open())
+            return false;
+        char magic[8]{};
+        uint32_t version{};
+        uint64_t file_hash{};
+        cv::Size size{};
+        ifs.read(magic, sizeof(magic));
+        ifs.read(reinterpret_cast<char *>(&version), sizeof(version));
+        ifs.read(reinterpret_cast<char *>(&file_hash), sizeof(file_hash));
+        ifs.read(reinterpret_cast<char *>(&size), sizeof(size));
+        if (!ifs.good() || std::memcmp(magic, LUT_MAGIC, sizeof(magic)) != 0 ||
+            version != LUT_VERSION || file_hash != hash || size != _size)
+            return false;
+        ifs.read(reinterpret_cast<char *>(_lut.data()), _lut.size() * sizeof(cv::Point2f));
+        return ifs.good();
+    }
+
+    //! 将查找表写入磁盘缓存，目录不存在或不可写时静默跳过
+    void save(const std::string &path, uint64_t hash) const
+    {
+        std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+        if (!ofs.is_open())
+            return;
+        ofs.write(LUT_MAGIC, sizeof(LUT_MAGIC));
+        ofs.write(reinterpret_cast<const char *>(&LUT_VERSION), sizeof(LUT_VERSION));
+        ofs.write(reinterpret_cast<const char *>(&hash), sizeof(hash));
+        ofs.write(reinterpret_cast<const char *>(&_size), sizeof(_size));
+        ofs.write(reinterpret_cast<const char *>(_lut.data()), _lut.size() * sizeof(cv::Point2f));
+    }
+
+    cv::Matx33f _camera_matrix;    //!< 相机内参矩阵
+    cv::Matx51f _dist_coeffs;      //!< 相机畸变参数
+    cv::Size _size;                //!< 查找表覆盖的图像尺寸
+    std::vector<cv::Point2f> _lut; //!< 全图去畸变查找表
+};
+
+RMVL_IMPL_DEF(CameraModel)
+
+CameraModel::CameraModel(const cv::Matx33f &camera_matrix, const cv::Matx51f &dist_coeffs,
+                         const cv::Size &size, std::string_view cache_dir)
+    : _impl(new Impl(camera_matrix, dist_coeffs, size, cache_dir)) {}
+
+cv::Point2f CameraModel::undistort(const cv::Point2f &pixel) const { return _impl->undistort(pixel); }
+
+void CameraModel::undistort(const std::vector<cv::Point2f> &pixels, std::vector<cv::Point2f> &points) const
+{
+    points.resize(pixels.size());
+    for (std::size_t i = 0; i < pixels.size(); ++i)
+        points[i] = _impl->undistort(pixels[i]);
+}
+
+cv::Vec3f CameraModel::ray(const cv::Point2f &pixel) const { return _impl->ray(pixel); }
+
+const CameraModel &CameraModel::get(const cv::Matx33f &camera_matrix, const cv::Matx51f &dist_coeffs,
+                                    const cv::Size &size, std::string_view cache_dir)
+{
+    // 未指定尺寸时按主点位于图像中心推断查找表覆盖范围
+    cv::Size lut_size = size;
+    if (lut_size.empty())
+        lut_size = {2 * cvRound(camera_matrix(0, 2)), 2 * cvRound(camera_matrix(1, 2))};
+    static std::mutex mtx;
+    static std::unordered_map<uint64_t, std::unique_ptr<CameraModel>> models;
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &model = models[hashCalibration(camera_matrix, dist_coeffs, lut_size)];
+    if (model == nullptr)
+        model.reset(new CameraModel(camera_matrix, dist_coeffs, lut_size, cache_dir));
+    return *model;
+}
+
+} // namespace rm
+
+#endif // HAVE_OPENCV
@@ -0,0 +1,226 @@
+/**
+ * @file pretreat.cu
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 图像预处理 CUDA 后端
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <cuda_runtime.h>
+
+#include "rmvl/core/util.hpp"
+#include "rmvl/algorithm/pretreat.hpp"
+
+namespace rm
+{
+
+//! CUDA 运行时 API 调用检查
+#define RMVL_CUDA_CHECK(expr)                                                                  \
+    do                                                                                         \
+    {                                                                                          \
+        cudaError_t cuda_status = (expr);                                                      \
+        if (cuda_status != cudaSuccess)                                                        \
+            RMVL_Error_(RMVL_StsError, "CUDA error: \"%s\"", cudaGetErrorString(cuda_status)); \
+    } while (false)
+
+//! 上传流水线的行分片数，分片的核函数与后续分片的上传在设备上重叠
+constexpr int PIPELINE_SLICES = 4;
+//! 低于该行数时分片流水线收益为负，退化为整幅上传
+constexpr int MIN_PIPELINE_ROWS = 256;
+//! 核函数线程块大小
+constexpr int BLOCK_SIZE = 256;
+
+namespace
+{
+
+//! 通道相减二值化核函数，每线程处理一个像素
+__global__ void minusBinaryKernel(const uint8_t *src, uint8_t *bin, int n, uint8_t ch1, uint8_t ch2, uint8_t thresh)
+{
+    int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= n)
+        return;
+    int diff = src[3 * idx + ch1] - src[3 * idx + ch2];
+    bin[idx] = diff > thresh ? 255 : 0;
+}
+
+//! 亮度阈值二值化核函数（BGR 输入），灰度转换与阈值判断融合
+__global__ void brightBinaryKernel(const uint8_t *src, uint8_t *bin, int n, uint8_t thresh)
+{
+    int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= n)
+        return;
+    // BT.601 灰度转换定点系数，与 CPU 路径、cv::COLOR_BGR2GRAY 一致
+    constexpr int B2Y = 1868, G2Y = 9617, R2Y = 4899, SHIFT = 14;
+    int gray = (B2Y * src[3 * idx] + G2Y * src[3 * idx + 1] +
+                R2Y * src[3 * idx + 2] + (1 << (SHIFT - 1))) >> SHIFT;
+    bin[idx] = gray > thresh ? 255 : 0;
+}
+
+//! 亮度阈值二值化核函数（Mono8 输入）
+__global__ void brightBinaryKernel1(const uint8_t *src, uint8_t *bin, int n, uint8_t thresh)
+{
+    int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= n)
+        return;
+    bin[idx] = src[idx] > thresh ? 255 : 0;
+}
+
+} // namespace
+
+class CudaPretreat::Impl
+{
+public:
+    Impl()
+    {
+        RMVL_CUDA_CHECK(cudaStreamCreateWithFlags(&_stream, cudaStreamNonBlocking));
+        RMVL_CUDA_CHECK(cudaStreamCreateWithFlags(&_copy_stream, cudaStreamNonBlocking));
+        for (auto &event : _events)
+            RMVL_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    }
+
+    ~Impl()
+    {
+        for (auto event : _events)
+            cudaEventDestroy(event);
+        cudaStreamDestroy(_copy_stream);
+        cudaStreamDestroy(_stream);
+        cudaFreeHost(_h_src);
+        cudaFreeHost(_h_bin);
+        cudaFree(_d_src);
+        cudaFree(_d_bin);
+    }
+
+    void binary(const cv::Mat &src, cv::Mat &dst, uint8_t ch1, uint8_t ch2, uint8_t thresh)
+    {
+        run(src, dst, [=](const uint8_t *d_src, uint8_t *d_bin, int n, cudaStream_t stream) {
+            minusBinaryKernel<<<(n + BLOCK_SIZE - 1) / BLOCK_SIZE, BLOCK_SIZE, 0, stream>>>(d_src, d_bin, n, ch1, ch2, thresh);
+        });
+    }
+
+    void binary(const cv::Mat &src, cv::Mat &dst, uint8_t thresh)
+    {
+        if (src.channels() == 3)
+            run(src, dst, [=](const uint8_t *d_src, uint8_t *d_bin, int n, cudaStream_t stream) {
+                brightBinaryKernel<<<(n + BLOCK_SIZE - 1) / BLOCK_SIZE, BLOCK_SIZE, 0, stream>>>(d_src, d_bin, n, thresh);
+            });
+        else
+            run(src, dst, [=](const uint8_t *d_src, uint8_t *d_bin, int n, cudaStream_t stream) {
+                brightBinaryKernel1<<<(n + BLOCK_SIZE - 1) / BLOCK_SIZE, BLOCK_SIZE, 0, stream>>>(d_src, d_bin, n, thresh);
+            });
+    }
+
+    void *stream() const noexcept { return _stream; }
+
+private:
+    //! 按需增长主机锁页缓冲与设备缓冲，容量足够时不产生分配
+    void ensure(std::size_t src_bytes, std::size_t bin_bytes)
+    {
+        if (src_bytes > _src_capacity)
+        {
+            cudaFreeHost(_h_src);
+            cudaFree(_d_src);
+            RMVL_CUDA_CHECK(cudaMallocHost(&_h_src, src_bytes));
+            RMVL_CUDA_CHECK(cudaMalloc(&_d_src, src_bytes));
+            _src_capacity = src_bytes;
+        }
+        if (bin_bytes > _bin_capacity)
+        {
+            cudaFreeHost(_h_bin);
+            cudaFree(_d_bin);
+            RMVL_CUDA_CHECK(cudaMallocHost(&_h_bin, bin_bytes));
+            RMVL_CUDA_CHECK(cudaMalloc(&_d_bin, bin_bytes));
+            _bin_capacity = bin_bytes;
+        }
+    }
+
+    /**
+     * @brief 上传、核函数与回读的统一执行路径
+     * @note 原图先落入锁页缓冲，H2D 拷贝按行分片在拷贝流上异步执行，计算流经事件
+     *       逐分片等待，分片 `i` 的核函数与分片 `i+1` 的上传在设备上重叠
+     *
+     * @param[in] src 原图像
+     * @param[out] dst 二值图像
+     * @param[in] launch 核函数启动器，形参为设备端原图、二值图首地址、像素数与计算流
+     */
+    template <typename Launcher>
+    void run(const cv::Mat &src, cv::Mat &dst, Launcher &&launch)
+    {
+        // 尺寸、类型一致时不会重新分配，逐帧处理可复用同一块缓冲区
+        dst.create(src.rows, src.cols, CV_8UC1);
+        const std::size_t row_bytes = src.cols * src.elemSize();
+        const std::size_t src_bytes = row_bytes * src.rows;
+        const std::size_t bin_bytes = static_cast<std::size_t>(src.cols) * src.rows;
+        ensure(src_bytes, bin_bytes);
+        if (src.isContinuous())
+            std::memcpy(_h_src, src.data, src_bytes);
+        else
+            for (int row = 0; row < src.rows; ++row)
+                std::memcpy(_h_src + row * row_bytes, src.ptr(row), row_bytes);
+        const int slices = src.rows >= MIN_PIPELINE_ROWS ? PIPELINE_SLICES : 1;
+        const int slice_rows = (src.rows + slices - 1) / slices;
+        for (int i = 0; i < slices; ++i)
+        {
+            const int top = i * slice_rows;
+            const int rows = std::min(slice_rows, src.rows - top);
+            if (rows <= 0)
+                break;
+            RMVL_CUDA_CHECK(cudaMemcpyAsync(_d_src + top * row_bytes, _h_src + top * row_bytes,
+                                            rows * row_bytes, cudaMemcpyHostToDevice, _copy_stream));
+            RMVL_CUDA_CHECK(cudaEventRecord(_events[i], _copy_stream));
+            RMVL_CUDA_CHECK(cudaStreamWaitEvent(_stream, _events[i], 0));
+            launch(_d_src + top * row_bytes, _d_bin + static_cast<std::size_t>(top) * src.cols, rows * src.cols, _stream);
+            RMVL_CUDA_CHECK(cudaGetLastError());
+        }
+        // 经锁页缓冲回读，`dst.create` 产生的图像必为连续存储
+        RMVL_CUDA_CHECK(cudaMemcpyAsync(_h_bin, _d_bin, bin_bytes, cudaMemcpyDeviceToHost, _stream));
+        RMVL_CUDA_CHECK(cudaStreamSynchronize(_stream));
+        std::memcpy(dst.data, _h_bin, bin_bytes);
+    }
+
+    cudaStream_t _stream{};                    //!< 计算流，可与推理会话共享
+    cudaStream_t _copy_stream{};               //!< 上传流
+    cudaEvent_t _events[PIPELINE_SLICES]{};    //!< 逐分片的上传完成事件
+    uint8_t *_h_src{};                         //!< 原图像锁页缓冲
+    uint8_t *_h_bin{};                         //!< 二值图像锁页缓冲
+    uint8_t *_d_src{};                         //!< 原图像设备缓冲
+    uint8_t *_d_bin{};                         //!< 二值图像设备缓冲
+    std::size_t _src_capacity{};               //!< 原图像缓冲容量
+    std::size_t _bin_capacity{};               //!< 二值图像缓冲容量
+};
+
+RMVL_IMPL_DEF(CudaPretreat)
+
+CudaPretreat::CudaPretreat() : _impl(new Impl) {}
+
+void CudaPretreat::binary(const cv::Mat &src, cv::Mat &dst, uint8_t ch1, uint8_t ch2, uint8_t threshold)
+{
+    if (src.type() != CV_8UC3)
+        RMVL_Error(RMVL_StsBadArg, "The image type of \"src\" is incorrect");
+    _impl->binary(src, dst, ch1, ch2, threshold);
+}
+
+void CudaPretreat::binary(const cv::Mat &src, cv::Mat &dst, uint8_t threshold)
+{
+    if (src.type() != CV_8UC3 && src.type() != CV_8UC1)
+        RMVL_Error(RMVL_StsBadArg, "The image type of \"src\" is incorrect");
+    _impl->binary(src, dst, threshold);
+}
+
+void *CudaPretreat::stream() const noexcept { return _impl->stream(); }
+
+void *pinnedAlloc(std::size_t size)
+{
+    void *ptr{};
+    RMVL_CUDA_CHECK(cudaHostAlloc(&ptr, size, cudaHostAllocPortable));
+    return ptr;
+}
+
+void pinnedFree(void *ptr) noexcept { cudaFreeHost(ptr); }
+
+} // namespace rm
@@ -71,108 +71,452 @@ cv::Mat draw(const RealSignal &datas, const cv::Scalar &color)
     return img;
 }
 
-ComplexSignal dft(const ComplexSignal &xt)
+#endif // HAVE_OPENCV
+
+using namespace numeric_literals;
+
+FFT::FFT(std::size_t n) : _n(n)
+{
+    if (n == 0)
+        RMVL_Error(RMVL_StsBadArg, "The size of the signal must be positive.");
+    bool pow2 = (n & (n - 1)) == 0;
+    // 非 2 的幂长度使用 Bluestein 算法，卷积长度取不小于 2n-1 的最小的 2 的幂
+    _m = pow2 ? n : [](std::size_t len) { std::size_t m = 1; while (m < len) m <<= 1; return m; }(2 * n - 1);
+    // 旋转因子表与位逆序表（按卷积长度 _m 缓存）
+    _w.resize(_m / 2);
+    for (std::size_t k = 0; k < _m / 2; ++k)
+        _w[k] = std::polar(1.0, -2_PI * k / _m);
+    _rev.resize(_m);
+    for (std::size_t i = 1; i < _m; ++i)
+        _rev[i] = (_rev[i >> 1] >> 1) | ((i & 1) ? _m >> 1 : 0);
+    if (!pow2)
+    {
+        // chirp 序列 e^{-πik²/n}，指数按 k² mod 2n 计算避免大数丢失精度
+        _chirp.resize(n);
+        for (std::size_t k = 0; k < n; ++k)
+            _chirp[k] = std::polar(1.0, -1_PI * ((k * k) % (2 * n)) / n);
+        // 共轭 chirp 的频域形式，创建计划时缓存，正逆变换共用
+        std::vector<std::complex<double>> b(_m);
+        b[0] = std::conj(_chirp[0]);
+        for (std::size_t k = 1; k < n; ++k)
+            b[k] = b[_m - k] = std::conj(_chirp[k]);
+        radix2(b, _w, _rev, false);
+        _chirp_fm = std::move(b);
+    }
+}
+
+void FFT::radix2(std::vector<std::complex<double>> &data, const std::vector<std::complex<double>> &w, const std::vector<std::size_t> &rev, bool inv)
+{
+    const std::size_t n = data.size();
+    for (std::size_t i = 0; i < n; ++i)
+        if (i < rev[i])
+            std::swap(data[i], data[rev[i]]);
+    // 迭代蝶形运算，旋转因子以 w.size()*2 为基本长度按步长取用
+    for (std::size_t len = 2; len <= n; len <<= 1)
+    {
+        const std::size_t step = 2 * w.size() / len;
+        for (std::size_t i = 0; i < n; i += len)
+            for (std::size_t k = 0; k < len / 2; ++k)
+            {
+                auto wk = inv ? std::conj(w[k * step]) : w[k * step];
+                auto u = data[i + k], v = wk * data[i + k + len / 2];
+                data[i + k] = u + v, data[i + k + len / 2] = u - v;
+            }
+    }
+}
+
+void FFT::transform(std::vector<std::complex<double>> &data, bool inv) const
 {
-    const int N = static_cast<int>(xt.size());
-    // std::deque -> cv::Mat
-    cv::Mat input(1, N, CV_64FC2);
-    for (int i = 0; i < N; ++i)
-        input.at<cv::Vec2d>(0, i) = {xt[i].real(), xt[i].imag()};
-    cv::Mat output;
-    // process
-    cv::dft(input, output, cv::DFT_COMPLEX_OUTPUT);
-    ComplexSignal res(N);
-    for (int i = 0; i < N; ++i)
-        res[i] = {output.at<cv::Vec2d>(0, i)[0], output.at<cv::Vec2d>(0, i)[1]};
+    if (_n == _m) // 2 的幂长度，直接原位蝶形运算
+    {
+        radix2(data, _w, _rev, inv);
+        return;
+    }
+    // Bluestein：x[k]·chirp[k] 与共轭 chirp 的循环卷积，逆变换通过共轭输入实现
+    std::vector<std::complex<double>> a(_m);
+    for (std::size_t k = 0; k < _n; ++k)
+        a[k] = (inv ? std::conj(data[k]) : data[k]) * _chirp[k];
+    radix2(a, _w, _rev, false);
+    for (std::size_t k = 0; k < _m; ++k)
+        a[k] *= _chirp_fm[k];
+    radix2(a, _w, _rev, true);
+    for (std::size_t k = 0; k < _n; ++k)
+    {
+        auto yk = a[k] / static_cast<double>(_m) * _chirp[k];
+        data[k] = inv ? std::conj(yk) : yk;
+    }
+}
 
+ComplexSignal FFT::forward(const ComplexSignal &xt) const
+{
+    if (xt.size() != _n)
+        RMVL_Error(RMVL_StsBadSize, "The size of the signal is inconsistent with the FFT plan.");
+    std::vector<std::complex<double>> data(xt.begin(), xt.end());
+    transform(data, false);
+    return ComplexSignal(data.begin(), data.end());
+}
+
+ComplexSignal FFT::inverse(const ComplexSignal &Xf) const
+{
+    if (Xf.size() != _n)
+        RMVL_Error(RMVL_StsBadSize, "The size of the signal is inconsistent with the FFT plan.");
+    std::vector<std::complex<double>> data(Xf.begin(), Xf.end());
+    transform(data, true);
+    ComplexSignal res(_n);
+    for (std::size_t i = 0; i < _n; ++i)
+        res[i] = data[i] / static_cast<double>(_n);
     return res;
 }
 
+ComplexSignal dft(const ComplexSignal &xt)
+{
+    thread_local FFT fft;
+    if (fft.size() != xt.size())
+        fft = FFT(xt.size());
+    return fft.forward(xt);
+}
+
 ComplexSignal idft(const ComplexSignal &Xf)
 {
-    const int N = static_cast<int>(Xf.size());
-    // std::deque -> cv::Mat
-    cv::Mat input(1, N, CV_64FC2);
-    for (int i = 0; i < N; ++i)
-        input.at<cv::Vec2d>(0, i) = {Xf[i].real(), Xf[i].imag()};
-    cv::Mat output;
-    // process
-    cv::dft(input, output, cv::DFT_INVERSE | cv::DFT_COMPLEX_OUTPUT);
-    ComplexSignal res(N);
-    for (int i = 0; i < N; ++i)
-        res[i] = {output.at<cv::Vec2d>(0, i)[0] / N, output.at<cv::Vec2d>(0, i)[1] / N};
+    thread_local FFT fft;
+    if (fft.size() != Xf.size())
+        fft = FFT(Xf.size());
+    return fft.inverse(Xf);
+}
 
-    return res;
+/////////////////////////////// 互相关、功率谱与重采样 ///////////////////////////////
+
+RealSignal xcorr(const RealSignal &a, const RealSignal &b)
+{
+    if (a.empty() || b.empty())
+        return {};
+    std::size_t m = a.size() + b.size() - 1;
+    // 补零至 2 的幂长度，走迭代基-2 变换
+    std::size_t n = 1;
+    while (n < m)
+        n <<= 1;
+    thread_local FFT fft;
+    if (fft.size() != n)
+        fft = FFT(n);
+    ComplexSignal pa(n), pb(n);
+    for (std::size_t i = 0; i < a.size(); ++i)
+        pa[i] = a[i];
+    for (std::size_t i = 0; i < b.size(); ++i)
+        pb[i] = b[i];
+    auto fa = fft.forward(pa), fb = fft.forward(pb);
+    // 频域相乘共轭等价于时域循环互相关
+    for (std::size_t i = 0; i < n; ++i)
+        fa[i] *= std::conj(fb[i]);
+    auto r = fft.inverse(fa);
+    // 循环互相关按滞后展开为线性互相关，负滞后位于循环结果的尾部
+    RealSignal retval(m);
+    auto zero_lag = static_cast<std::ptrdiff_t>(b.size()) - 1;
+    for (std::size_t k = 0; k < m; ++k)
+    {
+        std::ptrdiff_t lag = static_cast<std::ptrdiff_t>(k) - zero_lag;
+        retval[k] = r[(lag + n) % n].real();
+    }
+    return retval;
 }
 
-#else
+RealSignal psd(const RealSignal &x, std::size_t nfft, WindowType window)
+{
+    if (nfft < 2 || x.size() < nfft)
+        RMVL_Error(RMVL_StsBadArg, "The signal length must be no less than \"nfft\"");
+    // 窗函数与窗增益
+    std::vector<double> w(nfft, 1.);
+    for (std::size_t i = 0; i < nfft; ++i)
+    {
+        double phase = 2 * PI * i / (nfft - 1);
+        if (window == WindowType::Hann)
+            w[i] = 0.5 - 0.5 * std::cos(phase);
+        else if (window == WindowType::Hamming)
+            w[i] = 0.54 - 0.46 * std::cos(phase);
+    }
+    double gain = std::accumulate(w.begin(), w.end(), 0.);
+    thread_local FFT fft;
+    if (fft.size() != nfft)
+        fft = FFT(nfft);
+    // 段间 50% 重叠，各段加窗周期图取平均
+    RealSignal retval(nfft / 2 + 1);
+    std::size_t hop = nfft / 2, segments = 0;
+    for (std::size_t start = 0; start + nfft <= x.size(); start += hop, ++segments)
+    {
+        ComplexSignal seg(nfft);
+        for (std::size_t i = 0; i < nfft; ++i)
+            seg[i] = x[start + i] * w[i];
+        auto spec = fft.forward(seg);
+        for (std::size_t i = 0; i < retval.size(); ++i)
+            retval[i] += std::norm(spec[i]);
+    }
+    // 按窗增益校准，除直流与奈奎斯特频点外单边谱翻倍
+    for (std::size_t i = 0; i < retval.size(); ++i)
+    {
+        retval[i] /= static_cast<double>(segments) * gain * gain;
+        if (i != 0 && i != nfft / 2)
+            retval[i] *= 2;
+    }
+    return retval;
+}
 
-using namespace numeric_literals;
+std::complex<double> goertzel(const RealSignal &x, std::size_t bin)
+{
+    const std::size_t N = x.size();
+    if (N == 0)
+        return {};
+    // 二阶实系数递推 s[n] = x[n] + 2cos(ω)s[n-1] - s[n-2]，结束时一次复数运算得到频谱值
+    double omega = 2 * PI * static_cast<double>(bin) / static_cast<double>(N);
+    double coeff = 2 * std::cos(omega);
+    double s1{}, s2{};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        double s0 = x[i] + coeff * s1 - s2;
+        s2 = s1, s1 = s0;
+    }
+    return {s1 * std::cos(omega) - s2, s1 * std::sin(omega)};
+}
 
-/**
- * @brief 快速傅里叶变换递归函数
- *
- * @param[in] xt 离散时域信号
- * @param[in] N 信号长度
- * @return 离散频域信号
- */
-static inline ComplexSignal fftprocess(const ComplexSignal &xt)
+GoertzelDetector::GoertzelDetector(std::size_t window, std::size_t bin) : _window(window)
 {
-    std::size_t N = xt.size();
-    if (N == 1)
-        return xt;
-    ComplexSignal pe(N / 2), po(N / 2);
-    for (std::size_t i = 0; i < N / 2; ++i)
-        pe[i] = xt[2 * i], po[i] = xt[2 * i + 1];
-    ComplexSignal y(N);
-    auto ye = fftprocess(pe), yo = fftprocess(po);
-    for (std::size_t k = 0; k < N / 2; ++k)
+    if (window == 0)
+        RMVL_Error(RMVL_StsBadArg, "The window of \"GoertzelDetector\" must be positive");
+    if (bin >= window)
+        RMVL_Error(RMVL_StsBadArg, "The bin of \"GoertzelDetector\" must be less than the window");
+    double omega = 2 * PI * static_cast<double>(bin) / static_cast<double>(window);
+    _w = {std::cos(omega), std::sin(omega)};
+    _e.resize(window);
+    for (std::size_t m = 0; m < window; ++m)
+        _e[m] = {std::cos(omega * static_cast<double>(m)), -std::sin(omega * static_cast<double>(m))};
+}
+
+std::complex<double> GoertzelDetector::update(double x)
+{
+    RMVL_DbgAssert(_window != 0);
+    _win.push_back(x);
+    // 窗口未满时按频点系数直接累加
+    if (_win.size() <= _window)
     {
-        auto wk_yo = std::polar(1.0, -2_PI / N * k) * yo[k];
-        y[k] = ye[k] + wk_yo, y[k + N / 2] = ye[k] - wk_yo;
+        _s += x * _e[_win.size() - 1];
+        return _s;
     }
+    // 滑动更新 S ← (S + x_new - x_old)e^{2πik/N}，窗口起始随之前移一个样本
+    double oldest = _win.front();
+    _win.pop_front();
+    _s = (_s + x - oldest) * _w;
+    // 每滑动一个窗口长度，利用窗口内样本重新精确计算，消除递推舍入误差的累积
+    if (++_slides >= _window)
+    {
+        _slides = 0;
+        _s = {};
+        for (std::size_t m = 0; m < _window; ++m)
+            _s += _win[m] * _e[m];
+    }
+    return _s;
+}
+
+double GoertzelDetector::amp() const { return _win.empty() ? 0. : 2 * std::abs(_s) / static_cast<double>(_win.size()); }
 
-    return y;
+double GoertzelDetector::phase() const { return std::arg(_s); }
+
+Resampler::Resampler(std::size_t up, std::size_t down)
+{
+    if (up == 0 || down == 0)
+        RMVL_Error(RMVL_StsBadArg, "The rate of \"Resampler\" must be positive");
+    std::size_t g = std::gcd(up, down);
+    _up = up / g, _down = down / g;
+    // 每相位单侧 10 个抽头的汉宁窗 sinc 原型低通滤波器，截止频率为转换前后的较低奈奎斯特频率
+    _half = 10;
+    std::size_t len = 2 * _half * _up + 1;
+    auto center = static_cast<double>(_half * _up);
+    double cutoff = PI / static_cast<double>(std::max(_up, _down));
+    _h.resize(len);
+    for (std::size_t i = 0; i < len; ++i)
+    {
+        double t = static_cast<double>(i) - center;
+        double sinc = t == 0. ? cutoff / PI : std::sin(cutoff * t) / (PI * t);
+        double w = 0.5 - 0.5 * std::cos(2 * PI * i / (len - 1));
+        _h[i] = static_cast<double>(_up) * sinc * w;
+    }
 }
 
-static inline ComplexSignal ifftprocess(const ComplexSignal &Xf)
+RealSignal Resampler::resample(const RealSignal &x) const
 {
-    std::size_t N = Xf.size();
-    if (N == 1)
-        return Xf;
-    ComplexSignal pe(N / 2), po(N / 2);
-    for (std::size_t i = 0; i < N / 2; ++i)
-        pe[i] = Xf[2 * i], po[i] = Xf[2 * i + 1];
-    ComplexSignal y(N);
-    auto ye = ifftprocess(pe), yo = ifftprocess(po);
-    for (std::size_t k = 0; k < N / 2; ++k)
+    if (x.empty())
+        return {};
+    std::size_t out_len = (x.size() * _up + _down - 1) / _down;
+    RealSignal retval(out_len);
+    std::size_t center = _half * _up;
+    for (std::size_t m = 0; m < out_len; ++m)
     {
-        auto wk_yo = std::polar(1.0, 2_PI / N * k) * yo[k];
-        y[k] = ye[k] + wk_yo, y[k + N / 2] = ye[k] - wk_yo;
+        // 上采样率下的采样时刻（含群延迟补偿），仅累加该相位实际用到的抽头
+        std::size_t t = m * _down + center;
+        std::size_t phase = t % _up, start = t / _up;
+        double acc{};
+        for (std::size_t i = phase, k = 0; i < _h.size(); i += _up, ++k)
+        {
+            if (start < k)
+                break;
+            // 越界样本按 0 处理
+            if (start - k < x.size())
+                acc += _h[i] * x[start - k];
+        }
+        retval[m] = acc;
     }
+    return retval;
+}
+
+RealSignal resample(const RealSignal &x, std::size_t up, std::size_t down)
+{
+    if (up == 0 || down == 0)
+        RMVL_Error(RMVL_StsBadArg, "The rate of \"resample\" must be positive");
+    thread_local Resampler rs;
+    // 倍率之比一致时约分后的原型滤波器相同，可直接复用
+    if (rs.up() * down != rs.down() * up)
+        rs = Resampler(up, down);
+    return rs.resample(x);
+}
 
-    return y;
+//////////////////////////////////// 滑动窗口统计 ////////////////////////////////////
+
+MovingAverage::MovingAverage(std::size_t window) : _window(window)
+{
+    if (window == 0)
+        RMVL_Error(RMVL_StsBadArg, "The window of \"MovingAverage\" must be positive");
+    _win.reserve(window + 1);
 }
 
-ComplexSignal dft(const ComplexSignal &xt)
+double MovingAverage::update(double x)
 {
-    std::size_t N = xt.size();
-    if (std::log2(N) != std::floor(std::log2(N)))
-        RMVL_Error(RMVL_StsBadArg, "The size of the signal must be a power of 2.");
-    return fftprocess(xt);
+    _win.push_back(x);
+    _sum += x;
+    if (_win.size() > _window)
+    {
+        _sum -= _win.front();
+        _win.pop_front();
+    }
+    return _sum / static_cast<double>(_win.size());
 }
 
-ComplexSignal idft(const ComplexSignal &Xf)
+MovingMinMax::MovingMinMax(std::size_t window) : _window(window)
 {
-    std::size_t N = Xf.size();
-    if (std::log2(N) != std::floor(std::log2(N)))
-        RMVL_Error(RMVL_StsBadArg, "The size of the signal must be a power of 2.");
-    auto x = ifftprocess(Xf);
-    for (auto &xi : x)
-        xi /= static_cast<double>(N);
-    return x;
+    if (window == 0)
+        RMVL_Error(RMVL_StsBadArg, "The window of \"MovingMinMax\" must be positive");
+    _min_q.reserve(window + 1);
+    _max_q.reserve(window + 1);
 }
 
-#endif // HAVE_OPENCV
+void MovingMinMax::update(double x)
+{
+    Sample sample{x, _count++};
+    // 尾部被新样本支配的元素不可能再成为窗口极值，入队前弹出
+    while (!_min_q.empty() && _min_q.back().val >= x)
+        _min_q.pop_back();
+    _min_q.push_back(sample);
+    while (!_max_q.empty() && _max_q.back().val <= x)
+        _max_q.pop_back();
+    _max_q.push_back(sample);
+    // 弹出滑出窗口的队首元素
+    if (_min_q.front().seq + _window <= sample.seq)
+        _min_q.pop_front();
+    if (_max_q.front().seq + _window <= sample.seq)
+        _max_q.pop_front();
+}
+
+//! @cond
+
+namespace helper
+{
+
+//! 滑动窗口中值滤波的带序号样本，序号保证堆中元素互异，可按值随机删除
+struct MedianSample
+{
+    double val;   //!< 样本值
+    uint64_t seq; //!< 样本序号
+
+    bool operator<(const MedianSample &rhs) const { return val != rhs.val ? val < rhs.val : seq < rhs.seq; }
+    bool operator>(const MedianSample &rhs) const { return rhs < *this; }
+    bool operator==(const MedianSample &rhs) const { return seq == rhs.seq; }
+};
+
+} // namespace helper
+
+//! @endcond
+
+} // namespace rm
+
+template <>
+struct std::hash<rm::helper::MedianSample>
+{
+    std::size_t operator()(const rm::helper::MedianSample &sample) const noexcept { return std::hash<uint64_t>{}(sample.seq); }
+};
+
+namespace rm
+{
+
+class MovingMedian::Impl
+{
+public:
+    explicit Impl(std::size_t window) : _window(window)
+    {
+        if (window == 0)
+            RMVL_Error(RMVL_StsBadArg, "The window of \"MovingMedian\" must be positive");
+        _history.reserve(window + 1);
+    }
+
+    double update(double x)
+    {
+        helper::MedianSample sample{x, _count++};
+        // 不大于下堆堆顶的样本进入下堆（大根堆），其余进入上堆（小根堆）
+        if (_lower.empty() || sample < _lower.top())
+            _lower.push(sample);
+        else
+            _upper.push(sample);
+        _history.push_back(sample);
+        // 滑出窗口的样本从对应堆中随机删除
+        if (_history.size() > _window)
+        {
+            auto old = _history.front();
+            _history.pop_front();
+            std::size_t lower_size = _lower.size();
+            _lower.erase(old);
+            if (_lower.size() == lower_size)
+                _upper.erase(old);
+        }
+        // 再平衡：下堆的元素个数与上堆相等或恰好多 1
+        while (_lower.size() > _upper.size() + 1)
+        {
+            auto top = _lower.top();
+            _lower.pop();
+            _upper.push(top);
+        }
+        while (_upper.size() > _lower.size())
+        {
+            auto top = _upper.top();
+            _upper.pop();
+            _lower.push(top);
+        }
+        _median = _lower.size() == _upper.size() ? (_lower.top().val + _upper.top().val) / 2 : _lower.top().val;
+        return _median;
+    }
+
+    double get() const { return _median; }
+
+    std::size_t size() const { return _history.size(); }
+
+private:
+    std::size_t _window{};               //!< 窗口长度
+    uint64_t _count{};                   //!< 已推入的样本总数
+    double _median{};                    //!< 当前窗口中值
+    Signal<helper::MedianSample> _history; //!< 窗口样本（按推入顺序）
+    RaHeap<helper::MedianSample> _lower; //!< 大根堆，存放窗口内较小的一半样本
+    RaHeap<helper::MedianSample, std::vector<helper::MedianSample>, std::greater<helper::MedianSample>> _upper; //!< 小根堆，存放窗口内较大的一半样本
+};
+
+RMVL_IMPL_DEF(MovingMedian)
+
+MovingMedian::MovingMedian(std::size_t window) : _impl(new Impl(window)) {}
+double MovingMedian::update(double x) { return _impl->update(x); }
+double MovingMedian::get() const { return _impl->get(); }
+std::size_t MovingMedian::size() const { return _impl->size(); }
 
 } // namespace rm
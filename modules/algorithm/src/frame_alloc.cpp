@@ -0,0 +1,121 @@
+/**
+ * @file frame_alloc.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 帧缓冲区分配器（透明大页 + 缓存着色）
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#ifdef HAVE_OPENCV
+
+#include <atomic>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "rmvl/algorithm/pretreat.hpp"
+#include "rmvl/core/memstat.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm
+{
+
+//! 透明大页尺寸
+constexpr std::size_t HUGE_PAGE_SIZE = std::size_t(2) << 20;
+//! 缓存着色的偏移步长，取 1 页，保证不同着色的缓冲区映射至不同的 L2 组
+constexpr std::size_t COLOR_STRIDE = 4096;
+//! 缓存着色数量
+constexpr std::size_t NUM_COLORS = 8;
+
+/**
+ * @brief 分配帧缓冲区
+ * @note 按 2MB 对齐并圆整后分配，建议内核以透明大页映射，数据起始地址在大页内
+ *       按页粒度轮转偏移（缓存着色）
+ *
+ * @param[in] size 缓冲区大小
+ * @return 数据起始地址
+ */
+static uchar *frameAlloc(std::size_t size)
+{
+    static std::atomic_uint color{};
+    std::size_t offset = color.fetch_add(1) % NUM_COLORS * COLOR_STRIDE;
+    std::size_t rounded = (size + offset + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+    auto base = static_cast<uchar *>(::operator new(rounded, std::align_val_t(HUGE_PAGE_SIZE)));
+#ifdef __linux__
+    // 建议失败（内核未启用 THP）时退化为普通页映射，不影响分配本身
+    madvise(base, rounded, MADV_HUGEPAGE);
+#endif
+    return base + offset;
+}
+
+//! 释放帧缓冲区，着色偏移小于大页尺寸，向下对齐至大页边界即为分配基址
+static void frameFree(void *data) noexcept
+{
+    auto base = reinterpret_cast<uintptr_t>(data) & ~static_cast<uintptr_t>(HUGE_PAGE_SIZE - 1);
+    ::operator delete(reinterpret_cast<void *>(base), std::align_val_t(HUGE_PAGE_SIZE));
+}
+
+//! 帧缓冲区分配器，参见 rm::framePoolAllocator
+class FramePoolAllocator final : public cv::MatAllocator
+{
+public:
+    cv::UMatData *allocate(int dims, const int *sizes, int type, void *data0, std::size_t *step,
+                           cv::AccessFlag, cv::UMatUsageFlags) const override
+    {
+        std::size_t total = CV_ELEM_SIZE(type);
+        for (int i = dims - 1; i >= 0; --i)
+        {
+            if (step != nullptr)
+            {
+                if (data0 != nullptr && step[i] != CV_AUTOSTEP)
+                {
+                    CV_Assert(total <= step[i]);
+                    total = step[i];
+                }
+                else
+                    step[i] = total;
+            }
+            total *= sizes[i];
+        }
+        uchar *data = data0 != nullptr ? static_cast<uchar *>(data0) : frameAlloc(total);
+        if (data0 == nullptr)
+            RMVL_MEM_ALLOC_("algorithm/frame_pool", total);
+        auto u = new cv::UMatData(this);
+        u->data = u->origdata = data;
+        u->size = total;
+        if (data0 != nullptr)
+            u->flags |= cv::UMatData::USER_ALLOCATED;
+        return u;
+    }
+
+    bool allocate(cv::UMatData *u, cv::AccessFlag, cv::UMatUsageFlags) const override { return u != nullptr; }
+
+    void deallocate(cv::UMatData *u) const override
+    {
+        if (u == nullptr)
+            return;
+        CV_Assert(u->urefcount == 0 && u->refcount == 0);
+        if (!(u->flags & cv::UMatData::USER_ALLOCATED))
+        {
+            RMVL_MEM_FREE_("algorithm/frame_pool", u->size);
+            frameFree(u->origdata);
+            u->origdata = nullptr;
+        }
+        delete u;
+    }
+};
+
+cv::MatAllocator *framePoolAllocator()
+{
+    static FramePoolAllocator allocator;
+    return &allocator;
+}
+
+} // namespace rm
+
+#endif // HAVE_OPENCV
@@ -24,85 +24,105 @@ RMVL_IMPL_DEF(EwTopsis)
 
 EwTopsis::EwTopsis(const std::vector<std::vector<double>> &samples) : _impl(new Impl(samples)) {}
 std::vector<double> EwTopsis::inference() { return _impl->inference(); }
+void EwTopsis::updateSamples(const std::vector<std::vector<double>> &samples) { _impl->updateSamples(samples); }
+
+void EwTopsis::Impl::updateSamples(const MatType &samples)
+{
+    _sample_size = samples.size();
+    _index_size = samples.empty() ? 0 : samples.front().size();
+    _R.resize(_sample_size * _index_size);
+    for (std::size_t i = 0; i < _sample_size; ++i)
+        std::copy(samples[i].begin(), samples[i].end(), _R.begin() + i * _index_size);
+    _Rn.resize(_R.size());
+    _ext.resize(2 * _index_size);
+    _H.resize(_index_size);
+    _w.resize(_index_size);
+    S.resize(_sample_size);
+}
 
 auto EwTopsis::Impl::inference() -> IndexType
 {
-    MatType R;
-    calcR(R_, R);
-    MatType P;
-    calcP(R, P);
-    IndexType H;
-    calcH(P, H);
-    IndexType w;
-    calcw(H, w);
-    calcS(w, R_, S);
+    calcR();
+    calcP();
+    calcH();
+    calcw();
+    calcS();
     return S;
 }
 
-void EwTopsis::Impl::calcR(const MatType &_R, MatType &R)
+void EwTopsis::Impl::calcR()
 {
-    R = _R;
-    IndexType min_indexs(_index_size);
-    IndexType max_indexs(_index_size);
-    for (std::size_t j = 0; j < _index_size; ++j)
+    double *min_indexs = _ext.data();
+    double *max_indexs = _ext.data() + _index_size;
+    std::copy(_R.begin(), _R.begin() + _index_size, min_indexs);
+    std::copy(_R.begin(), _R.begin() + _index_size, max_indexs);
+    for (std::size_t i = 1; i < _sample_size; ++i)
     {
-        min_indexs[j] = _R[0][j];
-        max_indexs[j] = _R[0][j];
-        for (std::size_t i = 1; i < _sample_size; ++i)
+        const double *pr = _R.data() + i * _index_size;
+        for (std::size_t j = 0; j < _index_size; ++j)
         {
-            if (_R[i][j] < min_indexs[j])
-                min_indexs[j] = _R[i][j];
-            if (_R[i][j] > max_indexs[j])
-                max_indexs[j] = _R[i][j];
+            if (pr[j] < min_indexs[j])
+                min_indexs[j] = pr[j];
+            if (pr[j] > max_indexs[j])
+                max_indexs[j] = pr[j];
         }
     }
     for (std::size_t i = 0; i < _sample_size; ++i)
+    {
+        const double *pr = _R.data() + i * _index_size;
+        double *pn = _Rn.data() + i * _index_size;
         for (std::size_t j = 0; j < _index_size; ++j)
-            R[i][j] = (R_[i][j] - min_indexs[j]) / (max_indexs[j] - min_indexs[j]);
+            pn[j] = (pr[j] - min_indexs[j]) / (max_indexs[j] - min_indexs[j]);
+    }
 }
 
-void EwTopsis::Impl::calcP(const MatType &R, MatType &P)
+void EwTopsis::Impl::calcP()
 {
-    P = R;
-    IndexType sums(_index_size);
-    for (std::size_t j = 0; j < _index_size; ++j)
-        sums[j] = std::accumulate(R.begin(), R.end(), 0.0, [&j](double a, const IndexType &b) {
-            return a + b[j];
-        });
+    double *sums = _ext.data();
+    std::fill(sums, sums + _index_size, 0.0);
     for (std::size_t i = 0; i < _sample_size; ++i)
+    {
+        const double *pn = _Rn.data() + i * _index_size;
+        for (std::size_t j = 0; j < _index_size; ++j)
+            sums[j] += pn[j];
+    }
+    for (std::size_t i = 0; i < _sample_size; ++i)
+    {
+        double *pn = _Rn.data() + i * _index_size;
         for (std::size_t j = 0; j < _index_size; ++j)
-            P[i][j] = R[i][j] / sums[j];
+            pn[j] /= sums[j];
+    }
 }
 
-void EwTopsis::Impl::calcH(const MatType &P, IndexType &H)
+void EwTopsis::Impl::calcH()
 {
-    H.resize(_index_size);
-    for (std::size_t j = 0; j < _index_size; ++j)
+    std::fill(_H.begin(), _H.end(), 0.0);
+    for (std::size_t i = 0; i < _sample_size; ++i)
     {
-        H[j] = 0;
-        for (std::size_t i = 0; i < _sample_size; ++i)
-            if (P[i][j] != 0)
-                H[j] -= P[i][j] * std::log(P[i][j]);
-        H[j] /= std::log(_sample_size);
+        const double *pn = _Rn.data() + i * _index_size;
+        for (std::size_t j = 0; j < _index_size; ++j)
+            if (pn[j] != 0)
+                _H[j] -= pn[j] * std::log(pn[j]);
     }
+    for (std::size_t j = 0; j < _index_size; ++j)
+        _H[j] /= std::log(_sample_size);
 }
 
-inline void EwTopsis::Impl::calcw(const IndexType &H, IndexType &w)
+inline void EwTopsis::Impl::calcw()
 {
-    w.resize(_index_size);
-    double tmp = static_cast<double>(_index_size) - std::accumulate(H.begin(), H.end(), 0.0);
+    double tmp = static_cast<double>(_index_size) - std::accumulate(_H.begin(), _H.end(), 0.0);
     for (std::size_t j = 0; j < _index_size; ++j)
-        w[j] = (1 - H[j]) / tmp;
+        _w[j] = (1 - _H[j]) / tmp;
 }
 
-inline void EwTopsis::Impl::calcS(const IndexType &w, const MatType &R_, SampleType &S_)
+inline void EwTopsis::Impl::calcS()
 {
-    S_.resize(_sample_size);
     for (std::size_t i = 0; i < _sample_size; ++i)
     {
-        S_[i] = 0;
+        const double *pr = _R.data() + i * _index_size;
+        S[i] = 0;
         for (std::size_t j = 0; j < _index_size; ++j)
-            S_[i] += w[j] * R_[i][j];
+            S[i] += _w[j] * pr[j];
     }
 }
 
@@ -344,4 +364,225 @@ void Munkres::Impl::erasePrimes()
     });
 }
 
+/////////////////////////////// MunkresEngine ///////////////////////////////
+
+RMVL_IMPL_DEF(MunkresEngine)
+
+MunkresEngine::MunkresEngine(const std::vector<std::vector<double>> &cost_matrix) : _impl(new Impl(cost_matrix)) {}
+std::vector<std::size_t> MunkresEngine::solve() noexcept { return _impl->solve(); }
+void MunkresEngine::updateCosts(const std::vector<std::vector<double>> &cost_matrix) { _impl->updateCosts(cost_matrix); }
+void MunkresEngine::insertRow(const std::vector<double> &costs) { _impl->insertRow(costs); }
+void MunkresEngine::eraseRow(std::size_t idx) { _impl->eraseRow(idx); }
+void MunkresEngine::insertCol(const std::vector<double> &costs) { _impl->insertCol(costs); }
+void MunkresEngine::eraseCol(std::size_t idx) { _impl->eraseCol(idx); }
+
+MunkresEngine::Impl::Impl(const std::vector<std::vector<double>> &cost_matrix)
+    : _m(cost_matrix.size()), _n(cost_matrix.front().size()), _matrix(cost_matrix),
+      _u(_m), _v(_n), _star_row(_m, -1), _star_col(_n, -1)
+{
+    for (const auto &row : _matrix)
+        if (row.size() != _n)
+            RMVL_Error(RMVL_StsBadArg, "Matrix: \"cost_matrix\" is not rectangular");
+    restoreFeasibility();
+}
+
+void MunkresEngine::Impl::restoreFeasibility()
+{
+    if (_m == 0 || _n == 0)
+        return;
+    for (std::size_t r = 0; r < _m; r++)
+    {
+        double d = *std::min_element(_matrix[r].begin(), _matrix[r].end());
+        if (d != 0)
+        {
+            std::for_each(_matrix[r].begin(), _matrix[r].end(), [d](double &val) { val -= d; });
+            _u[r] += d;
+        }
+    }
+    for (std::size_t c = 0; c < _n; c++)
+    {
+        double d = _matrix[0][c];
+        for (std::size_t r = 1; r < _m; r++)
+            d = std::min(d, _matrix[r][c]);
+        if (d != 0)
+        {
+            for (std::size_t r = 0; r < _m; r++)
+                _matrix[r][c] -= d;
+            _v[c] += d;
+        }
+    }
+}
+
+void MunkresEngine::Impl::validateStars()
+{
+    for (std::size_t r = 0; r < _m; r++)
+    {
+        int c = _star_row[r];
+        if (c >= 0 && _matrix[r][c] != 0)
+        {
+            _star_row[r] = -1;
+            _star_col[c] = -1;
+        }
+    }
+}
+
+void MunkresEngine::Impl::augment(int row, int col, const std::vector<int> &prime_row)
+{
+    while (true)
+    {
+        int star_r = _star_col[col];
+        _star_row[row] = col;
+        _star_col[col] = row;
+        if (star_r < 0)
+            break;
+        // 该列原有的星标被取代，沿其所在行的 prime 继续
+        row = star_r;
+        col = prime_row[star_r];
+    }
+}
+
+void MunkresEngine::Impl::adjustDuals(const std::vector<bool> &row_covered, const std::vector<bool> &col_covered)
+{
+    double minval = std::numeric_limits<double>::max();
+    for (std::size_t r = 0; r < _m; r++)
+        for (std::size_t c = 0; c < _n; c++)
+            if (!row_covered[r] && !col_covered[c])
+                minval = std::min(minval, _matrix[r][c]);
+    // 重叠区域 +min，非覆盖区域 -min
+    for (std::size_t r = 0; r < _m; r++)
+        for (std::size_t c = 0; c < _n; c++)
+            _matrix[r][c] += (row_covered[r] ? minval : 0) - (!col_covered[c] ? minval : 0);
+    for (std::size_t r = 0; r < _m; r++)
+        if (!row_covered[r])
+            _u[r] += minval;
+    for (std::size_t c = 0; c < _n; c++)
+        if (col_covered[c])
+            _v[c] -= minval;
+}
+
+std::vector<std::size_t> MunkresEngine::Impl::solve() noexcept
+{
+    validateStars();
+    const std::size_t target = std::min(_m, _n);
+    std::size_t count = std::count_if(_star_row.begin(), _star_row.end(), [](int c) { return c >= 0; });
+    if (count < target)
+    {
+        std::vector<int> prime_row(_m, -1);
+        std::vector<bool> row_covered(_m, false), col_covered(_n, false);
+        for (std::size_t c = 0; c < _n; c++)
+            col_covered[c] = _star_col[c] >= 0;
+        while (count < target)
+        {
+            // 查找未覆盖的 0 元素
+            int row{-1}, col{-1};
+            for (std::size_t r = 0; r < _m && row < 0; r++)
+                if (!row_covered[r])
+                    for (std::size_t c = 0; c < _n; c++)
+                        if (_matrix[r][c] == 0 && !col_covered[c])
+                        {
+                            row = static_cast<int>(r), col = static_cast<int>(c);
+                            break;
+                        }
+            if (row < 0)
+            {
+                adjustDuals(row_covered, col_covered);
+                continue;
+            }
+            prime_row[row] = col;
+            if (_star_row[row] >= 0)
+            {
+                row_covered[row] = true;
+                col_covered[_star_row[row]] = false;
+            }
+            else
+            {
+                augment(row, col, prime_row);
+                count++;
+                // 清除覆盖与 prime，重新覆盖所有星标列
+                std::fill(prime_row.begin(), prime_row.end(), -1);
+                std::fill(row_covered.begin(), row_covered.end(), false);
+                for (std::size_t c = 0; c < _n; c++)
+                    col_covered[c] = _star_col[c] >= 0;
+            }
+        }
+    }
+    std::vector<std::size_t> retval(_m);
+    for (std::size_t r = 0; r < _m; r++)
+        retval[r] = _star_row[r] >= 0 ? static_cast<std::size_t>(_star_row[r]) : 0;
+    return retval;
+}
+
+void MunkresEngine::Impl::updateCosts(const std::vector<std::vector<double>> &cost_matrix)
+{
+    if (cost_matrix.size() != _m)
+        RMVL_Error(RMVL_StsBadArg, "Matrix: \"cost_matrix\" size mismatch");
+    for (std::size_t r = 0; r < _m; r++)
+    {
+        if (cost_matrix[r].size() != _n)
+            RMVL_Error(RMVL_StsBadArg, "Matrix: \"cost_matrix\" is not rectangular");
+        // 在既有对偶变量下重新约简，矩阵变化不大时绝大多数星标得以保留
+        for (std::size_t c = 0; c < _n; c++)
+            _matrix[r][c] = cost_matrix[r][c] - _u[r] - _v[c];
+    }
+    restoreFeasibility();
+}
+
+void MunkresEngine::Impl::insertRow(const std::vector<double> &costs)
+{
+    if (costs.size() != _n)
+        RMVL_Error(RMVL_StsBadArg, "Vector: \"costs\" size mismatch");
+    _matrix.emplace_back(_n);
+    for (std::size_t c = 0; c < _n; c++)
+        _matrix[_m][c] = costs[c] - _v[c];
+    _u.push_back(0);
+    _star_row.push_back(-1);
+    _m++;
+    restoreFeasibility();
+}
+
+void MunkresEngine::Impl::eraseRow(std::size_t idx)
+{
+    if (idx >= _m)
+        RMVL_Error(RMVL_StsBadArg, "Index: \"idx\" out of range");
+    if (_star_row[idx] >= 0)
+        _star_col[_star_row[idx]] = -1;
+    _matrix.erase(_matrix.begin() + idx);
+    _u.erase(_u.begin() + idx);
+    _star_row.erase(_star_row.begin() + idx);
+    _m--;
+    for (auto &r : _star_col)
+        if (r > static_cast<int>(idx))
+            r--;
+    restoreFeasibility();
+}
+
+void MunkresEngine::Impl::insertCol(const std::vector<double> &costs)
+{
+    if (costs.size() != _m)
+        RMVL_Error(RMVL_StsBadArg, "Vector: \"costs\" size mismatch");
+    for (std::size_t r = 0; r < _m; r++)
+        _matrix[r].push_back(costs[r] - _u[r]);
+    _v.push_back(0);
+    _star_col.push_back(-1);
+    _n++;
+    restoreFeasibility();
+}
+
+void MunkresEngine::Impl::eraseCol(std::size_t idx)
+{
+    if (idx >= _n)
+        RMVL_Error(RMVL_StsBadArg, "Index: \"idx\" out of range");
+    if (_star_col[idx] >= 0)
+        _star_row[_star_col[idx]] = -1;
+    for (auto &row : _matrix)
+        row.erase(row.begin() + idx);
+    _v.erase(_v.begin() + idx);
+    _star_col.erase(_star_col.begin() + idx);
+    _n--;
+    for (auto &c : _star_row)
+        if (c > static_cast<int>(idx))
+            c--;
+    restoreFeasibility();
+}
+
 } // namespace rm
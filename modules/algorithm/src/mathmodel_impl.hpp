@@ -28,58 +28,39 @@ public:
      *
      * @param[in] samples 样本指标
      */
-    Impl(const MatType &samples) : R_(samples), _sample_size(samples.size()), _index_size(samples[0].size()) {}
+    Impl(const MatType &samples) { updateSamples(samples); }
+
+    //! 更新样本指标，行列数一致时复用既有工作区，不发生重新分配
+    void updateSamples(const MatType &samples);
 
     //! 基于权熵 TOPSIS 推理出最终的指标
     IndexType inference();
 
 private:
-    /**
-     * @brief 获取标准化指标
-     *
-     * @param[in] _R 原始指标矩阵
-     * @param[out] R 标准化指标矩阵
-     */
-    void calcR(const MatType &_R, MatType &R);
+    //! 获取标准化指标，写入工作区 `_Rn`
+    void calcR();
 
-    /**
-     * @brief 获取归一化指标
-     *
-     * @param[in] R 标准化指标矩阵
-     * @param[out] P 归一化指标矩阵
-     */
-    void calcP(const MatType &R, MatType &P);
+    //! 获取归一化指标，在 `_Rn` 上就地归一化
+    void calcP();
 
-    /**
-     * @brief 获取指标熵值向量
-     *
-     * @param[in] P 归一化指标矩阵
-     * @param[out] H 指标熵值向量
-     */
-    void calcH(const MatType &P, IndexType &H);
+    //! 获取指标熵值向量 `_H`
+    void calcH();
 
-    /**
-     * @brief 获取指标熵权向量
-     *
-     * @param[in] H 指标熵值向量
-     * @param[out] w 指标熵权向量
-     */
-    void calcw(const IndexType &H, IndexType &w);
+    //! 获取指标熵权向量 `_w`
+    void calcw();
 
-    /**
-     * @brief 获取样本综合指标
-     * @todo Declaration shadows a fileld of EwTopsis<Tp> R_ and S
-     * @param[in] w  指标熵权向量
-     * @param[in] R_ 原始指标矩阵
-     * @param[out] S_ 综合指标
-     */
-    void calcS(const IndexType &w, const MatType &R_, SampleType &S_);
+    //! 获取样本综合指标 `S`
+    void calcS();
 
-    MatType R_;   //!< 指标数据
-    SampleType S; //!< 最终的指标数据
+    std::size_t _sample_size{}; //!< 行数，样本数
+    std::size_t _index_size{};  //!< 列数，指标数
 
-    const std::size_t _sample_size; //!< 行数，样本数
-    const std::size_t _index_size;  //!< 列数，指标数
+    std::vector<double> _R{};  //!< 指标数据，行优先平铺存储
+    std::vector<double> _Rn{}; //!< 标准化、归一化指标工作区，行优先平铺存储
+    IndexType _ext{};          //!< 列极值、列和缓冲区
+    IndexType _H{};            //!< 指标熵值向量
+    IndexType _w{};            //!< 指标熵权向量
+    SampleType S{};            //!< 最终的指标数据
 };
 
 class Munkres::Impl
@@ -166,4 +147,59 @@ private:
     std::pair<int, int> _first_zero{};
 };
 
+class MunkresEngine::Impl
+{
+public:
+    //! 创建增量式 KM 算法求解器
+    Impl(const std::vector<std::vector<double>> &cost_matrix);
+
+    //! 求解，可重复调用
+    std::vector<std::size_t> solve() noexcept;
+
+    //! 热启动更新代价矩阵
+    void updateCosts(const std::vector<std::vector<double>> &cost_matrix);
+
+    //! 在末尾插入一行
+    void insertRow(const std::vector<double> &costs);
+    //! 删除指定行
+    void eraseRow(std::size_t idx);
+    //! 在末尾插入一列
+    void insertCol(const std::vector<double> &costs);
+    //! 删除指定列
+    void eraseCol(std::size_t idx);
+
+private:
+    //! 恢复约简矩阵的可行性，将各行、列最小值计入对偶变量，保证矩阵非负且每行、列均有 `0` 元素
+    void restoreFeasibility();
+
+    //! 丢弃不再落于 `0` 元素上的星标
+    void validateStars();
+
+    /**
+     * @brief 沿 `prime` - 星标交替路径增广，星标数目 `+1`
+     *
+     * @param[in] row 路径起点（未覆盖 `0` 元素）所在行
+     * @param[in] col 路径起点所在列
+     * @param[in] prime_row 每行 `'` 所在的列，不存在为 `-1`
+     */
+    void augment(int row, int col, const std::vector<int> &prime_row);
+
+    /**
+     * @brief 调整对偶变量，使未覆盖区域出现新的 `0` 元素
+     *
+     * @param[in] row_covered 行是否覆盖
+     * @param[in] col_covered 列是否覆盖
+     */
+    void adjustDuals(const std::vector<bool> &row_covered, const std::vector<bool> &col_covered);
+
+    std::size_t _m{}; //!< 行数
+    std::size_t _n{}; //!< 列数
+
+    std::vector<std::vector<double>> _matrix{}; //!< 约简代价矩阵，等于原始代价减去行、列对偶变量
+    std::vector<double> _u{};                   //!< 行对偶变量
+    std::vector<double> _v{};                   //!< 列对偶变量
+    std::vector<int> _star_row{};               //!< 每行星标所在的列，不存在为 `-1`
+    std::vector<int> _star_col{};               //!< 每列星标所在的行，不存在为 `-1`
+};
+
 } // namespace rm
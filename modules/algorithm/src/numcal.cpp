@@ -73,6 +73,23 @@ double Interpolator::operator()(double x) const
     return y;
 }
 
+UniformInterpolator::UniformInterpolator(double x0, double step, const std::vector<double> &ys) : _x0(x0)
+{
+    if (step <= 0.)
+        RMVL_Error(RMVL_StsBadArg, "The step of \"UniformInterpolator\" must be positive");
+    if (ys.size() < 2)
+        RMVL_Error(RMVL_StsBadArg, "The number of nodes of \"UniformInterpolator\" must be no less than 2");
+    _inv_step = 1. / step;
+    // 区间 i 上的插值函数整理为 y = b_i + k_i * x，截距与斜率交替连续存放
+    _segments.reserve(2 * (ys.size() - 1));
+    for (std::size_t i = 0; i + 1 < ys.size(); i++)
+    {
+        double slope = (ys[i + 1] - ys[i]) * _inv_step;
+        _segments.push_back(ys[i] - slope * (x0 + step * i));
+        _segments.push_back(slope);
+    }
+}
+
 #ifdef HAVE_OPENCV
 
 CurveFitter::CurveFitter(const std::vector<double> &xs, const std::vector<double> &ys, std::bitset<8> order)
@@ -137,6 +154,150 @@ double CurveFitter::operator()(double) const
 
 #endif // HAVE_OPENCV
 
+CurveFitterStream::CurveFitterStream(std::bitset<8> order, std::size_t window) : _window(window)
+{
+    if (window == 0)
+        RMVL_Error(RMVL_StsBadArg, "The window of \"CurveFitterStream\" must be positive");
+    _idx.reserve(order.count());
+    for (std::size_t i = 0; i < order.size(); i++)
+        if (order.test(i))
+            _idx.push_back(i);
+    _gram.assign(_idx.size() * _idx.size(), 0.);
+    _rhs.assign(_idx.size(), 0.);
+    _coeffs.assign(_idx.size(), 0.);
+}
+
+void CurveFitterStream::rankUpdate(double x, double y, double sign)
+{
+    // 样本的各阶幂 φ_i = x^idx[i]，法方程修正 G ± φφ^T，右端修正 b ± φy
+    std::size_t k = _idx.size();
+    double phi[8]{};
+    for (std::size_t i = 0; i < k; i++)
+        phi[i] = std::pow(x, _idx[i]);
+    for (std::size_t i = 0; i < k; i++)
+    {
+        for (std::size_t j = 0; j < k; j++)
+            _gram[i * k + j] += sign * phi[i] * phi[j];
+        _rhs[i] += sign * phi[i] * y;
+    }
+    _dirty = true;
+}
+
+void CurveFitterStream::add(double x, double y)
+{
+    if (_samples.size() == _window)
+    {
+        auto [ox, oy] = _samples.front();
+        _samples.pop_front();
+        rankUpdate(ox, oy, -1.);
+    }
+    _samples.emplace_back(x, y);
+    rankUpdate(x, y, 1.);
+}
+
+double CurveFitterStream::operator()(double x) const
+{
+    if (_dirty)
+    {
+        // 列主元 Gauss 消去求解 k×k 法方程，k 不超过 8
+        std::size_t k = _idx.size();
+        double a[8 * 8], b[8];
+        std::copy(_gram.begin(), _gram.end(), a);
+        std::copy(_rhs.begin(), _rhs.end(), b);
+        for (std::size_t col = 0; col < k; col++)
+        {
+            std::size_t pivot = col;
+            for (std::size_t row = col + 1; row < k; row++)
+                if (std::abs(a[row * k + col]) > std::abs(a[pivot * k + col]))
+                    pivot = row;
+            if (pivot != col)
+            {
+                for (std::size_t j = col; j < k; j++)
+                    std::swap(a[col * k + j], a[pivot * k + j]);
+                std::swap(b[col], b[pivot]);
+            }
+            if (std::abs(a[col * k + col]) < 1e-12)
+                continue; // 欠定方程，跳过该列，对应系数保持为 0
+            for (std::size_t row = col + 1; row < k; row++)
+            {
+                double factor = a[row * k + col] / a[col * k + col];
+                for (std::size_t j = col; j < k; j++)
+                    a[row * k + j] -= factor * a[col * k + j];
+                b[row] -= factor * b[col];
+            }
+        }
+        for (std::size_t i = k; i-- > 0;)
+        {
+            double sum = b[i];
+            for (std::size_t j = i + 1; j < k; j++)
+                sum -= a[i * k + j] * _coeffs[j];
+            _coeffs[i] = std::abs(a[i * k + i]) < 1e-12 ? 0. : sum / a[i * k + i];
+        }
+        _dirty = false;
+    }
+    double retval{};
+    for (std::size_t i = 0; i < _idx.size(); i++)
+        retval += _coeffs[i] * std::pow(x, _idx[i]);
+    return retval;
+}
+
+RecursiveLeastSquares::RecursiveLeastSquares(std::size_t dim, double kp) : _dim(dim), _kp(kp)
+{
+    if (dim == 0)
+        RMVL_Error(RMVL_StsBadArg, "The dimension of \"RecursiveLeastSquares\" must be positive");
+    _p.resize(dim * dim);
+    _x.resize(dim);
+    _pa.resize(dim);
+    reset();
+}
+
+void RecursiveLeastSquares::reset()
+{
+    std::fill(_p.begin(), _p.end(), 0.);
+    for (std::size_t i = 0; i < _dim; i++)
+        _p[i * _dim + i] = _kp;
+    std::fill(_x.begin(), _x.end(), 0.);
+}
+
+void RecursiveLeastSquares::update(const std::vector<double> &a, double b)
+{
+    if (a.size() != _dim)
+        RMVL_Error_(RMVL_StsBadArg, "The size of \"a\" must be equal to the dimension %zu", _dim);
+    // Pa 与标量 aᵀPa、aᵀx 在一次遍历中同时累加
+    double apa{}, ax{};
+    for (std::size_t i = 0; i < _dim; i++)
+    {
+        double sum{};
+        const double *row = _p.data() + i * _dim;
+        for (std::size_t j = 0; j < _dim; j++)
+            sum += row[j] * a[j];
+        _pa[i] = sum;
+        apa += a[i] * sum;
+        ax += a[i] * _x[i];
+    }
+    // 增益 k = Pa/(1+aᵀPa)，x += k(b-aᵀx)，由 P 的对称性 P -= k(Pa)ᵀ
+    double inv_denom = 1. / (1. + apa);
+    double err = b - ax;
+    for (std::size_t i = 0; i < _dim; i++)
+    {
+        double ki = _pa[i] * inv_denom;
+        _x[i] += ki * err;
+        double *row = _p.data() + i * _dim;
+        for (std::size_t j = 0; j < _dim; j++)
+            row[j] -= ki * _pa[j];
+    }
+}
+
+double RecursiveLeastSquares::operator()(const std::vector<double> &a) const
+{
+    if (a.size() != _dim)
+        RMVL_Error_(RMVL_StsBadArg, "The size of \"a\" must be equal to the dimension %zu", _dim);
+    double retval{};
+    for (std::size_t i = 0; i < _dim; i++)
+        retval += a[i] * _x[i];
+    return retval;
+}
+
 double NonlinearSolver::operator()(double x0, double eps, std::size_t max_iter) const
 {
     double xk{x0};
@@ -145,13 +306,55 @@ double NonlinearSolver::operator()(double x0, double eps, std::size_t max_iter)
         double yk = func(xk);
         if (std::abs(yk) < eps)
             break;
-        xk -= para::algorithm_param.SECANT_STEP * yk / (func(xk + para::algorithm_param.SECANT_STEP) - yk);
+        if (dfunc)
+        {
+            double dk = dfunc(xk);
+            // Halley 迭代（三阶收敛），仅提供一阶导数时退化为 Newton 迭代
+            if (d2func)
+                xk -= 2 * yk * dk / (2 * dk * dk - yk * d2func(xk));
+            else
+                xk -= yk / dk;
+        }
+        else
+            xk -= para::algorithm_param.SECANT_STEP * yk / (func(xk + para::algorithm_param.SECANT_STEP) - yk);
         if (std::isinf(xk) || std::isnan(xk))
             RMVL_Error(RMVL_StsDivByZero, "The iteration is divergent");
     }
     return xk;
 }
 
+const std::vector<double> &NonlinearSolverBatch::operator()(std::size_t n, double x0, double eps, std::size_t max_iter)
+{
+    // 暖启动：方程个数与上一次一致时以上一次的根为初始值，否则回退为给定初始值
+    if (_roots.size() != n)
+        _roots.assign(n, x0);
+    _actives.assign(n, 1);
+    std::size_t remains{n};
+    for (std::size_t i = 0; i < max_iter && remains != 0; i++)
+    {
+        // 以方程为内层循环推进全部未收敛的根，已收敛的方程按掩码退出迭代
+        for (std::size_t k = 0; k < n; k++)
+        {
+            if (!_actives[k])
+                continue;
+            double xk = _roots[k], yk = func(k, xk);
+            if (std::abs(yk) < eps)
+            {
+                _actives[k] = 0, remains--;
+                continue;
+            }
+            if (dfunc)
+                xk -= yk / dfunc(k, xk);
+            else
+                xk -= para::algorithm_param.SECANT_STEP * yk / (func(k, xk + para::algorithm_param.SECANT_STEP) - yk);
+            if (std::isinf(xk) || std::isnan(xk))
+                RMVL_Error(RMVL_StsDivByZero, "The iteration is divergent");
+            _roots[k] = xk;
+        }
+    }
+    return _roots;
+}
+
 RungeKutta::RungeKutta(
     const Odes &fs, const std::valarray<double> &p,
     const std::valarray<double> &lam, const std::valarray<std::valarray<double>> &r)
@@ -18,6 +18,7 @@
 
 #include "rmvl/algorithm/math.hpp"
 #include "rmvl/algorithm/numcal.hpp"
+#include "rmvl/core/thread_pool.hpp"
 
 namespace rm
 {
@@ -60,23 +61,60 @@ double derivative(Func1d func, double x, DiffMode mode, double dx)
         return partial(func, x_dx, dx);
 }
 
-std::valarray<double> grad(FuncNd func, const std::valarray<double> &x, DiffMode mode, double dx)
+// 单个坐标方向的偏导数（差商）
+static inline double partialAt(const FuncNd &func, std::valarray<double> &x_dx, std::size_t i, DiffMode mode, double dx)
 {
-    std::valarray<double> ret(x.size());
-    auto x_dx{x};
     if (mode == DiffMode::Ridders)
-        for (std::size_t i = 0; i < x_dx.size(); ++i)
+    {
+        double T00{partial(func, x_dx, i, 2 * dx)};
+        double T10{partial(func, x_dx, i, dx)};
+        double T20{partial(func, x_dx, i, dx / 2)};
+        double T11{(4. * T10 - T00) / 3.};
+        double T21{(4. * T20 - T10) / 3.};
+        return (16. * T21 - T11) / 15.;
+    }
+    else
+        return partial(func, x_dx, i, dx);
+}
+
+std::valarray<double> grad(FuncNd func, const std::valarray<double> &x, DiffMode mode, double dx, bool parallel)
+{
+    std::valarray<double> ret(x.size());
+    if (parallel)
+        // 各坐标方向的差商求值相互独立，按线程分块并行，每个工作线程持有独立的扰动副本
+        ThreadPool::global().parallel_for(0, x.size(), [&](std::size_t begin, std::size_t end) {
+            std::valarray<double> x_dx = x;
+            for (std::size_t i = begin; i < end; ++i)
+                ret[i] = partialAt(func, x_dx, i, mode, dx);
+        });
+    else
+    {
+        auto x_dx{x};
+        for (std::size_t i = 0; i < x.size(); ++i)
+            ret[i] = partialAt(func, x_dx, i, mode, dx);
+    }
+    return ret;
+}
+
+std::valarray<double> grad(const FuncNdComplex &func, const std::valarray<double> &x, double dx, bool parallel)
+{
+    std::valarray<double> ret(x.size());
+    // 复步微分 Im[f(x + ih e_i)]/h：无相减抵消，步长可取 1e-100，每个偏导数仅一次求值
+    auto body = [&](std::size_t begin, std::size_t end) {
+        std::valarray<std::complex<double>> x_dx(x.size());
+        for (std::size_t i = 0; i < x.size(); ++i)
+            x_dx[i] = x[i];
+        for (std::size_t i = begin; i < end; ++i)
         {
-            double T00{partial(func, x_dx, i, 2 * dx)};
-            double T10{partial(func, x_dx, i, dx)};
-            double T20{partial(func, x_dx, i, dx / 2)};
-            double T11{(4. * T10 - T00) / 3.};
-            double T21{(4. * T20 - T10) / 3.};
-            ret[i] = (16. * T21 - T11) / 15.;
+            x_dx[i] = {x[i], dx};
+            ret[i] = func(x_dx).imag() / dx;
+            x_dx[i] = x[i];
         }
+    };
+    if (parallel)
+        ThreadPool::global().parallel_for(0, x.size(), body);
     else
-        for (std::size_t i = 0; i < x_dx.size(); ++i)
-            ret[i] = partial(func, x_dx, i, dx);
+        body(0, x.size());
     return ret;
 }
 
@@ -138,8 +176,11 @@ std::pair<double, double> fminbnd(Func1d func, double x1, double x2, const Optim
 // 共轭梯度法
 static double fminunc_cg(FuncNd func, std::valarray<double> &xk, const OptimalOptions &options)
 {
+    auto fnGrad = [&](const std::valarray<double> &x) {
+        return grad(func, x, options.diff_mode, options.dx, options.parallel);
+    };
     std::valarray<double> s = -xk;
-    std::valarray<double> xk_grad = grad(func, xk, options.diff_mode, options.dx), xk2_grad(xk_grad.size());
+    std::valarray<double> xk_grad = fnGrad(xk), xk2_grad(xk_grad.size());
     // 判断是否收敛
     double nbl_xk = normL2(xk_grad);
     if (nbl_xk < options.tol)
@@ -159,7 +200,7 @@ static double fminunc_cg(FuncNd func, std::valarray<double> &xk, const OptimalOp
         for (std::size_t j = 0; j < xk.size(); ++j)
             xk[j] += alpha * s[j];
         retfval = fval;
-        xk2_grad = grad(func, xk, options.diff_mode, options.dx);
+        xk2_grad = fnGrad(xk);
         auto nbl_xk2 = normL2(xk2_grad);
         if (nbl_xk2 < options.tol)
             break;
@@ -184,8 +225,18 @@ static double fminunc_splx(FuncNd func, std::valarray<double> &xk, const Optimal
         p = {xk, 0};
     for (std::size_t i = 0; i < dim; ++i)
         splx[i + 1].first[i] += 100 * options.dx;
-    for (std::size_t i = 0; i < N; ++i)
-        splx[i].second = func(splx[i].first);
+    // 各单纯形点的函数求值相互独立，可成批并行
+    auto fnEval = [&](std::size_t begin, std::size_t end) {
+        auto body = [&](std::size_t l, std::size_t r) {
+            for (std::size_t i = l; i < r; ++i)
+                splx[i].second = func(splx[i].first);
+        };
+        if (options.parallel)
+            ThreadPool::global().parallel_for(begin, end, body);
+        else
+            body(begin, end);
+    };
+    fnEval(0, N);
     // 单纯形迭代
     for (int i = 0; i < options.max_iter; ++i)
     {
@@ -229,10 +280,8 @@ static double fminunc_splx(FuncNd func, std::valarray<double> &xk, const Optimal
             else
             {
                 for (std::size_t i = 1; i < N; ++i)
-                {
                     splx[i].first = 0.5 * (splx[i].first + splx[0].first);
-                    splx[i].second = func(splx[i].first);
-                }
+                fnEval(1, N);
             }
         }
         // 判断是否收敛
@@ -260,6 +309,18 @@ std::pair<std::valarray<double>, double> fminunc(FuncNd func, const std::valarra
     return {xk, fval};
 }
 
+std::pair<std::valarray<double>, double> fminunc(FuncNd func, const std::vector<std::valarray<double>> &x0s, const OptimalOptions &options)
+{
+    RMVL_DbgAssert(!x0s.empty());
+    // 各起点的搜索相互独立，由共享线程池并行执行
+    std::vector<std::pair<std::valarray<double>, double>> results(x0s.size());
+    ThreadPool::global().parallel_for(0, x0s.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+            results[i] = fminunc(func, x0s[i], options);
+    });
+    return *std::min_element(results.begin(), results.end(), [](const auto &lhs, const auto &rhs) { return lhs.second < rhs.second; });
+}
+
 std::pair<std::valarray<double>, double> fmincon(FuncNd func, const std::valarray<double> &x0, FuncNds c, FuncNds ceq, const OptimalOptions &options)
 {
     RMVL_DbgAssert(x0.size() > 0);
@@ -310,6 +371,54 @@ static cv::Mat jacobian(FuncNds func, const std::valarray<double> &x, DiffMode,
     return retval;
 }
 
+//! 由解析雅可比函数计算雅可比矩阵
+static cv::Mat jacobianAnalytic(const FuncJac &jac, const std::valarray<double> &x)
+{
+    auto rows = jac(x);
+    RMVL_DbgAssert(!rows.empty());
+    cv::Mat retval(static_cast<int>(rows.size()), static_cast<int>(rows.front().size()), CV_64FC1);
+    for (int i = 0; i < retval.rows; ++i)
+    {
+        RMVL_DbgAssert(rows[i].size() == static_cast<std::size_t>(retval.cols));
+        for (int j = 0; j < retval.cols; ++j)
+            retval.at<double>(i, j) = rows[i][j];
+    }
+    return retval;
+}
+
+//! 依据稀疏结构仅从非零元素直接装配 `JᵀWJ` 与 `JᵀWf`
+static void assembleNormal(const cv::Mat &J, const cv::Mat &W, const cv::Mat &fvals, const SparsityPattern &sparsity, cv::Mat &JtWJ, cv::Mat &JtWf)
+{
+    JtWJ = cv::Mat::zeros(J.cols, J.cols, CV_64FC1);
+    JtWf = cv::Mat::zeros(J.cols, 1, CV_64FC1);
+    for (int i = 0; i < J.rows; ++i)
+    {
+        double wi = W.at<double>(i, i);
+        for (auto p : sparsity[i])
+        {
+            double wjip = wi * J.at<double>(i, static_cast<int>(p));
+            JtWf.at<double>(static_cast<int>(p)) += wjip * fvals.at<double>(i);
+            for (auto q : sparsity[i])
+                JtWJ.at<double>(static_cast<int>(p), static_cast<int>(q)) += wjip * J.at<double>(i, static_cast<int>(q));
+        }
+    }
+}
+
+//! 计算 Gauss-Newton 法的搜索方向，`JᵀWJs = JᵀWf`
+static cv::Mat lsqSearchDirection(const cv::Mat &J, const cv::Mat &W, const cv::Mat &fvals, const SparsityPattern &sparsity)
+{
+    cv::Mat JtWJ, JtWf, s;
+    if (sparsity.size() == static_cast<std::size_t>(J.rows))
+        assembleNormal(J, W, fvals, sparsity, JtWJ, JtWf);
+    else
+    {
+        auto Jt = J.t();
+        JtWJ = Jt * W * J, JtWf = Jt * W * fvals;
+    }
+    cv::solve(JtWJ, JtWf, s, cv::DECOMP_CHOLESKY);
+    return s;
+}
+
 // 获取鲁棒加权
 template <typename RobustCallable, typename Enable = std::enable_if_t<std::is_convertible_v<RobustCallable, std::function<double(double)>>>>
 static cv::Mat robustW(const cv::Mat &fvals, RobustCallable fn)
@@ -361,7 +470,7 @@ static std::function<cv::Mat(const cv::Mat &)> robustSelect(RobustMode rb)
 }
 
 // Gauss-Newton 法
-static std::valarray<double> lsqnonlin_gn(const FuncNds &func, const std::valarray<double> &x0, RobustMode rb, const OptimalOptions &options)
+static std::valarray<double> lsqnonlin_gn(const FuncNds &func, const FuncJac &jac, const std::valarray<double> &x0, RobustMode rb, const SparsityPattern &sparsity, const OptimalOptions &options)
 {
     RMVL_DbgAssert(x0.size() > 0);
     std::valarray<double> xk(x0);
@@ -373,13 +482,10 @@ static std::valarray<double> lsqnonlin_gn(const FuncNds &func, const std::valarr
         auto phi = func(xk);
         if (normL2(phi) < options.tol)
             break;
-        auto J = jacobian(func, xk, options.diff_mode, options.dx);
-        auto Jt = J.t();
+        auto J = jac != nullptr ? jacobianAnalytic(jac, xk) : jacobian(func, xk, options.diff_mode, options.dx);
         cv::Mat fvals(phi.size(), 1, CV_64FC1, &phi[0]);
-        cv::Mat s;
-        // JᵀWJs = JᵀWf
         cv::Mat W = fnW(fvals);
-        cv::solve(Jt * W * J, Jt * W * fvals, s, cv::DECOMP_CHOLESKY);
+        cv::Mat s = lsqSearchDirection(J, W, fvals, sparsity);
         // 更新 xk
         for (std::size_t i = 0; i < xk.size(); ++i)
             xk[i] -= s.at<double>(static_cast<int>(i));
@@ -388,7 +494,7 @@ static std::valarray<double> lsqnonlin_gn(const FuncNds &func, const std::valarr
 }
 
 // 改进的 Gauss-Newton 法
-static std::valarray<double> lsqnonlin_sgn(const FuncNds &func, const std::valarray<double> &x0, RobustMode rb, const OptimalOptions &options)
+static std::valarray<double> lsqnonlin_sgn(const FuncNds &func, const FuncJac &jac, const std::valarray<double> &x0, RobustMode rb, const SparsityPattern &sparsity, const OptimalOptions &options)
 {
     RMVL_DbgAssert(x0.size() > 0);
     std::valarray<double> xk(x0);
@@ -400,13 +506,10 @@ static std::valarray<double> lsqnonlin_sgn(const FuncNds &func, const std::valar
         auto phi = func(xk);
         if (normL2(phi) < options.tol)
             break;
-        auto J = jacobian(func, xk, options.diff_mode, options.dx);
-        auto Jt = J.t();
+        auto J = jac != nullptr ? jacobianAnalytic(jac, xk) : jacobian(func, xk, options.diff_mode, options.dx);
         cv::Mat fvals(phi.size(), 1, CV_64FC1, &phi[0]);
-        cv::Mat s;
-        // JᵀWJs = JᵀWf
         cv::Mat W = fnW(fvals);
-        cv::solve(Jt * W * J, Jt * W * fvals, s, cv::DECOMP_CHOLESKY);
+        cv::Mat s = lsqSearchDirection(J, W, fvals, sparsity);
         // 一维搜索 alpha
         auto func_alpha = [&](double alpha) {
             auto xk2 = xk;
@@ -427,8 +530,8 @@ static std::valarray<double> lsqnonlin_sgn(const FuncNds &func, const std::valar
 class LMFunctor
 {
 public:
-    LMFunctor(const FuncNds &func, const std::valarray<double> &x0, DiffMode diff_mode, double dx)
-        : _func(func), _x0(x0), M(func(x0).size()), N(x0.size()), _diff_mode(diff_mode), _dx(dx) {}
+    LMFunctor(const FuncNds &func, const FuncJac &jac, const std::valarray<double> &x0, DiffMode diff_mode, double dx)
+        : _func(func), _jac(jac), _x0(x0), M(func(x0).size()), N(x0.size()), _diff_mode(diff_mode), _dx(dx) {}
 
     int operator()(const Eigen::VectorXd &x, Eigen::VectorXd &fvec) const
     {
@@ -441,7 +544,7 @@ public:
     int df(const Eigen::VectorXd &x, Eigen::MatrixXd &fjac) const
     {
         std::valarray<double> xk(x.data(), x.size());
-        auto J = jacobian(_func, xk, _diff_mode, _dx);
+        auto J = _jac != nullptr ? jacobianAnalytic(_jac, xk) : jacobian(_func, xk, _diff_mode, _dx);
         for (int i = 0; i < J.rows; ++i)
             for (int j = 0; j < J.cols; ++j)
                 fjac(i, j) = J.at<double>(i, j);
@@ -453,6 +556,7 @@ public:
 
 private:
     const FuncNds &_func;
+    const FuncJac &_jac;
     const std::valarray<double> &_x0;
     const int M{};
     const int N{};
@@ -461,9 +565,9 @@ private:
 };
 
 // Levenberg-Marquardt 法
-static std::valarray<double> lsqnonlin_lm(const FuncNds &func, const std::valarray<double> &x0, RobustMode, const OptimalOptions &options)
+static std::valarray<double> lsqnonlin_lm(const FuncNds &func, const FuncJac &jac, const std::valarray<double> &x0, RobustMode, const OptimalOptions &options)
 {
-    LMFunctor functor(func, x0, options.diff_mode, options.dx);
+    LMFunctor functor(func, jac, x0, options.diff_mode, options.dx);
     Eigen::LevenbergMarquardt<LMFunctor> lm(functor);
     lm.parameters.maxfev = options.max_iter;
     lm.parameters.xtol = options.tol;
@@ -473,23 +577,28 @@ static std::valarray<double> lsqnonlin_lm(const FuncNds &func, const std::valarr
     return std::valarray<double>(res.data(), res.size());
 }
 
-std::valarray<double> lsqnonlinRKF(const FuncNds &func, const std::valarray<double> &x0, RobustMode rb, const OptimalOptions &options)
+std::valarray<double> lsqnonlinRKF(const FuncNds &func, const FuncJac &jac, const std::valarray<double> &x0, RobustMode rb, const SparsityPattern &sparsity, const OptimalOptions &options)
 {
     RMVL_DbgAssert(x0.size() > 0);
     switch (options.lsq_mode)
     {
     case LsqMode::LM:
-        return lsqnonlin_lm(func, x0, rb, options);
+        return lsqnonlin_lm(func, jac, x0, rb, options);
     case LsqMode::GN:
-        return lsqnonlin_gn(func, x0, rb, options);
+        return lsqnonlin_gn(func, jac, x0, rb, sparsity, options);
     default: // LsqMode::SGN
-        return lsqnonlin_sgn(func, x0, rb, options);
+        return lsqnonlin_sgn(func, jac, x0, rb, sparsity, options);
     };
 }
 
+std::valarray<double> lsqnonlinRKF(const FuncNds &func, const std::valarray<double> &x0, RobustMode rb, const OptimalOptions &options)
+{
+    return lsqnonlinRKF(func, nullptr, x0, rb, {}, options);
+}
+
 #else
 
-std::valarray<double> lsqnonlinRKF(const FuncNds &, const std::valarray<double> &, RobustMode, const OptimalOptions &)
+std::valarray<double> lsqnonlinRKF(const FuncNds &, const FuncJac &, const std::valarray<double> &, RobustMode, const SparsityPattern &, const OptimalOptions &)
 {
 #if _WIN32
     RMVL_Error(RMVL_StsBadFunc, "this function must be used with opencv_worldxxx.dll, please recompile "
@@ -501,6 +610,11 @@ std::valarray<double> lsqnonlinRKF(const FuncNds &, const std::valarray<double>
     return {};
 }
 
+std::valarray<double> lsqnonlinRKF(const FuncNds &func, const std::valarray<double> &x0, RobustMode rb, const OptimalOptions &options)
+{
+    return lsqnonlinRKF(func, nullptr, x0, rb, {}, options);
+}
+
 #endif // HAVE_OPENCV
 
 std::valarray<double> lsqnonlin(const FuncNds &func, const std::valarray<double> &x0, const OptimalOptions &options)
@@ -508,4 +622,9 @@ std::valarray<double> lsqnonlin(const FuncNds &func, const std::valarray<double>
     return lsqnonlinRKF(func, x0, RobustMode::L2, options);
 }
 
+std::valarray<double> lsqnonlin(const FuncNds &func, const FuncJac &jac, const std::valarray<double> &x0, const SparsityPattern &sparsity, const OptimalOptions &options)
+{
+    return lsqnonlinRKF(func, jac, x0, RobustMode::L2, sparsity, options);
+}
+
 } // namespace rm
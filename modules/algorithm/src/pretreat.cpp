@@ -11,48 +11,695 @@
 
 #ifdef HAVE_OPENCV
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+
+#include <opencv2/core/hal/intrin.hpp>
 #include <opencv2/imgproc.hpp>
 
+#include "rmvl/core/thread_pool.hpp"
+#include "rmvl/core/tuner.hpp"
 #include "rmvl/core/util.hpp"
+#include "rmvl/algorithm/math.hpp"
 #include "rmvl/algorithm/pretreat.hpp"
 
 namespace rm
 {
 
-cv::Mat binary(cv::Mat src, uint8_t ch1, uint8_t ch2, uint8_t thresh)
+//! 全局执行模式
+static std::atomic<PretreatExec> pretreat_exec{PretreatExec::Parallel};
+
+void setPretreatExec(PretreatExec mode)
+{
+    if (mode == PretreatExec::Auto)
+        RMVL_Error(RMVL_StsBadArg, "The global execution mode cannot be set to \"PretreatExec::Auto\"");
+    pretreat_exec = mode;
+}
+
+void tunePretreatExec(cv::Size size)
+{
+    // 在代表性图像上基准测试串行与并行通道相减二值化，选优结果按 CPU 型号持久化
+    cv::Mat src(size, CV_8UC3, cv::Scalar(30, 40, 120)), bin;
+    std::size_t idx = tuner::select(
+        "algorithm/binary",
+        {{"serial", [&] { binary(src, bin, RED, BLUE, 80, PretreatExec::Serial); }},
+         {"parallel", [&] { binary(src, bin, RED, BLUE, 80, PretreatExec::Parallel); }}});
+    pretreat_exec = idx == 0 ? PretreatExec::Serial : PretreatExec::Parallel;
+}
+
+/**
+ * @brief 按执行模式对图像各行执行处理
+ * @brief
+ * - 并行模式下按行分块交由共享线程池的高优先级通道执行（二值化位于识别热路径），
+ *   串行模式下在当前线程一次性处理所有行
+ *
+ * @tparam Callable 行处理可调用对象类型，形参为行范围 `cv::Range`
+ * @param[in] rows 图像行数
+ * @param[in] exec 执行模式
+ * @param[in] body 行处理可调用对象
+ */
+template <typename Callable>
+static inline void forEachRow(int rows, PretreatExec exec, Callable &&body)
+{
+    if (exec == PretreatExec::Auto)
+        exec = pretreat_exec;
+    if (exec == PretreatExec::Parallel)
+        ThreadPool::global().parallel_for(0, rows, [&body](std::size_t start, std::size_t end) {
+            body(cv::Range(static_cast<int>(start), static_cast<int>(end)));
+        }, TaskLane::High);
+    else
+        body(cv::Range(0, rows));
+}
+
+/**
+ * @brief 单行通道相减二值化，减法与阈值判断融合为一趟遍历
+ *
+ * @param[in] data_src 原图像行首地址（BGR 交错存储）
+ * @param[out] data_bin 二值图像行首地址
+ * @param[in] cols 行内像素数
+ * @param[in] ch1 通道 1
+ * @param[in] ch2 通道 2
+ * @param[in] thresh 相减阈值
+ */
+static inline void binaryRow(const uchar *data_src, uchar *data_bin, int cols, uint8_t ch1, uint8_t ch2, uint8_t thresh)
+{
+    int col = 0;
+#if CV_SIMD
+    // 通用向量指令在编译期映射到 SSE/AVX2/NEON，按向量宽度批量解交错处理
+    const int step = cv::v_uint8::nlanes;
+    cv::v_uint8 vthresh = cv::vx_setall_u8(thresh);
+    cv::v_uint8 chs[3];
+    for (; col <= cols - step; col += step)
+    {
+        cv::v_load_deinterleave(data_src + 3 * col, chs[0], chs[1], chs[2]);
+        // 无符号饱和减法在 ch1 < ch2 时饱和至 0，与有符号差值的阈值判断结果一致
+        cv::v_store(data_bin + col, (chs[ch1] - chs[ch2]) > vthresh);
+    }
+#endif
+    for (; col < cols; ++col)
+        data_bin[col] = data_src[3 * col + ch1] - data_src[3 * col + ch2] > thresh ? 255 : 0;
+}
+
+/**
+ * @brief 单行亮度阈值二值化（BGR 输入），灰度转换与阈值判断融合为一趟遍历
+ *
+ * @param[in] data_src 原图像行首地址（BGR 交错存储）
+ * @param[out] data_bin 二值图像行首地址
+ * @param[in] cols 行内像素数
+ * @param[in] thresh 亮度阈值
+ */
+static inline void binaryBrightRow(const uchar *data_src, uchar *data_bin, int cols, uint8_t thresh)
+{
+    // BT.601 灰度转换定点系数，与 cv::COLOR_BGR2GRAY 一致
+    constexpr int B2Y = 1868, G2Y = 9617, R2Y = 4899, SHIFT = 14;
+    for (int col = 0; col < cols; ++col)
+    {
+        int gray = (B2Y * data_src[3 * col] + G2Y * data_src[3 * col + 1] +
+                    R2Y * data_src[3 * col + 2] + (1 << (SHIFT - 1))) >> SHIFT;
+        data_bin[col] = gray > thresh ? 255 : 0;
+    }
+}
+
+/**
+ * @brief 单行亮度阈值二值化（Mono8 输入）
+ *
+ * @param[in] data_src 原图像行首地址
+ * @param[out] data_bin 二值图像行首地址
+ * @param[in] cols 行内像素数
+ * @param[in] thresh 亮度阈值
+ */
+static inline void binaryBrightRow1(const uchar *data_src, uchar *data_bin, int cols, uint8_t thresh)
+{
+    int col = 0;
+#if CV_SIMD
+    const int step = cv::v_uint8::nlanes;
+    cv::v_uint8 vthresh = cv::vx_setall_u8(thresh);
+    for (; col <= cols - step; col += step)
+        cv::v_store(data_bin + col, cv::vx_load(data_src + col) > vthresh);
+#endif
+    for (; col < cols; ++col)
+        data_bin[col] = data_src[col] > thresh ? 255 : 0;
+}
+
+void binary(cv::Mat src, cv::Mat &dst, uint8_t ch1, uint8_t ch2, uint8_t thresh, PretreatExec exec)
 {
     if (src.type() != CV_8UC3)
         RMVL_Error(RMVL_StsBadArg, "The image type of \"src\" is incorrect");
-    cv::Mat bin = cv::Mat::zeros(cv::Size(src.cols, src.rows), CV_8UC1);
-    // Image process
-    parallel_for_(cv::Range(0, src.rows), [&](const cv::Range &range) {
-        uchar *data_src = nullptr;
-        uchar *data_bin = nullptr;
+    // 新分配的输出图像使用帧缓冲区分配器，与原图同步遍历时避开 L2 组冲突
+    if (dst.empty())
+        dst.allocator = framePoolAllocator();
+    // 尺寸、类型一致时不会重新分配，逐帧处理可复用同一块缓冲区
+    dst.create(src.rows, src.cols, CV_8UC1);
+    forEachRow(src.rows, exec, [&](const cv::Range &range) {
         for (int row = range.start; row < range.end; ++row)
+            binaryRow(src.ptr<uchar>(row), dst.ptr<uchar>(row), src.cols, ch1, ch2, thresh);
+    });
+}
+
+cv::Mat binary(cv::Mat src, uint8_t ch1, uint8_t ch2, uint8_t thresh, PretreatExec exec)
+{
+    cv::Mat bin;
+    binary(src, bin, ch1, ch2, thresh, exec);
+    return bin;
+}
+
+void binary(cv::Mat src, cv::Mat &dst, uint8_t thresh, PretreatExec exec)
+{
+    if (src.type() != CV_8UC3 && src.type() != CV_8UC1)
+        RMVL_Error(RMVL_StsBadArg, "The image type of \"src\" is incorrect");
+    if (dst.empty())
+        dst.allocator = framePoolAllocator();
+    dst.create(src.rows, src.cols, CV_8UC1);
+    if (src.type() == CV_8UC3)
+        forEachRow(src.rows, exec, [&](const cv::Range &range) {
+            for (int row = range.start; row < range.end; ++row)
+                binaryBrightRow(src.ptr<uchar>(row), dst.ptr<uchar>(row), src.cols, thresh);
+        });
+    else
+        forEachRow(src.rows, exec, [&](const cv::Range &range) {
+            for (int row = range.start; row < range.end; ++row)
+                binaryBrightRow1(src.ptr<uchar>(row), dst.ptr<uchar>(row), src.cols, thresh);
+        });
+}
+
+cv::Mat binary(cv::Mat src, uint8_t thresh, PretreatExec exec)
+{
+    cv::Mat bin;
+    binary(src, bin, thresh, exec);
+    return bin;
+}
+
+// ------------------------------ 位压缩二值化 ------------------------------
+
+/**
+ * @brief 将单行字节掩码压缩为 1 位/像素的位图行
+ * @note 每 8 个掩码字节的符号位经乘法一次聚合为 8 位，位序与列序一致，行尾填充位置零
+ *
+ * @param[in] vals 字节掩码行首地址（`0x00` / `0xFF`）
+ * @param[in] cols 行内像素数
+ * @param[out] out 位图行首地址
+ */
+static inline void packRow(const uchar *vals, int cols, uint64_t *out)
+{
+    int words = cols >> 6;
+    for (int w = 0; w < words; ++w)
+    {
+        uint64_t bits = 0;
+        const uchar *p = vals + (w << 6);
+        for (int b = 0; b < 64; b += 8)
         {
-            data_src = src.ptr<uchar>(row);
-            data_bin = bin.ptr<uchar>(row);
-            for (int col = 0; col < src.cols; ++col)
-                if (data_src[3 * col + ch1] - data_src[3 * col + ch2] > thresh)
-                    data_bin[col] = 255;
+            uint64_t m;
+            std::memcpy(&m, p + b, sizeof(m));
+            bits |= ((m & 0x8080808080808080ull) * 0x0002040810204081ull >> 56) << b;
+        }
+        out[w] = bits;
+    }
+    int rem = cols & 63;
+    if (rem != 0)
+    {
+        uint64_t bits = 0;
+        const uchar *p = vals + (words << 6);
+        for (int b = 0; b < rem; ++b)
+            bits |= static_cast<uint64_t>(p[b] != 0) << b;
+        out[words] = bits;
+    }
+}
+
+void binaryPacked(cv::Mat src, PackedBinary &dst, uint8_t ch1, uint8_t ch2, uint8_t thresh, PretreatExec exec)
+{
+    if (src.type() != CV_8UC3)
+        RMVL_Error(RMVL_StsBadArg, "The image type of \"src\" is incorrect");
+    dst.create(src.rows, src.cols);
+    forEachRow(src.rows, exec, [&](const cv::Range &range) {
+        // 比较以 SIMD 写入线程局部的字节掩码行缓冲区，再按字压位写出
+        thread_local std::vector<uchar> vals;
+        if (vals.size() < static_cast<std::size_t>(src.cols))
+            vals.resize(src.cols);
+        for (int row = range.start; row < range.end; ++row)
+        {
+            binaryRow(src.ptr<uchar>(row), vals.data(), src.cols, ch1, ch2, thresh);
+            packRow(vals.data(), src.cols, dst.row(row));
         }
     });
-    return bin;
 }
 
-cv::Mat binary(cv::Mat src, uint8_t thresh)
+void binaryPacked(cv::Mat src, PackedBinary &dst, uint8_t thresh, PretreatExec exec)
 {
     if (src.type() != CV_8UC3 && src.type() != CV_8UC1)
         RMVL_Error(RMVL_StsBadArg, "The image type of \"src\" is incorrect");
+    dst.create(src.rows, src.cols);
+    forEachRow(src.rows, exec, [&](const cv::Range &range) {
+        thread_local std::vector<uchar> vals;
+        if (vals.size() < static_cast<std::size_t>(src.cols))
+            vals.resize(src.cols);
+        if (src.type() == CV_8UC3)
+            for (int row = range.start; row < range.end; ++row)
+            {
+                binaryBrightRow(src.ptr<uchar>(row), vals.data(), src.cols, thresh);
+                packRow(vals.data(), src.cols, dst.row(row));
+            }
+        else
+            for (int row = range.start; row < range.end; ++row)
+            {
+                binaryBrightRow1(src.ptr<uchar>(row), vals.data(), src.cols, thresh);
+                packRow(vals.data(), src.cols, dst.row(row));
+            }
+    });
+}
+
+// ------------------------------ 自适应阈值 ------------------------------
+
+/**
+ * @brief 单行通道差值提取，无符号饱和减法与 binaryRow 语义一致
+ *
+ * @param[in] data_src 原图像行首地址（BGR 交错存储）
+ * @param[out] vals 差值行缓冲区
+ * @param[in] cols 行内像素数
+ * @param[in] ch1 通道 1
+ * @param[in] ch2 通道 2
+ */
+static inline void minusValueRow(const uchar *data_src, uchar *vals, int cols, uint8_t ch1, uint8_t ch2)
+{
+    int col = 0;
+#if CV_SIMD
+    const int step = cv::v_uint8::nlanes;
+    cv::v_uint8 chs[3];
+    for (; col <= cols - step; col += step)
+    {
+        cv::v_load_deinterleave(data_src + 3 * col, chs[0], chs[1], chs[2]);
+        cv::v_store(vals + col, chs[ch1] - chs[ch2]);
+    }
+#endif
+    for (; col < cols; ++col)
+    {
+        int diff = data_src[3 * col + ch1] - data_src[3 * col + ch2];
+        vals[col] = diff > 0 ? static_cast<uchar>(diff) : 0;
+    }
+}
+
+/**
+ * @brief 单行 BT.601 亮度提取（BGR 输入），定点系数与 binaryBrightRow 一致
+ *
+ * @param[in] data_src 原图像行首地址（BGR 交错存储）
+ * @param[out] vals 亮度行缓冲区
+ * @param[in] cols 行内像素数
+ */
+static inline void brightValueRow(const uchar *data_src, uchar *vals, int cols)
+{
+    constexpr int B2Y = 1868, G2Y = 9617, R2Y = 4899, SHIFT = 14;
+    for (int col = 0; col < cols; ++col)
+        vals[col] = static_cast<uchar>((B2Y * data_src[3 * col] + G2Y * data_src[3 * col + 1] +
+                                        R2Y * data_src[3 * col + 2] + (1 << (SHIFT - 1))) >> SHIFT);
+}
+
+/**
+ * @brief 4 路子直方图累加
+ * @note 相邻像素分散至 4 个独立的子直方图，拆分同一计数槽的存取依赖以填满流水线，
+ *       通用向量指令不提供散射存储，直方图统计无法直接向量化
+ *
+ * @param[in] vals 值行缓冲区
+ * @param[in] cols 行内像素数
+ * @param[in out] sub 4 路子直方图
+ */
+static inline void histAccumulate(const uchar *vals, int cols, uint32_t sub[4][256])
+{
+    int col = 0;
+    for (; col + 4 <= cols; col += 4)
+    {
+        ++sub[0][vals[col]];
+        ++sub[1][vals[col + 1]];
+        ++sub[2][vals[col + 2]];
+        ++sub[3][vals[col + 3]];
+    }
+    for (; col < cols; ++col)
+        ++sub[0][vals[col]];
+}
+
+/**
+ * @brief Otsu 准则解算直方图阈值
+ *
+ * @param[in] hist 256 级直方图
+ * @return 类间方差最大的阈值，对比度过低（类间方差为 `0`）时返回 `-1`
+ */
+static int otsuThreshold(const uint32_t hist[256])
+{
+    uint64_t total{}, sum{};
+    for (int i = 0; i < 256; ++i)
+    {
+        total += hist[i];
+        sum += static_cast<uint64_t>(i) * hist[i];
+    }
+    if (total == 0)
+        return -1;
+    uint64_t wb{}, sumb{};
+    double best_var{};
+    int best{-1};
+    for (int t = 0; t + 1 < 256; ++t)
+    {
+        wb += hist[t];
+        if (wb == 0)
+            continue;
+        uint64_t wf = total - wb;
+        if (wf == 0)
+            break;
+        sumb += static_cast<uint64_t>(t) * hist[t];
+        double mb = static_cast<double>(sumb) / static_cast<double>(wb);
+        double mf = static_cast<double>(sum - sumb) / static_cast<double>(wf);
+        double var = static_cast<double>(wb) * static_cast<double>(wf) * (mb - mf) * (mb - mf);
+        if (var > best_var)
+        {
+            best_var = var;
+            best = t;
+        }
+    }
+    return best_var > 0. ? best : -1;
+}
+
+/**
+ * @brief 自适应阈值二值化实现
+ * @brief
+ * - 第一趟逐分块统计值直方图并以 Otsu 准则解算分块阈值，对比度过低的分块退回
+ *   全图阈值，第二趟复用单行二值化核完成阈值判断
+ *
+ * @param[in] src 原图像
+ * @param[out] dst 二值图像，已完成分配
+ * @param[in] bias 阈值偏置
+ * @param[in] tiles 分块数（宽 × 高）
+ * @param[in] exec 执行模式
+ * @param[in] value_row 单行值提取，形参为 `(行首地址, 起始列, 值缓冲区, 像素数)`
+ * @param[in] apply_row 单行阈值判断，形参为 `(行首地址, 二值行首地址, 起始列, 像素数, 阈值)`
+ */
+template <typename ValueRow, typename ApplyRow>
+static void binaryAdaptiveImpl(const cv::Mat &src, cv::Mat &dst, double bias, cv::Size tiles,
+                               PretreatExec exec, ValueRow value_row, ApplyRow apply_row)
+{
+    if (exec == PretreatExec::Auto)
+        exec = pretreat_exec;
+    const int tw = std::clamp(tiles.width, 1, src.cols);
+    const int th = std::clamp(tiles.height, 1, src.rows);
+    const int tile_w = (src.cols + tw - 1) / tw;
+    const int tile_h = (src.rows + th - 1) / th;
+    // 第一趟：逐分块统计直方图，分块间不共享状态，按分块分发至共享线程池
+    std::vector<std::array<uint32_t, 256>> hists(static_cast<std::size_t>(tw) * th);
+    auto tile_body = [&](std::size_t start, std::size_t end) {
+        // 值行缓冲区随线程池工作线程持久复用，逐帧处理不产生分配
+        thread_local std::vector<uchar> vals;
+        if (vals.size() < static_cast<std::size_t>(tile_w))
+            vals.resize(tile_w);
+        for (std::size_t t = start; t < end; ++t)
+        {
+            int left = static_cast<int>(t) % tw * tile_w, right = std::min(src.cols, left + tile_w);
+            int top = static_cast<int>(t) / tw * tile_h, bottom = std::min(src.rows, top + tile_h);
+            uint32_t sub[4][256]{};
+            for (int row = top; row < bottom; ++row)
+            {
+                value_row(src.ptr<uchar>(row), left, vals.data(), right - left);
+                histAccumulate(vals.data(), right - left, sub);
+            }
+            for (int i = 0; i < 256; ++i)
+                hists[t][i] = sub[0][i] + sub[1][i] + sub[2][i] + sub[3][i];
+        }
+    };
+    if (exec == PretreatExec::Parallel)
+        ThreadPool::global().parallel_for(0, hists.size(), tile_body, TaskLane::High);
+    else
+        tile_body(0, hists.size());
+    // 全图直方图为各分块之和，作为低对比度分块的退回阈值来源
+    std::array<uint32_t, 256> global_hist{};
+    for (const auto &hist : hists)
+        for (int i = 0; i < 256; ++i)
+            global_hist[i] += hist[i];
+    int global_thresh = otsuThreshold(global_hist.data());
+    // 整图无对比度时无从解算阈值，输出全零图像
+    if (global_thresh < 0)
+    {
+        dst.setTo(0);
+        return;
+    }
+    std::vector<uint8_t> thresh(hists.size());
+    for (std::size_t t = 0; t < hists.size(); ++t)
+    {
+        int val = otsuThreshold(hists[t].data());
+        if (val < 0)
+            val = global_thresh;
+        thresh[t] = static_cast<uint8_t>(std::clamp(static_cast<int>(val + bias), 0, 255));
+    }
+    // 第二趟：按分块阈值完成阈值判断
+    forEachRow(src.rows, exec, [&](const cv::Range &range) {
+        for (int row = range.start; row < range.end; ++row)
+        {
+            int ty = std::min(row / tile_h, th - 1);
+            const uchar *data_src = src.ptr<uchar>(row);
+            uchar *data_bin = dst.ptr<uchar>(row);
+            for (int tx = 0; tx < tw; ++tx)
+            {
+                int left = tx * tile_w, right = std::min(src.cols, left + tile_w);
+                apply_row(data_src, data_bin, left, right - left, thresh[static_cast<std::size_t>(ty) * tw + tx]);
+            }
+        }
+    });
+}
+
+void binaryAdaptive(cv::Mat src, cv::Mat &dst, uint8_t ch1, uint8_t ch2, double bias, cv::Size tiles, PretreatExec exec)
+{
+    if (src.empty())
+    {
+        dst.release();
+        return;
+    }
+    if (src.type() != CV_8UC3)
+        RMVL_Error(RMVL_StsBadArg, "The image type of \"src\" is incorrect");
+    if (dst.empty())
+        dst.allocator = framePoolAllocator();
+    dst.create(src.rows, src.cols, CV_8UC1);
+    binaryAdaptiveImpl(
+        src, dst, bias, tiles, exec,
+        [ch1, ch2](const uchar *data_src, int left, uchar *vals, int cols) { minusValueRow(data_src + 3 * left, vals, cols, ch1, ch2); },
+        [ch1, ch2](const uchar *data_src, uchar *data_bin, int left, int cols, uint8_t val) { binaryRow(data_src + 3 * left, data_bin + left, cols, ch1, ch2, val); });
+}
+
+cv::Mat binaryAdaptive(cv::Mat src, uint8_t ch1, uint8_t ch2, double bias, cv::Size tiles, PretreatExec exec)
+{
     cv::Mat bin;
+    binaryAdaptive(src, bin, ch1, ch2, bias, tiles, exec);
+    return bin;
+}
+
+void binaryAdaptive(cv::Mat src, cv::Mat &dst, double bias, cv::Size tiles, PretreatExec exec)
+{
+    if (src.empty())
+    {
+        dst.release();
+        return;
+    }
+    if (src.type() != CV_8UC3 && src.type() != CV_8UC1)
+        RMVL_Error(RMVL_StsBadArg, "The image type of \"src\" is incorrect");
+    if (dst.empty())
+        dst.allocator = framePoolAllocator();
+    dst.create(src.rows, src.cols, CV_8UC1);
     if (src.type() == CV_8UC3)
-        cvtColor(src, bin, cv::COLOR_BGR2GRAY);
+        binaryAdaptiveImpl(
+            src, dst, bias, tiles, exec,
+            [](const uchar *data_src, int left, uchar *vals, int cols) { brightValueRow(data_src + 3 * left, vals, cols); },
+            [](const uchar *data_src, uchar *data_bin, int left, int cols, uint8_t val) { binaryBrightRow(data_src + 3 * left, data_bin + left, cols, val); });
     else
-        bin = src.clone();
-    threshold(bin, bin, thresh, 255, cv::THRESH_BINARY);
+        binaryAdaptiveImpl(
+            src, dst, bias, tiles, exec,
+            [](const uchar *data_src, int left, uchar *vals, int cols) { std::memcpy(vals, data_src + left, cols); },
+            [](const uchar *data_src, uchar *data_bin, int left, int cols, uint8_t val) { binaryBrightRow1(data_src + left, data_bin + left, cols, val); });
+}
+
+cv::Mat binaryAdaptive(cv::Mat src, double bias, cv::Size tiles, PretreatExec exec)
+{
+    cv::Mat bin;
+    binaryAdaptive(src, bin, bias, tiles, exec);
     return bin;
 }
 
+//! 连通域行程，列区间为左闭右开 `[cs, ce)`
+struct Run
+{
+    int row;   //!< 行号
+    int cs;    //!< 起始列
+    int ce;    //!< 终止列（不含）
+    int label; //!< 临时标签
+};
+
+/**
+ * @brief 提取单行二值图像中的行程
+ * @note 行程外批量跳过全零向量块、行程内批量跳过全亮向量块，行程边界由标量循环定位，
+ *       稀疏二值图的扫描开销接近按字节读带宽
+ *
+ * @param[in] data 二值图像行首地址
+ * @param[in] cols 行内像素数
+ * @param[in] row 行号
+ * @param[out] runs 行程列表，向尾部追加
+ */
+static inline void extractRuns(const uchar *data, int cols, int row, std::vector<Run> &runs)
+{
+#if CV_SIMD
+    const int step = cv::v_uint8::nlanes;
+    cv::v_uint8 vzero = cv::vx_setzero_u8();
+#endif
+    int col = 0;
+    while (col < cols)
+    {
+#if CV_SIMD
+        for (; col + step <= cols; col += step)
+            if (cv::v_check_any(cv::vx_load(data + col) != vzero))
+                break;
+#endif
+        for (; col < cols && !data[col]; ++col)
+            ;
+        if (col == cols)
+            break;
+        int cs = col;
+#if CV_SIMD
+        for (; col + step <= cols; col += step)
+            if (!cv::v_check_all(cv::vx_load(data + col) != vzero))
+                break;
+#endif
+        for (; col < cols && data[col]; ++col)
+            ;
+        runs.push_back({row, cs, col, -1});
+    }
+}
+
+//! 并查集查询根标签，路径减半压缩
+static inline int ufFind(std::vector<int> &parents, int x)
+{
+    while (parents[x] != x)
+        x = parents[x] = parents[parents[x]];
+    return x;
+}
+
+/**
+ * @brief 两趟扫描连通域标记的公共实现，单行行程提取由 `extract` 回调完成
+ *
+ * @param[in] rows 图像行数
+ * @param[in] extract 单行行程提取回调，形如 `void(int row, std::vector<Run> &runs)`
+ * @param[out] stats 连通域统计信息
+ * @param[in] min_area 面积下限（像素数）
+ */
+template <typename RunExtractor>
+static void connectedComponentsImpl(int rows, RunExtractor extract, ConnectedComponents &stats, int min_area)
+{
+    // 行程列表与并查集标签为帧间复用的工作区
+    thread_local std::vector<Run> runs;
+    thread_local std::vector<int> parents;
+    runs.clear(), parents.clear();
+    // 第一趟：逐行提取行程，当前行行程与上一行的重叠行程（8 连通）经并查集合并，
+    // 行程在行内有序，与上一行的重叠判定以双指针完成
+    std::size_t prev_begin{}, prev_end{};
+    for (int row = 0; row < rows; ++row)
+    {
+        std::size_t cur_begin = runs.size();
+        extract(row, runs);
+        std::size_t pi = prev_begin;
+        for (std::size_t ri = cur_begin; ri < runs.size(); ++ri)
+        {
+            auto &r = runs[ri];
+            while (pi < prev_end && runs[pi].ce < r.cs)
+                ++pi;
+            // 左闭右开区间下，8 连通的重叠条件为 [pcs, pce) 与 [cs - 1, ce + 1) 相交
+            for (std::size_t pj = pi; pj < prev_end && runs[pj].cs <= r.ce; ++pj)
+            {
+                int root = ufFind(parents, runs[pj].label);
+                if (r.label < 0)
+                    r.label = root;
+                else
+                {
+                    int mine = ufFind(parents, r.label);
+                    if (mine != root)
+                        parents[std::max(mine, root)] = std::min(mine, root);
+                }
+            }
+            if (r.label < 0)
+            {
+                r.label = static_cast<int>(parents.size());
+                parents.push_back(r.label);
+            }
+        }
+        prev_begin = cur_begin, prev_end = runs.size();
+    }
+    // 第二趟：按行程累加各连通域的面积、包围盒与一、二阶矩，行程内 x 的各阶和由求和公式直接得到
+    struct Accum
+    {
+        int64_t n, sx, sy, sxx, syy, sxy;
+        int minx, maxx, miny, maxy;
+    };
+    thread_local std::vector<Accum> accums;
+    thread_local std::vector<int> comp_of;
+    accums.clear();
+    comp_of.assign(parents.size(), -1);
+    for (const auto &r : runs)
+    {
+        int &idx = comp_of[ufFind(parents, r.label)];
+        if (idx < 0)
+        {
+            idx = static_cast<int>(accums.size());
+            accums.push_back({0, 0, 0, 0, 0, 0, r.cs, r.ce, r.row, r.row});
+        }
+        auto &a = accums[idx];
+        int64_t len = r.ce - r.cs;
+        int64_t sx = (static_cast<int64_t>(r.cs) + r.ce - 1) * len / 2;
+        int64_t e = r.ce - 1, s = r.cs - 1;
+        int64_t sxx = e * (e + 1) * (2 * e + 1) / 6 - s * (s + 1) * (2 * s + 1) / 6;
+        a.n += len;
+        a.sx += sx, a.sy += r.row * len;
+        a.sxx += sxx, a.syy += static_cast<int64_t>(r.row) * r.row * len, a.sxy += r.row * sx;
+        a.minx = std::min(a.minx, r.cs), a.maxx = std::max(a.maxx, r.ce);
+        a.miny = std::min(a.miny, r.row), a.maxy = std::max(a.maxy, r.row);
+    }
+    for (const auto &a : accums)
+    {
+        if (a.n < min_area)
+            continue;
+        double n = static_cast<double>(a.n);
+        double cx = a.sx / n, cy = a.sy / n;
+        // 离散像素按单位方块处理，二阶中心矩附加 1/12 的像素自身贡献，单像素连通域等效边长为 1
+        double mu20 = a.sxx / n - cx * cx + 1. / 12, mu02 = a.syy / n - cy * cy + 1. / 12;
+        double mu11 = a.sxy / n - cx * cy;
+        double common = (mu20 + mu02) / 2, diff = (mu20 - mu02) / 2;
+        double disc = std::sqrt(diff * diff + mu11 * mu11);
+        double l1 = common + disc, l2 = std::max(common - disc, 0.);
+        stats.areas.push_back(static_cast<int>(a.n));
+        stats.bboxes.emplace_back(a.minx, a.miny, a.maxx - a.minx, a.maxy - a.miny + 1);
+        stats.centroids.emplace_back(static_cast<float>(cx), static_cast<float>(cy));
+        stats.angles.push_back(static_cast<float>(rad2deg(0.5 * std::atan2(2 * mu11, mu20 - mu02))));
+        stats.sizes.emplace_back(static_cast<float>(std::sqrt(12 * l1)), static_cast<float>(std::sqrt(12 * l2)));
+    }
+}
+
+void connectedComponents(cv::Mat bin, ConnectedComponents &stats, int min_area)
+{
+    stats.clear();
+    if (bin.empty())
+        return;
+    if (bin.type() != CV_8UC1)
+        RMVL_Error(RMVL_StsBadArg, "The image type of \"bin\" is incorrect");
+    connectedComponentsImpl(
+        bin.rows, [&bin](int row, std::vector<Run> &runs) { extractRuns(bin.ptr<uchar>(row), bin.cols, row, runs); },
+        stats, min_area);
+}
+
+void connectedComponents(const PackedBinary &bin, ConnectedComponents &stats, int min_area)
+{
+    stats.clear();
+    if (bin.empty())
+        return;
+    // 行程提取以 nextRun 逐字扫描完成，全零、全亮的字整字跳过
+    connectedComponentsImpl(
+        bin.rows(), [&bin](int row, std::vector<Run> &runs) {
+            int col = 0, cs{}, ce{};
+            while (nextRun(bin.row(row), bin.cols(), col, cs, ce))
+                runs.push_back({row, cs, ce, -1});
+        },
+        stats, min_area);
+}
+
 } // namespace rm
 
 #endif // HAVE_OPENCV
@@ -45,6 +45,63 @@ cv::Point2f calculateRelativeCenter(const cv::Matx33f &cameraMatrix, cv::Point2f
     return {result(0), result(1)};
 }
 
+void transformPoints(const cv::Matx33f &R, const cv::Vec3f &t, const cv::Point3f *src, cv::Point3f *dst, std::size_t num)
+{
+    // 旋转系数展开为标量，循环体内不含间接访问，可被编译器自动向量化
+    const float r00 = R(0, 0), r01 = R(0, 1), r02 = R(0, 2);
+    const float r10 = R(1, 0), r11 = R(1, 1), r12 = R(1, 2);
+    const float r20 = R(2, 0), r21 = R(2, 1), r22 = R(2, 2);
+    const float t0 = t(0), t1 = t(1), t2 = t(2);
+    for (std::size_t i = 0; i < num; ++i)
+    {
+        const float x = src[i].x, y = src[i].y, z = src[i].z;
+        dst[i].x = r00 * x + r01 * y + r02 * z + t0;
+        dst[i].y = r10 * x + r11 * y + r12 * z + t1;
+        dst[i].z = r20 * x + r21 * y + r22 * z + t2;
+    }
+}
+
+std::vector<cv::Point3f> transformPoints(const cv::Matx33f &R, const cv::Vec3f &t, const std::vector<cv::Point3f> &points)
+{
+    std::vector<cv::Point3f> retval(points.size());
+    transformPoints(R, t, points.data(), retval.data(), points.size());
+    return retval;
+}
+
+void composeQuats(const Quaternion &q, const Quaternion *src, Quaternion *dst, std::size_t num)
+{
+    // 左乘系数展开为标量，循环体内不含间接访问，可被编译器自动向量化
+    const float w = q.w, x = q.x, y = q.y, z = q.z;
+    for (std::size_t i = 0; i < num; ++i)
+    {
+        const float sw = src[i].w, sx = src[i].x, sy = src[i].y, sz = src[i].z;
+        dst[i].w = w * sw - x * sx - y * sy - z * sz;
+        dst[i].x = w * sx + x * sw + y * sz - z * sy;
+        dst[i].y = w * sy - x * sz + y * sw + z * sx;
+        dst[i].z = w * sz + x * sy - y * sx + z * sw;
+    }
+}
+
+std::vector<Quaternion> composeQuats(const Quaternion &q, const std::vector<Quaternion> &quats)
+{
+    std::vector<Quaternion> retval(quats.size());
+    composeQuats(q, quats.data(), retval.data(), quats.size());
+    return retval;
+}
+
+void rotatePoints(const Quaternion &q, const cv::Point3f *src, cv::Point3f *dst, std::size_t num)
+{
+    // 四元数展开一次为旋转矩阵系数后，复用零平移的批量刚体变换内核
+    transformPoints(q.toMat(), {}, src, dst, num);
+}
+
+std::vector<cv::Point3f> rotatePoints(const Quaternion &q, const std::vector<cv::Point3f> &points)
+{
+    std::vector<cv::Point3f> retval(points.size());
+    rotatePoints(q, points.data(), retval.data(), points.size());
+    return retval;
+}
+
 cv::Vec2f cameraConvertToPixel(const cv::Matx33f &cameraMatrix, const cv::Matx51f &distCoeffs, const cv::Vec3f &center3d)
 {
     std::vector<cv::Point3f> world_center3ds(1);
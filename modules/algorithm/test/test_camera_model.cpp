@@ -0,0 +1,90 @@
+/**
+ * @file test_camera_model.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 相机模型查找表服务单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#ifdef HAVE_OPENCV
+
+#include <cstdio>
+
+#include <gtest/gtest.h>
+#include <opencv2/calib3d.hpp>
+
+#include "rmvl/algorithm/camera_model.hpp"
+
+namespace rm_test
+{
+
+class CameraModelTest : public testing::Test
+{
+public:
+    cv::Matx33f camera_matrix{1250, 0, 320, 0, 1250, 256, 0, 0, 1};
+    cv::Matx51f dist_coeffs{-0.1f, 0.05f, 1e-3f, -1e-3f, 0.f};
+    cv::Size size{640, 512};
+};
+
+TEST_F(CameraModelTest, consistent_with_undistortPoints)
+{
+    rm::CameraModel model(camera_matrix, dist_coeffs, size);
+    std::vector<cv::Point2f> pixels = {{320.f, 256.f}, {10.5f, 20.25f}, {600.f, 500.f}, {320.4f, 100.6f}};
+    std::vector<cv::Point2f> expects, results;
+    cv::undistortPoints(pixels, expects, camera_matrix, dist_coeffs);
+    model.undistort(pixels, results);
+    ASSERT_EQ(results.size(), expects.size());
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        EXPECT_NEAR(results[i].x, expects[i].x, 1e-4f);
+        EXPECT_NEAR(results[i].y, expects[i].y, 1e-4f);
+    }
+}
+
+TEST_F(CameraModelTest, out_of_range_fallback)
+{
+    rm::CameraModel model(camera_matrix, dist_coeffs, size);
+    // 查找表覆盖范围之外回退为逐点迭代求解
+    cv::Point2f pixel{-20.f, 600.f};
+    std::vector<cv::Point2f> expects;
+    cv::undistortPoints(std::vector{pixel}, expects, camera_matrix, dist_coeffs);
+    auto result = model.undistort(pixel);
+    EXPECT_NEAR(result.x, expects[0].x, 1e-4f);
+    EXPECT_NEAR(result.y, expects[0].y, 1e-4f);
+}
+
+TEST_F(CameraModelTest, unit_ray)
+{
+    rm::CameraModel model(camera_matrix, dist_coeffs, size);
+    auto ray = model.ray({320.f, 256.f});
+    EXPECT_NEAR(cv::norm(ray), 1.f, 1e-6f);
+    // 主点处视线与光轴重合
+    EXPECT_NEAR(ray(0), 0.f, 1e-3f);
+    EXPECT_NEAR(ray(1), 0.f, 1e-3f);
+    EXPECT_GT(ray(2), 0.99f);
+}
+
+TEST_F(CameraModelTest, disk_cache_round_trip)
+{
+    // 首次构建写入缓存，二次构建从缓存加载，结果一致
+    rm::CameraModel model(camera_matrix, dist_coeffs, size, ".");
+    rm::CameraModel cached(camera_matrix, dist_coeffs, size, ".");
+    std::vector<cv::Point2f> pixels = {{123.4f, 345.6f}};
+    std::vector<cv::Point2f> lhs, rhs;
+    model.undistort(pixels, lhs);
+    cached.undistort(pixels, rhs);
+    EXPECT_EQ(lhs[0], rhs[0]);
+}
+
+TEST_F(CameraModelTest, process_level_service)
+{
+    const auto &model = rm::CameraModel::get(camera_matrix, dist_coeffs, size);
+    EXPECT_EQ(&model, &rm::CameraModel::get(camera_matrix, dist_coeffs, size));
+}
+
+} // namespace rm_test
+
+#endif // HAVE_OPENCV
@@ -31,4 +31,243 @@ TEST(DSPTest, dft)
     EXPECT_EQ(max_it, static_cast<std::ptrdiff_t>(f));
 }
 
+TEST(DSPTest, dft_non_pow2)
+{
+    constexpr int f = 10;
+    // 非 2 的幂长度的正弦波，覆盖 Bluestein 算法分支
+    rm::ComplexSignal x(1000);
+    for (std::size_t i = 0; i < 1000; ++i)
+        x[i] = std::sin(2 * rm::PI * i * f / 1000);
+    auto X = rm::dft(x);
+    auto Gx = rm::Gx(X, rm::GxType::Amp);
+    // 实信号频谱共轭对称，只在前半谱中寻找峰值
+    std::ptrdiff_t max_it = std::max_element(Gx.begin(), Gx.begin() + 500) - Gx.begin();
+    EXPECT_EQ(max_it, static_cast<std::ptrdiff_t>(f));
+}
+
+TEST(DSPTest, idft)
+{
+    rm::ComplexSignal x(512);
+    for (std::size_t i = 0; i < 512; ++i)
+        x[i] = {std::cos(0.1 * i), std::sin(0.05 * i)};
+    // 正逆变换往返后应恢复原信号
+    auto xr = rm::idft(rm::dft(x));
+    for (std::size_t i = 0; i < 512; ++i)
+    {
+        EXPECT_NEAR(xr[i].real(), x[i].real(), 1e-10);
+        EXPECT_NEAR(xr[i].imag(), x[i].imag(), 1e-10);
+    }
+}
+
+//! 生成确定性的伪随机测试序列
+static std::vector<double> makeTestSequence(std::size_t n)
+{
+    std::vector<double> seq(n);
+    uint32_t state = 0x2024;
+    for (auto &x : seq)
+    {
+        state = state * 1664525u + 1013904223u;
+        x = static_cast<double>(state % 1000) / 10. - 50.;
+    }
+    return seq;
+}
+
+TEST(DSPTest, moving_average)
+{
+    constexpr std::size_t window = 7;
+    auto seq = makeTestSequence(100);
+    rm::MovingAverage avg(window);
+    EXPECT_EQ(avg.get(), 0.);
+    for (std::size_t i = 0; i < seq.size(); ++i)
+    {
+        double result = avg.update(seq[i]);
+        // 与窗口内样本直接求均值的结果一致
+        std::size_t lo = i + 1 > window ? i + 1 - window : 0;
+        double sum{};
+        for (std::size_t j = lo; j <= i; ++j)
+            sum += seq[j];
+        EXPECT_NEAR(result, sum / static_cast<double>(i - lo + 1), 1e-12);
+        EXPECT_EQ(avg.size(), i - lo + 1);
+        EXPECT_NEAR(avg.get(), result, 1e-12);
+    }
+}
+
+TEST(DSPTest, moving_min_max)
+{
+    constexpr std::size_t window = 9;
+    auto seq = makeTestSequence(200);
+    rm::MovingMinMax extremum(window);
+    for (std::size_t i = 0; i < seq.size(); ++i)
+    {
+        extremum.update(seq[i]);
+        // 与窗口内样本直接求最值的结果一致
+        std::size_t lo = i + 1 > window ? i + 1 - window : 0;
+        EXPECT_EQ(extremum.min(), *std::min_element(seq.begin() + lo, seq.begin() + i + 1));
+        EXPECT_EQ(extremum.max(), *std::max_element(seq.begin() + lo, seq.begin() + i + 1));
+    }
+}
+
+TEST(DSPTest, moving_median)
+{
+    constexpr std::size_t window = 11;
+    auto seq = makeTestSequence(200);
+    rm::MovingMedian median(window);
+    for (std::size_t i = 0; i < seq.size(); ++i)
+    {
+        double result = median.update(seq[i]);
+        // 与窗口内样本排序取中值的结果一致
+        std::size_t lo = i + 1 > window ? i + 1 - window : 0;
+        std::vector<double> win(seq.begin() + lo, seq.begin() + i + 1);
+        std::sort(win.begin(), win.end());
+        double expected = win.size() % 2 == 1 ? win[win.size() / 2]
+                                              : (win[win.size() / 2 - 1] + win[win.size() / 2]) / 2;
+        EXPECT_NEAR(result, expected, 1e-12);
+        EXPECT_EQ(median.size(), win.size());
+    }
+    // 含重复样本的序列
+    rm::MovingMedian dup_median(4);
+    for (double x : {2., 2., 2., 5., 5., 2.})
+        dup_median.update(x);
+    EXPECT_NEAR(dup_median.get(), 3.5, 1e-12);
+}
+
+TEST(DSPTest, xcorr)
+{
+    auto a = makeTestSequence(40), b = makeTestSequence(25);
+    rm::RealSignal sa(a.size()), sb(b.size());
+    for (std::size_t i = 0; i < a.size(); ++i)
+        sa[i] = a[i];
+    for (std::size_t i = 0; i < b.size(); ++i)
+        sb[i] = b[i];
+    auto r = rm::xcorr(sa, sb);
+    EXPECT_EQ(r.size(), a.size() + b.size() - 1);
+    // 与 O(n²) 直接计算的线性互相关一致
+    for (std::size_t k = 0; k < r.size(); ++k)
+    {
+        std::ptrdiff_t lag = static_cast<std::ptrdiff_t>(k) - static_cast<std::ptrdiff_t>(b.size()) + 1;
+        double expected{};
+        for (std::size_t i = 0; i < b.size(); ++i)
+        {
+            std::ptrdiff_t j = static_cast<std::ptrdiff_t>(i) + lag;
+            if (j >= 0 && j < static_cast<std::ptrdiff_t>(a.size()))
+                expected += a[j] * b[i];
+        }
+        EXPECT_NEAR(r[k], expected, 1e-8);
+    }
+}
+
+TEST(DSPTest, xcorr_lag_recovery)
+{
+    // b 为 a 延迟 37 个采样点的片段，互相关峰值应落在对应滞后处
+    constexpr std::size_t delay = 37;
+    auto seq = makeTestSequence(300);
+    rm::RealSignal a(seq.size()), b(100);
+    for (std::size_t i = 0; i < seq.size(); ++i)
+        a[i] = seq[i];
+    for (std::size_t i = 0; i < b.size(); ++i)
+        b[i] = seq[i + delay];
+    auto r = rm::xcorr(a, b);
+    std::size_t max_it{};
+    for (std::size_t k = 1; k < r.size(); ++k)
+        if (r[k] > r[max_it])
+            max_it = k;
+    EXPECT_EQ(max_it - (b.size() - 1), delay);
+}
+
+TEST(DSPTest, psd)
+{
+    constexpr std::size_t nfft = 256;
+    constexpr int f = 32;
+    constexpr double amp = 3.;
+    // 幅值为 3 的整频点正弦波，单边功率谱峰值应为 A²/2 = 4.5
+    rm::RealSignal x(1024);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        x[i] = amp * std::sin(2 * rm::PI * i * f / nfft);
+    for (auto window : {rm::WindowType::Rect, rm::WindowType::Hann, rm::WindowType::Hamming})
+    {
+        auto gx = rm::psd(x, nfft, window);
+        EXPECT_EQ(gx.size(), nfft / 2 + 1);
+        std::size_t max_it{};
+        for (std::size_t i = 1; i < gx.size(); ++i)
+            if (gx[i] > gx[max_it])
+                max_it = i;
+        EXPECT_EQ(max_it, static_cast<std::size_t>(f));
+        EXPECT_NEAR(gx[max_it], amp * amp / 2, 0.1);
+    }
+    // 信号长度不足时抛出异常
+    rm::RealSignal bad(100);
+    EXPECT_THROW(rm::psd(bad, nfft), rm::Exception);
+}
+
+TEST(DSPTest, resample)
+{
+    // 1 kHz 正弦信号降采样至 200 Hz，与解析值比较（忽略滤波器边缘）
+    constexpr double fs = 1000., f = 20.;
+    rm::RealSignal x(500);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        x[i] = std::sin(2 * rm::PI * f * i / fs);
+    auto y = rm::resample(x, 1, 5);
+    EXPECT_EQ(y.size(), x.size() / 5);
+    // 原型滤波器通带存在约 0.15% 的衰减，容差适当放宽
+    for (std::size_t m = 15; m + 15 < y.size(); ++m)
+        EXPECT_NEAR(y[m], std::sin(2 * rm::PI * f * m / 200.), 2e-3);
+    // 2 倍插值，偶数下标应与原信号对齐
+    auto y2 = rm::resample(x, 2, 1);
+    EXPECT_EQ(y2.size(), x.size() * 2);
+    for (std::size_t m = 40; m + 40 < y2.size(); ++m)
+        EXPECT_NEAR(y2[m], std::sin(2 * rm::PI * f * m / 2000.), 1e-3);
+    // 非法倍率抛出异常
+    EXPECT_THROW(rm::resample(x, 0, 5), rm::Exception);
+}
+
+TEST(DSPTest, goertzel)
+{
+    constexpr std::size_t N = 256;
+    constexpr std::size_t k = 12;
+    rm::RealSignal x(N);
+    for (std::size_t i = 0; i < N; ++i)
+        x[i] = 0.3 + std::sin(2 * rm::PI * k * i / N + 0.4);
+    // 单频点结果与全长变换的对应频点一致
+    rm::ComplexSignal xc(N);
+    for (std::size_t i = 0; i < N; ++i)
+        xc[i] = x[i];
+    auto X = rm::dft(xc);
+    auto s = rm::goertzel(x, k);
+    EXPECT_NEAR(s.real(), X[k].real(), 1e-8);
+    EXPECT_NEAR(s.imag(), X[k].imag(), 1e-8);
+    // 幅值与相位与正弦分量解析值一致，sin(θ) = cos(θ - π/2)
+    EXPECT_NEAR(2 * std::abs(s) / N, 1., 1e-10);
+    EXPECT_NEAR(std::arg(s), 0.4 - rm::PI / 2, 1e-10);
+}
+
+TEST(DSPTest, goertzel_detector)
+{
+    constexpr std::size_t N = 128;
+    constexpr std::size_t k = 4;
+    rm::GoertzelDetector detector(N, k);
+    // 推入 3 个窗口长度的样本，覆盖未满、滑动与精确重算阶段
+    for (std::size_t i = 0; i < 3 * N; ++i)
+    {
+        detector.update(2. * std::cos(2 * rm::PI * k * i / N + 1.1));
+        // 窗口满后任意时刻的频谱值与窗口内样本的单频点直接计算一致
+        if (i == N + 7 || i == 2 * N + 3 || i == 3 * N - 1)
+        {
+            rm::RealSignal win(N);
+            std::size_t start = i + 1 - N;
+            for (std::size_t m = 0; m < N; ++m)
+                win[m] = 2. * std::cos(2 * rm::PI * k * (start + m) / N + 1.1);
+            auto ref = rm::goertzel(win, k);
+            EXPECT_NEAR(std::abs(detector.get() - ref), 0., 1e-9);
+        }
+    }
+    // 窗口整数周期覆盖正弦分量，幅值与窗口起始相位与解析值一致
+    EXPECT_NEAR(detector.amp(), 2., 1e-9);
+    std::size_t start = 3 * N - N;
+    double expect_phase = std::remainder(2 * rm::PI * k * start / N + 1.1, 2 * rm::PI);
+    EXPECT_NEAR(std::remainder(detector.phase() - expect_phase, 2 * rm::PI), 0., 1e-9);
+    // 非法参数抛出异常
+    EXPECT_THROW(rm::GoertzelDetector(0, 0), rm::Exception);
+    EXPECT_THROW(rm::GoertzelDetector(8, 8), rm::Exception);
+}
+
 } // namespace rm_test
@@ -28,6 +28,29 @@ TEST(EwTopsisTest, BasicFunction)
     EXPECT_EQ(it, ret.begin());
 }
 
+TEST(EwTopsisTest, ReuseWorkspace)
+{
+    std::vector<std::vector<double>> samples1 = {{1., 1.}, {3., 3.}, {2., 4.}, {1., 5.}};
+    std::vector<std::vector<double>> samples2 = {{5., 2.}, {1., 3.}, {4., 4.}, {2., 1.}};
+
+    // 同一对象通过 updateSamples 复用工作区，结果与新建对象一致
+    EwTopsis ew(samples1);
+    ew.inference();
+    ew.updateSamples(samples2);
+    auto reused = ew.inference();
+
+    EwTopsis ew2(samples2);
+    auto fresh = ew2.inference();
+    ASSERT_EQ(reused.size(), fresh.size());
+    for (std::size_t i = 0; i < fresh.size(); ++i)
+        EXPECT_EQ(reused[i], fresh[i]);
+
+    // 重复推理结果稳定
+    auto again = ew.inference();
+    for (std::size_t i = 0; i < fresh.size(); ++i)
+        EXPECT_EQ(again[i], fresh[i]);
+}
+
 class EwA;
 using Ew_ptr = std::shared_ptr<EwA>;
 
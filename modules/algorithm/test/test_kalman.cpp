@@ -50,6 +50,40 @@ TEST(KalmanTest, kf)
     EXPECT_NEAR(x(1), 30, 1e-2); // 0.3 / 0.01
 }
 
+// 多步预测快速路径测试
+TEST(KalmanTest, kf_predict_to)
+{
+    rm::KF21d kf;
+    kf.init({50, 30}, 1e-3);
+    double t{0.01};
+    kf.setA({1, t,
+             0, 1});
+    // n 步外推等价于 n 次 A 的应用：x + n * T * v
+    auto x10 = kf.predictTo(10);
+    EXPECT_NEAR(x10(0), 50 + 10 * t * 30, 1e-9);
+    EXPECT_NEAR(x10(1), 30, 1e-9);
+    // 以相同矩阵重设 A 后缓存保留，结果不变
+    kf.setA({1, t,
+             0, 1});
+    auto x10b = kf.predictTo(10);
+    EXPECT_NEAR(x10b(0), x10(0), 1e-12);
+    // 步数变化时重建缓存
+    auto x0 = kf.predictTo(0);
+    EXPECT_NEAR(x0(0), 50, 1e-12);
+    auto x25 = kf.predictTo(25);
+    EXPECT_NEAR(x25(0), 50 + 25 * t * 30, 1e-9);
+    // A 变化时缓存失效
+    kf.setA({1, 2 * t,
+             0, 1});
+    auto x10c = kf.predictTo(10);
+    EXPECT_NEAR(x10c(0), 50 + 20 * t * 30, 1e-9);
+    // predictTo 不改变滤波器状态
+    kf.setH({1, 0});
+    kf.predict();
+    auto x = kf.correct({50 + 30 * 2 * t});
+    EXPECT_NEAR(x(1), 30, 1);
+}
+
 // 二维匀速直线运动 KF 测试
 TEST(KalmanTest, kf2)
 {
@@ -149,6 +183,144 @@ TEST(KalmanTest, ekf)
     EXPECT_NEAR(x(3), 2, 0.1); // 0.02 / 0.01
 }
 
+// 批量 KF 测试，结果应与逐个运行的 rm::KalmanFilter 一致
+TEST(KalmanTest, kf_batch)
+{
+    constexpr std::size_t N = 8;
+    double t{0.01};
+    rm::KalmanFilterBatch<double, 2, 1> batch;
+    std::vector<rm::KF21d> kfs(N);
+    for (std::size_t j = 0; j < N; ++j)
+    {
+        batch.append({50. + j, 0}, 1e5);
+        kfs[j].init({50. + j, 0}, 1e5);
+        kfs[j].setQ(1e-1 * cv::Matx22d::eye());
+        kfs[j].setR({1e-3});
+        kfs[j].setA({1, t, 0, 1});
+        kfs[j].setH({1, 0});
+    }
+    batch.setQ(1e-1 * cv::Matx22d::eye());
+    batch.setR({1e-3});
+    batch.setA({1, t, 0, 1});
+    batch.setH({1, 0});
+
+    std::vector<cv::Matx<double, 1, 1>> zks(N);
+    for (int i = 0; i <= 100; i++)
+    {
+        batch.predict();
+        for (std::size_t j = 0; j < N; ++j)
+        {
+            kfs[j].predict();
+            zks[j] = {50. + j + 0.3 * i};
+            kfs[j].correct(zks[j]);
+        }
+        batch.correct(zks);
+    }
+    for (std::size_t j = 0; j < N; ++j)
+    {
+        EXPECT_NEAR(batch.x(j)(0), 80 + j, 1e-2);
+        EXPECT_NEAR(batch.x(j)(1), 30, 1e-2);
+    }
+}
+
+// 一维匀速运动平方根 KF 测试，结果应与 rm::KalmanFilter 一致
+TEST(KalmanTest, ud_kf)
+{
+    double t{0.01};
+    rm::UDKF21d udkf;
+    rm::KF21d kf;
+    udkf.init({50, 0}, 1e5), kf.init({50, 0}, 1e5);
+    udkf.setQ(1e-1 * cv::Matx22d::eye()), kf.setQ(1e-1 * cv::Matx22d::eye());
+    udkf.setR({1e-3}), kf.setR({1e-3});
+    udkf.setA({1, t, 0, 1}), kf.setA({1, t, 0, 1});
+    udkf.setH({1, 0}), kf.setH({1, 0});
+
+    cv::Matx21d x{}, xref{};
+    for (int i = 0; i <= 100; i++)
+    {
+        udkf.predict(), kf.predict();
+        x = udkf.correct({50 + 0.3 * i});
+        xref = kf.correct({50 + 0.3 * i});
+    }
+    EXPECT_NEAR(x(0), 80, 1e-2);
+    EXPECT_NEAR(x(1), 30, 1e-2);
+    EXPECT_NEAR(x(0), xref(0), 1e-8);
+    EXPECT_NEAR(x(1), xref(1), 1e-8);
+}
+
+// 单精度长时间运行的平方根 KF 测试
+TEST(KalmanTest, ud_kf_float_stability)
+{
+    float t{0.01f};
+    rm::UDKF42f udkf;
+    udkf.init({0, 0, 0, 0}, 1e5f);
+    udkf.setQ(1e-3f * cv::Matx44f::eye());
+    udkf.setR(cv::Matx22f::diag({1e-2f, 1e-2f}));
+    udkf.setA({1, 0, t, 0,
+               0, 1, 0, t,
+               0, 0, 1, 0,
+               0, 0, 0, 1});
+    udkf.setH({1, 0, 0, 0,
+               0, 1, 0, 0});
+
+    cv::Matx41f x{};
+    for (int i = 0; i <= 20000; i++)
+    {
+        udkf.predict();
+        x = udkf.correct({0.1f * i, -0.2f * i});
+    }
+    EXPECT_NEAR(x(0), 2000, 1);
+    EXPECT_NEAR(x(1), -4000, 1);
+    EXPECT_NEAR(x(2), 10, 0.1f);
+    EXPECT_NEAR(x(3), -20, 0.1f);
+}
+
+// 平面目标圆弧运动平方根 EKF 测试，与 KalmanTest.ekf 相同的系统
+TEST(KalmanTest, ud_ekf)
+{
+    std::default_random_engine ng;
+    std::normal_distribution<double> err{0, 1};
+
+    rm::UDEKF53d ekf;
+    ekf.init({0, 0, 0, 0, 150}, 1e5);
+    ekf.setQ(1e-1 * cv::Matx<double, 5, 5>::eye());
+    ekf.setR(cv::Matx33d::diag({1e-3, 1e-3, 1e-3}));
+    double t{0.01};
+    ekf.setFa([=](const cv::Matx<double, 5, 1> &x) -> cv::Matx<double, 5, 1> {
+        return {x(0),
+                x(1),
+                x(2) + x(3) * t,
+                x(3),
+                x(4)};
+    });
+    ekf.setFh([=](const cv::Matx<double, 5, 1> &x) -> cv::Matx<double, 3, 1> {
+        return {x(0) + x(4) * std::cos(x(2)),
+                x(1) + x(4) * std::sin(x(2)),
+                x(2)};
+    });
+
+    cv::Matx<double, 5, 1> x{};
+    for (int i = 0; i <= 200; i++)
+    {
+        ekf.setJa({1, 0, 0, 0, 0,
+                   0, 1, 0, 0, 0,
+                   0, 0, 1, t, 0,
+                   0, 0, 0, 1, 0,
+                   0, 0, 0, 0, 1});
+        auto x_ = ekf.predict();
+        ekf.setJh({1, 0, -x_(4) * std::sin(x_(2)), 0, std::cos(x_(2)),
+                   0, 1, x_(4) * std::cos(x_(2)), 0, std::sin(x_(2)),
+                   0, 0, 1, 0, 0});
+        x = ekf.correct({500 + 200 * std::cos(0.02 * i) + err(ng),
+                         500 + 200 * std::sin(0.02 * i) + err(ng),
+                         0.02 * i + 0.01 * err(ng)});
+    }
+    EXPECT_NEAR(x(0), 500, 1);
+    EXPECT_NEAR(x(1), 500, 1);
+    EXPECT_NEAR(x(2), 4, 0.1);
+    EXPECT_NEAR(x(3), 2, 0.1);
+}
+
 } // namespace rm_test
 
 #endif // HAVE_OPENCV
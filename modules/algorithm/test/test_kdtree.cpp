@@ -0,0 +1,75 @@
+/**
+ * @file test_kdtree.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief KD 树单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/algorithm/datastruct.hpp"
+
+namespace rm_test
+{
+
+// 最近邻查询与暴力扫描结果一致
+TEST(KDTreeTest, nearest_matches_brute_force)
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> dis(-100.f, 100.f);
+    std::vector<std::array<float, 2>> points(200);
+    for (auto &pt : points)
+        pt = {dis(gen), dis(gen)};
+    rm::KDTree<2> kdtree(points);
+    EXPECT_EQ(kdtree.size(), 200u);
+    for (int i = 0; i < 50; i++)
+    {
+        std::array<float, 2> query{dis(gen), dis(gen)};
+        auto d2 = [&query](const std::array<float, 2> &pt) {
+            return (pt[0] - query[0]) * (pt[0] - query[0]) + (pt[1] - query[1]) * (pt[1] - query[1]);
+        };
+        std::size_t brute = std::min_element(points.begin(), points.end(), [&d2](const auto &lhs, const auto &rhs) {
+                                return d2(lhs) < d2(rhs);
+                            }) -
+                            points.begin();
+        EXPECT_FLOAT_EQ(d2(points[kdtree.nearest(query)]), d2(points[brute]));
+    }
+}
+
+// 过滤器跳过已匹配的点
+TEST(KDTreeTest, nearest_with_filter)
+{
+    std::vector<std::array<float, 2>> points = {{0.f, 0.f}, {1.f, 0.f}, {5.f, 0.f}};
+    rm::KDTree<2> kdtree(points);
+    std::array<float, 2> query{0.2f, 0.f};
+    EXPECT_EQ(kdtree.nearest(query), 0u);
+    std::vector<bool> matched(points.size());
+    matched[0] = true;
+    EXPECT_EQ(kdtree.nearest(query, [&matched](std::size_t idx) { return !matched[idx]; }), 1u);
+    matched[1] = true;
+    EXPECT_EQ(kdtree.nearest(query, [&matched](std::size_t idx) { return !matched[idx]; }), 2u);
+    matched[2] = true;
+    // 无满足过滤器的点时返回 npos
+    EXPECT_EQ(kdtree.nearest(query, [&matched](std::size_t idx) { return !matched[idx]; }), rm::KDTree<2>::npos);
+}
+
+// 空树与重新构建
+TEST(KDTreeTest, empty_and_rebuild)
+{
+    rm::KDTree<3> kdtree;
+    EXPECT_TRUE(kdtree.empty());
+    EXPECT_EQ(kdtree.nearest({0.f, 0.f, 0.f}), rm::KDTree<3>::npos);
+    kdtree.build({{1.f, 2.f, 3.f}});
+    EXPECT_EQ(kdtree.nearest({0.f, 0.f, 0.f}), 0u);
+    kdtree.build({{1.f, 0.f, 0.f}, {0.f, 1.f, 0.f}});
+    EXPECT_EQ(kdtree.size(), 2u);
+    EXPECT_EQ(kdtree.nearest({0.9f, 0.f, 0.f}), 0u);
+}
+
+} // namespace rm_test
@@ -9,6 +9,8 @@
  *
  */
 
+#include <set>
+
 #include <gtest/gtest.h>
 
 #include "rmvl/algorithm/math.hpp"
@@ -58,3 +60,83 @@ TEST(Munkres, test3)
     EXPECT_EQ(result[2], 0);
     EXPECT_EQ(result[3], 3);
 }
+
+TEST(MunkresEngine, cold_solve)
+{
+    std::vector<std::vector<double>> cost = {
+        {82, 83, 69, 92},
+        {77, 37, 49, 92},
+        {11, 69, 5, 86},
+        {8, 9, 98, 23}};
+    rm::MunkresEngine km(cost);
+    auto result = km.solve();
+    EXPECT_EQ(result.size(), 4);
+    EXPECT_EQ(result[0], 2);
+    EXPECT_EQ(result[1], 1);
+    EXPECT_EQ(result[2], 0);
+    EXPECT_EQ(result[3], 3);
+}
+
+TEST(MunkresEngine, warm_start)
+{
+    std::vector<std::vector<double>> cost = {
+        {1, 2, 3},
+        {3, 2, 1},
+        {2, 1, 3}};
+    rm::MunkresEngine km(cost);
+    auto result = km.solve();
+    EXPECT_EQ(result[0], 0);
+    EXPECT_EQ(result[1], 2);
+    EXPECT_EQ(result[2], 1);
+    // 代价轻微扰动，最优分配不变
+    km.updateCosts({{1.1, 2, 3},
+                    {3, 2.1, 1},
+                    {2, 1.1, 3}});
+    result = km.solve();
+    EXPECT_EQ(result[0], 0);
+    EXPECT_EQ(result[1], 2);
+    EXPECT_EQ(result[2], 1);
+    // 代价变化导致最优分配改变
+    km.updateCosts({{3, 2, 1},
+                    {1, 2, 3},
+                    {2, 1, 3}});
+    result = km.solve();
+    EXPECT_EQ(result[0], 2);
+    EXPECT_EQ(result[1], 0);
+    EXPECT_EQ(result[2], 1);
+}
+
+TEST(MunkresEngine, insert_erase)
+{
+    std::vector<std::vector<double>> cost = {
+        {1, 2, 3},
+        {3, 2, 1},
+        {2, 1, 3}};
+    rm::MunkresEngine km(cost);
+    km.solve();
+    // 新目标进入视野，新增一行一列
+    km.insertRow({2, 3, 1});
+    km.insertCol({4, 5, 3, 6});
+    auto result = km.solve();
+    EXPECT_EQ(result.size(), 4);
+    // 存在多个最优分配，校验分配互不冲突且总代价最优
+    std::vector<std::vector<double>> cost4 = {
+        {1, 2, 3, 4},
+        {3, 2, 1, 5},
+        {2, 1, 3, 3},
+        {2, 3, 1, 6}};
+    std::set<std::size_t> cols(result.begin(), result.end());
+    EXPECT_EQ(cols.size(), 4);
+    double total{};
+    for (std::size_t i = 0; i < result.size(); ++i)
+        total += cost4[i][result[i]];
+    EXPECT_EQ(total, 7);
+    // 目标离开视野，删除一行一列
+    km.eraseRow(3);
+    km.eraseCol(3);
+    result = km.solve();
+    EXPECT_EQ(result.size(), 3);
+    EXPECT_EQ(result[0], 0);
+    EXPECT_EQ(result[1], 2);
+    EXPECT_EQ(result[2], 1);
+}
@@ -0,0 +1,127 @@
+/**
+ * @file test_math.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 快速三角函数近似单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "rmvl/algorithm/math.hpp"
+
+namespace rm_test
+{
+
+TEST(FastMathTest, sin_cos)
+{
+    // [-4π, 4π] 上与标准库逐点比较，误差不超过 1e-6
+    for (int i = -10000; i <= 10000; ++i)
+    {
+        double x = 4 * rm::PI * i / 10000.;
+        EXPECT_NEAR(rm::fastmath::sin(x), std::sin(x), 1e-6);
+        EXPECT_NEAR(rm::fastmath::cos(x), std::cos(x), 1e-6);
+    }
+}
+
+TEST(FastMathTest, atan)
+{
+    // 覆盖 |x| ≤ 1 与 |x| > 1 两条规约分支
+    for (int i = -10000; i <= 10000; ++i)
+    {
+        double x = 10. * i / 10000.;
+        EXPECT_NEAR(rm::fastmath::atan(x), std::atan(x), 1e-6);
+    }
+}
+
+TEST(FastMathTest, atan2)
+{
+    // 四象限与坐标轴上的方位角
+    for (int iy = -20; iy <= 20; ++iy)
+        for (int ix = -20; ix <= 20; ++ix)
+        {
+            double y = iy / 4., x = ix / 4.;
+            if (x == 0. && y == 0.)
+                continue;
+            EXPECT_NEAR(rm::fastmath::atan2(y, x), std::atan2(y, x), 1e-6);
+        }
+    EXPECT_EQ(rm::fastmath::atan2(0., 0.), 0.);
+}
+
+TEST(FastMathTest, batch)
+{
+    // 批量接口与标量接口结果一致，且支持原地计算
+    std::vector<double> x(256), y(256);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        x[i] = -2 * rm::PI + 4 * rm::PI * i / x.size();
+    rm::fastmath::sin(x.data(), y.data(), x.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        EXPECT_EQ(y[i], rm::fastmath::sin(x[i]));
+    auto x2 = x;
+    rm::fastmath::cos(x2.data(), x2.data(), x2.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        EXPECT_EQ(x2[i], rm::fastmath::cos(x[i]));
+    rm::fastmath::atan2(x.data(), y.data(), y.data(), x.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        EXPECT_EQ(y[i], rm::fastmath::atan2(x[i], rm::fastmath::sin(x[i])));
+}
+
+TEST(CircularAccumulatorTest, mean_and_variance)
+{
+    // 跨越 ±π 断点的一组角度，圆均值不受断点影响
+    rm::CircularAccumulator acc(4);
+    acc.update(0, rm::PI - 0.1);
+    acc.update(1, -rm::PI + 0.1);
+    acc.update(2, rm::PI - 0.05);
+    acc.update(3, -rm::PI + 0.05);
+    EXPECT_NEAR(std::abs(acc.mean()), rm::PI, 1e-12);
+    // 角度完全一致时合向量长度为 1，圆方差为 0
+    for (std::size_t i = 0; i < acc.size(); ++i)
+        acc.update(i, 0.5);
+    EXPECT_NEAR(acc.resultant(), 1., 1e-12);
+    EXPECT_NEAR(acc.variance(), 0., 1e-12);
+    EXPECT_NEAR(acc.mean(), 0.5, 1e-12);
+    // 均匀分布时合向量长度为 0
+    for (std::size_t i = 0; i < acc.size(); ++i)
+        acc.update(i, i * rm::PI / 2.);
+    EXPECT_NEAR(acc.resultant(), 0., 1e-12);
+    EXPECT_THROW(acc.update(4, 0.), rm::Exception);
+}
+
+TEST(CircularAccumulatorTest, custom_period)
+{
+    // 以 72° 为周期时，相差整数倍周期的角度视为同一角度
+    rm::CircularAccumulator acc(3, 72.);
+    acc.update(0, 10.);
+    acc.update(1, 10. + 72.);
+    acc.update(2, 10. - 144.);
+    EXPECT_NEAR(acc.resultant(), 1., 1e-12);
+    EXPECT_NEAR(acc.mean(), 10., 1e-9);
+    // 周期内的小扰动围绕均值聚合
+    acc.update(0, 9.);
+    acc.update(1, 83.);
+    EXPECT_NEAR(acc.mean(), 10., 1e-9);
+}
+
+TEST(CircularAccumulatorTest, incremental_consistency)
+{
+    // 大量增量更新（含重新求和周期）后与从头构造的累加器结果一致
+    rm::CircularAccumulator inc(8);
+    for (std::size_t round = 0; round < 2000; ++round)
+        for (std::size_t i = 0; i < inc.size(); ++i)
+            inc.update(i, std::fmod(0.37 * round + 0.71 * i, 2. * rm::PI) - rm::PI);
+    rm::CircularAccumulator fresh(8);
+    for (std::size_t i = 0; i < fresh.size(); ++i)
+        fresh.update(i, std::fmod(0.37 * 1999 + 0.71 * i, 2. * rm::PI) - rm::PI);
+    EXPECT_NEAR(inc.mean(), fresh.mean(), 1e-9);
+    EXPECT_NEAR(inc.resultant(), fresh.resultant(), 1e-9);
+    // 重置后槽位清空
+    inc.resize(2);
+    EXPECT_EQ(inc.size(), 2u);
+    EXPECT_NEAR(inc.resultant(), 0., 1e-12);
+}
+
+} // namespace rm_test
@@ -0,0 +1,78 @@
+/**
+ * @file test_matx_expr.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 小型定维矩阵表达式模板单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#ifdef HAVE_OPENCV
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "rmvl/algorithm/matx_expr.hpp"
+
+namespace rm_test
+{
+
+//! 生成元素服从 U(-1, 1) 的随机矩阵
+template <int M, int N>
+static cv::Matx<double, M, N> randomMatx(std::mt19937 &gen)
+{
+    std::uniform_real_distribution<double> dis(-1., 1.);
+    cv::Matx<double, M, N> m;
+    for (int i = 0; i < M * N; ++i)
+        m.val[i] = dis(gen);
+    return m;
+}
+
+TEST(MatxExprTest, fused_filter_chains)
+{
+    std::mt19937 gen(0x2025);
+    auto A = randomMatx<9, 9>(gen), P = randomMatx<9, 9>(gen), Q = randomMatx<9, 9>(gen);
+    auto H = randomMatx<4, 9>(gen);
+    auto K = randomMatx<9, 4>(gen);
+    auto I = cv::Matx<double, 9, 9>::eye();
+    cv::Matx<double, 9, 9> At = A.t();
+    // 预测链 APAᵀ + Q
+    cv::Matx<double, 9, 9> fused = rm::matx(A) * P * At + Q;
+    cv::Matx<double, 9, 9> naive = A * P * At + Q;
+    for (int i = 0; i < 81; ++i)
+        EXPECT_NEAR(fused.val[i], naive.val[i], 1e-12);
+    // 校正链 (I - KH)P
+    fused = (rm::matx(I) - K * H) * P;
+    naive = (I - K * H) * P;
+    for (int i = 0; i < 81; ++i)
+        EXPECT_NEAR(fused.val[i], naive.val[i], 1e-12);
+    // 新息协方差链 HPHᵀ + R，显式 eval
+    auto R = randomMatx<4, 4>(gen);
+    cv::Matx<double, 4, 4> fused2 = (rm::matx(H) * P * H.t() + R).eval();
+    cv::Matx<double, 4, 4> naive2 = H * P * H.t() + R;
+    for (int i = 0; i < 16; ++i)
+        EXPECT_NEAR(fused2.val[i], naive2.val[i], 1e-12);
+}
+
+TEST(MatxExprTest, transpose_and_scale)
+{
+    std::mt19937 gen(0x0817);
+    auto A = randomMatx<5, 3>(gen);
+    auto B = randomMatx<5, 4>(gen);
+    // 转置视图参与乘法，数乘融合求值
+    cv::Matx<double, 3, 4> fused = rm::matx(A).t() * B * 2.;
+    cv::Matx<double, 3, 4> naive = (A.t() * B) * 2.;
+    for (int i = 0; i < 12; ++i)
+        EXPECT_NEAR(fused.val[i], naive.val[i], 1e-12);
+    // 标量左乘与逐元素减法
+    cv::Matx<double, 5, 3> fused2 = 3. * rm::matx(A) - A;
+    for (int i = 0; i < 15; ++i)
+        EXPECT_NEAR(fused2.val[i], 2. * A.val[i], 1e-12);
+}
+
+} // namespace rm_test
+
+#endif // HAVE_OPENCV
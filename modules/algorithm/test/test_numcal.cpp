@@ -26,6 +26,14 @@ TEST(NumberCalculation, polynomial)
     EXPECT_EQ(foo(2), 17); // 1 + 2*2 + 3*2*2 = 17
 }
 
+TEST(NumberCalculation, static_polynomial)
+{
+    constexpr rm::PolynomialT foo(std::array{1., 2., 3.});
+    static_assert(foo(0) == 1, "1 + 2*0 + 3*0*0 = 1");
+    static_assert(foo(1) == 6, "1 + 2*1 + 3*1*1 = 6");
+    EXPECT_EQ(foo(2), 17); // 与 rm::Polynomial 结果一致
+}
+
 TEST(NumberCalculation, function_interpolator)
 {
     rm::Interpolator foo({1, 2, 3}, {0, 1, 0});
@@ -34,6 +42,34 @@ TEST(NumberCalculation, function_interpolator)
     EXPECT_EQ(foo(4), -7); // a0 = 1, a1=-10/3, a2=3, a3=-2/3
 }
 
+TEST(NumberCalculation, static_function_interpolator)
+{
+    constexpr rm::InterpolatorT foo(std::array{1., 2., 3.}, std::array{0., 1., 0.});
+    static_assert(foo(1) == 0 && foo(2) == 1 && foo(3) == 0, "interpolation conditions");
+    EXPECT_EQ(foo(0), -3); // 与 rm::Interpolator 结果一致
+}
+
+TEST(NumberCalculation, uniform_interpolator)
+{
+    // 节点 x = 1, 1.5, 2, 2.5，y = x^2
+    rm::UniformInterpolator foo(1, 0.5, {1, 2.25, 4, 6.25});
+    // 节点处取节点值
+    EXPECT_NEAR(foo(1), 1, 1e-12);
+    EXPECT_NEAR(foo(2.5), 6.25, 1e-12);
+    // 区间内为线性插值
+    EXPECT_NEAR(foo(1.25), (1 + 2.25) / 2, 1e-12);
+    EXPECT_NEAR(foo(2.25), (4 + 6.25) / 2, 1e-12);
+    // 越界时按端部区间的斜率线性外推
+    EXPECT_NEAR(foo(0.5), 1 - 0.5 * (2.25 - 1) / 0.5, 1e-12);
+    EXPECT_NEAR(foo(3), 6.25 + 0.5 * (6.25 - 4) / 0.5, 1e-12);
+    // 批量求值
+    std::vector<double> ys;
+    foo({1, 1.5, 2, 2.5}, ys);
+    ASSERT_EQ(ys.size(), 4u);
+    EXPECT_NEAR(ys[1], 2.25, 1e-12);
+    EXPECT_NEAR(ys[3], 6.25, 1e-12);
+}
+
 #ifdef HAVE_OPENCV
 
 TEST(NumberCalculation, curve_fitter_ax_b)
@@ -61,6 +97,63 @@ TEST(NumberCalculation, curve_fitter_ax3_cx_d)
 
 #endif // HAVE_OPENCV
 
+TEST(NumberCalculation, curve_fitter_stream)
+{
+    // 2x^2 + 3x - 1，窗口长度 4
+    rm::CurveFitterStream foo(0b111, 4);
+    foo.add(0, -1), foo.add(1, 4), foo.add(2, 13);
+    EXPECT_EQ(foo.size(), 3u);
+    EXPECT_NEAR(foo(3), 26, 1e-5);
+    // 插入第 4 个样本后窗口满
+    foo.add(-1, -2);
+    EXPECT_NEAR(foo(3), 26, 1e-5);
+    // 继续插入同一曲线的样本，逐出不改变拟合结果
+    foo.add(3, 26), foo.add(4, 43);
+    EXPECT_EQ(foo.size(), 4u);
+    EXPECT_NEAR(foo(5), 64, 1e-5);
+}
+
+TEST(NumberCalculation, curve_fitter_stream_sliding)
+{
+    // 窗口完全滑出旧曲线后，拟合结果只由新曲线样本决定
+    rm::CurveFitterStream foo(0b11, 3);
+    foo.add(0, 0), foo.add(1, 1), foo.add(2, 2); // y = x
+    EXPECT_NEAR(foo(10), 10, 1e-5);
+    foo.add(0, 1), foo.add(1, 3), foo.add(2, 5); // y = 2x + 1
+    EXPECT_NEAR(foo(10), 21, 1e-5);
+}
+
+TEST(NumberCalculation, recursive_least_squares)
+{
+    // 辨识线性模型 b = 2a₁ - a₂ + 0.5a₃，初值偏差随 kp 增大而减小
+    rm::RecursiveLeastSquares rls(3, 1e8);
+    const std::vector<double> truth = {2, -1, 0.5};
+    for (int i = 0; i < 50; ++i)
+    {
+        std::vector<double> a = {std::sin(0.3 * i), std::cos(0.7 * i), std::sin(1.1 * i + 0.5)};
+        double b = truth[0] * a[0] + truth[1] * a[1] + truth[2] * a[2];
+        rls.update(a, b);
+    }
+    for (std::size_t i = 0; i < rls.dim(); ++i)
+        EXPECT_NEAR(rls.x()[i], truth[i], 1e-5);
+    EXPECT_NEAR(rls({1, 1, 1}), 1.5, 1e-4);
+}
+
+TEST(NumberCalculation, recursive_least_squares_reset)
+{
+    rm::RecursiveLeastSquares rls(2, 1e8);
+    for (int i = 0; i < 20; ++i)
+        rls.update({std::sin(i * 0.9), std::cos(i * 0.4)}, std::sin(i * 0.9) * 3);
+    EXPECT_NEAR(rls.x()[0], 3, 1e-4);
+    // 重置后系数清零，可重新辨识另一组模型
+    rls.reset();
+    EXPECT_EQ(rls.x()[0], 0);
+    EXPECT_EQ(rls.x()[1], 0);
+    for (int i = 0; i < 20; ++i)
+        rls.update({std::sin(i * 0.9), std::cos(i * 0.4)}, std::cos(i * 0.4) * -2);
+    EXPECT_NEAR(rls.x()[1], -2, 1e-4);
+}
+
 TEST(NumberCalculation, nonlinear_solver)
 {
     rm::NonlinearSolver foo([](double x) { // f(x)
@@ -72,6 +165,45 @@ TEST(NumberCalculation, nonlinear_solver)
     EXPECT_NEAR(foo(-1.5), -2, 1e-5); // fo(-2) = 0
 }
 
+TEST(NumberCalculation, nonlinear_equation_analytic_derivative)
+{
+    // Newton 迭代
+    rm::NonlinearSolver newton([](double x) { return x * x - 4; },
+                               [](double x) { return 2 * x; });
+    EXPECT_NEAR(newton(2.5), 2, 1e-5);
+    EXPECT_NEAR(newton(-1.5), -2, 1e-5);
+    // Halley 迭代
+    rm::NonlinearSolver halley([](double x) { return x * x - 4; },
+                               [](double x) { return 2 * x; },
+                               [](double) { return 2.; });
+    EXPECT_NEAR(halley(2.5), 2, 1e-5);
+    EXPECT_NEAR(halley(-1.5), -2, 1e-5);
+}
+
+TEST(NumberCalculation, nonlinear_equation_batch)
+{
+    // 方程族 x^2 - (i + 1) = 0，根为 sqrt(i + 1)
+    rm::NonlinearSolverBatch solver([](std::size_t i, double x) { return x * x - static_cast<double>(i + 1); },
+                                    [](std::size_t, double x) { return 2 * x; });
+    const auto &roots = solver(4, 1.);
+    ASSERT_EQ(roots.size(), 4u);
+    for (std::size_t i = 0; i < roots.size(); i++)
+        EXPECT_NEAR(roots[i], std::sqrt(i + 1.), 1e-5);
+    // 暖启动：再次求解时以上一次的根为初始值
+    const auto &roots2 = solver(4, 1.);
+    for (std::size_t i = 0; i < roots2.size(); i++)
+        EXPECT_NEAR(roots2[i], std::sqrt(i + 1.), 1e-5);
+    // 方程个数变化时回退为给定初始值
+    const auto &roots3 = solver(2, 1.);
+    ASSERT_EQ(roots3.size(), 2u);
+    EXPECT_NEAR(roots3[1], std::sqrt(2.), 1e-5);
+    // 无解析导数时退化为弦截法
+    rm::NonlinearSolverBatch secant([](std::size_t i, double x) { return x * x - static_cast<double>(i + 1); });
+    const auto &roots4 = secant(3, 1.);
+    for (std::size_t i = 0; i < roots4.size(); i++)
+        EXPECT_NEAR(roots4[i], std::sqrt(i + 1.), 1e-5);
+}
+
 TEST(NumberCalculation, runge_kutta_ode)
 {
     auto f = [](double, const std::valarray<double> &xs) { return -2 * xs[0] - 2; }; // e^{-2x} - 1
@@ -123,6 +255,69 @@ TEST(NumberCalculation, runge_kutta_odes)
     EXPECT_NEAR(res4[1], real_x2, 1e-6);
 }
 
+TEST(NumberCalculation, runge_kutta_static_odes)
+{
+    // 与 runge_kutta_odes 相同的方程组，使用定步长模板求解器
+    auto fs = [](double t, const std::array<double, 2> &x) {
+        return std::array{2 * x[1] + t, -x[0] - 3 * x[1]};
+    };
+    double real_x1 = 3.0 / 4.0 * std::exp(-2) + 2 * std::exp(-1) + 3.0 / 2.0 - 7.0 / 4.0;
+    double real_x2 = -3.0 / 4.0 * std::exp(-2) - std::exp(-1) - 1.0 / 2.0 + 3.0 / 4.0;
+
+    rm::RungeKutta4T rk4(fs, 0, std::array{1., -1.});
+    auto res = rk4.solve(0.01, 100);
+    EXPECT_NEAR(res[0], real_x1, 1e-6);
+    EXPECT_NEAR(res[1], real_x2, 1e-6);
+
+    // 稠密输出，在任意点插值
+    auto sol = rk4.solveDense<100>(0.01);
+    auto end = sol(1);
+    EXPECT_NEAR(end[0], real_x1, 1e-6);
+    EXPECT_NEAR(end[1], real_x2, 1e-6);
+    auto mid = sol(0.505); // 落在步长中点
+    double mid_x1 = 3.0 / 4.0 * std::exp(-1.01) + 2 * std::exp(-0.505) + 3.0 / 2.0 * 0.505 - 7.0 / 4.0;
+    double mid_x2 = -3.0 / 4.0 * std::exp(-1.01) - std::exp(-0.505) - 1.0 / 2.0 * 0.505 + 3.0 / 4.0;
+    EXPECT_NEAR(mid[0], mid_x1, 1e-6);
+    EXPECT_NEAR(mid[1], mid_x2, 1e-6);
+}
+
+TEST(NumberCalculation, runge_kutta_45_adaptive)
+{
+    // 与 runge_kutta_static_odes 相同的方程组，使用自适应步长求解器并统计右端求值次数
+    std::size_t evals{};
+    auto fs = [&evals](double t, const std::array<double, 2> &x) {
+        ++evals;
+        return std::array{2 * x[1] + t, -x[0] - 3 * x[1]};
+    };
+    double real_x1 = 3.0 / 4.0 * std::exp(-2) + 2 * std::exp(-1) + 3.0 / 2.0 - 7.0 / 4.0;
+    double real_x2 = -3.0 / 4.0 * std::exp(-2) - std::exp(-1) - 1.0 / 2.0 + 3.0 / 4.0;
+
+    rm::RungeKutta45T rk45(fs, 0, std::array{1., -1.}, 1e-8, 1e-10);
+    auto res = rk45.solve(1.);
+    EXPECT_NEAR(res[0], real_x1, 1e-6);
+    EXPECT_NEAR(res[1], real_x2, 1e-6);
+    // 平缓问题上自适应步长远少于同等精度的定步长求解（100 步 × 4 次求值）
+    EXPECT_LT(evals, 200u);
+}
+
+TEST(NumberCalculation, runge_kutta_45_event)
+{
+    // 自由落体 y'' = -g，事件为落地 y = 0，解析落地时间为 sqrt(2h/g)
+    constexpr double g = 9.8, h0 = 20.;
+    auto fs = [](double, const std::array<double, 2> &x) {
+        return std::array{x[1], -g};
+    };
+    rm::RungeKutta45T rk45(fs, 0, std::array{h0, 0.});
+    auto [t, x] = rk45.solveUntil([](double, const std::array<double, 2> &x) { return -x[0]; }, 10.);
+    EXPECT_NEAR(t, std::sqrt(2 * h0 / g), 1e-6);
+    EXPECT_NEAR(x[0], 0., 1e-6);
+    // 事件未触发时积分至自变量上限
+    rm::RungeKutta45T rk45_far(fs, 0, std::array{h0, 0.});
+    auto [t_max, x_max] = rk45_far.solveUntil([](double, const std::array<double, 2> &x) { return -x[0] - 100.; }, 1.);
+    EXPECT_NEAR(t_max, 1., 1e-12);
+    EXPECT_NEAR(x_max[0], h0 - 0.5 * g, 1e-6);
+}
+
 #if __cpp_lib_generator >= 202207L
 TEST(NumberCalculation, runge_kutta_ode_generator)
 {
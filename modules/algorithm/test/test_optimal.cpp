@@ -38,6 +38,26 @@ TEST(Optimal, derivative)
     EXPECT_NEAR(val_ridders, 2, 1e-12);
 }
 
+TEST(Optimal, grad_parallel_and_complex_step)
+{
+    std::valarray<double> x0 = {1., -2., 3.};
+    auto func = [](const std::valarray<double> &x) { return x[0] * x[0] + 2 * x[1] * x[1] + std::sin(x[2]); };
+    // 并行梯度与串行梯度结果一致
+    auto serial = rm::grad(func, x0);
+    auto parallel = rm::grad(func, x0, rm::DiffMode::Central, 1e-3, true);
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (std::size_t i = 0; i < serial.size(); ++i)
+        EXPECT_NEAR(serial[i], parallel[i], 1e-12);
+    // 复步微分达到机器精度
+    rm::FuncNdComplex cfunc = [](const std::valarray<std::complex<double>> &x) {
+        return x[0] * x[0] + 2. * x[1] * x[1] + std::sin(x[2]);
+    };
+    auto complex_step = rm::grad(cfunc, x0);
+    EXPECT_NEAR(complex_step[0], 2., 1e-14);
+    EXPECT_NEAR(complex_step[1], -8., 1e-14);
+    EXPECT_NEAR(complex_step[2], std::cos(3.), 1e-14);
+}
+
 TEST(Optimal, fminbnd)
 {
     auto [x1, x2] = rm::region(f1d, -5);
@@ -66,6 +86,38 @@ TEST(Optimal, fminunc_conjgrad)
     EXPECT_NEAR(fval, 8, 1e-4);
 }
 
+TEST(Optimal, fminunc_parallel_eval)
+{
+    rm::OptimalOptions options;
+    options.parallel = true;
+    auto [x1, fval1] = rm::fminunc(quadratic, {0, 0}, options);
+    EXPECT_NEAR(x1[0], 8, 1e-4);
+    EXPECT_NEAR(x1[1], 6, 1e-4);
+    EXPECT_NEAR(fval1, 8, 1e-4);
+    options.fmin_mode = rm::FminMode::Simplex;
+    auto [x2, fval2] = rm::fminunc(rosenbrock, {1, -2}, options);
+    EXPECT_NEAR(x2[0], 1, 1e-2);
+    EXPECT_NEAR(x2[1], 1, 1e-2);
+    EXPECT_NEAR(fval2, 0, 1e-2);
+}
+
+// 双极小值函数，全局最小值点为 (2, 0)，局部极小值点为 (-1, 0)
+static inline double bimodal(const std::valarray<double> &x)
+{
+    double g1 = (x[0] + 1) * (x[0] + 1), g2 = (x[0] - 2) * (x[0] - 2);
+    return std::min(g1 + 1, g2) + x[1] * x[1];
+}
+
+TEST(Optimal, fminunc_multi_start)
+{
+    rm::OptimalOptions options;
+    options.fmin_mode = rm::FminMode::Simplex;
+    auto [x, fval] = rm::fminunc(bimodal, {{-2, 1}, {-1, -1}, {1, 1}, {3, -1}}, options);
+    EXPECT_NEAR(x[0], 2, 1e-2);
+    EXPECT_NEAR(x[1], 0, 1e-2);
+    EXPECT_NEAR(fval, 0, 1e-2);
+}
+
 TEST(Optimal, fmincon_degredate_to_fminunc)
 {
     auto [x, fval] = rm::fmincon(quadratic, {0, 0}, {}, {});
@@ -117,6 +169,41 @@ TEST(Optimal, lsqnonlin_linear)
     EXPECT_NEAR(x[1], 1, 1e-3);
 }
 
+TEST(Optimal, lsqnonlin_analytic_jacobian)
+{
+    rm::FuncJac jac_linear = [](const std::valarray<double> &) {
+        return std::vector<std::valarray<double>>{{1., 1.}, {1., -1.}};
+    };
+    rm::OptimalOptions options;
+    options.lsq_mode = rm::LsqMode::GN;
+    auto x = rm::lsqnonlin(lsq_linear, jac_linear, {0, 0}, {}, options);
+    EXPECT_NEAR(x[0], 5, 1e-3);
+    EXPECT_NEAR(x[1], 1, 1e-3);
+    options.lsq_mode = rm::LsqMode::LM;
+    x = rm::lsqnonlin(lsq_linear, jac_linear, {0, 0}, {}, options);
+    EXPECT_NEAR(x[0], 5, 1e-3);
+    EXPECT_NEAR(x[1], 1, 1e-3);
+}
+
+TEST(Optimal, lsqnonlin_sparse_jacobian)
+{
+    // 两个互不耦合的残差，稀疏结构中每行仅有一个非零偏导
+    rm::FuncNds lsq_sep = [](const std::valarray<double> &x) { return std::valarray<double>{x[0] - 2, x[1] - 3}; };
+    rm::FuncJac jac_sep = [](const std::valarray<double> &) {
+        return std::vector<std::valarray<double>>{{1., 0.}, {0., 1.}};
+    };
+    rm::SparsityPattern sparsity{{0}, {1}};
+    rm::OptimalOptions options;
+    options.lsq_mode = rm::LsqMode::GN;
+    auto x = rm::lsqnonlin(lsq_sep, jac_sep, {0, 0}, sparsity, options);
+    EXPECT_NEAR(x[0], 2, 1e-3);
+    EXPECT_NEAR(x[1], 3, 1e-3);
+    options.lsq_mode = rm::LsqMode::SGN;
+    x = rm::lsqnonlin(lsq_sep, jac_sep, {0, 0}, sparsity, options);
+    EXPECT_NEAR(x[0], 2, 1e-3);
+    EXPECT_NEAR(x[1], 3, 1e-3);
+}
+
 // 待拟合曲线: 0.8sin(1.9FPSx) + 2.09 - 0.8
 static inline double real_f(double x)
 {
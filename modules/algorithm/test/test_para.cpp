@@ -0,0 +1,38 @@
+/**
+ * @file test_para.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 参数模块快照机制单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "rmvlpara/algorithm.hpp"
+
+namespace rm_test
+{
+
+// 快照不可变性：发布新参数不影响已获取的旧快照
+TEST(ParaSnapshot, immutable_snapshot)
+{
+    auto old_param = rm::para::algorithm_param;
+    auto old_snap = rm::para::algorithm_snapshot();
+
+    auto data = rm::para::algorithm_param;
+    data.SECANT_STEP = 2e-3;
+    rm::para::algorithm_update(data);
+
+    // 旧快照保持不变，新快照立即可见新参数
+    EXPECT_EQ(old_snap->SECANT_STEP, old_param.SECANT_STEP);
+    EXPECT_EQ(rm::para::algorithm_snapshot()->SECANT_STEP, 2e-3);
+    // 发布同时同步至全局参数变量，兼容直接按字段读取的代码
+    EXPECT_EQ(rm::para::algorithm_param.SECANT_STEP, 2e-3);
+
+    rm::para::algorithm_update(old_param);
+}
+
+} // namespace rm_test
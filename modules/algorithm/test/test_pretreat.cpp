@@ -11,8 +11,13 @@
 
 #ifdef HAVE_OPENCV
 
+#include <algorithm>
+#include <tuple>
+
 #include <gtest/gtest.h>
 
+#include <opencv2/imgproc.hpp>
+
 #include "rmvl/algorithm/pretreat.hpp"
 
 using namespace cv;
@@ -74,6 +79,246 @@ TEST_F(PretreatTest, 3_channel_minus)
     EXPECT_EQ(bin.at<uchar>(0, 0), 0);
 }
 
+//! 通道相减阈值（复用预分配缓冲区）
+TEST_F(PretreatTest, 3_channel_minus_prealloc)
+{
+    Mat ch3 = make_multy_ch3(120, 20, 20);
+    Mat bin(Size(100, 100), CV_8UC1);
+    uchar *buf = bin.data;
+    binary(ch3, bin, BLUE, RED, 80);
+    EXPECT_EQ(bin.at<uchar>(50, 50), 255);
+    EXPECT_EQ(bin.at<uchar>(99, 99), 255);
+    // 尺寸不变时不应重新分配
+    binary(ch3, bin, BLUE, RED, 120);
+    EXPECT_EQ(bin.data, buf);
+    EXPECT_EQ(bin.at<uchar>(50, 50), 0);
+}
+
+//! 串行、并行执行模式结果一致
+TEST_F(PretreatTest, exec_mode)
+{
+    Mat ch3 = make_multy_ch3(120, 60, 20);
+    Mat bin_serial = binary(ch3, BLUE, RED, 80, PretreatExec::Serial);
+    Mat bin_parallel = binary(ch3, BLUE, RED, 80, PretreatExec::Parallel);
+    EXPECT_EQ(countNonZero(bin_serial != bin_parallel), 0);
+    // 全局设置为串行后，Auto 模式应与串行结果一致
+    setPretreatExec(PretreatExec::Serial);
+    Mat bin_auto = binary(ch3, 50);
+    setPretreatExec(PretreatExec::Parallel);
+    EXPECT_EQ(countNonZero(bin_auto != binary(ch3, 50)), 0);
+}
+
+//! 自适应阈值二值化
+TEST_F(PretreatTest, adaptive_threshold)
+{
+    // 暗背景上的亮块：亮度模式下亮块置 255，背景置 0
+    Mat src(Size(160, 120), CV_8UC3, Scalar(20, 20, 20));
+    src(Rect(40, 30, 40, 30)).setTo(Scalar(200, 200, 200));
+    Mat bin = binaryAdaptive(src);
+    EXPECT_EQ(bin.at<uchar>(45, 60), 255);
+    EXPECT_EQ(bin.at<uchar>(100, 120), 0);
+    // 通道相减模式：高 B-R 差值的区域置 255
+    Mat src_minus(Size(160, 120), CV_8UC3, Scalar(20, 20, 20));
+    src_minus(Rect(80, 60, 40, 30)).setTo(Scalar(200, 20, 20));
+    bin = binaryAdaptive(src_minus, BLUE, RED);
+    EXPECT_EQ(bin.at<uchar>(75, 100), 255);
+    EXPECT_EQ(bin.at<uchar>(10, 10), 0);
+    // 串行、并行执行模式结果一致
+    Mat bin_serial = binaryAdaptive(src, 0., Size(8, 6), PretreatExec::Serial);
+    Mat bin_parallel = binaryAdaptive(src, 0., Size(8, 6), PretreatExec::Parallel);
+    EXPECT_EQ(countNonZero(bin_serial != bin_parallel), 0);
+    // 整图无对比度时输出全零图像
+    Mat uniform = make_multy_ch3(120, 120, 120);
+    EXPECT_EQ(countNonZero(binaryAdaptive(uniform)), 0);
+    // 偏置叠加至解算出的阈值上，足够大的正偏置使输出全零
+    EXPECT_EQ(countNonZero(binaryAdaptive(src, 255.)), 0);
+}
+
+//! 帧缓冲区分配器的对齐、着色与回收
+TEST_F(PretreatTest, frame_pool_allocator)
+{
+    constexpr std::size_t huge_page = std::size_t(2) << 20;
+    constexpr std::size_t stride = 4096;
+    // 数据起始地址在大页内按页粒度偏移
+    Mat frame;
+    frame.allocator = framePoolAllocator();
+    frame.create(1080, 1440, CV_8UC3);
+    auto offset = reinterpret_cast<uintptr_t>(frame.data) % huge_page;
+    EXPECT_EQ(offset % stride, 0u);
+    // 相邻分配的着色偏移不同，缓冲区可正常读写
+    Mat frame2;
+    frame2.allocator = framePoolAllocator();
+    frame2.create(1080, 1440, CV_8UC3);
+    EXPECT_NE(reinterpret_cast<uintptr_t>(frame2.data) % huge_page, offset);
+    frame2.setTo(Scalar::all(255));
+    EXPECT_EQ(frame2.at<Vec3b>(1079, 1439), Vec3b(255, 255, 255));
+    // 新分配的二值化输出由帧缓冲区分配器提供，结果不受影响
+    Mat ch3 = make_multy_ch3(120, 20, 20);
+    Mat bin = binary(ch3, BLUE, RED, 80);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(bin.data) % huge_page % stride, 0u);
+    EXPECT_EQ(bin.at<uchar>(50, 50), 255);
+    // 释放与重分配不产生泄漏或越界（由 ASan/Valgrind 等工具配合验证）
+    frame.release();
+    frame.create(300, 400, CV_8UC1);
+    EXPECT_NE(frame.data, nullptr);
+}
+
+//! 两趟扫描连通域统计与 OpenCV 参考实现一致
+TEST_F(PretreatTest, connected_components)
+{
+    // 随机噪声图的连通域个数、面积、包围盒、质心与 cv::connectedComponentsWithStats 一致
+    Mat bin(240, 320, CV_8UC1);
+    randu(bin, Scalar(0), Scalar(2));
+    bin *= 255;
+    ConnectedComponents stats;
+    rm::connectedComponents(bin, stats);
+    Mat labels, cv_stats, cv_centroids;
+    int num = cv::connectedComponentsWithStats(bin, labels, cv_stats, cv_centroids, 8);
+    ASSERT_EQ(static_cast<int>(stats.size()), num - 1);
+    // 双方均以包围盒左上角与面积为键排序后一一比对
+    std::vector<std::size_t> si(stats.size());
+    std::vector<int> ci(num - 1);
+    for (std::size_t i = 0; i < si.size(); ++i)
+        si[i] = i, ci[i] = static_cast<int>(i) + 1;
+    auto skey = [&stats](std::size_t i) { return std::make_tuple(stats.bboxes[i].y, stats.bboxes[i].x, stats.areas[i]); };
+    auto ckey = [&cv_stats](int i) { return std::make_tuple(cv_stats.at<int>(i, CC_STAT_TOP), cv_stats.at<int>(i, CC_STAT_LEFT), cv_stats.at<int>(i, CC_STAT_AREA)); };
+    std::sort(si.begin(), si.end(), [&skey](auto lhs, auto rhs) { return skey(lhs) < skey(rhs); });
+    std::sort(ci.begin(), ci.end(), [&ckey](auto lhs, auto rhs) { return ckey(lhs) < ckey(rhs); });
+    for (std::size_t k = 0; k < si.size(); ++k)
+    {
+        auto i = si[k];
+        int j = ci[k];
+        EXPECT_EQ(stats.areas[i], cv_stats.at<int>(j, CC_STAT_AREA));
+        EXPECT_EQ(stats.bboxes[i].x, cv_stats.at<int>(j, CC_STAT_LEFT));
+        EXPECT_EQ(stats.bboxes[i].y, cv_stats.at<int>(j, CC_STAT_TOP));
+        EXPECT_EQ(stats.bboxes[i].width, cv_stats.at<int>(j, CC_STAT_WIDTH));
+        EXPECT_EQ(stats.bboxes[i].height, cv_stats.at<int>(j, CC_STAT_HEIGHT));
+        EXPECT_NEAR(stats.centroids[i].x, cv_centroids.at<double>(j, 0), 1e-4);
+        EXPECT_NEAR(stats.centroids[i].y, cv_centroids.at<double>(j, 1), 1e-4);
+    }
+}
+
+//! 连通域主轴角度、等效边长与面积过滤
+TEST_F(PretreatTest, connected_components_axis)
+{
+    // 旋转灯条状连通域的主轴角度、等效边长与绘制参数一致
+    Mat bin = Mat::zeros(300, 300, CV_8UC1);
+    RotatedRect rrect(Point2f(150, 150), Size2f(16, 80), 25.f);
+    Point2f pts[4];
+    rrect.points(pts);
+    Point ipts[]{pts[0], pts[1], pts[2], pts[3]};
+    fillConvexPoly(bin, ipts, 4, Scalar(255));
+    bin.at<uchar>(5, 5) = 255; // 面积为 1 的噪点
+    ConnectedComponents stats;
+    rm::connectedComponents(bin, stats, 10);
+    ASSERT_EQ(stats.size(), 1u);
+    // 长边 80 与竖直方向成 25°，即与 x 轴成 65°
+    EXPECT_NEAR(std::abs(stats.angles[0]), 65.f, 2.f);
+    EXPECT_NEAR(stats.sizes[0].width, 80.f, 3.f);
+    EXPECT_NEAR(stats.sizes[0].height, 16.f, 2.f);
+    EXPECT_NEAR(stats.centroids[0].x, 150.f, 1.f);
+    EXPECT_NEAR(stats.centroids[0].y, 150.f, 1.f);
+    // 统计对象逐帧复用，重复调用前被清空
+    rm::connectedComponents(bin, stats, 1);
+    EXPECT_EQ(stats.size(), 2u);
+}
+
+//! 位压缩二值化与字节掩码结果一致
+TEST_F(PretreatTest, packed_binary_consistency)
+{
+    // 宽度取非 64 整数倍，覆盖行尾不足一字的路径
+    Mat src(Size(133, 50), CV_8UC3);
+    randu(src, Scalar::all(0), Scalar::all(255));
+    Mat bin;
+    PackedBinary packed;
+    // 通道相减二值化
+    binary(src, bin, BLUE, RED, 80);
+    binaryPacked(src, packed, BLUE, RED, 80);
+    for (int y = 0; y < bin.rows; ++y)
+        for (int x = 0; x < bin.cols; ++x)
+            EXPECT_EQ(packed.test(x, y), bin.at<uchar>(y, x) != 0) << "x = " << x << ", y = " << y;
+    // 亮度阈值二值化
+    binary(src, bin, 120);
+    binaryPacked(src, packed, 120);
+    for (int y = 0; y < bin.rows; ++y)
+        for (int x = 0; x < bin.cols; ++x)
+            EXPECT_EQ(packed.test(x, y), bin.at<uchar>(y, x) != 0) << "x = " << x << ", y = " << y;
+}
+
+//! 位压缩行程扫描
+TEST_F(PretreatTest, packed_next_run)
+{
+    Mat bin = Mat::zeros(Size(200, 1), CV_8UC1);
+    // 行程跨越 64 位字边界与行尾
+    for (int x = 10; x < 20; ++x)
+        bin.at<uchar>(0, x) = 255;
+    for (int x = 60; x < 140; ++x)
+        bin.at<uchar>(0, x) = 255;
+    for (int x = 195; x < 200; ++x)
+        bin.at<uchar>(0, x) = 255;
+    PackedBinary packed;
+    binaryPacked(bin, packed, 100);
+    int col = 0, cs{}, ce{};
+    EXPECT_TRUE(nextRun(packed.row(0), packed.cols(), col, cs, ce));
+    EXPECT_EQ(cs, 10), EXPECT_EQ(ce, 20);
+    EXPECT_TRUE(nextRun(packed.row(0), packed.cols(), col, cs, ce));
+    EXPECT_EQ(cs, 60), EXPECT_EQ(ce, 140);
+    EXPECT_TRUE(nextRun(packed.row(0), packed.cols(), col, cs, ce));
+    EXPECT_EQ(cs, 195), EXPECT_EQ(ce, 200);
+    EXPECT_FALSE(nextRun(packed.row(0), packed.cols(), col, cs, ce));
+}
+
+//! 位压缩连通域标记与字节掩码版本结果一致
+TEST_F(PretreatTest, packed_connected_components)
+{
+    Mat bin = Mat::zeros(Size(160, 120), CV_8UC1);
+    rectangle(bin, Rect(10, 10, 40, 20), Scalar(255), FILLED);
+    rectangle(bin, Rect(70, 50, 10, 60), Scalar(255), FILLED);
+    circle(bin, Point(120, 30), 15, Scalar(255), FILLED);
+    PackedBinary packed;
+    binaryPacked(bin, packed, 100);
+    ConnectedComponents stats, packed_stats;
+    connectedComponents(bin, stats);
+    connectedComponents(packed, packed_stats);
+    ASSERT_EQ(packed_stats.size(), stats.size());
+    for (std::size_t i = 0; i < stats.size(); ++i)
+    {
+        EXPECT_EQ(packed_stats.areas[i], stats.areas[i]);
+        EXPECT_EQ(packed_stats.bboxes[i], stats.bboxes[i]);
+        EXPECT_NEAR(packed_stats.centroids[i].x, stats.centroids[i].x, 1e-5);
+        EXPECT_NEAR(packed_stats.centroids[i].y, stats.centroids[i].y, 1e-5);
+    }
+}
+
+#ifdef HAVE_CUDA
+
+//! CUDA 后端与 CPU 路径结果一致
+TEST_F(PretreatTest, cuda_backend_consistency)
+{
+    Mat src(Size(320, 300), CV_8UC3);
+    randu(src, Scalar::all(0), Scalar::all(255));
+    CudaPretreat pretreat;
+    EXPECT_NE(pretreat.stream(), nullptr);
+    Mat bin_gpu, bin_cpu;
+    // 通道相减二值化
+    pretreat.binary(src, bin_gpu, BLUE, RED, 80);
+    binary(src, bin_cpu, BLUE, RED, 80);
+    EXPECT_EQ(countNonZero(bin_gpu != bin_cpu), 0);
+    // 亮度阈值二值化（BGR 与 Mono8）
+    pretreat.binary(src, bin_gpu, 120);
+    binary(src, bin_cpu, 120);
+    EXPECT_EQ(countNonZero(bin_gpu != bin_cpu), 0);
+    // 尺寸不变时不应重新分配
+    uchar *buf = bin_gpu.data;
+    pretreat.binary(src, bin_gpu, 120);
+    EXPECT_EQ(bin_gpu.data, buf);
+    Mat gray = make_multy_ch1(120);
+    pretreat.binary(gray, bin_gpu, 100);
+    binary(gray, bin_cpu, 100);
+    EXPECT_EQ(countNonZero(bin_gpu != bin_cpu), 0);
+}
+#endif // HAVE_CUDA
+
 } // namespace rm_test
 
 #endif // HAVE_OPENCV
@@ -96,4 +96,87 @@ TEST(RaHeapTest, CustomData)
     EXPECT_EQ(heap.top(), arr[3]);
 }
 
+TEST(RaHeapTest, EraseMiddle)
+{
+    // 删除中部元素时，末尾补位的元素可能比新父节点更优，需向上调整
+    RaHeap<int> heap;
+    for (int x : {100, 30, 90, 10, 20, 80, 85, 5, 8, 15})
+        heap.push(x);
+    heap.erase(10);
+    heap.erase(30);
+    // 逐个弹出应得到降序序列
+    std::vector<int> sorted;
+    while (!heap.empty())
+    {
+        sorted.push_back(heap.top());
+        heap.pop();
+    }
+    EXPECT_TRUE(std::is_sorted(sorted.rbegin(), sorted.rend()));
+    EXPECT_EQ(sorted.size(), 8u);
+    EXPECT_EQ(sorted.front(), 100);
+    EXPECT_EQ(sorted.back(), 5);
+}
+
+TEST(RaHeap4Test, BasicMethod)
+{
+    // 大根堆
+    RaHeap4<double> heap;
+    heap.push(0, 0.3);
+    heap.push(1, 0.1);
+    heap.push(2, 0.2);
+    EXPECT_EQ(heap.size(), 3u);
+    EXPECT_EQ(heap.top(), 0.3);
+    EXPECT_EQ(heap.topKey(), 0u);
+    // 重复添加已存在的键时忽略
+    heap.push(1, 0.9);
+    EXPECT_EQ(*heap.at(1), 0.1);
+    heap.pop();
+    EXPECT_EQ(heap.topKey(), 2u);
+    heap.pop();
+    EXPECT_EQ(heap.topKey(), 1u);
+    heap.pop();
+    EXPECT_TRUE(heap.empty());
+    EXPECT_FALSE(heap.contains(0));
+    EXPECT_EQ(heap.at(0), nullptr);
+}
+
+TEST(RaHeap4Test, UpdateErase)
+{
+    // 小根堆
+    RaHeap4<int, std::greater<int>> heap;
+    for (int x : {30, 20, 40, 10, 50})
+        heap.push(heap.size(), x);
+    EXPECT_EQ(heap.topKey(), 3u);
+    // 向堆顶方向更新
+    heap.update(4, 1);
+    EXPECT_EQ(heap.topKey(), 4u);
+    // 向堆底方向更新
+    heap.update(4, 100);
+    EXPECT_EQ(heap.topKey(), 3u);
+    heap.erase(3);
+    EXPECT_FALSE(heap.contains(3));
+    EXPECT_EQ(heap.topKey(), 1u);
+    // 键不存在时忽略
+    heap.erase(3);
+    EXPECT_EQ(heap.size(), 4u);
+}
+
+TEST(RaHeap4Test, BatchAssign)
+{
+    // 批量建堆后逐个弹出应得到降序序列
+    std::vector<int> datas(300);
+    for (std::size_t i = 0; i < datas.size(); ++i)
+        datas[i] = static_cast<int>(i * 37 % 1000);
+    RaHeap4<int> heap(datas.begin(), datas.end());
+    EXPECT_EQ(heap.size(), datas.size());
+    std::vector<int> sorted;
+    while (!heap.empty())
+    {
+        EXPECT_EQ(datas[heap.topKey()], heap.top());
+        sorted.push_back(heap.top());
+        heap.pop();
+    }
+    EXPECT_TRUE(std::is_sorted(sorted.rbegin(), sorted.rend()));
+}
+
 } // namespace rm_test
@@ -0,0 +1,77 @@
+/**
+ * @file test_ring_buffer.cpp
+ * @author RoboMaster Vision Community
+ * @brief 定容环形缓冲区单元测试
+ * @version 1.0
+ * @date 2026-08-28
+ *
+ * @copyright Copyright 2026 (c), RoboMaster Vision Community
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "rmvl/algorithm/datastruct.hpp"
+
+namespace rm_test
+{
+
+TEST(RingBufferTest, push_and_access)
+{
+    rm::RingBuffer<int, 4> buf;
+    EXPECT_TRUE(buf.empty());
+    EXPECT_EQ(buf.capacity(), 4u);
+    buf.push_back(1), buf.push_back(2);
+    buf.push_front(0);
+    EXPECT_EQ(buf.size(), 3u);
+    EXPECT_EQ(buf.front(), 0);
+    EXPECT_EQ(buf.back(), 2);
+    for (int i = 0; i < 3; ++i)
+        EXPECT_EQ(buf[i], i);
+    EXPECT_EQ(buf.at(2), 2);
+    EXPECT_THROW(buf.at(3), std::out_of_range);
+}
+
+TEST(RingBufferTest, overwrite_when_full)
+{
+    // 队首推入覆盖队尾，队尾推入覆盖队首
+    rm::RingBuffer<int, 4> buf = {1, 2, 3, 4};
+    EXPECT_TRUE(buf.full());
+    buf.push_front(0);
+    EXPECT_EQ(buf.size(), 4u);
+    EXPECT_EQ(buf.front(), 0);
+    EXPECT_EQ(buf.back(), 3);
+    buf.push_back(4), buf.push_back(5);
+    EXPECT_EQ(buf.front(), 2);
+    EXPECT_EQ(buf.back(), 5);
+}
+
+TEST(RingBufferTest, iterator_order)
+{
+    rm::RingBuffer<int, 4> buf = {1, 2, 3, 4};
+    // 覆盖后迭代器仍按队首到队尾的逻辑顺序遍历
+    buf.push_front(0), buf.push_front(-1);
+    std::vector<int> datas(buf.begin(), buf.end());
+    EXPECT_EQ(datas, (std::vector<int>{-1, 0, 1, 2}));
+}
+
+TEST(RingBufferTest, release_on_evict)
+{
+    // 被覆盖、弹出的槽位需重置，及时释放共享指针资源
+    auto p1 = std::make_shared<int>(1);
+    auto p2 = std::make_shared<int>(2);
+    rm::RingBuffer<std::shared_ptr<int>, 2> buf;
+    buf.push_front(p1), buf.push_front(p2);
+    EXPECT_EQ(p1.use_count(), 2);
+    buf.push_front(std::make_shared<int>(3));
+    EXPECT_EQ(p1.use_count(), 1);
+    buf.pop_front();
+    EXPECT_EQ(buf.size(), 1u);
+    buf.clear();
+    EXPECT_EQ(p2.use_count(), 1);
+}
+
+} // namespace rm_test
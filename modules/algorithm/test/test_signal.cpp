@@ -0,0 +1,83 @@
+/**
+ * @file test_signal.cpp
+ * @author RoboMaster Vision Community
+ * @brief 连续存储信号容器单元测试
+ * @version 1.0
+ * @date 2025-09-02
+ *
+ * @copyright Copyright 2025 (c), RoboMaster Vision Community
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+
+#include "rmvl/algorithm/datastruct.hpp"
+
+namespace rm_test
+{
+
+TEST(SignalTest, push_back_and_access)
+{
+    rm::Signal<double> sig;
+    EXPECT_TRUE(sig.empty());
+    // 超出内置缓冲区容量，触发堆上扩容
+    for (int i = 0; i < 100; ++i)
+        sig.push_back(i);
+    EXPECT_EQ(sig.size(), 100u);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(sig[i], i);
+    EXPECT_EQ(sig.front(), 0);
+    EXPECT_EQ(sig.back(), 99);
+}
+
+TEST(SignalTest, ring_push)
+{
+    rm::Signal<int> sig(16);
+    std::iota(sig.begin(), sig.end(), 0);
+    // 容量已满，环形推入覆盖最早的元素
+    EXPECT_EQ(sig.capacity(), 16u);
+    sig.push(16), sig.push(17);
+    EXPECT_EQ(sig.size(), 16u);
+    EXPECT_EQ(sig.front(), 2);
+    EXPECT_EQ(sig.back(), 17);
+    for (int i = 0; i < 16; ++i)
+        EXPECT_EQ(sig[i], i + 2);
+}
+
+TEST(SignalTest, data_linearize)
+{
+    rm::Signal<int> sig(16);
+    std::iota(sig.begin(), sig.end(), 0);
+    for (int i = 16; i < 24; ++i)
+        sig.push(i);
+    // data() 需按逻辑顺序返回连续存储
+    const int *p = sig.data();
+    for (int i = 0; i < 16; ++i)
+        EXPECT_EQ(p[i], i + 8);
+}
+
+TEST(SignalTest, iterator_and_algorithm)
+{
+    rm::Signal<double> sig = {3., 1., 4., 1., 5., 9., 2., 6.};
+    EXPECT_EQ(*std::max_element(sig.begin(), sig.end()), 9.);
+    std::sort(sig.begin(), sig.end());
+    EXPECT_TRUE(std::is_sorted(sig.begin(), sig.end()));
+    EXPECT_EQ(std::accumulate(sig.begin(), sig.end(), 0.), 31.);
+}
+
+TEST(SignalTest, copy_and_move)
+{
+    rm::Signal<int> sig(40);
+    std::iota(sig.begin(), sig.end(), 0);
+    rm::Signal<int> copied = sig;
+    EXPECT_EQ(copied.size(), 40u);
+    EXPECT_EQ(copied[39], 39);
+    rm::Signal<int> moved = std::move(sig);
+    EXPECT_EQ(moved.size(), 40u);
+    EXPECT_EQ(moved[39], 39);
+}
+
+} // namespace rm_test
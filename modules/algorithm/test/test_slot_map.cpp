@@ -0,0 +1,114 @@
+/**
+ * @file test_slot_map.cpp
+ * @author RoboMaster Vision Community
+ * @brief 槽位映射单元测试
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), RoboMaster Vision Community
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+
+#include "rmvl/algorithm/datastruct.hpp"
+
+namespace rm_test
+{
+
+TEST(SlotMapTest, insert_and_access)
+{
+    rm::SlotMap<int> map;
+    EXPECT_TRUE(map.empty());
+    auto k1 = map.insert(10);
+    auto k2 = map.insert(20);
+    auto k3 = map.insert(30);
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(*map.at(k1), 10);
+    EXPECT_EQ(*map.at(k2), 20);
+    EXPECT_EQ(*map.at(k3), 30);
+    *map.at(k2) = 21;
+    EXPECT_EQ(*map.at(k2), 21);
+}
+
+TEST(SlotMapTest, stable_keys_on_erase)
+{
+    // 逻辑删除不搬移其余元素，其余键保持有效
+    rm::SlotMap<int> map;
+    auto k1 = map.insert(1);
+    auto k2 = map.insert(2);
+    auto k3 = map.insert(3);
+    EXPECT_TRUE(map.erase(k2));
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(*map.at(k1), 1);
+    EXPECT_EQ(*map.at(k3), 3);
+    // 已删除的键失效，重复删除失败
+    EXPECT_EQ(map.at(k2), nullptr);
+    EXPECT_FALSE(map.contains(k2));
+    EXPECT_FALSE(map.erase(k2));
+}
+
+TEST(SlotMapTest, free_list_reuse_and_generation)
+{
+    rm::SlotMap<int> map;
+    auto k1 = map.insert(1);
+    map.insert(2);
+    map.erase(k1);
+    // 空闲槽位被复用，下标相同但代数自增，旧键不会误指向新元素
+    auto k3 = map.insert(3);
+    EXPECT_EQ(k3.index, k1.index);
+    EXPECT_NE(k3.generation, k1.generation);
+    EXPECT_EQ(map.at(k1), nullptr);
+    EXPECT_EQ(*map.at(k3), 3);
+    EXPECT_EQ(map.size(), 2u);
+}
+
+TEST(SlotMapTest, iteration_skips_dead_slots)
+{
+    rm::SlotMap<int> map;
+    std::vector<rm::SlotMap<int>::key_type> keys;
+    for (int i = 0; i < 6; ++i)
+        keys.push_back(map.insert(i));
+    map.erase(keys[1]), map.erase(keys[4]);
+    int sum{};
+    std::size_t count{};
+    for (int x : map)
+        sum += x, ++count;
+    EXPECT_EQ(count, 4u);
+    EXPECT_EQ(sum, 0 + 2 + 3 + 5);
+    const auto &cmap = map;
+    EXPECT_EQ(std::accumulate(cmap.begin(), cmap.end(), 0), sum);
+}
+
+TEST(SlotMapTest, erase_releases_resource)
+{
+    // 逻辑删除时槽位元素被重置，资源及时释放
+    rm::SlotMap<std::shared_ptr<int>> map;
+    auto data = std::make_shared<int>(42);
+    std::weak_ptr<int> observer = data;
+    auto key = map.insert(std::move(data));
+    data.reset();
+    EXPECT_FALSE(observer.expired());
+    map.erase(key);
+    EXPECT_TRUE(observer.expired());
+}
+
+TEST(SlotMapTest, clear_invalidates_all_keys)
+{
+    rm::SlotMap<int> map;
+    auto k1 = map.insert(1);
+    auto k2 = map.insert(2);
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.at(k1), nullptr);
+    EXPECT_EQ(map.at(k2), nullptr);
+    // 清空后的槽位全部可复用
+    auto k3 = map.insert(3);
+    EXPECT_EQ(*map.at(k3), 3);
+    EXPECT_EQ(map.size(), 1u);
+}
+
+} // namespace rm_test
@@ -0,0 +1,81 @@
+/**
+ * @file test_sparse_set.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 稀疏集合单元测试
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+#include "rmvl/algorithm/datastruct.hpp"
+
+namespace rm_test
+{
+
+TEST(SparseSetTest, insert_and_access)
+{
+    rm::SparseSet<int> set;
+    EXPECT_TRUE(set.empty());
+    set.insert(3, 30);
+    set.insert(0, 0);
+    set.insert(7, 70);
+    EXPECT_EQ(set.size(), 3u);
+    EXPECT_TRUE(set.contains(3));
+    EXPECT_FALSE(set.contains(5));
+    EXPECT_EQ(set.at(7), 70);
+    // 重复插入覆盖组件，不产生新槽位
+    set.insert(3, 31);
+    EXPECT_EQ(set.size(), 3u);
+    EXPECT_EQ(set.at(3), 31);
+    set.at(0) = 1;
+    EXPECT_EQ(set.at(0), 1);
+    // 访问不存在的实体抛出异常
+    EXPECT_THROW(set.at(5), std::out_of_range);
+}
+
+TEST(SparseSetTest, erase_keeps_dense)
+{
+    rm::SparseSet<int> set;
+    for (uint32_t ent : {2u, 4u, 6u, 8u})
+        set.insert(ent, static_cast<int>(ent * 10));
+    // 删除后末尾组件补位，数组保持连续，实体映射同步更新
+    EXPECT_TRUE(set.erase(4));
+    EXPECT_EQ(set.size(), 3u);
+    EXPECT_FALSE(set.contains(4));
+    EXPECT_EQ(set.at(8), 80);
+    EXPECT_EQ(set.components().size(), set.entities().size());
+    for (std::size_t i = 0; i < set.size(); ++i)
+        EXPECT_EQ(set.components()[i], static_cast<int>(set.entities()[i] * 10));
+    // 实体不存在时删除失败
+    EXPECT_FALSE(set.erase(4));
+    EXPECT_FALSE(set.erase(100));
+    // 删除后实体可重新插入
+    set.insert(4, 41);
+    EXPECT_EQ(set.at(4), 41);
+    EXPECT_EQ(set.size(), 4u);
+}
+
+TEST(SparseSetTest, dense_iteration)
+{
+    rm::SparseSet<int> set;
+    // 实体编号稀疏分布，组件仍连续存放
+    for (uint32_t i = 0; i < 50; ++i)
+        set.insert(i * 7, static_cast<int>(i));
+    int sum = std::accumulate(set.begin(), set.end(), 0);
+    EXPECT_EQ(sum, 49 * 50 / 2);
+    // 遍历组件数组与按实体逐个访问结果一致
+    const auto &ents = set.entities();
+    for (std::size_t i = 0; i < set.size(); ++i)
+        EXPECT_EQ(set.components()[i], set.at(ents[i]));
+    set.clear();
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.contains(0));
+}
+
+} // namespace rm_test
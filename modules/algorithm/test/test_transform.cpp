@@ -0,0 +1,126 @@
+/**
+ * @file test_transform.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 坐标变换模块单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#ifdef HAVE_OPENCV
+
+#include <gtest/gtest.h>
+
+#include "rmvl/algorithm/transform.hpp"
+
+namespace rm_test
+{
+
+TEST(TransformTest, transform_points)
+{
+    // 绕 Z 轴旋转 90°，再平移 (1, 2, 3)
+    auto R = rm::euler2Mat(static_cast<float>(PI_2), rm::EulerAxis::Z);
+    cv::Vec3f t{1.f, 2.f, 3.f};
+    std::vector<cv::Point3f> points{{1.f, 0.f, 0.f}, {0.f, 1.f, 0.f}, {0.f, 0.f, 1.f}};
+    auto retval = rm::transformPoints(R, t, points);
+    ASSERT_EQ(retval.size(), points.size());
+    // 与逐点 Matx 乘法结果一致
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        cv::Vec3f ref = R * cv::Vec3f(points[i].x, points[i].y, points[i].z) + t;
+        EXPECT_NEAR(retval[i].x, ref(0), 1e-5);
+        EXPECT_NEAR(retval[i].y, ref(1), 1e-5);
+        EXPECT_NEAR(retval[i].z, ref(2), 1e-5);
+    }
+    // 就地变换
+    rm::transformPoints(R, t, points.data(), points.data(), points.size());
+    for (std::size_t i = 0; i < points.size(); ++i)
+        EXPECT_EQ(points[i], retval[i]);
+}
+
+TEST(TransformTest, compose_rt)
+{
+    auto R1 = rm::euler2Mat(0.3f, rm::EulerAxis::Y);
+    auto R2 = rm::euler2Mat(-0.4f, rm::EulerAxis::X);
+    cv::Vec3f t1{1.f, -2.f, 0.5f}, t2{0.f, 3.f, -1.f};
+    cv::Matx33f R;
+    cv::Vec3f t;
+    rm::composeRT(R1, t1, R2, t2, R, t);
+    // 复合后的单次变换与链式变换结果一致
+    cv::Vec3f p{0.7f, -1.2f, 2.4f};
+    cv::Vec3f ref = R2 * (R1 * p + t1) + t2;
+    cv::Vec3f val = R * p + t;
+    for (int i = 0; i < 3; ++i)
+        EXPECT_NEAR(val(i), ref(i), 1e-5);
+}
+
+TEST(TransformTest, quaternion)
+{
+    // 四元数组合与对应旋转矩阵乘积一致
+    auto q = rm::euler2Quat(0.3f, rm::EulerAxis::Y) * rm::euler2Quat(-0.4f, rm::EulerAxis::X);
+    auto R = rm::euler2Mat(0.3f, rm::EulerAxis::Y) * rm::euler2Mat(-0.4f, rm::EulerAxis::X);
+    EXPECT_NEAR(q.norm(), 1.f, 1e-6);
+    auto Rq = q.toMat();
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            EXPECT_NEAR(Rq(i, j), R(i, j), 1e-6);
+    // 向量旋转与矩阵乘法一致，共轭旋转还原原向量
+    cv::Vec3f v{0.7f, -1.2f, 2.4f};
+    cv::Vec3f ref = R * v;
+    cv::Vec3f val = q.rotate(v);
+    for (int i = 0; i < 3; ++i)
+        EXPECT_NEAR(val(i), ref(i), 1e-5);
+    cv::Vec3f back = q.conj().rotate(val);
+    for (int i = 0; i < 3; ++i)
+        EXPECT_NEAR(back(i), v(i), 1e-5);
+    // 从旋转矩阵构造往返一致，并覆盖迹接近 -1 的大角度分支
+    for (float angle : {0.5f, 3.1f, -3.1f})
+    {
+        auto q2 = rm::Quaternion(rm::euler2Mat(angle, rm::EulerAxis::Z));
+        auto ref_q = rm::euler2Quat(angle, rm::EulerAxis::Z);
+        // q 与 -q 表示同一旋转，比较旋转矩阵
+        auto R2 = q2.toMat(), ref_R = ref_q.toMat();
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                EXPECT_NEAR(R2(i, j), ref_R(i, j), 1e-5);
+    }
+}
+
+TEST(TransformTest, quaternion_batch)
+{
+    auto q = rm::euler2Quat(1.1f, rm::EulerAxis::Y);
+    // 批量组合与逐个四元数乘法一致
+    std::vector<rm::Quaternion> quats;
+    for (float angle : {0.f, 0.4f, -0.9f, 2.6f})
+        quats.push_back(rm::euler2Quat(angle, rm::EulerAxis::X));
+    auto composed = rm::composeQuats(q, quats);
+    ASSERT_EQ(composed.size(), quats.size());
+    for (std::size_t i = 0; i < quats.size(); ++i)
+    {
+        auto ref = q * quats[i];
+        EXPECT_NEAR(composed[i].w, ref.w, 1e-6);
+        EXPECT_NEAR(composed[i].x, ref.x, 1e-6);
+        EXPECT_NEAR(composed[i].y, ref.y, 1e-6);
+        EXPECT_NEAR(composed[i].z, ref.z, 1e-6);
+    }
+    // 批量旋转与逐点旋转一致，且支持就地旋转
+    std::vector<cv::Point3f> points{{1.f, 0.f, 0.f}, {0.f, 1.f, 0.f}, {0.5f, -2.f, 1.5f}};
+    auto rotated = rm::rotatePoints(q, points);
+    ASSERT_EQ(rotated.size(), points.size());
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        cv::Vec3f ref = q.rotate({points[i].x, points[i].y, points[i].z});
+        EXPECT_NEAR(rotated[i].x, ref(0), 1e-5);
+        EXPECT_NEAR(rotated[i].y, ref(1), 1e-5);
+        EXPECT_NEAR(rotated[i].z, ref(2), 1e-5);
+    }
+    rm::rotatePoints(q, points.data(), points.data(), points.size());
+    for (std::size_t i = 0; i < points.size(); ++i)
+        EXPECT_EQ(points[i], rotated[i]);
+}
+
+} // namespace rm_test
+
+#endif // HAVE_OPENCV
@@ -82,4 +82,35 @@ TEST(UnionFindTest, shared_pointer_extract)
     EXPECT_EQ(find(vec.begin(), vec.end(), arr[3]), vec.end());
 }
 
+TEST(DenseUnionFindTest, merge_connected_components)
+{
+    DenseUnionFind uf(9);
+    EXPECT_TRUE(uf.merge(0, 4));
+    EXPECT_TRUE(uf.merge(4, 5));
+    EXPECT_TRUE(uf.merge(1, 2));
+    // 重复合并不改变连通分量
+    EXPECT_FALSE(uf.merge(0, 5));
+    // {{0, 4, 5}, {1, 2}, {3}, {6}, {7}, {8}}
+    EXPECT_TRUE(uf.connected(2, 1));
+    EXPECT_TRUE(uf.connected(0, 5));
+    EXPECT_FALSE(uf.connected(1, 5));
+    EXPECT_FALSE(uf.connected(3, 6));
+    EXPECT_EQ(uf.components(), 6);
+}
+
+TEST(DenseUnionFindTest, extract)
+{
+    DenseUnionFind uf(6);
+    uf.merge(0, 1);
+    uf.merge(1, 2);
+    uf.merge(3, 4);
+    // 标号按各集合首个元素的索引顺序编号
+    EXPECT_EQ(uf.labels(), (std::vector<std::size_t>{0, 0, 0, 1, 1, 2}));
+    auto datas = uf.extract();
+    ASSERT_EQ(datas.size(), 3u);
+    EXPECT_EQ(datas[0], (std::vector<std::size_t>{0, 1, 2}));
+    EXPECT_EQ(datas[1], (std::vector<std::size_t>{3, 4}));
+    EXPECT_EQ(datas[2], (std::vector<std::size_t>{5}));
+}
+
 } // namespace rm_test
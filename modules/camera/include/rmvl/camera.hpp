@@ -17,6 +17,8 @@
 
 #ifdef HAVE_RMVL_CAMERA
 #include "camera/camutils.hpp"
+#include "camera/frame_source.hpp"
+#include "camera/recorder.hpp"
 
 #ifdef HAVE_RMVL_MV_CAMERA
 #include "camera/mv_camera.h"
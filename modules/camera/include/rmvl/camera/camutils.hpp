@@ -11,9 +11,20 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include <opencv2/core.hpp>
 
 #include "rmvl/core/rmvldef.hpp"
+#include "rmvl/core/statspage.hpp"
 
 namespace rm
 {
@@ -55,13 +66,63 @@ enum class RetrieveMode : uint8_t
     SDK,    //!< 使用官方 SDK 进行处理
 };
 
+//! Bayer 色彩滤波阵列排布，以图像首行前两个像素的颜色命名
+enum class BayerPattern : uint8_t
+{
+    BG, //!< 首行为 `B G B G ...`
+    GB, //!< 首行为 `G B G B ...`
+    RG, //!< 首行为 `R G R G ...`
+    GR  //!< 首行为 `G R G R ...`
+};
+
+//! Bayer 去马赛克插值方式
+enum class DemosaicMethod : uint8_t
+{
+    Bilinear, //!< 双线性插值，速度最快
+    Malvar    //!< Malvar-He-Cutler 梯度校正插值，质量更高
+};
+
+/**
+ * @brief 图像帧捕获元数据
+ * @brief
+ * - 由取帧时 SDK 已返回的帧信息块填充，不产生任何额外的 SDK 调用，经由各相机类的
+ *   `read(image, meta)` 重载与图像帧一同交付
+ * @brief
+ * - `frame_id` 来自 SDK 的帧号或 GigE 块号，相邻两帧跳号即为传输丢帧；曝光中点时刻可由
+ *   帧时间戳与 `exposure` 推算，如海康设备时间戳经 `toHostTick` 换算后减去半个曝光时间
+ * @note 各字段的可用性取决于相机 SDK 的帧信息块，SDK 未提供的字段保持为 `0`
+ */
+struct RMVL_EXPORTS_W_AG FrameMeta
+{
+    RMVL_W_RW uint64_t frame_id{}; //!< SDK 帧号或 GigE 块号，跳号表示传输丢帧
+    RMVL_W_RW double device_ts{};  //!< 设备时钟域的帧时间戳，含义与单位由相机 SDK 决定
+    RMVL_W_RW double exposure{};   //!< 本帧实际曝光时间（单位：μs）
+    RMVL_W_RW double gain{};       //!< 本帧实际模拟增益
+};
+
+/**
+ * @brief Bayer 图像去马赛克
+ * @brief
+ * - 内部使用 OpenCV 通用向量指令实现，在 x86 与 ARM 平台上分别编译为 SSE/AVX2 与 NEON 指令
+ * @brief
+ * - 输出为 `rm::binary` 可直接消费的 BGR 交错存储格式，`dst` 尺寸一致时不重新分配，
+ *   与预分配缓冲区配合可省去一次全图拷贝
+ *
+ * @param[in] src Bayer 格式单通道图像，类型为 `CV_8UC1`
+ * @param[out] dst BGR 格式图像，类型为 `CV_8UC3`
+ * @param[in] pattern Bayer 排布
+ * @param[in] method 插值方式
+ */
+RMVL_EXPORTS_W void demosaic(cv::Mat src, cv::Mat &dst, BayerPattern pattern, DemosaicMethod method = DemosaicMethod::Bilinear);
+
 //! 相机初始化配置模式
 struct RMVL_EXPORTS_W_AG CameraConfig
 {
-    RMVL_W_RW TriggerChannel trigger_channel{TriggerChannel::Chn1}; //!< 触发通道
-    RMVL_W_RW GrabMode grab_mode{GrabMode::Continuous};             //!< 采集模式
-    RMVL_W_RW HandleMode handle_mode{HandleMode::Key};              //!< 句柄创建方式
-    RMVL_W_RW RetrieveMode retrieve_mode{RetrieveMode::OpenCV};     //!< 数据处理模式
+    RMVL_W_RW TriggerChannel trigger_channel{TriggerChannel::Chn1};        //!< 触发通道
+    RMVL_W_RW GrabMode grab_mode{GrabMode::Continuous};                    //!< 采集模式
+    RMVL_W_RW HandleMode handle_mode{HandleMode::Key};                     //!< 句柄创建方式
+    RMVL_W_RW RetrieveMode retrieve_mode{RetrieveMode::OpenCV};            //!< 数据处理模式
+    RMVL_W_RW DemosaicMethod demosaic_method{DemosaicMethod::Bilinear};    //!< Bayer 去马赛克插值方式
 
     /**
      * @brief 创建相机初始化配置模式
@@ -89,6 +150,7 @@ private:
     inline void conf(GrabMode mode) { grab_mode = mode; }
     inline void conf(HandleMode mode) { handle_mode = mode; }
     inline void conf(RetrieveMode mode) { retrieve_mode = mode; }
+    inline void conf(DemosaicMethod method) { demosaic_method = method; }
 };
 
 //! 相机运行时属性
@@ -111,6 +173,10 @@ enum CameraProperties : uint16_t
     CAMERA_SHARPNESS = 0x28,      //!< 锐度
     CAMERA_FRAME_HEIGHT = 0x30,   //!< 图像帧高度
     CAMERA_FRAME_WIDTH = 0x31,    //!< 图像帧宽度
+    CAMERA_ROI_X = 0x32,          //!< ROI 采集窗口左上角 x 坐标
+    CAMERA_ROI_Y = 0x33,          //!< ROI 采集窗口左上角 y 坐标
+    CAMERA_ROI_WIDTH = 0x34,      //!< ROI 采集窗口宽度
+    CAMERA_ROI_HEIGHT = 0x35,     //!< ROI 采集窗口高度
 
     // ---------------- 触发属性 ----------------
     CAMERA_TRIGGER_DELAY = 0x40,  //!< 硬触发采集延迟（微秒\f$μs\f$）
@@ -118,6 +184,452 @@ enum CameraProperties : uint16_t
     CAMERA_TRIGGER_PERIOD = 0x42, //!< 单次触发时多次采集的周期（微秒\f$μs\f$）
     CAMERA_TRIGGER_SOFT = 0x43,   //!< 执行软触发
     CAMERA_ONCE_WB = 0x44,        //!< 执行单次白平衡
+
+    // -------------- GigE 传输属性 --------------
+    CAMERA_GV_PACKET_SIZE = 0x50,      //!< GigE 流通道包长（字节），与链路 MTU 协商一致后可启用巨帧
+    CAMERA_GV_PACKET_DELAY = 0x51,     //!< GigE 包发送间隔，多相机共享链路时用于错开包突发
+    CAMERA_GV_THROUGHPUT_LIMIT = 0x52, //!< GigE 链路带宽上限（字节/秒），非正数表示关闭限制，用于按相机预留带宽
+    CAMERA_GV_RESEND_ENABLE = 0x53,    //!< GigE 丢包重传使能，`0` 表示关闭，非 `0` 表示开启
+    CAMERA_GV_RESEND_TIMEOUT = 0x54,   //!< GigE 重传等待超时（毫秒）
+    CAMERA_GV_RESEND_WINDOW = 0x55,    //!< GigE 重传等待的最大包数窗口
+
+    // ----------- GigE 传输统计（只读） -----------
+    CAMERA_GV_DELIVERED_FRAME_COUNT = 0x60,  //!< 成功交付的帧数
+    CAMERA_GV_LOST_FRAME_COUNT = 0x61,       //!< 丢失的帧数
+    CAMERA_GV_INCOMPLETE_FRAME_COUNT = 0x62, //!< 残帧数
+    CAMERA_GV_RESEND_PACKET_COUNT = 0x63,    //!< 已重传的包数
+};
+
+/**
+ * @brief 相机参数配置集
+ * @brief
+ * - 逐条 `set(propId, value)` 在 SDK 中按属性往返，打开相机后完整下发一组参数耗时可达
+ *   数百毫秒，且部分属性会各自触发一次取流重启，该耗时主导了 USB 掉电重连后的恢复时间
+ * @brief
+ * - 配置集在本地暂存并校验全部属性，通过相机的 `apply()` 在停止取流的单次事务中批量
+ *   写入；配置集会被相机保存，`reconnect()` 后开始取流前自动重新应用，无需调用方重新
+ *   逐条下发
+ * @note 同一属性重复暂存时后值覆盖前值，属性按暂存顺序写入
+ */
+class RMVL_EXPORTS_W CameraProfile
+{
+public:
+    RMVL_W CameraProfile() = default;
+
+    /**
+     * @brief 暂存相机参数
+     *
+     * @param[in] propId 参数编号，事件类与只读统计类属性无法暂存
+     * @param[in] value 参数值
+     * @return 是否暂存成功
+     */
+    RMVL_W bool set(int propId, double value = 0.0);
+
+    //! 清空配置集
+    RMVL_W inline void clear() { _entries.clear(); }
+
+    //! 已暂存的参数个数
+    RMVL_W inline std::size_t size() const { return _entries.size(); }
+
+    //! 访问已暂存的参数列表（按暂存顺序）
+    inline const std::vector<std::pair<int, double>> &data() const { return _entries; }
+
+private:
+    std::vector<std::pair<int, double>> _entries; //!< 已暂存的参数列表
+};
+
+/**
+ * @brief 相机时钟到主机时钟的映射服务
+ * @brief
+ * - 相机 SDK 给出的帧时间戳位于相机时钟域，与主机 rm::Timer 时钟存在偏移与频率偏差（漂移），
+ *   固定偏移的对齐方式会以约每分钟毫秒级的速度漂移
+ * @brief
+ * - 本服务在每次抓取事件到来时送入一对 `(相机时间戳, 主机时间戳)`，以带遗忘因子的
+ *   滤波线性回归持续估计偏移与频偏，并剔除因排队延迟抖动产生的离群样本，
+ *   收敛后 `toHostTick()` 可将任意相机时间戳换算为主机时间，无需逐帧重新同步
+ * @note 相机时间戳的单位无需已知，频偏估计会一并吸收单位换算系数
+ */
+class RMVL_EXPORTS_W ClockMapper
+{
+public:
+    RMVL_W ClockMapper() = default;
+
+    /**
+     * @brief 送入一次抓取事件，更新偏移与频偏估计
+     *
+     * @param[in] device_ts 相机时钟域的帧时间戳，单位任意，但需随时间线性增长
+     * @param[in] host_tick 该帧对应的主机时间戳（单位：s），一般取 `Timer::now()`
+     */
+    RMVL_W void update(double device_ts, double host_tick);
+
+    /**
+     * @brief 将相机时钟域的时间戳换算为主机时间
+     *
+     * @param[in] device_ts 相机时钟域的时间戳
+     * @return 主机时间（单位：s），估计未收敛时返回最近一次抓取事件的主机时间戳
+     */
+    RMVL_W double toHostTick(double device_ts) const;
+
+    //! 偏移与频偏估计是否已收敛
+    RMVL_W bool valid() const { return _valid; }
+    //! 频偏估计值，即主机时间相对相机时间戳单位的换算系数
+    RMVL_W double skew() const { return _skew; }
+    //! 重置映射服务，相机重连导致时钟域不连续后调用
+    RMVL_W void reset() { *this = {}; }
+
+private:
+    static constexpr uint32_t MIN_SAMPLES = 8; //!< 收敛所需的最小样本数
+
+    double _base{};       //!< 首个相机时间戳，用于数值调理
+    double _s1{};         //!< 回归累加量：权重和
+    double _sx{};         //!< 回归累加量：\f$\sum x\f$
+    double _sy{};         //!< 回归累加量：\f$\sum y\f$
+    double _sxx{};        //!< 回归累加量：\f$\sum x^2\f$
+    double _sxy{};        //!< 回归累加量：\f$\sum xy\f$
+    double _offset{};     //!< 偏移估计值（单位：s）
+    double _skew{};       //!< 频偏估计值
+    double _residual{};   //!< 残差绝对值的滑动均值（单位：s），用于离群样本剔除
+    double _last_host{};  //!< 最近一次抓取事件的主机时间戳
+    uint32_t _samples{};  //!< 已接受的样本数
+    bool _init{};         //!< 是否已送入首个样本
+    bool _valid{};        //!< 估计是否已收敛
+};
+
+/**
+ * @brief 相机异步采集预取队列
+ * @brief
+ * - 后台采集线程持续从相机读取图像帧，连同到达时间戳一并存入有界队列，
+ *   使图像采集与图像处理重叠进行，处理线程通过 `tryRead()` 或 `waitRead()` 取帧
+ * @brief
+ * - 队列满时丢弃最早的帧，保证处理线程总能取到最新数据
+ */
+class AsyncCapture
+{
+public:
+    AsyncCapture() = default;
+    ~AsyncCapture() { stop(); }
+
+    //! @cond
+    AsyncCapture(const AsyncCapture &) = delete;
+    void operator=(const AsyncCapture &) = delete;
+    //! @endcond
+
+    /**
+     * @brief 启动异步采集
+     *
+     * @param[in] grab 阻塞式单帧读取函数
+     * @param[in] queue_size 预取队列容量
+     */
+    void start(std::function<bool(cv::Mat &)> grab, std::size_t queue_size = 4)
+    {
+        stop();
+        _grab = std::move(grab);
+        _queue_size = queue_size == 0 ? 1 : queue_size;
+        _stop = false;
+        _thread = std::thread(&AsyncCapture::grabLoop, this);
+    }
+
+    //! 停止异步采集，清空预取队列
+    void stop()
+    {
+        if (!_thread.joinable())
+            return;
+        _stop = true;
+        _thread.join();
+        std::lock_guard lk(_mutex);
+        _queue.clear();
+    }
+
+    //! 异步采集是否正在运行
+    inline bool isRunning() const { return _thread.joinable(); }
+
+    /**
+     * @brief 从预取队列中取出最早的图像帧，队列为空时立即返回
+     *
+     * @param[out] image 图像帧
+     * @param[out] timestamp 帧到达时间戳（单位：s，可为空）
+     * @return 是否成功取帧
+     */
+    bool tryRead(cv::OutputArray image, double *timestamp = nullptr)
+    {
+        std::lock_guard lk(_mutex);
+        return popFrame(image, timestamp);
+    }
+
+    /**
+     * @brief 从预取队列中取出最早的图像帧，队列为空时最多等待 `timeout` 秒
+     *
+     * @param[out] image 图像帧
+     * @param[in] timeout 等待超时时间（单位：s）
+     * @param[out] timestamp 帧到达时间戳（单位：s，可为空）
+     * @return 是否成功取帧
+     */
+    bool waitRead(cv::OutputArray image, double timeout, double *timestamp = nullptr)
+    {
+        std::unique_lock lk(_mutex);
+        _not_empty.wait_for(lk, std::chrono::duration<double>(timeout), [this] { return !_queue.empty(); });
+        return popFrame(image, timestamp);
+    }
+
+private:
+    //! 后台采集线程循环
+    void grabLoop()
+    {
+        while (!_stop)
+        {
+            cv::Mat frame;
+            if (!_grab(frame))
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                continue;
+            }
+            double t = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            std::size_t depth{};
+            {
+                std::lock_guard lk(_mutex);
+                // 队列已满，丢弃最早的帧
+                if (_queue.size() >= _queue_size)
+                    _queue.pop_front();
+                _queue.emplace_back(std::move(frame), t);
+                depth = _queue.size();
+            }
+            _not_empty.notify_one();
+            // 采集指标写入共享内存统计页，供外部监控进程零开销读取
+            stats::pageAdd(stats::PageField::CAPTURE_FRAMES, 1);
+            stats::pageSet(stats::PageField::QUEUE_DEPTH, depth);
+            if (_last_grab > 0. && t > _last_grab)
+            {
+                double fps = 1. / (t - _last_grab);
+                _fps = _fps == 0. ? fps : 0.9 * _fps + 0.1 * fps;
+                stats::pageSet(stats::PageField::CAPTURE_FPS, static_cast<uint64_t>(_fps * 1e3));
+            }
+            _last_grab = t;
+        }
+    }
+
+    //! 取出队首图像帧，需持有锁
+    bool popFrame(cv::OutputArray image, double *timestamp)
+    {
+        if (_queue.empty())
+            return false;
+        image.assign(_queue.front().first);
+        if (timestamp != nullptr)
+            *timestamp = _queue.front().second;
+        _queue.pop_front();
+        return true;
+    }
+
+    std::function<bool(cv::Mat &)> _grab;         //!< 单帧读取函数
+    std::size_t _queue_size{4};                   //!< 预取队列容量
+    double _last_grab{};                          //!< 最近一帧的到达时间戳，用于帧率估计
+    double _fps{};                                //!< 采集帧率滑动均值
+    std::deque<std::pair<cv::Mat, double>> _queue; //!< 预取队列（图像帧与到达时间戳）
+    std::mutex _mutex;                            //!< 预取队列互斥锁
+    std::condition_variable _not_empty;           //!< 预取队列非空条件变量
+    std::atomic<bool> _stop{};                    //!< 采集线程停止标志
+    std::thread _thread;                          //!< 后台采集线程
+};
+
+/**
+ * @brief 多相机同步采集组
+ * @brief
+ * - 每台相机由独立的后台线程异步采集，组内按帧到达时间戳对齐后整组交付，
+ *   相机间偏差超出容限时丢弃最早的帧并等待下一帧
+ * @brief
+ * - 硬触发同步：各相机配置为 `GrabMode::Hardware` 并接入同一触发信号后加入采集组即可；
+ *   软触发同步：各相机配置为 `GrabMode::Software`，通过 `softTrigger()` 统一触发
+ *
+ * @tparam CameraT 相机类型，需提供 `startCapture`、`stopCapture`、`tryRead` 与 `set` 成员函数
+ */
+template <typename CameraT>
+class CameraGroup
+{
+public:
+    /**
+     * @brief 创建多相机同步采集组，并启动各相机的异步采集
+     *
+     * @param[in] cameras 相机列表
+     * @param[in] queue_size 每台相机的预取队列容量
+     */
+    explicit CameraGroup(std::vector<std::unique_ptr<CameraT>> cameras, std::size_t queue_size = 4)
+        : _cameras(std::move(cameras)), _staged(_cameras.size())
+    {
+        for (auto &camera : _cameras)
+            camera->startCapture(queue_size);
+    }
+
+    ~CameraGroup()
+    {
+        for (auto &camera : _cameras)
+            camera->stopCapture();
+    }
+
+    //! @cond
+    CameraGroup(const CameraGroup &) = delete;
+    void operator=(const CameraGroup &) = delete;
+    //! @endcond
+
+    //! 相机数量
+    inline std::size_t size() const { return _cameras.size(); }
+    //! 访问指定相机
+    inline CameraT &at(std::size_t idx) { return *_cameras.at(idx); }
+
+    //! 对所有相机执行一次软触发
+    void softTrigger()
+    {
+        for (auto &camera : _cameras)
+            camera->set(CAMERA_TRIGGER_SOFT);
+    }
+
+    /**
+     * @brief 获取一组时间戳对齐的图像帧，每台相机各一帧
+     *
+     * @param[out] images 图像帧列表，顺序与构造时的相机列表一致
+     * @param[in] timeout 等待超时时间（单位：s）
+     * @param[in] max_skew 相机间允许的最大时间戳偏差（单位：s）
+     * @param[out] timestamps 各图像帧的到达时间戳（单位：s，可为空）
+     * @return 是否成功取得整组图像帧
+     */
+    bool waitRead(std::vector<cv::Mat> &images, double timeout, double max_skew = 5e-3, std::vector<double> *timestamps = nullptr)
+    {
+        using steady_clock = std::chrono::steady_clock;
+        auto deadline = steady_clock::now() + std::chrono::duration_cast<steady_clock::duration>(std::chrono::duration<double>(timeout));
+        for (;;)
+        {
+            // 为尚未暂存帧的相机取帧
+            bool all = true;
+            for (std::size_t i = 0; i < _cameras.size(); ++i)
+            {
+                if (!_staged[i].valid)
+                    _staged[i].valid = _cameras[i]->tryRead(_staged[i].img, &_staged[i].ts);
+                all = all && _staged[i].valid;
+            }
+            if (all)
+            {
+                // 检查相机间时间戳偏差
+                std::size_t oldest{};
+                double t_min = _staged[0].ts, t_max = _staged[0].ts;
+                for (std::size_t i = 1; i < _staged.size(); ++i)
+                {
+                    if (_staged[i].ts < t_min)
+                        t_min = _staged[i].ts, oldest = i;
+                    if (_staged[i].ts > t_max)
+                        t_max = _staged[i].ts;
+                }
+                if (t_max - t_min <= max_skew)
+                {
+                    images.resize(_staged.size());
+                    if (timestamps != nullptr)
+                        timestamps->resize(_staged.size());
+                    for (std::size_t i = 0; i < _staged.size(); ++i)
+                    {
+                        images[i] = _staged[i].img;
+                        if (timestamps != nullptr)
+                            (*timestamps)[i] = _staged[i].ts;
+                        _staged[i] = {};
+                    }
+                    return true;
+                }
+                // 偏差超出容限，丢弃最早的帧并等待对应相机的下一帧
+                _staged[oldest] = {};
+            }
+            if (steady_clock::now() >= deadline)
+                return false;
+            if (!all)
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    }
+
+private:
+    //! 单台相机暂存的图像帧
+    struct StagedFrame
+    {
+        cv::Mat img; //!< 图像帧
+        double ts{}; //!< 到达时间戳
+        bool valid{}; //!< 是否有效
+    };
+
+    std::vector<std::unique_ptr<CameraT>> _cameras; //!< 相机列表
+    std::vector<StagedFrame> _staged;               //!< 各相机暂存的图像帧
+};
+
+//! 双曝光交替采集的单槽位设置
+struct RMVL_EXPORTS_W_AG BracketSetting
+{
+    RMVL_W_RW double exposure{}; //!< 曝光值（微秒 \f$μs\f$）
+    RMVL_W_RW double gain{-1};   //!< 模拟增益，负数表示不修改增益
+};
+
+/**
+ * @brief 双曝光交替采集器
+ * @brief
+ * - 神符灯带与装甲板灯条的最佳曝光相差近一个数量级，单一曝光只能折中。本采集器在
+ *   一台相机上逐帧交替两组预设的曝光参数并为图像帧打上槽位标签，神符与装甲板识别
+ *   各自以半帧率消费对应槽位的图像流，无需增设第二台相机
+ * @brief
+ * - 每帧的时序为：下发该槽位的 `CAMERA_EXPOSURE`（及增益）、执行软触发、读取图像。
+ *   软触发模式下 `set` 先于触发完成，可保证参数恰好作用于本帧；连续采集模式下相机
+ *   内部流水线会使参数延迟 1~2 帧生效，槽位标签与实际曝光错位，因此相机应配置为
+ *   `GrabMode::Software`（接入外部触发信号时为 `GrabMode::Hardware`，并关闭软触发下发）
+ *
+ * @tparam CameraT 相机类型，需提供 `set` 与 `read` 成员函数
+ */
+template <typename CameraT>
+class ExposureBracket
+{
+public:
+    /**
+     * @brief 创建双曝光交替采集器，并将相机切换至手动曝光
+     *
+     * @param[in] camera 相机对象，生命周期需覆盖本采集器
+     * @param[in] s0 槽位 `0` 的曝光设置，一般为神符识别使用的低曝光
+     * @param[in] s1 槽位 `1` 的曝光设置，一般为装甲板识别使用的高曝光
+     * @param[in] soft_trigger 读取前是否下发软触发，相机为 `GrabMode::Hardware` 时置 `false`
+     */
+    ExposureBracket(CameraT &camera, const BracketSetting &s0, const BracketSetting &s1, bool soft_trigger = true)
+        : _camera(camera), _settings({s0, s1}), _soft_trigger(soft_trigger)
+    {
+        _camera.set(CAMERA_MANUAL_EXPOSURE);
+    }
+
+    //! @cond
+    ExposureBracket(const ExposureBracket &) = delete;
+    void operator=(const ExposureBracket &) = delete;
+    //! @endcond
+
+    /**
+     * @brief 下发下一槽位的曝光参数并读取一帧图像
+     *
+     * @param[out] image 图像帧
+     * @param[out] slot 图像帧对应的槽位标签（`0` 或 `1`）
+     * @return 是否读取成功，失败时不切换槽位，下次读取重试同一槽位
+     */
+    bool read(cv::OutputArray image, std::size_t &slot)
+    {
+        const auto &setting = _settings[_next];
+        _camera.set(CAMERA_EXPOSURE, setting.exposure);
+        if (setting.gain >= 0)
+            _camera.set(CAMERA_GAIN, setting.gain);
+        if (_soft_trigger)
+            _camera.set(CAMERA_TRIGGER_SOFT);
+        if (!_camera.read(image))
+            return false;
+        slot = _next;
+        _next ^= 1;
+        return true;
+    }
+
+    //! 下一帧将使用的槽位
+    inline std::size_t next() const { return _next; }
+
+    //! 访问指定槽位的曝光设置，修改后自下一次使用该槽位的帧起生效
+    inline BracketSetting &at(std::size_t idx) { return _settings.at(idx); }
+
+private:
+    CameraT &_camera;                        //!< 相机对象
+    std::array<BracketSetting, 2> _settings; //!< 两组曝光设置
+    bool _soft_trigger{};                    //!< 读取前是否下发软触发
+    std::size_t _next{};                     //!< 下一帧使用的槽位
 };
 
 //! 相机外参
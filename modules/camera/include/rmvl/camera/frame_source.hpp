@@ -0,0 +1,258 @@
+/**
+ * @file frame_source.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 统一实时与回放输入的帧源抽象
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <cstring>
+#include <memory>
+
+#ifdef __cpp_impl_coroutine
+#include <coroutine>
+#endif
+
+#include <opencv2/core.hpp>
+
+#include "rmvl/core/io.hpp"
+#include "rmvl/core/timer.hpp"
+
+namespace rm
+{
+
+//! @addtogroup camera
+//! @{
+
+//! 帧源输出的单帧
+struct SourceFrame
+{
+    cv::Mat image; //!< 图像帧，帧源结束后为空
+    double tick{}; //!< 帧时间戳（单位：s），实时源为到达时间，回放源为记录时间
+
+    //! 帧是否有效，帧源结束后取出的帧无效
+    explicit operator bool() const { return !image.empty(); }
+};
+
+/**
+ * @brief 帧源抽象
+ * @brief
+ * - 统一实时相机与文件回放两条输入路径：流水线代码仅面向 `tryRead` 或 `co_await next()`
+ *   编写，实时与回放模式下完全一致，时序差异（帧到达节奏、结束条件）由具体帧源内部处理
+ * @brief
+ * - C++20 协程可用时，`next()` 返回可等待对象：帧已就绪则不挂起，否则挂起当前协程并由
+ *   `poll()` 在帧到达后恢复，等待期间调度方可以执行其他工作，参考 rm::Client 的异步
+ *   方法调用
+ */
+class FrameSource
+{
+public:
+    FrameSource() = default;
+    virtual ~FrameSource() = default;
+
+    //! @cond
+    FrameSource(const FrameSource &) = delete;
+    void operator=(const FrameSource &) = delete;
+    //! @endcond
+
+    /**
+     * @brief 非阻塞取出下一帧
+     *
+     * @param[out] frame 取出的帧
+     * @return 是否成功取帧，暂无新帧或帧源已结束时返回 `false`
+     */
+    virtual bool tryRead(SourceFrame &frame) = 0;
+
+    //! 帧源是否已结束，回放完毕后为 `true`，实时源恒为 `false`
+    virtual bool eof() const = 0;
+
+#ifdef __cpp_impl_coroutine
+    /**
+     * @brief 下一帧的可等待对象（C++20 协程）
+     * @brief
+     * - 由 @ref next 创建，帧已就绪或帧源已结束时 `co_await` 不挂起，
+     *   否则挂起当前协程，帧到达后由 `poll()` 恢复并返回该帧
+     */
+    class NextAwaiter final
+    {
+    public:
+        //! @cond
+        NextAwaiter(const NextAwaiter &) = delete;
+        NextAwaiter(NextAwaiter &&) = delete;
+
+        NextAwaiter &operator=(const NextAwaiter &) = delete;
+        NextAwaiter &operator=(NextAwaiter &&) = delete;
+
+        ~NextAwaiter()
+        {
+            if (_src->_waiter == this)
+                _src->_waiter = nullptr;
+        }
+        //! @endcond
+
+        //! 帧已就绪或帧源已结束时无需挂起
+        bool await_ready() { return _src->tryRead(_frame) || _src->eof(); }
+
+        /**
+         * @brief 挂起当前协程，等待 `poll()` 在帧到达后恢复
+         *
+         * @param[in] handle 当前协程句柄
+         */
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            _handle = handle;
+            _src->_waiter = this;
+        }
+
+        //! 获取帧，帧源已结束时为无效帧
+        SourceFrame await_resume() noexcept { return std::move(_frame); }
+
+    private:
+        friend class FrameSource;
+
+        explicit NextAwaiter(FrameSource *src) : _src(src) {}
+
+        FrameSource *_src{};             //!< 所属帧源
+        SourceFrame _frame;              //!< 取出的帧
+        std::coroutine_handle<> _handle; //!< 挂起的协程句柄
+    };
+
+    /**
+     * @brief 获取下一帧（C++20 协程）
+     * @code{.cpp}
+     * while (auto frame = co_await source.next())
+     *     process(frame.image, frame.tick);
+     * @endcode
+     *
+     * @return 可等待对象，`co_await` 后得到 rm::SourceFrame
+     */
+    NextAwaiter next() { return NextAwaiter(this); }
+
+    /**
+     * @brief 事件循环单步：帧到达或帧源结束时恢复挂起的协程
+     *
+     * @return 是否恢复了挂起的协程
+     */
+    bool poll()
+    {
+        if (_waiter == nullptr)
+            return false;
+        auto *waiter = _waiter;
+        if (!tryRead(waiter->_frame) && !eof())
+            return false;
+        _waiter = nullptr;
+        waiter->_handle.resume();
+        return true;
+    }
+
+private:
+    NextAwaiter *_waiter{}; //!< 挂起等待帧的可等待对象
+#endif
+};
+
+/**
+ * @brief 实时相机帧源
+ * @brief
+ * - 基于相机的异步采集预取队列实现，构造时启动异步采集，`tryRead` 直接从预取队列取帧
+ *
+ * @tparam CameraT 相机类型，需提供 `startCapture`、`stopCapture` 与 `tryRead` 成员函数
+ */
+template <typename CameraT>
+class LiveFrameSource final : public FrameSource
+{
+public:
+    /**
+     * @brief 创建实时相机帧源，并启动相机的异步采集
+     *
+     * @param[in] camera 相机
+     * @param[in] queue_size 预取队列容量
+     */
+    explicit LiveFrameSource(std::unique_ptr<CameraT> camera, std::size_t queue_size = 4) : _camera(std::move(camera))
+    {
+        _camera->startCapture(queue_size);
+    }
+
+    ~LiveFrameSource() override { _camera->stopCapture(); }
+
+    bool tryRead(SourceFrame &frame) override { return _camera->tryRead(frame.image, &frame.tick); }
+
+    bool eof() const override { return false; }
+
+    //! 相机
+    inline CameraT &camera() { return *_camera; }
+
+private:
+    std::unique_ptr<CameraT> _camera; //!< 相机
+};
+
+/**
+ * @brief 帧日志回放帧源
+ * @brief
+ * - 基于内存映射的 rm::FrameJournalReader 实现，按记录顺序交付日志中的帧
+ * @brief
+ * - 实时回放模式下按记录时间戳的间隔交付帧，未到交付时刻时 `tryRead` 返回 `false`，
+ *   复现实时输入的时序行为；关闭实时回放时帧交付速度由磁盘 I/O 决定
+ */
+class JournalFrameSource final : public FrameSource
+{
+public:
+    /**
+     * @brief 创建帧日志回放帧源
+     *
+     * @param[in] path 帧日志文件路径
+     * @param[in] size 图像帧尺寸
+     * @param[in] type 图像帧类型，如 `CV_8UC1`、`CV_8UC3`
+     * @param[in] realtime 是否按记录时间戳的间隔实时交付，默认 `false`
+     */
+    JournalFrameSource(std::string_view path, cv::Size size, int type, bool realtime = false)
+        : _reader(path), _size(size), _type(type), _realtime(realtime) {}
+
+    bool tryRead(SourceFrame &frame) override
+    {
+        if (eof())
+            return false;
+        JournalFrame record = _reader.at(_idx);
+        if (_realtime)
+        {
+            // 以首帧对齐回放时钟，未到交付时刻时不交付
+            if (_idx == 0)
+            {
+                _start_tick = Timer::now();
+                _first_tick = record.tick;
+            }
+            else if (Timer::now() - _start_tick < record.tick - _first_tick)
+                return false;
+        }
+        frame.image.create(_size, _type);
+        std::size_t bytes = std::min(record.data.size(), frame.image.total() * frame.image.elemSize());
+        std::memcpy(frame.image.data, record.data.data(), bytes);
+        frame.tick = record.tick;
+        ++_idx;
+        return true;
+    }
+
+    bool eof() const override { return _idx >= _reader.size(); }
+
+    //! 回放进度，即下一帧的下标
+    inline std::size_t index() const { return _idx; }
+    //! 帧日志中的帧数
+    inline std::size_t size() const { return _reader.size(); }
+
+private:
+    FrameJournalReader _reader; //!< 帧日志读取器
+    cv::Size _size;             //!< 图像帧尺寸
+    int _type{};                //!< 图像帧类型
+    bool _realtime{};           //!< 是否实时回放
+    std::size_t _idx{};         //!< 下一帧的下标
+    double _start_tick{};       //!< 回放起始的主机时间戳
+    double _first_tick{};       //!< 首帧的记录时间戳
+};
+
+//! @} camera
+
+} // namespace rm
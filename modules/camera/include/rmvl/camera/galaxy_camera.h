@@ -87,6 +87,46 @@ public:
      */
     bool read(cv::OutputArray image);
 
+    /**
+     * @brief 从相机设备中读取图像，并交付本帧的捕获元数据
+     * @note 元数据由 SDK 帧信息块填充，不产生额外的 SDK 调用，参考 rm::FrameMeta
+     *
+     * @param[out] image 待读入的图像
+     * @param[out] meta 本帧的捕获元数据
+     * @return 是否读取成功
+     */
+    bool read(cv::OutputArray image, FrameMeta &meta);
+
+    /**
+     * @brief 启动异步采集，后台采集线程将读取到的图像帧存入预取队列，
+     *        使图像采集与图像处理重叠进行
+     *
+     * @param[in] queue_size 预取队列容量
+     */
+    RMVL_W void startCapture(std::size_t queue_size = 4);
+
+    //! 停止异步采集
+    RMVL_W void stopCapture();
+
+    /**
+     * @brief 从预取队列中取出最早的图像帧，队列为空时立即返回
+     *
+     * @param[out] image 图像帧
+     * @param[out] timestamp 帧到达时间戳（单位：s，可为空）
+     * @return 是否成功取帧
+     */
+    bool tryRead(cv::OutputArray image, double *timestamp = nullptr);
+
+    /**
+     * @brief 从预取队列中取出最早的图像帧，队列为空时最多等待 `timeout` 秒
+     *
+     * @param[out] image 图像帧
+     * @param[in] timeout 等待超时时间（单位：s）
+     * @param[out] timestamp 帧到达时间戳（单位：s，可为空）
+     * @return 是否成功取帧
+     */
+    bool waitRead(cv::OutputArray image, double timeout, double *timestamp = nullptr);
+
     //! @cond
 
     /**
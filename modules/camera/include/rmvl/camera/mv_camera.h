@@ -76,6 +76,19 @@ public:
      */
     RMVL_W bool set(int propId, double value = 0.0);
 
+    /**
+     * @brief 批量应用相机参数配置集
+     * @brief
+     * - 在暂停取流的单次事务中写入配置集内的全部参数，避免逐条 `set` 时部分属性
+     *   各自触发取流重启的往返开销
+     * @brief
+     * - 配置集会被保存，`reconnect()` 后开始取流前自动重新应用
+     *
+     * @param[in] profile 相机参数配置集
+     * @return 是否全部应用成功
+     */
+    RMVL_W bool apply(const CameraProfile &profile);
+
     /**
      * @brief 获取相机参数
      *
@@ -95,6 +108,46 @@ public:
      */
     bool read(cv::OutputArray image);
 
+    /**
+     * @brief 从相机设备中读取图像，并交付本帧的捕获元数据
+     * @note 元数据由 SDK 帧头信息填充，不产生额外的 SDK 调用，参考 rm::FrameMeta
+     *
+     * @param[out] image 待读入的图像
+     * @param[out] meta 本帧的捕获元数据
+     * @return 是否读取成功
+     */
+    bool read(cv::OutputArray image, FrameMeta &meta);
+
+    /**
+     * @brief 启动异步采集，后台采集线程将读取到的图像帧存入预取队列，
+     *        使图像采集与图像处理重叠进行
+     *
+     * @param[in] queue_size 预取队列容量
+     */
+    RMVL_W void startCapture(std::size_t queue_size = 4);
+
+    //! 停止异步采集
+    RMVL_W void stopCapture();
+
+    /**
+     * @brief 从预取队列中取出最早的图像帧，队列为空时立即返回
+     *
+     * @param[out] image 图像帧
+     * @param[out] timestamp 帧到达时间戳（单位：s，可为空）
+     * @return 是否成功取帧
+     */
+    bool tryRead(cv::OutputArray image, double *timestamp = nullptr);
+
+    /**
+     * @brief 从预取队列中取出最早的图像帧，队列为空时最多等待 `timeout` 秒
+     *
+     * @param[out] image 图像帧
+     * @param[in] timeout 等待超时时间（单位：s）
+     * @param[out] timestamp 帧到达时间戳（单位：s，可为空）
+     * @return 是否成功取帧
+     */
+    bool waitRead(cv::OutputArray image, double timeout, double *timestamp = nullptr);
+
     //! @cond
 
     /**
@@ -127,6 +180,19 @@ public:
      *
      * @return 是否成功重连
      */
+
+    /**
+     * @brief 设置硬件 ROI 采集窗口，仅传输窗口内的数据，可在跟踪过程中逐帧更新
+     * @note 窗口尺寸不变、仅平移窗口位置时无需停止取流，开销极小
+     *
+     * @param[in] roi ROI 采集窗口，以全幅面图像左上角为原点
+     * @return 是否设置成功
+     */
+    bool setROI(const cv::Rect &roi);
+
+    //! 恢复全幅面采集
+    bool resetROI();
+
     RMVL_W bool reconnect();
 };
 
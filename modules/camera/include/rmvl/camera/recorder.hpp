@@ -0,0 +1,101 @@
+/**
+ * @file recorder.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 硬件编码视频录制
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include "rmvl/core/rmvldef.hpp"
+
+namespace rm
+{
+
+//! @addtogroup camera
+//! @{
+
+//! 录制帧像素格式
+enum class RecordFormat : uint8_t
+{
+    Gray, //!< 单通道 8 位，适用于 Bayer 原始帧或灰度帧，编码为 4:0:0 亮度平面
+    NV12, //!< YUV 4:2:0 半平面格式，硬件编码器的原生输入，无需任何色彩转换
+    BGR   //!< BGR 交错存储格式，仅部分编码器支持，由编码器内部完成色彩转换
+};
+
+//! 录制状态统计
+struct RMVL_EXPORTS_W_AG RecordStatus
+{
+    RMVL_W_RW std::size_t encoded{}; //!< 已完成编码的帧数
+    RMVL_W_RW std::size_t dropped{}; //!< 因编码滞后被丢弃的帧数
+};
+
+/**
+ * @brief 硬件编码视频录制
+ * @brief
+ * - 通过 V4L2 Memory-to-Memory 接口将图像帧交由平台硬件编码器（如 Raspberry Pi
+ *   `bcm2835-codec`、各 SoC 厂商的 VPU）编码为 H.264，主处理线程仅支付一次入队开销，
+ *   编码与码流落盘由独立的后台线程完成，不与图像处理争抢 CPU
+ * @brief
+ * - `write` 持有传入图像帧的引用计数而非复制数据，与采集缓冲池配合时帧在编码完成前
+ *   不会被池回收；有界队列满时丢弃最早的帧，保证录制滞后不反压采集
+ * @brief
+ * - 建议直接录制 `retrieve` 在 BGR 转换前的原始输出（Bayer 帧以 RecordFormat::Gray
+ *   录制，NV12 帧以 RecordFormat::NV12 录制），省去录制路径上的色彩转换
+ * @note 输出为 H.264 Annex-B 裸码流文件，可通过 `ffmpeg -i xx.h264 -c copy xx.mp4`
+ *       无转码封装为容器格式
+ */
+class RMVL_EXPORTS_W VideoRecorder final
+{
+    RMVL_IMPL;
+
+public:
+    /**
+     * @brief 创建硬件编码视频录制，打开编码器设备并启动后台编码线程
+     *
+     * @param[in] path 输出文件路径，H.264 Annex-B 裸码流
+     * @param[in] size 图像帧尺寸
+     * @param[in] fps 录制帧率
+     * @param[in] format 录制帧像素格式，默认 RecordFormat::NV12
+     * @param[in] device 编码器设备节点，默认 `/dev/video11`（Raspberry Pi 硬件编码器）
+     * @param[in] queue_size 有界队列容量，默认 `4`
+     */
+    RMVL_W VideoRecorder(std::string_view path, cv::Size size, double fps, RecordFormat format = RecordFormat::NV12,
+                         std::string_view device = "/dev/video11", std::size_t queue_size = 4);
+
+    //! @cond
+    VideoRecorder(const VideoRecorder &) = delete;
+    VideoRecorder(VideoRecorder &&) = default;
+    VideoRecorder &operator=(const VideoRecorder &) = delete;
+    VideoRecorder &operator=(VideoRecorder &&) = default;
+    //! @endcond
+
+    //! 编码器设备是否成功打开
+    RMVL_W bool isOpened() const;
+
+    /**
+     * @brief 提交一帧图像进行录制
+     * @note 仅持有图像帧的引用计数并入队，立即返回；队列满时丢弃最早的帧并计入
+     *       RecordStatus::dropped
+     *
+     * @param[in] frame 图像帧，尺寸与像素格式需与构造参数一致
+     * @return 是否成功入队，编码器未打开或帧规格不一致时返回 `false`
+     */
+    RMVL_W bool write(cv::Mat frame);
+
+    //! 录制状态统计
+    RMVL_W RecordStatus status() const;
+
+    //! 停止录制，等待队列中的全部帧编码完成并关闭输出文件
+    RMVL_W void close();
+};
+
+//! @} camera
+
+} // namespace rm
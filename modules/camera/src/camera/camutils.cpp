@@ -9,6 +9,8 @@
  *
  */
 
+#include <cmath>
+
 #include <Eigen/Dense>
 
 #include <opencv2/calib3d.hpp>
@@ -16,8 +18,29 @@
 
 #include "rmvl/camera/camutils.hpp"
 #include "rmvl/algorithm/math.hpp"
+#include "rmvl/core/util.hpp"
 #include "rmvlpara/camera/camera.h"
 
+bool rm::CameraProfile::set(int propId, double value)
+{
+    // 事件类属性不具备可重放的状态语义，只读统计类属性无法写入
+    if (propId == CAMERA_TRIGGER_SOFT || propId == CAMERA_ONCE_WB || propId == CAMERA_ONCE_EXPOSURE ||
+        (propId >= CAMERA_GV_DELIVERED_FRAME_COUNT && propId <= CAMERA_GV_RESEND_PACKET_COUNT))
+    {
+        WARNING_("Try to stage an event or read-only variable in the camera profile, id: %d.", propId);
+        return false;
+    }
+    // 同一属性后值覆盖前值
+    for (auto &[id, val] : _entries)
+        if (id == propId)
+        {
+            val = value;
+            return true;
+        }
+    _entries.emplace_back(propId, value);
+    return true;
+}
+
 void rm::CameraExtrinsics::tvec(const cv::Vec3f &tvec)
 {
     _tvec = tvec;
@@ -64,3 +87,48 @@ void rm::CameraExtrinsics::R(const cv::Matx33f &R)
     _pitch = rad2deg(euler_angles[1]);
     _yaw = rad2deg(euler_angles[0]);
 }
+
+void rm::ClockMapper::update(double device_ts, double host_tick)
+{
+    _last_host = host_tick;
+    if (!_init)
+    {
+        _base = device_ts;
+        _init = true;
+    }
+    double x = device_ts - _base;
+    // 离群样本剔除：排队延迟抖动为单侧正向，残差明显偏离滑动均值的样本不参与回归
+    if (_valid)
+    {
+        double residual = std::abs(host_tick - (_offset + _skew * x));
+        if (residual > 8. * _residual + 1e-4)
+        {
+            // 拒绝样本时缓慢放宽阈值，保证时钟域跳变后仍能重新收敛
+            _residual = 0.95 * _residual + 0.05 * residual;
+            return;
+        }
+        _residual = 0.9 * _residual + 0.1 * residual;
+    }
+    // 带遗忘因子的最小二乘回归累加，遗忘因子约对应 1000 帧的时间常数
+    constexpr double FORGET = 0.999;
+    _s1 = FORGET * _s1 + 1.;
+    _sx = FORGET * _sx + x;
+    _sy = FORGET * _sy + host_tick;
+    _sxx = FORGET * _sxx + x * x;
+    _sxy = FORGET * _sxy + x * host_tick;
+    if (++_samples < MIN_SAMPLES)
+        return;
+    double den = _s1 * _sxx - _sx * _sx;
+    if (den <= 0.)
+        return;
+    _skew = (_s1 * _sxy - _sx * _sy) / den;
+    _offset = (_sy - _skew * _sx) / _s1;
+    _valid = true;
+}
+
+double rm::ClockMapper::toHostTick(double device_ts) const
+{
+    if (!_valid)
+        return _last_host;
+    return _offset + _skew * (device_ts - _base);
+}
@@ -0,0 +1,239 @@
+/**
+ * @file demosaic.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief Bayer 图像去马赛克
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <opencv2/core/hal/intrin.hpp>
+
+#include "rmvl/camera/camutils.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm
+{
+
+/**
+ * @brief 钳位访问 Bayer 图像像素，越界时取最近的边界像素
+ *
+ * @param[in] src Bayer 图像
+ * @param[in] y 行坐标
+ * @param[in] x 列坐标
+ * @return 像素值
+ */
+static inline int bayerAt(const cv::Mat &src, int y, int x)
+{
+    y = y < 0 ? 0 : (y >= src.rows ? src.rows - 1 : y);
+    x = x < 0 ? 0 : (x >= src.cols ? src.cols - 1 : x);
+    return src.ptr<uchar>(y)[x];
+}
+
+/**
+ * @brief 单像素双线性插值，用于图像边界与 SIMD 剩余列
+ *
+ * @param[in] src Bayer 图像
+ * @param[out] dst 目标像素首地址（BGR 交错存储）
+ * @param[in] y 行坐标
+ * @param[in] x 列坐标
+ * @param[in] gp 绿色像素的 `(x + y)` 奇偶性
+ * @param[in] blue_row 当前行是否包含蓝色像素
+ */
+static void bilinearPixel(const cv::Mat &src, uchar *dst, int y, int x, int gp, bool blue_row)
+{
+    int b{}, g{}, r{};
+    if (((x + y) & 1) == gp)
+    {
+        g = bayerAt(src, y, x);
+        int h = (bayerAt(src, y, x - 1) + bayerAt(src, y, x + 1) + 1) >> 1;
+        int v = (bayerAt(src, y - 1, x) + bayerAt(src, y + 1, x) + 1) >> 1;
+        b = blue_row ? h : v;
+        r = blue_row ? v : h;
+    }
+    else
+    {
+        int c = bayerAt(src, y, x);
+        g = (bayerAt(src, y, x - 1) + bayerAt(src, y, x + 1) +
+             bayerAt(src, y - 1, x) + bayerAt(src, y + 1, x) + 2) >>
+            2;
+        int d = (bayerAt(src, y - 1, x - 1) + bayerAt(src, y - 1, x + 1) +
+                 bayerAt(src, y + 1, x - 1) + bayerAt(src, y + 1, x + 1) + 2) >>
+                2;
+        b = blue_row ? c : d;
+        r = blue_row ? d : c;
+    }
+    dst[0] = static_cast<uchar>(b);
+    dst[1] = static_cast<uchar>(g);
+    dst[2] = static_cast<uchar>(r);
+}
+
+#if CV_SIMD
+
+//! 以 2 为步长加载 `ptr[0], ptr[2], ptr[4] ...` 处的像素
+static inline cv::v_uint8 v_load_step2(const uchar *ptr)
+{
+    cv::v_uint8 a, b;
+    cv::v_load_deinterleave(ptr, a, b);
+    return a;
+}
+
+//! 2 路舍入平均
+static inline cv::v_uint8 v_avg2(const cv::v_uint8 &a, const cv::v_uint8 &b)
+{
+    cv::v_uint16 a0, a1, b0, b1;
+    cv::v_expand(a, a0, a1);
+    cv::v_expand(b, b0, b1);
+    cv::v_uint16 one = cv::vx_setall_u16(1);
+    return cv::v_pack((a0 + b0 + one) >> 1, (a1 + b1 + one) >> 1);
+}
+
+//! 4 路舍入平均
+static inline cv::v_uint8 v_avg4(const cv::v_uint8 &a, const cv::v_uint8 &b, const cv::v_uint8 &c, const cv::v_uint8 &d)
+{
+    cv::v_uint16 a0, a1, b0, b1, c0, c1, d0, d1;
+    cv::v_expand(a, a0, a1);
+    cv::v_expand(b, b0, b1);
+    cv::v_expand(c, c0, c1);
+    cv::v_expand(d, d0, d1);
+    cv::v_uint16 two = cv::vx_setall_u16(2);
+    return cv::v_pack((a0 + b0 + c0 + d0 + two) >> 2, (a1 + b1 + c1 + d1 + two) >> 2);
+}
+
+#endif // CV_SIMD
+
+/**
+ * @brief 单行双线性插值（内部行）
+ *
+ * @param[in] src Bayer 图像
+ * @param[out] dst 目标行首地址（BGR 交错存储）
+ * @param[in] y 行坐标，满足 `1 <= y <= rows - 2`
+ * @param[in] gp 绿色像素的 `(x + y)` 奇偶性
+ * @param[in] blue_row 当前行是否包含蓝色像素
+ */
+static void bilinearRow(const cv::Mat &src, uchar *dst, int y, int gp, bool blue_row)
+{
+    const uchar *rm1 = src.ptr<uchar>(y - 1);
+    const uchar *r0 = src.ptr<uchar>(y);
+    const uchar *rp1 = src.ptr<uchar>(y + 1);
+    int cols = src.cols;
+    int x = 2;
+#if CV_SIMD
+    const int step = cv::v_uint8::nlanes;
+    // 绿色像素所在列的奇偶性
+    const int pg = (gp + y) & 1;
+    for (; x + 2 * step <= cols - 1; x += 2 * step)
+    {
+        // 绿色相位：B、R 分别取水平、垂直邻域均值
+        int xg = x + pg;
+        cv::v_uint8 g_g = v_load_step2(r0 + xg);
+        cv::v_uint8 h = v_avg2(v_load_step2(r0 + xg - 1), v_load_step2(r0 + xg + 1));
+        cv::v_uint8 v = v_avg2(v_load_step2(rm1 + xg), v_load_step2(rp1 + xg));
+        cv::v_uint8 b_g = blue_row ? h : v;
+        cv::v_uint8 r_g = blue_row ? v : h;
+        // 非绿色相位：G 取十字邻域均值，对侧颜色取对角邻域均值
+        int xc = x + 1 - pg;
+        cv::v_uint8 c = v_load_step2(r0 + xc);
+        cv::v_uint8 g_c = v_avg4(v_load_step2(r0 + xc - 1), v_load_step2(r0 + xc + 1),
+                                 v_load_step2(rm1 + xc), v_load_step2(rp1 + xc));
+        cv::v_uint8 d = v_avg4(v_load_step2(rm1 + xc - 1), v_load_step2(rm1 + xc + 1),
+                               v_load_step2(rp1 + xc - 1), v_load_step2(rp1 + xc + 1));
+        cv::v_uint8 b_c = blue_row ? c : d;
+        cv::v_uint8 r_c = blue_row ? d : c;
+        // 按列奇偶性交织两个相位的结果后连续存储
+        cv::v_uint8 b_lo, b_hi, g_lo, g_hi, r_lo, r_hi;
+        cv::v_zip(pg == 0 ? b_g : b_c, pg == 0 ? b_c : b_g, b_lo, b_hi);
+        cv::v_zip(pg == 0 ? g_g : g_c, pg == 0 ? g_c : g_g, g_lo, g_hi);
+        cv::v_zip(pg == 0 ? r_g : r_c, pg == 0 ? r_c : r_g, r_lo, r_hi);
+        cv::v_store_interleave(dst + 3 * x, b_lo, g_lo, r_lo);
+        cv::v_store_interleave(dst + 3 * (x + step), b_hi, g_hi, r_hi);
+    }
+#endif
+    for (; x < cols; ++x)
+        bilinearPixel(src, dst + 3 * x, y, x, gp, blue_row);
+    bilinearPixel(src, dst, y, 0, gp, blue_row);
+    bilinearPixel(src, dst + 3, y, 1, gp, blue_row);
+}
+
+/**
+ * @brief 单行 Malvar-He-Cutler 梯度校正插值（内部行）
+ *
+ * @param[in] src Bayer 图像
+ * @param[out] dst 目标行首地址（BGR 交错存储）
+ * @param[in] y 行坐标，满足 `2 <= y <= rows - 3`
+ * @param[in] gp 绿色像素的 `(x + y)` 奇偶性
+ * @param[in] blue_row 当前行是否包含蓝色像素
+ */
+static void malvarRow(const cv::Mat &src, uchar *dst, int y, int gp, bool blue_row)
+{
+    const uchar *rm2 = src.ptr<uchar>(y - 2);
+    const uchar *rm1 = src.ptr<uchar>(y - 1);
+    const uchar *r0 = src.ptr<uchar>(y);
+    const uchar *rp1 = src.ptr<uchar>(y + 1);
+    const uchar *rp2 = src.ptr<uchar>(y + 2);
+    int cols = src.cols;
+    auto clamp8 = [](int val) { return static_cast<uchar>(val < 0 ? 0 : (val > 255 ? 255 : val)); };
+    for (int x = 2; x <= cols - 3; ++x)
+    {
+        int b{}, g{}, r{};
+        if (((x + y) & 1) == gp)
+        {
+            // 绿色像素，水平、垂直方向的缺失颜色采用系数 ×16 的定点核
+            g = r0[x];
+            int diag = rm1[x - 1] + rm1[x + 1] + rp1[x - 1] + rp1[x + 1];
+            int ch = (10 * g + 8 * (r0[x - 1] + r0[x + 1]) - 2 * diag - 2 * (r0[x - 2] + r0[x + 2]) + rm2[x] + rp2[x] + 8) >> 4;
+            int v = (10 * g + 8 * (rm1[x] + rp1[x]) - 2 * diag - 2 * (rm2[x] + rp2[x]) + r0[x - 2] + r0[x + 2] + 8) >> 4;
+            b = blue_row ? ch : v;
+            r = blue_row ? v : ch;
+        }
+        else
+        {
+            // 非绿色像素
+            int c = r0[x];
+            int axial2 = rm2[x] + rp2[x] + r0[x - 2] + r0[x + 2];
+            g = (4 * c + 2 * (rm1[x] + rp1[x] + r0[x - 1] + r0[x + 1]) - axial2 + 4) >> 3;
+            int d = (12 * c + 4 * (rm1[x - 1] + rm1[x + 1] + rp1[x - 1] + rp1[x + 1]) - 3 * axial2 + 8) >> 4;
+            b = blue_row ? c : d;
+            r = blue_row ? d : c;
+        }
+        uchar *p = dst + 3 * x;
+        p[0] = clamp8(b);
+        p[1] = clamp8(g);
+        p[2] = clamp8(r);
+    }
+    for (int x : {0, 1, cols - 2, cols - 1})
+        bilinearPixel(src, dst + 3 * x, y, x, gp, blue_row);
+}
+
+void demosaic(cv::Mat src, cv::Mat &dst, BayerPattern pattern, DemosaicMethod method)
+{
+    if (src.empty())
+    {
+        dst = cv::Mat();
+        return;
+    }
+    RMVL_Assert(src.type() == CV_8UC1 && src.rows >= 4 && src.cols >= 4);
+    dst.create(src.size(), CV_8UC3);
+    // 绿色像素的 (x + y) 奇偶性
+    const int gp = (pattern == BayerPattern::GB || pattern == BayerPattern::GR) ? 0 : 1;
+    // 蓝色像素是否位于偶数行
+    const bool blue_even = (pattern == BayerPattern::BG || pattern == BayerPattern::GB);
+    cv::parallel_for_(cv::Range(0, src.rows), [&](const cv::Range &range) {
+        for (int y = range.start; y < range.end; ++y)
+        {
+            bool blue_row = ((y & 1) == 0) == blue_even;
+            uchar *dst_row = dst.ptr<uchar>(y);
+            if (y < 1 || y > src.rows - 2)
+                for (int x = 0; x < src.cols; ++x)
+                    bilinearPixel(src, dst_row + 3 * x, y, x, gp, blue_row);
+            else if (method == DemosaicMethod::Malvar && y >= 2 && y <= src.rows - 3)
+                malvarRow(src, dst_row, y, gp, blue_row);
+            else
+                bilinearRow(src, dst_row, y, gp, blue_row);
+        }
+    });
+}
+
+} // namespace rm
@@ -0,0 +1,442 @@
+/**
+ * @file recorder.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 硬件编码视频录制
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <linux/videodev2.h>
+#endif
+
+#include "rmvl/camera/recorder.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm
+{
+
+#ifdef __linux__
+
+class VideoRecorder::Impl
+{
+public:
+    Impl(std::string_view path, cv::Size size, double fps, RecordFormat format, std::string_view device, std::size_t queue_size)
+        : _size(size), _format(format), _queue_size(queue_size == 0 ? 1 : queue_size)
+    {
+        if (size.width <= 0 || size.height <= 0 || fps <= 0)
+        {
+            ERROR_("Invalid recording specification (%d, %d) @ %.1f fps", size.width, size.height, fps);
+            return;
+        }
+        _file = std::fopen(std::string(path).c_str(), "wb");
+        if (_file == nullptr)
+        {
+            ERROR_("Failed to open output file \"%s\"", std::string(path).c_str());
+            return;
+        }
+        if (!openEncoder(device, fps))
+        {
+            closeEncoder();
+            return;
+        }
+        _thread = std::thread(&Impl::encodeLoop, this);
+    }
+
+    ~Impl() { close(); }
+
+    inline bool isOpened() const { return _fd >= 0; }
+
+    bool write(cv::Mat frame)
+    {
+        if (_fd < 0 || _closing)
+            return false;
+        // 校验帧规格与构造参数一致
+        std::size_t expect = frameSize();
+        if (frame.total() * frame.elemSize() != expect)
+            return false;
+        // 编码器的 DMA 缓冲区要求连续存储，带行距的 ROI 视图在此处整理
+        if (!frame.isContinuous())
+            frame = frame.clone();
+        {
+            std::lock_guard lk(_mutex);
+            // 队列已满，丢弃最早的帧，录制滞后不反压采集
+            if (_queue.size() >= _queue_size)
+            {
+                _queue.pop_front();
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+            _queue.push_back(std::move(frame));
+        }
+        _not_empty.notify_one();
+        return true;
+    }
+
+    RecordStatus status() const
+    {
+        return {_encoded.load(std::memory_order_relaxed), _dropped.load(std::memory_order_relaxed)};
+    }
+
+    void close()
+    {
+        if (_thread.joinable())
+        {
+            {
+                std::lock_guard lk(_mutex);
+                _closing = true;
+            }
+            _not_empty.notify_one();
+            _thread.join();
+        }
+        closeEncoder();
+    }
+
+private:
+    //! 输出（原始帧）与采集（码流）队列各自的缓冲区个数
+    static constexpr std::size_t NUM_BUFFERS = 4;
+
+    //! 已映射的 V4L2 缓冲区
+    struct MappedBuffer
+    {
+        void *data{};         //!< 映射首地址
+        std::size_t length{}; //!< 映射长度
+    };
+
+    //! 录制帧像素格式对应的 V4L2 像素格式
+    inline uint32_t pixelFormat() const
+    {
+        switch (_format)
+        {
+        case RecordFormat::Gray:
+            return V4L2_PIX_FMT_GREY;
+        case RecordFormat::NV12:
+            return V4L2_PIX_FMT_NV12;
+        default:
+            return V4L2_PIX_FMT_BGR24;
+        }
+    }
+
+    //! 单帧原始数据长度
+    inline std::size_t frameSize() const
+    {
+        std::size_t luma = static_cast<std::size_t>(_size.width) * _size.height;
+        switch (_format)
+        {
+        case RecordFormat::Gray:
+            return luma;
+        case RecordFormat::NV12:
+            return luma * 3 / 2;
+        default:
+            return luma * 3;
+        }
+    }
+
+    //! 打开编码器设备，协商格式并完成缓冲区映射与流启动
+    bool openEncoder(std::string_view device, double fps)
+    {
+        _fd = ::open(std::string(device).c_str(), O_RDWR);
+        if (_fd < 0)
+        {
+            ERROR_("Failed to open encoder device \"%s\"", std::string(device).c_str());
+            return false;
+        }
+        v4l2_capability cap{};
+        if (::ioctl(_fd, VIDIOC_QUERYCAP, &cap) != 0 || !(cap.capabilities & V4L2_CAP_VIDEO_M2M_MPLANE))
+        {
+            ERROR_("Device \"%s\" is not a memory-to-memory encoder", std::string(device).c_str());
+            return false;
+        }
+        // 输出队列：原始帧格式
+        v4l2_format ofmt{};
+        ofmt.type = V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE;
+        ofmt.fmt.pix_mp.width = _size.width;
+        ofmt.fmt.pix_mp.height = _size.height;
+        ofmt.fmt.pix_mp.pixelformat = pixelFormat();
+        ofmt.fmt.pix_mp.num_planes = 1;
+        if (::ioctl(_fd, VIDIOC_S_FMT, &ofmt) != 0 || ofmt.fmt.pix_mp.pixelformat != pixelFormat())
+        {
+            ERROR_("Encoder does not accept the requested raw frame format");
+            return false;
+        }
+        // 采集队列：H.264 码流
+        v4l2_format cfmt{};
+        cfmt.type = V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE;
+        cfmt.fmt.pix_mp.width = _size.width;
+        cfmt.fmt.pix_mp.height = _size.height;
+        cfmt.fmt.pix_mp.pixelformat = V4L2_PIX_FMT_H264;
+        cfmt.fmt.pix_mp.num_planes = 1;
+        if (::ioctl(_fd, VIDIOC_S_FMT, &cfmt) != 0 || cfmt.fmt.pix_mp.pixelformat != V4L2_PIX_FMT_H264)
+        {
+            ERROR_("Encoder does not provide an H.264 bitstream output");
+            return false;
+        }
+        // 编码帧率
+        v4l2_streamparm parm{};
+        parm.type = V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE;
+        parm.parm.output.timeperframe.numerator = 1000;
+        parm.parm.output.timeperframe.denominator = static_cast<uint32_t>(fps * 1000);
+        ::ioctl(_fd, VIDIOC_S_PARM, &parm);
+        // 缓冲区申请与映射
+        if (!mapBuffers(V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE, _obufs) ||
+            !mapBuffers(V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE, _cbufs))
+        {
+            ERROR_("Failed to map encoder buffers");
+            return false;
+        }
+        for (std::size_t i = 0; i < NUM_BUFFERS; ++i)
+        {
+            _free_obufs.push_back(static_cast<uint32_t>(i));
+            if (!queueCapture(static_cast<uint32_t>(i)))
+                return false;
+        }
+        int otype = V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE, ctype = V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE;
+        if (::ioctl(_fd, VIDIOC_STREAMON, &otype) != 0 || ::ioctl(_fd, VIDIOC_STREAMON, &ctype) != 0)
+        {
+            ERROR_("Failed to start encoder streaming");
+            return false;
+        }
+        return true;
+    }
+
+    //! 申请并映射指定队列的缓冲区
+    bool mapBuffers(uint32_t type, MappedBuffer *bufs)
+    {
+        v4l2_requestbuffers req{};
+        req.count = NUM_BUFFERS;
+        req.type = type;
+        req.memory = V4L2_MEMORY_MMAP;
+        if (::ioctl(_fd, VIDIOC_REQBUFS, &req) != 0 || req.count < NUM_BUFFERS)
+            return false;
+        for (std::size_t i = 0; i < NUM_BUFFERS; ++i)
+        {
+            v4l2_plane plane{};
+            v4l2_buffer buf{};
+            buf.type = type;
+            buf.memory = V4L2_MEMORY_MMAP;
+            buf.index = static_cast<uint32_t>(i);
+            buf.length = 1;
+            buf.m.planes = &plane;
+            if (::ioctl(_fd, VIDIOC_QUERYBUF, &buf) != 0)
+                return false;
+            bufs[i].length = plane.length;
+            bufs[i].data = ::mmap(nullptr, plane.length, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, plane.m.mem_offset);
+            if (bufs[i].data == MAP_FAILED)
+            {
+                bufs[i].data = nullptr;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! 将指定采集缓冲区入队
+    bool queueCapture(uint32_t index)
+    {
+        v4l2_plane plane{};
+        v4l2_buffer buf{};
+        buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE;
+        buf.memory = V4L2_MEMORY_MMAP;
+        buf.index = index;
+        buf.length = 1;
+        buf.m.planes = &plane;
+        return ::ioctl(_fd, VIDIOC_QBUF, &buf) == 0;
+    }
+
+    //! 后台编码线程循环
+    void encodeLoop()
+    {
+        while (true)
+        {
+            cv::Mat frame;
+            {
+                std::unique_lock lk(_mutex);
+                _not_empty.wait(lk, [this] { return _closing || !_queue.empty(); });
+                if (_queue.empty())
+                    break;
+                frame = std::move(_queue.front());
+                _queue.pop_front();
+            }
+            encodeOne(frame);
+        }
+        drain();
+    }
+
+    //! 编码一帧：复制进输出缓冲区并入队，随后收取就绪的码流
+    void encodeOne(const cv::Mat &frame)
+    {
+        // 无空闲输出缓冲区时等待编码器归还
+        while (_free_obufs.empty())
+            if (!collect(-1))
+                return;
+        uint32_t index = _free_obufs.front();
+        _free_obufs.pop_front();
+        std::size_t bytes = std::min<std::size_t>(frameSize(), _obufs[index].length);
+        std::memcpy(_obufs[index].data, frame.data, bytes);
+        v4l2_plane plane{};
+        plane.bytesused = static_cast<uint32_t>(bytes);
+        v4l2_buffer buf{};
+        buf.type = V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE;
+        buf.memory = V4L2_MEMORY_MMAP;
+        buf.index = index;
+        buf.length = 1;
+        buf.m.planes = &plane;
+        if (::ioctl(_fd, VIDIOC_QBUF, &buf) != 0)
+        {
+            _free_obufs.push_back(index);
+            return;
+        }
+        collect(0);
+    }
+
+    /**
+     * @brief 收取编码器就绪的缓冲区：码流缓冲区落盘后重新入队，原始帧缓冲区归还空闲列表
+     *
+     * @param[in] timeout 等待超时（单位：ms），`-1` 表示阻塞等待，`0` 表示仅收取已就绪的缓冲区
+     * @return 是否有缓冲区被收取
+     */
+    bool collect(int timeout)
+    {
+        pollfd pfd{_fd, POLLIN | POLLOUT, 0};
+        if (::poll(&pfd, 1, timeout) <= 0)
+            return false;
+        bool retval{};
+        if (pfd.revents & POLLIN)
+        {
+            v4l2_plane plane{};
+            v4l2_buffer buf{};
+            buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE;
+            buf.memory = V4L2_MEMORY_MMAP;
+            buf.length = 1;
+            buf.m.planes = &plane;
+            if (::ioctl(_fd, VIDIOC_DQBUF, &buf) == 0)
+            {
+                if (plane.bytesused > 0)
+                {
+                    std::fwrite(_cbufs[buf.index].data, 1, plane.bytesused, _file);
+                    _encoded.fetch_add(1, std::memory_order_relaxed);
+                }
+                _last = buf.flags & V4L2_BUF_FLAG_LAST;
+                if (!_last)
+                    queueCapture(buf.index);
+                retval = true;
+            }
+        }
+        if (pfd.revents & POLLOUT)
+        {
+            v4l2_plane plane{};
+            v4l2_buffer buf{};
+            buf.type = V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE;
+            buf.memory = V4L2_MEMORY_MMAP;
+            buf.length = 1;
+            buf.m.planes = &plane;
+            if (::ioctl(_fd, VIDIOC_DQBUF, &buf) == 0)
+            {
+                _free_obufs.push_back(buf.index);
+                retval = true;
+            }
+        }
+        return retval;
+    }
+
+    //! 通知编码器结束并收取剩余码流
+    void drain()
+    {
+        v4l2_encoder_cmd cmd{};
+        cmd.cmd = V4L2_ENC_CMD_STOP;
+        if (::ioctl(_fd, VIDIOC_ENCODER_CMD, &cmd) != 0)
+            return;
+        // 收取直至编码器交付带结束标志的码流缓冲区
+        while (!_last && collect(500))
+            ;
+    }
+
+    //! 停止流并释放编码器资源
+    void closeEncoder()
+    {
+        if (_fd >= 0)
+        {
+            int otype = V4L2_BUF_TYPE_VIDEO_OUTPUT_MPLANE, ctype = V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE;
+            ::ioctl(_fd, VIDIOC_STREAMOFF, &otype);
+            ::ioctl(_fd, VIDIOC_STREAMOFF, &ctype);
+            for (std::size_t i = 0; i < NUM_BUFFERS; ++i)
+            {
+                if (_obufs[i].data != nullptr)
+                    ::munmap(_obufs[i].data, _obufs[i].length);
+                if (_cbufs[i].data != nullptr)
+                    ::munmap(_cbufs[i].data, _cbufs[i].length);
+                _obufs[i] = _cbufs[i] = {};
+            }
+            ::close(_fd);
+            _fd = -1;
+        }
+        if (_file != nullptr)
+        {
+            std::fclose(_file);
+            _file = nullptr;
+        }
+    }
+
+    int _fd{-1};                    //!< 编码器设备文件描述符
+    std::FILE *_file{};             //!< 码流输出文件
+    cv::Size _size;                 //!< 图像帧尺寸
+    RecordFormat _format;           //!< 录制帧像素格式
+    MappedBuffer _obufs[NUM_BUFFERS]; //!< 输出（原始帧）缓冲区
+    MappedBuffer _cbufs[NUM_BUFFERS]; //!< 采集（码流）缓冲区
+    std::deque<uint32_t> _free_obufs; //!< 空闲输出缓冲区索引
+    bool _last{};                   //!< 编码器是否已交付结束标志
+
+    std::size_t _queue_size{};          //!< 有界队列容量
+    std::deque<cv::Mat> _queue;         //!< 待编码帧队列（仅持有引用计数）
+    std::mutex _mutex;                  //!< 队列互斥锁
+    std::condition_variable _not_empty; //!< 队列非空条件变量
+    bool _closing{};                    //!< 停止标志
+    std::thread _thread;                //!< 后台编码线程
+    std::atomic<std::size_t> _encoded{}; //!< 已完成编码的帧数
+    std::atomic<std::size_t> _dropped{}; //!< 因编码滞后被丢弃的帧数
+};
+
+#else
+
+class VideoRecorder::Impl
+{
+public:
+    Impl(std::string_view, cv::Size, double, RecordFormat, std::string_view, std::size_t)
+    {
+        ERROR_("Hardware video recording is only supported on Linux (V4L2 M2M)");
+    }
+
+    inline bool isOpened() const { return false; }
+    inline bool write(cv::Mat) { return false; }
+    inline RecordStatus status() const { return {}; }
+    inline void close() {}
+};
+
+#endif // __linux__
+
+RMVL_IMPL_DEF(VideoRecorder)
+
+VideoRecorder::VideoRecorder(std::string_view path, cv::Size size, double fps, RecordFormat format, std::string_view device, std::size_t queue_size)
+    : _impl(new Impl(path, size, fps, format, device, queue_size)) {}
+bool VideoRecorder::isOpened() const { return _impl->isOpened(); }
+bool VideoRecorder::write(cv::Mat frame) { return _impl->write(std::move(frame)); }
+RecordStatus VideoRecorder::status() const { return _impl->status(); }
+void VideoRecorder::close() { _impl->close(); }
+
+} // namespace rm
@@ -9,12 +9,17 @@
  *
  */
 
+#include <cstdlib>
+#include <mutex>
 #include <thread>
 #include <unordered_set>
 
 #include <DxImageProc.h>
 #include <GxIAPI.h>
 
+#include "rmvl/core/init.hpp"
+#include "rmvl/core/lineage.hpp"
+
 #include <opencv2/imgproc.hpp>
 
 #include "galaxy_camera_impl.h"
@@ -31,6 +36,11 @@ bool GalaxyCamera::set(int prop_id, double value) const { return _impl->set(prop
 double GalaxyCamera::get(int prop_id) const { return _impl->get(prop_id); }
 bool GalaxyCamera::isOpened() const { return _impl->isOpened(); }
 bool GalaxyCamera::read(cv::OutputArray image) { return _impl->read(image); }
+bool GalaxyCamera::read(cv::OutputArray image, FrameMeta &meta) { return _impl->read(image, meta); }
+void GalaxyCamera::startCapture(std::size_t queue_size) { _impl->startCapture(queue_size); }
+void GalaxyCamera::stopCapture() { _impl->stopCapture(); }
+bool GalaxyCamera::tryRead(cv::OutputArray image, double *timestamp) { return _impl->tryRead(image, timestamp); }
+bool GalaxyCamera::waitRead(cv::OutputArray image, double timeout, double *timestamp) { return _impl->waitRead(image, timeout, timestamp); }
 bool GalaxyCamera::reconnect() const { return _impl->reconnect(); }
 
 std::string GalaxyCamera::version() { return GXGetLibVersion(); }
@@ -43,13 +53,19 @@ const char *getGXError() noexcept
     return errinfo;
 }
 
-GalaxyCamera::Impl::Impl(CameraConfig config, std::string_view id) noexcept : _config(config), _id(id)
-{
-    _opened = open();
-}
-
-bool GalaxyCamera::Impl::open() noexcept
+/**
+ * @brief 进程级初始化 SDK 库
+ * @note 库加载仅执行一次，进程退出时统一关闭，多相机实例、断线重连均复用同一份库资源
+ *
+ * @return 是否初始化成功
+ */
+static bool initGalaxySDK() noexcept
 {
+    static std::mutex init_mtx;
+    static bool inited = false;
+    std::lock_guard lk(init_mtx);
+    if (inited)
+        return true;
     auto status = GXInitLib();
     getGXError();
     if (status != GX_STATUS_SUCCESS)
@@ -57,6 +73,23 @@ bool GalaxyCamera::Impl::open() noexcept
         ERROR_("(galaxy) Failed to initialize the library (error: \"%s\")", getGXError());
         return false;
     }
+    std::atexit([] { GXCloseLib(); });
+    inited = true;
+    return true;
+}
+
+//! 注册为惰性初始化子系统，可通过 rm::init 在启动阶段预热
+static SubsystemRegistrar galaxy_registrar("camera/galaxy", [] { initGalaxySDK(); });
+
+GalaxyCamera::Impl::Impl(CameraConfig config, std::string_view id) noexcept : _config(config), _id(id)
+{
+    _opened = open();
+}
+
+bool GalaxyCamera::Impl::open() noexcept
+{
+    if (!initGalaxySDK())
+        return false;
     // ----------------------- 设备枚举 -----------------------
     uint32_t nums{};
     status = GXUpdateDeviceList(&nums, 1000);
@@ -219,7 +252,12 @@ bool GalaxyCamera::Impl::open() noexcept
     return true;
 }
 
-GalaxyCamera::Impl::~Impl() noexcept { release(); }
+GalaxyCamera::Impl::~Impl() noexcept
+{
+    // 先停止异步采集线程，再释放相机资源
+    _async.stop();
+    release();
+}
 
 bool GalaxyCamera::Impl::read(cv::OutputArray image) noexcept
 {
@@ -252,6 +290,8 @@ bool GalaxyCamera::Impl::read(cv::OutputArray image) noexcept
 
 bool GalaxyCamera::Impl::retrieve(cv::OutputArray image, RetrieveMode flag) noexcept
 {
+    // 取帧入口处铸造帧 ID，开启本帧的血缘跟踪
+    lineage::begin();
     // --------------------- 前置信息准备 ---------------------
 #ifdef __linux__
     int32_t pixel_format = _buffer->nPixelFormat;
@@ -261,6 +301,14 @@ bool GalaxyCamera::Impl::retrieve(cv::OutputArray image, RetrieveMode flag) noex
     int32_t pixel_format = _data.nPixelFormat;
     uint32_t width = _data.nWidth, height = _data.nHeight;
     void *buffer = _data.pImgBuf;
+#endif // __linux__
+    // 捕获元数据由 SDK 已返回的帧信息块填充，无额外 SDK 调用
+#ifdef __linux__
+    _meta.frame_id = _buffer->nFrameID;
+    _meta.device_ts = static_cast<double>(_buffer->nTimestamp);
+#else
+    _meta.frame_id = _data.nFrameID;
+    _meta.device_ts = static_cast<double>(_data.nTimestamp);
 #endif // __linux__
     // ---------------------- 解码、转码 ----------------------
     if (pixel_format == GX_PIXEL_FORMAT_MONO8)
@@ -290,13 +338,13 @@ bool GalaxyCamera::Impl::retrieve(cv::OutputArray image, RetrieveMode flag) noex
         {
             cv::Mat src_img(height, width, CV_8U, buffer);
             cv::Mat dst_img;
-            const static std::unordered_map<int32_t, int> bayer_map{
-                {GX_PIXEL_FORMAT_BAYER_GR8, cv::COLOR_BayerGR2BGR},
-                {GX_PIXEL_FORMAT_BAYER_RG8, cv::COLOR_BayerRG2BGR},
-                {GX_PIXEL_FORMAT_BAYER_GB8, cv::COLOR_BayerGB2BGR},
-                {GX_PIXEL_FORMAT_BAYER_BG8, cv::COLOR_BayerBG2BGR},
+            const static std::unordered_map<int32_t, BayerPattern> bayer_map{
+                {GX_PIXEL_FORMAT_BAYER_GR8, BayerPattern::GR},
+                {GX_PIXEL_FORMAT_BAYER_RG8, BayerPattern::RG},
+                {GX_PIXEL_FORMAT_BAYER_GB8, BayerPattern::GB},
+                {GX_PIXEL_FORMAT_BAYER_BG8, BayerPattern::BG},
             };
-            cv::cvtColor(src_img, dst_img, bayer_map.at(pixel_format));
+            demosaic(src_img, dst_img, bayer_map.at(pixel_format), _config.demosaic_method);
             image.assign(dst_img);
         }
         else
@@ -339,7 +387,7 @@ void GalaxyCamera::Impl::release() noexcept
     status = GXCloseDevice(_handle);
     if (status != GX_STATUS_SUCCESS)
         ERROR_("(galaxy) Failed to close device (error: \"%s\")", getGXError());
-    GXCloseLib();
+    // SDK 库保持常驻，由 initGalaxySDK 注册的退出回调统一关闭
 }
 
 } // namespace rm
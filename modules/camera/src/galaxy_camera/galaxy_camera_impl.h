@@ -73,6 +73,23 @@ public:
      */
     bool read(cv::OutputArray image) noexcept;
 
+    //! 从相机设备中读取图像，并交付本帧的捕获元数据
+    inline bool read(cv::OutputArray image, FrameMeta &meta) noexcept
+    {
+        bool retval = read(image);
+        meta = _meta;
+        return retval;
+    }
+
+    //! 启动异步采集
+    inline void startCapture(std::size_t queue_size) { _async.start([this](cv::Mat &img) { return read(img); }, queue_size); }
+    //! 停止异步采集
+    inline void stopCapture() { _async.stop(); }
+    //! 非阻塞获取预取队列中最早的图像帧
+    inline bool tryRead(cv::OutputArray image, double *timestamp) { return _async.tryRead(image, timestamp); }
+    //! 限时等待获取预取队列中最早的图像帧
+    inline bool waitRead(cv::OutputArray image, double timeout, double *timestamp) { return _async.waitRead(image, timeout, timestamp); }
+
     //! 相机重连
     bool reconnect() noexcept;
 
@@ -89,6 +106,9 @@ private:
 #endif // __linux__
 
     bool _opened{}; //!< 相机是否打开
+
+    FrameMeta _meta{};   //!< 最近一帧的捕获元数据，取帧时由 SDK 帧信息块填充
+    AsyncCapture _async; //!< 异步采集预取队列
 };
 
 //! 获取 GX_STATUS 错误信息
@@ -67,6 +67,25 @@ bool GalaxyCamera::Impl::set(int prop_id, double value) noexcept
                    GXSetInt(_handle, GX_INT_SATURATION, static_cast<int64_t>(value)) == GX_STATUS_SUCCESS;
     case CAMERA_TRIGGER_SOFT:
         return GXSendCommand(_handle, GX_COMMAND_TRIGGER_SOFTWARE) == GX_STATUS_SUCCESS;
+    // GigE Transport
+    case CAMERA_GV_PACKET_SIZE:
+        return GXSetInt(_handle, GX_INT_GEV_PACKETSIZE, static_cast<int64_t>(value)) == GX_STATUS_SUCCESS;
+    case CAMERA_GV_PACKET_DELAY:
+        return GXSetInt(_handle, GX_INT_GEV_PACKETDELAY, static_cast<int64_t>(value)) == GX_STATUS_SUCCESS;
+    case CAMERA_GV_THROUGHPUT_LIMIT:
+        if (value <= 0)
+            return GXSetEnum(_handle, GX_ENUM_DEVICE_LINK_THROUGHPUT_LIMIT_MODE, GX_DEVICE_LINK_THROUGHPUT_LIMIT_MODE_OFF) == GX_STATUS_SUCCESS;
+        else
+            return GXSetEnum(_handle, GX_ENUM_DEVICE_LINK_THROUGHPUT_LIMIT_MODE, GX_DEVICE_LINK_THROUGHPUT_LIMIT_MODE_ON) == GX_STATUS_SUCCESS &&
+                   GXSetInt(_handle, GX_INT_DEVICE_LINK_THROUGHPUT_LIMIT, static_cast<int64_t>(value)) == GX_STATUS_SUCCESS;
+    case CAMERA_GV_RESEND_ENABLE:
+        return GXSetEnum(_handle, GX_DS_ENUM_RESEND_MODE, static_cast<int64_t>(value) == 0
+                                                              ? GX_DS_RESEND_MODE_OFF
+                                                              : GX_DS_RESEND_MODE_ON) == GX_STATUS_SUCCESS;
+    case CAMERA_GV_RESEND_TIMEOUT:
+        return GXSetInt(_handle, GX_DS_INT_RESEND_TIMEOUT, static_cast<int64_t>(value)) == GX_STATUS_SUCCESS;
+    case CAMERA_GV_RESEND_WINDOW:
+        return GXSetInt(_handle, GX_DS_INT_MAX_WAIT_PACKET_COUNT, static_cast<int64_t>(value)) == GX_STATUS_SUCCESS;
     default:
         WARNING_("(galaxy) try to set undefined variable, id: %d.", prop_id);
         return false;
@@ -106,6 +125,26 @@ double GalaxyCamera::Impl::get(int prop_id) const noexcept
         return GXGetFloat(_handle, GX_FLOAT_TRIGGER_DELAY, &f_value) == GX_STATUS_SUCCESS ? f_value : -1.0;
     case CAMERA_SATURATION:
         return GXGetInt(_handle, GX_INT_SATURATION, &i_value) == GX_STATUS_SUCCESS ? i_value : -1.0;
+    // GigE Transport
+    case CAMERA_GV_PACKET_SIZE:
+        return GXGetInt(_handle, GX_INT_GEV_PACKETSIZE, &i_value) == GX_STATUS_SUCCESS ? i_value : -1.0;
+    case CAMERA_GV_PACKET_DELAY:
+        return GXGetInt(_handle, GX_INT_GEV_PACKETDELAY, &i_value) == GX_STATUS_SUCCESS ? i_value : -1.0;
+    case CAMERA_GV_THROUGHPUT_LIMIT:
+        return GXGetInt(_handle, GX_INT_DEVICE_LINK_THROUGHPUT_LIMIT, &i_value) == GX_STATUS_SUCCESS ? i_value : -1.0;
+    case CAMERA_GV_RESEND_TIMEOUT:
+        return GXGetInt(_handle, GX_DS_INT_RESEND_TIMEOUT, &i_value) == GX_STATUS_SUCCESS ? i_value : -1.0;
+    case CAMERA_GV_RESEND_WINDOW:
+        return GXGetInt(_handle, GX_DS_INT_MAX_WAIT_PACKET_COUNT, &i_value) == GX_STATUS_SUCCESS ? i_value : -1.0;
+    // GigE Transport Statistics
+    case CAMERA_GV_DELIVERED_FRAME_COUNT:
+        return GXGetInt(_handle, GX_DS_INT_DELIVERED_FRAME_COUNT, &i_value) == GX_STATUS_SUCCESS ? i_value : -1.0;
+    case CAMERA_GV_LOST_FRAME_COUNT:
+        return GXGetInt(_handle, GX_DS_INT_LOST_FRAME_COUNT, &i_value) == GX_STATUS_SUCCESS ? i_value : -1.0;
+    case CAMERA_GV_INCOMPLETE_FRAME_COUNT:
+        return GXGetInt(_handle, GX_DS_INT_INCOMPLETE_FRAME_COUNT, &i_value) == GX_STATUS_SUCCESS ? i_value : -1.0;
+    case CAMERA_GV_RESEND_PACKET_COUNT:
+        return GXGetInt(_handle, GX_DS_INT_RESEND_PACKET_COUNT, &i_value) == GX_STATUS_SUCCESS ? i_value : -1.0;
     default:
         WARNING_("(galaxy) Try to set undefined variable, id: %d.", prop_id);
         return -1.0;
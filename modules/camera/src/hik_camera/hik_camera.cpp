@@ -14,6 +14,11 @@
 
 #include <opencv2/imgproc.hpp>
 
+#include "rmvl/algorithm/pretreat.hpp"
+#include "rmvl/core/lineage.hpp"
+#include "rmvl/core/memstat.hpp"
+#include "rmvl/core/timer.hpp"
+
 #include "hik_camera_impl.h"
 
 namespace rm
@@ -23,10 +28,19 @@ RMVL_IMPL_DEF(HikCamera)
 
 HikCamera::HikCamera(CameraConfig cfg, std::string_view info) : _impl(new HikCamera::Impl(cfg, info)) {}
 bool HikCamera::set(int propId, double value) { return _impl->set(propId, value); }
+bool HikCamera::apply(const CameraProfile &profile) { return _impl->apply(profile); }
 double HikCamera::get(int propId) const { return _impl->get(propId); }
 bool HikCamera::read(cv::OutputArray image) { return _impl->read(image); }
+bool HikCamera::read(cv::OutputArray image, FrameMeta &meta) { return _impl->read(image, meta); }
+void HikCamera::startCapture(std::size_t queue_size) { _impl->startCapture(queue_size); }
+void HikCamera::stopCapture() { _impl->stopCapture(); }
+bool HikCamera::tryRead(cv::OutputArray image, double *timestamp) { return _impl->tryRead(image, timestamp); }
+bool HikCamera::waitRead(cv::OutputArray image, double timeout, double *timestamp) { return _impl->waitRead(image, timeout, timestamp); }
 bool HikCamera::isOpened() const { return _impl->isOpened(); }
+bool HikCamera::setROI(const cv::Rect &roi) { return _impl->setROI(roi); }
+bool HikCamera::resetROI() { return _impl->resetROI(); }
 bool HikCamera::reconnect() { return _impl->reconnect(); }
+double HikCamera::toHostTick(double device_ts) const { return _impl->toHostTick(device_ts); }
 
 std::string HikCamera::version()
 {
@@ -49,7 +63,12 @@ static const MV_CC_PIXEL_CONVERT_PARAM MV_CC_PIXEL_CONVERT_PARAM_Init =
 
 HikCamera::Impl::Impl(CameraConfig cfg, std::string_view info) noexcept : _cfg(cfg), _info(info) { _opened = open(); }
 
-HikCamera::Impl::~Impl() noexcept { release(); }
+HikCamera::Impl::~Impl() noexcept
+{
+    // 先停止异步采集线程，再释放相机资源
+    _async.stop();
+    release();
+}
 
 void HikCamera::Impl::release() noexcept
 {
@@ -215,6 +234,10 @@ bool HikCamera::Impl::open() noexcept
             return false;
         }
     }
+    // ------------------- 批量应用参数配置集 -------------------
+    // 取流尚未开始，属性写入不触发取流重启，重连路径只需本次批量写入即可恢复全部参数
+    if (_profile.size() != 0 && !applyProfile())
+        WARNING_("(hik) Failed to apply some entries of the camera profile");
     // ----------------------- 开始取流 -----------------------
     ret = MV_CC_StartGrabbing(_handle);
     if (ret != MV_OK)
@@ -227,8 +250,15 @@ bool HikCamera::Impl::open() noexcept
 
 bool HikCamera::Impl::retrieve(cv::OutputArray image, RetrieveMode flag) noexcept
 {
+    // 取帧入口处铸造帧 ID，开启本帧的血缘跟踪
+    lineage::begin();
     // --------------------- 前置信息准备 ---------------------
     const auto &frame_info = _p_out.stFrameInfo;
+    // 捕获元数据由 SDK 已返回的帧信息块填充，无额外 SDK 调用
+    _meta.frame_id = frame_info.nFrameNum;
+    _meta.device_ts = static_cast<double>((static_cast<uint64_t>(frame_info.nDevTimeStampHigh) << 32) | frame_info.nDevTimeStampLow);
+    _meta.exposure = frame_info.fExposureTime;
+    _meta.gain = frame_info.fGain;
     // 当前格式
     auto pixel_type = frame_info.enPixelType;
     // 单通道标志位集合
@@ -246,9 +276,8 @@ bool HikCamera::Impl::retrieve(cv::OutputArray image, RetrieveMode flag) noexcep
     }
     // 通道数
     uint channel = mono_set.find(pixel_type) == mono_set.end() ? 3 : 1;
-    auto frame_size = frame_info.nWidth * frame_info.nHeight * channel;
-    if (_p_dstbuf.size() != frame_size)
-        _p_dstbuf.resize(frame_size);
+    // 从缓冲区池中取出空闲缓冲区作为输出
+    cv::Mat frame = acquireFrame(frame_info.nHeight, frame_info.nWidth, channel == 1 ? CV_8UC1 : CV_8UC3);
     // ---------------------- 解码、转码 ----------------------
     auto ret = MV_OK;
     // MV_CC_ConvertPixelType
@@ -263,13 +292,12 @@ bool HikCamera::Impl::retrieve(cv::OutputArray image, RetrieveMode flag) noexcep
         cvt_param.enDstPixelType = channel == 1            // 目标像素格式
                                        ? PixelType_Gvsp_Mono8
                                        : PixelType_Gvsp_BGR8_Packed;
-        cvt_param.pDstBuffer = _p_dstbuf.data();     // 输出数据缓存
-        cvt_param.nDstBufferSize = _p_dstbuf.size(); // 提供的输出缓冲区大小
+        cvt_param.pDstBuffer = frame.data;                                               // 输出数据缓存
+        cvt_param.nDstBufferSize = static_cast<uint>(frame.total() * frame.elemSize()); // 提供的输出缓冲区大小
         ret = MV_CC_ConvertPixelType(_handle, &cvt_param);
         if (ret == MV_OK)
         {
-            image.assign(cv::Mat(cv::Size(cvt_param.nWidth, cvt_param.nHeight),
-                                 channel == 1 ? CV_8UC1 : CV_8UC3, _p_dstbuf.data()));
+            image.assign(frame);
             return true;
         }
         ERROR_("(hik) Failed to convert the pixel type (error: \"%s\")", errorCode2Str(ret));
@@ -279,18 +307,18 @@ bool HikCamera::Impl::retrieve(cv::OutputArray image, RetrieveMode flag) noexcep
     {
         cv::Mat src_image(cv::Size(frame_info.nWidth, frame_info.nHeight), CV_8U, _p_out.pBufAddr);
         if (channel == 1)
-            image.assign(src_image);
+            src_image.copyTo(frame);
         else
         {
-            cv::Mat dst_image;
-            const static std::unordered_map<MvGvspPixelType, cv::ColorConversionCodes> type_map =
-                {{PixelType_Gvsp_BayerGR8, cv::COLOR_BayerGR2RGB},
-                 {PixelType_Gvsp_BayerRG8, cv::COLOR_BayerRG2RGB},
-                 {PixelType_Gvsp_BayerGB8, cv::COLOR_BayerGB2RGB},
-                 {PixelType_Gvsp_BayerBG8, cv::COLOR_BayerBG2RGB}};
-            cv::cvtColor(src_image, dst_image, type_map.at(pixel_type));
-            image.assign(dst_image);
+            // 原 cv::cvtColor 输出 RGB 通道序，此处交换 R、B 排布以保持通道序不变
+            const static std::unordered_map<MvGvspPixelType, BayerPattern> type_map =
+                {{PixelType_Gvsp_BayerGR8, BayerPattern::GB},
+                 {PixelType_Gvsp_BayerRG8, BayerPattern::BG},
+                 {PixelType_Gvsp_BayerGB8, BayerPattern::GR},
+                 {PixelType_Gvsp_BayerBG8, BayerPattern::RG}};
+            demosaic(src_image, frame, type_map.at(pixel_type), _cfg.demosaic_method);
         }
+        image.assign(frame);
         return true;
     }
     // 无效参数
@@ -301,12 +329,45 @@ bool HikCamera::Impl::retrieve(cv::OutputArray image, RetrieveMode flag) noexcep
     return false;
 }
 
+cv::Mat HikCamera::Impl::acquireFrame(int rows, int cols, int type) noexcept
+{
+    for (auto &frame : _frame_pool)
+        // 引用计数为 1 表示仅缓冲区池自身持有，可安全复用
+        if (frame.u != nullptr && frame.u->refcount == 1)
+        {
+            if (frame.rows != rows || frame.cols != cols || frame.type() != type)
+                frame.create(rows, cols, type);
+            RMVL_MEM_POOL_HIT_("camera/hik_frame_pool");
+            return frame;
+        }
+    // 缓冲区池的槽位由帧缓冲区分配器提供透明大页与缓存着色支持，
+    // 全幅面帧的逐像素遍历不再频繁发生 dTLB 缺失，且与二值图错开 L2 组
+    cv::Mat frame;
+    frame.allocator = framePoolAllocator();
+    frame.create(rows, cols, type);
+    RMVL_MEM_POOL_MISS_("camera/hik_frame_pool");
+    // 缓冲区池已满，分配临时缓冲区，不纳入缓冲区池
+    if (_frame_pool.size() >= MAX_POOL_SIZE)
+    {
+        DEBUG_WARNING_("(hik) Frame buffer pool exhausted, allocating a temporary buffer");
+        return frame;
+    }
+    _frame_pool.push_back(frame);
+    return frame;
+}
+
 bool HikCamera::Impl::read(cv::OutputArray image) noexcept
 {
     // 获取图像地址
     auto ret = MV_CC_GetImageBuffer(_handle, &_p_out, 1000);
     if (ret == MV_OK)
+    {
+        // 送入抓取事件，持续估计相机时钟到主机时钟的偏移与频偏
+        const auto &frame_info = _p_out.stFrameInfo;
+        double device_ts = static_cast<double>((static_cast<uint64_t>(frame_info.nDevTimeStampHigh) << 32) | frame_info.nDevTimeStampLow);
+        _clock_mapper.update(device_ts, Timer::now());
         retrieve(image, _cfg.retrieve_mode);
+    }
     else
     {
         WARNING_("(hik) No data in getting image buffer");
@@ -326,12 +387,58 @@ bool HikCamera::Impl::read(cv::OutputArray image) noexcept
     return !image.empty();
 }
 
+bool HikCamera::Impl::setROI(const cv::Rect &roi) noexcept
+{
+    MVCC_INTVALUE w_value = {0, 0, 0, 0, {0}};
+    MVCC_INTVALUE h_value = {0, 0, 0, 0, {0}};
+    if (MV_CC_GetIntValue(_handle, "Width", &w_value) != MV_OK ||
+        MV_CC_GetIntValue(_handle, "Height", &h_value) != MV_OK)
+        return false;
+    // 窗口尺寸不变时仅平移偏移量，无需停止取流
+    if (static_cast<int>(w_value.nCurValue) == roi.width && static_cast<int>(h_value.nCurValue) == roi.height)
+        return MV_CC_SetIntValue(_handle, "OffsetX", roi.x) == MV_OK &&
+               MV_CC_SetIntValue(_handle, "OffsetY", roi.y) == MV_OK;
+    // 窗口尺寸变化需要停止取流
+    auto ret = MV_CC_StopGrabbing(_handle);
+    if (ret != MV_OK)
+    {
+        ERROR_("(hik) Failed to stop grabbing (error: \"%s\")", errorCode2Str(ret));
+        return false;
+    }
+    // 先清零偏移量，避免新旧窗口组合越界
+    bool ok = MV_CC_SetIntValue(_handle, "OffsetX", 0) == MV_OK &&
+              MV_CC_SetIntValue(_handle, "OffsetY", 0) == MV_OK &&
+              MV_CC_SetIntValue(_handle, "Width", roi.width) == MV_OK &&
+              MV_CC_SetIntValue(_handle, "Height", roi.height) == MV_OK &&
+              MV_CC_SetIntValue(_handle, "OffsetX", roi.x) == MV_OK &&
+              MV_CC_SetIntValue(_handle, "OffsetY", roi.y) == MV_OK;
+    ret = MV_CC_StartGrabbing(_handle);
+    if (ret != MV_OK)
+    {
+        ERROR_("(hik) Failed to start grabbing (error: \"%s\")", errorCode2Str(ret));
+        return false;
+    }
+    return ok;
+}
+
+bool HikCamera::Impl::resetROI() noexcept
+{
+    MVCC_INTVALUE wmax_value = {0, 0, 0, 0, {0}};
+    MVCC_INTVALUE hmax_value = {0, 0, 0, 0, {0}};
+    if (MV_CC_GetIntValue(_handle, "WidthMax", &wmax_value) != MV_OK ||
+        MV_CC_GetIntValue(_handle, "HeightMax", &hmax_value) != MV_OK)
+        return false;
+    return setROI({0, 0, static_cast<int>(wmax_value.nCurValue), static_cast<int>(hmax_value.nCurValue)});
+}
+
 bool HikCamera::Impl::reconnect() noexcept
 {
     using namespace std::chrono_literals;
     INFO_("(hik) Camera device reconnect");
     release();
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // 重连后相机时钟域不再连续，重置时钟映射服务
+    _clock_mapper.reset();
     open();
     return true;
 }
@@ -22,13 +22,19 @@ class HikCamera::Impl
 {
     // -------------------------- 相机信息 --------------------------
     void *_handle;     //!< 相机设备句柄
-    CameraConfig _cfg; //!< 初始化配置模式
-    std::string _info; //!< 相机唯一标识
-    bool _opened{};    //!< 相机是否打开
+    CameraConfig _cfg;      //!< 初始化配置模式
+    std::string _info;      //!< 相机唯一标识
+    CameraProfile _profile; //!< 相机参数配置集，重连后自动重新应用
+    bool _opened{};         //!< 相机是否打开
 
     // -------------------------- 图像信息 --------------------------
-    MV_FRAME_OUT _p_out;          //!< 输出图像的数据及信息
-    std::vector<uchar> _p_dstbuf; //!< 输出数据缓存
+    MV_FRAME_OUT _p_out;                //!< 输出图像的数据及信息
+    std::vector<cv::Mat> _frame_pool;   //!< 输出图像缓冲区池，按引用计数回收复用
+    static constexpr std::size_t MAX_POOL_SIZE = 8; //!< 缓冲区池上限
+
+    FrameMeta _meta{};         //!< 最近一帧的捕获元数据，取帧时由 SDK 帧信息块填充
+    AsyncCapture _async;       //!< 异步采集预取队列
+    ClockMapper _clock_mapper; //!< 相机时钟到主机时钟的映射服务
 
 public:
     /**
@@ -51,6 +57,14 @@ public:
      */
     bool set(int propId, double value) noexcept;
 
+    /**
+     * @brief 批量应用相机参数配置集，配置集被保存并在重连后自动重新应用
+     *
+     * @param profile 相机参数配置集
+     * @return 是否全部应用成功
+     */
+    bool apply(const CameraProfile &profile) noexcept;
+
     /**
      * @brief 获取相机参数
      *
@@ -82,6 +96,31 @@ public:
      */
     bool read(cv::OutputArray image) noexcept;
 
+    //! 从相机设备中读取图像，并交付本帧的捕获元数据
+    inline bool read(cv::OutputArray image, FrameMeta &meta) noexcept
+    {
+        bool retval = read(image);
+        meta = _meta;
+        return retval;
+    }
+
+    //! 启动异步采集
+    inline void startCapture(std::size_t queue_size) { _async.start([this](cv::Mat &img) { return read(img); }, queue_size); }
+    //! 停止异步采集
+    inline void stopCapture() { _async.stop(); }
+    //! 非阻塞获取预取队列中最早的图像帧
+    inline bool tryRead(cv::OutputArray image, double *timestamp) { return _async.tryRead(image, timestamp); }
+    //! 限时等待获取预取队列中最早的图像帧
+    inline bool waitRead(cv::OutputArray image, double timeout, double *timestamp) { return _async.waitRead(image, timeout, timestamp); }
+
+    //! 设置硬件 ROI 采集窗口
+    bool setROI(const cv::Rect &roi) noexcept;
+    //! 恢复全幅面采集
+    bool resetROI() noexcept;
+
+    //! 将相机时钟域的帧时间戳换算为主机时间
+    inline double toHostTick(double device_ts) const noexcept { return _clock_mapper.toHostTick(device_ts); }
+
     //! 打开相机
     bool open() noexcept;
 
@@ -89,6 +128,22 @@ public:
     bool reconnect() noexcept;
 
 private:
+    /**
+     * @brief 从缓冲区池中取出一块空闲缓冲区，无空闲时创建新的缓冲区
+     * @brief
+     * - 返回的 `cv::Mat` 与池中共享引用计数，使用方持有期间不会被复用，
+     *   释放后自动回到池中，稳态采集循环不产生堆分配
+     *
+     * @param rows 图像行数
+     * @param cols 图像列数
+     * @param type 图像类型
+     * @return 空闲缓冲区
+     */
+    cv::Mat acquireFrame(int rows, int cols, int type) noexcept;
+
+    //! 按暂存顺序写入配置集内的全部参数
+    bool applyProfile() noexcept;
+
     //! 错误码转字符串
     const char *errorCode2Str(unsigned int code) noexcept;
 };
@@ -53,6 +53,14 @@ bool HikCamera::Impl::set(int propId, double value) noexcept
                MV_CC_SetFloatValue(_handle, "Saturation", static_cast<float>(value)) == MV_OK;
     case CAMERA_TRIGGER_SOFT:
         return MV_CC_SetCommandValue(_handle, "TriggerSoftware") == MV_OK;
+    case CAMERA_ROI_X:
+        return MV_CC_SetIntValue(_handle, "OffsetX", static_cast<unsigned int>(value)) == MV_OK;
+    case CAMERA_ROI_Y:
+        return MV_CC_SetIntValue(_handle, "OffsetY", static_cast<unsigned int>(value)) == MV_OK;
+    case CAMERA_ROI_WIDTH:
+        return MV_CC_SetIntValue(_handle, "Width", static_cast<unsigned int>(value)) == MV_OK;
+    case CAMERA_ROI_HEIGHT:
+        return MV_CC_SetIntValue(_handle, "Height", static_cast<unsigned int>(value)) == MV_OK;
     default:
         WARNING_("(hik) Try to set undefined variable, id: %d.", propId);
         return false;
@@ -91,10 +99,43 @@ double HikCamera::Impl::get(int propId) const noexcept
         return MV_CC_GetFloatValue(_handle, "TriggerDelay", &f_value) == MV_OK ? static_cast<double>(f_value.fCurValue) : -1.0;
     case CAMERA_SATURATION:
         return MV_CC_GetFloatValue(_handle, "Saturation", &f_value) == MV_OK ? static_cast<double>(f_value.fCurValue) : -1.0;
+    case CAMERA_ROI_X:
+        return MV_CC_GetIntValue(_handle, "OffsetX", &i_value) == MV_OK ? static_cast<double>(i_value.nCurValue) : -1.0;
+    case CAMERA_ROI_Y:
+        return MV_CC_GetIntValue(_handle, "OffsetY", &i_value) == MV_OK ? static_cast<double>(i_value.nCurValue) : -1.0;
+    case CAMERA_ROI_WIDTH:
+        return MV_CC_GetIntValue(_handle, "Width", &i_value) == MV_OK ? static_cast<double>(i_value.nCurValue) : -1.0;
+    case CAMERA_ROI_HEIGHT:
+        return MV_CC_GetIntValue(_handle, "Height", &i_value) == MV_OK ? static_cast<double>(i_value.nCurValue) : -1.0;
     default:
         WARNING_("(hik) Try to set undefined variable, id: %d.", propId);
         return -1.0;
     }
 }
 
+bool HikCamera::Impl::applyProfile() noexcept
+{
+    bool retval = true;
+    for (const auto &[prop_id, value] : _profile.data())
+        retval &= set(prop_id, value);
+    return retval;
+}
+
+bool HikCamera::Impl::apply(const CameraProfile &profile) noexcept
+{
+    _profile = profile;
+    if (!_opened)
+        return true;
+    // 单次停止取流的事务中批量写入，避免逐条下发时部分属性各自触发取流重启
+    if (MV_CC_StopGrabbing(_handle) != MV_OK)
+        return false;
+    bool retval = applyProfile();
+    if (MV_CC_StartGrabbing(_handle) != MV_OK)
+    {
+        ERROR_("(hik) Failed to restart grabbing after applying the camera profile");
+        return false;
+    }
+    return retval;
+}
+
 } // namespace rm
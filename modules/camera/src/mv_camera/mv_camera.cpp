@@ -12,6 +12,9 @@
 #include <thread>
 #include <opencv2/imgproc.hpp>
 
+#include "rmvl/core/init.hpp"
+#include "rmvl/core/lineage.hpp"
+
 #include "mv_camera_impl.h"
 
 namespace rm
@@ -21,9 +24,17 @@ RMVL_IMPL_DEF(MvCamera)
 
 MvCamera::MvCamera(CameraConfig init_mode, std::string_view serial) : _impl(new MvCamera::Impl(init_mode, serial)) {}
 bool MvCamera::set(int propId, double value) { return _impl->set(propId, value); }
+bool MvCamera::apply(const CameraProfile &profile) { return _impl->apply(profile); }
 double MvCamera::get(int propId) const { return _impl->get(propId); }
 bool MvCamera::isOpened() const { return _impl->isOpened(); }
 bool MvCamera::read(cv::OutputArray image) { return _impl->read(image); }
+bool MvCamera::read(cv::OutputArray image, FrameMeta &meta) { return _impl->read(image, meta); }
+void MvCamera::startCapture(std::size_t queue_size) { _impl->startCapture(queue_size); }
+void MvCamera::stopCapture() { _impl->stopCapture(); }
+bool MvCamera::tryRead(cv::OutputArray image, double *timestamp) { return _impl->tryRead(image, timestamp); }
+bool MvCamera::waitRead(cv::OutputArray image, double timeout, double *timestamp) { return _impl->waitRead(image, timeout, timestamp); }
+bool MvCamera::setROI(const cv::Rect &roi) { return _impl->setROI(roi); }
+bool MvCamera::resetROI() { return _impl->resetROI(); }
 bool MvCamera::reconnect() { return _impl->reconnect(); }
 
 std::string MvCamera::version()
@@ -33,12 +44,28 @@ std::string MvCamera::version()
     return status == CAMERA_STATUS_SUCCESS ? vstr : "unknown";
 }
 
+/**
+ * @brief 进程级初始化 SDK 库
+ * @note 库加载仅执行一次，多相机实例、断线重连均复用同一份库资源
+ */
+static void initMvSDK() noexcept
+{
+    static const bool inited = [] { return CameraSdkInit(1) == CAMERA_STATUS_SUCCESS; }();
+    (void)inited;
+}
+
+//! 注册为惰性初始化子系统，可通过 rm::init 在启动阶段预热
+static SubsystemRegistrar mv_registrar("camera/mv", [] { initMvSDK(); });
+
 MvCamera::Impl::Impl(CameraConfig init_mode, std::string_view serial) noexcept
     : _camera_id(serial), _camera_list(new tSdkCameraDevInfo[_camera_counts]),
-      _grab_mode(init_mode.grab_mode), _retrieve_mode(init_mode.retrieve_mode) { open(); }
+      _grab_mode(init_mode.grab_mode), _retrieve_mode(init_mode.retrieve_mode),
+      _demosaic_method(init_mode.demosaic_method) { open(); }
 
 MvCamera::Impl::~Impl() noexcept
 {
+    // 先停止异步采集线程，再释放相机资源
+    _async.stop();
     delete[] _camera_list;
     _camera_list = nullptr;
     delete[] _pbyOut;
@@ -48,7 +75,7 @@ MvCamera::Impl::~Impl() noexcept
 
 bool MvCamera::Impl::open() noexcept
 {
-    CameraSdkInit(1);
+    initMvSDK();
     // ----------------------- 设备枚举 -----------------------
     _status = CameraEnumerateDevice(_camera_list, &_camera_counts);
     if (_status == CAMERA_STATUS_SUCCESS)
@@ -92,6 +119,10 @@ bool MvCamera::Impl::open() noexcept
     // 整合的设备描述信息
     tSdkCameraCapbility capability;
     CameraGetCapability(_handle, &capability);
+    // ------------------- 批量应用参数配置集 -------------------
+    // SDK 尚未进入工作模式，属性写入不触发取流重启，重连路径只需本次批量写入即可恢复全部参数
+    if (_profile.size() != 0 && !applyProfile())
+        WARNING_("(mv) Failed to apply some entries of the camera profile");
     // 让SDK进入工作模式
     CameraPlay(_handle);
     if (capability.sIspCapacity.bMonoSensor)
@@ -105,6 +136,9 @@ bool MvCamera::Impl::open() noexcept
         CameraSetIspOutFormat(_handle, CAMERA_MEDIA_TYPE_BGR8);
     }
 
+    _max_width = capability.sResolutionRange.iWidthMax;
+    _max_height = capability.sResolutionRange.iHeightMax;
+
     if (_pbyOut == nullptr)
         _pbyOut = new BYTE[capability.sResolutionRange.iHeightMax * capability.sResolutionRange.iWidthMax * _channel];
 
@@ -113,23 +147,30 @@ bool MvCamera::Impl::open() noexcept
 }
 
 /**
- * @brief Media type 转换为 ColorConversionCodes
+ * @brief Media type 转换为 BayerPattern
+ * @note 原 cv::cvtColor 输出 RGB 通道序，此处交换 R、B 排布以保持通道序不变
  *
  * @param[in] media_type
- * @return ColorConversionCodes
+ * @return BayerPattern
  */
-static inline cv::ColorConversionCodes mediaType2CVType(UINT media_type)
+static inline BayerPattern mediaType2Pattern(UINT media_type)
 {
-    static std::unordered_map<UINT, cv::ColorConversionCodes> convertion =
-        {{CAMERA_MEDIA_TYPE_BAYGR8, cv::COLOR_BayerGR2RGB},
-         {CAMERA_MEDIA_TYPE_BAYRG8, cv::COLOR_BayerRG2RGB},
-         {CAMERA_MEDIA_TYPE_BAYGB8, cv::COLOR_BayerGB2RGB},
-         {CAMERA_MEDIA_TYPE_BAYBG8, cv::COLOR_BayerBG2RGB}};
+    static std::unordered_map<UINT, BayerPattern> convertion =
+        {{CAMERA_MEDIA_TYPE_BAYGR8, BayerPattern::GB},
+         {CAMERA_MEDIA_TYPE_BAYRG8, BayerPattern::BG},
+         {CAMERA_MEDIA_TYPE_BAYGB8, BayerPattern::GR},
+         {CAMERA_MEDIA_TYPE_BAYBG8, BayerPattern::RG}};
     return convertion[media_type];
 }
 
 bool MvCamera::Impl::retrieve(cv::OutputArray image) noexcept
 {
+    // 取帧入口处铸造帧 ID，开启本帧的血缘跟踪
+    lineage::begin();
+    // 捕获元数据由 SDK 已返回的帧头信息填充，无额外 SDK 调用（SDK 帧头不含帧号）
+    _meta.device_ts = static_cast<double>(_frame_info.uiTimeStamp);
+    _meta.exposure = static_cast<double>(_frame_info.uiExpTime);
+    _meta.gain = static_cast<double>(_frame_info.fAnalogGain);
     if (_channel != 1 && _channel != 3)
     {
         ERROR_("(mv) Camera image channel: %d.", _channel);
@@ -169,9 +210,7 @@ bool MvCamera::Impl::retrieve(cv::OutputArray image) noexcept
         else if (_channel == 3)
         {
             cv::Mat bgrImg;
-            // cvtColor has a good effect processed by multy-thread，which is
-            // suitable for the device with weak single core performance
-            cvtColor(bayerImg, bgrImg, mediaType2CVType(_frame_info.uiMediaType));
+            demosaic(bayerImg, bgrImg, mediaType2Pattern(_frame_info.uiMediaType), _demosaic_method);
             image.assign(bgrImg);
         }
         CameraReleaseImageBuffer(_handle, _pbyBuffer);
@@ -183,6 +222,21 @@ bool MvCamera::Impl::retrieve(cv::OutputArray image) noexcept
     return false;
 }
 
+bool MvCamera::Impl::setROI(const cv::Rect &roi) noexcept
+{
+    tSdkImageResolution resolution{};
+    resolution.iIndex = 0xff; // 自定义分辨率
+    resolution.iHOffsetFOV = roi.x;
+    resolution.iVOffsetFOV = roi.y;
+    resolution.iWidthFOV = roi.width;
+    resolution.iHeightFOV = roi.height;
+    resolution.iWidth = roi.width;
+    resolution.iHeight = roi.height;
+    return CameraSetImageResolution(_handle, &resolution) == CAMERA_STATUS_SUCCESS;
+}
+
+bool MvCamera::Impl::resetROI() noexcept { return setROI({0, 0, _max_width, _max_height}); }
+
 bool MvCamera::Impl::reconnect() noexcept
 {
     using namespace std::chrono_literals;    
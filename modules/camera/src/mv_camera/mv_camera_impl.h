@@ -26,6 +26,7 @@ class MvCamera::Impl
     // ------------------------- 相机信息 -------------------------
     bool _is_opened = false;         //!< 相机是否打开
     std::string _camera_id;          //!< 指定相机的串口号
+    CameraProfile _profile;          //!< 相机参数配置集，重连后自动重新应用
     CameraHandle _handle;            //!< 相机设备句柄
     INT _camera_counts = 8;          //!< 相机设备数量
     tSdkCameraDevInfo *_camera_list; //!< 相机设备信息列表
@@ -36,9 +37,12 @@ class MvCamera::Impl
     BYTE *_pbyOut = nullptr;     //!< 处理后的缓冲区指针
     GrabMode _grab_mode;         //!< 图像采集模式
     RetrieveMode _retrieve_mode; //!< 图像处理模式
+    DemosaicMethod _demosaic_method; //!< Bayer 去马赛克插值方式
 
     // ------------------------- 图像信息 -------------------------
     tSdkFrameHead _frame_info;   //!< 图像帧头信息
+    int _max_width{};            //!< 传感器最大宽度
+    int _max_height{};           //!< 传感器最大高度
     int _channel = 3;            //!< 通道数
     bool _auto_exposure = false; //!< 相机自动曝光
     double _exposure = 1200;     //!< 相机设备曝光时间
@@ -51,6 +55,9 @@ class MvCamera::Impl
     int _saturation = 100;       //!< 图像饱和度
     int _sharpness = 0;          //!< 图像锐度
 
+    FrameMeta _meta{};   //!< 最近一帧的捕获元数据，取帧时由 SDK 帧头信息填充
+    AsyncCapture _async; //!< 异步采集预取队列
+
 public:
     Impl(CameraConfig init_mode, std::string_view serial) noexcept;
 
@@ -59,6 +66,14 @@ public:
     //! 设置相机参数
     bool set(int propId, double value) noexcept;
 
+    /**
+     * @brief 批量应用相机参数配置集，配置集被保存并在重连后自动重新应用
+     *
+     * @param profile 相机参数配置集
+     * @return 是否全部应用成功
+     */
+    bool apply(const CameraProfile &profile) noexcept;
+
     //! 获取相机参数
     double get(int propId) const noexcept;
 
@@ -81,6 +96,28 @@ public:
         return !image.empty();
     }
 
+    //! 从相机设备中读取图像，并交付本帧的捕获元数据
+    inline bool read(cv::OutputArray image, FrameMeta &meta) noexcept
+    {
+        bool retval = read(image);
+        meta = _meta;
+        return retval;
+    }
+
+    //! 启动异步采集
+    inline void startCapture(std::size_t queue_size) { _async.start([this](cv::Mat &img) { return read(img); }, queue_size); }
+    //! 停止异步采集
+    inline void stopCapture() { _async.stop(); }
+    //! 非阻塞获取预取队列中最早的图像帧
+    inline bool tryRead(cv::OutputArray image, double *timestamp) { return _async.tryRead(image, timestamp); }
+    //! 限时等待获取预取队列中最早的图像帧
+    inline bool waitRead(cv::OutputArray image, double timeout, double *timestamp) { return _async.waitRead(image, timeout, timestamp); }
+
+    //! 设置硬件 ROI 采集窗口
+    bool setROI(const cv::Rect &roi) noexcept;
+    //! 恢复全幅面采集
+    bool resetROI() noexcept;
+
     //! 打开相机
     bool open() noexcept;
 
@@ -88,6 +125,9 @@ public:
     bool reconnect() noexcept;
 
 private:
+    //! 按暂存顺序写入配置集内的全部参数
+    bool applyProfile() noexcept;
+
     //! 释放相机资源
     inline void release() noexcept { CameraUnInit(_handle); }
 };
@@ -128,10 +128,47 @@ double MvCamera::Impl::get(int propId) const noexcept
         return static_cast<double>(_frame_info.iHeight);
     case CAMERA_FRAME_WIDTH:
         return static_cast<double>(_frame_info.iWidth);
+    case CAMERA_ROI_X:
+        tSdkImageResolution roi_x;
+        return CameraGetImageResolution(_handle, &roi_x) == CAMERA_STATUS_SUCCESS ? roi_x.iHOffsetFOV : -1;
+    case CAMERA_ROI_Y:
+        tSdkImageResolution roi_y;
+        return CameraGetImageResolution(_handle, &roi_y) == CAMERA_STATUS_SUCCESS ? roi_y.iVOffsetFOV : -1;
+    case CAMERA_ROI_WIDTH:
+        tSdkImageResolution roi_w;
+        return CameraGetImageResolution(_handle, &roi_w) == CAMERA_STATUS_SUCCESS ? roi_w.iWidthFOV : -1;
+    case CAMERA_ROI_HEIGHT:
+        tSdkImageResolution roi_h;
+        return CameraGetImageResolution(_handle, &roi_h) == CAMERA_STATUS_SUCCESS ? roi_h.iHeightFOV : -1;
     default:
         WARNING_("(mv) Try to get undefined variable, id: %d.", propId);
         return CAMERA_STATUS_FAILED;
     }
 }
 
+bool MvCamera::Impl::applyProfile() noexcept
+{
+    bool retval = true;
+    for (const auto &[prop_id, value] : _profile.data())
+        retval &= set(prop_id, value);
+    return retval;
+}
+
+bool MvCamera::Impl::apply(const CameraProfile &profile) noexcept
+{
+    _profile = profile;
+    if (!_is_opened)
+        return true;
+    // 单次暂停取流的事务中批量写入，避免逐条下发时部分属性各自触发取流重启
+    if (CameraPause(_handle) != CAMERA_STATUS_SUCCESS)
+        return false;
+    bool retval = applyProfile();
+    if (CameraPlay(_handle) != CAMERA_STATUS_SUCCESS)
+    {
+        ERROR_("(mv) Failed to restart grabbing after applying the camera profile");
+        return false;
+    }
+    return retval;
+}
+
 } // namespace rm
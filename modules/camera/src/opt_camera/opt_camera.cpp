@@ -12,6 +12,8 @@
 #include <thread>
 #include <opencv2/imgproc.hpp>
 
+#include "rmvl/core/lineage.hpp"
+
 #include "opt_camera_impl.h"
 
 namespace rm
@@ -24,24 +26,13 @@ bool OptCamera::set(int propId, double value) { return _impl->set(propId, value)
 double OptCamera::get(int propId) const { return _impl->get(propId); }
 bool OptCamera::isOpened() const { return _impl->isOpened(); }
 bool OptCamera::read(cv::OutputArray image) { return _impl->read(image); }
+bool OptCamera::read(cv::OutputArray image, FrameMeta &meta) { return _impl->read(image, meta); }
+void OptCamera::startCapture(std::size_t queue_size) { _impl->startCapture(queue_size); }
+void OptCamera::stopCapture() { _impl->stopCapture(); }
+bool OptCamera::tryRead(cv::OutputArray image, double *timestamp) { return _impl->tryRead(image, timestamp); }
+bool OptCamera::waitRead(cv::OutputArray image, double timeout, double *timestamp) { return _impl->waitRead(image, timeout, timestamp); }
 bool OptCamera::reconnect() { return _impl->reconnect(); }
 
-/**
- * @brief 将 OPT 的像素类型转换为 OpenCV 的图像类型
- *
- * @param pixel_type
- * @return cv::ColorConversionCodes
- */
-static inline cv::ColorConversionCodes optPixelType2CVType(OPT_EPixelType pixel_type)
-{
-    static std::unordered_map<OPT_EPixelType, cv::ColorConversionCodes> convertion =
-        {{gvspPixelBayGR8, cv::COLOR_BayerGR2RGB},
-         {gvspPixelBayRG8, cv::COLOR_BayerRG2RGB},
-         {gvspPixelBayGB8, cv::COLOR_BayerGB2RGB},
-         {gvspPixelBayBG8, cv::COLOR_BayerBG2RGB}};
-    return convertion[pixel_type];
-}
-
 /**
  * @brief 将 OPT 的错误码转换为字符串
  *
@@ -88,6 +79,8 @@ OptCamera::Impl::Impl(CameraConfig init_mode, std::string_view handle_info) noex
 
 OptCamera::Impl::~Impl() noexcept
 {
+    // 先停止异步采集线程，再释放相机资源
+    _async.stop();
     if (_handle != nullptr)
         release();
 }
@@ -176,6 +169,8 @@ bool OptCamera::Impl::read(cv::OutputArray image) noexcept
 
 bool OptCamera::Impl::retrieve(cv::OutputArray image) noexcept
 {
+    // 取帧入口处铸造帧 ID，开启本帧的血缘跟踪
+    lineage::begin();
     // 获取图像
     int status = OPT_GetFrame(_handle, &_src_frame, 1000);
     if (status != OPT_OK)
@@ -186,6 +181,13 @@ bool OptCamera::Impl::retrieve(cv::OutputArray image) noexcept
     }
     // 图像格式
     OPT_FrameInfo &frame_info = _src_frame.frameInfo;
+    // 传输统计：依据 GigE Vision 块 ID 连续性统计丢帧
+    ++_delivered_frames;
+    if (_last_block_id != 0 && frame_info.blockId > _last_block_id + 1)
+        _lost_frames += frame_info.blockId - _last_block_id - 1;
+    _last_block_id = frame_info.blockId;
+    // 捕获元数据由 SDK 已返回的帧信息块填充，无额外 SDK 调用（仅块 ID 可用）
+    _meta.frame_id = frame_info.blockId;
     // 像素格式
     OPT_EPixelType &pixel_format = _src_frame.frameInfo.pixelFormat;
     if (pixel_format != gvspPixelMono8 && pixel_format != gvspPixelBayRG8)
@@ -235,7 +237,8 @@ bool OptCamera::Impl::retrieve(cv::OutputArray image) noexcept
         else // gvspPixelBayRG8
         {
             cv::Mat bgr_img;
-            cvtColor(bayer_img, bgr_img, optPixelType2CVType(pixel_format));
+            // 原 cv::cvtColor 输出 RGB 通道序，BayRG8 交换 R、B 排布后即为 BG
+            demosaic(bayer_img, bgr_img, BayerPattern::BG, _init_mode.demosaic_method);
             image.assign(bgr_img);
         }
         OPT_ReleaseFrame(_handle, &_src_frame);
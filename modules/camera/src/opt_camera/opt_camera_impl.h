@@ -32,6 +32,14 @@ class OptCamera::Impl
     // 图像数据
     OPT_Frame _src_frame; //!< SDK 直接得到的 Frame 类型指针
 
+    // 传输统计
+    uint64_t _delivered_frames{}; //!< 成功交付的帧数
+    uint64_t _lost_frames{};      //!< 依据块 ID 连续性统计的丢帧数
+    uint64_t _last_block_id{};    //!< 上一帧的 GigE Vision 块 ID
+
+    FrameMeta _meta{};   //!< 最近一帧的捕获元数据，取帧时由 SDK 帧信息块填充
+    AsyncCapture _async; //!< 异步采集预取队列
+
 public:
     Impl(CameraConfig init_mode, std::string_view handle_info) noexcept;
     ~Impl() noexcept;
@@ -48,6 +56,23 @@ public:
     bool retrieve(cv::OutputArray image) noexcept;
     //! 读取图片
     bool read(cv::OutputArray image) noexcept;
+
+    //! 读取图片，并交付本帧的捕获元数据
+    inline bool read(cv::OutputArray image, FrameMeta &meta) noexcept
+    {
+        bool retval = read(image);
+        meta = _meta;
+        return retval;
+    }
+
+    //! 启动异步采集
+    inline void startCapture(std::size_t queue_size) { _async.start([this](cv::Mat &img) { return read(img); }, queue_size); }
+    //! 停止异步采集
+    inline void stopCapture() { _async.stop(); }
+    //! 非阻塞获取预取队列中最早的图像帧
+    inline bool tryRead(cv::OutputArray image, double *timestamp) { return _async.tryRead(image, timestamp); }
+    //! 限时等待获取预取队列中最早的图像帧
+    inline bool waitRead(cv::OutputArray image, double timeout, double *timestamp) { return _async.waitRead(image, timeout, timestamp); }
     //! 相机设备是否打开
     inline bool isOpened() const noexcept { return _is_opened; }
     //! 释放资源
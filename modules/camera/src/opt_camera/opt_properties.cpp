@@ -42,6 +42,17 @@ bool OptCamera::Impl::set(int propId, double value) noexcept
                OPT_SetDoubleFeatureValue(_handle, "Gamma", value) == OPT_OK;
     case CAMERA_SATURATION:
         return OPT_SetIntFeatureValue(_handle, "Saturation", static_cast<int64_t>(value)) == OPT_OK;
+    // GigE Transport
+    case CAMERA_GV_PACKET_SIZE:
+        return OPT_SetIntFeatureValue(_handle, "GevSCPSPacketSize", static_cast<int64_t>(value)) == OPT_OK;
+    case CAMERA_GV_PACKET_DELAY:
+        return OPT_SetIntFeatureValue(_handle, "GevSCPD", static_cast<int64_t>(value)) == OPT_OK;
+    case CAMERA_GV_THROUGHPUT_LIMIT:
+        if (value <= 0)
+            return OPT_SetEnumFeatureSymbol(_handle, "DeviceLinkThroughputLimitMode", "Off") == OPT_OK;
+        else
+            return OPT_SetEnumFeatureSymbol(_handle, "DeviceLinkThroughputLimitMode", "On") == OPT_OK &&
+                   OPT_SetIntFeatureValue(_handle, "DeviceLinkThroughputLimit", static_cast<int64_t>(value)) == OPT_OK;
     default:
         WARNING_("(opt) Try to set an undefined variable, propId: %d.", propId);
         return false;
@@ -70,6 +81,18 @@ double OptCamera::Impl::get(int propId) const noexcept
         return OPT_GetDoubleFeatureValue(_handle, "Gamma", &dretval) == OPT_OK ? dretval : -1.0;
     case CAMERA_SATURATION:
         return OPT_GetIntFeatureValue(_handle, "Saturation", &iretval) == OPT_OK ? static_cast<double>(iretval) : -1.0;
+    // GigE Transport
+    case CAMERA_GV_PACKET_SIZE:
+        return OPT_GetIntFeatureValue(_handle, "GevSCPSPacketSize", &iretval) == OPT_OK ? static_cast<double>(iretval) : -1.0;
+    case CAMERA_GV_PACKET_DELAY:
+        return OPT_GetIntFeatureValue(_handle, "GevSCPD", &iretval) == OPT_OK ? static_cast<double>(iretval) : -1.0;
+    case CAMERA_GV_THROUGHPUT_LIMIT:
+        return OPT_GetIntFeatureValue(_handle, "DeviceLinkThroughputLimit", &iretval) == OPT_OK ? static_cast<double>(iretval) : -1.0;
+    // GigE Transport Statistics
+    case CAMERA_GV_DELIVERED_FRAME_COUNT:
+        return static_cast<double>(_delivered_frames);
+    case CAMERA_GV_LOST_FRAME_COUNT:
+        return static_cast<double>(_lost_frames);
     default:
         WARNING_("(opt) Try to get an undefined variable, propId: %d.", propId);
         return -1.0;
@@ -42,6 +42,10 @@
 
 // 通用
 #include "core/io.hpp"
+#include "core/pipeline.hpp"
+#include "core/queue.hpp"
+#include "core/smallvec.hpp"
+#include "core/thread_pool.hpp"
 #include "core/timer.hpp"
 #include "core/util.hpp"
 #include "core/version.hpp"
@@ -0,0 +1,76 @@
+/**
+ * @file filewatch.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 文件监视服务
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "rmvldef.hpp"
+
+namespace rm
+{
+
+//! @addtogroup core
+//! @{
+
+/**
+ * @brief 文件监视服务
+ * @note
+ * - 监视注册的文件，文件被修改保存后在后台监视线程上执行对应的回调，主循环无需轮询
+ *   文件状态，稳态不产生任何系统调用
+ * @note
+ * - Linux 下基于 `inotify` 实现，监视线程空闲时阻塞于事件描述符；其余平台回退至
+ *   后台线程低频轮询文件修改时间
+ * @note
+ * - 回调在监视线程上执行，耗时回调会推迟同一监视器中其余文件的变更通知
+ */
+class RMVL_EXPORTS FileWatcher
+{
+    RMVL_IMPL;
+
+public:
+    FileWatcher();
+
+    FileWatcher(const FileWatcher &) = delete;
+    FileWatcher(FileWatcher &&) = default;
+    FileWatcher &operator=(const FileWatcher &) = delete;
+    FileWatcher &operator=(FileWatcher &&) = default;
+
+    /**
+     * @brief 注册文件监视
+     * @note 监视的是文件所在目录中的对应条目，编辑器以临时文件加重命名方式保存时
+     *       同样能够得到通知，文件本身可以尚不存在
+     *
+     * @param[in] path 文件路径，所在目录需存在
+     * @param[in] callback 文件被修改保存后在监视线程上执行的回调，参数为文件路径
+     * @return 监视标识符，可传入 @ref unwatch 取消监视，注册失败时返回 `0`
+     */
+    uint32_t watch(std::string_view path, std::function<void(const std::string &)> callback);
+
+    /**
+     * @brief 取消文件监视
+     *
+     * @param[in] id 监视标识符，参见 @ref watch
+     * @return 是否取消成功，标识符不存在时返回 `false`
+     */
+    bool unwatch(uint32_t id);
+
+    //! 获取全局文件监视服务，参数热重载等设施共享此实例
+    static FileWatcher &global();
+};
+
+//! @} core
+
+} // namespace rm
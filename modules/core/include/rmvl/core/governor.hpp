@@ -0,0 +1,157 @@
+/**
+ * @file governor.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 热状态感知的自适应速率调控服务
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "rmvldef.hpp"
+
+namespace rm
+{
+
+//! @addtogroup core
+//! @{
+
+//! 速率调控等级
+enum class ThrottleLevel : uint8_t
+{
+    Normal,  //!< 正常，各组件以满速率运行
+    Reduced, //!< 降速，温度到达降速阈值，各组件按比例降低速率
+    Minimum  //!< 最低，温度到达最低速率阈值，各组件以保底速率运行
+};
+
+/**
+ * @brief 热状态感知的自适应速率调控服务
+ * @note
+ * - 后台周期性采样热状态（Linux 下为 `/sys/class/thermal` 各热区温度的最大值），按带
+ *   回差的阈值划分调控等级，等级变化时在采样线程中依次通知所有订阅者，协调相机帧率、
+ *   识别降级与 OPC UA 定时器周期等整条管线的速率适配，温度回落后自动恢复，
+ *   可通过 `global()` 获取全局实例
+ * @note
+ * - 平台不提供热状态（或需接入功耗计等其他数据源）时，可通过 `setSource`
+ *   注入自定义采样函数
+ *
+ * @code{.cpp}
+ * auto &governor = rm::RateGovernor::global();
+ * governor.subscribe([&](rm::ThrottleLevel level) {
+ *     double scale = rm::RateGovernor::rateScale(level);
+ *     capture.set(rm::CAMERA_FPS, 200 * scale);       // 相机帧率
+ *     p_detector->setFrameBudget(5 / scale);          // 识别帧预算
+ *     timer.setPeriod(10 / scale);                    // OPC UA 定时器周期
+ * });
+ * governor.start();
+ * @endcode
+ */
+class RMVL_EXPORTS RateGovernor final
+{
+public:
+    RateGovernor() = default;
+    ~RateGovernor();
+
+    RateGovernor(const RateGovernor &) = delete;
+    RateGovernor &operator=(const RateGovernor &) = delete;
+
+    //! 获取全局实例
+    static RateGovernor &global();
+
+    /**
+     * @brief 配置调控阈值
+     * @note 等级升高在温度到达对应阈值时立即发生，等级回落需温度降至阈值以下
+     *       `hysteresis` 的回差，避免在阈值附近往复切换
+     *
+     * @param[in] reduced 降速阈值（单位：℃），默认为 `85`
+     * @param[in] minimum 最低速率阈值（单位：℃），默认为 `95`
+     * @param[in] hysteresis 等级回落的温度回差（单位：℃），默认为 `5`
+     */
+    void setThresholds(double reduced, double minimum, double hysteresis = 5.);
+
+    /**
+     * @brief 注入自定义热状态采样函数
+     * @note 返回值与调控阈值同量纲即可，接入功耗计时可将功率按同一阈值体系换算，
+     *       传入空函数时恢复默认数据源
+     *
+     * @param[in] source 采样函数，返回当前热状态（单位：℃）
+     */
+    void setSource(std::function<double()> source);
+
+    /**
+     * @brief 订阅调控等级变化
+     * @note 订阅时立即以当前等级回调一次，便于订阅者完成初始配置，此后仅在等级
+     *       变化时在采样线程中回调，回调中不可调用本服务的其他接口
+     *
+     * @param[in] callback 回调函数，形参为最新调控等级
+     * @return 订阅号，可用于退订
+     */
+    std::size_t subscribe(std::function<void(ThrottleLevel)> callback);
+
+    /**
+     * @brief 退订调控等级变化
+     *
+     * @param[in] id 订阅号
+     */
+    void unsubscribe(std::size_t id);
+
+    /**
+     * @brief 启动速率调控
+     *
+     * @param[in] period 热状态采样周期（单位：s），默认为 `1`
+     */
+    void start(double period = 1.);
+
+    //! 停止速率调控，调控等级保持停止时刻的状态
+    void stop();
+
+    //! 获取当前调控等级
+    ThrottleLevel level() const noexcept { return _level.load(std::memory_order_relaxed); }
+
+    //! 获取最近一次采样的热状态（单位：℃），尚未采样时为 `0`
+    double temperature() const noexcept { return _temperature.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 获取调控等级对应的速率比例
+     *
+     * @param[in] level 调控等级
+     * @return 速率比例，正常为 `1`，降速为 `0.75`，最低为 `0.5`
+     */
+    static double rateScale(ThrottleLevel level) noexcept;
+
+private:
+    //! 采样一次热状态并更新调控等级，等级变化时通知所有订阅者
+    void sample();
+
+    std::atomic<ThrottleLevel> _level{ThrottleLevel::Normal}; //!< 当前调控等级
+    std::atomic<double> _temperature{};                       //!< 最近一次采样的热状态
+
+    double _reduced{85.};   //!< 降速阈值
+    double _minimum{95.};   //!< 最低速率阈值
+    double _hysteresis{5.}; //!< 等级回落的温度回差
+
+    std::function<double()> _source; //!< 自定义热状态采样函数，为空时使用默认数据源
+
+    //! 订阅表 `[订阅号 : 回调函数]`
+    std::vector<std::pair<std::size_t, std::function<void(ThrottleLevel)>>> _subscribers;
+    std::size_t _next_id{}; //!< 下一个订阅号
+
+    mutable std::mutex _mtx;     //!< 保护配置与订阅表
+    std::condition_variable _cv; //!< 停止通知条件变量
+    std::thread _thread;         //!< 采样线程
+    bool _running{};             //!< 采样线程是否运行
+};
+
+//! @} core
+
+} // namespace rm
@@ -0,0 +1,77 @@
+/**
+ * @file init.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 子系统惰性初始化模块
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "rmvldef.hpp"
+
+//! @addtogroup core
+//! @{
+//! @defgroup core_init 子系统惰性初始化模块
+//! @}
+
+namespace rm
+{
+
+//! @addtogroup core_init
+//! @{
+
+/**
+ * @brief 子系统初始化注册器
+ * @brief
+ * - 各模块在命名空间作用域定义一个静态注册器对象，即可将耗时的初始化动作（如相机 SDK
+ *   的库加载）注册为按需执行的回调，注册本身为常数时间，不执行任何初始化动作，
+ *   不影响可执行文件的加载耗时
+ * @brief
+ * - 注册后的初始化动作默认推迟到首次使用（如相机首次 `open`）时执行，也可通过
+ *   rm::init 在启动阶段统一预热指定的子系统
+ */
+class RMVL_EXPORTS SubsystemRegistrar
+{
+public:
+    /**
+     * @brief 注册子系统初始化回调
+     *
+     * @param[in] name 子系统名称，建议使用 `模块/子系统` 的形式，例如 `camera/galaxy`
+     * @param[in] fn 初始化回调，要求幂等，即重复调用与调用一次效果相同
+     */
+    SubsystemRegistrar(std::string_view name, void (*fn)()) noexcept;
+};
+
+/**
+ * @brief 预热指定的子系统
+ * @brief
+ * - 按需初始化 `profile` 中列出的子系统，未列出的子系统保持未初始化状态，
+ *   仍会在首次使用时自动完成初始化，因此不调用本函数不影响功能正确性
+ * @brief
+ * - 对冷启动时间敏感的进程可在启动阶段调用本函数，仅预热将要用到的子系统，
+ *   将初始化耗时从首帧关键路径上移除
+ *
+ * @param[in] profile 待预热的子系统名称列表，传入空列表表示预热所有已注册的子系统
+ * @return 本次匹配到并已完成初始化的子系统数量
+ */
+RMVL_W std::size_t init(const std::vector<std::string> &profile = {});
+
+/**
+ * @brief 获取所有已注册的子系统名称
+ * @note 可用于审计当前进程链接了哪些含初始化动作的模块
+ *
+ * @return 子系统名称列表，按注册顺序排列
+ */
+RMVL_W std::vector<std::string> subsystems();
+
+//! @} core_init
+
+} // namespace rm
@@ -12,13 +12,19 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <cstring>
+#include <functional>
+#include <utility>
 #include <iosfwd>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "rmvldef.hpp"
+#include "util.hpp"
 
 namespace rm
 {
@@ -105,6 +111,120 @@ struct RMVL_EXPORTS_W_AG ImuData
     RMVL_W static std::vector<ImuData> read(std::string_view input_file) noexcept;
 };
 
+//! 移动位置信息列式批量容器（SoA） @see ImuBatch
+struct RMVL_EXPORTS_W_AG TranslationBatch
+{
+    RMVL_W_RW std::vector<float> x;  //!< x 方向位置、距离列 \f$p_x\f$
+    RMVL_W_RW std::vector<float> y;  //!< y 方向位置、距离列 \f$p_y\f$
+    RMVL_W_RW std::vector<float> z;  //!< z 方向位置、距离列 \f$p_z\f$
+    RMVL_W_RW std::vector<float> vx; //!< x 方向速度列 \f$v_x\f$
+    RMVL_W_RW std::vector<float> vy; //!< y 方向速度列 \f$v_y\f$
+    RMVL_W_RW std::vector<float> vz; //!< z 方向速度列 \f$v_z\f$
+};
+
+//! 转动姿态信息列式批量容器（SoA） @see ImuBatch
+struct RMVL_EXPORTS_W_AG RotationBatch
+{
+    RMVL_W_RW std::vector<float> yaw;         //!< 偏转角列
+    RMVL_W_RW std::vector<float> pitch;       //!< 俯仰角列
+    RMVL_W_RW std::vector<float> roll;        //!< 滚转角列
+    RMVL_W_RW std::vector<float> yaw_speed;   //!< 偏转角速度列
+    RMVL_W_RW std::vector<float> pitch_speed; //!< 俯仰角速度列
+    RMVL_W_RW std::vector<float> roll_speed;  //!< 滚转角速度列
+};
+
+/**
+ * @brief IMU 数据列式批量容器（SoA）
+ * @note
+ * - `std::vector<ImuData>` 上的离线分析按 12 列交错的 AoS 布局访存，只用到个别字段的
+ *   统计遍历仍按整条记录的跨度跳跃，带宽大半浪费在无关字段上；本容器将每个字段存为独立
+ *   的连续列，逐列遍历按内存带宽线性推进，也便于向量化
+ * @note
+ * - 各列长度始终一致，通过 `push_back` / `at` 与单条 rm::ImuData 互转，通过 `from` /
+ *   `toVector` 与 AoS 向量整体互转
+ */
+struct RMVL_EXPORTS_W_AG ImuBatch
+{
+    RMVL_W_RW TranslationBatch translation; //!< 移动位置数据列组
+    RMVL_W_RW RotationBatch rotation;       //!< 转动姿态数据列组
+
+    //! 样本数
+    RMVL_W std::size_t size() const noexcept { return translation.x.size(); }
+
+    /**
+     * @brief 为所有数据列预留容量
+     *
+     * @param[in] n 预期样本数
+     */
+    RMVL_W void reserve(std::size_t n);
+
+    /**
+     * @brief 在所有数据列末尾追加一条 IMU 数据
+     *
+     * @param[in] data 待追加的 IMU 数据
+     */
+    RMVL_W void push_back(const ImuData &data);
+
+    /**
+     * @brief 取出指定下标处的一条 IMU 数据
+     *
+     * @param[in] idx 样本下标
+     * @return IMU 数据
+     */
+    RMVL_W ImuData at(std::size_t idx) const;
+
+    /**
+     * @brief 由 AoS 向量整体转换为列式批量容器
+     *
+     * @param[in] datas AoS 排布的 IMU 数据
+     * @return 列式批量容器
+     */
+    RMVL_W static ImuBatch from(const std::vector<ImuData> &datas);
+
+    /**
+     * @brief 整体转换回 AoS 向量，用于喂入既有的逐条处理接口
+     *
+     * @return AoS 排布的 IMU 数据
+     */
+    RMVL_W std::vector<ImuData> toVector() const;
+
+    /**
+     * @brief 批量导出 IMU 数据列（二进制列式编码）
+     * @brief
+     * - 文件头为幻数、版本号与样本数，随后 12 个数据列依次以连续 `float` 数组整块写入，
+     *   编解码均为逐列的单次大块 I/O，百万样本级日志的吞吐由内存带宽决定
+     *
+     * @param[in] out 输出流对象
+     * @param[in] batch 待写入的 IMU 数据列
+     */
+    static void write(std::ostream &out, const ImuBatch &batch) noexcept;
+
+    /**
+     * @brief 批量导入 IMU 数据列（二进制列式解码）
+     *
+     * @param[in] in 输入流对象
+     * @param[out] batch 读取出的 IMU 数据列
+     * @return 是否读取成功，文件头校验失败或数据不完整时返回 `false`
+     */
+    static bool read(std::istream &in, ImuBatch &batch) noexcept;
+
+    /**
+     * @brief 批量导出 IMU 数据列到文件
+     *
+     * @param[in] output_file 输出文件路径，已存在时将被覆盖
+     * @param[in] batch 待写入的 IMU 数据列
+     */
+    RMVL_W static void write(std::string_view output_file, const ImuBatch &batch) noexcept;
+
+    /**
+     * @brief 从文件批量导入 IMU 数据列
+     *
+     * @param[in] input_file 输入文件路径
+     * @return 读取出的 IMU 数据列，读取失败时为空
+     */
+    RMVL_W static ImuBatch read(std::string_view input_file) noexcept;
+};
+
 /// @example samples/tutorial_code/io/sample_read_corners.cpp 角点数据读取例程
 /// @example samples/tutorial_code/io/sample_write_corners.cpp 角点数据写入例程
 
@@ -139,18 +259,296 @@ void writeCorners(std::ostream &out, const std::vector<std::vector<std::array<fl
  */
 void readCorners(std::istream &in, std::vector<std::vector<std::array<float, 2>>> &corners);
 
+/**
+ * @brief 双缓冲异步角点数据写入器
+ * @note
+ * - 比赛期间开启角点日志时，`writeCorners` 的浮点文本格式化发生在视觉主循环线程上，
+ *   每帧带来可观测的耗时。本写入器的 `write` 仅将一帧角点数据移动入前台缓冲区后立即
+ *   返回，后台线程以缓冲区交换取走积压的若干帧，统一完成文本格式化并以单次大块写入
+ *   落盘，热路径开销仅为一次移动与缓冲区交换
+ * @note
+ * - 文件格式与 `writeCorners` 一致，可由 `readCorners` 读取；析构时完成缓冲区排空与
+ *   落盘
+ */
+class RMVL_EXPORTS CornerWriter
+{
+    RMVL_IMPL;
+
+public:
+    /**
+     * @brief 创建双缓冲异步角点数据写入器
+     *
+     * @param[in] path 输出文件路径，已存在时将被覆盖
+     */
+    explicit CornerWriter(std::string_view path);
+
+    CornerWriter(const CornerWriter &) = delete;
+    CornerWriter(CornerWriter &&) = default;
+    CornerWriter &operator=(const CornerWriter &) = delete;
+    CornerWriter &operator=(CornerWriter &&) = default;
+
+    /**
+     * @brief 写入一帧角点数据（仅移动入前台缓冲区，格式化与落盘由后台线程完成）
+     *
+     * @param[in] corners 待写入的角点数据，写入后原对象被移空
+     * @return 是否入队成功，文件未打开时返回 `false`
+     */
+    bool write(std::vector<std::vector<std::array<float, 2>>> &&corners);
+
+    //! 已入队的帧数
+    std::size_t size() const;
+};
+
+//////////////////////////////////// IMU 历史缓存 ////////////////////////////////////
+
+/**
+ * @brief IMU 历史环形缓存
+ * @note
+ * - 单写多读无锁设计：写线程（串口接收）调用 `push` 按时间戳递增追加样本，任意线程可
+ *   并发调用 `query` 获取指定时间戳处线性插值后的 IMU 数据，用于将相机帧与其真实曝光
+ *   时刻的位姿对齐
+ * @note
+ * - `push` 仅允许单一线程调用，`query` 无并发限制
+ */
+class RMVL_EXPORTS ImuHistory
+{
+    RMVL_IMPL;
+
+public:
+    /**
+     * @brief 创建 IMU 历史环形缓存
+     *
+     * @param[in] capacity 缓存样本容量，向上取整至 2 的幂
+     */
+    explicit ImuHistory(std::size_t capacity = 1024);
+
+    ImuHistory(const ImuHistory &) = delete;
+    ImuHistory(ImuHistory &&) = default;
+    ImuHistory &operator=(const ImuHistory &) = delete;
+    ImuHistory &operator=(ImuHistory &&) = default;
+
+    /**
+     * @brief 追加 IMU 样本（仅单写线程）
+     *
+     * @param[in] tick 采样时间戳，需严格递增
+     * @param[in] imu IMU 数据
+     */
+    void push(double tick, const ImuData &imu);
+
+    /**
+     * @brief 查询指定时间戳处的 IMU 数据
+     * @note 时间戳落在两个样本之间时返回线性插值结果，早于最旧样本或晚于最新样本时
+     *       返回边界样本
+     *
+     * @param[in] tick 查询时间戳
+     * @return IMU 数据，缓存为空时返回 `std::nullopt`
+     */
+    std::optional<ImuData> query(double tick) const;
+
+    //! 当前缓存的样本数
+    std::size_t size() const;
+};
+
+///////////////////////////////////// 二进制记录 /////////////////////////////////////
+
+/**
+ * @brief 单条记录的只读视图
+ * @note 角点与帧数据负载为指向内存映射文件的零拷贝跨度，生命周期与对应的 rm::RecordReader 一致
+ */
+struct RecordView
+{
+    double tick{};                                                              //!< 记录时间戳
+    ImuData imu{};                                                              //!< IMU 数据
+    std::vector<std::pair<const std::array<float, 2> *, std::size_t>> corners; //!< 角点组跨度列表，每组为（首地址, 点数）
+    const uint8_t *payload{};                                                   //!< 帧数据负载首地址，无负载时为空
+    std::size_t payload_size{};                                                 //!< 帧数据负载长度
+};
+
+/**
+ * @brief 二进制记录写入器
+ * @note
+ * - 以分块二进制格式逐条写入时间戳、IMU 数据、角点与任意帧数据负载，文件尾部附有
+ *   逐记录索引，供 rm::RecordReader 内存映射后随机访问
+ * @note
+ * - 析构时完成索引与文件头的写入，写入过程中断的文件无法读取
+ */
+class RMVL_EXPORTS RecordWriter
+{
+    RMVL_IMPL;
+
+public:
+    /**
+     * @brief 创建二进制记录文件
+     *
+     * @param[in] path 文件路径，已存在时将被覆盖
+     */
+    explicit RecordWriter(std::string_view path);
+
+    RecordWriter(const RecordWriter &) = delete;
+    RecordWriter(RecordWriter &&) = default;
+    RecordWriter &operator=(const RecordWriter &) = delete;
+    RecordWriter &operator=(RecordWriter &&) = default;
+
+    /**
+     * @brief 追加一条记录
+     *
+     * @param[in] tick 记录时间戳
+     * @param[in] imu IMU 数据
+     * @param[in] corners 角点数据
+     * @param[in] payload 帧数据负载首地址，可为空
+     * @param[in] payload_size 帧数据负载长度
+     */
+    void write(double tick, const ImuData &imu, const std::vector<std::vector<std::array<float, 2>>> &corners,
+               const void *payload = nullptr, std::size_t payload_size = 0);
+
+    //! 已写入的记录条数
+    std::size_t size() const;
+};
+
+/**
+ * @brief 二进制记录读取器
+ * @note
+ * - 将 rm::RecordWriter 生成的记录文件整体内存映射，`at()` 仅解析定长头部并返回指向
+ *   映射内存的零拷贝视图，重放速度由磁盘 I/O 决定
+ */
+class RMVL_EXPORTS RecordReader
+{
+    RMVL_IMPL;
+
+public:
+    /**
+     * @brief 打开二进制记录文件
+     *
+     * @param[in] path 文件路径
+     */
+    explicit RecordReader(std::string_view path);
+
+    RecordReader(const RecordReader &) = delete;
+    RecordReader(RecordReader &&) = default;
+    RecordReader &operator=(const RecordReader &) = delete;
+    RecordReader &operator=(RecordReader &&) = default;
+
+    //! 记录条数
+    std::size_t size() const;
+
+    /**
+     * @brief 随机访问指定记录
+     *
+     * @param[in] idx 记录下标
+     * @return 记录的只读视图
+     */
+    RecordView at(std::size_t idx) const;
+};
+
+///////////////////////////////////// 帧数据日志 /////////////////////////////////////
+
+//! 帧日志中的单帧数据
+struct JournalFrame
+{
+    double tick{};             //!< 帧时间戳
+    std::vector<uint8_t> data; //!< 解压后的帧数据
+};
+
+/**
+ * @brief LZ4 压缩异步帧日志写入器
+ * @note
+ * - 采集线程调用 `write` 仅将帧复制到预分配的环形队列后立即返回，后台线程完成 LZ4
+ *   块压缩与追加落盘，文件尾部附逐帧索引（文件偏移、压缩前后长度与时间戳），供
+ *   rm::FrameJournalReader 随机访问
+ * @note
+ * - 队列满（落盘跟不上采集）时 `write` 丢弃当前帧并计数，采集线程永不阻塞；
+ *   不可压缩的帧按原样存储，避免无收益的膨胀
+ * @note
+ * - 析构时完成队列排空与索引写入，写入过程中断的文件无法读取
+ */
+class RMVL_EXPORTS FrameJournal
+{
+    RMVL_IMPL;
+
+public:
+    /**
+     * @brief 创建帧日志文件
+     *
+     * @param[in] path 文件路径，已存在时将被覆盖
+     * @param[in] frame_capacity 单帧最大长度（字节），默认 `4 MiB`
+     * @param[in] slots 环形队列槽位个数，决定落盘抖动时允许积压的帧数，默认 `16`
+     */
+    explicit FrameJournal(std::string_view path, std::size_t frame_capacity = 4 * 1024 * 1024, std::size_t slots = 16);
+
+    FrameJournal(const FrameJournal &) = delete;
+    FrameJournal(FrameJournal &&) = default;
+    FrameJournal &operator=(const FrameJournal &) = delete;
+    FrameJournal &operator=(FrameJournal &&) = default;
+
+    /**
+     * @brief 追加一帧数据（仅复制入队，压缩与落盘由后台线程完成）
+     *
+     * @param[in] tick 帧时间戳
+     * @param[in] data 帧数据首地址
+     * @param[in] size 帧数据长度（字节）
+     * @return 是否入队成功，队列已满或长度超出单帧容量时返回 `false`
+     */
+    bool write(double tick, const void *data, std::size_t size);
+
+    //! 已入队的帧数
+    std::size_t size() const;
+
+    //! 因队列满而丢弃的帧数
+    std::size_t dropped() const;
+};
+
+/**
+ * @brief 帧日志读取器
+ * @note 将 rm::FrameJournal 生成的日志文件整体内存映射，`at()` 按逐帧索引定位并解压
+ *       指定帧，各帧可乱序随机访问
+ */
+class RMVL_EXPORTS FrameJournalReader
+{
+    RMVL_IMPL;
+
+public:
+    /**
+     * @brief 打开帧日志文件
+     *
+     * @param[in] path 文件路径
+     */
+    explicit FrameJournalReader(std::string_view path);
+
+    FrameJournalReader(const FrameJournalReader &) = delete;
+    FrameJournalReader(FrameJournalReader &&) = default;
+    FrameJournalReader &operator=(const FrameJournalReader &) = delete;
+    FrameJournalReader &operator=(FrameJournalReader &&) = default;
+
+    //! 帧数
+    std::size_t size() const;
+
+    /**
+     * @brief 随机访问并解压指定帧
+     *
+     * @param[in] idx 帧下标
+     * @return 解压后的帧数据
+     */
+    JournalFrame at(std::size_t idx) const;
+};
+
 ///////////////////////////////////// 串口通信 /////////////////////////////////////
 
 enum class BaudRate : uint8_t
 {
-    BR_1200,   //!< 波特率 1200
-    BR_2400,   //!< 波特率 2400
-    BR_4800,   //!< 波特率 4800
-    BR_9600,   //!< 波特率 9600
-    BR_19200,  //!< 波特率 19200
-    BR_38400,  //!< 波特率 38400
-    BR_57600,  //!< 波特率 57600
-    BR_115200, //!< 波特率 115200
+    BR_1200,    //!< 波特率 1200
+    BR_2400,    //!< 波特率 2400
+    BR_4800,    //!< 波特率 4800
+    BR_9600,    //!< 波特率 9600
+    BR_19200,   //!< 波特率 19200
+    BR_38400,   //!< 波特率 38400
+    BR_57600,   //!< 波特率 57600
+    BR_115200,  //!< 波特率 115200
+    BR_230400,  //!< 波特率 230400
+    BR_460800,  //!< 波特率 460800
+    BR_921600,  //!< 波特率 921600
+    BR_1000000, //!< 波特率 1000000
+    BR_2000000, //!< 波特率 2000000
+    BR_3000000, //!< 波特率 3000000
 };
 
 //! 串口数据读取模式
@@ -160,11 +558,25 @@ enum class SerialReadMode : uint8_t
     NONBLOCK //!< 非阻塞模式，即读取数据时不会等待，如果没有数据到来则立即返回 `-1`
 };
 
+//! 串口数据写入模式
+enum class SerialWriteMode : uint8_t
+{
+    SYNC, //!< 同步模式，即 `write` 调用直接写入串口，等待写入完成后返回
+    ASYNC //!< 异步模式，即 `write` 调用仅将数据复制到预分配的环形队列后立即返回，由后台线程完成写入
+};
+
 //! 串口通信模式
 struct RMVL_EXPORTS_W_AG SerialPortMode
 {
-    RMVL_W_RW BaudRate baud_rate{BaudRate::BR_115200};         //!< 波特率
-    RMVL_W_RW SerialReadMode read_mode{SerialReadMode::BLOCK}; //!< 读取模式
+    RMVL_W_RW BaudRate baud_rate{BaudRate::BR_115200};           //!< 波特率
+    RMVL_W_RW SerialReadMode read_mode{SerialReadMode::BLOCK};   //!< 读取模式
+    RMVL_W_RW SerialWriteMode write_mode{SerialWriteMode::SYNC}; //!< 写入模式
+    /**
+     * @brief 自定义波特率 /Bd，上限 3000000
+     * @note 非 `0` 时覆盖 `baud_rate`，Linux 下经 `termios2` 的 `BOTHER` 标志设置任意
+     *       非标准波特率，Windows 下直接写入 DCB
+     */
+    RMVL_W_RW uint32_t custom_baud{};
 };
 
 //! 串行接口通信库
@@ -175,6 +587,9 @@ class RMVL_EXPORTS_W SerialPort
 public:
     /**
      * @brief 构造新 SerialPort 对象
+     * @note Linux 下打开串口时自动启用内核低时延模式（`ASYNC_LOW_LATENCY`），将 FTDI
+     *       等 USB 转串口适配器的延迟定时器从默认 16ms 降至 1ms，非 USB 转串口设备不
+     *       支持该配置时忽略，不影响通信
      *
      * @param[in] device 设备名
      * @param[in] mode 串口通信模式
@@ -269,6 +684,119 @@ public:
     template <typename Tp, typename Enable = std::enable_if_t<std::is_aggregate_v<Tp> || std::is_same_v<Tp, std::string_view>>>
     SerialPort &operator<<(const Tp &data) { return (this->write(data), *this); }
 
+    /**
+     * @brief 从串口读取数据到聚合体中（`noexcept` 快速路径）
+     * @brief
+     * - 与 `read(head_flag, tail_flag, data)` 的定界逻辑一致，但以 rm::expected 返回结果，
+     *   区分 I/O 失败、无数据与无有效数据帧三种情况，错误检查编译为一次分支判断
+     * @brief
+     * - 失败诊断经 rm::diagLog 记入环形缓冲，链路抖动期间逐帧读取不触发任何格式化输出，
+     *   诊断信息可在空闲时经 rm::diagDrain 统一取出
+     *
+     * @tparam Tp 读取到聚合体的类型
+     * @param[in] head_flag 头帧
+     * @param[in] tail_flag 尾帧
+     * @return 读取的聚合体数据，或一种 rm::Errc 错误码
+     */
+    template <typename Tp, typename Enable = std::enable_if_t<std::is_aggregate_v<Tp>>>
+    expected<Tp> tryRead(uint8_t head_flag, uint8_t tail_flag) noexcept
+    {
+        constexpr int LENGTH = 512, SIZE = sizeof(Tp);
+        uint8_t buffer[LENGTH]{};
+        auto len_result = fdreadQuiet(buffer, LENGTH);
+        if (len_result < 0)
+            return unexpected{Errc::IOError};
+        if (len_result == 0)
+            return unexpected{Errc::Timeout};
+        Tp data{};
+        bool found{};
+        for (long int i = 0; (i + SIZE + 1) < len_result; i++)
+            if (buffer[i] == head_flag && buffer[i + SIZE + 1] == tail_flag)
+            {
+                std::memcpy(&data, &buffer[i + 1], SIZE);
+                found = true;
+            }
+        if (!found)
+            return (diagLog(Errc::InvFmt, "SerialPort::tryRead: no valid frame"), unexpected{Errc::InvFmt});
+        return data;
+    }
+
+    /**
+     * @brief 不带头尾标志的数据读取（`noexcept` 快速路径） @see tryRead(uint8_t, uint8_t)
+     *
+     * @tparam Tp 读取到聚合体的类型
+     * @return 读取的聚合体数据，或一种 rm::Errc 错误码
+     */
+    template <typename Tp, typename Enable = std::enable_if_t<std::is_aggregate_v<Tp>>>
+    expected<Tp> tryRead() noexcept
+    {
+        constexpr int MAX_LENGTH = 512, MAX_READ_DST = sizeof(Tp);
+        char buffer[MAX_LENGTH]{};
+        auto len_result = fdreadQuiet(buffer, MAX_LENGTH);
+        if (len_result < 0)
+            return unexpected{Errc::IOError};
+        if (len_result == 0)
+            return unexpected{Errc::Timeout};
+        if (len_result > MAX_READ_DST)
+            return (diagLog(Errc::BadSize, "SerialPort::tryRead: frame too long"), unexpected{Errc::BadSize});
+        Tp data{};
+        std::memcpy(&data, buffer, len_result);
+        return data;
+    }
+
+    /**
+     * @brief 数据写入串口（`noexcept` 快速路径）
+     * @brief
+     * - 与 `write(data)` 行为一致，但以 rm::expected 返回结果，失败诊断经 rm::diagLog
+     *   记入环形缓冲，不在热路径上触发格式化输出
+     *
+     * @tparam Tp 写入聚合体的类型
+     * @param[in] data 要写入的聚合体
+     * @return 成功状态，或一种 rm::Errc 错误码
+     */
+    template <typename Tp, typename Enable = std::enable_if_t<std::is_aggregate_v<Tp>>>
+    expected<void> tryWrite(const Tp &data) noexcept
+    {
+        if (sizeof(data) == fdwriteQuiet(&data, sizeof(data)))
+            return {};
+        return unexpected{Errc::IOError};
+    }
+
+    /**
+     * @brief 注册数据帧回调，启动事件驱动读取
+     * @brief
+     * - 后台线程使用 I/O 多路复用等待数据到来，完成头尾帧定界后将完整的数据帧通过回调交付，
+     *   无需在自旋循环中轮询 `read()`
+     * @note 事件驱动读取期间不要再调用 `read` 系列方法，回调在后台线程中执行
+     *
+     * @tparam Tp 数据帧聚合体的类型
+     * @param[in] head_flag 头帧
+     * @param[in] tail_flag 尾帧
+     * @param[in] callback 数据帧回调函数
+     */
+    template <typename Tp, typename Enable = std::enable_if_t<std::is_aggregate_v<Tp>>>
+    void startReadEvent(uint8_t head_flag, uint8_t tail_flag, const std::function<void(const Tp &)> &callback)
+    {
+        startReadEvent(head_flag, tail_flag, sizeof(Tp), [callback](const uint8_t *data) {
+            Tp val;
+            std::memcpy(&val, data, sizeof(Tp));
+            callback(val);
+        });
+    }
+
+    /**
+     * @brief 注册数据帧回调，启动事件驱动读取（原始字节形式）
+     *
+     * @param[in] head_flag 头帧
+     * @param[in] tail_flag 尾帧
+     * @param[in] length 数据帧长度（不含头尾帧）
+     * @param[in] callback 数据帧回调函数，形参为指向数据帧首字节（头帧之后）的指针
+     */
+    void startReadEvent(uint8_t head_flag, uint8_t tail_flag, std::size_t length, const std::function<void(const uint8_t *)> &callback);
+
+    //! 停止事件驱动读取
+    void stopReadEvent();
+
     //! 串口是否打开
     bool isOpened() const;
 
@@ -280,6 +808,12 @@ private:
 
     //! 读取数据（基于文件描述符）
     long int fdread(void *data, size_t len);
+
+    //! 写入数据，失败诊断记入环形缓冲而非直接输出
+    long int fdwriteQuiet(const void *data, size_t len) noexcept;
+
+    //! 读取数据，失败诊断记入环形缓冲而非直接输出
+    long int fdreadQuiet(void *data, size_t len) noexcept;
 };
 
 //////////////////////////////////// 进程间通信 ////////////////////////////////////
@@ -381,6 +915,458 @@ public:
     inline PipeClient &operator<<(std::string_view data) { return (write(data), *this); }
 };
 
+/**
+ * @brief 共享内存传输服务端
+ * @brief
+ * - 与 rm::PipeServer 具备一致的 `read` / `write` 接口，但数据通过共享内存传递，
+ *   不经过内核缓冲区复制，适合在同一主机的进程间传输图像帧等大块数据
+ * @brief
+ * - 收发双向各占一条顺序锁（seqlock）保护的通道：写入方通过 @ref borrow / @ref commit
+ *   直接在共享内存中就地构造数据（零拷贝），读取方在读出后校验序号以发现并发覆盖
+ * @note 单写者单读者模型，数据以「最新帧获胜」的方式覆盖，读取方跟不上时旧数据被直接覆盖
+ */
+class RMVL_EXPORTS_W ShmServer
+{
+    RMVL_IMPL;
+
+public:
+    ShmServer(const ShmServer &) = delete;
+    ShmServer(ShmServer &&) = default;
+    ShmServer &operator=(const ShmServer &) = delete;
+    ShmServer &operator=(ShmServer &&) = default;
+
+    /**
+     * @brief 创建新的共享内存段并初始化收发通道，销毁时自动移除该共享内存段
+     *
+     * @param[in] name 共享内存名称，长度不超过 256 个字符
+     * @param[in] capacity 单条通道的容量（字节），默认 `4 MiB`
+     */
+    RMVL_W ShmServer(std::string_view name, std::size_t capacity = 4 * 1024 * 1024);
+
+    /**
+     * @brief 从接收通道读取数据
+     *
+     * @param[out] data 读取的数据
+     * @return 是否读取成功，无新数据或读取期间数据被覆盖时返回 `false`
+     */
+    bool read(std::string &data);
+
+    //! @cond
+    RMVL_W inline std::tuple<bool, std::string> read()
+    {
+        std::string data;
+        return {read(data), data};
+    }
+    //! @endcond
+
+    /**
+     * @brief 向发送通道写入数据
+     *
+     * @param[in] data 待写入的数据
+     * @return 是否写入成功
+     */
+    RMVL_W bool write(std::string_view data);
+
+    /**
+     * @brief 借出发送通道的写缓冲区，供调用方就地构造数据（零拷贝写入）
+     * @note 借出后必须调用 @ref commit 提交，借出期间读取方会放弃读取
+     *
+     * @return 指向写缓冲区首字节的指针，容量为构造时指定的通道容量
+     */
+    void *borrow();
+
+    /**
+     * @brief 提交借出的写缓冲区中的数据
+     *
+     * @param[in] len 有效数据长度（字节）
+     * @return 是否提交成功
+     */
+    bool commit(std::size_t len);
+
+    //! 单条通道的容量（字节）
+    std::size_t capacity() const;
+};
+
+//! 共享内存传输客户端 @see ShmServer
+class RMVL_EXPORTS_W ShmClient
+{
+    RMVL_IMPL;
+
+public:
+    ShmClient(const ShmClient &) = delete;
+    ShmClient(ShmClient &&) = default;
+    ShmClient &operator=(const ShmClient &) = delete;
+    ShmClient &operator=(ShmClient &&) = default;
+
+    /**
+     * @brief 打开存在的共享内存段
+     *
+     * @param[in] name 共享内存名称
+     */
+    RMVL_W ShmClient(std::string_view name);
+
+    /**
+     * @brief 从接收通道读取数据
+     *
+     * @param[out] data 读取的数据
+     * @return 是否读取成功，无新数据或读取期间数据被覆盖时返回 `false`
+     */
+    bool read(std::string &data);
+
+    //! @cond
+    RMVL_W inline std::tuple<bool, std::string> read()
+    {
+        std::string data;
+        return {read(data), data};
+    }
+    //! @endcond
+
+    /**
+     * @brief 向发送通道写入数据
+     *
+     * @param[in] data 待写入的数据
+     * @return 是否写入成功
+     */
+    RMVL_W bool write(std::string_view data);
+
+    //! 借出发送通道的写缓冲区 @see ShmServer::borrow
+    void *borrow();
+
+    //! 提交借出的写缓冲区中的数据 @see ShmServer::commit
+    bool commit(std::size_t len);
+
+    //! 单条通道的容量（字节）
+    std::size_t capacity() const;
+};
+
+/**
+ * @brief 共享内存广播服务端
+ * @brief
+ * - rm::PipeServer 与 rm::ShmServer 均服务单一对端，同一份数据分发给多个本机进程时
+ *   需要建立多条通道并重复写入；本类将数据写入共享内存中的单一环形槽位队列，
+ *   一次写入即可供任意数量的 rm::BroadcastClient 订阅读取，无额外拷贝
+ * @brief
+ * - 每个订阅者持有独立的读取游标，互不影响；读取跟不上写入的慢订阅者按槽位粒度
+ *   跳过被覆盖的旧数据，不会阻塞写入方与其他订阅者
+ * @note 单写者多读者模型，广播方向为服务端 \f$\to\f$ 客户端的单向通道
+ */
+class RMVL_EXPORTS_W BroadcastServer
+{
+    RMVL_IMPL;
+
+public:
+    BroadcastServer(const BroadcastServer &) = delete;
+    BroadcastServer(BroadcastServer &&) = default;
+    BroadcastServer &operator=(const BroadcastServer &) = delete;
+    BroadcastServer &operator=(BroadcastServer &&) = default;
+
+    /**
+     * @brief 创建新的共享内存段并初始化环形槽位队列，销毁时自动移除该共享内存段
+     *
+     * @param[in] name 共享内存名称，长度不超过 256 个字符
+     * @param[in] slot_capacity 单个槽位的容量（字节），即单条数据的最大长度，默认 `64 KiB`
+     * @param[in] slots 槽位个数，决定慢订阅者允许的最大滞后量，默认 `64`
+     */
+    RMVL_W BroadcastServer(std::string_view name, std::size_t slot_capacity = 64 * 1024, std::size_t slots = 64);
+
+    /**
+     * @brief 向环形槽位队列广播数据
+     *
+     * @param[in] data 待广播的数据
+     * @return 是否写入成功
+     */
+    RMVL_W bool write(std::string_view data);
+
+    /**
+     * @brief 借出下一个槽位的写缓冲区，供调用方就地构造数据（零拷贝写入）
+     * @note 借出后必须调用 @ref commit 提交，借出期间订阅者会放弃读取该槽位
+     *
+     * @return 指向写缓冲区首字节的指针，容量为构造时指定的槽位容量
+     */
+    void *borrow();
+
+    /**
+     * @brief 提交借出的写缓冲区中的数据
+     *
+     * @param[in] len 有效数据长度（字节）
+     * @return 是否提交成功
+     */
+    bool commit(std::size_t len);
+
+    //! 单个槽位的容量（字节）
+    std::size_t capacity() const;
+};
+
+//! 共享内存广播订阅客户端 @see BroadcastServer
+class RMVL_EXPORTS_W BroadcastClient
+{
+    RMVL_IMPL;
+
+public:
+    BroadcastClient(const BroadcastClient &) = delete;
+    BroadcastClient(BroadcastClient &&) = default;
+    BroadcastClient &operator=(const BroadcastClient &) = delete;
+    BroadcastClient &operator=(BroadcastClient &&) = default;
+
+    /**
+     * @brief 打开存在的共享内存段并订阅广播
+     *
+     * @param[in] name 共享内存名称
+     */
+    RMVL_W BroadcastClient(std::string_view name);
+
+    /**
+     * @brief 按写入顺序读取下一条广播数据
+     * @note 读取滞后超出槽位个数时自动跳过已被覆盖的旧数据，跳过量可通过 @ref skipped 查询
+     *
+     * @param[out] data 读取的数据
+     * @return 是否读取成功，无新数据时返回 `false`
+     */
+    bool read(std::string &data);
+
+    //! @cond
+    RMVL_W inline std::tuple<bool, std::string> read()
+    {
+        std::string data;
+        return {read(data), data};
+    }
+    //! @endcond
+
+    //! 因读取滞后而跳过的数据条数
+    RMVL_W std::size_t skipped() const;
+};
+
+//////////////////////////////////// 跨主机消息链路 ////////////////////////////////////
+
+/**
+ * @brief TCP 消息链路服务端
+ * @brief
+ * - 与 rm::PipeServer 具备一致的 `read` / `write` 接口，但数据经由 TCP 在主机间传递，
+ *   用于流水线跨主机划分等场景：采集主机将帧或阶段边界数据集写入链路，计算主机在对端
+ *   读出并重组，消息边界由链路内部的长度前缀保持
+ * @brief
+ * - 背压由 TCP 流量控制给出：对端消费跟不上时发送缓冲区充满，`write` 阻塞至对端腾出
+ *   窗口，在途数据量有界，发送方的阻塞即为背压信号
+ * @note 单对端模型，构造时阻塞等待对端连接，对端断开后 `read` / `write` 返回 `false`
+ */
+class RMVL_EXPORTS_W TcpServer
+{
+    RMVL_IMPL;
+
+public:
+    TcpServer(const TcpServer &) = delete;
+    TcpServer(TcpServer &&) = default;
+    TcpServer &operator=(const TcpServer &) = delete;
+    TcpServer &operator=(TcpServer &&) = default;
+
+    /**
+     * @brief 创建 TCP 消息链路服务端，阻塞等待对端连接
+     *
+     * @param[in] port 监听端口号
+     */
+    RMVL_W TcpServer(uint16_t port);
+
+    /**
+     * @brief 从链路读取一条完整消息，无消息时阻塞
+     *
+     * @param[out] data 读取的消息
+     * @return 是否读取成功，对端断开后返回 `false`
+     */
+    bool read(std::string &data);
+
+    //! @cond
+    RMVL_W inline std::tuple<bool, std::string> read()
+    {
+        std::string data;
+        return {read(data), data};
+    }
+    //! @endcond
+
+    inline TcpServer &operator>>(std::string &data) { return (read(data), *this); }
+
+    /**
+     * @brief 向链路写入一条完整消息，对端消费跟不上时阻塞（背压）
+     *
+     * @param[in] data 待写入的消息
+     * @return 是否写入成功，对端断开后返回 `false`
+     */
+    RMVL_W bool write(std::string_view data);
+
+    inline TcpServer &operator<<(std::string_view data) { return (write(data), *this); }
+};
+
+//! TCP 消息链路客户端 @see TcpServer
+class RMVL_EXPORTS_W TcpClient
+{
+    RMVL_IMPL;
+
+public:
+    TcpClient(const TcpClient &) = delete;
+    TcpClient(TcpClient &&) = default;
+    TcpClient &operator=(const TcpClient &) = delete;
+    TcpClient &operator=(TcpClient &&) = default;
+
+    /**
+     * @brief 连接指定主机上的 TCP 消息链路服务端
+     *
+     * @param[in] host 服务端主机地址，如 `"192.168.1.10"`
+     * @param[in] port 服务端端口号
+     */
+    RMVL_W TcpClient(std::string_view host, uint16_t port);
+
+    /**
+     * @brief 从链路读取一条完整消息，无消息时阻塞
+     *
+     * @param[out] data 读取的消息
+     * @return 是否读取成功，对端断开后返回 `false`
+     */
+    bool read(std::string &data);
+
+    //! @cond
+    RMVL_W inline std::tuple<bool, std::string> read()
+    {
+        std::string data;
+        return {read(data), data};
+    }
+    //! @endcond
+
+    inline TcpClient &operator>>(std::string &data) { return (read(data), *this); }
+
+    /**
+     * @brief 向链路写入一条完整消息，对端消费跟不上时阻塞（背压）
+     *
+     * @param[in] data 待写入的消息
+     * @return 是否写入成功，对端断开后返回 `false`
+     */
+    RMVL_W bool write(std::string_view data);
+
+    inline TcpClient &operator<<(std::string_view data) { return (write(data), *this); }
+};
+
+//////////////////////////////////// 遥测组播 ////////////////////////////////////
+
+//! 遥测样本 @see TelemetrySubscriber
+struct TelemetrySample
+{
+    uint16_t id{};    //!< 通道标识
+    std::string data; //!< 样本数据
+
+    /**
+     * @brief 将样本数据解释为指定的平凡可复制结构体
+     *
+     * @tparam Tp 结构体类型，需可平凡复制
+     * @param[out] out 解释结果
+     * @return 是否成功，样本数据长度与结构体大小不一致时返回 `false`
+     */
+    template <typename Tp>
+    bool get(Tp &out) const
+    {
+        static_assert(std::is_trivially_copyable_v<Tp>, "\"Tp\" must be trivially copyable");
+        if (data.size() != sizeof(Tp))
+            return false;
+        std::memcpy(&out, data.data(), sizeof(Tp));
+        return true;
+    }
+};
+
+/**
+ * @brief UDP 组播遥测发布端
+ * @brief
+ * - 面向场边显示等尽力而为的遥测流：位姿、决策等 POD 结构体经由 `publish` 以一次
+ *   `memcpy` 追加进 MTU 界限内的批量缓冲区，缓冲区写满或距上次发出超过发布周期时，
+ *   整批样本经由单个 UDP 组播报文发出，热路径上不维护连接，也没有逐样本的系统调用
+ * @brief
+ * - 批次头部带递增序列号，订阅端可据此发现丢失的批次；任意数量的 rm::TelemetrySubscriber
+ *   加入组播组即可订阅，发布端无需感知
+ * @note 尽力而为语义，不重传，不适用于需要可靠送达的控制数据
+ */
+class RMVL_EXPORTS_W TelemetryPublisher
+{
+    RMVL_IMPL;
+
+public:
+    TelemetryPublisher(const TelemetryPublisher &) = delete;
+    TelemetryPublisher(TelemetryPublisher &&) = default;
+    TelemetryPublisher &operator=(const TelemetryPublisher &) = delete;
+    TelemetryPublisher &operator=(TelemetryPublisher &&) = default;
+
+    /**
+     * @brief 创建 UDP 组播遥测发布端
+     *
+     * @param[in] group 组播组地址，如 `239.255.0.1`
+     * @param[in] port 组播端口
+     * @param[in] period 发布周期（单位：s），批量缓冲区未满时由下一次 `publish` 按该周期
+     *                   触发发出，默认 `0.02`
+     * @param[in] capacity 批量缓冲区容量（字节），应不超过链路 MTU 扣除 IP、UDP 头部后的
+     *                     剩余量，默认 `1400`
+     */
+    RMVL_W TelemetryPublisher(std::string_view group, uint16_t port, double period = 0.02, std::size_t capacity = 1400);
+
+    /**
+     * @brief 发布一条遥测样本
+     * @note 样本以一次 `memcpy` 追加进批量缓冲区，缓冲区剩余空间不足时先整批发出，
+     *       距上次发出超过发布周期时在追加后整批发出
+     *
+     * @param[in] id 通道标识，由使用者约定，用于订阅端区分样本类型
+     * @param[in] data 样本数据首地址
+     * @param[in] len 样本数据长度（字节）
+     * @return 是否成功，单条样本超出批量缓冲区容量时返回 `false`
+     */
+    bool publish(uint16_t id, const void *data, std::size_t len);
+
+    /**
+     * @brief 发布一条平凡可复制的结构体遥测样本
+     *
+     * @tparam Tp 结构体类型，需可平凡复制
+     * @param[in] id 通道标识
+     * @param[in] sample 样本结构体
+     * @return 是否成功
+     */
+    template <typename Tp>
+    bool publish(uint16_t id, const Tp &sample)
+    {
+        static_assert(std::is_trivially_copyable_v<Tp>, "\"Tp\" must be trivially copyable");
+        return publish(id, &sample, sizeof(Tp));
+    }
+
+    //! 立即发出批量缓冲区中的全部样本，缓冲区为空时不发出任何报文
+    RMVL_W bool flush();
+
+    //! 已发出的批次数，即下一批次的序列号
+    RMVL_W uint32_t sequence() const;
+};
+
+//! UDP 组播遥测订阅端 @see TelemetryPublisher
+class RMVL_EXPORTS_W TelemetrySubscriber
+{
+    RMVL_IMPL;
+
+public:
+    TelemetrySubscriber(const TelemetrySubscriber &) = delete;
+    TelemetrySubscriber(TelemetrySubscriber &&) = default;
+    TelemetrySubscriber &operator=(const TelemetrySubscriber &) = delete;
+    TelemetrySubscriber &operator=(TelemetrySubscriber &&) = default;
+
+    /**
+     * @brief 加入 UDP 组播组并订阅遥测流
+     *
+     * @param[in] group 组播组地址，需与发布端一致
+     * @param[in] port 组播端口，需与发布端一致
+     */
+    RMVL_W TelemetrySubscriber(std::string_view group, uint16_t port);
+
+    /**
+     * @brief 非阻塞读取一个批次中的全部样本
+     *
+     * @param[out] samples 批次中的全部样本，按发布顺序排列
+     * @return 是否读取成功，无新批次时返回 `false`
+     */
+    bool read(std::vector<TelemetrySample> &samples);
+
+    //! 由批次序列号间隙推算出的丢失批次数
+    RMVL_W std::size_t dropped() const;
+};
+
 //! @} core_io
 
 } // namespace rm
@@ -0,0 +1,108 @@
+/**
+ * @file lineage.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 帧血缘跟踪模块
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include "trace.hpp"
+
+//! @addtogroup core
+//! @{
+//! @defgroup core_lineage 帧血缘跟踪模块
+//! @}
+
+namespace rm::lineage
+{
+
+//! @addtogroup core_lineage
+//! @{
+
+//! 帧血缘跟踪经过的流水线阶段
+enum class Stage : uint32_t
+{
+    Retrieve,  //!< 相机取帧
+    Detect,    //!< 识别
+    Sync,      //!< 序列组同步
+    Predict,   //!< 预测
+    Decide,    //!< 决策
+    STAGE_NUM, //!< 阶段数目
+};
+
+//! 帧血缘跟踪记录，定长结构，各阶段时间戳按 rm::lineage::Stage 顺序存放
+struct FrameRecord
+{
+    uint64_t id{};                                           //!< 帧 ID，自取帧起逐帧递增，`0` 表示无效记录
+    double stamp[static_cast<std::size_t>(Stage::STAGE_NUM)]{}; //!< 各阶段完成时刻（单位：s），未经过的阶段为 `0`
+};
+
+//! 帧血缘跟踪记录在跟踪文件中的事件 ID，参数依次为帧 ID 与各阶段完成时刻
+constexpr uint32_t EVENT_ID = 0x454E494C; // "LINE"
+
+//! @cond
+inline std::atomic<uint64_t> _lineage_next{1};
+inline thread_local FrameRecord _lineage_record{};
+inline thread_local FrameRecord _lineage_last{};
+//! @endcond
+
+/**
+ * @brief 开启一帧的血缘跟踪，在相机取帧处铸造帧 ID
+ * @note 帧 ID 全局单调递增，同时记下 rm::lineage::Stage::Retrieve 阶段时间戳，上一帧
+ *       未发布的记录被直接覆盖
+ *
+ * @return 铸造的帧 ID
+ */
+inline uint64_t begin()
+{
+    _lineage_record = {};
+    _lineage_record.id = _lineage_next.fetch_add(1, std::memory_order_relaxed);
+    _lineage_record.stamp[static_cast<std::size_t>(Stage::Retrieve)] = Timer::now();
+    return _lineage_record.id;
+}
+
+//! 当前帧的帧 ID，本线程没有开启中的血缘跟踪时返回 `0`
+inline uint64_t current() noexcept { return _lineage_record.id; }
+
+/**
+ * @brief 记下指定阶段的完成时刻
+ * @note 写入本线程当前帧记录中对应阶段的时间戳，开销为一次时钟读取与一次内存写入，
+ *       可常开保留在热路径中，没有开启中的血缘跟踪时为空操作
+ *
+ * @param[in] stage 流水线阶段
+ */
+inline void mark(Stage stage)
+{
+    if (_lineage_record.id != 0 && stage < Stage::STAGE_NUM)
+        _lineage_record.stamp[static_cast<std::size_t>(stage)] = Timer::now();
+}
+
+/**
+ * @brief 发布当前帧的血缘跟踪记录，在帧处理结束处调用
+ * @note 跟踪（rm::trace）处于启动状态时，记录以 rm::lineage::EVENT_ID 为事件 ID 写入
+ *       跟踪文件，事件参数依次为帧 ID 与各阶段完成时刻，事件自身的时间戳即为帧结束时刻，
+ *       解码后即可得到逐帧的阶段瀑布时延；发布后记录关闭，可通过 `last()` 查询
+ */
+inline void publish()
+{
+    static_assert(static_cast<std::size_t>(Stage::STAGE_NUM) == 5, "the trace event carries the frame id plus 5 stage stamps");
+    if (_lineage_record.id == 0)
+        return;
+    RMVL_TRACE_(EVENT_ID, static_cast<double>(_lineage_record.id),
+                _lineage_record.stamp[0], _lineage_record.stamp[1], _lineage_record.stamp[2],
+                _lineage_record.stamp[3], _lineage_record.stamp[4]);
+    _lineage_last = _lineage_record;
+    _lineage_record = {};
+}
+
+//! 本线程最近一次发布的血缘跟踪记录
+inline const FrameRecord &last() noexcept { return _lineage_last; }
+
+//! @} core_lineage
+
+} // namespace rm::lineage
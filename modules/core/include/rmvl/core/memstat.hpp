@@ -0,0 +1,170 @@
+/**
+ * @file memstat.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 内存分配统计模块
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "rmvldef.hpp"
+
+//! @addtogroup core
+//! @{
+//! @defgroup core_memstat 内存分配统计模块
+//! @}
+
+//! @addtogroup core_memstat
+//! @{
+
+#ifdef RMVL_MEMSTAT_DISABLE
+
+#define RMVL_MEM_ALLOC_(name, bytes) ((void)0)
+#define RMVL_MEM_FREE_(name, bytes) ((void)0)
+#define RMVL_MEM_POOL_HIT_(name) ((void)0)
+#define RMVL_MEM_POOL_MISS_(name) ((void)0)
+
+#else
+
+/**
+ * @brief 记录一次内存分配
+ * @note
+ * - 统计未启动时仅付出一次原子读的开销，可无条件保留在分配热路径中，定义
+ *   `RMVL_MEMSTAT_DISABLE` 后完全编译消除
+ * @note
+ * - 统计通道在首次记录时按名称查找并缓存，后续记录为纯原子累加
+ *
+ * @param[in] name 统计通道名称，一般为 `<模块>/<缓冲池>` 形式的字符串字面量
+ * @param[in] bytes 分配的字节数
+ */
+#define RMVL_MEM_ALLOC_(name, bytes)                          \
+    do                                                        \
+    {                                                         \
+        if (rm::memstat::active())                            \
+        {                                                     \
+            static auto &chn__ = rm::memstat::channel(name);  \
+            rm::memstat::recordAlloc(chn__, bytes);           \
+        }                                                     \
+    } while (false)
+
+//! 记录一次内存释放，参见 @ref RMVL_MEM_ALLOC_
+#define RMVL_MEM_FREE_(name, bytes)                           \
+    do                                                        \
+    {                                                         \
+        if (rm::memstat::active())                            \
+        {                                                     \
+            static auto &chn__ = rm::memstat::channel(name);  \
+            rm::memstat::recordFree(chn__, bytes);            \
+        }                                                     \
+    } while (false)
+
+//! 记录一次缓冲池命中（复用既有缓冲区），参见 @ref RMVL_MEM_ALLOC_
+#define RMVL_MEM_POOL_HIT_(name)                              \
+    do                                                        \
+    {                                                         \
+        if (rm::memstat::active())                            \
+        {                                                     \
+            static auto &chn__ = rm::memstat::channel(name);  \
+            rm::memstat::recordPool(chn__, true);             \
+        }                                                     \
+    } while (false)
+
+//! 记录一次缓冲池未命中（新建缓冲区），参见 @ref RMVL_MEM_ALLOC_
+#define RMVL_MEM_POOL_MISS_(name)                             \
+    do                                                        \
+    {                                                         \
+        if (rm::memstat::active())                            \
+        {                                                     \
+            static auto &chn__ = rm::memstat::channel(name);  \
+            rm::memstat::recordPool(chn__, false);            \
+        }                                                     \
+    } while (false)
+
+#endif // RMVL_MEMSTAT_DISABLE
+
+//! @} core_memstat
+
+namespace rm::memstat
+{
+
+//! @addtogroup core_memstat
+//! @{
+
+//! 内存统计通道，内部结构对使用者不可见
+struct MemChannel;
+
+//! @cond
+inline std::atomic<bool> _memstat_active{};
+
+void recordAlloc(MemChannel &chn, std::size_t bytes);
+void recordFree(MemChannel &chn, std::size_t bytes);
+void recordPool(MemChannel &chn, bool hit);
+//! @endcond
+
+//! 内存分配统计是否处于启动状态
+inline bool active() noexcept { return _memstat_active.load(std::memory_order_relaxed); }
+
+//! 启动内存分配统计，已有通道中的历史计数被保留
+void start();
+
+//! 停止内存分配统计，通道与已有计数保留，可继续通过 `summary()` 导出
+void stop();
+
+/**
+ * @brief 按名称获取内存统计通道，不存在时自动创建
+ * @note 通道在进程生命周期内保留，首次获取后可缓存返回的引用，热路径查找开销为零
+ *
+ * @param[in] name 通道名称
+ * @return 内存统计通道
+ */
+MemChannel &channel(std::string_view name);
+
+//! 内存统计通道摘要
+struct Summary
+{
+    std::size_t alloc_count{}; //!< 分配次数
+    std::size_t free_count{};  //!< 释放次数
+    std::size_t alloc_bytes{}; //!< 累计分配字节数
+    std::size_t live_bytes{};  //!< 在用字节数
+    std::size_t peak_bytes{};  //!< 在用字节数峰值
+    std::size_t pool_hits{};   //!< 缓冲池命中次数
+    std::size_t pool_misses{}; //!< 缓冲池未命中次数
+
+    //! 缓冲池命中率，无缓冲池记录时为 `0`
+    double hitRate() const noexcept
+    {
+        std::size_t total = pool_hits + pool_misses;
+        return total == 0 ? 0. : static_cast<double>(pool_hits) / static_cast<double>(total);
+    }
+};
+
+/**
+ * @brief 导出指定通道的内存统计摘要
+ *
+ * @param[in] name 通道名称
+ * @return 内存统计摘要，通道不存在时各计数为 `0`
+ */
+Summary summary(std::string_view name);
+
+/**
+ * @brief 按通道名称字典序导出所有通道的内存统计摘要
+ * @note 摘要为普通计数值，可直接映射至 OPC UA 服务器的数据源变量节点对外发布，
+ *       参见 rm::publishMemStats
+ */
+std::vector<std::pair<std::string, Summary>> exportAll();
+
+//! 清空所有通道的计数数据，已缓存的通道引用保持有效
+void reset();
+
+//! @} core_memstat
+
+} // namespace rm::memstat
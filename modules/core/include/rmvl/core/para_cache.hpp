@@ -0,0 +1,227 @@
+/**
+ * @file para_cache.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 参数模块二进制缓存
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+//! @addtogroup para
+//! @{
+//! @defgroup para_cache 参数模块二进制缓存
+//! @brief 参数首次从 YAML 文件加载时编译为带哈希校验的二进制缓存，后续启动直接按二进制加载，
+//!        跳过 YAML 解析，由 `rmvl_generate_para` 生成的 `read` 接口自动使用
+//! @} para
+
+namespace rm::para::cache
+{
+
+//! @addtogroup para_cache
+//! @{
+
+//! 缓存文件魔数，即小端字节序下的 "RMPC"
+constexpr uint32_t CACHE_MAGIC = 0x43504d52;
+//! 缓存文件格式版本号
+constexpr uint32_t CACHE_VERSION = 1;
+
+/**
+ * @brief 计算字节序列的 FNV-1a 哈希
+ *
+ * @param[in] data 字节序列首地址
+ * @param[in] size 字节序列长度
+ * @param[in] seed 哈希种子，分块计算时传入上一块的结果
+ * @return 32 位哈希值
+ */
+inline uint32_t fnv1a(const void *data, std::size_t size, uint32_t seed = 0x811c9dc5)
+{
+    auto ptr = static_cast<const uint8_t *>(data);
+    uint32_t retval = seed;
+    for (std::size_t i = 0; i < size; ++i)
+        retval = (retval ^ ptr[i]) * 0x01000193;
+    return retval;
+}
+
+/**
+ * @brief 计算文件内容哈希，用于校验缓存对应的源文件是否发生变化
+ *
+ * @param[in] path 文件路径
+ * @return 文件内容的 FNV-1a 哈希，文件不存在时返回 `0`
+ */
+inline uint32_t fileHash(const std::string &path)
+{
+    std::FILE *fp = std::fopen(path.c_str(), "rb");
+    if (fp == nullptr)
+        return 0;
+    uint32_t retval = 0x811c9dc5;
+    char buf[4096];
+    std::size_t num{};
+    while ((num = std::fread(buf, 1, sizeof(buf), fp)) > 0)
+        retval = fnv1a(buf, num, retval);
+    std::fclose(fp);
+    return retval;
+}
+
+/**
+ * @brief 二进制缓存写入器
+ * @note 依次序列化各参数字段后通过 `dump` 落盘，字段顺序由生成的 `archive` 方法固定，
+ *       与参数规范哈希一同保证缓存与参数类的二进制布局一致
+ */
+class BinWriter
+{
+public:
+    //! 序列化平凡可拷贝类型（算术类型、枚举以及矩阵、点等数据结构）
+    template <typename Tp, typename Enable = std::enable_if_t<std::is_trivially_copyable_v<Tp>>>
+    void operator()(const Tp &val)
+    {
+        auto ptr = reinterpret_cast<const uint8_t *>(&val);
+        _buf.insert(_buf.end(), ptr, ptr + sizeof(Tp));
+    }
+
+    //! 序列化字符串
+    void operator()(const std::string &val)
+    {
+        (*this)(static_cast<uint64_t>(val.size()));
+        _buf.insert(_buf.end(), val.begin(), val.end());
+    }
+
+    //! 序列化动态数组
+    template <typename Tp>
+    void operator()(const std::vector<Tp> &val)
+    {
+        (*this)(static_cast<uint64_t>(val.size()));
+        for (const auto &item : val)
+            (*this)(item);
+    }
+
+    /**
+     * @brief 将缓存写入指定文件
+     *
+     * @param[in] path 缓存文件路径
+     * @param[in] schema_hash 参数规范哈希，生成代码时由 `*.para` 文件内容计算
+     * @param[in] src_hash 参数源文件（YAML）内容哈希
+     * @return 是否写入成功
+     */
+    bool dump(const std::string &path, uint32_t schema_hash, uint32_t src_hash) const
+    {
+        std::FILE *fp = std::fopen(path.c_str(), "wb");
+        if (fp == nullptr)
+            return false;
+        const uint32_t header[4]{CACHE_MAGIC, CACHE_VERSION, schema_hash, src_hash};
+        const uint64_t size = _buf.size();
+        bool retval = std::fwrite(header, sizeof(header), 1, fp) == 1 && std::fwrite(&size, sizeof(size), 1, fp) == 1;
+        if (retval && size > 0)
+            retval = std::fwrite(_buf.data(), size, 1, fp) == 1;
+        std::fclose(fp);
+        return retval;
+    }
+
+private:
+    std::vector<uint8_t> _buf; //!< 序列化缓冲区
+};
+
+/**
+ * @brief 二进制缓存读取器
+ * @note `load` 校验魔数、版本与两级哈希后载入缓存内容，反序列化完成后通过 `ok`
+ *       确认缓存被完整消费，任何一步失败都应回退至 YAML 解析
+ */
+class BinReader
+{
+public:
+    /**
+     * @brief 载入并校验缓存文件
+     *
+     * @param[in] path 缓存文件路径
+     * @param[in] schema_hash 参数规范哈希，需与写入时一致
+     * @param[in] src_hash 参数源文件（YAML）内容哈希，需与写入时一致
+     * @return 校验是否通过
+     */
+    bool load(const std::string &path, uint32_t schema_hash, uint32_t src_hash)
+    {
+        std::FILE *fp = std::fopen(path.c_str(), "rb");
+        if (fp == nullptr)
+            return false;
+        uint32_t header[4]{};
+        uint64_t size{};
+        bool retval = std::fread(header, sizeof(header), 1, fp) == 1 && std::fread(&size, sizeof(size), 1, fp) == 1 &&
+                      header[0] == CACHE_MAGIC && header[1] == CACHE_VERSION && header[2] == schema_hash && header[3] == src_hash;
+        if (retval)
+        {
+            _buf.resize(static_cast<std::size_t>(size));
+            if (size > 0)
+                retval = std::fread(_buf.data(), static_cast<std::size_t>(size), 1, fp) == 1;
+        }
+        std::fclose(fp);
+        _cur = 0;
+        _valid = retval;
+        return retval;
+    }
+
+    //! 缓存是否有效且被完整消费，应在反序列化全部字段后调用
+    bool ok() const { return _valid && _cur == _buf.size(); }
+
+    //! 反序列化平凡可拷贝类型（算术类型、枚举以及矩阵、点等数据结构）
+    template <typename Tp, typename Enable = std::enable_if_t<std::is_trivially_copyable_v<Tp>>>
+    void operator()(Tp &val) { take(&val, sizeof(Tp)); }
+
+    //! 反序列化字符串
+    void operator()(std::string &val)
+    {
+        uint64_t size{};
+        if (!take(&size, sizeof(size)) || _cur + size > _buf.size())
+        {
+            _valid = false;
+            return;
+        }
+        val.assign(reinterpret_cast<const char *>(_buf.data() + _cur), static_cast<std::size_t>(size));
+        _cur += static_cast<std::size_t>(size);
+    }
+
+    //! 反序列化动态数组
+    template <typename Tp>
+    void operator()(std::vector<Tp> &val)
+    {
+        uint64_t size{};
+        if (!take(&size, sizeof(size)) || size > _buf.size() - _cur)
+        {
+            _valid = false;
+            return;
+        }
+        val.resize(static_cast<std::size_t>(size));
+        for (auto &item : val)
+            (*this)(item);
+    }
+
+private:
+    //! 从缓冲区读取指定长度的字节
+    bool take(void *dst, std::size_t size)
+    {
+        if (!_valid || _cur + size > _buf.size())
+        {
+            _valid = false;
+            return false;
+        }
+        std::memcpy(dst, _buf.data() + _cur, size);
+        _cur += size;
+        return true;
+    }
+
+    std::vector<uint8_t> _buf; //!< 缓存内容
+    std::size_t _cur{};        //!< 读取位置
+    bool _valid{};             //!< 缓存是否有效
+};
+
+//! @} para_cache
+
+} // namespace rm::para::cache
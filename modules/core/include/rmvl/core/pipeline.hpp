@@ -0,0 +1,157 @@
+/**
+ * @file pipeline.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 多阶段流水线调度器
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "util.hpp"
+
+namespace rm
+{
+
+//! @addtogroup core
+//! @{
+
+/**
+ * @brief 多阶段流水线调度器
+ * @note
+ * - 将采集、预处理、识别、追踪预测等处理阶段组织为流水线，不同帧的不同阶段在工作线程上
+ *   重叠执行，吞吐量由最慢阶段决定，而非各阶段耗时之和
+ * @note
+ * - 帧在固定数目的帧槽中流转，采集阶段最多领先最慢阶段一个帧槽池的距离，以此约束端到端延迟
+ * @note
+ * - 就绪任务不绑定线程，空闲的工作线程从共享就绪集中优先取靠后阶段的任务（任务窃取），
+ *   同一阶段在任意时刻至多执行一帧，且按采集顺序执行，阶段回调可安全持有状态
+ *
+ * @tparam FrameT 帧类型，包含单帧数据在各阶段间传递的全部内容
+ */
+template <typename FrameT>
+class Pipeline
+{
+public:
+    /**
+     * @brief 阶段回调，对指定帧就地完成本阶段的处理
+     * @note 返回 `false` 时，首个阶段（采集）表示数据源结束，其余阶段表示丢弃当前帧
+     */
+    using stage_callback = std::function<bool(FrameT &)>;
+
+    /**
+     * @brief 创建流水线调度器
+     *
+     * @param[in] stages 各阶段回调列表，首个阶段为采集阶段，负责向帧槽填充数据
+     * @param[in] slots 帧槽数目，为 `0` 时取阶段数 `+ 1`
+     * @param[in] workers 工作线程数目，为 `0` 时取阶段数与硬件并发数的较小值
+     */
+    explicit Pipeline(std::vector<stage_callback> stages, std::size_t slots = 0, std::size_t workers = 0)
+        : _stages(std::move(stages))
+    {
+        RMVL_Assert(!_stages.empty());
+        _frames.resize(slots != 0 ? slots : _stages.size() + 1);
+        _workers = workers != 0 ? workers : std::min<std::size_t>(_stages.size(), std::max(1u, std::thread::hardware_concurrency()));
+    }
+
+    Pipeline(const Pipeline &) = delete;
+    Pipeline &operator=(const Pipeline &) = delete;
+
+    /**
+     * @brief 运行流水线，阻塞直至采集阶段返回 `false` 且所有在途帧处理完毕
+     * @note 可多次调用，每次调用重新从采集阶段开始
+     */
+    void run()
+    {
+        const std::size_t nstages = _stages.size();
+        _ready.assign(nstages, {});
+        _busy.assign(nstages, false);
+        _stop_capture = false;
+        // 初始时所有帧槽对采集阶段就绪
+        for (std::size_t i = 0; i < _frames.size(); ++i)
+            _ready.front().push_back(i);
+        std::vector<std::thread> threads;
+        threads.reserve(_workers);
+        for (std::size_t i = 0; i < _workers; ++i)
+            threads.emplace_back(&Pipeline::work, this);
+        for (auto &t : threads)
+            t.join();
+    }
+
+private:
+    //! 工作线程主循环
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(_mtx);
+        while (true)
+        {
+            // 优先取靠后阶段的就绪任务，先排空在途帧，再采集新帧
+            std::size_t stage = _stages.size();
+            for (std::size_t s = _stages.size(); s-- > 0;)
+            {
+                if (_busy[s] || _ready[s].empty() || (s == 0 && _stop_capture))
+                    continue;
+                stage = s;
+                break;
+            }
+            if (stage == _stages.size())
+            {
+                if (finished())
+                    break;
+                _cv.wait(lock);
+                continue;
+            }
+            std::size_t slot = _ready[stage].front();
+            _ready[stage].pop_front();
+            _busy[stage] = true;
+            lock.unlock();
+            bool ok = _stages[stage](_frames[slot]);
+            lock.lock();
+            _busy[stage] = false;
+            if (stage == 0 && !ok)
+                _stop_capture = true;
+            // 处理成功且存在后继阶段时向下游流转，否则帧槽归还采集阶段
+            if (ok && stage + 1 < _stages.size())
+                _ready[stage + 1].push_back(slot);
+            else
+                _ready.front().push_back(slot);
+            _cv.notify_all();
+        }
+        // 唤醒其余等待线程，使其检测到流水线结束
+        _cv.notify_all();
+    }
+
+    //! 流水线是否已结束（需持有锁）
+    bool finished() const
+    {
+        if (!_stop_capture)
+            return false;
+        for (std::size_t s = 0; s < _stages.size(); ++s)
+            if (_busy[s] || (s != 0 && !_ready[s].empty()))
+                return false;
+        return true;
+    }
+
+    std::vector<stage_callback> _stages;        //!< 各阶段回调
+    std::vector<FrameT> _frames;                //!< 帧槽池
+    std::size_t _workers{};                     //!< 工作线程数目
+    std::mutex _mtx;                            //!< 调度状态互斥锁
+    std::condition_variable _cv;                //!< 就绪任务条件变量
+    std::vector<std::deque<std::size_t>> _ready; //!< 各阶段的就绪帧槽队列，首个队列兼作空闲帧槽池
+    std::vector<bool> _busy;                    //!< 各阶段是否正在执行
+    bool _stop_capture{};                       //!< 采集阶段是否已结束
+};
+
+//! @} core
+
+} // namespace rm
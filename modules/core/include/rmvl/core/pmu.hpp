@@ -0,0 +1,99 @@
+/**
+ * @file pmu.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 硬件性能计数模块
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "rmvldef.hpp"
+
+//! @addtogroup core
+//! @{
+//! @defgroup core_pmu 硬件性能计数模块
+//! @}
+
+namespace rm
+{
+
+//! @addtogroup core_pmu
+//! @{
+
+//! 硬件性能计数采样结果
+struct PmuCounts
+{
+    uint64_t cycles{};        //!< 时钟周期数
+    uint64_t instructions{};  //!< 退役指令数
+    uint64_t cache_misses{};  //!< 缓存缺失数（末级缓存）
+    uint64_t branch_misses{}; //!< 分支预测失败数
+
+    //! 每周期指令数（IPC），明显低于硬件发射宽度通常意味着访存受限
+    double ipc() const noexcept { return cycles == 0 ? 0. : static_cast<double>(instructions) / static_cast<double>(cycles); }
+    //! 千条指令缓存缺失数（Cache MPKI），偏高意味着工作集超出缓存容量或访问模式不友好
+    double cacheMpki() const noexcept { return instructions == 0 ? 0. : 1e3 * static_cast<double>(cache_misses) / static_cast<double>(instructions); }
+    //! 千条指令分支预测失败数（Branch MPKI）
+    double branchMpki() const noexcept { return instructions == 0 ? 0. : 1e3 * static_cast<double>(branch_misses) / static_cast<double>(instructions); }
+};
+
+//! 两次采样之差，用于计算作用域区段内的计数增量
+inline PmuCounts operator-(const PmuCounts &lhs, const PmuCounts &rhs) noexcept
+{
+    return {lhs.cycles - rhs.cycles, lhs.instructions - rhs.instructions,
+            lhs.cache_misses - rhs.cache_misses, lhs.branch_misses - rhs.branch_misses};
+}
+
+/**
+ * @brief 硬件性能计数器组
+ * @brief
+ * - 面向调用线程打开一组持续计数的 PMU 计数器（时钟周期、退役指令、缓存缺失、
+ *   分支预测失败），区段两端各取一次快照、相减即得区段增量，快照不复位计数器，
+ *   支持区段嵌套
+ * @brief
+ * - Linux 下基于 `perf_event` 实现，仅统计用户态。受 `perf_event_paranoid` 或
+ *   虚拟化环境限制无法打开时 `valid()` 返回 `false`，快照恒为零，调用方无需分支
+ *   处理平台差异；个别事件（如虚拟机中的缓存缺失）不可用时仅该计数恒为零
+ * @note 计数器组绑定至构造线程，快照应在同一线程内获取
+ */
+class RMVL_EXPORTS PmuCounters final
+{
+public:
+    PmuCounters();
+    ~PmuCounters();
+
+    //! @cond
+    PmuCounters(const PmuCounters &) = delete;
+    PmuCounters(PmuCounters &&) = delete;
+    PmuCounters &operator=(const PmuCounters &) = delete;
+    PmuCounters &operator=(PmuCounters &&) = delete;
+    //! @endcond
+
+    //! 计数器组是否打开成功
+    bool valid() const noexcept { return _fds[0] >= 0; }
+
+    //! 获取当前计数快照，计数器组未打开时恒为零
+    PmuCounts snapshot() const noexcept;
+
+private:
+    int _fds[4]{-1, -1, -1, -1}; //!< 各事件的文件描述符，首个为组长
+    uint64_t _ids[4]{};          //!< 各事件在组读取结果中的标识
+};
+
+/**
+ * @brief 获取当前线程的硬件性能计数器组
+ * @note 线程局部单例，首次调用时打开并随线程退出关闭，供逐帧、逐阶段的高频采样
+ *       复用，避免每个区段重复打开计数器组
+ *
+ * @return 当前线程的硬件性能计数器组
+ */
+RMVL_EXPORTS PmuCounters &threadPmu();
+
+//! @} core_pmu
+
+} // namespace rm
@@ -0,0 +1,256 @@
+/**
+ * @file protocol.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 串口定长帧协议编解码模块
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+
+#ifdef __SSE4_2__
+#include <nmmintrin.h>
+#endif
+
+#include "util.hpp"
+
+//! @addtogroup core
+//! @{
+//! @defgroup core_protocol 串口定长帧协议编解码模块
+//! @}
+
+namespace rm::protocol
+{
+
+//! @addtogroup core_protocol
+//! @{
+
+//! 帧头标志
+inline constexpr uint8_t FRAME_HEAD = 0xa5;
+
+//! @cond
+
+namespace helper
+{
+
+//! CRC-32C（Castagnoli）查找表，编译期生成
+struct Crc32Table
+{
+    uint32_t val[256]{};
+
+    constexpr Crc32Table()
+    {
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t crc = i;
+            for (int j = 0; j < 8; ++j)
+                crc = (crc >> 1) ^ ((crc & 1) ? 0x82f63b78u : 0u);
+            val[i] = crc;
+        }
+    }
+};
+
+inline constexpr Crc32Table crc32_table{};
+
+//! 聚合体各数据成员大小之和，即无填充字节时的紧凑布局大小
+template <typename Tp>
+constexpr std::size_t packedSize()
+{
+    std::size_t size{};
+    reflect::for_each(Tp{}, [&size](const auto &member) { size += sizeof(member); });
+    return size;
+}
+
+} // namespace helper
+
+//! @endcond
+
+/**
+ * @brief 计算 CRC-32C 校验值
+ * @note 编译目标支持 SSE4.2 时使用硬件 `crc32` 指令按 8 字节步进计算，否则退化为查表实现，
+ *       两种路径结果一致，可与 MCU 端的查表实现互校
+ *
+ * @param[in] data 数据首地址
+ * @param[in] len 数据长度（字节）
+ * @return CRC-32C 校验值
+ */
+inline uint32_t crc32(const void *data, std::size_t len) noexcept
+{
+    const auto *p = static_cast<const uint8_t *>(data);
+    uint32_t crc = 0xffffffffu;
+#ifdef __SSE4_2__
+    uint64_t crc64 = crc;
+    for (; len >= 8; len -= 8, p += 8)
+    {
+        uint64_t v{};
+        std::memcpy(&v, p, 8);
+        crc64 = _mm_crc32_u64(crc64, v);
+    }
+    crc = static_cast<uint32_t>(crc64);
+    for (; len > 0; --len, ++p)
+        crc = _mm_crc32_u8(crc, *p);
+#else
+    for (; len > 0; --len, ++p)
+        crc = helper::crc32_table.val[(crc ^ *p) & 0xff] ^ (crc >> 8);
+#endif
+    return crc ^ 0xffffffffu;
+}
+
+/**
+ * @brief 定长帧编解码器
+ * @brief
+ * - 以聚合体 `Tp` 的声明布局作为帧负载描述，帧格式为
+ *   `[帧头 1B] [负载长度 1B] [负载 sizeof(Tp) B] [CRC-32C 4B]`，
+ *   校验覆盖帧头至负载末尾，多字节字段与 CRC 均为小端字节序
+ * @brief
+ * - 帧长、负载长度均为编译期常量，编码为一次 `memcpy`，负载无逐字段打包开销；
+ *   负载布局含填充字节时编译失败，可通过调整字段顺序或对齐消除
+ *
+ * @tparam Tp 帧负载类型，需为无填充字节的平凡可复制聚合体
+ */
+template <typename Tp>
+class FrameCodec
+{
+    static_assert(std::is_aggregate_v<Tp> && std::is_trivially_copyable_v<Tp>,
+                  "\"Tp\" must be a trivially copyable aggregate");
+    static_assert(helper::packedSize<Tp>() == sizeof(Tp),
+                  "\"Tp\" contains padding bytes, adjust field order or alignment");
+    static_assert(sizeof(Tp) <= UINT8_MAX, "payload of \"Tp\" exceeds the 1-byte length field");
+
+public:
+    static constexpr std::size_t payload_size = sizeof(Tp); //!< 负载长度（字节）
+    static constexpr std::size_t frame_size = payload_size + 6; //!< 帧长（字节）
+
+    //! 编码缓冲区类型，可直接传入 `SerialPort::write`
+    using buffer_t = std::array<uint8_t, frame_size>;
+
+    /**
+     * @brief 将负载编码为完整帧
+     *
+     * @param[in] data 帧负载
+     * @return 编码后的帧缓冲区
+     */
+    static buffer_t encode(const Tp &data) noexcept
+    {
+        buffer_t frame{};
+        frame[0] = FRAME_HEAD;
+        frame[1] = static_cast<uint8_t>(payload_size);
+        std::memcpy(frame.data() + 2, &data, payload_size);
+        uint32_t crc = crc32(frame.data(), payload_size + 2);
+        std::memcpy(frame.data() + payload_size + 2, &crc, 4);
+        return frame;
+    }
+
+    /**
+     * @brief 从帧缓冲区解码负载
+     *
+     * @param[in] frame 帧首地址，需至少含 `frame_size` 字节
+     * @return 解码得到的负载，帧头、长度或校验不匹配时返回 `std::nullopt`
+     */
+    static std::optional<Tp> decode(const uint8_t *frame) noexcept
+    {
+        if (frame[0] != FRAME_HEAD || frame[1] != payload_size)
+            return std::nullopt;
+        uint32_t crc{};
+        std::memcpy(&crc, frame + payload_size + 2, 4);
+        if (crc != crc32(frame, payload_size + 2))
+            return std::nullopt;
+        Tp data{};
+        std::memcpy(&data, frame + 2, payload_size);
+        return data;
+    }
+};
+
+/**
+ * @brief 定长帧增量重同步扫描器
+ * @brief
+ * - 按到达顺序送入串口字节流，内部完成分帧、校验与损坏后的重同步：校验失败时仅丢弃
+ *   一个字节并继续向后扫描帧头，单个损坏帧不会连带丢弃后续完好的帧
+ * @brief
+ * - 送入的字节数无需与帧边界对齐，适合配合 `SerialPort` 的非阻塞读取使用
+ *
+ * @tparam Tp 帧负载类型，同 rm::protocol::FrameCodec
+ */
+template <typename Tp>
+class StreamScanner
+{
+    using codec = FrameCodec<Tp>;
+
+public:
+    /**
+     * @brief 送入新到达的字节流，逐帧解析
+     *
+     * @param[in] data 字节流首地址
+     * @param[in] len 字节流长度
+     * @param[in] callback 帧负载回调，每解析出一个完好帧调用一次
+     */
+    template <typename Callable>
+    void feed(const uint8_t *data, std::size_t len, Callable &&callback)
+    {
+        while (len > 0)
+        {
+            std::size_t n = std::min(len, BUF_SIZE - _used);
+            std::memcpy(_buf.data() + _used, data, n);
+            _used += n, data += n, len -= n;
+            scan(callback);
+            // 缓冲区仍满说明数据无法构成完好帧，丢弃一个字节以推进扫描
+            if (_used == BUF_SIZE)
+                drop(1);
+        }
+    }
+
+    //! 因损坏或失步而丢弃的字节数
+    std::size_t dropped() const { return _dropped; }
+
+private:
+    //! 从缓冲区头部开始扫描并解析完好帧
+    template <typename Callable>
+    void scan(Callable &&callback)
+    {
+        while (_used >= codec::frame_size)
+        {
+            if (_buf[0] != FRAME_HEAD)
+            {
+                drop(1);
+                continue;
+            }
+            if (auto data = codec::decode(_buf.data()); data.has_value())
+            {
+                callback(*data);
+                consume(codec::frame_size);
+            }
+            else
+                drop(1);
+        }
+    }
+
+    //! 丢弃缓冲区头部 `n` 个字节，并计入丢弃统计
+    void drop(std::size_t n) { _dropped += n, consume(n); }
+
+    //! 消耗缓冲区头部 `n` 个字节
+    void consume(std::size_t n)
+    {
+        _used -= n;
+        std::memmove(_buf.data(), _buf.data() + n, _used);
+    }
+
+    static constexpr std::size_t BUF_SIZE = 4 * codec::frame_size; //!< 缓冲区容量
+
+    std::array<uint8_t, BUF_SIZE> _buf{}; //!< 字节流缓冲区
+    std::size_t _used{};                  //!< 缓冲区已用字节数
+    std::size_t _dropped{};               //!< 已丢弃的字节数
+};
+
+//! @} core_protocol
+
+} // namespace rm::protocol
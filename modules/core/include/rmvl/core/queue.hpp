@@ -0,0 +1,484 @@
+/**
+ * @file queue.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 无锁有界并发队列
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include "util.hpp"
+
+namespace rm
+{
+
+//! @addtogroup core
+//! @{
+
+/**
+ * @brief 无锁有界多生产者多消费者队列
+ * @note
+ * - 基于序列号标记的环形数组实现，`try_xxx` 操作无锁完成，适用于相机回调、串口接收、
+ *   数据发布等高吞吐量的阶段间数据传递
+ * @note
+ * - 阻塞操作在无锁快速路径失败后进入条件变量等待，仅在存在等待者时才会产生通知开销
+ * @note
+ * - 队列关闭后，入队操作立即失败，出队操作在队列排空后失败，用于通知消费者结束
+ *
+ * @tparam Tp 元素类型
+ */
+template <typename Tp>
+class MpmcQueue
+{
+public:
+    /**
+     * @brief 创建队列
+     *
+     * @param[in] capacity 队列容量，内部向上取整至 2 的幂
+     */
+    explicit MpmcQueue(std::size_t capacity)
+    {
+        RMVL_Assert(capacity > 0);
+        std::size_t num = 2;
+        while (num < capacity)
+            num <<= 1;
+        _cells = std::make_unique<Cell[]>(num);
+        _mask = num - 1;
+        for (std::size_t i = 0; i <= _mask; ++i)
+            _cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    MpmcQueue(const MpmcQueue &) = delete;
+    MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+    //! 队列容量
+    std::size_t capacity() const { return _mask + 1; }
+
+    /**
+     * @brief 尝试入队（非阻塞）
+     *
+     * @param[in] val 待入队的元素
+     * @return 入队是否成功，队列已满或已关闭时返回 `false`
+     */
+    bool try_push(const Tp &val)
+    {
+        Tp tmp = val;
+        return try_push(std::move(tmp));
+    }
+
+    /**
+     * @brief 尝试入队（非阻塞），失败时不消耗入参
+     *
+     * @param[in] val 待入队的元素
+     * @return 入队是否成功，队列已满或已关闭时返回 `false`
+     */
+    bool try_push(Tp &&val)
+    {
+        if (!pushImpl(val))
+            return false;
+        wake(_pop_waiters, _not_empty);
+        return true;
+    }
+
+    /**
+     * @brief 尝试出队（非阻塞）
+     *
+     * @param[out] val 出队的元素
+     * @return 出队是否成功，队列为空时返回 `false`
+     */
+    bool try_pop(Tp &val)
+    {
+        if (!popImpl(val))
+            return false;
+        wake(_push_waiters, _not_full);
+        return true;
+    }
+
+    /**
+     * @brief 批量尝试入队（非阻塞）
+     *
+     * @param[in] first 待入队区间的起始迭代器
+     * @param[in] last 待入队区间的结束迭代器
+     * @return 实际入队的元素个数
+     */
+    template <typename InputIt>
+    std::size_t try_push(InputIt first, InputIt last)
+    {
+        std::size_t num{};
+        for (; first != last && try_push(*first); ++first)
+            ++num;
+        return num;
+    }
+
+    /**
+     * @brief 批量尝试出队（非阻塞）
+     *
+     * @param[out] out 出队元素的输出迭代器
+     * @param[in] max 最大出队元素个数
+     * @return 实际出队的元素个数
+     */
+    template <typename OutputIt>
+    std::size_t try_pop(OutputIt out, std::size_t max)
+    {
+        std::size_t num{};
+        for (Tp val; num < max && try_pop(val); ++num)
+            *out++ = std::move(val);
+        return num;
+    }
+
+    /**
+     * @brief 入队（阻塞），队列已满时等待空闲槽位
+     *
+     * @param[in] val 待入队的元素
+     * @return 入队是否成功，队列已关闭时返回 `false`
+     */
+    bool push(Tp val)
+    {
+        if (try_push(std::move(val)))
+            return true;
+        std::unique_lock<std::mutex> lock(_mtx);
+        ++_push_waiters;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (;;)
+        {
+            // 持锁期间仅执行不通知的入队实现，通知在解锁后进行，避免自死锁
+            if (pushImpl(val))
+            {
+                --_push_waiters;
+                lock.unlock();
+                wake(_pop_waiters, _not_empty);
+                return true;
+            }
+            if (_closed.load(std::memory_order_relaxed))
+            {
+                --_push_waiters;
+                return false;
+            }
+            _not_full.wait(lock);
+        }
+    }
+
+    /**
+     * @brief 出队（阻塞），队列为空时等待数据
+     *
+     * @param[out] val 出队的元素
+     * @return 出队是否成功，队列已关闭且排空后返回 `false`
+     */
+    bool pop(Tp &val)
+    {
+        if (try_pop(val))
+            return true;
+        std::unique_lock<std::mutex> lock(_mtx);
+        ++_pop_waiters;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (;;)
+        {
+            // 持锁期间仅执行不通知的出队实现，通知在解锁后进行，避免自死锁
+            if (popImpl(val))
+            {
+                --_pop_waiters;
+                lock.unlock();
+                wake(_push_waiters, _not_full);
+                return true;
+            }
+            if (_closed.load(std::memory_order_relaxed))
+            {
+                --_pop_waiters;
+                return false;
+            }
+            _not_empty.wait(lock);
+        }
+    }
+
+    //! 关闭队列，入队立即失败，出队在排空后失败，唤醒所有阻塞操作
+    void close()
+    {
+        _closed.store(true, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(_mtx);
+        _not_empty.notify_all();
+        _not_full.notify_all();
+    }
+
+private:
+    //! 序列号标记的存储槽位
+    struct Cell
+    {
+        std::atomic<std::size_t> seq; //!< 槽位序列号，标记可写（= 下标 + 圈数）或可读（= 下标 + 圈数 + 1）
+        Tp data;                      //!< 数据
+    };
+
+    //! 存在等待者时加锁通知，快速路径仅一道屏障与一次原子读取
+    void wake(const std::atomic<std::size_t> &waiters, std::condition_variable &cv)
+    {
+        // 与等待者递增计数后的屏障配对：数据发布与计数递增两者必有一方对对方可见
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_relaxed) != 0)
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            cv.notify_one();
+        }
+    }
+
+    //! 入队实现，仅在成功时消耗入参，不产生通知
+    bool pushImpl(Tp &val)
+    {
+        if (_closed.load(std::memory_order_relaxed))
+            return false;
+        std::size_t pos = _tail.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell &cell = _cells[pos & _mask];
+            std::size_t seq = cell.seq.load(std::memory_order_acquire);
+            auto dif = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (dif == 0)
+            {
+                // 占据该槽位，写入数据后以序列号发布
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    cell.data = std::move(val);
+                    cell.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (dif < 0)
+                return false;
+            else
+                pos = _tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    //! 出队实现，不产生通知
+    bool popImpl(Tp &val)
+    {
+        std::size_t pos = _head.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell &cell = _cells[pos & _mask];
+            std::size_t seq = cell.seq.load(std::memory_order_acquire);
+            auto dif = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (dif == 0)
+            {
+                if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    val = std::move(cell.data);
+                    cell.seq.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (dif < 0)
+                return false;
+            else
+                pos = _head.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<Cell[]> _cells; //!< 环形槽位数组
+    std::size_t _mask{};            //!< 下标掩码，容量 - 1
+
+    alignas(64) std::atomic<std::size_t> _tail{}; //!< 入队序列号
+    alignas(64) std::atomic<std::size_t> _head{}; //!< 出队序列号
+
+    std::mutex _mtx;                                     //!< 阻塞操作互斥锁
+    std::condition_variable _not_empty;                  //!< 队列非空条件变量
+    std::condition_variable _not_full;                   //!< 队列非满条件变量
+    alignas(64) std::atomic<std::size_t> _pop_waiters{}; //!< 阻塞出队的等待者数目
+    std::atomic<std::size_t> _push_waiters{};            //!< 阻塞入队的等待者数目
+    std::atomic<bool> _closed{};                         //!< 队列是否已关闭
+};
+
+/**
+ * @brief 无锁有界单生产者单消费者队列
+ * @note
+ * - 仅允许一个线程入队、一个线程出队，环形数组配合缓存的对端下标，
+ *   无竞争路径上只有一次原子读写，较 MpmcQueue 更快
+ * @note
+ * - 接口与 MpmcQueue 的非阻塞、批量子集一致，出队提供阻塞变体
+ *
+ * @tparam Tp 元素类型
+ */
+template <typename Tp>
+class SpscQueue
+{
+public:
+    /**
+     * @brief 创建队列
+     *
+     * @param[in] capacity 队列容量，内部向上取整至 2 的幂
+     */
+    explicit SpscQueue(std::size_t capacity)
+    {
+        RMVL_Assert(capacity > 0);
+        std::size_t num = 2;
+        while (num < capacity)
+            num <<= 1;
+        _data = std::make_unique<Tp[]>(num);
+        _mask = num - 1;
+    }
+
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    //! 队列容量
+    std::size_t capacity() const { return _mask + 1; }
+
+    /**
+     * @brief 尝试入队（非阻塞），仅生产者线程可调用
+     *
+     * @param[in] val 待入队的元素
+     * @return 入队是否成功，队列已满或已关闭时返回 `false`
+     */
+    bool try_push(const Tp &val)
+    {
+        Tp tmp = val;
+        return pushImpl(tmp);
+    }
+
+    /**
+     * @brief 尝试入队（非阻塞），失败时不消耗入参，仅生产者线程可调用
+     *
+     * @param[in] val 待入队的元素
+     * @return 入队是否成功，队列已满或已关闭时返回 `false`
+     */
+    bool try_push(Tp &&val) { return pushImpl(val); }
+
+    /**
+     * @brief 尝试出队（非阻塞），仅消费者线程可调用
+     *
+     * @param[out] val 出队的元素
+     * @return 出队是否成功，队列为空时返回 `false`
+     */
+    bool try_pop(Tp &val)
+    {
+        std::size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _tail_cache)
+        {
+            _tail_cache = _tail.load(std::memory_order_acquire);
+            if (head == _tail_cache)
+                return false;
+        }
+        val = std::move(_data[head & _mask]);
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 批量尝试入队（非阻塞），仅生产者线程可调用
+     *
+     * @param[in] first 待入队区间的起始迭代器
+     * @param[in] last 待入队区间的结束迭代器
+     * @return 实际入队的元素个数
+     */
+    template <typename InputIt>
+    std::size_t try_push(InputIt first, InputIt last)
+    {
+        std::size_t num{};
+        for (; first != last && try_push(*first); ++first)
+            ++num;
+        return num;
+    }
+
+    /**
+     * @brief 批量尝试出队（非阻塞），仅消费者线程可调用
+     *
+     * @param[out] out 出队元素的输出迭代器
+     * @param[in] max 最大出队元素个数
+     * @return 实际出队的元素个数
+     */
+    template <typename OutputIt>
+    std::size_t try_pop(OutputIt out, std::size_t max)
+    {
+        std::size_t num{};
+        for (Tp val; num < max && try_pop(val); ++num)
+            *out++ = std::move(val);
+        return num;
+    }
+
+    /**
+     * @brief 出队（阻塞），队列为空时等待数据，仅消费者线程可调用
+     *
+     * @param[out] val 出队的元素
+     * @return 出队是否成功，队列已关闭且排空后返回 `false`
+     */
+    bool pop(Tp &val)
+    {
+        if (try_pop(val))
+            return true;
+        std::unique_lock<std::mutex> lock(_mtx);
+        ++_pop_waiters;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (;;)
+        {
+            if (try_pop(val))
+            {
+                --_pop_waiters;
+                return true;
+            }
+            if (_closed.load(std::memory_order_relaxed))
+            {
+                --_pop_waiters;
+                return false;
+            }
+            _not_empty.wait(lock);
+        }
+    }
+
+    //! 关闭队列，入队立即失败，出队在排空后失败，唤醒阻塞的消费者
+    void close()
+    {
+        _closed.store(true, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(_mtx);
+        _not_empty.notify_all();
+    }
+
+private:
+    //! 入队实现，仅在成功时消耗入参
+    bool pushImpl(Tp &val)
+    {
+        if (_closed.load(std::memory_order_relaxed))
+            return false;
+        std::size_t tail = _tail.load(std::memory_order_relaxed);
+        // 本地缓存的消费端下标足够判断非满时，无需再次读取对端
+        if (tail - _head_cache > _mask)
+        {
+            _head_cache = _head.load(std::memory_order_acquire);
+            if (tail - _head_cache > _mask)
+                return false;
+        }
+        _data[tail & _mask] = std::move(val);
+        _tail.store(tail + 1, std::memory_order_release);
+        // 与等待者递增计数后的屏障配对，见 MpmcQueue::wake
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_pop_waiters.load(std::memory_order_relaxed) != 0)
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _not_empty.notify_one();
+        }
+        return true;
+    }
+
+    std::unique_ptr<Tp[]> _data; //!< 环形数组
+    std::size_t _mask{};         //!< 下标掩码，容量 - 1
+
+    alignas(64) std::atomic<std::size_t> _tail{}; //!< 入队下标，生产者独占写
+    std::size_t _head_cache{};                    //!< 生产者本地缓存的出队下标
+    alignas(64) std::atomic<std::size_t> _head{}; //!< 出队下标，消费者独占写
+    std::size_t _tail_cache{};                    //!< 消费者本地缓存的入队下标
+
+    std::mutex _mtx;                                     //!< 阻塞操作互斥锁
+    std::condition_variable _not_empty;                  //!< 队列非空条件变量
+    alignas(64) std::atomic<std::size_t> _pop_waiters{}; //!< 阻塞出队的等待者数目
+    std::atomic<bool> _closed{};                         //!< 队列是否已关闭
+};
+
+//! @} core
+
+} // namespace rm
@@ -0,0 +1,262 @@
+/**
+ * @file smallvec.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 内置容量小向量
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+namespace rm
+{
+
+//! @addtogroup core
+//! @{
+
+/**
+ * @brief 内置容量小向量
+ * @note
+ * - 前 `N` 个元素存储在对象内部的预留空间中，不产生堆分配，超出后退化为与
+ *   `std::vector` 一致的堆上倍增扩容，适用于逐帧构造、元素个数通常很小的列表
+ * @note
+ * - 提供 `std::vector` 的常用子集接口，迭代器为裸指针，可直接用于标准算法
+ *
+ * @tparam Tp 元素类型
+ * @tparam N 内置容量，即不产生堆分配的最大元素个数
+ */
+template <typename Tp, std::size_t N>
+class SmallVector
+{
+    static_assert(N > 0, "Inline capacity of the \"SmallVector\" must be positive");
+
+public:
+    using value_type = Tp;
+    using iterator = Tp *;
+    using const_iterator = const Tp *;
+
+    SmallVector() = default;
+
+    SmallVector(const SmallVector &sv) { assign(sv.begin(), sv.end()); }
+
+    SmallVector(SmallVector &&sv) noexcept { moveFrom(std::move(sv)); }
+
+    SmallVector(std::initializer_list<Tp> il) { assign(il.begin(), il.end()); }
+
+    ~SmallVector() { destroy(); }
+
+    SmallVector &operator=(const SmallVector &sv)
+    {
+        if (this != &sv)
+        {
+            clear();
+            assign(sv.begin(), sv.end());
+        }
+        return *this;
+    }
+
+    SmallVector &operator=(SmallVector &&sv) noexcept
+    {
+        if (this != &sv)
+        {
+            destroy();
+            moveFrom(std::move(sv));
+        }
+        return *this;
+    }
+
+    //! 元素个数
+    std::size_t size() const { return _size; }
+    //! 是否为空
+    bool empty() const { return _size == 0; }
+    //! 当前容量
+    std::size_t capacity() const { return _capacity; }
+
+    iterator begin() { return _data; }
+    const_iterator begin() const { return _data; }
+    iterator end() { return _data + _size; }
+    const_iterator end() const { return _data + _size; }
+
+    Tp &operator[](std::size_t idx) { return _data[idx]; }
+    const Tp &operator[](std::size_t idx) const { return _data[idx]; }
+    Tp &front() { return _data[0]; }
+    const Tp &front() const { return _data[0]; }
+    Tp &back() { return _data[_size - 1]; }
+    const Tp &back() const { return _data[_size - 1]; }
+
+    /**
+     * @brief 预留不少于指定元素个数的容量
+     *
+     * @param[in] num 元素个数
+     */
+    void reserve(std::size_t num)
+    {
+        if (num > _capacity)
+            grow(num);
+    }
+
+    //! 清空所有元素，不释放已分配的空间
+    void clear()
+    {
+        for (std::size_t i = 0; i < _size; ++i)
+            _data[i].~Tp();
+        _size = 0;
+    }
+
+    /**
+     * @brief 在尾部追加元素
+     *
+     * @param[in] val 待追加的元素
+     */
+    void push_back(const Tp &val) { emplace_back(val); }
+
+    /**
+     * @brief 在尾部就地构造元素
+     *
+     * @param[in] args 元素构造参数
+     * @return 构造出的元素的引用
+     */
+    template <typename... Args>
+    Tp &emplace_back(Args &&...args)
+    {
+        if (_size == _capacity)
+            grow(_capacity << 1);
+        new (_data + _size) Tp(std::forward<Args>(args)...);
+        return _data[_size++];
+    }
+
+    /**
+     * @brief 在指定位置前插入一段元素
+     *
+     * @param[in] pos 插入位置
+     * @param[in] first 待插入区间的起始迭代器
+     * @param[in] last 待插入区间的结束迭代器
+     * @return 指向首个插入元素的迭代器
+     */
+    template <typename InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        std::size_t idx = pos - _data;
+        std::size_t num = std::distance(first, last);
+        if (num == 0)
+            return _data + idx;
+        if (_size + num > _capacity)
+            grow(std::max(_size + num, _capacity << 1));
+        // 自尾部逆序后移，腾出插入区间
+        for (std::size_t i = _size; i > idx; --i)
+        {
+            new (_data + i + num - 1) Tp(std::move(_data[i - 1]));
+            _data[i - 1].~Tp();
+        }
+        for (std::size_t i = idx; first != last; ++first, ++i)
+            new (_data + i) Tp(*first);
+        _size += num;
+        return _data + idx;
+    }
+
+    /**
+     * @brief 删除指定区间的元素
+     *
+     * @param[in] first 待删除区间的起始迭代器
+     * @param[in] last 待删除区间的结束迭代器
+     * @return 指向最后被删除元素之后位置的迭代器
+     */
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        std::size_t idx = first - _data, num = last - first;
+        if (num != 0)
+        {
+            std::move(_data + idx + num, _data + _size, _data + idx);
+            for (std::size_t i = _size - num; i < _size; ++i)
+                _data[i].~Tp();
+            _size -= num;
+        }
+        return _data + idx;
+    }
+
+    /**
+     * @brief 删除指定位置的元素
+     *
+     * @param[in] pos 待删除元素的迭代器
+     * @return 指向被删除元素之后位置的迭代器
+     */
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+private:
+    //! 从空状态按区间复制元素
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        reserve(std::distance(first, last));
+        for (; first != last; ++first)
+            new (_data + _size++) Tp(*first);
+    }
+
+    //! 从空状态接管右值，堆上数据直接转移指针，内置数据逐元素移动
+    void moveFrom(SmallVector &&sv) noexcept
+    {
+        if (sv.onHeap())
+        {
+            _data = sv._data;
+            _size = sv._size;
+            _capacity = sv._capacity;
+        }
+        else
+        {
+            for (std::size_t i = 0; i < sv._size; ++i)
+                new (_data + i) Tp(std::move(sv._data[i]));
+            _size = sv._size;
+            sv.clear();
+        }
+        sv._data = reinterpret_cast<Tp *>(sv._inline);
+        sv._size = 0;
+        sv._capacity = N;
+    }
+
+    //! 扩容至不少于指定元素个数的容量
+    void grow(std::size_t num)
+    {
+        std::size_t capacity = std::max(num, N << 1);
+        Tp *data = std::allocator<Tp>{}.allocate(capacity);
+        for (std::size_t i = 0; i < _size; ++i)
+        {
+            new (data + i) Tp(std::move(_data[i]));
+            _data[i].~Tp();
+        }
+        if (onHeap())
+            std::allocator<Tp>{}.deallocate(_data, _capacity);
+        _data = data;
+        _capacity = capacity;
+    }
+
+    //! 元素是否存储在堆上
+    bool onHeap() const { return _data != reinterpret_cast<const Tp *>(_inline); }
+
+    //! 析构所有元素并释放堆空间，回退至空的内置存储状态
+    void destroy()
+    {
+        clear();
+        if (onHeap())
+        {
+            std::allocator<Tp>{}.deallocate(_data, _capacity);
+            _data = reinterpret_cast<Tp *>(_inline);
+            _capacity = N;
+        }
+    }
+
+    alignas(Tp) std::byte _inline[N * sizeof(Tp)];  //!< 内置存储空间
+    Tp *_data{reinterpret_cast<Tp *>(_inline)};     //!< 元素首地址
+    std::size_t _size{};                            //!< 元素个数
+    std::size_t _capacity{N};                       //!< 当前容量
+};
+
+//! @} core
+
+} // namespace rm
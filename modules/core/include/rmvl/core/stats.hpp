@@ -0,0 +1,213 @@
+/**
+ * @file stats.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 运行时耗时统计模块
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <vector>
+
+#include "pmu.hpp"
+#include "str.hpp"
+#include "timer.hpp"
+
+//! @addtogroup core
+//! @{
+//! @defgroup core_stats 运行时耗时统计模块
+//! @}
+
+namespace rm::stats
+{
+
+//! @addtogroup core_stats
+//! @{
+
+//! 统计通道，内部结构对使用者不可见
+struct StageStats;
+
+//! @cond
+inline std::atomic<bool> _stats_active{};
+inline std::atomic<bool> _stats_pmu_active{};
+
+void record(StageStats &stats, double duration, std::size_t depth);
+void record(StageStats &stats, double duration, std::size_t depth, const PmuCounts &pmu);
+bool pmuSnapshot(PmuCounts &counts) noexcept;
+//! @endcond
+
+//! 耗时统计是否处于启动状态
+inline bool active() noexcept { return _stats_active.load(std::memory_order_relaxed); }
+
+//! 硬件性能计数采样是否处于启动状态
+inline bool pmuActive() noexcept { return _stats_pmu_active.load(std::memory_order_relaxed); }
+
+//! 启动耗时统计，已有通道中的历史采样被保留
+void start();
+
+//! 停止耗时统计，通道与已有采样保留，可继续通过 `summary()` 导出
+void stop();
+
+/**
+ * @brief 启动硬件性能计数采样
+ * @note 在耗时统计的基础上，探针额外在区段两端采样 rm::PmuCounters 硬件计数器，
+ *       摘要中给出各通道的 IPC 与缓存、分支 MPKI，用于区分访存受限与计算受限的
+ *       耗时回归。硬件计数器不可用时采样自动退化为纯耗时统计，对应指标为 0
+ */
+void startPmu();
+
+//! 停止硬件性能计数采样，耗时统计不受影响
+void stopPmu();
+
+/**
+ * @brief 按名称获取统计通道，不存在时自动创建
+ * @note 通道在进程生命周期内保留，首次获取后可缓存返回的引用，热路径查找开销为零
+ *
+ * @param[in] name 通道名称
+ * @return 统计通道
+ */
+StageStats &channel(std::string_view name);
+
+/**
+ * @brief 按实例获取统计通道，不存在时自动创建
+ * @note 通道名称由阶段名、动态类型名与对象地址组成，同一阶段的不同实例互不干扰
+ *
+ * @tparam Tp 对象类型
+ * @param[in] stage 阶段名称
+ * @param[in] obj 对象指针
+ * @return 统计通道
+ */
+template <typename Tp>
+inline StageStats &instanceChannel(const char *stage, const Tp *obj)
+{
+    char name[96];
+    return channel(str::format_to(name, "%s/%s@%p", stage, typeid(*obj).name(), static_cast<const void *>(obj)));
+}
+
+/**
+ * @brief 作用域耗时探针
+ * @note 构造时记录起始时刻，析构时将持续时间与队列深度写入统计通道，统计未启动时
+ *       构造空探针，除一次原子读外无额外开销
+ */
+class Probe
+{
+public:
+    Probe() = default;
+
+    /**
+     * @brief 创建作用域耗时探针
+     *
+     * @param[in] stats 统计通道
+     * @param[in] depth 当前队列深度
+     */
+    Probe(StageStats &stats, std::size_t depth) : _stats(&stats), _depth(depth), _start(Timer::now())
+    {
+        if (pmuActive())
+            _has_pmu = pmuSnapshot(_pmu_start);
+    }
+
+    Probe(const Probe &) = delete;
+    Probe &operator=(const Probe &) = delete;
+    Probe(Probe &&other) noexcept : _stats(other._stats), _depth(other._depth), _start(other._start), _pmu_start(other._pmu_start), _has_pmu(other._has_pmu) { other._stats = nullptr; }
+    Probe &operator=(Probe &&) = delete;
+
+    ~Probe()
+    {
+        if (_stats == nullptr)
+            return;
+        if (PmuCounts pmu_end{}; _has_pmu && pmuSnapshot(pmu_end))
+            record(*_stats, Timer::now() - _start, _depth, pmu_end - _pmu_start);
+        else
+            record(*_stats, Timer::now() - _start, _depth);
+    }
+
+private:
+    StageStats *_stats{};  //!< 统计通道，空探针时为空
+    std::size_t _depth{};  //!< 队列深度
+    double _start{};       //!< 起始时刻
+    PmuCounts _pmu_start{}; //!< 起始硬件计数快照
+    bool _has_pmu{};       //!< 起始快照是否有效
+};
+
+//! 统计通道摘要
+struct Summary
+{
+    std::size_t count{}; //!< 采样次数
+    double mean{};       //!< 平均耗时（单位：s）
+    double min{};        //!< 最小耗时（单位：s）
+    double max{};        //!< 最大耗时（单位：s）
+    double p50{};        //!< 耗时中位数（单位：s）
+    double p90{};        //!< 耗时 90 分位数（单位：s）
+    double p99{};        //!< 耗时 99 分位数（单位：s）
+    std::size_t depth{}; //!< 最近一次队列深度
+    // 以下指标由硬件性能计数采样得出，未启动或硬件计数器不可用时为 0
+    double ipc{};         //!< 每周期指令数
+    double cache_mpki{};  //!< 千条指令缓存缺失数
+    double branch_mpki{}; //!< 千条指令分支预测失败数
+};
+
+/**
+ * @brief 导出指定通道的统计摘要
+ * @note 分位数由最近若干次采样计算得出，早于环形缓冲区容量的采样仅参与计数与均值
+ *
+ * @param[in] name 通道名称
+ * @return 统计摘要，通道不存在时 `count` 为 `0`
+ */
+Summary summary(std::string_view name);
+
+//! 按通道名称字典序导出所有通道的统计摘要
+std::vector<std::pair<std::string, Summary>> exportAll();
+
+//! 清空所有通道的采样数据，已缓存的通道引用保持有效
+void reset();
+
+//! 单个预算条目的核对结果
+struct BudgetDiff
+{
+    std::string stage; //!< 预算条目名称
+    double budget{};   //!< 机器档归一化后的预算（单位：s）
+    double measured{}; //!< 实测 p90 耗时（单位：s），无匹配采样时为 0
+    bool over{};       //!< 是否超出预算，无匹配采样的条目视为超出
+};
+
+/**
+ * @brief 实测标定负载耗时，用于预算核对的机器档归一化（单位：s）
+ * @note 标定负载为固定迭代次数的整数串行运算，耗时与本机单核速度成反比，多次运行
+ *       取最小值以抑制调度噪声
+ */
+double calibration();
+
+/**
+ * @brief 按预算文件核对各通道的统计摘要
+ * @note
+ * - 预算文件为纯文本，每行一条 `<条目名> = <预算耗时/ms>`，`#` 起始为注释。条目名与
+ *   通道名按前缀匹配（前缀后需为 `/`、`@` 或名称结尾），因此条目 `detector` 可约束全部
+ *   `detector/...` 实例通道，多个通道匹配同一条目时取其中最大的 p90
+ * @note
+ * - 保留条目 `calibration` 记录生成预算时参考机的标定负载耗时（单位：ms），核对前将
+ *   各预算按本机与参考机标定耗时之比缩放，实现机器档归一化；缺省时预算按原值核对
+ *
+ * @param[in] path 预算文件路径
+ * @return 各条目的核对结果，按文件顺序排列，文件无法读取时为空
+ */
+std::vector<BudgetDiff> checkBudget(std::string_view path);
+
+/**
+ * @brief 生成预算核对的对比报告
+ *
+ * @param[in] diffs 预算核对结果
+ * @return 多行文本报告，超出预算的条目行尾以 `EXCEEDED` 标注
+ */
+std::string budgetReport(const std::vector<BudgetDiff> &diffs);
+
+//! @} core_stats
+
+} // namespace rm::stats
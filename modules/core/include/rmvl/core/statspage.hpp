@@ -0,0 +1,90 @@
+/**
+ * @file statspage.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 共享内存统计页
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+//! @addtogroup core
+//! @{
+//! @defgroup core_statspage 共享内存统计页
+//! @{
+//! @brief 面向外部监控进程的零开销实时遥测
+//! @brief
+//! - 进程内各组件将运行时指标（采集帧率、预取队列深度、各阶段耗时等）以松弛原子
+//!   写入一块固定布局的共享内存页，外部进程（如运维看板采集端）直接映射同一页面
+//!   按固定偏移读取，读取不经过任何 RMVL 代码路径，对生产者的开销仅为一次松弛
+//!   原子存储，无系统调用，亦无需轮询 @ref opcua 服务器
+//! @brief
+//! - 页面布局：`16` 字节页头（`uint32` 魔数 `"RMST"`、`uint32` 版本号、`uint64`
+//!   字段数）后跟各字段，字段 `i` 为位于偏移 \f$16 + 8i\f$ 处的 `uint64`，外部
+//!   读取方以魔数判定页面就绪，按 rm::stats::PageField 枚举值计算偏移
+//! @brief
+//! - 页面映射失败（或非 Linux 平台）时自动退化为进程内静态页，生产者接口行为
+//!   不变，仅外部进程不可见
+//! @} core_statspage
+//! @}
+
+namespace rm::stats
+{
+
+//! @addtogroup core_statspage
+//! @{
+
+//! 统计页字段，字段 `i` 位于页内偏移 \f$16 + 8i\f$ 处
+enum class PageField : std::size_t
+{
+    CAPTURE_FRAMES,  //!< 累计采集帧数
+    CAPTURE_FPS,     //!< 采集帧率滑动均值（单位：0.001 fps）
+    QUEUE_DEPTH,     //!< 采集预取队列深度
+    DETECT_TIME,     //!< 最近一帧识别阶段耗时（单位：μs）
+    COMPENSATE_TIME, //!< 最近一帧补偿阶段耗时（单位：μs）
+    PREDICT_TIME,    //!< 最近一帧预测阶段耗时（单位：μs）
+    DECIDE_TIME,     //!< 最近一帧决策阶段耗时（单位：μs）
+    FRAME_TIME,      //!< 最近一帧流水线总耗时（单位：μs）
+    FIELD_NUM        //!< 字段数
+};
+
+//! 统计页是否成功映射至共享内存，`false` 表示已退化为进程内静态页
+bool pageActive() noexcept;
+
+//! 统计页的共享内存文件路径，非 Linux 平台返回空字符串
+const char *pagePath() noexcept;
+
+/**
+ * @brief 写入统计页字段
+ * @note 仅一次松弛原子存储，可在热路径中无条件调用
+ *
+ * @param[in] field 统计页字段
+ * @param[in] value 字段值
+ */
+void pageSet(PageField field, uint64_t value) noexcept;
+
+/**
+ * @brief 累加统计页字段
+ *
+ * @param[in] field 统计页字段
+ * @param[in] delta 增量
+ */
+void pageAdd(PageField field, uint64_t delta) noexcept;
+
+/**
+ * @brief 读取统计页字段，供进程内调试与测试使用，外部进程应直接映射页面读取
+ *
+ * @param[in] field 统计页字段
+ * @return 字段值
+ */
+uint64_t pageGet(PageField field) noexcept;
+
+//! @} core_statspage
+
+} // namespace rm::stats
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <cstdio>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -39,13 +40,68 @@ std::vector<std::string> split(std::string_view str, std::string_view delim);
  */
 std::string join(const std::vector<std::string> &strs, std::string_view delim);
 
+/**
+ * @brief 字符串分割（无分配版本）
+ * @note 分割结果以 `std::string_view` 的形式写入调用者提供的定长区间，不产生堆分配，
+ *       可在常量表达式中使用；与 `split` 一致，连续的分割符视为一个
+ *
+ * @param[in] str 待分割的字符串
+ * @param[in] delim 分割符
+ * @param[out] dst 结果区间首地址
+ * @param[in] max_num 结果区间容量，超出容量的子串不写入
+ * @return 分割出的全部子串数目，可与 `max_num` 比较以判断是否发生截断
+ */
+constexpr std::size_t split(std::string_view str, std::string_view delim, std::string_view *dst, std::size_t max_num)
+{
+    std::size_t retval{};
+    std::size_t start = str.find_first_not_of(delim);
+    while (start != std::string_view::npos)
+    {
+        std::size_t index = str.find_first_of(delim, start);
+        if (index == std::string_view::npos)
+            index = str.size();
+        if (retval < max_num)
+            dst[retval] = str.substr(start, index - start);
+        retval++;
+        start = str.find_first_not_of(delim, index);
+    }
+    return retval;
+}
+
 /**
  * @brief 去除字符串两端的空白字符
  *
  * @param[in] str 待处理的字符串
  * @return 处理后的字符串
  */
-std::string_view strip(std::string_view str);
+constexpr std::string_view strip(std::string_view str)
+{
+    constexpr std::string_view spaces = " \t\n\r";
+    std::size_t str_begin = str.find_first_not_of(spaces);
+    if (str_begin == std::string_view::npos)
+        return {};
+    return str.substr(str_begin, str.find_last_not_of(spaces) + 1 - str_begin);
+}
+
+/**
+ * @brief 格式化写入栈缓冲区
+ * @note `printf` 风格的无分配格式化，结果截断至缓冲区容量，适用于节点路径拼接等高频小字符串场景
+ *
+ * @tparam N 缓冲区容量
+ * @tparam Args 格式化参数类型列表
+ * @param[out] buf 栈缓冲区
+ * @param[in] fmt 格式化字符串
+ * @param[in] args 格式化参数
+ * @return 指向 `buf` 的字符串视图，格式化失败时为空
+ */
+template <std::size_t N, typename... Args>
+inline std::string_view format_to(char (&buf)[N], const char *fmt, Args... args)
+{
+    int num = std::snprintf(buf, N, fmt, args...);
+    if (num < 0)
+        return {};
+    return {buf, num < static_cast<int>(N) ? static_cast<std::size_t>(num) : N - 1};
+}
 
 /**
  * @brief 将字符串转换为小写
@@ -0,0 +1,120 @@
+/**
+ * @file thread_pool.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 共享线程池服务
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "rmvldef.hpp"
+
+namespace rm
+{
+
+//! @addtogroup core
+//! @{
+
+//! 任务优先级通道
+enum class TaskLane
+{
+    Normal, //!< 普通任务
+    High    //!< 高优先级任务，所有工作线程优先执行，用于识别等热路径
+};
+
+/**
+ * @brief 共享线程池服务
+ * @note
+ * - 各模块的并行处理统一从共享线程池取用工作线程，避免各自创建线程导致的核心超额订阅，
+ *   可通过 `global()` 获取全局实例
+ * @note
+ * - 普通任务轮转分发至各工作线程的本地队列，空闲的工作线程从其他线程的队列中窃取任务，
+ *   高优先级任务进入独立通道，被所有工作线程优先执行
+ * @note
+ * - 支持将工作线程绑定至 CPU 核心，减少任务在核心间迁移带来的缓存失效
+ */
+class RMVL_EXPORTS ThreadPool
+{
+public:
+    /**
+     * @brief 创建线程池
+     *
+     * @param[in] workers 工作线程数目，为 `0` 时取硬件并发数 `- 1`，即为参与执行的提交线程保留一个核心
+     * @param[in] pin 是否将工作线程依次绑定至 CPU 核心
+     */
+    explicit ThreadPool(std::size_t workers = 0, bool pin = false);
+
+    //! 等待所有已提交任务完成并停止工作线程
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    //! 工作线程数目
+    std::size_t size() const { return _workers.size(); }
+
+    /**
+     * @brief 提交任务
+     *
+     * @param[in] task 任务可调用对象
+     * @param[in] lane 任务优先级通道
+     */
+    void submit(std::function<void()> task, TaskLane lane = TaskLane::Normal);
+
+    /**
+     * @brief 并行执行区间任务，阻塞直至整个区间处理完毕
+     * @note
+     * - 区间被划分为若干连续子区间，由工作线程与当前线程共同自调度执行，任务体中抛出的
+     *   rm::Exception 等异常在全部子区间结束后于当前线程重新抛出（仅保留首个）
+     * @note
+     * - 可在任务体中嵌套调用，当前线程始终参与执行，不会因线程池繁忙而死锁
+     *
+     * @param[in] begin 区间起始（含）
+     * @param[in] end 区间结束（不含）
+     * @param[in] body 子区间处理可调用对象，形参为子区间的起始与结束
+     * @param[in] lane 任务优先级通道
+     */
+    void parallel_for(std::size_t begin, std::size_t end, const std::function<void(std::size_t, std::size_t)> &body,
+                      TaskLane lane = TaskLane::Normal);
+
+    //! 获取全局线程池实例
+    static ThreadPool &global();
+
+private:
+    //! 工作线程及其本地任务队列
+    struct Worker
+    {
+        std::deque<std::function<void()>> tasks; //!< 本地任务队列
+        std::thread thread;                      //!< 工作线程
+    };
+
+    //! 工作线程主循环
+    void work(std::size_t idx);
+
+    //! 取出一个待执行任务（需持有锁），优先级：高优先级通道 > 本地队列 > 窃取其他队列
+    bool take(std::size_t idx, std::function<void()> &task);
+
+    std::vector<std::unique_ptr<Worker>> _workers; //!< 所有工作线程
+    std::deque<std::function<void()>> _high;       //!< 高优先级任务通道
+    std::mutex _mtx;                               //!< 任务队列互斥锁
+    std::condition_variable _cv;                   //!< 任务到达条件变量
+    std::size_t _round{};                          //!< 普通任务轮转分发下标
+    bool _pin{};                                   //!< 是否绑定 CPU 核心
+    bool _stop{};                                  //!< 线程池是否停止
+};
+
+//! @} core
+
+} // namespace rm
@@ -2,7 +2,7 @@
  * @file timer.hpp
  * @author zhaoxi (535394140@qq.com)
  * @brief 定时、计时模块
- * @version 1.0
+ * @version 1.1
  * @date 2023-10-16
  *
  * @copyright Copyright 2023 (c), zhaoxi
@@ -11,7 +11,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 #include "rmvldef.hpp"
 
@@ -30,6 +40,15 @@ namespace rm
  * @brief 定时器
  * @brief
  * - 在程序开始时调用 `reset()` 函数，之后调用 `now()` 函数即可返回从构造初期到现在经过的时间
+ * @brief
+ * - `now()` 基于硬件计数器（x86 的 `rdtsc`、AArch64 的 `cntvct_el0`）实现，并周期性使用
+ *   `steady_clock` 重新标定计数器频率，单次调用仅需数个时钟周期
+ * @brief
+ * - `now()` 可跨线程并发调用，标定结果经序列锁作为整体快照发布，读者不会观察到
+ *   撕裂的频率估计
+ * @brief
+ * - 对同一帧内的大量计时需求，可在每帧开始时调用一次 `sync()`，之后使用 `frame()`
+ *   获取缓存的帧时间戳，避免重复计时
  */
 class RMVL_EXPORTS_W Timer
 {
@@ -40,16 +59,206 @@ public:
     Timer(const Timer &) = delete;
     void operator=(const Timer &) = delete;
 
-    //! 重置定时器
-    RMVL_W static void reset() { _tick = steady_clock::now(); }
+    //! 重置定时器，需在各工作线程启动前调用
+    RMVL_W static void reset()
+    {
+        // 写侧：序号置奇独占标定快照，与可能仍在运行的读者互斥
+        uint32_t seq{};
+        do
+            seq = _seq.load(std::memory_order_relaxed) & ~1u;
+        while (!_seq.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire));
+        _tick = steady_clock::now();
+        _reset_tick = tick();
+        _calib_tick.store(_reset_tick, std::memory_order_relaxed);
+        _calib_time.store(0, std::memory_order_relaxed);
+        _period.store(0, std::memory_order_relaxed);
+        _recalib.store(0, std::memory_order_relaxed);
+        _frame.store(0, std::memory_order_relaxed);
+        _seq.store(seq + 2, std::memory_order_release);
+    }
+
     //! 返回从构造初期到现在经过的时间（单位：s）
-    RMVL_W static double now() { return std::chrono::duration_cast<std::chrono::duration<double>>(steady_clock::now() - _tick).count(); }
+    RMVL_W static double now()
+    {
+        uint64_t t = tick();
+        // seqlock 读侧：序号为偶数且前后一致时读取到完整的标定快照
+        uint32_t seq = _seq.load(std::memory_order_acquire);
+        while (!(seq & 1))
+        {
+            uint64_t calib_tick = _calib_tick.load(std::memory_order_relaxed);
+            uint64_t recalib = _recalib.load(std::memory_order_relaxed);
+            double calib_time = _calib_time.load(std::memory_order_relaxed);
+            double period = _period.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (uint32_t cur = _seq.load(std::memory_order_acquire); cur != seq)
+            {
+                seq = cur;
+                continue;
+            }
+            // 快速路径：距上次标定不久，直接按频率估计值换算
+            if (t - calib_tick < recalib)
+                return calib_time + (t - calib_tick) * period;
+            break;
+        }
+        // 标定路径：同时采样硬件计数器与 steady_clock，更新频率估计
+        double real = std::chrono::duration_cast<std::chrono::duration<double>>(steady_clock::now() - _tick).count();
+        // 写侧：序号置奇独占标定快照，竞争失败时直接返回实测时间，不重复标定
+        seq = _seq.load(std::memory_order_relaxed);
+        if ((seq & 1) || !_seq.compare_exchange_strong(seq, seq + 1, std::memory_order_acquire))
+            return real;
+        if (t > _reset_tick && real > 1e-3)
+        {
+            _period.store(real / (t - _reset_tick), std::memory_order_relaxed);
+            // 约每 0.5s 重新标定一次
+            _recalib.store(static_cast<uint64_t>(0.5 * (t - _reset_tick) / real), std::memory_order_relaxed);
+        }
+        _calib_tick.store(t, std::memory_order_relaxed);
+        _calib_time.store(real, std::memory_order_relaxed);
+        _seq.store(seq + 2, std::memory_order_release);
+        return real;
+    }
+
+    //! 刷新缓存的帧时间戳，每帧开始时调用一次
+    RMVL_W static void sync() { _frame.store(now(), std::memory_order_relaxed); }
+    //! 返回最近一次 `sync()` 时刻缓存的帧时间戳（单位：s）
+    RMVL_W static double frame() { return _frame.load(std::memory_order_relaxed); }
 
 private:
+    //! 读取硬件计数器
+    static inline uint64_t tick()
+    {
+#if defined(__x86_64__) || defined(__i386__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t val{};
+        asm volatile("mrs %0, cntvct_el0" : "=r"(val));
+        return val;
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    static std::atomic<uint32_t> _seq;     //!< 标定快照序列锁，标定期间为奇数
     static steady_clock::time_point _tick; //!< 起始时间
+    static uint64_t _reset_tick;           //!< 起始时间对应的计数器读数
+    // 以下标定快照由 _seq 发布，各字段以松散原子操作访问，跨线程读取时整体一致
+    static std::atomic<uint64_t> _calib_tick; //!< 上次标定时的计数器读数
+    static std::atomic<double> _calib_time;   //!< 上次标定时的经过时间
+    static std::atomic<double> _period;       //!< 计数器单个周期的时长（单位：s）
+    static std::atomic<uint64_t> _recalib;    //!< 重新标定间隔（单位：计数器周期）
+    static std::atomic<double> _frame;        //!< 缓存的帧时间戳
 };
 
+inline std::atomic<uint32_t> Timer::_seq = {};
 inline std::chrono::steady_clock::time_point Timer::_tick = {};
+inline uint64_t Timer::_reset_tick = {};
+inline std::atomic<uint64_t> Timer::_calib_tick = {};
+inline std::atomic<double> Timer::_calib_time = {};
+inline std::atomic<double> Timer::_period = {};
+inline std::atomic<uint64_t> Timer::_recalib = {};
+inline std::atomic<double> Timer::_frame = {};
+
+/**
+ * @brief 高精度等待服务
+ * @brief
+ * - 操作系统睡眠的唤醒抖动通常在 ±1ms 量级，对 5ms 帧周期即 20% 的时序噪声。本服务采用
+ *   粗睡眠 + 有界自旋的混合策略：先以系统睡眠逼近至护带（guard band）以内，剩余时间在
+ *   硬件计数器（rm::Timer 时间轴）上自旋至到期，唤醒精度可达微秒量级
+ * @brief
+ * - 护带宽度在首次使用时按本平台实测的睡眠唤醒超调自动标定，自旋时长不超过护带宽度，
+ *   等待期间的 CPU 占用有界，适用于触发调度与控制环的周期节拍
+ * @code{.cpp}
+ * double next = rm::Timer::now();
+ * while (running)
+ * {
+ *     next += 0.005; // 5ms 帧周期
+ *     rm::PreciseWait::until(next);
+ *     ... // 帧处理
+ * }
+ * @endcode
+ */
+class RMVL_EXPORTS_W PreciseWait
+{
+public:
+    //! @cond
+    PreciseWait() = delete;
+    //! @endcond
+
+    /**
+     * @brief 等待至 rm::Timer 时间轴上的指定时刻
+     * @note 已过期的时刻立即返回
+     *
+     * @param[in] deadline 目标时刻，与 rm::Timer::now() 同一时间轴（单位：s）
+     */
+    RMVL_W static void until(double deadline)
+    {
+        const double guard = guardBand();
+        // 粗睡眠：以系统睡眠逼近至护带以内，唤醒超调由护带吸收
+        double remaining = deadline - Timer::now();
+        while (remaining > guard)
+        {
+            std::this_thread::sleep_for(std::chrono::duration<double>(remaining - guard));
+            remaining = deadline - Timer::now();
+        }
+        // 有界自旋：剩余时间不超过护带宽度，在硬件计数器上自旋至到期
+        while (Timer::now() < deadline)
+            relax();
+    }
+
+    /**
+     * @brief 等待指定时长
+     *
+     * @param[in] duration 等待时长（单位：s）
+     */
+    RMVL_W static void sleep(double duration) { until(Timer::now() + duration); }
+
+    /**
+     * @brief 当前护带宽度（单位：s）
+     * @note 首次调用时标定：实测若干次短睡眠的唤醒超调取最大值并附加裕量，
+     *       结果限制在 `[50µs, 5ms]` 内
+     */
+    RMVL_W static double guardBand()
+    {
+        double guard = _guard.load(std::memory_order_relaxed);
+        if (guard > 0.)
+            return guard;
+        // 并发首次调用时重复标定无害，结果相互覆盖
+        guard = calibrate();
+        _guard.store(guard, std::memory_order_relaxed);
+        return guard;
+    }
+
+private:
+    //! 自旋等待提示，降低同核超线程争用与功耗
+    static inline void relax()
+    {
+#if defined(__x86_64__) || defined(__i386__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    //! 实测短睡眠的唤醒超调，标定护带宽度
+    static double calibrate()
+    {
+        double overshoot = 0.;
+        for (int i = 0; i < 5; ++i)
+        {
+            double start = Timer::now();
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+            overshoot = std::max(overshoot, Timer::now() - start - 500e-6);
+        }
+        // 1.5 倍裕量吸收标定之后可能更大的超调，下限覆盖计时颗粒度，上限避免长时间自旋
+        return std::clamp(overshoot * 1.5 + 2e-5, 5e-5, 5e-3);
+    }
+
+    static std::atomic<double> _guard; //!< 护带宽度（单位：s），`0` 表示尚未标定
+};
+
+inline std::atomic<double> PreciseWait::_guard = {};
 
 //! @} core_timer
 
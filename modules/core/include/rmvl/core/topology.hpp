@@ -0,0 +1,98 @@
+/**
+ * @file topology.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief CPU 拓扑与线程亲和性配置服务
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "rmvldef.hpp"
+
+namespace rm
+{
+
+//! @addtogroup core
+//! @{
+
+//! CPU 执行通道
+enum class CpuLane : uint8_t
+{
+    Capture,   //!< 图像捕获通道，适用于相机 SDK 的取流回调线程
+    Detect,    //!< 识别通道，适用于识别、推理等计算热路径
+    Control,   //!< 控制通道，适用于串口收发、预测决策等低延迟路径
+    Background //!< 后台通道，适用于录像、日志等对延迟不敏感的任务
+};
+
+/**
+ * @brief CPU 拓扑与线程亲和性配置服务
+ * @note
+ * - 将整机 CPU 核心划分至若干执行通道，RMVL 创建的线程与相机 SDK 的回调线程统一按
+ *   通道绑定，减少调度迁移带来的缓存失效与帧时间抖动，可通过 `global()` 获取全局实例
+ * @note
+ * - 通道划分需在各线程绑定前完成，未配置的通道不产生任何绑定行为，各接口在不支持
+ *   线程亲和性的平台上均为空操作
+ * @note
+ * - 相机 SDK 自行创建的回调线程无法在创建时绑定，可在首次回调中调用
+ *   `bindCurrentThread` 完成绑定
+ */
+class RMVL_EXPORTS CpuTopology final
+{
+public:
+    //! 获取全局实例
+    static CpuTopology &global();
+
+    /**
+     * @brief 配置执行通道占用的 CPU 核心集合
+     *
+     * @param[in] lane 执行通道
+     * @param[in] cpus CPU 核心编号列表，传入空列表时清除该通道的配置
+     */
+    void setLane(CpuLane lane, const std::vector<int> &cpus);
+
+    /**
+     * @brief 获取执行通道占用的 CPU 核心集合
+     *
+     * @param[in] lane 执行通道
+     * @return CPU 核心编号列表，通道未配置时为空
+     */
+    std::vector<int> lane(CpuLane lane) const;
+
+    /**
+     * @brief 将当前线程绑定至执行通道
+     * @note 设置 CPU 亲和性至通道占用的核心集合，`priority > 0` 时进一步设置
+     *       `SCHED_FIFO` 实时调度及其优先级，实时调度权限不足时仅完成亲和性绑定并输出警告
+     *
+     * @param[in] lane 执行通道
+     * @param[in] priority 实时调度优先级，为 `0` 时不改变调度策略
+     * @return 是否完成亲和性绑定，通道未配置或平台不支持时返回 `false`
+     */
+    bool bindCurrentThread(CpuLane lane, int priority = 0) const noexcept;
+
+    /**
+     * @brief 将指定线程绑定至执行通道
+     *
+     * @param[in] thread 待绑定的线程
+     * @param[in] lane 执行通道
+     * @param[in] priority 实时调度优先级，为 `0` 时不改变调度策略
+     * @return 是否完成亲和性绑定，通道未配置或平台不支持时返回 `false`
+     */
+    bool bindThread(std::thread &thread, CpuLane lane, int priority = 0) const noexcept;
+
+private:
+    mutable std::mutex _mtx;              //!< 通道配置互斥锁
+    std::array<std::vector<int>, 4> _lanes; //!< 各执行通道占用的 CPU 核心集合
+};
+
+//! @} core
+
+} // namespace rm
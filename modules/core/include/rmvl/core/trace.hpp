@@ -0,0 +1,128 @@
+/**
+ * @file trace.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 低开销二进制跟踪模块
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "timer.hpp"
+
+//! @addtogroup core
+//! @{
+//! @defgroup core_trace 低开销二进制跟踪模块
+//! @}
+
+//! @addtogroup core_trace
+//! @{
+
+/**
+ * @brief 写入一条跟踪事件
+ * @note
+ * - 事件以定长二进制记录写入当前线程的无锁环形缓冲区，由后台线程落盘，单次写入开销为
+ *   数十纳秒量级，可常开用于定位偶发的时延抖动
+ * @note
+ * - 跟踪未启动时仅付出一次原子读的开销，可无条件保留在热路径中
+ *
+ * @param[in] id 事件 ID，含义由使用者约定
+ * @param[in] ... 事件参数，不超过 6 个，统一转换为 `double` 存储
+ */
+#define RMVL_TRACE_(id, ...)                    \
+    do                                          \
+    {                                           \
+        if (rm::trace::active())                \
+            rm::trace::emit(id, ##__VA_ARGS__); \
+    } while (false)
+
+//! @} core_trace
+
+namespace rm::trace
+{
+
+//! @addtogroup core_trace
+//! @{
+
+//! 跟踪事件记录，64 字节定长二进制结构
+struct TraceEvent
+{
+    uint32_t id{};   //!< 事件 ID
+    uint32_t argc{}; //!< 有效参数个数
+    double ts{};     //!< 时间戳，即事件发生时刻的 `Timer::now()` 返回值（单位：s）
+    double args[6];  //!< 事件参数
+};
+
+//! @cond
+inline std::atomic<bool> _trace_active{};
+
+void push(const TraceEvent &ev);
+//! @endcond
+
+//! 跟踪是否处于启动状态
+inline bool active() noexcept { return _trace_active.load(std::memory_order_relaxed); }
+
+/**
+ * @brief 启动跟踪
+ * @note
+ * - 后台线程周期性地将各线程环形缓冲区中的事件记录以二进制形式写入指定文件，
+ *   环形缓冲区占满时丢弃新事件而非阻塞热路径，丢弃数目可通过 `dropped()` 获取
+ *
+ * @param[in] file 跟踪文件路径，使用 `read()` 解码
+ */
+void start(std::string_view file);
+
+//! 停止跟踪，将剩余事件全部落盘后关闭跟踪文件
+void stop();
+
+//! 自上次 `start()` 以来因环形缓冲区占满被丢弃的事件数目
+uint64_t dropped() noexcept;
+
+/**
+ * @brief 写入一条跟踪事件
+ * @note 一般通过 `RMVL_TRACE_` 宏间接使用，宏在跟踪未启动时可跳过参数求值
+ *
+ * @tparam Args 参数类型列表，均需可转换为 `double`
+ * @param[in] id 事件 ID，含义由使用者约定
+ * @param[in] args 事件参数，不超过 6 个
+ */
+template <typename... Args>
+inline void emit(uint32_t id, Args... args)
+{
+    static_assert(sizeof...(Args) <= 6, "rm::trace::emit: up to 6 arguments are supported");
+    TraceEvent ev{};
+    ev.id = id;
+    ev.argc = sizeof...(Args);
+    ev.ts = Timer::now();
+    std::size_t i{};
+    ((ev.args[i++] = static_cast<double>(args)), ...);
+    push(ev);
+}
+
+/**
+ * @brief 解码跟踪文件
+ *
+ * @param[in] file 由 `start()` 生成的跟踪文件路径
+ * @return 按落盘顺序排列的事件记录，同一线程的事件保持先后次序
+ */
+std::vector<TraceEvent> read(std::string_view file);
+
+/**
+ * @brief 将单条事件记录格式化为文本
+ *
+ * @param[in] ev 事件记录
+ * @return 形如 `[12.345678] id=3: 1, 2.5` 的字符串
+ */
+std::string format(const TraceEvent &ev);
+
+//! @} core_trace
+
+} // namespace rm::trace
@@ -0,0 +1,84 @@
+/**
+ * @file tuner.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 内核变体启动自调优模块
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//! @addtogroup core
+//! @{
+//! @defgroup core_tuner 内核变体启动自调优模块
+//! @} core
+
+namespace rm::tuner
+{
+
+//! @addtogroup core_tuner
+//! @{
+
+//! 内核变体，名称与该变体的一次执行
+struct Variant
+{
+    std::string name;          //!< 变体名称，作为选优表的持久化键，需在同一内核内唯一
+    std::function<void()> run; //!< 在代表性数据上执行一次该变体的可调用对象
+};
+
+/**
+ * @brief 获取当前 CPU 型号名称
+ * @note 从 `/proc/cpuinfo` 读取，用于区分不同机型的选优表，无法识别时返回 `"unknown"`
+ *
+ * @return CPU 型号名称
+ */
+std::string cpuModel();
+
+/**
+ * @brief 设置选优表的持久化文件路径
+ * @note
+ * - 选优表按 CPU 型号校验，更换机型后缓存自动失效并在下次选优时重建，传入空路径时
+ *   不做持久化，每次进程启动均重新基准测试
+ * @note
+ * - 路径需在首次 `select()` 之前设置，设置时会重新加载选优表
+ *
+ * @param[in] path 选优表文件路径
+ */
+void setCacheFile(std::string_view path);
+
+/**
+ * @brief 在注册的内核变体中基准测试并选出最快者
+ * @note
+ * - 选优表中已有该内核的胜者时直接返回其下标，不做基准测试，否则对各变体预热一次后
+ *   计时若干次取最短耗时，胜者写入选优表并持久化。将返回的下标缓存为函数指针或函数
+ *   局部静态变量后，稳态分发不再有任何额外开销
+ *
+ * @code{.cpp}
+ * // 启动时选优一次，此后 binary 的执行模式即为本机最快者
+ * static rm::PretreatExec exec = [] {
+ *     cv::Mat src(1024, 1280, CV_8UC3), bin;
+ *     std::size_t idx = rm::tuner::select(
+ *         "algorithm/binary",
+ *         {{"serial", [&] { rm::binary(src, bin, rm::RED, rm::BLUE, 80, rm::PretreatExec::Serial); }},
+ *          {"parallel", [&] { rm::binary(src, bin, rm::RED, rm::BLUE, 80, rm::PretreatExec::Parallel); }}});
+ *     return idx == 0 ? rm::PretreatExec::Serial : rm::PretreatExec::Parallel;
+ * }();
+ * @endcode
+ *
+ * @param[in] kernel 内核名称，作为选优表的键
+ * @param[in] variants 内核变体列表，不允许为空
+ * @return 最快变体在 `variants` 中的下标
+ */
+std::size_t select(std::string_view kernel, const std::vector<Variant> &variants);
+
+//! @} core_tuner
+
+} // namespace rm::tuner
@@ -20,6 +20,8 @@
 #include <cstdint>
 #include <cstdio>
 #include <string>
+#include <variant>
+#include <vector>
 
 #include "rmvldef.hpp"
 
@@ -190,6 +192,151 @@ void error(int _code, std::string_view _err, const char *_func, const char *_fil
  */
 const char *getBuildInformation();
 
+//////////////////// 热路径错误处理 ////////////////////
+
+/**
+ * @brief 轻量错误码
+ * @brief
+ * - 适用于以返回值报告错误的 `noexcept` 热路径接口，错误检查编译为一次分支判断，
+ *   不产生异常表与着陆垫，亦不在热路径上触发 `printf` 格式化
+ * @see rm::expected, rm::diagLog
+ */
+enum class Errc : int8_t
+{
+    Unknown,    //!< 未知错误
+    BadArg,     //!< 参数异常
+    BadSize,    //!< 数据大小不正确
+    NullPtr,    //!< 空指针
+    OutOfRange, //!< 数值超出范围
+    InvFmt,     //!< 无效格式
+    IOError,    //!< I/O 读写失败
+    Timeout     //!< 操作超时
+};
+
+//! 获取轻量错误码的文本描述
+const char *to_string(Errc errc) noexcept;
+
+/**
+ * @brief 非预期值包装，用于在 rm::expected 中无歧义地构造错误分支
+ *
+ * @tparam E 错误码类型
+ */
+template <typename E>
+struct unexpected
+{
+    E value; //!< 错误码
+};
+
+//! @cond
+template <typename E>
+unexpected(E) -> unexpected<E>;
+//! @endcond
+
+/**
+ * @brief 预期值类型
+ * @brief
+ * - 持有预期的结果值 `Tp` 或错误码 `E` 二者之一，语义与 C++23 的 `std::expected` 一致，
+ *   作为热路径 `noexcept` 接口的返回值，将错误传播从异常抛出替换为一次分支判断
+ * @code
+ * rm::expected<std::string> foo() noexcept
+ * {
+ *     if (!ok)
+ *         return rm::unexpected{rm::Errc::IOError};
+ *     return data;
+ * }
+ * @endcode
+ *
+ * @tparam Tp 预期的结果值类型
+ * @tparam E 错误码类型，默认为 rm::Errc
+ */
+template <typename Tp, typename E = Errc>
+class expected
+{
+public:
+    //! 从结果值构造
+    constexpr expected(Tp val) : _storage(std::in_place_index<0>, std::move(val)) {}
+    //! 从非预期的错误码构造
+    constexpr expected(unexpected<E> unex) : _storage(std::in_place_index<1>, unex.value) {}
+
+    //! 是否持有结果值
+    constexpr bool has_value() const noexcept { return _storage.index() == 0; }
+    //! 是否持有结果值
+    constexpr explicit operator bool() const noexcept { return has_value(); }
+
+    //! 访问结果值，不持有结果值时行为未定义
+    constexpr Tp &value() noexcept { return *std::get_if<0>(&_storage); }
+    //! 访问结果值，不持有结果值时行为未定义
+    constexpr const Tp &value() const noexcept { return *std::get_if<0>(&_storage); }
+    //! 访问结果值，不持有结果值时行为未定义
+    constexpr Tp &operator*() noexcept { return value(); }
+    //! 访问结果值，不持有结果值时行为未定义
+    constexpr const Tp &operator*() const noexcept { return value(); }
+    //! 访问结果值的成员，不持有结果值时行为未定义
+    constexpr Tp *operator->() noexcept { return std::get_if<0>(&_storage); }
+    //! 访问结果值的成员，不持有结果值时行为未定义
+    constexpr const Tp *operator->() const noexcept { return std::get_if<0>(&_storage); }
+
+    //! 访问错误码，持有结果值时行为未定义
+    constexpr E error() const noexcept { return *std::get_if<1>(&_storage); }
+
+    /**
+     * @brief 获取结果值，不持有结果值时返回指定的默认值
+     *
+     * @param[in] default_val 默认值
+     * @return 结果值或默认值
+     */
+    template <typename U>
+    constexpr Tp value_or(U &&default_val) const { return has_value() ? value() : static_cast<Tp>(std::forward<U>(default_val)); }
+
+private:
+    std::variant<Tp, E> _storage; //!< 结果值或错误码
+};
+
+//! 无结果值的预期值类型特化，适用于仅报告成功与否的操作 @see rm::expected
+template <typename E>
+class expected<void, E>
+{
+public:
+    //! 构造成功状态
+    constexpr expected() = default;
+    //! 从非预期的错误码构造
+    constexpr expected(unexpected<E> unex) : _errc(unex.value), _has_error(true) {}
+
+    //! 是否处于成功状态
+    constexpr bool has_value() const noexcept { return !_has_error; }
+    //! 是否处于成功状态
+    constexpr explicit operator bool() const noexcept { return has_value(); }
+    //! 访问错误码，处于成功状态时行为未定义
+    constexpr E error() const noexcept { return _errc; }
+
+private:
+    E _errc{};         //!< 错误码
+    bool _has_error{}; //!< 是否持有错误码
+};
+
+/**
+ * @brief 向诊断环形缓冲追加一条错误记录
+ * @brief
+ * - 热路径上的错误诊断不宜直接 `printf`：链路抖动期间逐帧的格式化与终端写入本身即
+ *   成为可观测的耗时。本函数仅将错误码与上下文指针存入固定容量的环形缓冲后立即返回，
+ *   文本格式化推迟到 rm::diagDrain 排空时进行，缓冲满时覆盖最早的记录
+ * @note 线程安全，可在多个热路径线程中并发调用
+ *
+ * @param[in] errc 轻量错误码
+ * @param[in] ctx 上下文描述，必须指向静态生存期的字符串（如字符串字面量）
+ */
+void diagLog(Errc errc, const char *ctx) noexcept;
+
+/**
+ * @brief 排空诊断环形缓冲，返回格式化后的错误记录
+ * @brief
+ * - 每条记录形如 `#<序号> [<错误码>] <上下文>`，序号全局单调递增，缓冲溢出导致的
+ *   记录丢失可通过序号跳变发现
+ *
+ * @return 格式化后的错误记录列表，按追加顺序排列
+ */
+RMVL_W std::vector<std::string> diagDrain();
+
 //! @} core
 
 } // namespace rm
@@ -337,7 +484,7 @@ consteval std::size_t size(auto &&...args)
  * @param[in] f 可调用对象
  */
 template <typename Tp, typename Callable>
-inline void for_each(Tp &&val, Callable &&f)
+constexpr void for_each(Tp &&val, Callable &&f)
 {
     static_assert(std::is_aggregate_v<std::remove_reference_t<Tp>>);
     if constexpr (size<std::remove_reference_t<Tp>>() == 12u)
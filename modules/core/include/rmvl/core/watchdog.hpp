@@ -0,0 +1,150 @@
+/**
+ * @file watchdog.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 低开销卡死看门狗服务
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "rmvldef.hpp"
+
+namespace rm
+{
+
+//! @addtogroup core
+//! @{
+
+/**
+ * @brief 低开销卡死看门狗服务
+ * @note
+ * - 相机 SDK 等外部调用卡死时，视觉主循环会在无任何输出的情况下冻结，调用点本身无从
+ *   自救；各管线阶段通过 `beat` 触碰专属的心跳字（一次宽松原子存储，亚纳秒级），监测
+ *   线程按配置的截止时限检查各心跳字是否推进，超时即判定卡死并在监测线程中调用该阶段
+ *   注册的恢复回调（如相机断线重连），实现有界时延的故障检出，无需在每个调用点插入
+ *   计时器
+ * @note
+ * - 阶段在首次 `beat` 后才纳入监测，避免尚未启动的阶段被误判；卡死阶段的心跳恢复推进
+ *   后自动重新武装，再次卡死会再次触发恢复回调
+ * @note
+ * - 恢复回调在监测线程中执行，需自行保证与阶段线程的同步；可通过 `global()` 获取
+ *   全局实例
+ *
+ * @code{.cpp}
+ * auto &watchdog = rm::Watchdog::global();
+ * auto id = watchdog.add("capture", 0.2, [&] { capture.reconnect(); });
+ * watchdog.start();
+ * while (true)
+ * {
+ *     watchdog.beat(id); // 心跳，亚纳秒级开销
+ *     capture.read(frame);
+ *     ...
+ * }
+ * @endcode
+ */
+class RMVL_EXPORTS Watchdog final
+{
+public:
+    //! 可注册的阶段数上限
+    static constexpr std::size_t MAX_STAGES = 64;
+
+    Watchdog() = default;
+    ~Watchdog();
+
+    Watchdog(const Watchdog &) = delete;
+    Watchdog &operator=(const Watchdog &) = delete;
+
+    //! 获取全局实例
+    static Watchdog &global();
+
+    /**
+     * @brief 注册一个受监测的阶段
+     * @note 监测自该阶段首次 `beat` 后开始，恢复回调在监测线程中执行
+     *
+     * @param[in] name 阶段名称，用于卡死告警输出
+     * @param[in] deadline 卡死判定截止时限（单位：s），心跳字超过该时限未推进即判定卡死
+     * @param[in] on_stall 恢复回调，可为空
+     * @return 阶段号，供 `beat` 等接口使用
+     */
+    std::size_t add(std::string_view name, double deadline, std::function<void()> on_stall = {});
+
+    /**
+     * @brief 阶段心跳，推进指定阶段的心跳字
+     * @note 单次宽松原子存储，可在热路径中逐帧甚至逐次调用；每个阶段的心跳字应只由
+     *       该阶段所在的单一线程推进
+     *
+     * @param[in] id 阶段号
+     */
+    void beat(std::size_t id) noexcept
+    {
+        auto &word = _stages[id].beat;
+        word.store(word.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 指定阶段当前是否处于卡死状态
+     *
+     * @param[in] id 阶段号
+     */
+    bool stalled(std::size_t id) const noexcept { return _stages[id].is_stalled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 指定阶段累计的卡死次数
+     *
+     * @param[in] id 阶段号
+     */
+    std::size_t stalls(std::size_t id) const noexcept { return _stages[id].stall_count.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 启动卡死监测
+     *
+     * @param[in] period 心跳检查周期（单位：s），决定故障检出时延的上界为
+     *                   `deadline + period`，默认为 `0.01`
+     */
+    void start(double period = 0.01);
+
+    //! 停止卡死监测，已注册的阶段保留，可再次启动
+    void stop();
+
+private:
+    //! 检查所有阶段的心跳推进情况，超时阶段触发恢复回调
+    void check(double now);
+
+    //! 受监测的阶段
+    struct Stage
+    {
+        std::atomic<uint64_t> beat{};            //!< 心跳字，由阶段线程推进
+        std::atomic<bool> is_stalled{};          //!< 当前是否卡死
+        std::atomic<std::size_t> stall_count{};  //!< 累计卡死次数
+        double deadline{};                       //!< 卡死判定截止时限
+        std::function<void()> on_stall;          //!< 恢复回调
+        std::string name;                        //!< 阶段名称
+        uint64_t seen{};                         //!< 监测线程最近观察到的心跳字
+        double seen_time{};                      //!< 心跳字最近一次推进的观察时刻
+    };
+
+    //! 阶段表（定长预分配，`beat` 无锁访问）
+    std::array<Stage, MAX_STAGES> _stages;
+    std::atomic<std::size_t> _count{}; //!< 已注册的阶段数
+
+    mutable std::mutex _mtx;     //!< 保护注册与启停
+    std::condition_variable _cv; //!< 停止通知条件变量
+    std::thread _thread;         //!< 监测线程
+    bool _running{};             //!< 监测线程是否运行
+};
+
+//! @} core
+
+} // namespace rm
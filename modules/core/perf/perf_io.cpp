@@ -0,0 +1,38 @@
+/**
+ * @file perf_io.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 数据 IO 与通信基准测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "rmvl/core/io.hpp"
+
+namespace rm_test
+{
+
+// 命名管道一写一读往返，衡量进程间通信链路的单次收发开销
+static void pipe_round_trip(benchmark::State &state)
+{
+    rm::PipeServer server("perf_io_pipe");
+    rm::PipeClient client("perf_io_pipe");
+    std::string payload(static_cast<std::size_t>(state.range(0)), 'A');
+    std::string data;
+    for (auto _ : state)
+    {
+        client.write(payload);
+        server.read(data);
+        benchmark::DoNotOptimize(data);
+    }
+}
+
+BENCHMARK(pipe_round_trip)->Name("named pipe round trip - by rmvl")->Arg(64)->Arg(1024);
+
+} // namespace rm_test
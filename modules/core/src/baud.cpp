@@ -0,0 +1,38 @@
+/**
+ * @file baud.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 任意波特率设置
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#ifdef __linux__
+
+// 本翻译单元仅包含内核头 <asm/termbits.h>，与 glibc 的 <termios.h> 存在
+// struct termios 的类型重定义冲突，不可与 serial.cpp 合并
+#include <asm/termbits.h>
+#include <sys/ioctl.h>
+
+#include <cstdint>
+
+namespace rm
+{
+
+bool setCustomBaudRate(int fd, uint32_t baud)
+{
+    termios2 tio{};
+    if (ioctl(fd, TCGETS2, &tio) != 0)
+        return false;
+    // 输入、输出波特率均切换为 BOTHER 任意数值模式
+    tio.c_cflag &= ~(CBAUD | (CBAUD << IBSHIFT));
+    tio.c_cflag |= BOTHER | (BOTHER << IBSHIFT);
+    tio.c_ispeed = tio.c_ospeed = baud;
+    return ioctl(fd, TCSETS2, &tio) == 0;
+}
+
+} // namespace rm
+
+#endif // __linux__
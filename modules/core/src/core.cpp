@@ -10,6 +10,7 @@
  */
 
 #include <cstdarg>
+#include <mutex>
 
 #include "rmvl/core/util.hpp"
 #include "rmvl/core/str.hpp"
@@ -105,6 +106,80 @@ const char *getBuildInformation()
     return build_info;
 }
 
+const char *to_string(Errc errc) noexcept
+{
+    switch (errc)
+    {
+    case Errc::BadArg:
+        return "Bad argument";
+    case Errc::BadSize:
+        return "Incorrect size";
+    case Errc::NullPtr:
+        return "Null pointer";
+    case Errc::OutOfRange:
+        return "Out of range";
+    case Errc::InvFmt:
+        return "Invalid format";
+    case Errc::IOError:
+        return "I/O error";
+    case Errc::Timeout:
+        return "Timeout";
+    default:
+        return "Unknown error";
+    }
+}
+
+namespace
+{
+
+//! 诊断环形缓冲的单条记录
+struct DiagRecord
+{
+    uint64_t seq{};          //!< 全局单调递增的序号
+    Errc errc{};             //!< 轻量错误码
+    const char *ctx{};       //!< 上下文描述（静态生存期字符串）
+};
+
+constexpr std::size_t DIAG_CAPACITY = 64; //!< 诊断环形缓冲容量
+
+std::mutex diag_mutex;                  //!< 保护诊断环形缓冲
+DiagRecord diag_ring[DIAG_CAPACITY]{};  //!< 诊断环形缓冲
+uint64_t diag_seq{};                    //!< 下一条记录的序号
+uint64_t diag_read{};                   //!< 已排空记录的序号上界
+
+} // namespace
+
+void diagLog(Errc errc, const char *ctx) noexcept
+{
+    // 临界区内仅三次标量存储，格式化推迟到排空时进行
+    std::lock_guard lk(diag_mutex);
+    diag_ring[diag_seq % DIAG_CAPACITY] = {diag_seq, errc, ctx};
+    ++diag_seq;
+}
+
+std::vector<std::string> diagDrain()
+{
+    DiagRecord records[DIAG_CAPACITY];
+    std::size_t n{};
+    uint64_t seq{};
+    {
+        std::lock_guard lk(diag_mutex);
+        seq = diag_seq;
+        // 未排空的记录中最多保留最近 DIAG_CAPACITY 条，更早的已被覆盖
+        uint64_t begin = seq - diag_read > DIAG_CAPACITY ? seq - DIAG_CAPACITY : diag_read;
+        n = static_cast<std::size_t>(seq - begin);
+        for (std::size_t i = 0; i < n; ++i)
+            records[i] = diag_ring[(begin + i) % DIAG_CAPACITY];
+        diag_read = seq;
+    }
+    std::vector<std::string> retval;
+    retval.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+        retval.push_back(format("#%ju [%s] %s", static_cast<uintmax_t>(records[i].seq),
+                                to_string(records[i].errc), records[i].ctx == nullptr ? "" : records[i].ctx));
+    return retval;
+}
+
 namespace str
 {
 
@@ -136,13 +211,6 @@ std::string join(const std::vector<std::string> &strs, std::string_view delim)
     return res;
 }
 
-std::string_view strip(std::string_view str)
-{
-    auto str_begin = str.find_first_not_of(" \t\n\r");
-    auto str_end = str.find_last_not_of(" \t\n\r") + 1;
-    return str.substr(str_begin, str_end - str_begin);
-}
-
 std::string lower(std::string_view str)
 {
     std::string res(str);
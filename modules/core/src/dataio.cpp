@@ -10,8 +10,21 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
 #include <fstream>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <type_traits>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
 
 #include "rmvl/core/io.hpp"
 #include "rmvl/core/util.hpp"
@@ -66,6 +79,131 @@ std::vector<ImuData> ImuData::read(std::string_view input_file) noexcept
     return datas;
 }
 
+//! IMU 批量文件幻数
+constexpr char IMU_BATCH_MAGIC[8] = {'R', 'M', 'V', 'L', 'I', 'M', 'B', '\0'};
+//! IMU 批量文件格式版本号
+constexpr uint32_t IMU_BATCH_VERSION = 1;
+
+//! IMU 批量容器的 12 个数据列，顺序与 ImuData 的成员声明顺序一致
+static std::array<std::vector<float> *, 12> imuColumns(ImuBatch &batch)
+{
+    auto &t = batch.translation;
+    auto &r = batch.rotation;
+    return {&t.x, &t.y, &t.z, &t.vx, &t.vy, &t.vz,
+            &r.yaw, &r.pitch, &r.roll, &r.yaw_speed, &r.pitch_speed, &r.roll_speed};
+}
+
+static std::array<const std::vector<float> *, 12> imuColumns(const ImuBatch &batch)
+{
+    const auto &t = batch.translation;
+    const auto &r = batch.rotation;
+    return {&t.x, &t.y, &t.z, &t.vx, &t.vy, &t.vz,
+            &r.yaw, &r.pitch, &r.roll, &r.yaw_speed, &r.pitch_speed, &r.roll_speed};
+}
+
+void ImuBatch::reserve(std::size_t n)
+{
+    for (auto *col : imuColumns(*this))
+        col->reserve(n);
+}
+
+void ImuBatch::push_back(const ImuData &data)
+{
+    float vals[12];
+    std::memcpy(vals, &data, sizeof(ImuData));
+    auto cols = imuColumns(*this);
+    for (std::size_t i = 0; i < 12; ++i)
+        cols[i]->push_back(vals[i]);
+}
+
+ImuData ImuBatch::at(std::size_t idx) const
+{
+    if (idx >= size())
+        RMVL_Error_(RMVL_StsOutOfRange, "Imu batch index %zu is out of range [0, %zu)", idx, size());
+    float vals[12];
+    auto cols = imuColumns(*this);
+    for (std::size_t i = 0; i < 12; ++i)
+        vals[i] = (*cols[i])[idx];
+    ImuData retval;
+    std::memcpy(&retval, vals, sizeof(ImuData));
+    return retval;
+}
+
+ImuBatch ImuBatch::from(const std::vector<ImuData> &datas)
+{
+    ImuBatch batch;
+    batch.reserve(datas.size());
+    for (const auto &data : datas)
+        batch.push_back(data);
+    return batch;
+}
+
+std::vector<ImuData> ImuBatch::toVector() const
+{
+    std::vector<ImuData> datas(size());
+    auto cols = imuColumns(*this);
+    // 逐列回填，各列均为顺序读取
+    for (std::size_t i = 0; i < 12; ++i)
+    {
+        const auto &col = *cols[i];
+        for (std::size_t j = 0; j < col.size(); ++j)
+            reinterpret_cast<float *>(&datas[j])[i] = col[j];
+    }
+    return datas;
+}
+
+void ImuBatch::write(std::ostream &out, const ImuBatch &batch) noexcept
+{
+    uint32_t reserved{};
+    uint64_t count = batch.size();
+    out.write(IMU_BATCH_MAGIC, sizeof(IMU_BATCH_MAGIC));
+    out.write(reinterpret_cast<const char *>(&IMU_BATCH_VERSION), sizeof(IMU_BATCH_VERSION));
+    out.write(reinterpret_cast<const char *>(&reserved), sizeof(reserved));
+    out.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    // 逐列整块写入
+    for (const auto *col : imuColumns(batch))
+        out.write(reinterpret_cast<const char *>(col->data()), count * sizeof(float));
+}
+
+bool ImuBatch::read(std::istream &in, ImuBatch &batch) noexcept
+{
+    char magic[8]{};
+    uint32_t version{}, reserved{};
+    uint64_t count{};
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char *>(&version), sizeof(version));
+    in.read(reinterpret_cast<char *>(&reserved), sizeof(reserved));
+    in.read(reinterpret_cast<char *>(&count), sizeof(count));
+    if (!in || std::memcmp(magic, IMU_BATCH_MAGIC, sizeof(IMU_BATCH_MAGIC)) != 0 || version != IMU_BATCH_VERSION)
+        return false;
+    // 逐列整块读取
+    for (auto *col : imuColumns(batch))
+    {
+        col->resize(static_cast<std::size_t>(count));
+        in.read(reinterpret_cast<char *>(col->data()), count * sizeof(float));
+    }
+    return static_cast<bool>(in);
+}
+
+void ImuBatch::write(std::string_view output_file, const ImuBatch &batch) noexcept
+{
+    std::ofstream ofs(output_file.data(), std::ios::binary | std::ios::trunc);
+    if (!ofs.is_open())
+        return;
+    write(ofs, batch);
+}
+
+ImuBatch ImuBatch::read(std::string_view input_file) noexcept
+{
+    std::ifstream ifs(input_file.data(), std::ios::binary);
+    if (!ifs.is_open())
+        return {};
+    ImuBatch batch;
+    if (!read(ifs, batch))
+        return {};
+    return batch;
+}
+
 void writeCorners(std::ostream &out, const std::vector<std::vector<std::array<float, 2>>> &corners)
 {
     std::for_each(corners.begin(), corners.end(), [&out](const auto &corner) {
@@ -96,4 +234,817 @@ void readCorners(std::istream &in, std::vector<std::vector<std::array<float, 2>>
     }
 }
 
+// IMU 数据按原始内存布局整体拷贝、插值与写入文件，依赖其平凡可拷贝且无填充字节
+static_assert(std::is_trivially_copyable_v<ImuData> && sizeof(ImuData) == 12 * sizeof(float),
+              "\"ImuData\" must be trivially copyable without padding");
+
+//////////////////////////////////// 异步角点写入 ////////////////////////////////////
+
+class CornerWriter::Impl
+{
+public:
+    explicit Impl(std::string_view path) : _ofs(path.data(), std::ios::trunc)
+    {
+        if (!_ofs.is_open())
+        {
+            ERROR_("Failed to open the corner file \"%s\"", path.data());
+            return;
+        }
+        _worker = std::thread(&Impl::workerLoop, this);
+    }
+
+    ~Impl()
+    {
+        if (!_ofs.is_open())
+            return;
+        {
+            std::lock_guard lk(_mtx);
+            _stop = true;
+        }
+        _cv.notify_one();
+        _worker.join();
+    }
+
+    bool write(std::vector<std::vector<std::array<float, 2>>> &&corners)
+    {
+        if (!_ofs.is_open())
+            return false;
+        {
+            std::lock_guard lk(_mtx);
+            _front.emplace_back(std::move(corners));
+            ++_written;
+        }
+        _cv.notify_one();
+        return true;
+    }
+
+    std::size_t size() const
+    {
+        std::lock_guard lk(_mtx);
+        return _written;
+    }
+
+private:
+    void workerLoop()
+    {
+        std::vector<std::vector<std::vector<std::array<float, 2>>>> back;
+        while (true)
+        {
+            {
+                std::unique_lock lk(_mtx);
+                _cv.wait(lk, [this] { return !_front.empty() || _stop; });
+                if (_front.empty() && _stop)
+                    return;
+                // 前后台缓冲区交换，格式化与落盘期间不持有锁
+                back.swap(_front);
+            }
+            std::ostringstream oss;
+            for (const auto &corners : back)
+                writeCorners(oss, corners);
+            back.clear();
+            // 积压的若干帧合并为单次大块写入
+            const auto &str = oss.str();
+            _ofs.write(str.data(), str.size());
+        }
+    }
+
+    std::ofstream _ofs;          //!< 角点文件输出流
+    std::size_t _written{};      //!< 已入队的帧数
+    bool _stop{};                //!< 后台线程停止标志
+    mutable std::mutex _mtx;     //!< 前台缓冲区互斥锁
+    std::condition_variable _cv; //!< 前台缓冲区条件变量
+    std::thread _worker;         //!< 后台格式化落盘线程
+
+    //! 前台缓冲区（采集线程移动入队的角点数据帧）
+    std::vector<std::vector<std::vector<std::array<float, 2>>>> _front;
+};
+
+RMVL_IMPL_DEF(CornerWriter)
+
+CornerWriter::CornerWriter(std::string_view path) : _impl(new Impl(path)) {}
+bool CornerWriter::write(std::vector<std::vector<std::array<float, 2>>> &&corners) { return _impl->write(std::move(corners)); }
+std::size_t CornerWriter::size() const { return _impl->size(); }
+
+//////////////////////////////////// IMU 历史缓存 ////////////////////////////////////
+
+class ImuHistory::Impl
+{
+    //! 环形缓存槽位，seq 为槽位序列锁：写入期间为 2i+1，第 i 次写入完成后为 2i+2
+    struct Slot
+    {
+        std::atomic_uint64_t seq{};
+        double tick{};
+        ImuData data{};
+    };
+
+public:
+    explicit Impl(std::size_t capacity)
+    {
+        if (capacity == 0)
+            RMVL_Error(RMVL_StsBadArg, "The capacity of \"ImuHistory\" must be positive");
+        std::size_t cap{1};
+        while (cap < capacity)
+            cap <<= 1;
+        _slots = std::vector<Slot>(cap);
+        _mask = cap - 1;
+    }
+
+    void push(double tick, const ImuData &imu)
+    {
+        uint64_t idx = _count.load(std::memory_order_relaxed);
+        Slot &slot = _slots[idx & _mask];
+        // 序列锁写入：先置奇数标记写入中，释放屏障后写入数据，再以偶数序列号发布
+        slot.seq.store(2 * idx + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.tick = tick;
+        slot.data = imu;
+        slot.seq.store(2 * idx + 2, std::memory_order_release);
+        _count.store(idx + 1, std::memory_order_release);
+    }
+
+    std::optional<ImuData> query(double tick) const
+    {
+        Sample lhs{}, rhs{};
+        for (;;)
+        {
+            uint64_t count = _count.load(std::memory_order_acquire);
+            if (count == 0)
+                return std::nullopt;
+            uint64_t lo = count > _mask + 1 ? count - _mask - 1 : 0, hi = count - 1;
+            // 槽位被写线程覆盖时读取失败，重新对缓存窗口做快照后重试
+            if (!load(hi, rhs))
+                continue;
+            if (tick >= rhs.tick)
+                return rhs.data;
+            if (!load(lo, lhs))
+                continue;
+            if (tick <= lhs.tick)
+                return lhs.data;
+            // 二分查找覆盖查询时间戳的相邻样本对 [lo, lo + 1]
+            bool stale = false;
+            while (hi - lo > 1)
+            {
+                uint64_t mid = lo + (hi - lo) / 2;
+                Sample sample{};
+                if (!load(mid, sample))
+                {
+                    stale = true;
+                    break;
+                }
+                (sample.tick <= tick ? lo : hi) = mid;
+            }
+            if (stale)
+                continue;
+            if (!load(lo, lhs) || !load(lo + 1, rhs))
+                continue;
+            return lerp(lhs, rhs, tick);
+        }
+    }
+
+    std::size_t size() const
+    {
+        uint64_t count = _count.load(std::memory_order_acquire);
+        return static_cast<std::size_t>(std::min<uint64_t>(count, _mask + 1));
+    }
+
+private:
+    //! 带时间戳的 IMU 样本
+    struct Sample
+    {
+        double tick{};
+        ImuData data{};
+    };
+
+    //! 序列锁读取第 idx 次写入的样本，槽位已被覆盖时返回 `false`
+    bool load(uint64_t idx, Sample &sample) const
+    {
+        const Slot &slot = _slots[idx & _mask];
+        if (slot.seq.load(std::memory_order_acquire) != 2 * idx + 2)
+            return false;
+        sample.tick = slot.tick;
+        sample.data = slot.data;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.seq.load(std::memory_order_relaxed) == 2 * idx + 2;
+    }
+
+    //! 对相邻样本对按时间戳线性插值
+    static ImuData lerp(const Sample &lhs, const Sample &rhs, double tick)
+    {
+        auto ratio = static_cast<float>((tick - lhs.tick) / (rhs.tick - lhs.tick));
+        float lvals[12], rvals[12];
+        std::memcpy(lvals, &lhs.data, sizeof(ImuData));
+        std::memcpy(rvals, &rhs.data, sizeof(ImuData));
+        for (std::size_t i = 0; i < 12; ++i)
+            lvals[i] += ratio * (rvals[i] - lvals[i]);
+        ImuData retval;
+        std::memcpy(&retval, lvals, sizeof(ImuData));
+        return retval;
+    }
+
+    std::vector<Slot> _slots;     //!< 环形缓存槽位
+    std::size_t _mask{};          //!< 槽位下标掩码
+    std::atomic_uint64_t _count{}; //!< 已写入的样本总数
+};
+
+RMVL_IMPL_DEF(ImuHistory)
+
+ImuHistory::ImuHistory(std::size_t capacity) : _impl(new Impl(capacity)) {}
+void ImuHistory::push(double tick, const ImuData &imu) { _impl->push(tick, imu); }
+std::optional<ImuData> ImuHistory::query(double tick) const { return _impl->query(tick); }
+std::size_t ImuHistory::size() const { return _impl->size(); }
+
+///////////////////////////////////// 二进制记录 /////////////////////////////////////
+
+//! 记录文件幻数
+constexpr char RECORD_MAGIC[8] = {'R', 'M', 'V', 'L', 'R', 'E', 'C', '\0'};
+//! 记录文件格式版本号
+constexpr uint32_t RECORD_VERSION = 1;
+//! 文件头长度：幻数 + 版本号 + 保留位 + 索引区偏移 + 记录条数
+constexpr uint64_t RECORD_HEADER_SIZE = 32;
+
+class RecordWriter::Impl
+{
+public:
+    explicit Impl(std::string_view path) : _ofs(path.data(), std::ios::binary | std::ios::trunc)
+    {
+        if (!_ofs.is_open())
+            RMVL_Error_(RMVL_StsBadArg, "Failed to open the record file \"%s\"", path.data());
+        // 先写入占位文件头，索引区偏移与记录条数在析构时回填
+        char header[RECORD_HEADER_SIZE]{};
+        _ofs.write(header, RECORD_HEADER_SIZE);
+        _pos = RECORD_HEADER_SIZE;
+    }
+
+    ~Impl()
+    {
+        // 记录区之后依次写入逐记录偏移索引，并回填文件头
+        uint64_t index_offset = _pos;
+        _ofs.write(reinterpret_cast<const char *>(_offsets.data()), _offsets.size() * sizeof(uint64_t));
+        uint64_t count = _offsets.size();
+        _ofs.seekp(0);
+        _ofs.write(RECORD_MAGIC, sizeof(RECORD_MAGIC));
+        put(RECORD_VERSION), put(uint32_t(0)), put(index_offset), put(count);
+    }
+
+    void write(double tick, const ImuData &imu, const std::vector<std::vector<std::array<float, 2>>> &corners,
+               const void *payload, std::size_t payload_size)
+    {
+        _offsets.push_back(_pos);
+        put(tick), put(imu);
+        put(static_cast<uint32_t>(corners.size()));
+        for (const auto &corner : corners)
+        {
+            put(static_cast<uint32_t>(corner.size()));
+            putBytes(corner.data(), corner.size() * sizeof(std::array<float, 2>));
+        }
+        put(static_cast<uint32_t>(payload_size));
+        if (payload_size != 0)
+            putBytes(payload, payload_size);
+        // 记录按 8 字节对齐补齐，保证映射后的时间戳可直接按 double 访问
+        constexpr char pad[8]{};
+        if (_pos % 8 != 0)
+            putBytes(pad, 8 - _pos % 8);
+    }
+
+    std::size_t size() const { return _offsets.size(); }
+
+private:
+    //! 写入平凡可拷贝对象
+    template <typename Tp>
+    void put(const Tp &val) { putBytes(&val, sizeof(Tp)); }
+
+    //! 写入原始字节并推进写入位置
+    void putBytes(const void *data, std::size_t size)
+    {
+        _ofs.write(reinterpret_cast<const char *>(data), size);
+        _pos += size;
+    }
+
+    std::ofstream _ofs;             //!< 记录文件输出流
+    std::vector<uint64_t> _offsets; //!< 逐记录的文件偏移
+    uint64_t _pos{};                //!< 当前写入位置
+};
+
+RMVL_IMPL_DEF(RecordWriter)
+
+RecordWriter::RecordWriter(std::string_view path) : _impl(new Impl(path)) {}
+void RecordWriter::write(double tick, const ImuData &imu, const std::vector<std::vector<std::array<float, 2>>> &corners,
+                         const void *payload, std::size_t payload_size) { _impl->write(tick, imu, corners, payload, payload_size); }
+std::size_t RecordWriter::size() const { return _impl->size(); }
+
+class RecordReader::Impl
+{
+public:
+    explicit Impl(std::string_view path)
+    {
+#ifndef _WIN32
+        // POSIX 平台整体内存映射，页缓存命中时随机访问无任何拷贝
+        int fd = ::open(path.data(), O_RDONLY);
+        if (fd == -1)
+            RMVL_Error_(RMVL_StsBadArg, "Failed to open the record file \"%s\"", path.data());
+        struct stat st{};
+        ::fstat(fd, &st);
+        _size = static_cast<std::size_t>(st.st_size);
+        void *addr = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED)
+            RMVL_Error_(RMVL_StsError, "Failed to map the record file \"%s\"", path.data());
+        _data = static_cast<const uint8_t *>(addr);
+#else
+        // Windows 平台退化为整体读入堆缓冲区
+        std::ifstream ifs(path.data(), std::ios::binary | std::ios::ate);
+        if (!ifs.is_open())
+            RMVL_Error_(RMVL_StsBadArg, "Failed to open the record file \"%s\"", path.data());
+        _buf.resize(static_cast<std::size_t>(ifs.tellg()));
+        ifs.seekg(0);
+        ifs.read(reinterpret_cast<char *>(_buf.data()), _buf.size());
+        _data = _buf.data();
+        _size = _buf.size();
+#endif // _WIN32
+        // 校验文件头与索引区边界
+        if (_size < RECORD_HEADER_SIZE || std::memcmp(_data, RECORD_MAGIC, sizeof(RECORD_MAGIC)) != 0)
+            RMVL_Error(RMVL_StsBadArg, "Invalid record file header");
+        if (get<uint32_t>(8) != RECORD_VERSION)
+            RMVL_Error(RMVL_StsBadArg, "Unsupported record file version");
+        uint64_t index_offset = get<uint64_t>(16);
+        _count = static_cast<std::size_t>(get<uint64_t>(24));
+        if (index_offset % 8 != 0 || index_offset + _count * sizeof(uint64_t) > _size)
+            RMVL_Error(RMVL_StsBadArg, "Invalid record file index");
+        _index = reinterpret_cast<const uint64_t *>(_data + index_offset);
+    }
+
+    ~Impl()
+    {
+#ifndef _WIN32
+        if (_data != nullptr)
+            ::munmap(const_cast<uint8_t *>(_data), _size);
+#endif // _WIN32
+    }
+
+    std::size_t size() const { return _count; }
+
+    RecordView at(std::size_t idx) const
+    {
+        if (idx >= _count)
+            RMVL_Error_(RMVL_StsOutOfRange, "Record index %zu is out of range [0, %zu)", idx, _count);
+        std::size_t pos = static_cast<std::size_t>(_index[idx]);
+        RecordView view{};
+        view.tick = get<double>(pos), pos += sizeof(double);
+        view.imu = get<ImuData>(pos), pos += sizeof(ImuData);
+        auto group_count = get<uint32_t>(pos);
+        pos += sizeof(uint32_t);
+        view.corners.reserve(group_count);
+        for (uint32_t i = 0; i < group_count; ++i)
+        {
+            auto point_count = get<uint32_t>(pos);
+            pos += sizeof(uint32_t);
+            // 角点在文件中即为连续的 float 对，直接以映射内存中的跨度返回
+            view.corners.emplace_back(reinterpret_cast<const std::array<float, 2> *>(_data + pos), point_count);
+            pos += point_count * sizeof(std::array<float, 2>);
+        }
+        view.payload_size = get<uint32_t>(pos);
+        pos += sizeof(uint32_t);
+        view.payload = view.payload_size != 0 ? _data + pos : nullptr;
+        return view;
+    }
+
+private:
+    //! 读取指定偏移处的平凡可拷贝对象
+    template <typename Tp>
+    Tp get(std::size_t pos) const
+    {
+        Tp val;
+        std::memcpy(&val, _data + pos, sizeof(Tp));
+        return val;
+    }
+
+    const uint8_t *_data{};   //!< 映射内存首地址
+    std::size_t _size{};      //!< 映射内存长度
+    const uint64_t *_index{}; //!< 逐记录偏移索引首地址
+    std::size_t _count{};     //!< 记录条数
+#ifdef _WIN32
+    std::vector<uint8_t> _buf; //!< 堆缓冲区
+#endif // _WIN32
+};
+
+RMVL_IMPL_DEF(RecordReader)
+
+RecordReader::RecordReader(std::string_view path) : _impl(new Impl(path)) {}
+std::size_t RecordReader::size() const { return _impl->size(); }
+RecordView RecordReader::at(std::size_t idx) const { return _impl->at(idx); }
+
+///////////////////////////////////// 帧数据日志 /////////////////////////////////////
+
+//! 读取小端 4 字节无符号整数
+static inline uint32_t read32(const uint8_t *p)
+{
+    uint32_t val;
+    std::memcpy(&val, p, 4);
+    return val;
+}
+
+//! LZ4 压缩输出缓冲区容量上界
+static constexpr std::size_t lz4Bound(std::size_t len) { return len + len / 255 + 16; }
+
+/**
+ * @brief LZ4 块格式贪心压缩，输出与标准 liblz4 块格式兼容
+ * @note 单哈希表匹配最近出现的 4 字节序列，匹配失败逐字节推进，`dst` 容量需不小于
+ *       `lz4Bound(len)`
+ *
+ * @param[in] src 输入数据首地址
+ * @param[in] len 输入数据长度（字节）
+ * @param[out] dst 压缩输出缓冲区
+ * @return 压缩后长度
+ */
+static std::size_t lz4Compress(const uint8_t *src, std::size_t len, uint8_t *dst)
+{
+    constexpr std::size_t HASH_BITS = 13;
+    // 最后一个匹配的起点距输入末尾不少于 12 字节，且末尾 5 字节必须为字面量
+    constexpr std::size_t MFLIMIT = 12, LAST_LITERALS = 5;
+    uint32_t table[1 << HASH_BITS]{}; // 4 字节序列最近出现位置 + 1，0 表示未出现
+    const uint8_t *ip = src, *anchor = src, *iend = src + len;
+    const uint8_t *limit = len > MFLIMIT ? iend - MFLIMIT : src;
+    uint8_t *op = dst;
+    while (ip < limit)
+    {
+        uint32_t h = (read32(ip) * 2654435761u) >> (32 - HASH_BITS);
+        uint32_t cand = table[h];
+        table[h] = static_cast<uint32_t>(ip - src) + 1;
+        const uint8_t *match = src + cand - 1;
+        if (cand == 0 || ip - match > 65535 || read32(match) != read32(ip))
+        {
+            ++ip;
+            continue;
+        }
+        // 向后延伸匹配
+        const uint8_t *p = ip + 4, *m = match + 4;
+        const uint8_t *match_end = iend - LAST_LITERALS;
+        while (p < match_end && *p == *m)
+            ++p, ++m;
+        std::size_t match_len = p - ip - 4; // 超出最小匹配长度 4 的部分
+        std::size_t lit_len = ip - anchor;
+        std::size_t offset = ip - match;
+        // 序列头：高 4 位为字面量长度，低 4 位为匹配长度，15 表示后接扩展长度字节
+        uint8_t *token = op++;
+        if (lit_len >= 15)
+        {
+            *token = 15 << 4;
+            std::size_t rest = lit_len - 15;
+            for (; rest >= 255; rest -= 255)
+                *op++ = 255;
+            *op++ = static_cast<uint8_t>(rest);
+        }
+        else
+            *token = static_cast<uint8_t>(lit_len << 4);
+        std::memcpy(op, anchor, lit_len), op += lit_len;
+        *op++ = static_cast<uint8_t>(offset);
+        *op++ = static_cast<uint8_t>(offset >> 8);
+        if (match_len >= 15)
+        {
+            *token |= 15;
+            std::size_t rest = match_len - 15;
+            for (; rest >= 255; rest -= 255)
+                *op++ = 255;
+            *op++ = static_cast<uint8_t>(rest);
+        }
+        else
+            *token |= static_cast<uint8_t>(match_len);
+        ip = p, anchor = p;
+    }
+    // 末尾字面量序列
+    std::size_t lit_len = iend - anchor;
+    uint8_t *token = op++;
+    if (lit_len >= 15)
+    {
+        *token = 15 << 4;
+        std::size_t rest = lit_len - 15;
+        for (; rest >= 255; rest -= 255)
+            *op++ = 255;
+        *op++ = static_cast<uint8_t>(rest);
+    }
+    else
+        *token = static_cast<uint8_t>(lit_len << 4);
+    std::memcpy(op, anchor, lit_len), op += lit_len;
+    return op - dst;
+}
+
+/**
+ * @brief LZ4 块格式解压
+ *
+ * @param[in] src 压缩数据首地址
+ * @param[in] len 压缩数据长度（字节）
+ * @param[out] dst 解压输出缓冲区
+ * @param[in] dst_len 预期的解压后长度（字节）
+ * @return 是否解压成功且长度与 `dst_len` 一致
+ */
+static bool lz4Decompress(const uint8_t *src, std::size_t len, uint8_t *dst, std::size_t dst_len)
+{
+    const uint8_t *ip = src, *iend = src + len;
+    uint8_t *op = dst, *oend = dst + dst_len;
+    while (ip < iend)
+    {
+        uint8_t token = *ip++;
+        // 字面量
+        std::size_t lit_len = token >> 4;
+        if (lit_len == 15)
+        {
+            uint8_t b{};
+            do
+            {
+                if (ip >= iend)
+                    return false;
+                b = *ip++, lit_len += b;
+            } while (b == 255);
+        }
+        if (lit_len > static_cast<std::size_t>(iend - ip) || lit_len > static_cast<std::size_t>(oend - op))
+            return false;
+        std::memcpy(op, ip, lit_len), ip += lit_len, op += lit_len;
+        // 末尾序列仅含字面量
+        if (ip == iend)
+            break;
+        // 匹配
+        if (iend - ip < 2)
+            return false;
+        std::size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<std::size_t>(op - dst))
+            return false;
+        std::size_t match_len = (token & 0xf) + 4;
+        if ((token & 0xf) == 15)
+        {
+            uint8_t b{};
+            do
+            {
+                if (ip >= iend)
+                    return false;
+                b = *ip++, match_len += b;
+            } while (b == 255);
+        }
+        if (match_len > static_cast<std::size_t>(oend - op))
+            return false;
+        const uint8_t *mp = op - offset;
+        if (offset >= match_len)
+            std::memcpy(op, mp, match_len);
+        else // 重叠匹配（短周期重复），逐字节复制
+            for (std::size_t i = 0; i < match_len; ++i)
+                op[i] = mp[i];
+        op += match_len;
+    }
+    return op == oend;
+}
+
+//! 帧日志文件幻数
+constexpr char JOURNAL_MAGIC[8] = {'R', 'M', 'V', 'L', 'J', 'N', 'L', '\0'};
+//! 帧日志文件格式版本号
+constexpr uint32_t JOURNAL_VERSION = 1;
+//! 文件头长度：幻数 + 版本号 + 保留位 + 索引区偏移 + 帧数
+constexpr uint64_t JOURNAL_HEADER_SIZE = 32;
+
+//! 帧日志逐帧索引项
+struct JournalEntry
+{
+    uint64_t offset;    //!< 帧数据的文件偏移
+    uint64_t comp_size; //!< 落盘长度，与压缩前长度相等时表示未压缩存储
+    uint64_t raw_size;  //!< 压缩前长度
+    double tick;        //!< 帧时间戳
+};
+
+class FrameJournal::Impl
+{
+public:
+    Impl(std::string_view path, std::size_t frame_capacity, std::size_t slots)
+        : _ofs(path.data(), std::ios::binary | std::ios::trunc), _frame_capacity(frame_capacity)
+    {
+        if (!_ofs.is_open())
+            RMVL_Error_(RMVL_StsBadArg, "Failed to open the journal file \"%s\"", path.data());
+        if (frame_capacity == 0 || slots == 0)
+            RMVL_Error(RMVL_StsBadArg, "The capacity and slots of \"FrameJournal\" must be positive");
+        // 先写入占位文件头，索引区偏移与帧数在析构时回填
+        char header[JOURNAL_HEADER_SIZE]{};
+        _ofs.write(header, JOURNAL_HEADER_SIZE);
+        _pos = JOURNAL_HEADER_SIZE;
+        _slots = std::vector<Slot>(slots);
+        for (auto &slot : _slots)
+            slot.data.resize(frame_capacity);
+        _comp.resize(lz4Bound(frame_capacity));
+        _worker = std::thread(&Impl::workerLoop, this);
+    }
+
+    ~Impl()
+    {
+        {
+            std::lock_guard lk(_mtx);
+            _stop = true;
+        }
+        _cv.notify_one();
+        _worker.join();
+        // 帧数据区按 8 字节对齐补齐后写入逐帧索引，并回填文件头
+        constexpr char pad[8]{};
+        if (_pos % 8 != 0)
+        {
+            _ofs.write(pad, 8 - _pos % 8);
+            _pos += 8 - _pos % 8;
+        }
+        uint64_t index_offset = _pos;
+        _ofs.write(reinterpret_cast<const char *>(_entries.data()), _entries.size() * sizeof(JournalEntry));
+        uint64_t count = _entries.size();
+        uint32_t version = JOURNAL_VERSION, reserved{};
+        _ofs.seekp(0);
+        _ofs.write(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+        _ofs.write(reinterpret_cast<const char *>(&version), sizeof(version));
+        _ofs.write(reinterpret_cast<const char *>(&reserved), sizeof(reserved));
+        _ofs.write(reinterpret_cast<const char *>(&index_offset), sizeof(index_offset));
+        _ofs.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    }
+
+    bool write(double tick, const void *data, std::size_t size)
+    {
+        if (size > _frame_capacity)
+            return false;
+        {
+            std::lock_guard lk(_mtx);
+            // 队列满（落盘跟不上采集）时丢弃当前帧并计数，采集线程永不阻塞
+            if (_queued == _slots.size())
+            {
+                ++_dropped;
+                DEBUG_WARNING_("Frame journal queue is full, the current frame is dropped.");
+                return false;
+            }
+            Slot &slot = _slots[(_head + _queued) % _slots.size()];
+            std::memcpy(slot.data.data(), data, size);
+            slot.size = size, slot.tick = tick;
+            ++_queued, ++_written;
+        }
+        _cv.notify_one();
+        return true;
+    }
+
+    std::size_t size() const
+    {
+        std::lock_guard lk(_mtx);
+        return _written;
+    }
+
+    std::size_t dropped() const
+    {
+        std::lock_guard lk(_mtx);
+        return _dropped;
+    }
+
+private:
+    void workerLoop()
+    {
+        while (true)
+        {
+            Slot *slot{};
+            {
+                std::unique_lock lk(_mtx);
+                _cv.wait(lk, [this] { return _queued != 0 || _stop; });
+                if (_queued == 0 && _stop)
+                    return;
+                slot = &_slots[_head];
+            }
+            // 压缩与落盘期间不持有锁，采集线程可继续向其余槽位入队
+            std::size_t comp_size = lz4Compress(slot->data.data(), slot->size, _comp.data());
+            JournalEntry entry{_pos, slot->size, slot->size, slot->tick};
+            if (comp_size < slot->size)
+            {
+                entry.comp_size = comp_size;
+                _ofs.write(reinterpret_cast<const char *>(_comp.data()), comp_size);
+            }
+            else // 不可压缩的帧按原样存储，避免无收益的膨胀
+                _ofs.write(reinterpret_cast<const char *>(slot->data.data()), slot->size);
+            _pos += entry.comp_size;
+            _entries.push_back(entry);
+            {
+                std::lock_guard lk(_mtx);
+                _head = (_head + 1) % _slots.size();
+                --_queued;
+            }
+        }
+    }
+
+    //! 环形队列槽位
+    struct Slot
+    {
+        double tick{};             //!< 帧时间戳
+        std::size_t size{};        //!< 帧数据长度
+        std::vector<uint8_t> data; //!< 帧数据缓冲区（构造时一次性分配）
+    };
+
+    std::ofstream _ofs;                 //!< 日志文件输出流
+    std::size_t _frame_capacity{};      //!< 单帧最大长度
+    std::vector<Slot> _slots;           //!< 环形队列槽位
+    std::size_t _head{};                //!< 队首下标（后台线程取出位置）
+    std::size_t _queued{};              //!< 队列中的帧数
+    std::size_t _written{};             //!< 已入队的帧数
+    std::size_t _dropped{};             //!< 因队列满而丢弃的帧数
+    std::vector<uint8_t> _comp;         //!< 压缩输出缓冲区（构造时一次性分配）
+    std::vector<JournalEntry> _entries; //!< 逐帧索引
+    uint64_t _pos{};                    //!< 当前写入位置
+    bool _stop{};                       //!< 后台线程停止标志
+    mutable std::mutex _mtx;            //!< 队列互斥锁
+    std::condition_variable _cv;        //!< 队列条件变量
+    std::thread _worker;                //!< 后台压缩落盘线程
+};
+
+RMVL_IMPL_DEF(FrameJournal)
+
+FrameJournal::FrameJournal(std::string_view path, std::size_t frame_capacity, std::size_t slots) : _impl(new Impl(path, frame_capacity, slots)) {}
+bool FrameJournal::write(double tick, const void *data, std::size_t size) { return _impl->write(tick, data, size); }
+std::size_t FrameJournal::size() const { return _impl->size(); }
+std::size_t FrameJournal::dropped() const { return _impl->dropped(); }
+
+class FrameJournalReader::Impl
+{
+public:
+    explicit Impl(std::string_view path)
+    {
+#ifndef _WIN32
+        // POSIX 平台整体内存映射，仅解压被访问的帧
+        int fd = ::open(path.data(), O_RDONLY);
+        if (fd == -1)
+            RMVL_Error_(RMVL_StsBadArg, "Failed to open the journal file \"%s\"", path.data());
+        struct stat st{};
+        ::fstat(fd, &st);
+        _size = static_cast<std::size_t>(st.st_size);
+        void *addr = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED)
+            RMVL_Error_(RMVL_StsError, "Failed to map the journal file \"%s\"", path.data());
+        _data = static_cast<const uint8_t *>(addr);
+#else
+        // Windows 平台退化为整体读入堆缓冲区
+        std::ifstream ifs(path.data(), std::ios::binary | std::ios::ate);
+        if (!ifs.is_open())
+            RMVL_Error_(RMVL_StsBadArg, "Failed to open the journal file \"%s\"", path.data());
+        _buf.resize(static_cast<std::size_t>(ifs.tellg()));
+        ifs.seekg(0);
+        ifs.read(reinterpret_cast<char *>(_buf.data()), _buf.size());
+        _data = _buf.data();
+        _size = _buf.size();
+#endif // _WIN32
+        // 校验文件头与索引区边界
+        if (_size < JOURNAL_HEADER_SIZE || std::memcmp(_data, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0)
+            RMVL_Error(RMVL_StsBadArg, "Invalid journal file header");
+        if (get<uint32_t>(8) != JOURNAL_VERSION)
+            RMVL_Error(RMVL_StsBadArg, "Unsupported journal file version");
+        uint64_t index_offset = get<uint64_t>(16);
+        _count = static_cast<std::size_t>(get<uint64_t>(24));
+        if (index_offset % 8 != 0 || index_offset + _count * sizeof(JournalEntry) > _size)
+            RMVL_Error(RMVL_StsBadArg, "Invalid journal file index");
+        _index = reinterpret_cast<const JournalEntry *>(_data + index_offset);
+    }
+
+    ~Impl()
+    {
+#ifndef _WIN32
+        if (_data != nullptr)
+            ::munmap(const_cast<uint8_t *>(_data), _size);
+#endif // _WIN32
+    }
+
+    std::size_t size() const { return _count; }
+
+    JournalFrame at(std::size_t idx) const
+    {
+        if (idx >= _count)
+            RMVL_Error_(RMVL_StsOutOfRange, "Journal frame index %zu is out of range [0, %zu)", idx, _count);
+        const JournalEntry &entry = _index[idx];
+        if (entry.offset + entry.comp_size > _size)
+            RMVL_Error(RMVL_StsBadArg, "Invalid journal frame bounds");
+        JournalFrame frame{entry.tick, {}};
+        frame.data.resize(entry.raw_size);
+        if (entry.comp_size == entry.raw_size)
+            std::memcpy(frame.data.data(), _data + entry.offset, entry.raw_size);
+        else if (!lz4Decompress(_data + entry.offset, entry.comp_size, frame.data.data(), entry.raw_size))
+            RMVL_Error_(RMVL_StsError, "Failed to decompress the journal frame %zu", idx);
+        return frame;
+    }
+
+private:
+    //! 读取指定偏移处的平凡可拷贝对象
+    template <typename Tp>
+    Tp get(std::size_t pos) const
+    {
+        Tp val;
+        std::memcpy(&val, _data + pos, sizeof(Tp));
+        return val;
+    }
+
+    const uint8_t *_data{};       //!< 映射内存首地址
+    std::size_t _size{};          //!< 映射内存长度
+    const JournalEntry *_index{}; //!< 逐帧索引首地址
+    std::size_t _count{};         //!< 帧数
+#ifdef _WIN32
+    std::vector<uint8_t> _buf; //!< 堆缓冲区
+#endif // _WIN32
+};
+
+RMVL_IMPL_DEF(FrameJournalReader)
+
+FrameJournalReader::FrameJournalReader(std::string_view path) : _impl(new Impl(path)) {}
+std::size_t FrameJournalReader::size() const { return _impl->size(); }
+JournalFrame FrameJournalReader::at(std::size_t idx) const { return _impl->at(idx); }
+
 } // namespace rm
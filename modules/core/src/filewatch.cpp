@@ -0,0 +1,272 @@
+/**
+ * @file filewatch.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 文件监视服务
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#else
+#include <chrono>
+#include <condition_variable>
+#include <sys/stat.h>
+#endif
+
+#include "rmvl/core/filewatch.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm
+{
+
+//! 拆分文件路径为目录与文件名，无目录部分时目录为 "."
+static std::pair<std::string, std::string> splitPath(std::string_view path)
+{
+    auto pos = path.find_last_of('/');
+    if (pos == std::string_view::npos)
+        return {".", std::string(path)};
+    return {std::string(path.substr(0, pos == 0 ? 1 : pos)), std::string(path.substr(pos + 1))};
+}
+
+class FileWatcher::Impl
+{
+public:
+    Impl() = default;
+    ~Impl() { stop(); }
+
+    uint32_t watch(std::string_view path, std::function<void(const std::string &)> callback);
+    bool unwatch(uint32_t id);
+
+private:
+    //! 监视条目
+    struct Entry
+    {
+        std::string path;                                //!< 文件路径
+        std::string name;                                //!< 目录中的文件名
+        std::function<void(const std::string &)> cb;     //!< 变更回调
+#ifdef __linux__
+        int wd{-1}; //!< 所在目录的 inotify 监视描述符
+#else
+        int64_t mtime{}; //!< 最近一次观察到的修改时间
+#endif
+    };
+
+    void stop();
+
+    std::mutex _mtx;                        //!< 监视条目互斥锁
+    std::map<uint32_t, Entry> _entries;     //!< 监视条目映射表 `[标识符 : 条目]`
+    uint32_t _next_id{1};                   //!< 下一个监视标识符
+    std::thread _worker;                    //!< 监视线程
+#ifdef __linux__
+    void run();
+
+    int _fd{-1};          //!< inotify 实例描述符
+    int _wakeup_fds[2]{}; //!< 监视线程唤醒管道，写入端用于注册变更与退出通知
+    bool _stopped{};      //!< 退出标志
+#else
+    void run();
+
+    std::condition_variable _cv; //!< 轮询等待条件变量
+    bool _stopped{};             //!< 退出标志
+#endif
+};
+
+#ifdef __linux__
+
+uint32_t FileWatcher::Impl::watch(std::string_view path, std::function<void(const std::string &)> callback)
+{
+    if (callback == nullptr)
+        return 0;
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (_fd < 0)
+    {
+        _fd = inotify_init1(IN_CLOEXEC);
+        if (_fd < 0)
+        {
+            WARNING_("Failed to initialize the file watcher");
+            return 0;
+        }
+        if (pipe(_wakeup_fds) != 0)
+        {
+            WARNING_("Failed to initialize the file watcher");
+            ::close(_fd), _fd = -1;
+            return 0;
+        }
+        _worker = std::thread(&Impl::run, this);
+    }
+    auto [dir, name] = splitPath(path);
+    // 监视目录而非文件本身，覆盖编辑器以临时文件加重命名方式完成的保存
+    int wd = inotify_add_watch(_fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (wd < 0)
+    {
+        WARNING_("Failed to watch the directory \"%s\"", dir.c_str());
+        return 0;
+    }
+    uint32_t id = _next_id++;
+    _entries[id] = {std::string(path), std::move(name), std::move(callback), wd};
+    return id;
+}
+
+bool FileWatcher::Impl::unwatch(uint32_t id)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    auto it = _entries.find(id);
+    if (it == _entries.end())
+        return false;
+    int wd = it->second.wd;
+    _entries.erase(it);
+    // 同一目录可能被多个条目共享，仅在无人使用时移除目录监视
+    for (const auto &[eid, entry] : _entries)
+        if (entry.wd == wd)
+            return true;
+    inotify_rm_watch(_fd, wd);
+    return true;
+}
+
+void FileWatcher::Impl::run()
+{
+    char buf[4096];
+    pollfd fds[2]{{_fd, POLLIN, 0}, {_wakeup_fds[0], POLLIN, 0}};
+    while (true)
+    {
+        if (poll(fds, 2, -1) < 0)
+            continue;
+        if (fds[1].revents & POLLIN)
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            if (_stopped)
+                return;
+        }
+        if (!(fds[0].revents & POLLIN))
+            continue;
+        auto num = ::read(_fd, buf, sizeof(buf));
+        if (num <= 0)
+            continue;
+        // 收集命中的回调后在锁外执行，回调中允许注册、取消监视
+        std::vector<std::pair<std::function<void(const std::string &)>, std::string>> hits;
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            for (long idx = 0; idx < num;)
+            {
+                auto event = reinterpret_cast<const inotify_event *>(buf + idx);
+                idx += sizeof(inotify_event) + event->len;
+                if (event->len == 0)
+                    continue;
+                for (const auto &[id, entry] : _entries)
+                    if (entry.wd == event->wd && entry.name == event->name)
+                        hits.emplace_back(entry.cb, entry.path);
+            }
+        }
+        for (const auto &[cb, path] : hits)
+            cb(path);
+    }
+}
+
+void FileWatcher::Impl::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (_fd < 0)
+            return;
+        _stopped = true;
+    }
+    char token{};
+    auto unused = ::write(_wakeup_fds[1], &token, 1);
+    (void)unused;
+    _worker.join();
+    ::close(_wakeup_fds[0]);
+    ::close(_wakeup_fds[1]);
+    ::close(_fd);
+}
+
+#else
+
+//! 获取文件修改时间，文件不存在时返回 `0`
+static int64_t fileMTime(const std::string &path)
+{
+    struct stat st{};
+    return stat(path.c_str(), &st) == 0 ? static_cast<int64_t>(st.st_mtime) : 0;
+}
+
+uint32_t FileWatcher::Impl::watch(std::string_view path, std::function<void(const std::string &)> callback)
+{
+    if (callback == nullptr)
+        return 0;
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (!_worker.joinable())
+        _worker = std::thread(&Impl::run, this);
+    uint32_t id = _next_id++;
+    auto [dir, name] = splitPath(path);
+    _entries[id] = {std::string(path), std::move(name), std::move(callback), fileMTime(std::string(path))};
+    return id;
+}
+
+bool FileWatcher::Impl::unwatch(uint32_t id)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _entries.erase(id) != 0;
+}
+
+void FileWatcher::Impl::run()
+{
+    std::unique_lock<std::mutex> lock(_mtx);
+    while (!_cv.wait_for(lock, std::chrono::milliseconds(200), [this] { return _stopped; }))
+    {
+        std::vector<std::pair<std::function<void(const std::string &)>, std::string>> hits;
+        for (auto &[id, entry] : _entries)
+        {
+            int64_t mtime = fileMTime(entry.path);
+            if (mtime != entry.mtime)
+            {
+                entry.mtime = mtime;
+                if (mtime != 0)
+                    hits.emplace_back(entry.cb, entry.path);
+            }
+        }
+        lock.unlock();
+        for (const auto &[cb, path] : hits)
+            cb(path);
+        lock.lock();
+    }
+}
+
+void FileWatcher::Impl::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (!_worker.joinable())
+            return;
+        _stopped = true;
+    }
+    _cv.notify_all();
+    _worker.join();
+}
+
+#endif
+
+RMVL_IMPL_DEF(FileWatcher)
+
+FileWatcher::FileWatcher() : _impl(new Impl) {}
+
+uint32_t FileWatcher::watch(std::string_view path, std::function<void(const std::string &)> callback) { return _impl->watch(path, std::move(callback)); }
+
+bool FileWatcher::unwatch(uint32_t id) { return _impl->unwatch(id); }
+
+FileWatcher &FileWatcher::global()
+{
+    static FileWatcher watcher;
+    return watcher;
+}
+
+} // namespace rm
@@ -0,0 +1,179 @@
+/**
+ * @file governor.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 热状态感知的自适应速率调控服务
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+
+#ifdef __linux__
+#include <cstdio>
+#include <string>
+#endif
+
+#include "rmvl/core/governor.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm
+{
+
+/**
+ * @brief 默认热状态采样，取各热区温度的最大值
+ *
+ * @return 当前热状态（单位：℃），平台不提供热状态时为 `0`
+ */
+static double readThermalState()
+{
+#ifdef __linux__
+    double retval{};
+    for (int zone = 0;; ++zone)
+    {
+        std::string path = "/sys/class/thermal/thermal_zone" + std::to_string(zone) + "/temp";
+        FILE *fp = std::fopen(path.c_str(), "r");
+        if (fp == nullptr)
+            break;
+        // 热区温度以千分之一摄氏度表示
+        long milli_degree{};
+        if (std::fscanf(fp, "%ld", &milli_degree) == 1)
+            retval = std::max(retval, static_cast<double>(milli_degree) * 1e-3);
+        std::fclose(fp);
+    }
+    return retval;
+#else
+    return 0.;
+#endif
+}
+
+RateGovernor::~RateGovernor() { stop(); }
+
+RateGovernor &RateGovernor::global()
+{
+    static RateGovernor governor;
+    return governor;
+}
+
+void RateGovernor::setThresholds(double reduced, double minimum, double hysteresis)
+{
+    if (reduced >= minimum || hysteresis < 0.)
+        RMVL_Error_(RMVL_StsBadArg, "Invalid thresholds: reduced = %g, minimum = %g, hysteresis = %g", reduced, minimum, hysteresis);
+    std::lock_guard lk(_mtx);
+    _reduced = reduced;
+    _minimum = minimum;
+    _hysteresis = hysteresis;
+}
+
+void RateGovernor::setSource(std::function<double()> source)
+{
+    std::lock_guard lk(_mtx);
+    _source = std::move(source);
+}
+
+std::size_t RateGovernor::subscribe(std::function<void(ThrottleLevel)> callback)
+{
+    std::unique_lock lk(_mtx);
+    std::size_t id = _next_id++;
+    _subscribers.emplace_back(id, std::move(callback));
+    auto cb = _subscribers.back().second;
+    // 立即以当前等级回调一次，便于订阅者完成初始配置
+    lk.unlock();
+    cb(level());
+    return id;
+}
+
+void RateGovernor::unsubscribe(std::size_t id)
+{
+    std::lock_guard lk(_mtx);
+    _subscribers.erase(std::remove_if(_subscribers.begin(), _subscribers.end(),
+                                      [id](const auto &subscriber) { return subscriber.first == id; }),
+                       _subscribers.end());
+}
+
+void RateGovernor::start(double period)
+{
+    std::lock_guard lk(_mtx);
+    if (_running)
+        return;
+    _running = true;
+    _thread = std::thread([this, period] {
+        std::unique_lock lk(_mtx);
+        while (_running)
+        {
+            lk.unlock();
+            sample();
+            lk.lock();
+            _cv.wait_for(lk, std::chrono::duration<double>(period), [this] { return !_running; });
+        }
+    });
+}
+
+void RateGovernor::stop()
+{
+    {
+        std::lock_guard lk(_mtx);
+        if (!_running)
+            return;
+        _running = false;
+    }
+    _cv.notify_all();
+    _thread.join();
+}
+
+void RateGovernor::sample()
+{
+    std::unique_lock lk(_mtx);
+    auto source = _source;
+    const double reduced = _reduced, minimum = _minimum, hysteresis = _hysteresis;
+    lk.unlock();
+    double temperature = source ? source() : readThermalState();
+    _temperature.store(temperature, std::memory_order_relaxed);
+    // 等级升高在到达阈值时立即发生，回落需降至阈值以下回差，避免在阈值附近往复切换
+    ThrottleLevel cur = level(), next = cur;
+    switch (cur)
+    {
+    case ThrottleLevel::Normal:
+        next = temperature >= minimum ? ThrottleLevel::Minimum : temperature >= reduced ? ThrottleLevel::Reduced : cur;
+        break;
+    case ThrottleLevel::Reduced:
+        if (temperature >= minimum)
+            next = ThrottleLevel::Minimum;
+        else if (temperature <= reduced - hysteresis)
+            next = ThrottleLevel::Normal;
+        break;
+    case ThrottleLevel::Minimum:
+        if (temperature <= reduced - hysteresis)
+            next = ThrottleLevel::Normal;
+        else if (temperature <= minimum - hysteresis)
+            next = ThrottleLevel::Reduced;
+        break;
+    }
+    if (next == cur)
+        return;
+    _level.store(next, std::memory_order_relaxed);
+    // 复制订阅表后在锁外回调，避免回调中的耗时操作阻塞订阅接口
+    lk.lock();
+    auto subscribers = _subscribers;
+    lk.unlock();
+    for (auto &[id, callback] : subscribers)
+        callback(next);
+}
+
+double RateGovernor::rateScale(ThrottleLevel level) noexcept
+{
+    switch (level)
+    {
+    case ThrottleLevel::Reduced:
+        return 0.75;
+    case ThrottleLevel::Minimum:
+        return 0.5;
+    default:
+        return 1.;
+    }
+}
+
+} // namespace rm
@@ -0,0 +1,83 @@
+/**
+ * @file init.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 子系统惰性初始化模块
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <mutex>
+
+#include "rmvl/core/init.hpp"
+
+namespace rm
+{
+
+namespace
+{
+
+//! 子系统注册项
+struct Subsystem
+{
+    std::string name; //!< 子系统名称
+    void (*fn)();     //!< 初始化回调
+    bool done{};      //!< 是否已完成初始化
+};
+
+//! 初始化上下文单例
+struct InitContext
+{
+    std::mutex mtx;                     //!< 保护子系统注册表
+    std::vector<Subsystem> subsystems; //!< 子系统注册表，按注册顺序排列
+
+    static InitContext &ctx()
+    {
+        static InitContext inst;
+        return inst;
+    }
+};
+
+} // namespace
+
+SubsystemRegistrar::SubsystemRegistrar(std::string_view name, void (*fn)()) noexcept
+{
+    auto &context = InitContext::ctx();
+    std::lock_guard lk(context.mtx);
+    context.subsystems.push_back({std::string(name), fn, false});
+}
+
+std::size_t init(const std::vector<std::string> &profile)
+{
+    auto &context = InitContext::ctx();
+    std::lock_guard lk(context.mtx);
+    std::size_t nums{};
+    for (auto &subsystem : context.subsystems)
+    {
+        if (!profile.empty() && std::find(profile.begin(), profile.end(), subsystem.name) == profile.end())
+            continue;
+        if (!subsystem.done)
+        {
+            subsystem.fn();
+            subsystem.done = true;
+        }
+        nums++;
+    }
+    return nums;
+}
+
+std::vector<std::string> subsystems()
+{
+    auto &context = InitContext::ctx();
+    std::lock_guard lk(context.mtx);
+    std::vector<std::string> retval;
+    retval.reserve(context.subsystems.size());
+    for (const auto &subsystem : context.subsystems)
+        retval.push_back(subsystem.name);
+    return retval;
+}
+
+} // namespace rm
@@ -11,6 +11,7 @@
 
 #ifndef _WIN32
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -32,10 +33,237 @@ PipeClient::PipeClient(std::string_view name) : _impl(new Impl(name)) {}
 bool PipeClient::read(std::string &data) { return _impl->read(data); }
 bool PipeClient::write(std::string_view data) { return _impl->write(data); }
 
+RMVL_IMPL_DEF(ShmServer)
+RMVL_IMPL_DEF(ShmClient)
+
+ShmServer::ShmServer(std::string_view name, std::size_t capacity) : _impl(new Impl(name, capacity)) {}
+bool ShmServer::read(std::string &data) { return _impl->read(data); }
+bool ShmServer::write(std::string_view data) { return _impl->write(data); }
+void *ShmServer::borrow() { return _impl->borrow(); }
+bool ShmServer::commit(std::size_t len) { return _impl->commit(len); }
+std::size_t ShmServer::capacity() const { return _impl->capacity(); }
+
+ShmClient::ShmClient(std::string_view name) : _impl(new Impl(name)) {}
+bool ShmClient::read(std::string &data) { return _impl->read(data); }
+bool ShmClient::write(std::string_view data) { return _impl->write(data); }
+void *ShmClient::borrow() { return _impl->borrow(); }
+bool ShmClient::commit(std::size_t len) { return _impl->commit(len); }
+std::size_t ShmClient::capacity() const { return _impl->capacity(); }
+
+RMVL_IMPL_DEF(BroadcastServer)
+RMVL_IMPL_DEF(BroadcastClient)
+
+BroadcastServer::BroadcastServer(std::string_view name, std::size_t slot_capacity, std::size_t slots) : _impl(new Impl(name, slot_capacity, slots)) {}
+bool BroadcastServer::write(std::string_view data) { return _impl->write(data); }
+void *BroadcastServer::borrow() { return _impl->borrow(); }
+bool BroadcastServer::commit(std::size_t len) { return _impl->commit(len); }
+std::size_t BroadcastServer::capacity() const { return _impl->capacity(); }
+
+BroadcastClient::BroadcastClient(std::string_view name) : _impl(new Impl(name)) {}
+bool BroadcastClient::read(std::string &data) { return _impl->read(data); }
+std::size_t BroadcastClient::skipped() const { return _impl->skipped(); }
+
+bool ShmTransport::create(std::string_view name, std::size_t capacity)
+{
+    _capacity = capacity;
+    if (!_shm.create(name, HEADER_SIZE + 2 * (HEADER_SIZE + capacity)))
+        return false;
+    *static_cast<uint64_t *>(_shm.get()) = capacity;
+    return true;
+}
+
+bool ShmTransport::open(std::string_view name)
+{
+    if (!_shm.open(name))
+        return false;
+    _capacity = *static_cast<uint64_t *>(_shm.get());
+    return true;
+}
+
+bool ShmTransport::readChannel(int idx, std::string &data, uint64_t &last_seq)
+{
+    if (_shm.get() == nullptr)
+        return false;
+    Channel *ch = channel(idx);
+    auto s1 = ch->seq.load(std::memory_order_acquire);
+    // 无新数据，或写入正在进行
+    if (s1 == last_seq || (s1 & 1))
+        return false;
+    auto len = ch->len;
+    if (len > _capacity)
+        return false;
+    data.assign(reinterpret_cast<const char *>(payload(idx)), len);
+    // 读取期间数据被覆盖则放弃本次读取
+    if (ch->seq.load(std::memory_order_acquire) != s1)
+        return false;
+    last_seq = s1;
+    return true;
+}
+
+void *ShmTransport::borrowChannel(int idx)
+{
+    if (_shm.get() == nullptr)
+        return nullptr;
+    // 序号自增为奇数，标记写入进行中
+    channel(idx)->seq.fetch_add(1, std::memory_order_acq_rel);
+    return payload(idx);
+}
+
+bool ShmTransport::commitChannel(int idx, std::size_t len)
+{
+    if (_shm.get() == nullptr || len > _capacity)
+        return false;
+    Channel *ch = channel(idx);
+    ch->len = len;
+    // 序号自增为偶数，发布本次写入
+    ch->seq.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+bool BroadcastRing::create(std::string_view name, std::size_t slot_capacity, std::size_t slots)
+{
+    if (slot_capacity == 0 || slots == 0)
+        return false;
+    if (!_shm.create(name, HEADER_SIZE + slots * (HEADER_SIZE + slot_capacity)))
+        return false;
+    _slot_capacity = slot_capacity;
+    _slots = slots;
+    Header *hdr = header();
+    hdr->slot_capacity = slot_capacity;
+    hdr->slots = slots;
+    return true;
+}
+
+bool BroadcastRing::open(std::string_view name)
+{
+    if (!_shm.open(name))
+        return false;
+    _slot_capacity = header()->slot_capacity;
+    _slots = header()->slots;
+    return true;
+}
+
+void *BroadcastRing::borrow()
+{
+    if (_shm.get() == nullptr)
+        return nullptr;
+    // 单写者场景，无需原子读取 count
+    auto idx = header()->count.load(std::memory_order_relaxed) % _slots;
+    // 序号自增为奇数，标记写入进行中
+    slot(idx)->seq.fetch_add(1, std::memory_order_acq_rel);
+    return payload(idx);
+}
+
+bool BroadcastRing::commit(std::size_t len)
+{
+    if (_shm.get() == nullptr || len > _slot_capacity)
+        return false;
+    Header *hdr = header();
+    auto idx = hdr->count.load(std::memory_order_relaxed) % _slots;
+    Slot *s = slot(idx);
+    s->len = len;
+    // 序号自增为偶数，发布本次写入，随后推进数据条数
+    s->seq.fetch_add(1, std::memory_order_release);
+    hdr->count.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+bool BroadcastRing::read(std::string &data, uint64_t &cursor, std::size_t &skipped)
+{
+    if (_shm.get() == nullptr || _slots == 0)
+        return false;
+    Header *hdr = header();
+    // 游标指向的槽位可能在读取期间被新一轮写入覆盖，覆盖时向后跳过并重试
+    for (std::size_t attempt = 0; attempt <= _slots; ++attempt)
+    {
+        auto count = hdr->count.load(std::memory_order_acquire);
+        if (cursor >= count)
+            return false;
+        // 滞后超出槽位个数时，跳至仍保留的最早数据
+        if (count - cursor > _slots)
+        {
+            skipped += count - _slots - cursor;
+            cursor = count - _slots;
+        }
+        auto idx = cursor % _slots;
+        Slot *s = slot(idx);
+        // 游标对应轮次的发布序号
+        auto expected = (cursor / _slots + 1) * 2;
+        auto s1 = s->seq.load(std::memory_order_acquire);
+        if (s1 != expected)
+        {
+            ++skipped, ++cursor;
+            continue;
+        }
+        auto len = s->len;
+        if (len > _slot_capacity)
+            return false;
+        data.assign(reinterpret_cast<const char *>(payload(idx)), len);
+        if (s->seq.load(std::memory_order_acquire) == s1)
+        {
+            ++cursor;
+            return true;
+        }
+        ++skipped, ++cursor;
+    }
+    return false;
+}
+
 using namespace std::string_literals;
 
 #ifdef _WIN32
 
+ShmSegment::~ShmSegment()
+{
+    if (_base != nullptr)
+        UnmapViewOfFile(_base);
+    if (_handle != nullptr)
+        CloseHandle(_handle);
+}
+
+bool ShmSegment::create(std::string_view name, std::size_t size)
+{
+    _name = "Local\\rmvl_shm_"s + name.data();
+    _map_size = size;
+    _handle = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                 static_cast<DWORD>(_map_size >> 32), static_cast<DWORD>(_map_size), _name.c_str());
+    if (_handle == nullptr)
+    {
+        ERROR_("Failed to create shared memory");
+        return false;
+    }
+    _base = MapViewOfFile(_handle, FILE_MAP_ALL_ACCESS, 0, 0, _map_size);
+    if (_base == nullptr)
+    {
+        ERROR_("Failed to map shared memory");
+        return false;
+    }
+    _owner = true;
+    return true;
+}
+
+bool ShmSegment::open(std::string_view name)
+{
+    _name = "Local\\rmvl_shm_"s + name.data();
+    _handle = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, _name.c_str());
+    if (_handle == nullptr)
+    {
+        ERROR_("Failed to open shared memory");
+        return false;
+    }
+    _base = MapViewOfFile(_handle, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (_base == nullptr)
+    {
+        ERROR_("Failed to map shared memory");
+        return false;
+    }
+    MEMORY_BASIC_INFORMATION info{};
+    if (VirtualQuery(_base, &info, sizeof(info)) != 0)
+        _map_size = info.RegionSize;
+    return true;
+}
+
+
 static void closePipe(HANDLE handle)
 {
     if (handle != INVALID_HANDLE_VALUE)
@@ -192,6 +420,71 @@ PipeClient::Impl::~Impl() { closePipe(_fd); }
 bool PipeClient::Impl::read(std::string &data) { return readPipe(_fd, data); }
 bool PipeClient::Impl::write(std::string_view data) { return writePipe(_fd, data); }
 
+
+ShmSegment::~ShmSegment()
+{
+    if (_base != nullptr)
+        munmap(_base, _map_size);
+    if (_fd != -1)
+        ::close(_fd);
+    if (_owner)
+        shm_unlink(_name.c_str());
+}
+
+bool ShmSegment::create(std::string_view name, std::size_t size)
+{
+    _name = "/rmvl_shm_"s + name.data();
+    _map_size = size;
+    // 清理可能由异常退出残留的同名共享内存段
+    shm_unlink(_name.c_str());
+    _fd = shm_open(_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
+    if (_fd == -1)
+    {
+        ERROR_("Failed to create shared memory");
+        return false;
+    }
+    if (ftruncate(_fd, _map_size) != 0)
+    {
+        ERROR_("Failed to resize shared memory");
+        return false;
+    }
+    _base = mmap(nullptr, _map_size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (_base == MAP_FAILED)
+    {
+        _base = nullptr;
+        ERROR_("Failed to map shared memory");
+        return false;
+    }
+    _owner = true;
+    return true;
+}
+
+bool ShmSegment::open(std::string_view name)
+{
+    _name = "/rmvl_shm_"s + name.data();
+    _fd = shm_open(_name.c_str(), O_RDWR, 0666);
+    if (_fd == -1)
+    {
+        ERROR_("Failed to open shared memory");
+        return false;
+    }
+    struct stat st{};
+    if (fstat(_fd, &st) != 0)
+    {
+        ERROR_("Failed to stat shared memory");
+        return false;
+    }
+    _map_size = st.st_size;
+    _base = mmap(nullptr, _map_size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (_base == MAP_FAILED)
+    {
+        _base = nullptr;
+        ERROR_("Failed to map shared memory");
+        return false;
+    }
+    return true;
+}
+
 #endif
 
 } // namespace rm
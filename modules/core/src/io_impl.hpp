@@ -15,29 +15,95 @@
 #include <windows.h>
 #endif
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "rmvl/core/io.hpp"
+#include "uring.hpp"
 
 namespace rm
 {
 
+//! 自定义波特率上限 /Bd
+constexpr uint32_t MAX_CUSTOM_BAUD = 3000000;
+
+#ifdef __linux__
+/**
+ * @brief 经 `termios2` 的 `BOTHER` 标志设置任意非标准波特率
+ * @note 定义于 `baud.cpp`：所需的内核头 `<asm/termbits.h>` 与 glibc 的 `<termios.h>`
+ *       存在类型重定义冲突，需在不包含后者的独立翻译单元中实现
+ *
+ * @param[in] fd 串口文件描述符
+ * @param[in] baud 波特率 /Bd
+ * @return 是否设置成功
+ */
+bool setCustomBaudRate(int fd, uint32_t baud);
+#endif
+
 class SerialPort::Impl
 {
 public:
-    explicit Impl(std::string_view device, SerialPortMode mode = {}) : _device(device), _mode(mode) { open(); }
+    explicit Impl(std::string_view device, SerialPortMode mode = {}) : _device(device), _mode(mode)
+    {
+        open();
+        if (_mode.write_mode == SerialWriteMode::ASYNC)
+            _writer = std::thread(&Impl::writerLoop, this);
+    }
 
-    ~Impl() { close(); }
+    ~Impl()
+    {
+        stopReadEvent();
+        if (_writer.joinable())
+        {
+            {
+                std::lock_guard lk(_wq_mutex);
+                _writer_stop = true;
+            }
+            _wq_cv.notify_one();
+            _writer.join();
+        }
+        close();
+    }
 
     void open();
     void close();
 
     //! 串口是否打开
     inline bool isOpened() const { return _is_open; }
-    //! 写入数据
-    long int fdwrite(const void *data, std::size_t len);
-    //! 读取数据
-    long int fdread(void *data, std::size_t len);
+    //! 写入数据，异步模式下仅将数据复制到预分配的环形队列，`quiet` 时失败诊断记入环形缓冲
+    long int fdwrite(const void *data, std::size_t len, bool quiet = false);
+    //! 读取数据，`quiet` 时失败诊断记入环形缓冲而非直接输出
+    long int fdread(void *data, std::size_t len, bool quiet = false);
+
+    //! 启动事件驱动读取
+    void startReadEvent(uint8_t head_flag, uint8_t tail_flag, std::size_t len, const std::function<void(const uint8_t *)> &callback);
+    //! 停止事件驱动读取
+    void stopReadEvent();
 
 private:
+    //! 异步写入队列的数据帧槽位
+    struct WriteSlot
+    {
+        std::size_t len;   //!< 数据帧长度
+        uint8_t data[256]; //!< 数据帧内容
+    };
+
+    //! 写入数据（基于文件描述符，直接写入）
+    long int fdwriteDirect(const void *data, std::size_t len, bool quiet = false);
+    //! 写入一批数据帧，可用时经 io_uring 单次提交，否则逐帧直接写入
+    void writeBatch(const WriteSlot *slots, std::size_t n);
+    //! 后台写入线程循环，从环形队列中取出数据帧并写入串口
+    void writerLoop();
+    //! 后台读取线程循环，等待数据到来并累积到接收缓冲区
+    void readerLoop();
+    //! 从接收缓冲区中解析完整的数据帧并交付回调
+    void parseFrames();
+
+    //! 异步写入队列的槽位个数
+    static constexpr std::size_t WQ_SIZE = 64;
+
 #ifdef _WIN32
     HANDLE _handle{INVALID_HANDLE_VALUE}; //!< 文件句柄
 #else
@@ -46,6 +112,28 @@ private:
     bool _is_open{};      //!< 串口打开标志位
     std::string _device;  //!< 设备名
     SerialPortMode _mode; //!< 串口通信模式
+
+#ifdef RMVL_HAVE_IO_URING
+    UringQueue _uring;  //!< io_uring 批量提交队列
+    bool _uring_init{}; //!< 是否已尝试创建批量提交队列
+#endif
+
+    WriteSlot _wq[WQ_SIZE];         //!< 异步写入环形队列（构造时一次性分配）
+    std::size_t _wq_head{};         //!< 队首下标（后台线程取出位置）
+    std::size_t _wq_size{};         //!< 队列中的数据帧个数
+    bool _writer_stop{};            //!< 后台写入线程停止标志
+    std::mutex _wq_mutex;           //!< 队列互斥锁
+    std::condition_variable _wq_cv; //!< 队列条件变量
+    std::thread _writer;            //!< 后台写入线程
+
+    uint8_t _head_flag{};                             //!< 头帧
+    uint8_t _tail_flag{};                             //!< 尾帧
+    std::size_t _frame_len{};                         //!< 数据帧长度（不含头尾帧）
+    std::function<void(const uint8_t *)> _frame_callback; //!< 数据帧回调函数
+    uint8_t _rxbuf[1024];                             //!< 接收累积缓冲区
+    std::size_t _rx_size{};                           //!< 接收累积缓冲区中的字节数
+    std::atomic<bool> _reader_stop{};                 //!< 后台读取线程停止标志
+    std::thread _reader;                              //!< 后台读取线程
 };
 
 class PipeServer::Impl
@@ -70,6 +158,251 @@ private:
 #endif
 };
 
+//! 共享内存段的创建、打开与映射
+class ShmSegment
+{
+public:
+    ShmSegment() = default;
+    ~ShmSegment();
+
+    ShmSegment(const ShmSegment &) = delete;
+    ShmSegment &operator=(const ShmSegment &) = delete;
+
+    //! 创建指定大小的共享内存段（创建者），内容清零，销毁时移除
+    bool create(std::string_view name, std::size_t size);
+    //! 打开存在的共享内存段
+    bool open(std::string_view name);
+
+    //! 共享内存段映射首地址，未映射时为空指针
+    inline void *get() const { return _base; }
+
+private:
+    void *_base{};           //!< 共享内存段映射首地址
+    std::size_t _map_size{}; //!< 共享内存段映射长度
+    std::string _name;       //!< 共享内存名称
+    bool _owner{};           //!< 是否为创建者
+
+#ifdef _WIN32
+    HANDLE _handle{}; //!< 文件映射句柄
+#else
+    int _fd{-1}; //!< 文件描述符
+#endif
+};
+
+/**
+ * @brief 共享内存双向通道读写
+ * @brief
+ * - 共享内存段布局为 `[容量字段][通道 0 头部][通道 0 数据][通道 1 头部][通道 1 数据]`，
+ *   其中通道 0 为服务端 \f$\to\f$ 客户端方向，通道 1 为客户端 \f$\to\f$ 服务端方向
+ * @brief
+ * - 每条通道由顺序锁（seqlock）保护：写入方在写前、写后各将序号自增 `1`，
+ *   序号为奇数表示写入进行中，读取方读出后校验序号一致方视为有效
+ */
+class ShmTransport
+{
+public:
+    //! 通道头部
+    struct Channel
+    {
+        std::atomic<uint64_t> seq; //!< 顺序号，奇数表示写入进行中
+        uint64_t len;              //!< 有效数据长度
+    };
+
+    //! 通道头部对齐长度，避免相邻通道的伪共享
+    static constexpr std::size_t HEADER_SIZE = 64;
+
+    //! 创建新的共享内存段（服务端），销毁时移除
+    bool create(std::string_view name, std::size_t capacity);
+    //! 打开存在的共享内存段（客户端）
+    bool open(std::string_view name);
+
+    //! 从指定通道读取数据，`last_seq` 用于跳过已读取过的数据
+    bool readChannel(int idx, std::string &data, uint64_t &last_seq);
+    //! 借出指定通道的写缓冲区
+    void *borrowChannel(int idx);
+    //! 提交指定通道借出的写缓冲区
+    bool commitChannel(int idx, std::size_t len);
+
+    //! 单条通道的容量
+    inline std::size_t capacity() const { return _capacity; }
+
+private:
+    //! 指定通道的头部
+    inline Channel *channel(int idx) const
+    {
+        return reinterpret_cast<Channel *>(static_cast<uint8_t *>(_shm.get()) + HEADER_SIZE + idx * (HEADER_SIZE + _capacity));
+    }
+    //! 指定通道的数据区首地址
+    inline uint8_t *payload(int idx) const
+    {
+        return reinterpret_cast<uint8_t *>(channel(idx)) + HEADER_SIZE;
+    }
+
+    ShmSegment _shm;         //!< 共享内存段
+    std::size_t _capacity{}; //!< 单条通道的容量
+};
+
+/**
+ * @brief 共享内存环形槽位队列（单写者多读者广播）
+ * @brief
+ * - 共享内存段布局为 `[队列头部][槽位 0 头部][槽位 0 数据]...[槽位 N-1 头部][槽位 N-1 数据]`，
+ *   写入方按数据条数取模选择槽位循环写入，队列头部维护单调递增的已写入条数
+ * @brief
+ * - 每个槽位由顺序锁（seqlock）保护：第 `gen` 轮写入前序号置为 \f$2gen+1\f$，写入后置为
+ *   \f$2(gen+1)\f$，读取方由自身游标推算期望序号，不一致即表示槽位已被新一轮写入覆盖；
+ *   读取游标由各读取方自行持有，互不影响
+ */
+class BroadcastRing
+{
+public:
+    //! 队列头部
+    struct Header
+    {
+        uint64_t slot_capacity;      //!< 单个槽位的容量
+        uint64_t slots;              //!< 槽位个数
+        std::atomic<uint64_t> count; //!< 已写入的数据条数
+    };
+
+    //! 槽位头部
+    struct Slot
+    {
+        std::atomic<uint64_t> seq; //!< 顺序号，奇数表示写入进行中
+        uint64_t len;              //!< 有效数据长度
+    };
+
+    //! 头部对齐长度，避免相邻槽位的伪共享
+    static constexpr std::size_t HEADER_SIZE = 64;
+
+    //! 创建新的共享内存段（服务端），销毁时移除
+    bool create(std::string_view name, std::size_t slot_capacity, std::size_t slots);
+    //! 打开存在的共享内存段（订阅客户端）
+    bool open(std::string_view name);
+
+    //! 借出下一个槽位的写缓冲区
+    void *borrow();
+    //! 提交借出的写缓冲区并发布
+    bool commit(std::size_t len);
+    //! 读取游标 `cursor` 指向的下一条数据，`skipped` 累计因滞后而跳过的条数
+    bool read(std::string &data, uint64_t &cursor, std::size_t &skipped);
+
+    //! 单个槽位的容量
+    inline std::size_t capacity() const { return _slot_capacity; }
+
+private:
+    //! 队列头部
+    inline Header *header() const { return static_cast<Header *>(_shm.get()); }
+    //! 指定槽位的头部
+    inline Slot *slot(std::size_t idx) const
+    {
+        return reinterpret_cast<Slot *>(static_cast<uint8_t *>(_shm.get()) + HEADER_SIZE + idx * (HEADER_SIZE + _slot_capacity));
+    }
+    //! 指定槽位的数据区首地址
+    inline uint8_t *payload(std::size_t idx) const
+    {
+        return reinterpret_cast<uint8_t *>(slot(idx)) + HEADER_SIZE;
+    }
+
+    ShmSegment _shm;              //!< 共享内存段
+    std::size_t _slot_capacity{}; //!< 单个槽位的容量
+    std::size_t _slots{};         //!< 槽位个数
+};
+
+class ShmServer::Impl
+{
+public:
+    Impl(std::string_view name, std::size_t capacity) { _shm.create(name, capacity); }
+
+    //! 读取数据（通道 1：客户端 → 服务端）
+    inline bool read(std::string &data) { return _shm.readChannel(1, data, _last_seq); }
+    //! 写入数据（通道 0：服务端 → 客户端）
+    inline bool write(std::string_view data)
+    {
+        if (data.size() > _shm.capacity())
+            return false;
+        void *dst = _shm.borrowChannel(0);
+        if (dst == nullptr)
+            return false;
+        std::memcpy(dst, data.data(), data.size());
+        return _shm.commitChannel(0, data.size());
+    }
+
+    inline void *borrow() { return _shm.borrowChannel(0); }
+    inline bool commit(std::size_t len) { return _shm.commitChannel(0, len); }
+    inline std::size_t capacity() const { return _shm.capacity(); }
+
+private:
+    ShmTransport _shm;     //!< 共享内存段
+    uint64_t _last_seq{};  //!< 接收通道最近一次读取的序号
+};
+
+class ShmClient::Impl
+{
+public:
+    explicit Impl(std::string_view name) { _shm.open(name); }
+
+    //! 读取数据（通道 0：服务端 → 客户端）
+    inline bool read(std::string &data) { return _shm.readChannel(0, data, _last_seq); }
+    //! 写入数据（通道 1：客户端 → 服务端）
+    inline bool write(std::string_view data)
+    {
+        if (data.size() > _shm.capacity())
+            return false;
+        void *dst = _shm.borrowChannel(1);
+        if (dst == nullptr)
+            return false;
+        std::memcpy(dst, data.data(), data.size());
+        return _shm.commitChannel(1, data.size());
+    }
+
+    inline void *borrow() { return _shm.borrowChannel(1); }
+    inline bool commit(std::size_t len) { return _shm.commitChannel(1, len); }
+    inline std::size_t capacity() const { return _shm.capacity(); }
+
+private:
+    ShmTransport _shm;    //!< 共享内存段
+    uint64_t _last_seq{}; //!< 接收通道最近一次读取的序号
+};
+
+class BroadcastServer::Impl
+{
+public:
+    Impl(std::string_view name, std::size_t slot_capacity, std::size_t slots) { _ring.create(name, slot_capacity, slots); }
+
+    //! 写入数据，发布给全部订阅客户端
+    inline bool write(std::string_view data)
+    {
+        if (data.size() > _ring.capacity())
+            return false;
+        void *dst = _ring.borrow();
+        if (dst == nullptr)
+            return false;
+        std::memcpy(dst, data.data(), data.size());
+        return _ring.commit(data.size());
+    }
+
+    inline void *borrow() { return _ring.borrow(); }
+    inline bool commit(std::size_t len) { return _ring.commit(len); }
+    inline std::size_t capacity() const { return _ring.capacity(); }
+
+private:
+    BroadcastRing _ring; //!< 共享内存环形槽位队列
+};
+
+class BroadcastClient::Impl
+{
+public:
+    explicit Impl(std::string_view name) { _ring.open(name); }
+
+    //! 按发布顺序读取下一条数据
+    inline bool read(std::string &data) { return _ring.read(data, _cursor, _skipped); }
+    inline std::size_t skipped() const { return _skipped; }
+
+private:
+    BroadcastRing _ring;    //!< 共享内存环形槽位队列
+    uint64_t _cursor{};     //!< 读取游标，指向下一条待读取的数据
+    std::size_t _skipped{}; //!< 因滞后而跳过的数据条数
+};
+
 class PipeClient::Impl
 {
 public:
@@ -0,0 +1,224 @@
+/**
+ * @file link.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief TCP 跨主机消息链路
+ * @version 1.0
+ * @date 2025-08-29
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
+#include "rmvl/core/io.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm
+{
+
+namespace
+{
+
+#ifdef _WIN32
+using socket_t = SOCKET;
+constexpr socket_t INVALID_SOCK = INVALID_SOCKET;
+
+//! 进程内一次性初始化 Winsock
+bool initSocket()
+{
+    static bool retval = []() {
+        WSADATA wsa_data;
+        return WSAStartup(MAKEWORD(2, 2), &wsa_data) == 0;
+    }();
+    return retval;
+}
+
+inline void closeSocket(socket_t fd) { ::closesocket(fd); }
+#else
+using socket_t = int;
+constexpr socket_t INVALID_SOCK = -1;
+
+inline bool initSocket() { return true; }
+inline void closeSocket(socket_t fd) { ::close(fd); }
+#endif
+
+//! 循环发送至全部写出，套接字缓冲区充满时在 `send` 内阻塞（背压）
+bool sendAll(socket_t fd, const void *data, std::size_t len)
+{
+    auto p = static_cast<const char *>(data);
+    while (len != 0)
+    {
+        auto n = ::send(fd, p, static_cast<int>(len), 0);
+        if (n <= 0)
+            return false;
+        p += n, len -= n;
+    }
+    return true;
+}
+
+//! 循环接收至读满指定长度，无数据时阻塞，对端断开时返回 `false`
+bool recvAll(socket_t fd, void *data, std::size_t len)
+{
+    auto p = static_cast<char *>(data);
+    while (len != 0)
+    {
+        auto n = ::recv(fd, p, static_cast<int>(len), 0);
+        if (n <= 0)
+            return false;
+        p += n, len -= n;
+    }
+    return true;
+}
+
+//! 消息链路帧：`uint32` 长度前缀 + 消息内容，保持流上的消息边界
+bool writeMessage(socket_t fd, std::string_view data)
+{
+    if (fd == INVALID_SOCK)
+        return false;
+    auto len = static_cast<uint32_t>(data.size());
+    return sendAll(fd, &len, sizeof(len)) && sendAll(fd, data.data(), data.size());
+}
+
+bool readMessage(socket_t fd, std::string &data)
+{
+    if (fd == INVALID_SOCK)
+        return false;
+    uint32_t len{};
+    if (!recvAll(fd, &len, sizeof(len)))
+        return false;
+    data.resize(len);
+    return recvAll(fd, data.data(), len);
+}
+
+//! 关闭 Nagle 算法，小消息立即发出，降低阶段边界交接的附加时延
+inline void setNoDelay(socket_t fd)
+{
+    int flag = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char *>(&flag), sizeof(flag));
+}
+
+} // namespace
+
+class TcpServer::Impl
+{
+public:
+    explicit Impl(uint16_t port)
+    {
+        if (!initSocket())
+        {
+            ERROR_("Failed to initialize socket environment");
+            return;
+        }
+        socket_t listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (listen_fd == INVALID_SOCK)
+        {
+            ERROR_("Failed to create the listening socket");
+            return;
+        }
+        int reuse = 1;
+        ::setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char *>(&reuse), sizeof(reuse));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(port);
+        if (::bind(listen_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 || ::listen(listen_fd, 1) != 0)
+        {
+            ERROR_("Failed to bind the listening socket to port %u", port);
+            closeSocket(listen_fd);
+            return;
+        }
+        // 单对端模型，接受首个连接后即关闭监听套接字
+        _fd = ::accept(listen_fd, nullptr, nullptr);
+        closeSocket(listen_fd);
+        if (_fd == INVALID_SOCK)
+        {
+            ERROR_("Failed to accept the peer connection");
+            return;
+        }
+        setNoDelay(_fd);
+    }
+
+    ~Impl()
+    {
+        if (_fd != INVALID_SOCK)
+            closeSocket(_fd);
+    }
+
+    bool read(std::string &data) { return readMessage(_fd, data); }
+    bool write(std::string_view data) { return writeMessage(_fd, data); }
+
+private:
+    socket_t _fd{INVALID_SOCK}; //!< 对端连接套接字
+};
+
+class TcpClient::Impl
+{
+public:
+    Impl(std::string_view host, uint16_t port)
+    {
+        if (!initSocket())
+        {
+            ERROR_("Failed to initialize socket environment");
+            return;
+        }
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        if (::inet_pton(AF_INET, host.data(), &addr.sin_addr) != 1)
+        {
+            ERROR_("Invalid host address \"%s\"", host.data());
+            return;
+        }
+        _fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (_fd == INVALID_SOCK)
+        {
+            ERROR_("Failed to create the client socket");
+            return;
+        }
+        if (::connect(_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0)
+        {
+            ERROR_("Failed to connect to \"%s:%u\"", host.data(), port);
+            closeSocket(_fd);
+            _fd = INVALID_SOCK;
+            return;
+        }
+        setNoDelay(_fd);
+    }
+
+    ~Impl()
+    {
+        if (_fd != INVALID_SOCK)
+            closeSocket(_fd);
+    }
+
+    bool read(std::string &data) { return readMessage(_fd, data); }
+    bool write(std::string_view data) { return writeMessage(_fd, data); }
+
+private:
+    socket_t _fd{INVALID_SOCK}; //!< 连接套接字
+};
+
+RMVL_IMPL_DEF(TcpServer)
+RMVL_IMPL_DEF(TcpClient)
+
+TcpServer::TcpServer(uint16_t port) : _impl(new Impl(port)) {}
+bool TcpServer::read(std::string &data) { return _impl->read(data); }
+bool TcpServer::write(std::string_view data) { return _impl->write(data); }
+
+TcpClient::TcpClient(std::string_view host, uint16_t port) : _impl(new Impl(host, port)) {}
+bool TcpClient::read(std::string &data) { return _impl->read(data); }
+bool TcpClient::write(std::string_view data) { return _impl->write(data); }
+
+} // namespace rm
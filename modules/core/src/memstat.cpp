@@ -0,0 +1,139 @@
+/**
+ * @file memstat.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 内存分配统计模块
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "rmvl/core/memstat.hpp"
+
+namespace rm::memstat
+{
+
+//! 内存统计通道，热路径仅涉及松散原子操作
+struct MemChannel
+{
+    std::atomic<uint64_t> alloc_count{}; //!< 分配次数
+    std::atomic<uint64_t> free_count{};  //!< 释放次数
+    std::atomic<uint64_t> alloc_bytes{}; //!< 累计分配字节数
+    std::atomic<uint64_t> live_bytes{};  //!< 在用字节数
+    std::atomic<uint64_t> peak_bytes{};  //!< 在用字节数峰值
+    std::atomic<uint64_t> pool_hits{};   //!< 缓冲池命中次数
+    std::atomic<uint64_t> pool_misses{}; //!< 缓冲池未命中次数
+};
+
+namespace
+{
+
+//! 统计上下文单例
+struct MemStatContext
+{
+    std::mutex mtx;                                                          //!< 保护通道注册表
+    std::map<std::string, std::unique_ptr<MemChannel>, std::less<>> channels; //!< 通道注册表
+
+    static MemStatContext &ctx()
+    {
+        static MemStatContext inst;
+        return inst;
+    }
+};
+
+//! 由内存统计通道生成摘要
+Summary makeSummary(const MemChannel &chn)
+{
+    Summary retval{};
+    retval.alloc_count = chn.alloc_count.load(std::memory_order_relaxed);
+    retval.free_count = chn.free_count.load(std::memory_order_relaxed);
+    retval.alloc_bytes = chn.alloc_bytes.load(std::memory_order_relaxed);
+    retval.live_bytes = chn.live_bytes.load(std::memory_order_relaxed);
+    retval.peak_bytes = chn.peak_bytes.load(std::memory_order_relaxed);
+    retval.pool_hits = chn.pool_hits.load(std::memory_order_relaxed);
+    retval.pool_misses = chn.pool_misses.load(std::memory_order_relaxed);
+    return retval;
+}
+
+} // namespace
+
+void recordAlloc(MemChannel &chn, std::size_t bytes)
+{
+    chn.alloc_count.fetch_add(1, std::memory_order_relaxed);
+    chn.alloc_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    auto live = chn.live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    auto peak = chn.peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !chn.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+        ;
+}
+
+void recordFree(MemChannel &chn, std::size_t bytes)
+{
+    chn.free_count.fetch_add(1, std::memory_order_relaxed);
+    chn.live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void recordPool(MemChannel &chn, bool hit)
+{
+    if (hit)
+        chn.pool_hits.fetch_add(1, std::memory_order_relaxed);
+    else
+        chn.pool_misses.fetch_add(1, std::memory_order_relaxed);
+}
+
+void start() { _memstat_active.store(true, std::memory_order_release); }
+
+void stop() { _memstat_active.store(false, std::memory_order_release); }
+
+MemChannel &channel(std::string_view name)
+{
+    auto &context = MemStatContext::ctx();
+    std::lock_guard lk(context.mtx);
+    auto it = context.channels.find(name);
+    if (it == context.channels.end())
+        it = context.channels.emplace(std::string(name), std::make_unique<MemChannel>()).first;
+    return *it->second;
+}
+
+Summary summary(std::string_view name)
+{
+    auto &context = MemStatContext::ctx();
+    std::lock_guard lk(context.mtx);
+    auto it = context.channels.find(name);
+    return it == context.channels.end() ? Summary{} : makeSummary(*it->second);
+}
+
+std::vector<std::pair<std::string, Summary>> exportAll()
+{
+    auto &context = MemStatContext::ctx();
+    std::lock_guard lk(context.mtx);
+    std::vector<std::pair<std::string, Summary>> retval;
+    retval.reserve(context.channels.size());
+    for (const auto &[name, chn] : context.channels)
+        retval.emplace_back(name, makeSummary(*chn));
+    return retval;
+}
+
+void reset()
+{
+    auto &context = MemStatContext::ctx();
+    std::lock_guard lk(context.mtx);
+    for (auto &[name, chn] : context.channels)
+    {
+        chn->alloc_count.store(0, std::memory_order_relaxed);
+        chn->free_count.store(0, std::memory_order_relaxed);
+        chn->alloc_bytes.store(0, std::memory_order_relaxed);
+        chn->live_bytes.store(0, std::memory_order_relaxed);
+        chn->peak_bytes.store(0, std::memory_order_relaxed);
+        chn->pool_hits.store(0, std::memory_order_relaxed);
+        chn->pool_misses.store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace rm::memstat
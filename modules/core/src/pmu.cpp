@@ -0,0 +1,107 @@
+/**
+ * @file pmu.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 硬件性能计数模块
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include "rmvl/core/pmu.hpp"
+
+#ifdef __linux__
+
+#include <cstring>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace rm
+{
+
+//! 待打开的硬件事件，顺序与 PmuCounts 各计数一致，首个为组长
+static constexpr uint64_t pmu_events[4]{PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+PmuCounters::PmuCounters()
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = pmu_events[i];
+        // 仅统计用户态，降低所需的 perf_event_paranoid 权限等级
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        // 整组单次 read 读取，按标识区分各事件
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
+        int fd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, _fds[0], 0));
+        if (fd < 0)
+        {
+            // 组长打开失败则整组不可用，个别事件失败仅该计数恒为零
+            if (i == 0)
+                return;
+            continue;
+        }
+        ::ioctl(fd, PERF_EVENT_IOC_ID, &_ids[i]);
+        _fds[i] = fd;
+    }
+}
+
+PmuCounters::~PmuCounters()
+{
+    // 先关闭组员，最后关闭组长
+    for (int i = 3; i >= 0; --i)
+        if (_fds[i] >= 0)
+            ::close(_fds[i]);
+}
+
+PmuCounts PmuCounters::snapshot() const noexcept
+{
+    PmuCounts counts{};
+    if (!valid())
+        return counts;
+    // PERF_FORMAT_GROUP 读取布局：{ nr, [value, id] × nr }
+    uint64_t buf[1 + 2 * 4]{};
+    if (::read(_fds[0], buf, sizeof(buf)) < 0)
+        return counts;
+    uint64_t *vals[4]{&counts.cycles, &counts.instructions, &counts.cache_misses, &counts.branch_misses};
+    for (uint64_t i = 0; i < buf[0] && i < 4; ++i)
+        for (int j = 0; j < 4; ++j)
+            if (_fds[j] >= 0 && buf[2 + 2 * i] == _ids[j])
+                *vals[j] = buf[1 + 2 * i];
+    return counts;
+}
+
+} // namespace rm
+
+#else
+
+namespace rm
+{
+
+PmuCounters::PmuCounters() = default;
+
+PmuCounters::~PmuCounters() = default;
+
+PmuCounts PmuCounters::snapshot() const noexcept { return {}; }
+
+} // namespace rm
+
+#endif // __linux__
+
+namespace rm
+{
+
+PmuCounters &threadPmu()
+{
+    thread_local PmuCounters pmu;
+    return pmu;
+}
+
+} // namespace rm
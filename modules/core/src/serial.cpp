@@ -16,8 +16,13 @@
 #ifndef _WIN32
 #include <dirent.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <termios.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <linux/serial.h>
+#include <sys/ioctl.h>
+#endif
 #endif
 
 namespace rm
@@ -46,6 +51,19 @@ static unsigned int getBaudRate(BaudRate baud_rate)
         return CBR_57600;
     case BaudRate::BR_115200:
         return CBR_115200;
+    // DCB 的波特率字段为任意数值，高速率无对应的 CBR_ 常量，直接返回数值
+    case BaudRate::BR_230400:
+        return 230400;
+    case BaudRate::BR_460800:
+        return 460800;
+    case BaudRate::BR_921600:
+        return 921600;
+    case BaudRate::BR_1000000:
+        return 1000000;
+    case BaudRate::BR_2000000:
+        return 2000000;
+    case BaudRate::BR_3000000:
+        return 3000000;
     default:
         return CBR_115200;
     }
@@ -68,6 +86,30 @@ static unsigned int getBaudRate(BaudRate baud_rate)
         return B57600;
     case BaudRate::BR_115200:
         return B115200;
+#ifdef B230400
+    case BaudRate::BR_230400:
+        return B230400;
+#endif
+#ifdef B460800
+    case BaudRate::BR_460800:
+        return B460800;
+#endif
+#ifdef B921600
+    case BaudRate::BR_921600:
+        return B921600;
+#endif
+#ifdef B1000000
+    case BaudRate::BR_1000000:
+        return B1000000;
+#endif
+#ifdef B2000000
+    case BaudRate::BR_2000000:
+        return B2000000;
+#endif
+#ifdef B3000000
+    case BaudRate::BR_3000000:
+        return B3000000;
+#endif
     default:
         return B115200;
     }
@@ -93,6 +135,135 @@ bool SerialPort::read(std::string &data)
 
 long int SerialPort::fdwrite(const void *data, size_t length) { return _impl->fdwrite(data, length); }
 long int SerialPort::fdread(void *data, size_t len) { return _impl->fdread(data, len); }
+long int SerialPort::fdwriteQuiet(const void *data, size_t length) noexcept { return _impl->fdwrite(data, length, true); }
+long int SerialPort::fdreadQuiet(void *data, size_t len) noexcept { return _impl->fdread(data, len, true); }
+
+long int SerialPort::Impl::fdwrite(const void *data, std::size_t len, bool quiet)
+{
+    // 同步模式或数据帧超出槽位容量时直接写入
+    if (_mode.write_mode == SerialWriteMode::SYNC || len > sizeof(WriteSlot::data))
+        return fdwriteDirect(data, len, quiet);
+    {
+        std::lock_guard lk(_wq_mutex);
+        // 队列已满时丢弃最早的数据帧，保证控制链路始终发送最新数据
+        if (_wq_size == WQ_SIZE)
+        {
+            _wq_head = (_wq_head + 1) % WQ_SIZE;
+            --_wq_size;
+            DEBUG_WARNING_("Serial port write queue is full, the oldest frame is dropped.");
+        }
+        auto &slot = _wq[(_wq_head + _wq_size) % WQ_SIZE];
+        std::memcpy(slot.data, data, len);
+        slot.len = len;
+        ++_wq_size;
+    }
+    _wq_cv.notify_one();
+    return static_cast<long int>(len);
+}
+
+void SerialPort::startReadEvent(uint8_t head_flag, uint8_t tail_flag, std::size_t length, const std::function<void(const uint8_t *)> &callback)
+{
+    _impl->startReadEvent(head_flag, tail_flag, length, callback);
+}
+void SerialPort::stopReadEvent() { _impl->stopReadEvent(); }
+
+void SerialPort::Impl::startReadEvent(uint8_t head_flag, uint8_t tail_flag, std::size_t len, const std::function<void(const uint8_t *)> &callback)
+{
+    if (len + 2 > sizeof(_rxbuf))
+        RMVL_Error_(RMVL_StsBadArg, "The frame length %zu exceeds the receive buffer capacity.", len);
+    // 重复注册时先停止原有的读取线程
+    stopReadEvent();
+    _head_flag = head_flag, _tail_flag = tail_flag;
+    _frame_len = len, _frame_callback = callback;
+    _rx_size = 0;
+    _reader_stop = false;
+    _reader = std::thread(&Impl::readerLoop, this);
+}
+
+void SerialPort::Impl::stopReadEvent()
+{
+    _reader_stop = true;
+    if (_reader.joinable())
+        _reader.join();
+}
+
+void SerialPort::Impl::parseFrames()
+{
+    const std::size_t frame = _frame_len + 2;
+    std::size_t pos = 0;
+    while (pos + frame <= _rx_size)
+    {
+        if (_rxbuf[pos] == _head_flag && _rxbuf[pos + _frame_len + 1] == _tail_flag)
+        {
+            _frame_callback(_rxbuf + pos + 1);
+            pos += frame;
+        }
+        else
+            ++pos;
+    }
+    // 保留尚未构成完整数据帧的尾部字节
+    if (pos != 0)
+    {
+        std::memmove(_rxbuf, _rxbuf + pos, _rx_size - pos);
+        _rx_size -= pos;
+    }
+    // 异常数据填满缓冲区且无法定界时整体丢弃
+    if (_rx_size == sizeof(_rxbuf))
+        _rx_size = 0;
+}
+
+void SerialPort::Impl::writerLoop()
+{
+    WriteSlot batch[WQ_SIZE];
+    while (true)
+    {
+        std::size_t n{};
+        {
+            std::unique_lock lk(_wq_mutex);
+            _wq_cv.wait(lk, [this] { return _wq_size != 0 || _writer_stop; });
+            if (_writer_stop && _wq_size == 0)
+                return;
+            // 一次性取走全部排队数据帧到线程局部槽位后立即解锁，写串口期间不持有锁
+            for (; _wq_size != 0; ++n)
+            {
+                batch[n] = _wq[_wq_head];
+                _wq_head = (_wq_head + 1) % WQ_SIZE;
+                --_wq_size;
+            }
+        }
+        writeBatch(batch, n);
+    }
+}
+
+void SerialPort::Impl::writeBatch(const WriteSlot *slots, std::size_t n)
+{
+#ifdef RMVL_HAVE_IO_URING
+    if (!_uring_init)
+    {
+        _uring_init = true;
+        // 内核过旧或 io_uring 被禁用（如容器 seccomp 策略）时创建失败，保持逐帧写入
+        if (!_uring.init(WQ_SIZE))
+            DEBUG_WARNING_("io_uring is unavailable, serial writes fall back to write(2).");
+    }
+    if (n > 1 && _uring.ok() && _is_open)
+    {
+        // 批量写入前统一清空输出缓冲区，随后单次系统调用提交全部数据帧
+        tcflush(_fd, TCOFLUSH);
+        for (std::size_t i = 0; i < n; ++i)
+            _uring.prepWrite(_fd, slots[i].data, static_cast<unsigned>(slots[i].len));
+        if (_uring.submit() == n)
+        {
+            DEBUG_INFO_("Success to write the serial port.");
+            return;
+        }
+        WARNING_("Unable to write to serial port, restart...");
+        open();
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < n; ++i)
+        fdwriteDirect(slots[i].data, slots[i].len);
+}
 
 #ifdef _WIN32
 void SerialPort::Impl::open()
@@ -137,7 +308,8 @@ void SerialPort::Impl::open()
 
     DCB dcb{};
     GetCommState(_handle, &dcb);
-    DWORD bps = getBaudRate(_mode.baud_rate);
+    // DCB 的波特率字段为任意数值，自定义波特率直接写入
+    DWORD bps = _mode.custom_baud != 0 ? std::min<DWORD>(_mode.custom_baud, MAX_CUSTOM_BAUD) : getBaudRate(_mode.baud_rate);
     dcb.BaudRate = bps;        // 波特率
     dcb.ByteSize = 8;          // 数据位
     dcb.Parity = NOPARITY;     // 无校验
@@ -159,24 +331,27 @@ void SerialPort::Impl::close()
     _is_open = false;
 }
 
-long int SerialPort::Impl::fdwrite(const void *data, std::size_t len)
+long int SerialPort::Impl::fdwriteDirect(const void *data, std::size_t len, bool quiet)
 {
     DWORD len_result{};
     if (_is_open)
     {
         if (!WriteFile(_handle, data, static_cast<DWORD>(len), &len_result, nullptr))
         {
-            WARNING_("Unable to write to serial port, error code: %ld", ::GetLastError());
+            if (quiet)
+                diagLog(Errc::IOError, "SerialPort::tryWrite");
+            else
+                WARNING_("Unable to write to serial port, error code: %ld", ::GetLastError());
             open();
         }
-        else
+        else if (!quiet)
             DEBUG_INFO_("Success to write the serial port.");
     }
 
     return len_result;
 }
 
-long int SerialPort::Impl::fdread(void *data, std::size_t len)
+long int SerialPort::Impl::fdread(void *data, std::size_t len, bool quiet)
 {
     DWORD len_result{};
 
@@ -184,7 +359,10 @@ long int SerialPort::Impl::fdread(void *data, std::size_t len)
     {
         if (!ReadFile(_handle, data, static_cast<DWORD>(len), &len_result, nullptr))
         {
-            WARNING_("The serial port cannot be read, error code: %ld, restart...", ::GetLastError());
+            if (quiet)
+                diagLog(Errc::IOError, "SerialPort::tryRead");
+            else
+                WARNING_("The serial port cannot be read, error code: %ld, restart...", ::GetLastError());
             open();
         }
     }
@@ -195,6 +373,22 @@ long int SerialPort::Impl::fdread(void *data, std::size_t len)
     return len_result;
 }
 
+
+void SerialPort::Impl::readerLoop()
+{
+    while (!_reader_stop)
+    {
+        DWORD n{};
+        if (ReadFile(_handle, _rxbuf + _rx_size, static_cast<DWORD>(sizeof(_rxbuf) - _rx_size), &n, nullptr) && n > 0)
+        {
+            _rx_size += n;
+            parseFrames();
+        }
+        else
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
 #else
 void SerialPort::Impl::open()
 {
@@ -233,6 +427,30 @@ void SerialPort::Impl::open()
     // 设置新属性，TCSANOW：所有改变立即生效
     tcsetattr(_fd, TCSANOW, &option);
 
+#ifdef __linux__
+    // 自定义波特率经 termios2 的 BOTHER 标志设置，覆盖上方的标准速率
+    if (_mode.custom_baud != 0)
+    {
+        uint32_t baud = _mode.custom_baud;
+        if (baud > MAX_CUSTOM_BAUD)
+        {
+            WARNING_("The custom baud rate %u exceeds the maximum of %u, clamped.", baud, MAX_CUSTOM_BAUD);
+            baud = MAX_CUSTOM_BAUD;
+        }
+        if (!setCustomBaudRate(_fd, baud))
+            WARNING_("Failed to set the custom baud rate: %u.", baud);
+    }
+    // 内核低时延模式：将 FTDI 等 USB 转串口适配器的延迟定时器从默认 16ms 降至 1ms，
+    // 非 USB 转串口设备不支持该配置时忽略，不影响通信
+    serial_struct ser{};
+    if (ioctl(_fd, TIOCGSERIAL, &ser) == 0)
+    {
+        ser.flags |= ASYNC_LOW_LATENCY;
+        if (ioctl(_fd, TIOCSSERIAL, &ser) != 0)
+            DEBUG_WARNING_("The serial port does not support the low latency mode.");
+    }
+#endif
+
     _is_open = true;
 }
 
@@ -243,7 +461,7 @@ void SerialPort::Impl::close()
     _is_open = false;
 }
 
-long int SerialPort::Impl::fdwrite(const void *data, std::size_t length)
+long int SerialPort::Impl::fdwriteDirect(const void *data, std::size_t length, bool quiet)
 {
     ssize_t len_result = -1;
     if (_is_open)
@@ -255,16 +473,19 @@ long int SerialPort::Impl::fdwrite(const void *data, std::size_t length)
 
     if (len_result != static_cast<ssize_t>(length))
     {
-        WARNING_("Unable to write to serial port, restart...");
+        if (quiet)
+            diagLog(Errc::IOError, "SerialPort::tryWrite");
+        else
+            WARNING_("Unable to write to serial port, restart...");
         open();
     }
-    else
+    else if (!quiet)
         DEBUG_INFO_("Success to write the serial port.");
 
     return len_result;
 }
 
-long int SerialPort::Impl::fdread(void *data, std::size_t len)
+long int SerialPort::Impl::fdread(void *data, std::size_t len, bool quiet)
 {
     ssize_t len_result = -1;
 
@@ -276,7 +497,10 @@ long int SerialPort::Impl::fdread(void *data, std::size_t len)
 
     if (len_result == -1)
     {
-        WARNING_("The serial port cannot be read, restart...");
+        if (quiet)
+            diagLog(Errc::IOError, "SerialPort::tryRead");
+        else
+            WARNING_("The serial port cannot be read, restart...");
         open();
     }
     else if (len_result == 0)
@@ -286,6 +510,24 @@ long int SerialPort::Impl::fdread(void *data, std::size_t len)
     return len_result;
 }
 
+
+void SerialPort::Impl::readerLoop()
+{
+    while (!_reader_stop)
+    {
+        pollfd pfd{_fd, POLLIN, 0};
+        // 以 100ms 超时等待数据到来，保证停止标志能够被及时响应
+        int rc = ::poll(&pfd, 1, 100);
+        if (rc <= 0 || !(pfd.revents & POLLIN))
+            continue;
+        auto n = ::read(_fd, _rxbuf + _rx_size, sizeof(_rxbuf) - _rx_size);
+        if (n <= 0)
+            continue;
+        _rx_size += n;
+        parseFrames();
+    }
+}
+
 #endif
 
 } // namespace rm
@@ -0,0 +1,279 @@
+/**
+ * @file stats.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 运行时耗时统计模块
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "rmvl/core/stats.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm::stats
+{
+
+//! 统计通道，热路径仅涉及松散原子操作
+struct StageStats
+{
+    static constexpr std::size_t RING_SIZE = 1024; //!< 分位数采样环容量，需为 2 的幂
+
+    std::atomic<uint64_t> count{};                 //!< 采样次数
+    std::atomic<uint64_t> sum_ns{};                //!< 耗时总和（单位：ns）
+    std::atomic<uint64_t> min_ns{UINT64_MAX};      //!< 最小耗时（单位：ns）
+    std::atomic<uint64_t> max_ns{};                //!< 最大耗时（单位：ns）
+    std::atomic<std::size_t> depth{};              //!< 最近一次队列深度
+    std::array<std::atomic<uint64_t>, RING_SIZE> ring{}; //!< 最近采样环（单位：ns）
+    // 硬件性能计数累计值，仅在 PMU 采样启动且计数器可用时更新
+    std::atomic<uint64_t> cycles{};        //!< 时钟周期总数
+    std::atomic<uint64_t> instructions{};  //!< 退役指令总数
+    std::atomic<uint64_t> cache_misses{};  //!< 缓存缺失总数
+    std::atomic<uint64_t> branch_misses{}; //!< 分支预测失败总数
+};
+
+namespace
+{
+
+//! 统计上下文单例
+struct StatsContext
+{
+    std::mutex mtx;                                                          //!< 保护通道注册表
+    std::map<std::string, std::unique_ptr<StageStats>, std::less<>> channels; //!< 通道注册表
+
+    static StatsContext &ctx()
+    {
+        static StatsContext inst;
+        return inst;
+    }
+};
+
+//! 由统计通道生成摘要
+Summary makeSummary(const StageStats &stats)
+{
+    Summary retval{};
+    retval.count = stats.count.load(std::memory_order_relaxed);
+    if (retval.count == 0)
+        return retval;
+    retval.mean = static_cast<double>(stats.sum_ns.load(std::memory_order_relaxed)) / static_cast<double>(retval.count) * 1e-9;
+    retval.min = static_cast<double>(stats.min_ns.load(std::memory_order_relaxed)) * 1e-9;
+    retval.max = static_cast<double>(stats.max_ns.load(std::memory_order_relaxed)) * 1e-9;
+    retval.depth = stats.depth.load(std::memory_order_relaxed);
+    // 分位数由最近的采样环计算
+    std::size_t num = std::min<std::size_t>(retval.count, StageStats::RING_SIZE);
+    std::vector<uint64_t> samples(num);
+    for (std::size_t i = 0; i < num; ++i)
+        samples[i] = stats.ring[i].load(std::memory_order_relaxed);
+    std::sort(samples.begin(), samples.end());
+    auto quantile = [&](double q) { return static_cast<double>(samples[static_cast<std::size_t>(q * static_cast<double>(num - 1))]) * 1e-9; };
+    retval.p50 = quantile(0.5);
+    retval.p90 = quantile(0.9);
+    retval.p99 = quantile(0.99);
+    // 硬件性能计数指标由累计值计算，未采样时保持为 0
+    PmuCounts pmu{stats.cycles.load(std::memory_order_relaxed), stats.instructions.load(std::memory_order_relaxed),
+                  stats.cache_misses.load(std::memory_order_relaxed), stats.branch_misses.load(std::memory_order_relaxed)};
+    retval.ipc = pmu.ipc();
+    retval.cache_mpki = pmu.cacheMpki();
+    retval.branch_mpki = pmu.branchMpki();
+    return retval;
+}
+
+} // namespace
+
+void record(StageStats &stats, double duration, std::size_t depth)
+{
+    if (duration < 0)
+        duration = 0;
+    const auto ns = static_cast<uint64_t>(duration * 1e9);
+    auto idx = stats.count.fetch_add(1, std::memory_order_relaxed);
+    stats.ring[idx & (StageStats::RING_SIZE - 1)].store(ns, std::memory_order_relaxed);
+    stats.sum_ns.fetch_add(ns, std::memory_order_relaxed);
+    auto cur = stats.min_ns.load(std::memory_order_relaxed);
+    while (ns < cur && !stats.min_ns.compare_exchange_weak(cur, ns, std::memory_order_relaxed))
+        ;
+    cur = stats.max_ns.load(std::memory_order_relaxed);
+    while (ns > cur && !stats.max_ns.compare_exchange_weak(cur, ns, std::memory_order_relaxed))
+        ;
+    stats.depth.store(depth, std::memory_order_relaxed);
+}
+
+void record(StageStats &stats, double duration, std::size_t depth, const PmuCounts &pmu)
+{
+    record(stats, duration, depth);
+    stats.cycles.fetch_add(pmu.cycles, std::memory_order_relaxed);
+    stats.instructions.fetch_add(pmu.instructions, std::memory_order_relaxed);
+    stats.cache_misses.fetch_add(pmu.cache_misses, std::memory_order_relaxed);
+    stats.branch_misses.fetch_add(pmu.branch_misses, std::memory_order_relaxed);
+}
+
+bool pmuSnapshot(PmuCounts &counts) noexcept
+{
+    auto &pmu = threadPmu();
+    if (!pmu.valid())
+        return false;
+    counts = pmu.snapshot();
+    return true;
+}
+
+void start() { _stats_active.store(true, std::memory_order_release); }
+
+void stop() { _stats_active.store(false, std::memory_order_release); }
+
+void startPmu() { _stats_pmu_active.store(true, std::memory_order_release); }
+
+void stopPmu() { _stats_pmu_active.store(false, std::memory_order_release); }
+
+StageStats &channel(std::string_view name)
+{
+    auto &context = StatsContext::ctx();
+    std::lock_guard lk(context.mtx);
+    auto it = context.channels.find(name);
+    if (it == context.channels.end())
+        it = context.channels.emplace(std::string(name), std::make_unique<StageStats>()).first;
+    return *it->second;
+}
+
+Summary summary(std::string_view name)
+{
+    auto &context = StatsContext::ctx();
+    std::lock_guard lk(context.mtx);
+    auto it = context.channels.find(name);
+    return it == context.channels.end() ? Summary{} : makeSummary(*it->second);
+}
+
+std::vector<std::pair<std::string, Summary>> exportAll()
+{
+    auto &context = StatsContext::ctx();
+    std::lock_guard lk(context.mtx);
+    std::vector<std::pair<std::string, Summary>> retval;
+    retval.reserve(context.channels.size());
+    for (const auto &[name, stats] : context.channels)
+        retval.emplace_back(name, makeSummary(*stats));
+    return retval;
+}
+
+void reset()
+{
+    auto &context = StatsContext::ctx();
+    std::lock_guard lk(context.mtx);
+    for (auto &[name, stats] : context.channels)
+    {
+        stats->count.store(0, std::memory_order_relaxed);
+        stats->sum_ns.store(0, std::memory_order_relaxed);
+        stats->min_ns.store(UINT64_MAX, std::memory_order_relaxed);
+        stats->max_ns.store(0, std::memory_order_relaxed);
+        stats->depth.store(0, std::memory_order_relaxed);
+        stats->cycles.store(0, std::memory_order_relaxed);
+        stats->instructions.store(0, std::memory_order_relaxed);
+        stats->cache_misses.store(0, std::memory_order_relaxed);
+        stats->branch_misses.store(0, std::memory_order_relaxed);
+    }
+}
+
+double calibration()
+{
+    double best = std::numeric_limits<double>::max();
+    // 固定迭代次数的整数串行运算（xorshift），多次运行取最小值以抑制调度噪声
+    for (int run = 0; run < 3; ++run)
+    {
+        uint64_t x = 0x9e3779b97f4a7c15ull;
+        double start = Timer::now();
+        for (uint32_t i = 0; i < (1u << 21); ++i)
+        {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+        }
+        double elapsed = Timer::now() - start;
+        volatile uint64_t sink = x;
+        (void)sink;
+        best = std::min(best, elapsed);
+    }
+    return best;
+}
+
+std::vector<BudgetDiff> checkBudget(std::string_view path)
+{
+    std::ifstream ifs{std::string(path)};
+    if (!ifs.is_open())
+    {
+        ERROR_("stats - failed to open the budget file \"%s\"", std::string(path).c_str());
+        return {};
+    }
+    // 解析预算条目，耗时以 ms 记录，保留条目 calibration 给出参考机的标定负载耗时
+    std::vector<std::pair<std::string, double>> entries;
+    double reference{};
+    std::string line;
+    auto trim = [](std::string_view sv) {
+        while (!sv.empty() && std::isspace(static_cast<unsigned char>(sv.front())))
+            sv.remove_prefix(1);
+        while (!sv.empty() && std::isspace(static_cast<unsigned char>(sv.back())))
+            sv.remove_suffix(1);
+        return sv;
+    };
+    while (std::getline(ifs, line))
+    {
+        if (auto pos = line.find('#'); pos != std::string::npos)
+            line.erase(pos);
+        auto pos = line.find('=');
+        if (pos == std::string::npos)
+            continue;
+        auto name = trim(std::string_view(line).substr(0, pos));
+        auto value = trim(std::string_view(line).substr(pos + 1));
+        if (name.empty() || value.empty())
+            continue;
+        double budget = std::strtod(std::string(value).c_str(), nullptr) * 1e-3;
+        if (name == "calibration")
+            reference = budget;
+        else
+            entries.emplace_back(name, budget);
+    }
+    // 机器档归一化：预算按本机与参考机标定负载耗时之比缩放
+    double scale = reference > 0. ? calibration() / reference : 1.;
+    auto datas = exportAll();
+    std::vector<BudgetDiff> retval;
+    retval.reserve(entries.size());
+    for (const auto &[stage, budget] : entries)
+    {
+        BudgetDiff diff{stage, budget * scale, 0., false};
+        std::size_t count{};
+        for (const auto &[name, sum] : datas)
+        {
+            // 条目名与通道名按前缀匹配，前缀后需为 '/'、'@' 或名称结尾
+            if (name.size() < stage.size() || name.compare(0, stage.size(), stage) != 0)
+                continue;
+            if (name.size() > stage.size() && name[stage.size()] != '/' && name[stage.size()] != '@')
+                continue;
+            // 多个实例通道匹配同一条目时取其中最大的 p90
+            diff.measured = std::max(diff.measured, sum.p90);
+            count += sum.count;
+        }
+        diff.over = count == 0 || diff.measured > diff.budget;
+        retval.push_back(std::move(diff));
+    }
+    return retval;
+}
+
+std::string budgetReport(const std::vector<BudgetDiff> &diffs)
+{
+    std::string retval{"stage                            budget /ms      p90 /ms\n"};
+    char buf[128];
+    for (const auto &diff : diffs)
+        retval += str::format_to(buf, "%-32s %10.3f %12.3f%s\n", diff.stage.c_str(), diff.budget * 1e3,
+                                 diff.measured * 1e3, diff.over ? "   EXCEEDED" : "");
+    return retval;
+}
+
+} // namespace rm::stats
@@ -0,0 +1,104 @@
+/**
+ * @file statspage.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 共享内存统计页
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <atomic>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "rmvl/core/statspage.hpp"
+
+namespace rm::stats
+{
+
+//! 页头，随后紧跟 `PageField::FIELD_NUM` 个 `uint64` 字段
+struct PageHeader
+{
+    uint32_t magic;   //!< 魔数 "RMST"
+    uint32_t version; //!< 页面布局版本号
+    uint64_t fields;  //!< 字段数
+};
+
+static constexpr uint32_t PAGE_MAGIC = 0x54534D52; // "RMST"（小端）
+static constexpr uint32_t PAGE_VERSION = 1;
+static constexpr std::size_t FIELD_NUM = static_cast<std::size_t>(PageField::FIELD_NUM);
+static constexpr std::size_t PAGE_BYTES = sizeof(PageHeader) + sizeof(uint64_t) * FIELD_NUM;
+
+// 外部进程按裸 uint64 读取各字段，要求原子类型与其值类型布局一致且免锁
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t));
+
+//! 共享映射是否成功
+static bool page_shared{};
+//! 映射失败时的进程内静态页
+static std::atomic<uint64_t> local_page[FIELD_NUM]{};
+
+const char *pagePath() noexcept
+{
+#ifdef __linux__
+    return "/dev/shm/rmvl_stats";
+#else
+    return "";
+#endif
+}
+
+/**
+ * @brief 获取统计页字段数组，首次调用时完成映射
+ * @note 映射在 `/dev/shm` 下以普通文件完成，外部进程以只读方式映射同一文件即可。
+ *       页面不随进程退出删除，看板可读取到最后一次写入的指标
+ */
+static std::atomic<uint64_t> *page() noexcept
+{
+    static std::atomic<uint64_t> *slots = []() -> std::atomic<uint64_t> * {
+#ifdef __linux__
+        int fd = ::open(pagePath(), O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+        if (fd >= 0)
+        {
+            if (::ftruncate(fd, PAGE_BYTES) == 0)
+            {
+                void *mem = ::mmap(nullptr, PAGE_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                ::close(fd);
+                if (mem != MAP_FAILED)
+                {
+                    auto hdr = static_cast<PageHeader *>(mem);
+                    hdr->version = PAGE_VERSION;
+                    hdr->fields = FIELD_NUM;
+                    // 魔数最后写入并同步发布，外部读取方以魔数判定页面就绪
+                    hdr->magic = PAGE_MAGIC;
+                    std::atomic_thread_fence(std::memory_order_release);
+                    page_shared = true;
+                    return reinterpret_cast<std::atomic<uint64_t> *>(static_cast<char *>(mem) + sizeof(PageHeader));
+                }
+            }
+            else
+                ::close(fd);
+        }
+#endif
+        return local_page;
+    }();
+    return slots;
+}
+
+bool pageActive() noexcept
+{
+    page();
+    return page_shared;
+}
+
+void pageSet(PageField field, uint64_t value) noexcept { page()[static_cast<std::size_t>(field)].store(value, std::memory_order_relaxed); }
+
+void pageAdd(PageField field, uint64_t delta) noexcept { page()[static_cast<std::size_t>(field)].fetch_add(delta, std::memory_order_relaxed); }
+
+uint64_t pageGet(PageField field) noexcept { return page()[static_cast<std::size_t>(field)].load(std::memory_order_relaxed); }
+
+} // namespace rm::stats
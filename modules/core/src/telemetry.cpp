@@ -0,0 +1,304 @@
+/**
+ * @file telemetry.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief UDP 组播遥测通道
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <vector>
+
+#include "rmvl/core/io.hpp"
+#include "rmvl/core/timer.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm
+{
+
+namespace
+{
+
+#ifdef _WIN32
+using socket_t = SOCKET;
+constexpr socket_t INVALID_SOCK = INVALID_SOCKET;
+
+//! 进程内一次性初始化 Winsock
+bool initSocket()
+{
+    static bool retval = []() {
+        WSADATA wsa_data;
+        return WSAStartup(MAKEWORD(2, 2), &wsa_data) == 0;
+    }();
+    return retval;
+}
+
+inline void closeSocket(socket_t fd) { ::closesocket(fd); }
+inline bool setNonBlock(socket_t fd)
+{
+    u_long mode = 1;
+    return ::ioctlsocket(fd, FIONBIO, &mode) == 0;
+}
+#else
+using socket_t = int;
+constexpr socket_t INVALID_SOCK = -1;
+
+inline bool initSocket() { return true; }
+inline void closeSocket(socket_t fd) { ::close(fd); }
+inline bool setNonBlock(socket_t fd) { return ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK) == 0; }
+#endif
+
+//! 批次头部
+struct BatchHeader
+{
+    uint16_t magic;    //!< 魔数，用于过滤无关报文
+    uint16_t count;    //!< 批次内的样本条数
+    uint32_t sequence; //!< 批次序列号，单调递增
+};
+
+//! 批次头部魔数 `"MT"`
+constexpr uint16_t TELEMETRY_MAGIC = 0x4d54;
+//! 单条样本的头部长度：`uint16` 通道标识与 `uint16` 数据长度
+constexpr std::size_t SAMPLE_HEADER_SIZE = 2 * sizeof(uint16_t);
+
+} // namespace
+
+class TelemetryPublisher::Impl
+{
+public:
+    Impl(std::string_view group, uint16_t port, double period, std::size_t capacity) : _period(period)
+    {
+        if (capacity <= sizeof(BatchHeader) + SAMPLE_HEADER_SIZE)
+        {
+            ERROR_("Telemetry batch capacity %zu is too small", capacity);
+            return;
+        }
+        if (!initSocket())
+        {
+            ERROR_("Failed to initialize socket environment");
+            return;
+        }
+        std::memset(&_addr, 0, sizeof(_addr));
+        _addr.sin_family = AF_INET;
+        _addr.sin_port = htons(port);
+        if (::inet_pton(AF_INET, std::string(group).c_str(), &_addr.sin_addr) != 1)
+        {
+            ERROR_("Invalid multicast group address \"%s\"", std::string(group).c_str());
+            return;
+        }
+        _fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        if (_fd == INVALID_SOCK)
+        {
+            ERROR_("Failed to create telemetry publisher socket");
+            return;
+        }
+        // 遥测面向同一接入网内的场边工具，生存时间限制为 1 跳，并允许本机环回订阅
+        unsigned char ttl = 1, loop = 1;
+        ::setsockopt(_fd, IPPROTO_IP, IP_MULTICAST_TTL, reinterpret_cast<const char *>(&ttl), sizeof(ttl));
+        ::setsockopt(_fd, IPPROTO_IP, IP_MULTICAST_LOOP, reinterpret_cast<const char *>(&loop), sizeof(loop));
+        _buffer.reserve(capacity);
+        _capacity = capacity;
+        _last_flush = Timer::now();
+        beginBatch();
+    }
+
+    ~Impl()
+    {
+        if (_fd != INVALID_SOCK)
+        {
+            flush();
+            closeSocket(_fd);
+        }
+    }
+
+    bool publish(uint16_t id, const void *data, std::size_t len)
+    {
+        if (_fd == INVALID_SOCK || data == nullptr)
+            return false;
+        if (sizeof(BatchHeader) + SAMPLE_HEADER_SIZE + len > _capacity)
+            return false;
+        // 剩余空间不足时先整批发出，保证单条样本不跨报文
+        if (_buffer.size() + SAMPLE_HEADER_SIZE + len > _capacity)
+            flush();
+        uint16_t sample_len = static_cast<uint16_t>(len);
+        const auto old_size = _buffer.size();
+        _buffer.resize(old_size + SAMPLE_HEADER_SIZE + len);
+        std::memcpy(_buffer.data() + old_size, &id, sizeof(id));
+        std::memcpy(_buffer.data() + old_size + sizeof(id), &sample_len, sizeof(sample_len));
+        std::memcpy(_buffer.data() + old_size + SAMPLE_HEADER_SIZE, data, len);
+        ++_count;
+        // 距上次发出超过发布周期时按周期发出，空闲时批次最多滞后一个周期
+        if (Timer::now() - _last_flush >= _period)
+            return flush();
+        return true;
+    }
+
+    bool flush()
+    {
+        _last_flush = Timer::now();
+        if (_fd == INVALID_SOCK || _count == 0)
+            return false;
+        auto *header = reinterpret_cast<BatchHeader *>(_buffer.data());
+        header->count = _count;
+        header->sequence = _sequence;
+        auto sent = ::sendto(_fd, reinterpret_cast<const char *>(_buffer.data()), static_cast<int>(_buffer.size()), 0,
+                             reinterpret_cast<const sockaddr *>(&_addr), sizeof(_addr));
+        bool retval = sent == static_cast<decltype(sent)>(_buffer.size());
+        ++_sequence;
+        beginBatch();
+        return retval;
+    }
+
+    inline uint32_t sequence() const { return _sequence; }
+
+private:
+    //! 重置批量缓冲区，预留批次头部
+    void beginBatch()
+    {
+        _buffer.resize(sizeof(BatchHeader));
+        auto *header = reinterpret_cast<BatchHeader *>(_buffer.data());
+        header->magic = TELEMETRY_MAGIC;
+        _count = 0;
+    }
+
+    socket_t _fd{INVALID_SOCK};   //!< 套接字
+    sockaddr_in _addr{};          //!< 组播组地址
+    double _period{};             //!< 发布周期（单位：s）
+    std::size_t _capacity{};      //!< 批量缓冲区容量（构造时一次性分配）
+    std::vector<uint8_t> _buffer; //!< 批量缓冲区
+    uint16_t _count{};            //!< 当前批次内的样本条数
+    uint32_t _sequence{};         //!< 下一批次的序列号
+    double _last_flush{};         //!< 最近一次发出的时间戳
+};
+
+class TelemetrySubscriber::Impl
+{
+public:
+    Impl(std::string_view group, uint16_t port)
+    {
+        if (!initSocket())
+        {
+            ERROR_("Failed to initialize socket environment");
+            return;
+        }
+        in_addr group_addr{};
+        if (::inet_pton(AF_INET, std::string(group).c_str(), &group_addr) != 1)
+        {
+            ERROR_("Invalid multicast group address \"%s\"", std::string(group).c_str());
+            return;
+        }
+        _fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        if (_fd == INVALID_SOCK)
+        {
+            ERROR_("Failed to create telemetry subscriber socket");
+            return;
+        }
+        // 允许同一主机上的多个订阅端绑定同一端口
+        int reuse = 1;
+        ::setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char *>(&reuse), sizeof(reuse));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        if (::bind(_fd, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)) != 0)
+        {
+            ERROR_("Failed to bind telemetry subscriber socket to port %u", port);
+            closeSocket(_fd);
+            _fd = INVALID_SOCK;
+            return;
+        }
+        ip_mreq mreq{};
+        mreq.imr_multiaddr = group_addr;
+        mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+        if (::setsockopt(_fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, reinterpret_cast<const char *>(&mreq), sizeof(mreq)) != 0)
+        {
+            ERROR_("Failed to join multicast group \"%s\"", std::string(group).c_str());
+            closeSocket(_fd);
+            _fd = INVALID_SOCK;
+            return;
+        }
+        setNonBlock(_fd);
+    }
+
+    ~Impl()
+    {
+        if (_fd != INVALID_SOCK)
+            closeSocket(_fd);
+    }
+
+    bool read(std::vector<TelemetrySample> &samples)
+    {
+        samples.clear();
+        if (_fd == INVALID_SOCK)
+            return false;
+        uint8_t buffer[65536];
+        auto received = ::recvfrom(_fd, reinterpret_cast<char *>(buffer), sizeof(buffer), 0, nullptr, nullptr);
+        if (received < static_cast<decltype(received)>(sizeof(BatchHeader)))
+            return false;
+        BatchHeader header;
+        std::memcpy(&header, buffer, sizeof(header));
+        if (header.magic != TELEMETRY_MAGIC)
+            return false;
+        // 由序列号间隙推算丢失的批次数，首个批次用于对齐序列号
+        if (_synced && header.sequence != _next_sequence)
+            _dropped += static_cast<uint32_t>(header.sequence - _next_sequence);
+        _next_sequence = header.sequence + 1;
+        _synced = true;
+        samples.reserve(header.count);
+        std::size_t offset = sizeof(BatchHeader);
+        const auto total = static_cast<std::size_t>(received);
+        for (uint16_t i = 0; i < header.count; ++i)
+        {
+            if (offset + SAMPLE_HEADER_SIZE > total)
+                break;
+            uint16_t id{}, len{};
+            std::memcpy(&id, buffer + offset, sizeof(id));
+            std::memcpy(&len, buffer + offset + sizeof(id), sizeof(len));
+            offset += SAMPLE_HEADER_SIZE;
+            if (offset + len > total)
+                break;
+            auto &sample = samples.emplace_back();
+            sample.id = id;
+            sample.data.assign(reinterpret_cast<const char *>(buffer + offset), len);
+            offset += len;
+        }
+        return !samples.empty();
+    }
+
+    inline std::size_t dropped() const { return _dropped; }
+
+private:
+    socket_t _fd{INVALID_SOCK}; //!< 套接字
+    uint32_t _next_sequence{};  //!< 期望的下一批次序列号
+    bool _synced{};             //!< 是否已与发布端序列号对齐
+    std::size_t _dropped{};     //!< 由序列号间隙推算出的丢失批次数
+};
+
+RMVL_IMPL_DEF(TelemetryPublisher)
+RMVL_IMPL_DEF(TelemetrySubscriber)
+
+TelemetryPublisher::TelemetryPublisher(std::string_view group, uint16_t port, double period, std::size_t capacity)
+    : _impl(new Impl(group, port, period, capacity)) {}
+bool TelemetryPublisher::publish(uint16_t id, const void *data, std::size_t len) { return _impl->publish(id, data, len); }
+bool TelemetryPublisher::flush() { return _impl->flush(); }
+uint32_t TelemetryPublisher::sequence() const { return _impl->sequence(); }
+
+TelemetrySubscriber::TelemetrySubscriber(std::string_view group, uint16_t port) : _impl(new Impl(group, port)) {}
+bool TelemetrySubscriber::read(std::vector<TelemetrySample> &samples) { return _impl->read(samples); }
+std::size_t TelemetrySubscriber::dropped() const { return _impl->dropped(); }
+
+} // namespace rm
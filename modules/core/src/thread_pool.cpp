@@ -0,0 +1,187 @@
+/**
+ * @file thread_pool.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 共享线程池服务
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <atomic>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+#include "rmvl/core/thread_pool.hpp"
+#include "rmvl/core/topology.hpp"
+
+namespace rm
+{
+
+ThreadPool::ThreadPool(std::size_t workers, bool pin) : _pin(pin)
+{
+    if (workers == 0)
+    {
+        std::size_t num = std::thread::hardware_concurrency();
+        workers = num > 1 ? num - 1 : 1;
+    }
+    _workers.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i)
+        _workers.emplace_back(std::make_unique<Worker>());
+    for (std::size_t i = 0; i < workers; ++i)
+        _workers[i]->thread = std::thread(&ThreadPool::work, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+    }
+    _cv.notify_all();
+    for (auto &worker : _workers)
+        worker->thread.join();
+}
+
+void ThreadPool::submit(std::function<void()> task, TaskLane lane)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (lane == TaskLane::High)
+            _high.push_back(std::move(task));
+        else
+        {
+            // 普通任务轮转分发至各工作线程的本地队列
+            _workers[_round]->tasks.push_back(std::move(task));
+            _round = (_round + 1) % _workers.size();
+        }
+    }
+    _cv.notify_one();
+}
+
+void ThreadPool::parallel_for(std::size_t begin, std::size_t end, const std::function<void(std::size_t, std::size_t)> &body, TaskLane lane)
+{
+    if (begin >= end)
+        return;
+    std::size_t num = end - begin;
+    // 子区间个数取工作线程数（含当前线程）的 2 倍，均衡负载的同时控制调度开销
+    std::size_t nchunks = std::min<std::size_t>(num, (_workers.size() + 1) * 2);
+    std::size_t chunk = (num + nchunks - 1) / nchunks;
+    //! 区间自调度的共享状态
+    struct ForState
+    {
+        std::atomic<std::size_t> next;      //!< 下一个待执行子区间的起始
+        std::atomic<std::size_t> remaining; //!< 未完成的子区间个数
+        std::mutex mtx;                     //!< 完成通知互斥锁
+        std::condition_variable done;       //!< 全部完成条件变量
+        std::exception_ptr eptr;            //!< 任务体抛出的首个异常
+    };
+    auto state = std::make_shared<ForState>();
+    state->next = begin;
+    state->remaining = (num + chunk - 1) / chunk;
+    auto runner = [state, end, chunk, &body]() {
+        for (;;)
+        {
+            std::size_t start = state->next.fetch_add(chunk);
+            if (start >= end)
+                break;
+            try
+            {
+                body(start, std::min(end, start + chunk));
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(state->mtx);
+                if (state->eptr == nullptr)
+                    state->eptr = std::current_exception();
+            }
+            if (state->remaining.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lock(state->mtx);
+                state->done.notify_all();
+            }
+        }
+    };
+    // 向工作线程提交协助任务，当前线程全程参与执行，不会因线程池繁忙而死锁
+    std::size_t helpers = std::min(state->remaining.load() - 1, _workers.size());
+    for (std::size_t i = 0; i < helpers; ++i)
+        submit(runner, lane);
+    runner();
+    std::unique_lock<std::mutex> lock(state->mtx);
+    state->done.wait(lock, [&state] { return state->remaining.load() == 0; });
+    if (state->eptr != nullptr)
+        std::rethrow_exception(state->eptr);
+}
+
+ThreadPool &ThreadPool::global()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::work(std::size_t idx)
+{
+#ifdef __linux__
+    // 优先按 CPU 拓扑服务配置的识别通道绑定，通道未配置时回退至依次绑定
+    if (!CpuTopology::global().bindCurrentThread(CpuLane::Detect) && _pin)
+    {
+        // 依次绑定至 CPU 核心，减少任务在核心间迁移带来的缓存失效
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(idx % std::thread::hardware_concurrency(), &cpuset);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+    }
+#endif
+    std::function<void()> task;
+    std::unique_lock<std::mutex> lock(_mtx);
+    while (true)
+    {
+        if (take(idx, task))
+        {
+            lock.unlock();
+            task();
+            task = nullptr;
+            lock.lock();
+        }
+        else if (_stop)
+            break;
+        else
+            _cv.wait(lock);
+    }
+}
+
+bool ThreadPool::take(std::size_t idx, std::function<void()> &task)
+{
+    // 高优先级通道优先于一切本地任务
+    if (!_high.empty())
+    {
+        task = std::move(_high.front());
+        _high.pop_front();
+        return true;
+    }
+    // 本地队列后进先出，保持缓存热度
+    auto &own = _workers[idx]->tasks;
+    if (!own.empty())
+    {
+        task = std::move(own.back());
+        own.pop_back();
+        return true;
+    }
+    // 自其他工作线程的队列头部窃取
+    for (std::size_t i = 1; i < _workers.size(); ++i)
+    {
+        auto &victim = _workers[(idx + i) % _workers.size()]->tasks;
+        if (!victim.empty())
+        {
+            task = std::move(victim.front());
+            victim.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace rm
@@ -0,0 +1,93 @@
+/**
+ * @file topology.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief CPU 拓扑与线程亲和性配置服务
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+#include "rmvl/core/topology.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm
+{
+
+CpuTopology &CpuTopology::global()
+{
+    static CpuTopology topology;
+    return topology;
+}
+
+void CpuTopology::setLane(CpuLane lane, const std::vector<int> &cpus)
+{
+    const unsigned num = std::thread::hardware_concurrency();
+    for (int cpu : cpus)
+        if (cpu < 0 || static_cast<unsigned>(cpu) >= num)
+            RMVL_Error_(RMVL_StsBadArg, "CPU id %d is out of range [0, %u)", cpu, num);
+    std::lock_guard<std::mutex> lock(_mtx);
+    _lanes[static_cast<std::size_t>(lane)] = cpus;
+}
+
+std::vector<int> CpuTopology::lane(CpuLane lane) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _lanes[static_cast<std::size_t>(lane)];
+}
+
+#ifdef __linux__
+
+/**
+ * @brief 将指定的 pthread 线程绑定至 CPU 核心集合，并按需设置实时调度
+ *
+ * @param[in] handle pthread 线程句柄
+ * @param[in] cpus CPU 核心编号列表
+ * @param[in] priority 实时调度优先级，为 `0` 时不改变调度策略
+ * @return 是否完成亲和性绑定
+ */
+static bool bindHandle(pthread_t handle, const std::vector<int> &cpus, int priority) noexcept
+{
+    if (cpus.empty())
+        return false;
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (int cpu : cpus)
+        CPU_SET(cpu, &cpuset);
+    if (pthread_setaffinity_np(handle, sizeof(cpuset), &cpuset) != 0)
+        return false;
+    if (priority > 0)
+    {
+        // 实时调度需要 CAP_SYS_NICE 权限，不足时仅完成亲和性绑定
+        sched_param param{};
+        param.sched_priority = priority;
+        if (pthread_setschedparam(handle, SCHED_FIFO, &param) != 0)
+            WARNING_("Failed to set SCHED_FIFO priority %d, affinity binding is still effective", priority);
+    }
+    return true;
+}
+
+bool CpuTopology::bindCurrentThread(CpuLane lane, int priority) const noexcept
+{
+    return bindHandle(pthread_self(), this->lane(lane), priority);
+}
+
+bool CpuTopology::bindThread(std::thread &thread, CpuLane lane, int priority) const noexcept
+{
+    return bindHandle(thread.native_handle(), this->lane(lane), priority);
+}
+
+#else
+
+bool CpuTopology::bindCurrentThread(CpuLane, int) const noexcept { return false; }
+
+bool CpuTopology::bindThread(std::thread &, CpuLane, int) const noexcept { return false; }
+
+#endif
+
+} // namespace rm
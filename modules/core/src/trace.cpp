@@ -0,0 +1,217 @@
+/**
+ * @file trace.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 低开销二进制跟踪模块
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "rmvl/core/trace.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm::trace
+{
+
+//! 跟踪文件头魔数，即小端字节序下的 "RMTR"
+constexpr uint32_t TRACE_MAGIC = 0x52544d52;
+//! 跟踪文件格式版本号
+constexpr uint32_t TRACE_VERSION = 1;
+//! 单线程环形缓冲区容量（2 的幂）
+constexpr std::size_t RING_SIZE = 2048;
+
+//! 单线程事件环形缓冲区，事件所属线程写入，后台落盘线程读出
+struct EventRing
+{
+    std::array<TraceEvent, RING_SIZE> data; //!< 事件记录存储
+    std::atomic<uint64_t> head{};           //!< 读指针，仅后台线程推进
+    std::atomic<uint64_t> tail{};           //!< 写指针，仅所属线程推进
+    std::atomic<uint64_t> drops{};          //!< 因缓冲区占满被丢弃的事件数
+    std::atomic<bool> retired{};            //!< 所属线程是否已退出
+};
+
+//! 跟踪全局上下文
+struct TraceContext
+{
+    std::mutex mtx;                               //!< 保护环形缓冲区列表与后台线程管理
+    std::condition_variable cv;                   //!< 用于通知后台线程及时退出
+    std::vector<std::shared_ptr<EventRing>> rings; //!< 各线程环形缓冲区
+    std::FILE *file{};                            //!< 跟踪文件句柄
+    std::thread worker;                           //!< 后台落盘线程
+    bool running{};                               //!< 后台线程运行标志位
+    uint64_t retired_drops{};                     //!< 已退出线程累计的丢弃事件数
+};
+
+static TraceContext &ctx()
+{
+    static TraceContext obj;
+    return obj;
+}
+
+//! 线程环形缓冲区持有者，线程首次写入时注册，线程退出时标记注销
+struct RingHolder
+{
+    std::shared_ptr<EventRing> ring{std::make_shared<EventRing>()};
+
+    RingHolder()
+    {
+        auto &c = ctx();
+        std::lock_guard lk(c.mtx);
+        c.rings.push_back(ring);
+    }
+
+    ~RingHolder() { ring->retired.store(true, std::memory_order_release); }
+};
+
+static EventRing &localRing()
+{
+    thread_local RingHolder holder;
+    return *holder.ring;
+}
+
+void push(const TraceEvent &ev)
+{
+    if (!active())
+        return;
+    auto &ring = localRing();
+    uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    if (tail - ring.head.load(std::memory_order_acquire) >= RING_SIZE)
+    {
+        ring.drops.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    ring.data[tail & (RING_SIZE - 1)] = ev;
+    ring.tail.store(tail + 1, std::memory_order_release);
+}
+
+//! 将单个环形缓冲区中的现存事件全部落盘
+static void drainRing(EventRing &ring, std::FILE *file)
+{
+    uint64_t head = ring.head.load(std::memory_order_relaxed);
+    const uint64_t tail = ring.tail.load(std::memory_order_acquire);
+    while (head != tail)
+    {
+        std::size_t idx = head & (RING_SIZE - 1);
+        std::size_t num = static_cast<std::size_t>(std::min<uint64_t>(tail - head, RING_SIZE - idx));
+        std::fwrite(&ring.data[idx], sizeof(TraceEvent), num, file);
+        head += num;
+    }
+    ring.head.store(tail, std::memory_order_release);
+}
+
+//! 后台落盘线程主循环
+static void workerLoop()
+{
+    auto &c = ctx();
+    std::unique_lock lk(c.mtx);
+    while (true)
+    {
+        for (auto &ring : c.rings)
+            drainRing(*ring, c.file);
+        // 已退出线程的缓冲区在排空后移除，丢弃数目汇总至全局上下文
+        c.rings.erase(std::remove_if(c.rings.begin(), c.rings.end(), [&c](const auto &ring) {
+                          if (!ring->retired.load(std::memory_order_acquire))
+                              return false;
+                          c.retired_drops += ring->drops.load(std::memory_order_relaxed);
+                          return true;
+                      }),
+                      c.rings.end());
+        if (!c.running)
+            break;
+        c.cv.wait_for(lk, std::chrono::milliseconds(5));
+    }
+    std::fflush(c.file);
+}
+
+void start(std::string_view file)
+{
+    auto &c = ctx();
+    std::lock_guard lk(c.mtx);
+    if (c.running)
+        RMVL_Error(RMVL_StsError, "Trace has already been started");
+    c.file = std::fopen(std::string(file).c_str(), "wb");
+    if (c.file == nullptr)
+        RMVL_Error_(RMVL_StsError, "Failed to open the trace file \"%s\"", std::string(file).c_str());
+    const uint32_t header[2]{TRACE_MAGIC, TRACE_VERSION};
+    std::fwrite(header, sizeof(header), 1, c.file);
+    // 丢弃跟踪停止期间残留在缓冲区中的事件
+    for (auto &ring : c.rings)
+    {
+        ring->head.store(ring->tail.load(std::memory_order_acquire), std::memory_order_release);
+        ring->drops.store(0, std::memory_order_relaxed);
+    }
+    c.retired_drops = 0;
+    c.running = true;
+    c.worker = std::thread(workerLoop);
+    _trace_active.store(true, std::memory_order_release);
+}
+
+void stop()
+{
+    auto &c = ctx();
+    {
+        std::lock_guard lk(c.mtx);
+        if (!c.running)
+            return;
+        _trace_active.store(false, std::memory_order_release);
+        c.running = false;
+    }
+    c.cv.notify_all();
+    c.worker.join();
+    std::fclose(c.file);
+    c.file = nullptr;
+}
+
+uint64_t dropped() noexcept
+{
+    auto &c = ctx();
+    std::lock_guard lk(c.mtx);
+    uint64_t retval = c.retired_drops;
+    for (const auto &ring : c.rings)
+        retval += ring->drops.load(std::memory_order_relaxed);
+    return retval;
+}
+
+std::vector<TraceEvent> read(std::string_view file)
+{
+    std::FILE *fp = std::fopen(std::string(file).c_str(), "rb");
+    if (fp == nullptr)
+        RMVL_Error_(RMVL_StsError, "Failed to open the trace file \"%s\"", std::string(file).c_str());
+    uint32_t header[2]{};
+    if (std::fread(header, sizeof(header), 1, fp) != 1 || header[0] != TRACE_MAGIC || header[1] != TRACE_VERSION)
+    {
+        std::fclose(fp);
+        RMVL_Error_(RMVL_StsInvFmt, "Invalid trace file \"%s\"", std::string(file).c_str());
+    }
+    std::vector<TraceEvent> retval;
+    TraceEvent ev{};
+    while (std::fread(&ev, sizeof(TraceEvent), 1, fp) == 1)
+        retval.push_back(ev);
+    std::fclose(fp);
+    return retval;
+}
+
+std::string format(const TraceEvent &ev)
+{
+    char buf[64]{};
+    snprintf(buf, sizeof(buf), "[%.6f] id=%u", ev.ts, ev.id);
+    std::string retval{buf};
+    for (uint32_t i = 0; i < ev.argc && i < 6; ++i)
+    {
+        snprintf(buf, sizeof(buf), "%s%g", i == 0 ? ": " : ", ", ev.args[i]);
+        retval += buf;
+    }
+    return retval;
+}
+
+} // namespace rm::trace
@@ -0,0 +1,191 @@
+/**
+ * @file tuner.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 内核变体启动自调优模块
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+
+#include "rmvl/core/para_cache.hpp"
+#include "rmvl/core/timer.hpp"
+#include "rmvl/core/tuner.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm::tuner
+{
+
+//! 选优表文件首行标识
+constexpr std::string_view TABLE_TAG = "RMVLTUNER1";
+//! 基准测试计时次数，取最短耗时，削弱调度抖动的影响
+constexpr std::size_t BENCH_REPS = 5;
+
+//! 自调优模块状态
+struct TunerState
+{
+    std::mutex mtx;                                        //!< 选优表互斥锁
+    std::string path;                                      //!< 选优表文件路径，为空时不做持久化
+    std::unordered_map<std::string, std::string> winners;  //!< 选优表，内核名称到胜者变体名称的映射
+    bool loaded{};                                         //!< 选优表是否已加载
+};
+
+static TunerState &state()
+{
+    static TunerState s;
+    return s;
+}
+
+std::string cpuModel()
+{
+#ifdef __linux__
+    std::FILE *fp = std::fopen("/proc/cpuinfo", "r");
+    if (fp != nullptr)
+    {
+        // x86 机型提供 "model name"，部分 ARM 机型（如 Jetson）以 "Hardware" 或 "Model" 标识
+        std::string model{};
+        char line[256];
+        while (std::fgets(line, sizeof(line), fp) != nullptr)
+        {
+            std::string_view sv = line;
+            for (std::string_view key : {"model name", "Hardware", "Model"})
+            {
+                if (sv.substr(0, key.size()) != key)
+                    continue;
+                auto pos = sv.find(':');
+                if (pos == std::string_view::npos)
+                    continue;
+                auto val = sv.substr(pos + 1);
+                while (!val.empty() && (val.front() == ' ' || val.front() == '\t'))
+                    val.remove_prefix(1);
+                while (!val.empty() && (val.back() == '\n' || val.back() == '\r'))
+                    val.remove_suffix(1);
+                if (!val.empty() && (model.empty() || key == std::string_view("model name")))
+                    model = val;
+            }
+            if (!model.empty() && sv.substr(0, 10) == "model name")
+                break;
+        }
+        std::fclose(fp);
+        if (!model.empty())
+            return model;
+    }
+#endif // __linux__
+    return "unknown";
+}
+
+/**
+ * @brief 加载选优表，首行的 CPU 型号哈希不匹配时视为更换机型，忽略全部内容
+ * @note 需持有 `state().mtx` 后调用
+ */
+static void load(TunerState &s)
+{
+    s.loaded = true;
+    s.winners.clear();
+    if (s.path.empty())
+        return;
+    std::FILE *fp = std::fopen(s.path.c_str(), "r");
+    if (fp == nullptr)
+        return;
+    auto model = cpuModel();
+    uint32_t cpu_hash = para::cache::fnv1a(model.data(), model.size());
+    char line[512];
+    char tag[32]{};
+    uint32_t hash{};
+    if (std::fgets(line, sizeof(line), fp) == nullptr ||
+        std::sscanf(line, "%31s %x", tag, &hash) != 2 || tag != TABLE_TAG || hash != cpu_hash)
+    {
+        std::fclose(fp);
+        return;
+    }
+    while (std::fgets(line, sizeof(line), fp) != nullptr)
+    {
+        std::string_view sv = line;
+        while (!sv.empty() && (sv.back() == '\n' || sv.back() == '\r'))
+            sv.remove_suffix(1);
+        auto pos = sv.find('=');
+        if (pos == std::string_view::npos || pos == 0 || pos + 1 == sv.size())
+            continue;
+        s.winners[std::string(sv.substr(0, pos))] = std::string(sv.substr(pos + 1));
+    }
+    std::fclose(fp);
+}
+
+/**
+ * @brief 持久化选优表，路径为空时不做任何操作
+ * @note 需持有 `state().mtx` 后调用
+ */
+static void save(const TunerState &s)
+{
+    if (s.path.empty())
+        return;
+    std::FILE *fp = std::fopen(s.path.c_str(), "w");
+    if (fp == nullptr)
+    {
+        WARNING_("(tuner) Failed to open the cache file: \"%s\"", s.path.c_str());
+        return;
+    }
+    auto model = cpuModel();
+    uint32_t cpu_hash = para::cache::fnv1a(model.data(), model.size());
+    std::fprintf(fp, "%s %08x\n", TABLE_TAG.data(), cpu_hash);
+    for (const auto &[kernel, winner] : s.winners)
+        std::fprintf(fp, "%s=%s\n", kernel.c_str(), winner.c_str());
+    std::fclose(fp);
+}
+
+void setCacheFile(std::string_view path)
+{
+    auto &s = state();
+    std::lock_guard<std::mutex> lock(s.mtx);
+    s.path = path;
+    load(s);
+}
+
+std::size_t select(std::string_view kernel, const std::vector<Variant> &variants)
+{
+    if (variants.empty())
+        RMVL_Error(RMVL_StsBadArg, "\"variants\" is empty");
+    if (variants.size() == 1)
+        return 0;
+    auto &s = state();
+    std::lock_guard<std::mutex> lock(s.mtx);
+    if (!s.loaded)
+        load(s);
+    // 命中选优表时直接返回胜者下标，不做基准测试
+    auto it = s.winners.find(std::string(kernel));
+    if (it != s.winners.end())
+        for (std::size_t i = 0; i < variants.size(); ++i)
+            if (variants[i].name == it->second)
+                return i;
+    // 各变体预热一次后计时若干次取最短耗时，最快者胜出
+    std::size_t best{};
+    double best_cost = std::numeric_limits<double>::max();
+    for (std::size_t i = 0; i < variants.size(); ++i)
+    {
+        variants[i].run();
+        double cost = std::numeric_limits<double>::max();
+        for (std::size_t rep = 0; rep < BENCH_REPS; ++rep)
+        {
+            double start = Timer::now();
+            variants[i].run();
+            cost = std::min(cost, Timer::now() - start);
+        }
+        if (cost < best_cost)
+        {
+            best_cost = cost;
+            best = i;
+        }
+    }
+    s.winners[std::string(kernel)] = variants[best].name;
+    save(s);
+    return best;
+}
+
+} // namespace rm::tuner
@@ -0,0 +1,179 @@
+/**
+ * @file uring.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief io_uring 批量提交队列
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define RMVL_HAVE_IO_URING 1
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace rm
+{
+
+/**
+ * @brief io_uring 批量提交队列
+ * @brief
+ * - 通过原生系统调用直接操作 io_uring，不引入 liburing 依赖，将多个写请求累积后
+ *   以单次 `io_uring_enter` 提交并等待完成，摊薄逐请求的系统调用开销
+ * @brief
+ * - 内核过旧或 io_uring 被禁用（如容器 seccomp 策略）时 init() 返回 `false`，
+ *   由调用方回退至逐次 `write(2)` 路径
+ */
+class UringQueue
+{
+public:
+    UringQueue() = default;
+
+    ~UringQueue()
+    {
+        if (_sqes != nullptr)
+            munmap(_sqes, _sqes_size);
+        if (_cq_ring != nullptr && _cq_ring != _sq_ring)
+            munmap(_cq_ring, _cq_ring_size);
+        if (_sq_ring != nullptr)
+            munmap(_sq_ring, _sq_ring_size);
+        if (_fd != -1)
+            ::close(_fd);
+    }
+
+    UringQueue(const UringQueue &) = delete;
+    UringQueue &operator=(const UringQueue &) = delete;
+
+    /**
+     * @brief 创建提交、完成队列并映射到用户态
+     *
+     * @param[in] entries 队列深度
+     * @return 是否创建成功，失败时不可用，后续 ok() 返回 `false`
+     */
+    bool init(unsigned entries) noexcept
+    {
+        io_uring_params p{};
+        int fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &p));
+        if (fd < 0)
+            return false;
+        _sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        _cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+        // 5.4 起支持提交、完成队列共用一次映射
+        if (p.features & IORING_FEAT_SINGLE_MMAP)
+            _sq_ring_size = _cq_ring_size = std::max(_sq_ring_size, _cq_ring_size);
+        _sq_ring = mmap(nullptr, _sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (_sq_ring == MAP_FAILED)
+            return _sq_ring = nullptr, ::close(fd), false;
+        if (p.features & IORING_FEAT_SINGLE_MMAP)
+            _cq_ring = _sq_ring;
+        else
+        {
+            _cq_ring = mmap(nullptr, _cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            if (_cq_ring == MAP_FAILED)
+                return _cq_ring = nullptr, ::close(fd), false;
+        }
+        _sqes_size = p.sq_entries * sizeof(io_uring_sqe);
+        _sqes = static_cast<io_uring_sqe *>(mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+        if (_sqes == MAP_FAILED)
+            return _sqes = nullptr, ::close(fd), false;
+        auto sq = static_cast<uint8_t *>(_sq_ring);
+        _sq_ktail = reinterpret_cast<unsigned *>(sq + p.sq_off.tail);
+        _sq_array = reinterpret_cast<unsigned *>(sq + p.sq_off.array);
+        _sq_mask = *reinterpret_cast<unsigned *>(sq + p.sq_off.ring_mask);
+        auto cq = static_cast<uint8_t *>(_cq_ring);
+        _cq_khead = reinterpret_cast<unsigned *>(cq + p.cq_off.head);
+        _cq_ktail = reinterpret_cast<unsigned *>(cq + p.cq_off.tail);
+        _cqes = reinterpret_cast<io_uring_cqe *>(cq + p.cq_off.cqes);
+        _cq_mask = *reinterpret_cast<unsigned *>(cq + p.cq_off.ring_mask);
+        _tail = *_sq_ktail;
+        _fd = fd;
+        return true;
+    }
+
+    //! 队列是否可用
+    inline bool ok() const noexcept { return _fd != -1; }
+
+    /**
+     * @brief 追加一个写请求，暂不提交
+     * @note 数据缓冲区在 submit() 返回前必须保持有效
+     *
+     * @param[in] fd 目标文件描述符
+     * @param[in] data 数据首地址
+     * @param[in] len 数据长度（字节）
+     */
+    void prepWrite(int fd, const void *data, unsigned len) noexcept
+    {
+        if (!ok())
+            return;
+        unsigned idx = _tail & _sq_mask;
+        io_uring_sqe &sqe = _sqes[idx];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_WRITE;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<uint64_t>(data);
+        sqe.len = len;
+        sqe.off = static_cast<uint64_t>(-1); // 使用文件当前位置，语义同 write(2)
+        _sq_array[idx] = idx;
+        ++_tail, ++_pending;
+    }
+
+    /**
+     * @brief 单次系统调用提交全部追加的请求并等待完成
+     *
+     * @return 成功完成的请求个数
+     */
+    unsigned submit() noexcept
+    {
+        if (!ok() || _pending == 0)
+            return 0;
+        __atomic_store_n(_sq_ktail, _tail, __ATOMIC_RELEASE);
+        unsigned n = _pending;
+        _pending = 0;
+        if (::syscall(__NR_io_uring_enter, _fd, n, n, IORING_ENTER_GETEVENTS, nullptr, 0) < 0)
+            return 0;
+        // 收割完成队列并统计成功完成的请求
+        unsigned done{};
+        unsigned head = *_cq_khead;
+        while (head != __atomic_load_n(_cq_ktail, __ATOMIC_ACQUIRE))
+        {
+            if (_cqes[head & _cq_mask].res >= 0)
+                ++done;
+            ++head;
+        }
+        __atomic_store_n(_cq_khead, head, __ATOMIC_RELEASE);
+        return done;
+    }
+
+private:
+    int _fd{-1};               //!< io_uring 实例文件描述符
+    void *_sq_ring{};          //!< 提交队列映射首地址
+    std::size_t _sq_ring_size{}; //!< 提交队列映射长度
+    void *_cq_ring{};          //!< 完成队列映射首地址
+    std::size_t _cq_ring_size{}; //!< 完成队列映射长度
+    io_uring_sqe *_sqes{};     //!< 提交队列表项数组
+    std::size_t _sqes_size{};  //!< 提交队列表项数组映射长度
+    unsigned *_sq_ktail{};     //!< 提交队列尾指针（内核共享）
+    unsigned *_sq_array{};     //!< 提交队列索引数组
+    unsigned _sq_mask{};       //!< 提交队列下标掩码
+    unsigned *_cq_khead{};     //!< 完成队列头指针（内核共享）
+    unsigned *_cq_ktail{};     //!< 完成队列尾指针（内核共享）
+    io_uring_cqe *_cqes{};     //!< 完成队列表项数组
+    unsigned _cq_mask{};       //!< 完成队列下标掩码
+    unsigned _tail{};          //!< 提交队列本地尾下标
+    unsigned _pending{};       //!< 已追加、尚未提交的请求个数
+};
+
+} // namespace rm
+
+#endif
@@ -0,0 +1,104 @@
+/**
+ * @file watchdog.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 低开销卡死看门狗服务
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <chrono>
+
+#include "rmvl/core/timer.hpp"
+#include "rmvl/core/util.hpp"
+#include "rmvl/core/watchdog.hpp"
+
+namespace rm
+{
+
+Watchdog::~Watchdog() { stop(); }
+
+Watchdog &Watchdog::global()
+{
+    static Watchdog watchdog;
+    return watchdog;
+}
+
+std::size_t Watchdog::add(std::string_view name, double deadline, std::function<void()> on_stall)
+{
+    if (deadline <= 0.)
+        RMVL_Error_(RMVL_StsBadArg, "Invalid watchdog deadline: %g", deadline);
+    std::lock_guard lk(_mtx);
+    std::size_t id = _count.load(std::memory_order_relaxed);
+    if (id >= MAX_STAGES)
+        RMVL_Error_(RMVL_StsOutOfRange, "The number of watchdog stages exceeds %zu", MAX_STAGES);
+    Stage &stage = _stages[id];
+    stage.deadline = deadline;
+    stage.on_stall = std::move(on_stall);
+    stage.name = name;
+    // 阶段表定长预分配，发布计数后 beat 即可无锁访问对应槽位
+    _count.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+void Watchdog::start(double period)
+{
+    std::lock_guard lk(_mtx);
+    if (_running)
+        return;
+    _running = true;
+    _thread = std::thread([this, period] {
+        std::unique_lock lk(_mtx);
+        while (_running)
+        {
+            lk.unlock();
+            check(Timer::now());
+            lk.lock();
+            _cv.wait_for(lk, std::chrono::duration<double>(period), [this] { return !_running; });
+        }
+    });
+}
+
+void Watchdog::stop()
+{
+    {
+        std::lock_guard lk(_mtx);
+        if (!_running)
+            return;
+        _running = false;
+    }
+    _cv.notify_all();
+    _thread.join();
+}
+
+void Watchdog::check(double now)
+{
+    std::size_t count = _count.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Stage &stage = _stages[i];
+        uint64_t beat = stage.beat.load(std::memory_order_relaxed);
+        // 首次 beat 前不纳入监测，避免尚未启动的阶段被误判
+        if (beat == 0)
+            continue;
+        if (beat != stage.seen)
+        {
+            // 心跳推进，刷新观察时刻并重新武装
+            stage.seen = beat;
+            stage.seen_time = now;
+            stage.is_stalled.store(false, std::memory_order_relaxed);
+        }
+        else if (!stage.is_stalled.load(std::memory_order_relaxed) && now - stage.seen_time > stage.deadline)
+        {
+            stage.is_stalled.store(true, std::memory_order_relaxed);
+            stage.stall_count.fetch_add(1, std::memory_order_relaxed);
+            WARNING_("Watchdog: stage \"%s\" stalled for more than %g s", stage.name.c_str(), stage.deadline);
+            if (stage.on_stall)
+                stage.on_stall();
+        }
+    }
+}
+
+} // namespace rm
@@ -0,0 +1,88 @@
+/**
+ * @file test_expected.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 预期值类型与诊断环形缓冲单元测试
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "rmvl/core/util.hpp"
+
+namespace rm_test
+{
+
+static rm::expected<std::string> parsePositive(int x) noexcept
+{
+    if (x <= 0)
+        return rm::unexpected{rm::Errc::OutOfRange};
+    return std::to_string(x);
+}
+
+TEST(ExpectedTest, value_and_error)
+{
+    auto ok = parsePositive(42);
+    ASSERT_TRUE(ok.has_value());
+    ASSERT_TRUE(static_cast<bool>(ok));
+    EXPECT_EQ(*ok, "42");
+    EXPECT_EQ(ok->size(), 2u);
+    auto bad = parsePositive(-1);
+    ASSERT_FALSE(bad);
+    EXPECT_EQ(bad.error(), rm::Errc::OutOfRange);
+    // value_or 在失败时返回默认值
+    EXPECT_EQ(bad.value_or("fallback"), "fallback");
+    EXPECT_EQ(ok.value_or("fallback"), "42");
+}
+
+TEST(ExpectedTest, void_specialization)
+{
+    rm::expected<void> ok{};
+    EXPECT_TRUE(ok);
+    rm::expected<void> bad{rm::unexpected{rm::Errc::IOError}};
+    ASSERT_FALSE(bad);
+    EXPECT_EQ(bad.error(), rm::Errc::IOError);
+}
+
+TEST(ExpectedTest, errc_to_string)
+{
+    EXPECT_STREQ(rm::to_string(rm::Errc::IOError), "I/O error");
+    EXPECT_STREQ(rm::to_string(rm::Errc::Timeout), "Timeout");
+    EXPECT_STREQ(rm::to_string(rm::Errc::Unknown), "Unknown error");
+}
+
+TEST(ExpectedTest, diag_ring)
+{
+    // 清空历史记录
+    rm::diagDrain();
+    rm::diagLog(rm::Errc::IOError, "serial flap");
+    rm::diagLog(rm::Errc::Timeout, "no data");
+    auto records = rm::diagDrain();
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_NE(records[0].find("[I/O error] serial flap"), std::string::npos);
+    EXPECT_NE(records[1].find("[Timeout] no data"), std::string::npos);
+    // 排空后缓冲为空
+    EXPECT_TRUE(rm::diagDrain().empty());
+}
+
+TEST(ExpectedTest, diag_ring_overflow)
+{
+    rm::diagDrain();
+    // 超出容量时仅保留最近的记录，序号保持单调递增
+    for (int i = 0; i < 100; ++i)
+        rm::diagLog(rm::Errc::IOError, "x");
+    auto records = rm::diagDrain();
+    ASSERT_EQ(records.size(), 64u);
+    // 丢失的记录可通过序号跳变发现
+    uintmax_t first{}, last{};
+    ASSERT_EQ(std::sscanf(records.front().c_str(), "#%ju", &first), 1);
+    ASSERT_EQ(std::sscanf(records.back().c_str(), "#%ju", &last), 1);
+    EXPECT_EQ(last - first, 63u);
+}
+
+} // namespace rm_test
@@ -0,0 +1,97 @@
+/**
+ * @file test_filewatch.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 文件监视服务单元测试
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/filewatch.hpp"
+
+namespace rm_test
+{
+
+//! 写入文件并关闭，触发一次保存事件
+static void touchFile(const char *path, const char *content)
+{
+    std::FILE *fp = std::fopen(path, "w");
+    ASSERT_NE(fp, nullptr);
+    std::fputs(content, fp);
+    std::fclose(fp);
+}
+
+//! 等待计数器到达期望值，超时返回 `false`
+static bool waitFor(const std::atomic_int &counter, int expect)
+{
+    for (int i = 0; i < 200; ++i)
+    {
+        if (counter.load() >= expect)
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+TEST(FileWatchTest, modify_and_unwatch)
+{
+    const char *file = "ts_filewatch.yml";
+    touchFile(file, "%YAML:1.0\n");
+
+    rm::FileWatcher watcher;
+    std::atomic_int counter{};
+    std::string seen{};
+    auto id = watcher.watch(file, [&](const std::string &path) { seen = path, ++counter; });
+    ASSERT_NE(id, 0u);
+
+    touchFile(file, "%YAML:1.0\nval: 1\n");
+    EXPECT_TRUE(waitFor(counter, 1));
+    EXPECT_EQ(seen, file);
+
+    touchFile(file, "%YAML:1.0\nval: 2\n");
+    EXPECT_TRUE(waitFor(counter, 2));
+
+    // 取消监视后不再产生回调
+    EXPECT_TRUE(watcher.unwatch(id));
+    EXPECT_FALSE(watcher.unwatch(id));
+    touchFile(file, "%YAML:1.0\nval: 3\n");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(counter.load(), 2);
+
+    std::remove(file);
+}
+
+TEST(FileWatchTest, create_and_rename_replace)
+{
+    const char *file = "ts_filewatch_rn.yml";
+    const char *tmp = "ts_filewatch_rn.yml.tmp";
+    std::remove(file);
+
+    rm::FileWatcher watcher;
+    std::atomic_int counter{};
+    // 文件尚不存在时即可注册监视
+    auto id = watcher.watch(file, [&](const std::string &) { ++counter; });
+    ASSERT_NE(id, 0u);
+
+    touchFile(file, "%YAML:1.0\n");
+    EXPECT_TRUE(waitFor(counter, 1));
+
+    // 编辑器以临时文件加重命名的方式保存时同样能够得到通知
+    touchFile(tmp, "%YAML:1.0\nval: 1\n");
+    ASSERT_EQ(std::rename(tmp, file), 0);
+    EXPECT_TRUE(waitFor(counter, 2));
+
+    EXPECT_TRUE(watcher.unwatch(id));
+    std::remove(file);
+}
+
+} // namespace rm_test
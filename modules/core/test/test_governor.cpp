@@ -0,0 +1,111 @@
+/**
+ * @file test_governor.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 热状态感知的自适应速率调控服务单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/governor.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm_test
+{
+
+//! 限时等待调控等级到达期望值
+static bool waitLevel(const rm::RateGovernor &governor, rm::ThrottleLevel level)
+{
+    for (int i = 0; i < 200; ++i)
+    {
+        if (governor.level() == level)
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return false;
+}
+
+// 阈值配置校验
+TEST(RateGovernorTest, threshold_validation)
+{
+    rm::RateGovernor governor;
+    EXPECT_THROW(governor.setThresholds(95., 85.), rm::Exception);
+    EXPECT_THROW(governor.setThresholds(85., 95., -1.), rm::Exception);
+}
+
+// 等级切换与回差
+TEST(RateGovernorTest, level_transition_with_hysteresis)
+{
+    rm::RateGovernor governor;
+    governor.setThresholds(85., 95., 5.);
+    std::atomic<double> temperature{60.};
+    governor.setSource([&temperature] { return temperature.load(); });
+    governor.start(0.005);
+    EXPECT_EQ(governor.level(), rm::ThrottleLevel::Normal);
+    // 到达降速阈值
+    temperature = 86.;
+    EXPECT_TRUE(waitLevel(governor, rm::ThrottleLevel::Reduced));
+    // 回差区间内不回落
+    temperature = 82.;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(governor.level(), rm::ThrottleLevel::Reduced);
+    // 到达最低速率阈值
+    temperature = 96.;
+    EXPECT_TRUE(waitLevel(governor, rm::ThrottleLevel::Minimum));
+    // 降至最低速率阈值以下回差，回落至降速
+    temperature = 88.;
+    EXPECT_TRUE(waitLevel(governor, rm::ThrottleLevel::Reduced));
+    // 降至降速阈值以下回差，恢复正常
+    temperature = 75.;
+    EXPECT_TRUE(waitLevel(governor, rm::ThrottleLevel::Normal));
+    governor.stop();
+}
+
+// 订阅通知与退订
+TEST(RateGovernorTest, subscribe_notification)
+{
+    rm::RateGovernor governor;
+    governor.setThresholds(85., 95.);
+    std::atomic<double> temperature{60.};
+    governor.setSource([&temperature] { return temperature.load(); });
+    std::atomic_int count{};
+    std::atomic<rm::ThrottleLevel> last{rm::ThrottleLevel::Minimum};
+    auto id = governor.subscribe([&](rm::ThrottleLevel level) {
+        ++count;
+        last = level;
+    });
+    // 订阅时立即以当前等级回调一次
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(last, rm::ThrottleLevel::Normal);
+    governor.start(0.005);
+    temperature = 90.;
+    EXPECT_TRUE(waitLevel(governor, rm::ThrottleLevel::Reduced));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(count, 2);
+    EXPECT_EQ(last, rm::ThrottleLevel::Reduced);
+    // 退订后不再收到通知
+    governor.unsubscribe(id);
+    temperature = 60.;
+    EXPECT_TRUE(waitLevel(governor, rm::ThrottleLevel::Normal));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(count, 2);
+    governor.stop();
+}
+
+// 速率比例
+TEST(RateGovernorTest, rate_scale)
+{
+    EXPECT_DOUBLE_EQ(rm::RateGovernor::rateScale(rm::ThrottleLevel::Normal), 1.);
+    EXPECT_DOUBLE_EQ(rm::RateGovernor::rateScale(rm::ThrottleLevel::Reduced), 0.75);
+    EXPECT_DOUBLE_EQ(rm::RateGovernor::rateScale(rm::ThrottleLevel::Minimum), 0.5);
+}
+
+} // namespace rm_test
@@ -0,0 +1,87 @@
+/**
+ * @file test_imu_batch.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief IMU 数据列式批量容器单元测试
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <cstdio>
+#include <numeric>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/io.hpp"
+
+namespace rm_test
+{
+
+//! 构造各字段均可区分的 IMU 样本
+static rm::ImuData makeImu(int i)
+{
+    rm::ImuData imu{};
+    imu.translation = {1.f * i, 2.f * i, 3.f * i, 4.f * i, 5.f * i, 6.f * i};
+    imu.rotation = {7.f * i, 8.f * i, 9.f * i, 10.f * i, 11.f * i, 12.f * i};
+    return imu;
+}
+
+TEST(ImuBatchTest, aos_round_trip)
+{
+    std::vector<rm::ImuData> datas;
+    for (int i = 0; i < 100; ++i)
+        datas.push_back(makeImu(i));
+    auto batch = rm::ImuBatch::from(datas);
+    EXPECT_EQ(batch.size(), 100u);
+    // 列式访问：单列求和不触碰其余 11 列
+    double yaw_sum = std::accumulate(batch.rotation.yaw.begin(), batch.rotation.yaw.end(), 0.);
+    EXPECT_NEAR(yaw_sum, 7. * 99 * 100 / 2, 1e-3);
+    // 单条取出与整体转换回 AoS 均与原数据一致
+    EXPECT_EQ(batch.at(42).translation.vz, 6.f * 42);
+    EXPECT_EQ(batch.at(42).rotation.pitch_speed, 11.f * 42);
+    auto back = batch.toVector();
+    ASSERT_EQ(back.size(), datas.size());
+    for (std::size_t i = 0; i < back.size(); ++i)
+        EXPECT_EQ(back[i].rotation.roll_speed, datas[i].rotation.roll_speed);
+    EXPECT_THROW(batch.at(100), rm::Exception);
+}
+
+TEST(ImuBatchTest, binary_codec)
+{
+    rm::ImuBatch batch;
+    batch.reserve(50);
+    for (int i = 0; i < 50; ++i)
+        batch.push_back(makeImu(i));
+    std::stringstream ss;
+    rm::ImuBatch::write(ss, batch);
+    // 文件头 24 字节 + 12 列 × 50 样本 × 4 字节
+    EXPECT_EQ(ss.str().size(), 24u + 12u * 50 * sizeof(float));
+    rm::ImuBatch decoded;
+    ASSERT_TRUE(rm::ImuBatch::read(ss, decoded));
+    EXPECT_EQ(decoded.size(), 50u);
+    EXPECT_EQ(decoded.translation.y, batch.translation.y);
+    EXPECT_EQ(decoded.rotation.yaw_speed, batch.rotation.yaw_speed);
+    // 幻数校验失败时读取失败
+    std::stringstream bad("not an imu batch file");
+    EXPECT_FALSE(rm::ImuBatch::read(bad, decoded));
+}
+
+TEST(ImuBatchTest, file_round_trip)
+{
+    const char *path = "ts_imu_batch.bin";
+    rm::ImuBatch batch;
+    for (int i = 0; i < 10; ++i)
+        batch.push_back(makeImu(i));
+    rm::ImuBatch::write(path, batch);
+    auto loaded = rm::ImuBatch::read(path);
+    EXPECT_EQ(loaded.size(), 10u);
+    EXPECT_EQ(loaded.at(7).translation.x, 7.f);
+    std::remove(path);
+    // 文件不存在时返回空容器
+    EXPECT_EQ(rm::ImuBatch::read("ts_imu_batch_absent.bin").size(), 0u);
+}
+
+} // namespace rm_test
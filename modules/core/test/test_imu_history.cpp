@@ -0,0 +1,86 @@
+/**
+ * @file test_imu_history.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief IMU 历史环形缓存单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/io.hpp"
+
+namespace rm_test
+{
+
+//! 构造 yaw 与 x 随时间戳线性变化的 IMU 样本
+static rm::ImuData makeImu(double tick)
+{
+    rm::ImuData imu{};
+    imu.rotation.yaw = static_cast<float>(10 * tick);
+    imu.translation.x = static_cast<float>(2 * tick);
+    return imu;
+}
+
+TEST(ImuHistoryTest, interpolated_query)
+{
+    rm::ImuHistory history(16);
+    EXPECT_FALSE(history.query(0.).has_value());
+    for (int i = 0; i <= 10; ++i)
+        history.push(0.1 * i, makeImu(0.1 * i));
+    EXPECT_EQ(history.size(), 11u);
+    // 样本之间线性插值
+    auto imu = history.query(0.55);
+    ASSERT_TRUE(imu.has_value());
+    EXPECT_NEAR(imu->rotation.yaw, 5.5f, 1e-5f);
+    EXPECT_NEAR(imu->translation.x, 1.1f, 1e-5f);
+    // 查询时间戳越界时返回边界样本
+    EXPECT_EQ(history.query(-1.)->rotation.yaw, 0.f);
+    EXPECT_NEAR(history.query(100.)->rotation.yaw, 10.f, 1e-5f);
+}
+
+TEST(ImuHistoryTest, ring_overwrite)
+{
+    rm::ImuHistory history(8);
+    for (int i = 0; i < 100; ++i)
+        history.push(0.01 * i, makeImu(0.01 * i));
+    EXPECT_EQ(history.size(), 8u);
+    // 已被覆盖的旧时间戳回退到缓存窗口内最旧的样本
+    EXPECT_NEAR(history.query(0.)->rotation.yaw, 10 * 0.01f * 92, 1e-4f);
+    EXPECT_NEAR(history.query(0.99)->rotation.yaw, 10 * 0.01f * 99, 1e-4f);
+}
+
+TEST(ImuHistoryTest, concurrent_query)
+{
+    rm::ImuHistory history(64);
+    std::atomic_bool stop{};
+    // 单写线程持续追加，多个读线程并发插值查询，插值结果始终落在线性样本上
+    std::thread writer([&history, &stop]() {
+        for (int i = 0; i < 20000; ++i)
+            history.push(1e-4 * i, makeImu(1e-4 * i));
+        stop = true;
+    });
+    std::vector<std::thread> readers;
+    std::atomic_int failures{};
+    for (int t = 0; t < 3; ++t)
+        readers.emplace_back([&history, &stop, &failures]() {
+            while (!stop)
+            {
+                auto imu = history.query(1e-4 * (std::rand() % 20000));
+                if (imu.has_value() && std::abs(imu->rotation.yaw - 5 * imu->translation.x) > 1e-3f)
+                    ++failures;
+            }
+        });
+    writer.join();
+    for (auto &reader : readers)
+        reader.join();
+    EXPECT_EQ(failures, 0);
+}
+
+} // namespace rm_test
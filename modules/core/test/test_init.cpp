@@ -0,0 +1,55 @@
+/**
+ * @file test_init.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 子系统惰性初始化模块单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/init.hpp"
+
+namespace rm_test
+{
+
+static int init_a_nums{};
+static int init_b_nums{};
+
+// 注册器在命名空间作用域定义，注册本身不执行初始化回调
+static rm::SubsystemRegistrar init_a_registrar("test/init_a", [] { ++init_a_nums; });
+static rm::SubsystemRegistrar init_b_registrar("test/init_b", [] { ++init_b_nums; });
+
+TEST(InitTest, registrar_defers_callback)
+{
+    auto names = rm::subsystems();
+    EXPECT_NE(std::find(names.begin(), names.end(), "test/init_a"), names.end());
+    EXPECT_NE(std::find(names.begin(), names.end(), "test/init_b"), names.end());
+    // 仅注册时回调不执行
+    EXPECT_EQ(init_a_nums, 0);
+    EXPECT_EQ(init_b_nums, 0);
+}
+
+TEST(InitTest, init_profile_and_idempotent)
+{
+    // 未注册的子系统不匹配
+    EXPECT_EQ(rm::init({"test/none"}), 0u);
+    // 仅预热列出的子系统
+    EXPECT_EQ(rm::init({"test/init_a"}), 1u);
+    EXPECT_EQ(init_a_nums, 1);
+    EXPECT_EQ(init_b_nums, 0);
+    // 重复预热不再执行回调
+    EXPECT_EQ(rm::init({"test/init_a"}), 1u);
+    EXPECT_EQ(init_a_nums, 1);
+    // 空列表预热所有已注册的子系统
+    EXPECT_GE(rm::init(), 2u);
+    EXPECT_EQ(init_a_nums, 1);
+    EXPECT_EQ(init_b_nums, 1);
+}
+
+} // namespace rm_test
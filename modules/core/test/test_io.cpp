@@ -9,10 +9,9 @@
  *
  */
 
+#include <cstring>
 #include <fstream>
-#ifdef _WIN32
 #include <thread>
-#endif
 
 #include <gtest/gtest.h>
 
@@ -37,6 +36,31 @@ TEST(IOTest, corners_io)
     EXPECT_EQ(ret[1][2][1], 9.9f);
 }
 
+TEST(IOTest, corner_writer)
+{
+    {
+        rm::CornerWriter writer("ts_corner_writer.csv");
+        for (int i = 0; i < 10; i++)
+        {
+            auto v = static_cast<float>(i);
+            writer.write({{{v, v + 0.5f}, {v + 1.f, v + 1.5f}}, {{v + 2.f, v + 2.5f}}});
+        }
+        EXPECT_EQ(writer.size(), 10u);
+        // 析构时后台线程完成排空与落盘
+    }
+    std::vector<std::vector<std::array<float, 2>>> ret;
+    std::ifstream ifs("ts_corner_writer.csv", std::ios::in);
+    for (int i = 0; i < 10; i++)
+    {
+        ret.clear();
+        rm::readCorners(ifs, ret);
+        auto v = static_cast<float>(i);
+        ASSERT_EQ(ret.size(), 2u);
+        EXPECT_EQ(ret[0][1][0], v + 1.f);
+        EXPECT_EQ(ret[1][0][1], v + 2.5f);
+    }
+}
+
 TEST(IOTest, pipe_io)
 {
 #ifdef _WIN32
@@ -67,4 +91,164 @@ TEST(IOTest, pipe_io)
 #endif
 }
 
+TEST(IOTest, tcp_io)
+{
+    // 服务端构造时阻塞等待对端连接，置于独立线程
+    std::thread t([]() {
+        rm::TcpServer server(40931);
+        EXPECT_TRUE(server.write("Hello"));
+        std::string msg{};
+        EXPECT_TRUE(server.read(msg));
+        EXPECT_EQ(msg, "world");
+        // 消息边界由长度前缀保持，空消息与二进制消息均完整往返
+        EXPECT_TRUE(server.write(""));
+        EXPECT_TRUE(server.write(std::string_view("\x00\x01\x02", 3)));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    rm::TcpClient client("127.0.0.1", 40931);
+    std::string msg{};
+    EXPECT_TRUE(client.read(msg));
+    EXPECT_EQ(msg, "Hello");
+    EXPECT_TRUE(client.write("world"));
+    EXPECT_TRUE(client.read(msg));
+    EXPECT_TRUE(msg.empty());
+    EXPECT_TRUE(client.read(msg));
+    EXPECT_EQ(msg, std::string("\x00\x01\x02", 3));
+    t.join();
+    // 对端销毁断开后读取失败
+    EXPECT_FALSE(client.read(msg));
+}
+
+TEST(IOTest, shm_io)
+{
+    rm::ShmServer server("test_shm", 1024);
+    rm::ShmClient client("test_shm");
+    EXPECT_EQ(server.capacity(), 1024u);
+    EXPECT_EQ(client.capacity(), 1024u);
+    // 普通读写
+    EXPECT_TRUE(server.write("hello"));
+    std::string data{};
+    EXPECT_TRUE(client.read(data));
+    EXPECT_EQ(data, "hello");
+    // 无新数据时读取失败
+    EXPECT_FALSE(client.read(data));
+    EXPECT_TRUE(client.write("world"));
+    EXPECT_TRUE(server.read(data));
+    EXPECT_EQ(data, "world");
+    // 零拷贝借出、提交
+    auto *buf = static_cast<char *>(server.borrow());
+    ASSERT_NE(buf, nullptr);
+    std::memcpy(buf, "borrow", 6);
+    EXPECT_TRUE(server.commit(6));
+    EXPECT_TRUE(client.read(data));
+    EXPECT_EQ(data, "borrow");
+    // 超出容量的写入失败
+    EXPECT_FALSE(server.write(std::string(2048, 'x')));
+}
+
+TEST(IOTest, broadcast_io)
+{
+    rm::BroadcastServer server("test_broadcast", 1024, 8);
+    rm::BroadcastClient client1("test_broadcast");
+    rm::BroadcastClient client2("test_broadcast");
+    EXPECT_EQ(server.capacity(), 1024u);
+    // 一次写入，多个订阅者各自按序读取
+    EXPECT_TRUE(server.write("hello"));
+    EXPECT_TRUE(server.write("world"));
+    std::string data{};
+    EXPECT_TRUE(client1.read(data));
+    EXPECT_EQ(data, "hello");
+    EXPECT_TRUE(client1.read(data));
+    EXPECT_EQ(data, "world");
+    EXPECT_FALSE(client1.read(data));
+    EXPECT_TRUE(client2.read(data));
+    EXPECT_EQ(data, "hello");
+    EXPECT_TRUE(client2.read(data));
+    EXPECT_EQ(data, "world");
+    // 零拷贝借出、提交
+    auto *buf = static_cast<char *>(server.borrow());
+    ASSERT_NE(buf, nullptr);
+    std::memcpy(buf, "borrow", 6);
+    EXPECT_TRUE(server.commit(6));
+    EXPECT_TRUE(client1.read(data));
+    EXPECT_EQ(data, "borrow");
+    // 超出槽位容量的写入失败
+    EXPECT_FALSE(server.write(std::string(2048, 'x')));
+}
+
+TEST(IOTest, broadcast_slow_consumer_skip)
+{
+    rm::BroadcastServer server("test_broadcast_skip", 64, 4);
+    rm::BroadcastClient client("test_broadcast_skip");
+    // 写入量超出槽位个数，滞后的订阅者跳过被覆盖的旧数据而非阻塞写入
+    for (int i = 0; i < 10; ++i)
+        EXPECT_TRUE(server.write("msg" + std::to_string(i)));
+    std::string data{};
+    EXPECT_TRUE(client.read(data));
+    EXPECT_EQ(data, "msg6");
+    EXPECT_EQ(client.skipped(), 6u);
+    for (int i = 7; i < 10; ++i)
+    {
+        EXPECT_TRUE(client.read(data));
+        EXPECT_EQ(data, "msg" + std::to_string(i));
+    }
+    EXPECT_FALSE(client.read(data));
+    EXPECT_EQ(client.skipped(), 6u);
+}
+
+//! 遥测样本结构体
+struct TestPose
+{
+    float x;   //!< x 坐标
+    float y;   //!< y 坐标
+    float yaw; //!< 偏航角
+};
+
+TEST(IOTest, telemetry_multicast)
+{
+    rm::TelemetrySubscriber sub("239.255.0.1", 40927);
+    // 发布周期设长，由 flush 显式控制批次边界
+    rm::TelemetryPublisher pub("239.255.0.1", 40927, 10.);
+    // 样本以一次 memcpy 追加进批量缓冲区，不触发发送
+    TestPose pose{1.f, 2.f, 0.5f};
+    EXPECT_TRUE(pub.publish(1, pose));
+    uint32_t decision = 42;
+    EXPECT_TRUE(pub.publish(2, decision));
+    EXPECT_EQ(pub.sequence(), 0u);
+    // 超出批量缓冲区容量的单条样本发布失败
+    std::vector<uint8_t> oversize(2048);
+    EXPECT_FALSE(pub.publish(3, oversize.data(), oversize.size()));
+    pub.flush();
+    EXPECT_EQ(pub.sequence(), 1u);
+    std::vector<rm::TelemetrySample> samples;
+    bool received{};
+    for (int i = 0; i < 100 && !(received = sub.read(samples)); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    // 受网络环境限制无法组播环回时跳过
+    if (!received)
+        GTEST_SKIP() << "Multicast loopback unavailable in this environment";
+    ASSERT_EQ(samples.size(), 2u);
+    EXPECT_EQ(samples[0].id, 1u);
+    TestPose pose_out{};
+    ASSERT_TRUE(samples[0].get(pose_out));
+    EXPECT_EQ(pose_out.x, 1.f);
+    EXPECT_EQ(pose_out.y, 2.f);
+    EXPECT_EQ(pose_out.yaw, 0.5f);
+    EXPECT_EQ(samples[1].id, 2u);
+    uint32_t decision_out{};
+    ASSERT_TRUE(samples[1].get(decision_out));
+    EXPECT_EQ(decision_out, 42u);
+    // 样本数据长度与结构体大小不一致时解释失败
+    EXPECT_FALSE(samples[1].get(pose_out));
+    // 第二个批次序列号递增，无丢失
+    EXPECT_TRUE(pub.publish(1, pose));
+    pub.flush();
+    EXPECT_EQ(pub.sequence(), 2u);
+    for (int i = 0; i < 100 && !sub.read(samples); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    EXPECT_EQ(sub.dropped(), 0u);
+    // 无新批次时非阻塞读取返回 false
+    EXPECT_FALSE(sub.read(samples));
+}
+
 } // namespace rm_test
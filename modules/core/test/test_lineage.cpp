@@ -0,0 +1,87 @@
+/**
+ * @file test_lineage.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 帧血缘跟踪模块单元测试
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/lineage.hpp"
+
+namespace rm_test
+{
+
+using rm::lineage::Stage;
+
+TEST(LineageTest, begin_mark_publish)
+{
+    // 没有开启中的记录时，标记与发布均为空操作
+    EXPECT_EQ(rm::lineage::current(), 0u);
+    rm::lineage::mark(Stage::Detect);
+    rm::lineage::publish();
+
+    auto id = rm::lineage::begin();
+    EXPECT_NE(id, 0u);
+    EXPECT_EQ(rm::lineage::current(), id);
+    rm::lineage::mark(Stage::Detect);
+    rm::lineage::mark(Stage::Sync);
+    rm::lineage::mark(Stage::Predict);
+    rm::lineage::mark(Stage::Decide);
+    rm::lineage::publish();
+    // 发布后记录关闭，内容可通过 last() 查询
+    EXPECT_EQ(rm::lineage::current(), 0u);
+    const auto &rec = rm::lineage::last();
+    EXPECT_EQ(rec.id, id);
+    // 各阶段时间戳按标记顺序单调不减
+    double retrieve = rec.stamp[static_cast<std::size_t>(Stage::Retrieve)];
+    double decide = rec.stamp[static_cast<std::size_t>(Stage::Decide)];
+    EXPECT_GT(retrieve, 0.);
+    EXPECT_LE(retrieve, rec.stamp[static_cast<std::size_t>(Stage::Detect)]);
+    EXPECT_LE(rec.stamp[static_cast<std::size_t>(Stage::Detect)], rec.stamp[static_cast<std::size_t>(Stage::Sync)]);
+    EXPECT_LE(rec.stamp[static_cast<std::size_t>(Stage::Sync)], rec.stamp[static_cast<std::size_t>(Stage::Predict)]);
+    EXPECT_LE(rec.stamp[static_cast<std::size_t>(Stage::Predict)], decide);
+    // 帧 ID 逐帧递增，未标记的阶段时间戳为 0
+    auto id2 = rm::lineage::begin();
+    EXPECT_GT(id2, id);
+    rm::lineage::publish();
+    EXPECT_EQ(rm::lineage::last().stamp[static_cast<std::size_t>(Stage::Detect)], 0.);
+}
+
+TEST(LineageTest, trace_record)
+{
+    const char *file = "ts_lineage.bin";
+    rm::trace::start(file);
+    auto id1 = rm::lineage::begin();
+    rm::lineage::mark(Stage::Detect);
+    rm::lineage::publish();
+    auto id2 = rm::lineage::begin();
+    rm::lineage::mark(Stage::Detect);
+    rm::lineage::mark(Stage::Decide);
+    rm::lineage::publish();
+    rm::trace::stop();
+
+    // 每帧一条定长跟踪事件，参数依次为帧 ID 与各阶段完成时刻
+    auto events = rm::trace::read(file);
+    ASSERT_EQ(events.size(), 2u);
+    for (const auto &ev : events)
+    {
+        EXPECT_EQ(ev.id, rm::lineage::EVENT_ID);
+        EXPECT_EQ(ev.argc, 6u);
+    }
+    EXPECT_EQ(static_cast<uint64_t>(events[0].args[0]), id1);
+    EXPECT_EQ(static_cast<uint64_t>(events[1].args[0]), id2);
+    // 事件自身的时间戳即为帧结束时刻，不早于帧内各阶段时间戳
+    EXPECT_GE(events[1].ts, events[1].args[1 + static_cast<std::size_t>(Stage::Decide)]);
+    EXPECT_GT(events[1].args[1 + static_cast<std::size_t>(Stage::Decide)],
+              events[1].args[1 + static_cast<std::size_t>(Stage::Retrieve)]);
+    std::remove(file);
+}
+
+} // namespace rm_test
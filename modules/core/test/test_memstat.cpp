@@ -0,0 +1,85 @@
+/**
+ * @file test_memstat.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 内存分配统计模块单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/memstat.hpp"
+
+namespace rm_test
+{
+
+// 分配、释放与缓冲池计数
+TEST(MemStatTest, record_and_summary)
+{
+    rm::memstat::start();
+    rm::memstat::reset();
+    RMVL_MEM_ALLOC_("test/record", 1024);
+    RMVL_MEM_ALLOC_("test/record", 2048);
+    RMVL_MEM_FREE_("test/record", 1024);
+    RMVL_MEM_POOL_HIT_("test/record");
+    RMVL_MEM_POOL_HIT_("test/record");
+    RMVL_MEM_POOL_MISS_("test/record");
+    auto summary = rm::memstat::summary("test/record");
+    EXPECT_EQ(summary.alloc_count, 2u);
+    EXPECT_EQ(summary.free_count, 1u);
+    EXPECT_EQ(summary.alloc_bytes, 3072u);
+    EXPECT_EQ(summary.live_bytes, 2048u);
+    EXPECT_EQ(summary.peak_bytes, 3072u);
+    EXPECT_EQ(summary.pool_hits, 2u);
+    EXPECT_EQ(summary.pool_misses, 1u);
+    EXPECT_DOUBLE_EQ(summary.hitRate(), 2. / 3.);
+    rm::memstat::stop();
+}
+
+// 统计未启动时不产生记录
+TEST(MemStatTest, inactive_no_record)
+{
+    rm::memstat::stop();
+    rm::memstat::reset();
+    RMVL_MEM_ALLOC_("test/inactive", 4096);
+    RMVL_MEM_POOL_MISS_("test/inactive");
+    EXPECT_EQ(rm::memstat::summary("test/inactive").alloc_count, 0u);
+    EXPECT_EQ(rm::memstat::summary("test/inactive").pool_misses, 0u);
+}
+
+// 通道不存在时摘要计数为 0
+TEST(MemStatTest, unknown_channel)
+{
+    auto summary = rm::memstat::summary("test/unknown");
+    EXPECT_EQ(summary.alloc_count, 0u);
+    EXPECT_DOUBLE_EQ(summary.hitRate(), 0.);
+}
+
+// 导出与清空
+TEST(MemStatTest, export_and_reset)
+{
+    rm::memstat::start();
+    RMVL_MEM_ALLOC_("test/export_a", 100);
+    RMVL_MEM_ALLOC_("test/export_b", 200);
+    auto all = rm::memstat::exportAll();
+    // 注册表按名称字典序导出，至少包含本测试创建的两个通道
+    EXPECT_TRUE(std::is_sorted(all.begin(), all.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; }));
+    auto find = [&all](std::string_view name) {
+        return std::find_if(all.begin(), all.end(), [&name](const auto &item) { return item.first == name; }) != all.end();
+    };
+    EXPECT_TRUE(find("test/export_a"));
+    EXPECT_TRUE(find("test/export_b"));
+    // 清空后计数归零，已缓存的通道引用保持有效
+    rm::memstat::reset();
+    EXPECT_EQ(rm::memstat::summary("test/export_a").alloc_bytes, 0u);
+    RMVL_MEM_ALLOC_("test/export_a", 300);
+    EXPECT_EQ(rm::memstat::summary("test/export_a").alloc_bytes, 300u);
+    rm::memstat::stop();
+}
+
+} // namespace rm_test
@@ -0,0 +1,112 @@
+/**
+ * @file test_para_cache.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 参数模块二进制缓存单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/para_cache.hpp"
+
+using namespace rm::para;
+
+namespace rm_test
+{
+
+enum class TestColor
+{
+    RED,
+    BLUE
+};
+
+TEST(ParaCacheTest, round_trip)
+{
+    const char *file = "ts_para_cache.bin";
+    cache::BinWriter writer;
+    writer(42);
+    writer(3.14);
+    writer(TestColor::BLUE);
+    writer(std::string("hello"));
+    writer(std::vector<double>{1., 2., 3.});
+    EXPECT_TRUE(writer.dump(file, 0x12345678u, 0xabcdef01u));
+
+    cache::BinReader reader;
+    ASSERT_TRUE(reader.load(file, 0x12345678u, 0xabcdef01u));
+    int num{};
+    double val{};
+    TestColor color{};
+    std::string str{};
+    std::vector<double> vec{};
+    reader(num), reader(val), reader(color), reader(str), reader(vec);
+    EXPECT_TRUE(reader.ok());
+    EXPECT_EQ(num, 42);
+    EXPECT_EQ(val, 3.14);
+    EXPECT_EQ(color, TestColor::BLUE);
+    EXPECT_EQ(str, "hello");
+    EXPECT_EQ(vec, (std::vector<double>{1., 2., 3.}));
+    std::remove(file);
+}
+
+TEST(ParaCacheTest, hash_mismatch)
+{
+    const char *file = "ts_para_cache_hash.bin";
+    cache::BinWriter writer;
+    writer(42);
+    EXPECT_TRUE(writer.dump(file, 0x12345678u, 0xabcdef01u));
+
+    cache::BinReader reader;
+    // 参数规范哈希或源文件哈希不一致时校验失败
+    EXPECT_FALSE(reader.load(file, 0x87654321u, 0xabcdef01u));
+    EXPECT_FALSE(reader.load(file, 0x12345678u, 0x10fedcbau));
+    std::remove(file);
+}
+
+TEST(ParaCacheTest, incomplete_consume)
+{
+    const char *file = "ts_para_cache_sz.bin";
+    cache::BinWriter writer;
+    writer(42);
+    writer(3.14);
+    EXPECT_TRUE(writer.dump(file, 0u, 0u));
+
+    // 缓存未被完整消费（如字段数变化但哈希碰撞）时视为无效
+    cache::BinReader reader;
+    ASSERT_TRUE(reader.load(file, 0u, 0u));
+    int num{};
+    reader(num);
+    EXPECT_FALSE(reader.ok());
+
+    // 读取超出缓存长度时同样视为无效
+    ASSERT_TRUE(reader.load(file, 0u, 0u));
+    double v1{}, v2{}, v3{};
+    reader(v1), reader(v2), reader(v3);
+    EXPECT_FALSE(reader.ok());
+    std::remove(file);
+}
+
+TEST(ParaCacheTest, file_hash)
+{
+    const char *file = "ts_para_cache_src.yml";
+    std::FILE *fp = std::fopen(file, "wb");
+    std::fputs("num: 20\n", fp);
+    std::fclose(fp);
+    uint32_t h1 = cache::fileHash(file);
+    EXPECT_NE(h1, 0u);
+    // 内容变化后哈希变化
+    fp = std::fopen(file, "wb");
+    std::fputs("num: 21\n", fp);
+    std::fclose(fp);
+    EXPECT_NE(cache::fileHash(file), h1);
+    // 文件不存在时返回 0
+    EXPECT_EQ(cache::fileHash("ts_para_cache_none.yml"), 0u);
+    std::remove(file);
+}
+
+} // namespace rm_test
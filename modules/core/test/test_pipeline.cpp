@@ -0,0 +1,107 @@
+/**
+ * @file test_pipeline.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 多阶段流水线调度器单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/pipeline.hpp"
+
+namespace rm_test
+{
+
+//! 流水线测试帧
+struct TestFrame
+{
+    int seq{};   //!< 帧序号
+    int value{}; //!< 处理数据
+};
+
+TEST(PipelineTest, frames_in_order)
+{
+    int next_seq{};
+    std::vector<int> results;
+    rm::Pipeline<TestFrame> pipeline({
+        [&](TestFrame &frame) {
+            if (next_seq >= 20)
+                return false;
+            frame.seq = next_seq++;
+            frame.value = frame.seq;
+            return true;
+        },
+        [](TestFrame &frame) {
+            frame.value *= 2;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return true;
+        },
+        [&](TestFrame &frame) {
+            // 末级阶段串行执行，无需加锁
+            results.push_back(frame.value);
+            return true;
+        },
+    });
+    pipeline.run();
+    // 所有帧按采集顺序到达末级阶段
+    ASSERT_EQ(results.size(), 20u);
+    for (int i = 0; i < 20; ++i)
+        EXPECT_EQ(results[i], 2 * i);
+}
+
+TEST(PipelineTest, drop_frames)
+{
+    int next_seq{};
+    std::vector<int> results;
+    rm::Pipeline<TestFrame> pipeline({
+        [&](TestFrame &frame) {
+            if (next_seq >= 10)
+                return false;
+            frame.seq = next_seq++;
+            return true;
+        },
+        [](TestFrame &frame) { return frame.seq % 2 == 0; },
+        [&](TestFrame &frame) {
+            results.push_back(frame.seq);
+            return true;
+        },
+    });
+    pipeline.run();
+    // 被中间阶段丢弃的帧不会到达末级阶段，其余帧保持顺序
+    ASSERT_EQ(results.size(), 5u);
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(results[i], 2 * i);
+}
+
+TEST(PipelineTest, rerun)
+{
+    int next_seq{};
+    int count{};
+    rm::Pipeline<TestFrame> pipeline({
+        [&](TestFrame &frame) {
+            if (next_seq >= 5)
+                return false;
+            frame.seq = next_seq++;
+            return true;
+        },
+        [&](TestFrame &) {
+            ++count;
+            return true;
+        },
+    });
+    pipeline.run();
+    EXPECT_EQ(count, 5);
+    // 再次运行时从采集阶段重新开始
+    next_seq = 0;
+    pipeline.run();
+    EXPECT_EQ(count, 10);
+}
+
+} // namespace rm_test
@@ -0,0 +1,73 @@
+/**
+ * @file test_pmu.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 硬件性能计数模块单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/pmu.hpp"
+
+namespace rm_test
+{
+
+//! 制造一段可观测的计算负载
+static volatile uint64_t pmu_sink{};
+static void workload()
+{
+    uint64_t sum{};
+    for (uint64_t i = 0; i < 100000; ++i)
+        sum += i * i;
+    pmu_sink = sum;
+}
+
+// 快照的单调性与区段增量
+TEST(PmuTest, snapshot_monotonic)
+{
+    rm::PmuCounters pmu;
+    // 受权限或虚拟化环境限制无法打开时，快照恒为零且不产生错误
+    if (!pmu.valid())
+    {
+        auto counts = pmu.snapshot();
+        EXPECT_EQ(counts.cycles, 0u);
+        EXPECT_EQ(counts.instructions, 0u);
+        GTEST_SKIP() << "PMU counters unavailable in this environment";
+    }
+    auto begin = pmu.snapshot();
+    workload();
+    auto end = pmu.snapshot();
+    // 持续计数的快照单调不减，区段内执行了可观测数量的指令
+    EXPECT_GE(end.cycles, begin.cycles);
+    EXPECT_GE(end.instructions, begin.instructions);
+    auto delta = end - begin;
+    EXPECT_GT(delta.instructions, 100000u);
+    EXPECT_GT(delta.ipc(), 0.);
+}
+
+// 派生指标的退化行为
+TEST(PmuTest, derived_metrics)
+{
+    rm::PmuCounts counts{};
+    EXPECT_DOUBLE_EQ(counts.ipc(), 0.);
+    EXPECT_DOUBLE_EQ(counts.cacheMpki(), 0.);
+    EXPECT_DOUBLE_EQ(counts.branchMpki(), 0.);
+    counts = {1000, 2000, 10, 4};
+    EXPECT_DOUBLE_EQ(counts.ipc(), 2.);
+    EXPECT_DOUBLE_EQ(counts.cacheMpki(), 5.);
+    EXPECT_DOUBLE_EQ(counts.branchMpki(), 2.);
+}
+
+// 线程局部计数器组复用同一实例
+TEST(PmuTest, thread_local_instance)
+{
+    auto &pmu1 = rm::threadPmu();
+    auto &pmu2 = rm::threadPmu();
+    EXPECT_EQ(&pmu1, &pmu2);
+}
+
+} // namespace rm_test
@@ -0,0 +1,89 @@
+/**
+ * @file test_protocol.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 串口定长帧协议编解码模块单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/protocol.hpp"
+
+namespace rm_test
+{
+
+//! 云台下行帧负载，字段布局无填充字节
+struct GimbalFrame
+{
+    float yaw;
+    float pitch;
+    uint16_t shoot_speed;
+    uint8_t color;
+    uint8_t flag;
+};
+
+using codec = rm::protocol::FrameCodec<GimbalFrame>;
+
+TEST(ProtocolTest, crc32c_known_vector)
+{
+    // CRC-32C 标准测试向量
+    EXPECT_EQ(rm::protocol::crc32("123456789", 9), 0xe3069283u);
+    EXPECT_EQ(rm::protocol::crc32("", 0), 0x00000000u);
+}
+
+TEST(ProtocolTest, encode_decode_round_trip)
+{
+    static_assert(codec::payload_size == 12);
+    static_assert(codec::frame_size == 18);
+    GimbalFrame data{1.5f, -2.25f, 28, 1, 0x3c};
+    auto frame = codec::encode(data);
+    EXPECT_EQ(frame[0], rm::protocol::FRAME_HEAD);
+    EXPECT_EQ(frame[1], codec::payload_size);
+    auto result = codec::decode(frame.data());
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->yaw, data.yaw);
+    EXPECT_EQ(result->pitch, data.pitch);
+    EXPECT_EQ(result->shoot_speed, data.shoot_speed);
+    EXPECT_EQ(result->color, data.color);
+    EXPECT_EQ(result->flag, data.flag);
+}
+
+TEST(ProtocolTest, decode_rejects_corruption)
+{
+    auto frame = codec::encode({1.f, 2.f, 15, 0, 0});
+    frame[5] ^= 0x01; // 负载单比特翻转
+    EXPECT_FALSE(codec::decode(frame.data()).has_value());
+    frame[5] ^= 0x01;
+    EXPECT_TRUE(codec::decode(frame.data()).has_value());
+}
+
+TEST(ProtocolTest, scanner_resync_on_corrupted_stream)
+{
+    auto frame1 = codec::encode({1.f, 2.f, 15, 0, 1});
+    auto frame2 = codec::encode({3.f, 4.f, 18, 1, 2});
+    auto bad = codec::encode({5.f, 6.f, 30, 0, 3});
+    bad[6] ^= 0xff; // 模拟传输损坏
+    // 流内容：垃圾前缀 + 完好帧 + 损坏帧 + 完好帧
+    std::vector<uint8_t> stream{0x00, 0xa5, 0x17};
+    stream.insert(stream.end(), frame1.begin(), frame1.end());
+    stream.insert(stream.end(), bad.begin(), bad.end());
+    stream.insert(stream.end(), frame2.begin(), frame2.end());
+
+    rm::protocol::StreamScanner<GimbalFrame> scanner;
+    std::vector<GimbalFrame> frames;
+    // 按 5 字节分片送入，模拟与帧边界不对齐的串口读取
+    for (std::size_t i = 0; i < stream.size(); i += 5)
+        scanner.feed(stream.data() + i, std::min<std::size_t>(5, stream.size() - i),
+                     [&frames](const GimbalFrame &data) { frames.push_back(data); });
+    ASSERT_EQ(frames.size(), 2u);
+    EXPECT_EQ(frames[0].flag, 1);
+    EXPECT_EQ(frames[1].flag, 2);
+    // 丢弃字节数 = 垃圾前缀 + 损坏帧
+    EXPECT_EQ(scanner.dropped(), 3u + codec::frame_size);
+}
+
+} // namespace rm_test
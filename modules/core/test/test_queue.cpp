@@ -0,0 +1,140 @@
+/**
+ * @file test_queue.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 无锁有界并发队列单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <iterator>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/queue.hpp"
+
+namespace rm_test
+{
+
+TEST(MpmcQueueTest, basic_push_pop)
+{
+    rm::MpmcQueue<int> queue(4);
+    EXPECT_EQ(queue.capacity(), 4u);
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.try_push(i));
+    // 队列已满
+    EXPECT_FALSE(queue.try_push(4));
+    int val{};
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.try_pop(val));
+        EXPECT_EQ(val, i);
+    }
+    // 队列为空
+    EXPECT_FALSE(queue.try_pop(val));
+}
+
+TEST(MpmcQueueTest, batch_operations)
+{
+    rm::MpmcQueue<int> queue(8);
+    std::vector<int> src = {1, 2, 3, 4, 5};
+    EXPECT_EQ(queue.try_push(src.begin(), src.end()), 5u);
+    std::vector<int> dst;
+    EXPECT_EQ(queue.try_pop(std::back_inserter(dst), 3), 3u);
+    EXPECT_EQ(dst, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(queue.try_pop(std::back_inserter(dst), 10), 2u);
+    EXPECT_EQ(dst.back(), 5);
+}
+
+TEST(MpmcQueueTest, multi_producer_multi_consumer)
+{
+    constexpr int PRODUCERS = 4, CONSUMERS = 4, PER_PRODUCER = 2500;
+    rm::MpmcQueue<int> queue(64);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < PRODUCERS; ++p)
+        threads.emplace_back([&queue, p]() {
+            for (int i = 0; i < PER_PRODUCER; ++i)
+                EXPECT_TRUE(queue.push(p * PER_PRODUCER + i));
+        });
+    std::vector<long long> sums(CONSUMERS);
+    std::vector<std::size_t> counts(CONSUMERS);
+    for (int c = 0; c < CONSUMERS; ++c)
+        threads.emplace_back([&queue, &sums, &counts, c]() {
+            int val{};
+            // 阻塞出队，队列关闭且排空后退出
+            while (queue.pop(val))
+            {
+                sums[c] += val;
+                ++counts[c];
+            }
+        });
+    for (int p = 0; p < PRODUCERS; ++p)
+        threads[p].join();
+    queue.close();
+    for (int c = 0; c < CONSUMERS; ++c)
+        threads[PRODUCERS + c].join();
+    // 所有元素恰好被消费一次
+    long long total = PRODUCERS * PER_PRODUCER;
+    EXPECT_EQ(std::accumulate(counts.begin(), counts.end(), 0ll), total);
+    EXPECT_EQ(std::accumulate(sums.begin(), sums.end(), 0ll), total * (total - 1) / 2);
+}
+
+TEST(MpmcQueueTest, close_unblocks_consumer)
+{
+    rm::MpmcQueue<int> queue(4);
+    std::thread consumer([&queue]() {
+        int val{};
+        EXPECT_FALSE(queue.pop(val));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.close();
+    consumer.join();
+    EXPECT_FALSE(queue.try_push(1));
+}
+
+TEST(SpscQueueTest, basic_push_pop)
+{
+    rm::SpscQueue<int> queue(4);
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.try_push(i));
+    EXPECT_FALSE(queue.try_push(4));
+    int val{};
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.try_pop(val));
+        EXPECT_EQ(val, i);
+    }
+    EXPECT_FALSE(queue.try_pop(val));
+}
+
+TEST(SpscQueueTest, single_producer_single_consumer)
+{
+    constexpr int TOTAL = 100000;
+    rm::SpscQueue<int> queue(128);
+    std::thread producer([&queue]() {
+        for (int i = 0; i < TOTAL; ++i)
+            while (!queue.try_push(i))
+                std::this_thread::yield();
+        queue.close();
+    });
+    long long sum{};
+    std::size_t count{};
+    int val{};
+    while (queue.pop(val))
+    {
+        // 单生产者入队保证先进先出
+        EXPECT_EQ(val, static_cast<int>(count));
+        sum += val;
+        ++count;
+    }
+    producer.join();
+    EXPECT_EQ(count, static_cast<std::size_t>(TOTAL));
+    EXPECT_EQ(sum, static_cast<long long>(TOTAL) * (TOTAL - 1) / 2);
+}
+
+} // namespace rm_test
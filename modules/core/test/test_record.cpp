@@ -0,0 +1,168 @@
+/**
+ * @file test_record.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 二进制记录读写单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/io.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm_test
+{
+
+//! 构造指定条数的记录文件，返回文件路径
+static std::string makeRecordFile(std::size_t count)
+{
+    std::string path = "ts_record_" + std::to_string(count) + ".rec";
+    rm::RecordWriter writer(path);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        rm::ImuData imu{};
+        imu.rotation.yaw = static_cast<float>(i);
+        imu.translation.x = static_cast<float>(i) * 0.5f;
+        std::vector<std::vector<std::array<float, 2>>> corners(i % 3);
+        for (std::size_t g = 0; g < corners.size(); ++g)
+            corners[g].assign(4, {static_cast<float>(i), static_cast<float>(g)});
+        std::string payload = "payload-" + std::to_string(i);
+        writer.write(0.01 * static_cast<double>(i), imu, corners, payload.data(), payload.size());
+    }
+    EXPECT_EQ(writer.size(), count);
+    return path;
+}
+
+TEST(RecordTest, round_trip)
+{
+    auto path = makeRecordFile(10);
+    rm::RecordReader reader(path);
+    ASSERT_EQ(reader.size(), 10u);
+    for (std::size_t i = 0; i < reader.size(); ++i)
+    {
+        auto view = reader.at(i);
+        EXPECT_DOUBLE_EQ(view.tick, 0.01 * static_cast<double>(i));
+        EXPECT_EQ(view.imu.rotation.yaw, static_cast<float>(i));
+        EXPECT_EQ(view.imu.translation.x, static_cast<float>(i) * 0.5f);
+        ASSERT_EQ(view.corners.size(), i % 3);
+        for (std::size_t g = 0; g < view.corners.size(); ++g)
+        {
+            const auto &[points, point_count] = view.corners[g];
+            ASSERT_EQ(point_count, 4u);
+            for (std::size_t p = 0; p < point_count; ++p)
+            {
+                EXPECT_EQ(points[p][0], static_cast<float>(i));
+                EXPECT_EQ(points[p][1], static_cast<float>(g));
+            }
+        }
+        std::string payload = "payload-" + std::to_string(i);
+        ASSERT_EQ(view.payload_size, payload.size());
+        EXPECT_EQ(std::string(reinterpret_cast<const char *>(view.payload), view.payload_size), payload);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(RecordTest, random_access)
+{
+    auto path = makeRecordFile(100);
+    rm::RecordReader reader(path);
+    ASSERT_EQ(reader.size(), 100u);
+    // 随机访问只解析目标记录，与顺序读取结果一致
+    EXPECT_DOUBLE_EQ(reader.at(73).tick, 0.73);
+    EXPECT_DOUBLE_EQ(reader.at(5).tick, 0.05);
+    EXPECT_THROW(reader.at(100), rm::Exception);
+    std::remove(path.c_str());
+}
+
+TEST(RecordTest, empty_file)
+{
+    auto path = makeRecordFile(0);
+    rm::RecordReader reader(path);
+    EXPECT_EQ(reader.size(), 0u);
+    std::remove(path.c_str());
+}
+
+TEST(RecordTest, invalid_file)
+{
+    EXPECT_THROW(rm::RecordReader("ts_record_nonexistent.rec"), rm::Exception);
+}
+
+//! 获取文件长度（字节）
+static std::size_t fileSize(const std::string &path)
+{
+    std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+    return static_cast<std::size_t>(ifs.tellg());
+}
+
+TEST(JournalTest, round_trip_with_compression)
+{
+    std::string path = "ts_journal.jnl";
+    std::size_t raw_total{};
+    {
+        // 队列深度不小于总帧数，保证紧凑写入也不触发丢帧
+        rm::FrameJournal journal(path, 256 * 1024, 32);
+        // 高重复度数据模拟图像帧，各帧内容互不相同
+        for (std::size_t i = 0; i < 20; ++i)
+        {
+            std::vector<uint8_t> frame(64 * 1024);
+            for (std::size_t j = 0; j < frame.size(); ++j)
+                frame[j] = static_cast<uint8_t>((j / 256 + i) & 0xff);
+            EXPECT_TRUE(journal.write(0.005 * static_cast<double>(i), frame.data(), frame.size()));
+            raw_total += frame.size();
+        }
+        EXPECT_EQ(journal.size(), 20u);
+        EXPECT_EQ(journal.dropped(), 0u);
+        // 析构时排空队列并写入索引
+    }
+    // 高重复度数据压缩后应显著小于原始长度
+    EXPECT_LT(fileSize(path), raw_total / 2);
+    rm::FrameJournalReader reader(path);
+    ASSERT_EQ(reader.size(), 20u);
+    // 乱序随机访问
+    for (std::size_t i : {7ul, 0ul, 19ul, 3ul})
+    {
+        auto frame = reader.at(i);
+        EXPECT_DOUBLE_EQ(frame.tick, 0.005 * static_cast<double>(i));
+        ASSERT_EQ(frame.data.size(), 64u * 1024u);
+        for (std::size_t j = 0; j < frame.data.size(); ++j)
+            ASSERT_EQ(frame.data[j], static_cast<uint8_t>((j / 256 + i) & 0xff));
+    }
+    EXPECT_THROW(reader.at(20), rm::Exception);
+    std::remove(path.c_str());
+}
+
+TEST(JournalTest, incompressible_frames_stored_raw)
+{
+    std::string path = "ts_journal_raw.jnl";
+    // 伪随机数据不可压缩，应按原样存储且往返一致
+    std::vector<uint8_t> frame(32 * 1024);
+    uint32_t state = 0x12345678;
+    for (auto &byte : frame)
+    {
+        state = state * 1664525u + 1013904223u;
+        byte = static_cast<uint8_t>(state >> 24);
+    }
+    {
+        rm::FrameJournal journal(path, 64 * 1024, 4);
+        EXPECT_TRUE(journal.write(1.5, frame.data(), frame.size()));
+        // 超出单帧容量的帧被拒绝
+        std::vector<uint8_t> oversize(128 * 1024);
+        EXPECT_FALSE(journal.write(2.0, oversize.data(), oversize.size()));
+    }
+    rm::FrameJournalReader reader(path);
+    ASSERT_EQ(reader.size(), 1u);
+    auto view = reader.at(0);
+    EXPECT_DOUBLE_EQ(view.tick, 1.5);
+    EXPECT_EQ(view.data, frame);
+    std::remove(path.c_str());
+}
+
+} // namespace rm_test
@@ -0,0 +1,116 @@
+/**
+ * @file test_smallvec.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 内置容量小向量单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/smallvec.hpp"
+
+namespace rm_test
+{
+
+TEST(SmallVectorTest, inline_storage)
+{
+    rm::SmallVector<int, 8> sv;
+    EXPECT_TRUE(sv.empty());
+    EXPECT_EQ(sv.capacity(), 8u);
+    for (int i = 0; i < 8; ++i)
+        sv.push_back(i);
+    // 未超出内置容量，不触发堆分配扩容
+    EXPECT_EQ(sv.capacity(), 8u);
+    EXPECT_EQ(sv.size(), 8u);
+    for (int i = 0; i < 8; ++i)
+        EXPECT_EQ(sv[i], i);
+}
+
+TEST(SmallVectorTest, grow_to_heap)
+{
+    rm::SmallVector<int, 4> sv;
+    for (int i = 0; i < 100; ++i)
+        sv.emplace_back(i);
+    EXPECT_EQ(sv.size(), 100u);
+    EXPECT_GE(sv.capacity(), 100u);
+    EXPECT_EQ(std::accumulate(sv.begin(), sv.end(), 0), 4950);
+}
+
+TEST(SmallVectorTest, insert_and_erase)
+{
+    rm::SmallVector<int, 4> sv = {1, 2, 7, 8};
+    std::vector<int> mid = {3, 4, 5, 6};
+    auto it = sv.insert(sv.begin() + 2, mid.begin(), mid.end());
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(sv.size(), 8u);
+    for (int i = 0; i < 8; ++i)
+        EXPECT_EQ(sv[i], i + 1);
+    // 标准算法可直接作用于裸指针迭代器
+    sv.erase(std::remove_if(sv.begin(), sv.end(), [](int val) { return val % 2 == 0; }), sv.end());
+    EXPECT_EQ(sv.size(), 4u);
+    EXPECT_EQ(sv.back(), 7);
+}
+
+TEST(SmallVectorTest, move_and_copy)
+{
+    rm::SmallVector<std::shared_ptr<int>, 2> sv;
+    for (int i = 0; i < 6; ++i)
+        sv.push_back(std::make_shared<int>(i));
+    auto copied = sv;
+    EXPECT_EQ(copied.size(), 6u);
+    EXPECT_EQ(copied[5].use_count(), 2);
+    auto moved = std::move(sv);
+    EXPECT_EQ(moved.size(), 6u);
+    EXPECT_TRUE(sv.empty());
+    for (int i = 0; i < 6; ++i)
+        EXPECT_EQ(*moved[i], i);
+    // 内置存储下的移动逐元素完成，不增加引用计数
+    rm::SmallVector<std::shared_ptr<int>, 8> inlined;
+    inlined.push_back(std::make_shared<int>(42));
+    auto inlined_moved = std::move(inlined);
+    EXPECT_EQ(inlined_moved.front().use_count(), 1);
+}
+
+TEST(SmallVectorTest, move_assign_heap_from_inline)
+{
+    // 目的向量已扩容至堆上，源向量仍在内置存储：移动赋值后目的向量须回退至
+    // 内置存储，原堆空间不得被重用或二次释放
+    rm::SmallVector<std::shared_ptr<int>, 4> dst;
+    for (int i = 0; i < 10; ++i)
+        dst.push_back(std::make_shared<int>(i));
+    EXPECT_GT(dst.capacity(), 4u);
+    rm::SmallVector<std::shared_ptr<int>, 4> src;
+    for (int i = 0; i < 3; ++i)
+        src.push_back(std::make_shared<int>(i + 100));
+    dst = std::move(src);
+    EXPECT_EQ(dst.size(), 3u);
+    EXPECT_EQ(dst.capacity(), 4u);
+    EXPECT_TRUE(src.empty());
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(*dst[i], i + 100);
+        EXPECT_EQ(dst[i].use_count(), 1);
+    }
+    // 反向：内置存储的目的向量接管堆上数据，指针直接转移
+    rm::SmallVector<std::shared_ptr<int>, 4> heap_src;
+    for (int i = 0; i < 10; ++i)
+        heap_src.push_back(std::make_shared<int>(i));
+    rm::SmallVector<std::shared_ptr<int>, 4> inline_dst;
+    inline_dst.push_back(std::make_shared<int>(-1));
+    inline_dst = std::move(heap_src);
+    EXPECT_EQ(inline_dst.size(), 10u);
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(*inline_dst[i], i);
+}
+
+} // namespace rm_test
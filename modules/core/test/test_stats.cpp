@@ -0,0 +1,177 @@
+/**
+ * @file test_stats.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 运行时耗时统计模块单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/stats.hpp"
+
+namespace rm_test
+{
+
+TEST(StatsTest, record_and_summary)
+{
+    rm::stats::reset();
+    rm::stats::start();
+    auto &ch = rm::stats::channel("test/summary");
+    // 写入 1ms ~ 100ms 共 100 条确定性采样
+    for (int i = 1; i <= 100; ++i)
+        rm::stats::record(ch, i * 1e-3, static_cast<std::size_t>(i));
+    auto sum = rm::stats::summary("test/summary");
+    EXPECT_EQ(sum.count, 100u);
+    EXPECT_NEAR(sum.mean, 50.5e-3, 1e-6);
+    EXPECT_NEAR(sum.min, 1e-3, 1e-6);
+    EXPECT_NEAR(sum.max, 100e-3, 1e-6);
+    EXPECT_NEAR(sum.p50, 50e-3, 1.5e-3);
+    EXPECT_NEAR(sum.p90, 90e-3, 1.5e-3);
+    EXPECT_NEAR(sum.p99, 99e-3, 1.5e-3);
+    // 队列深度为最近一次采样值
+    EXPECT_EQ(sum.depth, 100u);
+    rm::stats::stop();
+}
+
+TEST(StatsTest, inactive_probe_is_empty)
+{
+    rm::stats::reset();
+    rm::stats::stop();
+    EXPECT_FALSE(rm::stats::active());
+    {
+        // 统计未启动时探针为空，不产生采样
+        rm::stats::Probe probe = rm::stats::active() ? rm::stats::Probe(rm::stats::channel("test/inactive"), 0) : rm::stats::Probe{};
+        (void)probe;
+    }
+    EXPECT_EQ(rm::stats::summary("test/inactive").count, 0u);
+}
+
+TEST(StatsTest, scoped_probe_records_once)
+{
+    rm::stats::reset();
+    rm::stats::start();
+    auto &ch = rm::stats::channel("test/probe");
+    {
+        rm::stats::Probe probe(ch, 3);
+        (void)probe;
+    }
+    auto sum = rm::stats::summary("test/probe");
+    EXPECT_EQ(sum.count, 1u);
+    EXPECT_GE(sum.max, 0.);
+    EXPECT_EQ(sum.depth, 3u);
+    rm::stats::stop();
+}
+
+TEST(StatsTest, instance_channel_isolated)
+{
+    rm::stats::reset();
+    rm::stats::start();
+    int a{}, b{};
+    auto &ch_a = rm::stats::instanceChannel("test_stage", &a);
+    auto &ch_b = rm::stats::instanceChannel("test_stage", &b);
+    EXPECT_NE(&ch_a, &ch_b);
+    rm::stats::record(ch_a, 1e-3, 0);
+    // 同一实例重复获取返回同一通道
+    EXPECT_EQ(&rm::stats::instanceChannel("test_stage", &a), &ch_a);
+    auto datas = rm::stats::exportAll();
+    std::size_t num{};
+    for (const auto &[name, sum] : datas)
+        if (name.find("test_stage/") == 0)
+            num += sum.count;
+    EXPECT_EQ(num, 1u);
+    rm::stats::stop();
+}
+
+TEST(StatsTest, pmu_sampling)
+{
+    rm::stats::reset();
+    rm::stats::start();
+    rm::stats::startPmu();
+    auto &ch = rm::stats::channel("test/pmu");
+    {
+        rm::stats::Probe probe(ch, 0);
+        volatile uint64_t sum{};
+        for (uint64_t i = 0; i < 100000; ++i)
+            sum = sum + i;
+    }
+    auto sum = rm::stats::summary("test/pmu");
+    EXPECT_EQ(sum.count, 1u);
+    // 硬件计数器可用时摘要给出区段 IPC，不可用时自动退化为纯耗时统计
+    if (rm::threadPmu().valid())
+        EXPECT_GT(sum.ipc, 0.);
+    else
+        EXPECT_DOUBLE_EQ(sum.ipc, 0.);
+    rm::stats::stopPmu();
+    rm::stats::stop();
+}
+
+TEST(StatsTest, budget_check)
+{
+    rm::stats::reset();
+    rm::stats::start();
+    auto &fast = rm::stats::channel("budget_fast/Impl@0x1");
+    auto &slow = rm::stats::channel("budget_slow");
+    for (int i = 0; i < 20; ++i)
+    {
+        rm::stats::record(fast, 1e-3, 0);
+        rm::stats::record(slow, 8e-3, 0);
+    }
+    // 预算文件：budget_fast 余量充足、budget_slow 超出、budget_none 无匹配采样
+    std::ofstream ofs("stats_budget_test.txt");
+    ofs << "# 单元测试预算\n"
+        << "budget_fast = 5 # 条目按前缀匹配实例通道\n"
+        << "budget_slow = 2\n"
+        << "budget_none = 1\n";
+    ofs.close();
+    auto diffs = rm::stats::checkBudget("stats_budget_test.txt");
+    ASSERT_EQ(diffs.size(), 3u);
+    EXPECT_FALSE(diffs[0].over);
+    EXPECT_NEAR(diffs[0].measured, 1e-3, 1e-6);
+    EXPECT_TRUE(diffs[1].over);
+    EXPECT_NEAR(diffs[1].measured, 8e-3, 1e-6);
+    // 无匹配采样的条目视为超出
+    EXPECT_TRUE(diffs[2].over);
+    EXPECT_DOUBLE_EQ(diffs[2].measured, 0.);
+    // 报告中超出预算的条目以 EXCEEDED 标注
+    auto report = rm::stats::budgetReport(diffs);
+    EXPECT_NE(report.find("budget_slow"), std::string::npos);
+    EXPECT_NE(report.find("EXCEEDED"), std::string::npos);
+    // 文件无法读取时核对结果为空
+    EXPECT_TRUE(rm::stats::checkBudget("stats_budget_absent.txt").empty());
+    rm::stats::stop();
+}
+
+TEST(StatsTest, budget_normalization)
+{
+    // 标定负载耗时为正，量级可重复
+    double calib = rm::stats::calibration();
+    EXPECT_GT(calib, 0.);
+    rm::stats::reset();
+    rm::stats::start();
+    auto &ch = rm::stats::channel("budget_scale");
+    for (int i = 0; i < 10; ++i)
+        rm::stats::record(ch, 2e-3, 0);
+    // 参考机标定值远大于本机：预算等比例收紧，原本充足的条目转为超出
+    std::ofstream tight("stats_budget_tight.txt");
+    tight << "calibration = " << calib * 1e3 * 1e3 << "\nbudget_scale = 3\n";
+    tight.close();
+    auto diffs = rm::stats::checkBudget("stats_budget_tight.txt");
+    ASSERT_EQ(diffs.size(), 1u);
+    EXPECT_TRUE(diffs[0].over);
+    // 参考机标定值远小于本机：预算等比例放宽，原本超出的条目转为通过
+    std::ofstream loose("stats_budget_loose.txt");
+    loose << "calibration = " << calib * 1e3 * 1e-3 << "\nbudget_scale = 1\n";
+    loose.close();
+    diffs = rm::stats::checkBudget("stats_budget_loose.txt");
+    ASSERT_EQ(diffs.size(), 1u);
+    EXPECT_FALSE(diffs[0].over);
+    rm::stats::stop();
+}
+
+} // namespace rm_test
@@ -0,0 +1,60 @@
+/**
+ * @file test_statspage.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 共享内存统计页单元测试
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/statspage.hpp"
+
+namespace rm_test
+{
+
+// 字段写入与读回
+TEST(StatsPageTest, set_add_get)
+{
+    rm::stats::pageSet(rm::stats::PageField::QUEUE_DEPTH, 3);
+    EXPECT_EQ(rm::stats::pageGet(rm::stats::PageField::QUEUE_DEPTH), 3u);
+    rm::stats::pageSet(rm::stats::PageField::CAPTURE_FRAMES, 100);
+    rm::stats::pageAdd(rm::stats::PageField::CAPTURE_FRAMES, 5);
+    EXPECT_EQ(rm::stats::pageGet(rm::stats::PageField::CAPTURE_FRAMES), 105u);
+}
+
+// 外部读取方契约：页面文件按固定偏移可直接读取各字段
+TEST(StatsPageTest, external_layout)
+{
+    if (!rm::stats::pageActive())
+        GTEST_SKIP() << "Stats page is not backed by shared memory on this platform.";
+    rm::stats::pageSet(rm::stats::PageField::FRAME_TIME, 2333);
+    std::ifstream ifs(rm::stats::pagePath(), std::ios::binary);
+    ASSERT_TRUE(ifs.is_open());
+    std::vector<char> page((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    constexpr std::size_t field_num = static_cast<std::size_t>(rm::stats::PageField::FIELD_NUM);
+    ASSERT_GE(page.size(), 16 + 8 * field_num);
+    // 页头：魔数 "RMST"、版本号、字段数
+    uint32_t magic{}, version{};
+    uint64_t fields{};
+    std::memcpy(&magic, page.data(), sizeof(magic));
+    std::memcpy(&version, page.data() + 4, sizeof(version));
+    std::memcpy(&fields, page.data() + 8, sizeof(fields));
+    EXPECT_EQ(magic, 0x54534D52u);
+    EXPECT_EQ(version, 1u);
+    EXPECT_EQ(fields, field_num);
+    // 字段 i 位于偏移 16 + 8i 处
+    uint64_t frame_time{};
+    std::memcpy(&frame_time, page.data() + 16 + 8 * static_cast<std::size_t>(rm::stats::PageField::FRAME_TIME), sizeof(frame_time));
+    EXPECT_EQ(frame_time, 2333u);
+}
+
+} // namespace rm_test
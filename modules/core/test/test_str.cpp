@@ -0,0 +1,54 @@
+/**
+ * @file test_str.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 字符串处理模块单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/str.hpp"
+
+namespace rm_test
+{
+
+// 无分配分割可在常量表达式中使用
+constexpr std::size_t constexprSplit()
+{
+    std::string_view out[4];
+    return rm::str::split("a/bc/def", "/", out, 4);
+}
+static_assert(constexprSplit() == 3);
+static_assert(rm::str::strip("  hello\t\n") == "hello");
+static_assert(rm::str::strip(" \t\r\n").empty());
+
+TEST(StrTest, split_view)
+{
+    std::string_view out[4];
+    // 连续分割符视为一个，首尾分割符不产生空子串
+    EXPECT_EQ(rm::str::split("/a//bc/", "/", out, 4), 2u);
+    EXPECT_EQ(out[0], "a");
+    EXPECT_EQ(out[1], "bc");
+    // 超出容量时返回全部子串数目，仅写入容量内的部分
+    EXPECT_EQ(rm::str::split("a/b/c/d/e", "/", out, 4), 5u);
+    EXPECT_EQ(out[3], "d");
+    // 无分割符时整体作为一个子串
+    EXPECT_EQ(rm::str::split("abc", "/", out, 4), 1u);
+    EXPECT_EQ(out[0], "abc");
+    EXPECT_EQ(rm::str::split("", "/", out, 4), 0u);
+}
+
+TEST(StrTest, format_to)
+{
+    char buf[32];
+    EXPECT_EQ(rm::str::format_to(buf, "node_%d/%s", 3, "name"), "node_3/name");
+    // 超出缓冲区容量时截断
+    char small[8];
+    EXPECT_EQ(rm::str::format_to(small, "0123456789"), "0123456");
+}
+
+} // namespace rm_test
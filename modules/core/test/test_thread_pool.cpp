@@ -0,0 +1,91 @@
+/**
+ * @file test_thread_pool.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 共享线程池服务单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/thread_pool.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm_test
+{
+
+TEST(ThreadPoolTest, submit_tasks)
+{
+    rm::ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+    std::atomic_int count{};
+    std::mutex mtx;
+    std::condition_variable cv;
+    for (int i = 0; i < 100; ++i)
+        pool.submit([&]() {
+            if (++count == 100)
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                cv.notify_one();
+            }
+        }, i % 2 == 0 ? rm::TaskLane::High : rm::TaskLane::Normal);
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [&count] { return count == 100; });
+    EXPECT_EQ(count, 100);
+}
+
+TEST(ThreadPoolTest, parallel_for_covers_range)
+{
+    rm::ThreadPool pool(3);
+    std::vector<int> data(1000);
+    pool.parallel_for(0, data.size(), [&data](std::size_t start, std::size_t end) {
+        for (std::size_t i = start; i < end; ++i)
+            data[i] = static_cast<int>(i);
+    });
+    // 每个下标恰好被处理一次
+    for (std::size_t i = 0; i < data.size(); ++i)
+        EXPECT_EQ(data[i], static_cast<int>(i));
+}
+
+TEST(ThreadPoolTest, nested_parallel_for)
+{
+    rm::ThreadPool pool(2);
+    std::vector<std::vector<int>> data(8, std::vector<int>(64));
+    pool.parallel_for(0, data.size(), [&pool, &data](std::size_t start, std::size_t end) {
+        for (std::size_t i = start; i < end; ++i)
+            pool.parallel_for(0, data[i].size(), [&row = data[i]](std::size_t s, std::size_t e) {
+                for (std::size_t j = s; j < e; ++j)
+                    row[j] = 1;
+            });
+    });
+    // 嵌套并行不死锁，且全部元素被处理
+    long long total{};
+    for (const auto &row : data)
+        total += std::accumulate(row.begin(), row.end(), 0ll);
+    EXPECT_EQ(total, 8 * 64);
+}
+
+TEST(ThreadPoolTest, exception_rethrown)
+{
+    rm::ThreadPool pool(2);
+    EXPECT_THROW(pool.parallel_for(0, 100, [](std::size_t start, std::size_t) {
+        if (start == 0)
+            RMVL_Error(RMVL_StsError, "failure in task body");
+    }), rm::Exception);
+}
+
+TEST(ThreadPoolTest, global_instance)
+{
+    auto &pool = rm::ThreadPool::global();
+    EXPECT_GE(pool.size(), 1u);
+    EXPECT_EQ(&pool, &rm::ThreadPool::global());
+}
+
+} // namespace rm_test
@@ -0,0 +1,104 @@
+/**
+ * @file test_timer.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 定时、计时模块单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/timer.hpp"
+
+namespace rm_test
+{
+
+TEST(TimerTest, now)
+{
+    rm::Timer::reset();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    double t1 = rm::Timer::now();
+    EXPECT_GT(t1, 0.015);
+    // 时间应单调不减
+    for (int i = 0; i < 1000; ++i)
+    {
+        double t2 = rm::Timer::now();
+        EXPECT_GE(t2, t1);
+        t1 = t2;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_GT(rm::Timer::now(), 0.035);
+}
+
+TEST(TimerTest, frame)
+{
+    rm::Timer::reset();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    rm::Timer::sync();
+    double t = rm::Timer::frame();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    // 未再次 sync() 时帧时间戳保持不变
+    EXPECT_EQ(rm::Timer::frame(), t);
+    rm::Timer::sync();
+    EXPECT_GT(rm::Timer::frame(), t);
+}
+
+TEST(TimerTest, concurrent_now)
+{
+    rm::Timer::reset();
+    // 多线程并发读取并跨越重标定边界，标定快照撕裂会表现为重标定间隔量级
+    // （数百 ms）的时间回退，容差取 10ms 以兼容带插桩的重负载环境
+    std::atomic<bool> ok{true};
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 4; ++i)
+        workers.emplace_back([&ok] {
+            double last = rm::Timer::now();
+            for (int j = 0; j < 200000; ++j)
+            {
+                double cur = rm::Timer::now();
+                if (cur < last - 1e-2)
+                    ok = false;
+                last = cur;
+            }
+        });
+    for (auto &w : workers)
+        w.join();
+    EXPECT_TRUE(ok);
+}
+
+TEST(PreciseWaitTest, guard_band)
+{
+    // 护带宽度在标定后应落入文档约定的范围
+    double guard = rm::PreciseWait::guardBand();
+    EXPECT_GE(guard, 5e-5);
+    EXPECT_LE(guard, 5e-3);
+    // 再次获取时直接返回已标定值
+    EXPECT_EQ(rm::PreciseWait::guardBand(), guard);
+}
+
+TEST(PreciseWaitTest, wait_precision)
+{
+    rm::Timer::reset();
+    // 等待不得早于到期时刻返回，上界取宽松值以兼容重负载环境
+    for (double duration : {0.002, 0.005})
+    {
+        double start = rm::Timer::now();
+        rm::PreciseWait::sleep(duration);
+        double elapsed = rm::Timer::now() - start;
+        EXPECT_GE(elapsed, duration);
+        EXPECT_LT(elapsed, duration + 0.02);
+    }
+    // 已过期的时刻立即返回
+    double start = rm::Timer::now();
+    rm::PreciseWait::until(start - 1.);
+    EXPECT_LT(rm::Timer::now() - start, 0.01);
+}
+
+} // namespace rm_test
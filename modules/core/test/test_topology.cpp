@@ -0,0 +1,95 @@
+/**
+ * @file test_topology.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief CPU 拓扑与线程亲和性配置服务单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+#include "rmvl/core/topology.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm_test
+{
+
+// 通道配置读写
+TEST(CpuTopologyTest, lane_configuration)
+{
+    rm::CpuTopology topology;
+    EXPECT_TRUE(topology.lane(rm::CpuLane::Capture).empty());
+    topology.setLane(rm::CpuLane::Capture, {0});
+    EXPECT_EQ(topology.lane(rm::CpuLane::Capture), std::vector<int>{0});
+    // 空列表清除配置
+    topology.setLane(rm::CpuLane::Capture, {});
+    EXPECT_TRUE(topology.lane(rm::CpuLane::Capture).empty());
+    // 越界核心编号
+    EXPECT_THROW(topology.setLane(rm::CpuLane::Detect, {-1}), rm::Exception);
+    EXPECT_THROW(topology.setLane(rm::CpuLane::Detect, {static_cast<int>(std::thread::hardware_concurrency())}), rm::Exception);
+}
+
+// 未配置通道的绑定不产生任何行为
+TEST(CpuTopologyTest, bind_unconfigured_lane)
+{
+    rm::CpuTopology topology;
+    EXPECT_FALSE(topology.bindCurrentThread(rm::CpuLane::Control));
+}
+
+#ifdef __linux__
+
+// 当前线程绑定后亲和性掩码与通道配置一致
+TEST(CpuTopologyTest, bind_current_thread)
+{
+    rm::CpuTopology topology;
+    topology.setLane(rm::CpuLane::Detect, {0});
+    std::thread([&topology]() {
+        EXPECT_TRUE(topology.bindCurrentThread(rm::CpuLane::Detect));
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        pthread_getaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+        EXPECT_EQ(CPU_COUNT(&cpuset), 1);
+        EXPECT_TRUE(CPU_ISSET(0, &cpuset));
+    }).join();
+}
+
+// 指定线程绑定后亲和性掩码与通道配置一致
+TEST(CpuTopologyTest, bind_other_thread)
+{
+    rm::CpuTopology topology;
+    topology.setLane(rm::CpuLane::Background, {0});
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool bound{};
+    std::thread worker([&]() {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [&bound] { return bound; });
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        pthread_getaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+        EXPECT_EQ(CPU_COUNT(&cpuset), 1);
+        EXPECT_TRUE(CPU_ISSET(0, &cpuset));
+    });
+    EXPECT_TRUE(topology.bindThread(worker, rm::CpuLane::Background));
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        bound = true;
+    }
+    cv.notify_one();
+    worker.join();
+}
+
+#endif
+
+} // namespace rm_test
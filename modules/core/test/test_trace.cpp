@@ -0,0 +1,100 @@
+/**
+ * @file test_trace.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 低开销二进制跟踪模块单元测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <cstdio>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/trace.hpp"
+
+namespace rm_test
+{
+
+TEST(TraceTest, emit_and_read)
+{
+    const char *file = "ts_trace_basic.bin";
+    rm::trace::start(file);
+    RMVL_TRACE_(1);
+    RMVL_TRACE_(2, 3.14);
+    RMVL_TRACE_(3, 1, 2.5, -6);
+    rm::trace::stop();
+
+    auto events = rm::trace::read(file);
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_EQ(events[0].id, 1u);
+    EXPECT_EQ(events[0].argc, 0u);
+    EXPECT_EQ(events[1].id, 2u);
+    ASSERT_EQ(events[1].argc, 1u);
+    EXPECT_EQ(events[1].args[0], 3.14);
+    EXPECT_EQ(events[2].id, 3u);
+    ASSERT_EQ(events[2].argc, 3u);
+    EXPECT_EQ(events[2].args[0], 1);
+    EXPECT_EQ(events[2].args[1], 2.5);
+    EXPECT_EQ(events[2].args[2], -6);
+    // 同一线程的事件时间戳单调不减
+    EXPECT_LE(events[0].ts, events[1].ts);
+    EXPECT_LE(events[1].ts, events[2].ts);
+    std::remove(file);
+}
+
+TEST(TraceTest, multi_thread)
+{
+    const char *file = "ts_trace_mt.bin";
+    constexpr int N = 2000;
+    rm::trace::start(file);
+    std::thread t1([] { for (int i = 0; i < N; ++i) RMVL_TRACE_(1, i); });
+    std::thread t2([] { for (int i = 0; i < N; ++i) RMVL_TRACE_(2, i); });
+    t1.join(), t2.join();
+    rm::trace::stop();
+
+    auto events = rm::trace::read(file);
+    EXPECT_EQ(events.size() + rm::trace::dropped(), 2u * N);
+    // 同一线程的事件保持先后次序
+    int next1{}, next2{};
+    for (const auto &ev : events)
+    {
+        auto &next = ev.id == 1 ? next1 : next2;
+        EXPECT_GE(ev.args[0], next);
+        next = static_cast<int>(ev.args[0]) + 1;
+    }
+    std::remove(file);
+}
+
+TEST(TraceTest, inactive_and_restart)
+{
+    // 跟踪未启动时事件被直接丢弃，不会混入后续跟踪文件
+    EXPECT_FALSE(rm::trace::active());
+    RMVL_TRACE_(99);
+    rm::trace::emit(98, 1.0);
+
+    const char *file = "ts_trace_restart.bin";
+    rm::trace::start(file);
+    EXPECT_TRUE(rm::trace::active());
+    RMVL_TRACE_(5);
+    rm::trace::stop();
+    EXPECT_FALSE(rm::trace::active());
+
+    auto events = rm::trace::read(file);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].id, 5u);
+    std::remove(file);
+}
+
+TEST(TraceTest, format)
+{
+    rm::trace::TraceEvent ev{};
+    ev.id = 7, ev.argc = 2, ev.ts = 1.5;
+    ev.args[0] = 2, ev.args[1] = 0.25;
+    EXPECT_EQ(rm::trace::format(ev), "[1.500000] id=7: 2, 0.25");
+}
+
+} // namespace rm_test
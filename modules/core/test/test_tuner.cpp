@@ -0,0 +1,68 @@
+/**
+ * @file test_tuner.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 内核变体启动自调优模块单元测试
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/tuner.hpp"
+#include "rmvl/core/util.hpp"
+
+namespace rm_test
+{
+
+//! 可控耗时的基准负载，`iters` 越大耗时越长
+static void workload(std::size_t iters)
+{
+    volatile std::size_t sum{};
+    for (std::size_t i = 0; i < iters; ++i)
+        sum = sum + i;
+}
+
+TEST(TunerTest, cpu_model)
+{
+    auto model = rm::tuner::cpuModel();
+    EXPECT_FALSE(model.empty());
+}
+
+TEST(TunerTest, select_fastest)
+{
+    rm::tuner::setCacheFile({});
+    // 耗时差距悬殊的两个变体，基准测试应选出快者
+    std::size_t idx = rm::tuner::select("test/select_fastest", {{"slow", [] { workload(500000); }},
+                                                               {"fast", [] { workload(100); }}});
+    EXPECT_EQ(idx, 1u);
+    // 单变体直接返回，空变体列表抛出异常
+    EXPECT_EQ(rm::tuner::select("test/single", {{"only", [] {}}}), 0u);
+    EXPECT_THROW(rm::tuner::select("test/empty", {}), rm::Exception);
+}
+
+TEST(TunerTest, cache_round_trip)
+{
+    const char *file = "ts_tuner.tbl";
+    rm::tuner::setCacheFile(file);
+    std::size_t idx = rm::tuner::select("test/cache", {{"slow", [] { workload(500000); }},
+                                                       {"fast", [] { workload(100); }}});
+    EXPECT_EQ(idx, 1u);
+    // 重新加载选优表后按变体名称命中缓存，不再基准测试：即使耗时关系反转，仍返回缓存的胜者
+    rm::tuner::setCacheFile(file);
+    idx = rm::tuner::select("test/cache", {{"slow", [] { workload(100); }},
+                                           {"fast", [] { workload(500000); }}});
+    EXPECT_EQ(idx, 1u);
+    // 清除持久化路径后选优表重建，重新基准测试
+    rm::tuner::setCacheFile({});
+    idx = rm::tuner::select("test/cache", {{"slow", [] { workload(100); }},
+                                           {"fast", [] { workload(500000); }}});
+    EXPECT_EQ(idx, 0u);
+    std::remove(file);
+}
+
+} // namespace rm_test
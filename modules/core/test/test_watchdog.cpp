@@ -0,0 +1,73 @@
+/**
+ * @file test_watchdog.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 低开销卡死看门狗服务单元测试
+ * @version 1.0
+ * @date 2026-08-29
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "rmvl/core/util.hpp"
+#include "rmvl/core/watchdog.hpp"
+
+namespace rm_test
+{
+
+using namespace std::chrono_literals;
+
+TEST(WatchdogTest, stall_detect_and_rearm)
+{
+    rm::Watchdog watchdog;
+    std::atomic_size_t recovered{};
+    auto id = watchdog.add("stage", 0.05, [&recovered] { ++recovered; });
+    watchdog.start(0.005);
+    // 心跳持续推进时不判定卡死
+    for (int i = 0; i < 10; ++i)
+    {
+        watchdog.beat(id);
+        std::this_thread::sleep_for(10ms);
+    }
+    EXPECT_FALSE(watchdog.stalled(id));
+    EXPECT_EQ(recovered.load(), 0u);
+    // 心跳停止推进，超过截止时限后判定卡死并触发恢复回调（仅一次）
+    std::this_thread::sleep_for(200ms);
+    EXPECT_TRUE(watchdog.stalled(id));
+    EXPECT_EQ(recovered.load(), 1u);
+    EXPECT_EQ(watchdog.stalls(id), 1u);
+    // 心跳恢复推进后重新武装，再次卡死会再次触发
+    watchdog.beat(id);
+    std::this_thread::sleep_for(50ms);
+    EXPECT_FALSE(watchdog.stalled(id));
+    std::this_thread::sleep_for(200ms);
+    EXPECT_TRUE(watchdog.stalled(id));
+    EXPECT_EQ(recovered.load(), 2u);
+    watchdog.stop();
+}
+
+TEST(WatchdogTest, not_armed_before_first_beat)
+{
+    rm::Watchdog watchdog;
+    auto id = watchdog.add("idle", 0.02);
+    watchdog.start(0.005);
+    // 首次 beat 前不纳入监测
+    std::this_thread::sleep_for(100ms);
+    EXPECT_FALSE(watchdog.stalled(id));
+    EXPECT_EQ(watchdog.stalls(id), 0u);
+    watchdog.stop();
+}
+
+TEST(WatchdogTest, invalid_argument)
+{
+    rm::Watchdog watchdog;
+    EXPECT_THROW(watchdog.add("bad", 0.), rm::Exception);
+}
+
+} // namespace rm_test
@@ -76,6 +76,35 @@ public:
      * @return 是否设置成功？
      */
     RMVL_W bool set(int chn, int val);
+
+    /**
+     * @brief 异步设置指定通道的光源亮度
+     * @brief
+     * - `set` 为阻塞的串口事务（含写后延时），在帧循环中调节亮度会使当前帧停顿；本方法
+     *   仅将命令入队后立即返回，事务由后台线程执行，同一通道的连续调节按「最新值生效」
+     *   合并 @see LightCommandQueue
+     * @note 异步队列工作期间不应再在其他线程同步调用 `set` / `get` 等方法，需要时先以
+     *       `sync` 等待队列排空
+     *
+     * @param[in] chn 指定通道，范围: `1 ~ 8`
+     * @param[in] val 指定通道的光源亮度
+     * @param[in] on_done 完成回调，形参为是否设置成功，可为空，在后台线程中执行
+     */
+    RMVL_W void setAsync(int chn, int val, const std::function<void(bool)> &on_done = {});
+
+    //! 阻塞等待异步队列中的全部设置命令执行完毕
+    RMVL_W void sync() const;
+
+    /**
+     * @brief 设置指定通道为频闪模式
+     * @note 频闪模式下光源仅在指定硬触发输入通道的信号有效期间按配置亮度点亮，
+     *       调用 `open` 或 `close` 可退出频闪模式，恢复常亮、常灭控制
+     *
+     * @param[in] chn 指定通道，范围: `1 ~ 8`
+     * @param[in] cfg 频闪配置
+     * @return 是否设置成功？
+     */
+    RMVL_W bool setStrobe(int chn, const LightStrobeConfig &cfg);
 };
 
 //! @} hik_light_control
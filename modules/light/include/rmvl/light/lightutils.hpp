@@ -11,6 +11,12 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
 #include "rmvl/core/util.hpp"
 
 namespace rm
@@ -30,4 +36,139 @@ struct RMVL_EXPORTS_W_AG LightConfig
     RMVL_W_RW LightHandleMode handle_mode{}; //!< 通信模式
 };
 
+/**
+ * @brief 光源控制器硬触发通道
+ * @note 编号与相机模块的 `rm::TriggerChannel` 对齐，相机的曝光有效电平输出接入光源控制器的
+ *       对应触发输入通道后，即可实现光源与曝光窗口同步的频闪
+ */
+enum class LightTriggerChannel : uint8_t
+{
+    Chn0, //!< 通道 0
+    Chn1, //!< 通道 1
+    Chn2, //!< 通道 2
+    Chn3  //!< 通道 3
+};
+
+/**
+ * @brief 光源频闪配置
+ * @note 频闪模式下光源仅在硬触发信号有效期间点亮，占空比降低后允许以更高亮度驱动，
+ *       可缩短相机曝光时间，降低运动模糊
+ */
+struct RMVL_EXPORTS_W_AG LightStrobeConfig
+{
+    RMVL_W_RW LightTriggerChannel trigger_channel{}; //!< 硬触发输入通道
+    RMVL_W_RW uint32_t pulse_width{};                //!< 脉冲宽度，单位 `0.1ms`
+    RMVL_W_RW uint8_t intensity{};                   //!< 频闪期间的光源亮度，范围 \f$[0, 255]\f$
+};
+
+/**
+ * @brief 光源控制命令异步队列
+ * @note
+ * - 光源控制器的单次设置为阻塞的串口、以太网事务，耗时可达数毫秒至十余毫秒；本队列将
+ *   命令入队后立即返回，阻塞事务由后台线程统一执行，热路径的开销仅为一次入队
+ * @note
+ * - 同一通道的待执行命令按「最新值生效」合并：帧循环中对同一通道的连续调节只会向设备
+ *   下发最后一次的值，被合并命令的完成回调随之被替换
+ * @note
+ * - 完成回调在后台线程中执行；析构时后台线程在执行完全部待执行命令后退出
+ */
+class LightCommandQueue final
+{
+public:
+    /**
+     * @brief 创建光源控制命令异步队列
+     *
+     * @param[in] apply 命令执行函数，形参为（通道，亮度值），返回是否执行成功，
+     *                  在后台线程中调用
+     */
+    explicit LightCommandQueue(std::function<bool(int, int)> apply)
+        : _apply(std::move(apply)), _worker(&LightCommandQueue::workerLoop, this) {}
+
+    ~LightCommandQueue()
+    {
+        {
+            std::lock_guard lk(_mtx);
+            _stop = true;
+        }
+        _cv.notify_one();
+        _worker.join();
+    }
+
+    LightCommandQueue(const LightCommandQueue &) = delete;
+    LightCommandQueue &operator=(const LightCommandQueue &) = delete;
+
+    /**
+     * @brief 入队一条设置命令（仅入队，执行由后台线程完成）
+     *
+     * @param[in] chn 指定通道
+     * @param[in] val 指定通道的光源亮度
+     * @param[in] on_done 完成回调，形参为是否执行成功，可为空，在后台线程中执行
+     */
+    void push(int chn, int val, std::function<void(bool)> on_done = {})
+    {
+        {
+            std::lock_guard lk(_mtx);
+            // 同通道合并，最新值生效
+            _cmds[chn] = {val, std::move(on_done)};
+        }
+        _cv.notify_one();
+    }
+
+    //! 待执行（含正在执行）的命令条数
+    std::size_t pending() const
+    {
+        std::lock_guard lk(_mtx);
+        return _cmds.size() + (_busy ? 1 : 0);
+    }
+
+    //! 阻塞等待队列中的全部命令执行完毕
+    void sync() const
+    {
+        std::unique_lock lk(_mtx);
+        _idle.wait(lk, [this] { return _cmds.empty() && !_busy; });
+    }
+
+private:
+    void workerLoop()
+    {
+        std::unique_lock lk(_mtx);
+        while (true)
+        {
+            _cv.wait(lk, [this] { return !_cmds.empty() || _stop; });
+            if (_cmds.empty() && _stop)
+                return;
+            auto it = _cmds.begin();
+            int chn = it->first;
+            Command cmd = std::move(it->second);
+            _cmds.erase(it);
+            _busy = true;
+            // 阻塞事务与完成回调的执行期间不持有锁，热路径可继续入队
+            lk.unlock();
+            bool ok = _apply(chn, cmd.val);
+            if (cmd.on_done)
+                cmd.on_done(ok);
+            lk.lock();
+            _busy = false;
+            if (_cmds.empty())
+                _idle.notify_all();
+        }
+    }
+
+    //! 待执行命令
+    struct Command
+    {
+        int val{};                        //!< 光源亮度
+        std::function<void(bool)> on_done; //!< 完成回调
+    };
+
+    std::function<bool(int, int)> _apply; //!< 命令执行函数
+    std::map<int, Command> _cmds;         //!< 待执行命令表 `[通道 : 命令]`，同通道合并
+    bool _busy{};                         //!< 后台线程是否正在执行命令
+    bool _stop{};                         //!< 后台线程停止标志
+    mutable std::mutex _mtx;              //!< 命令表互斥锁
+    std::condition_variable _cv;          //!< 命令到来条件变量
+    mutable std::condition_variable _idle; //!< 队列排空条件变量
+    std::thread _worker;                  //!< 后台执行线程
+};
+
 } // namespace rm
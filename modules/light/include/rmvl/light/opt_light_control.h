@@ -93,6 +93,24 @@ public:
      */
     RMVL_W bool setIntensity(int channel, int intensity) noexcept;
 
+    /**
+     * @brief 异步设置指定通道的光源亮度
+     * @brief
+     * - `setIntensity` 为阻塞的以太网事务，在帧循环中调节亮度会使当前帧停顿；本方法仅将
+     *   命令入队后立即返回，事务由后台线程执行，同一通道的连续调节按「最新值生效」合并
+     *   @see LightCommandQueue
+     * @note 异步队列工作期间不应再在其他线程同步调用 `setIntensity` 等方法，需要时先以
+     *       `sync` 等待队列排空
+     *
+     * @param[in] channel 指定通道
+     * @param[in] intensity 指定通道的光源亮度
+     * @param[in] on_done 完成回调，形参为是否设置成功，可为空，在后台线程中执行
+     */
+    RMVL_W void setIntensityAsync(int channel, int intensity, const std::function<void(bool)> &on_done = {});
+
+    //! 阻塞等待异步队列中的全部设置命令执行完毕
+    RMVL_W void sync() const;
+
     /**
      * @brief 光源控制器软触发指定通道
      *
@@ -101,6 +119,17 @@ public:
      * @return 是否成功触发？
      */
     RMVL_W bool trigger(int channel, int time) const noexcept;
+
+    /**
+     * @brief 设置指定通道为频闪模式
+     * @note OPT 控制器的外触发输入与输出通道一一对应，`LightStrobeConfig` 中的触发输入通道
+     *       仅对支持通道路由的控制器生效；设置后光源仅在外触发信号有效期间按配置亮度点亮
+     *
+     * @param[in] channel 指定通道，范围: [1 ~ 8]（十进制格式）
+     * @param[in] cfg 频闪配置
+     * @return 是否设置成功？
+     */
+    RMVL_W bool setStrobe(int channel, const LightStrobeConfig &cfg) noexcept;
 };
 
 //! @} opt_light_control
@@ -0,0 +1,29 @@
+/**
+ * @file light.hpp
+ * @author RMVL Community
+ * @brief light header file (Generated by CMake automatically, DO NOT MODIFY!)
+ * 
+ * @copyright Copyright 2026 (c), RMVL Community
+ * 
+ */
+
+#pragma once
+
+//! @addtogroup para
+//! @{
+
+//! @defgroup para_light light 的参数模块
+//! @{
+
+#ifdef HAVE_RMVL_HIK_LIGHT_CONTROL
+#include "light/hik_light_control.h"
+#endif // HAVE_RMVL_HIK_LIGHT_CONTROL
+
+//! @} para_light
+
+//! @addtogroup para_light
+//! @{
+//! @brief 与 @ref light 相关的参数模块，包含...
+//! @} para_light
+
+//! @} para
@@ -0,0 +1,84 @@
+/**
+ * @file hik_light_control.h
+ * @author RMVL Community
+ * @brief HikLightControlParam module header file, without opencv (Generated by CMake automatically, DO NOT MODIFY!)
+ * 
+ * @copyright Copyright 2026 (c), RMVL Community
+ * 
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rmvl/core/rmvldef.hpp"
+
+
+namespace rm::para
+{
+
+//! @addtogroup para_light
+//! @{
+//! @details
+//! - 类名： HikLightControlParam ，对应的全局参数变量： `rm::para::hik_light_control_param`
+//! @} para_light
+
+//! @addtogroup para_light
+//! @{
+
+////////////////////// 扩展部分 //////////////////////
+
+
+////////////////////// 参数部分 //////////////////////
+
+/**
+ * @brief HikLightControlParam 参数模块
+ * @note
+ * - 不受 OpenCV 支持，无法实现运行时参数加载
+ * @note
+ * - 无法包含 OpenCV 中有关矩阵、向量、点等数据结构
+ */
+class RMVL_EXPORTS_W HikLightControlParam
+{
+public:
+    RMVL_W HikLightControlParam() = default;
+
+    //! 串口写入后的延时时间，单位ms @note 默认值：`10`
+    RMVL_W_RW uint32_t DELAY_AFTER_WRITE = 10;
+
+};
+
+//! HikLightControlParam 参数模块 @note 此参数对象不受 OpenCV 支持
+RMVL_W_RW inline HikLightControlParam hik_light_control_param;
+
+//! @cond
+inline std::shared_ptr<const HikLightControlParam> _hik_light_control_snap{std::make_shared<const HikLightControlParam>()};
+//! @endcond
+
+/**
+ * @brief 获取 HikLightControlParam 的不可变参数快照
+ * @note 每帧获取一次快照指针，帧内热路径从快照按字段读取，读取无锁且不会在并发调参时发生撕裂
+ *
+ * @return 最近一次通过 `hik_light_control_update` 发布的参数快照
+ */
+inline std::shared_ptr<const HikLightControlParam> hik_light_control_snapshot() { return std::atomic_load_explicit(&_hik_light_control_snap, std::memory_order_acquire); }
+
+/**
+ * @brief 原子发布新的 HikLightControlParam 参数
+ * @note 供调参界面等写者使用，发布后获取的快照立即可见新参数，同时同步至
+ *       `hik_light_control_param` 以兼容直接按字段读取的代码
+ *
+ * @param[in] data 待发布的参数
+ */
+inline void hik_light_control_update(const HikLightControlParam &data)
+{
+    hik_light_control_param = data;
+    std::atomic_store_explicit(&_hik_light_control_snap, std::make_shared<const HikLightControlParam>(data), std::memory_order_release);
+}
+
+//! @} para_light
+
+} // namespace rm::para
@@ -42,8 +42,22 @@ public:
     //! 设置指定通道的光源亮度
     bool set(int chn, int val);
 
+    //! 异步设置指定通道的光源亮度（仅入队，串口事务由后台线程执行）
+    void setAsync(int chn, int val, const std::function<void(bool)> &on_done);
+
+    //! 阻塞等待异步队列中的全部设置命令执行完毕
+    void sync() const
+    {
+        if (_queue != nullptr)
+            _queue->sync();
+    }
+
+    //! 设置指定通道为频闪模式
+    bool setStrobe(int chn, const LightStrobeConfig &cfg);
+
 private:
-    std::unique_ptr<SerialPort> _sp{}; //!< 串口对象
+    std::unique_ptr<SerialPort> _sp{};          //!< 串口对象
+    std::unique_ptr<LightCommandQueue> _queue; //!< 异步命令队列（首次异步设置时创建）
 };
 
 } // namespace rm
@@ -15,6 +15,9 @@ bool HikLightController::open() { return _impl->open(); }
 bool HikLightController::close() { return _impl->close(); }
 int HikLightController::get(int chn) const { return _impl->get(chn); }
 bool HikLightController::set(int chn, int val) { return _impl->set(chn, val); }
+void HikLightController::setAsync(int chn, int val, const std::function<void(bool)> &on_done) { _impl->setAsync(chn, val, on_done); }
+void HikLightController::sync() const { _impl->sync(); }
+bool HikLightController::setStrobe(int chn, const LightStrobeConfig &cfg) { return _impl->setStrobe(chn, cfg); }
 
 using namespace std::string_literals;
 constexpr const char HIK_CHN_STR[] = "ABCDEF";
@@ -98,4 +101,34 @@ bool HikLightController::Impl::set(int chn, int val)
     return buf == std::string(1, ch);
 }
 
+void HikLightController::Impl::setAsync(int chn, int val, const std::function<void(bool)> &on_done)
+{
+    RMVL_DbgAssert(isOpened());
+    RMVL_Assert(chn > 0 && chn <= 6 && val >= 0 && val <= 255);
+    // 首次异步设置时创建命令队列，事务执行函数直接复用同步设置
+    if (_queue == nullptr)
+        _queue = std::make_unique<LightCommandQueue>([this](int c, int v) { return set(c, v); });
+    _queue->push(chn, val, on_done);
+}
+
+bool HikLightController::Impl::setStrobe(int chn, const LightStrobeConfig &cfg)
+{
+    RMVL_DbgAssert(isOpened());
+    RMVL_Assert(chn > 0 && chn <= 6 && cfg.pulse_width <= 9999);
+    // 预设频闪期间的亮度
+    if (!set(chn, cfg.intensity))
+        return false;
+    char ch = HIK_CHN_STR[chn - 1];
+    // 绑定硬触发输入通道并设置脉冲宽度，命令格式与亮度设置一致，以 'T' 开头
+    char command[10]{};
+    snprintf(command, sizeof(command), "T%c%u%04u#", ch, static_cast<unsigned>(cfg.trigger_channel), cfg.pulse_width);
+    if (!_sp->write(command))
+        return false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(para::hik_light_control_param.DELAY_AFTER_WRITE));
+    std::string buf;
+    if (!_sp->read(buf))
+        return false;
+    return buf == std::string(1, ch);
+}
+
 } // namespace rm
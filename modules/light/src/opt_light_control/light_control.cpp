@@ -18,7 +18,10 @@ bool OPTLightController::close(const std::vector<int> &channels) noexcept { retu
 bool OPTLightController::close() noexcept { return _impl->close(); }
 int OPTLightController::getIntensity(int channel) const noexcept { return _impl->getIntensity(channel); }
 bool OPTLightController::setIntensity(int channel, int intensity) noexcept { return _impl->setIntensity(channel, intensity); }
+void OPTLightController::setIntensityAsync(int channel, int intensity, const std::function<void(bool)> &on_done) { _impl->setIntensityAsync(channel, intensity, on_done); }
+void OPTLightController::sync() const { _impl->sync(); }
 bool OPTLightController::trigger(int channel, int time) const noexcept { return _impl->trigger(channel, time); }
+bool OPTLightController::setStrobe(int channel, const LightStrobeConfig &cfg) noexcept { return _impl->setStrobe(channel, cfg); }
 
 OPTLightController::Impl::Impl(const LightConfig &cfg, std::string_view id)
 {
@@ -41,6 +44,13 @@ OPTLightController::Impl::Impl(const LightConfig &cfg, std::string_view id)
     }
 }
 
+OPTLightController::Impl::~Impl()
+{
+    // 先排空异步命令队列，再断开连接
+    _queue.reset();
+    disconnect();
+}
+
 bool OPTLightController::Impl::disconnect() noexcept
 {
     if (_init)
@@ -94,4 +104,13 @@ bool OPTLightController::Impl::trigger(int channel, int time) const noexcept
     return OPTController_SoftwareTrigger(_handle, channel, time) == OPT_SUCCEED;
 }
 
+bool OPTLightController::Impl::setStrobe(int channel, const LightStrobeConfig &cfg) noexcept
+{
+    // 预设频闪期间的亮度
+    if (OPTController_SetIntensity(_handle, channel, cfg.intensity) != OPT_SUCCEED)
+        return false;
+    // 触发脉冲宽度单位为 0.1ms，与 SDK 触发宽度定义一致
+    return OPTController_SetTriggerWidth(_handle, channel, static_cast<int>(cfg.pulse_width)) == OPT_SUCCEED;
+}
+
 } // namespace rm
@@ -48,14 +48,35 @@ public:
     //! 设置指定通道的光源亮度
     bool setIntensity(int channel, int intensity) noexcept;
 
+    //! 异步设置指定通道的光源亮度（仅入队，以太网事务由后台线程执行）
+    void setIntensityAsync(int channel, int intensity, const std::function<void(bool)> &on_done)
+    {
+        // 首次异步设置时创建命令队列，事务执行函数直接复用同步设置
+        if (_queue == nullptr)
+            _queue = std::make_unique<LightCommandQueue>([this](int c, int v) { return setIntensity(c, v); });
+        _queue->push(channel, intensity, on_done);
+    }
+
+    //! 阻塞等待异步队列中的全部设置命令执行完毕
+    void sync() const
+    {
+        if (_queue != nullptr)
+            _queue->sync();
+    }
+
     //! 光源控制器软触发指定通道
     bool trigger(int channel, int time) const noexcept;
 
+    //! 设置指定通道为频闪模式
+    bool setStrobe(int channel, const LightStrobeConfig &cfg) noexcept;
+
 private:
     bool disconnect() noexcept;
 
     bool _init{};        //!< 初始化标志位
     long long _handle{}; //!< 光源控制器句柄
+
+    std::unique_ptr<LightCommandQueue> _queue; //!< 异步命令队列（首次异步设置时创建）
 };
 
 } // namespace rm
@@ -12,6 +12,14 @@
 #pragma once
 
 #include <any>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
 #include <onnxruntime/onnxruntime_cxx_api.h>
 
 #include <opencv2/core/mat.hpp>
@@ -30,7 +38,9 @@ enum class OrtProvider : uint8_t
     CPU,      //!< 由 `CPU` 执行
     CUDA,     //!< 由 `CUDA` 执行
     TensorRT, //!< 由 `TensorRT` 执行
-    OpenVINO  //!< 由 `OpenVINO` 执行
+    OpenVINO, //!< 由 `OpenVINO` 执行
+    Auto      //!< 自动选择：对各可用提供者以实际模型实测推理耗时并选出最快者，
+              //!< 选优结果以模型哈希为键经由 rm::tuner 按机型缓存，后续启动直接命中
 };
 
 //! 预处理选项
@@ -40,13 +50,104 @@ struct RMVL_EXPORTS_W_AG PreprocessOptions
     RMVL_W_RW std::vector<float> stds;  //!< 标准差
 };
 
-//! 后处理选项
+/**
+ * @brief 后处理选项
+ * @note `softmax`、`topk` 与 `thresh` 在整个输出批量上以单趟融合核执行，
+ *       参见 rm::ClassificationNet::postProcess
+ */
 struct RMVL_EXPORTS_W_AG PostprocessOptions
 {
     RMVL_W_RW uint8_t color{};             //!< 颜色通道
-    RMVL_W_RW std::vector<float> thresh{}; //!< 阈值向量
+    RMVL_W_RW std::vector<float> thresh{}; //!< 置信度阈值，长度为 `1` 时作为全局阈值，否则按类别标签索引，为空时不做阈值过滤
+    RMVL_W_RW bool softmax{};              //!< 是否对输出执行 softmax 归一化，将原始输出转为概率后再行阈值过滤
+    RMVL_W_RW int topk{1};                 //!< 每张图像保留的结果个数，大于 `1` 时按置信度降序返回 top-k 列表
 };
 
+/**
+ * @brief ROI 批量缓冲区
+ * @brief
+ * - 持有一块连续的槽位化暂存缓冲区，识别层经由 `acquire` 取得槽位的 `cv::Mat`
+ *   写入视图并将 ROI 直接写入，识别与推理的边界上不产生逐 ROI 的图像分配与拷贝
+ * @brief
+ * - rm::OnnxNet::inference 的批量缓冲区重载就地消费全部槽位，连续的槽位布局使
+ *   单通道批量的标准化在单趟遍历内完成，参见 rm::ClassificationNet
+ * @brief
+ * - `HAVE_CUDA` 时暂存缓冲区以锁页（pinned）内存分配，`OrtProvider::CUDA` 等
+ *   设备提供者的主机到设备传输经由 DMA 执行
+ */
+class RMVL_EXPORTS RoiBatch final
+{
+public:
+    RoiBatch() = default;
+    ~RoiBatch();
+
+    //! @cond
+    RoiBatch(const RoiBatch &) = delete;
+    RoiBatch(RoiBatch &&) = delete;
+    RoiBatch &operator=(const RoiBatch &) = delete;
+    RoiBatch &operator=(RoiBatch &&) = delete;
+    //! @endcond
+
+    /**
+     * @brief 预留槽位容量，容量与槽位规格均满足时不产生任何分配
+     * @note 槽位规格发生变化时缓冲区重新分配，已有槽位视图与内容均失效
+     *
+     * @param[in] capacity 槽位容量
+     * @param[in] size 槽位图像尺寸
+     * @param[in] channels 槽位图像通道数，可以是 `1` 或 `3`，默认为 `1`
+     */
+    void reserve(std::size_t capacity, cv::Size size, int channels = 1);
+
+    /**
+     * @brief 取得下一个槽位的写入视图
+     * @note 视图包装暂存缓冲区中的槽位数据，写入即落入批量缓冲区。容量不足时扩容
+     *       并使已有槽位视图失效，逐帧复用时应预先 `reserve` 足够的容量
+     *
+     * @return 槽位的 `cv::Mat` 写入视图
+     */
+    cv::Mat acquire();
+
+    /**
+     * @brief 获取指定槽位的视图
+     *
+     * @param[in] idx 槽位索引
+     * @return 槽位的 `cv::Mat` 视图
+     */
+    cv::Mat at(std::size_t idx) const;
+
+    //! 清空槽位计数，保留容量与槽位规格，在每帧写入前调用
+    void clear() noexcept { _count = 0; }
+    //! 获取已写入的槽位个数
+    std::size_t size() const noexcept { return _count; }
+    //! 批量缓冲区是否为空
+    bool empty() const noexcept { return _count == 0; }
+    //! 获取暂存缓冲区首地址
+    const uchar *data() const noexcept { return _data; }
+    //! 获取单个槽位的字节数
+    std::size_t stride() const noexcept;
+    //! 获取槽位图像尺寸
+    cv::Size imageSize() const noexcept { return _size; }
+    //! 获取槽位图像通道数
+    int channels() const noexcept { return _channels; }
+
+private:
+    uchar *_data{};          //!< 暂存缓冲区首地址
+    std::size_t _capacity{}; //!< 槽位容量
+    std::size_t _count{};    //!< 已写入的槽位个数
+    cv::Size _size{};        //!< 槽位图像尺寸
+    int _channels{1};        //!< 槽位图像通道数
+};
+
+/**
+ * @brief 设置 `OrtProvider::CUDA` 提供者的外部计算流
+ * @note 需在构造使用 `OrtProvider::CUDA` 的网络之前调用，传入 `cudaStream_t` 句柄，
+ *       如 rm::CudaPretreat 的 `stream()`。推理在该流上排队执行，与预处理共流可免去
+ *       设备级同步，传入 `nullptr` 恢复由 Ort 自行创建计算流
+ *
+ * @param[in] stream CUDA 计算流句柄
+ */
+RMVL_EXPORTS void setOrtCudaStream(void *stream);
+
 //! ONNX-Runtime (Ort) 部署库基类 \cite microsoft23ort
 class RMVL_EXPORTS_W OnnxNet
 {
@@ -55,6 +156,9 @@ protected:
     Ort::Env _env;                          //!< 环境配置
     Ort::SessionOptions _session_options;   //!< 会话选项
     std::unique_ptr<Ort::Session> _session; //!< 会话
+
+    //! 模型文件的只读共享映射，权重页在多进程间共享，需在会话生命周期内保持有效
+    std::vector<std::shared_ptr<const void>> _model_maps;
 #if ORT_API_VERSION < 12
     std::vector<const char *> _inames; //!< 输入名称
     std::vector<const char *> _onames; //!< 输出名称
@@ -62,6 +166,29 @@ protected:
     std::vector<Ort::AllocatedStringPtr> _inames; //!< 输入名称
     std::vector<Ort::AllocatedStringPtr> _onames; //!< 输出名称
 #endif
+    std::string _cache_dir;                    //!< 引擎缓存路径
+    std::unique_ptr<Ort::IoBinding> _binding;  //!< 输入输出绑定
+    std::vector<std::vector<float>> _obuffers; //!< 绑定的持久输出缓冲区
+    std::vector<Ort::Value> _otensors;         //!< 绑定的持久输出 Tensor
+
+    //! 热更新中待切换的新会话及其输入输出名称
+    struct PendingSession
+    {
+        std::unique_ptr<Ort::Session> session; //!< 新会话
+#if ORT_API_VERSION < 12
+        std::vector<const char *> inames; //!< 输入名称
+        std::vector<const char *> onames; //!< 输出名称
+#else
+        std::vector<Ort::AllocatedStringPtr> inames; //!< 输入名称
+        std::vector<Ort::AllocatedStringPtr> onames; //!< 输出名称
+#endif
+        std::vector<std::shared_ptr<const void>> maps; //!< 新会话的模型文件映射
+    };
+
+    std::mutex _pending_mutex;                //!< 待切换会话互斥锁
+    std::unique_ptr<PendingSession> _pending; //!< 待切换的新会话
+    std::atomic_bool _pending_ready{};        //!< 新会话是否就绪
+    std::thread _reload_thread;               //!< 热更新后台线程
 
 public:
     /**
@@ -88,9 +215,94 @@ public:
      */
     RMVL_W std::any inference(const std::vector<cv::Mat> &images, const PreprocessOptions &preop, const PostprocessOptions &postop);
 
-    virtual ~OnnxNet() = default;
+    /**
+     * @brief 批量缓冲区推理
+     * @brief
+     * - 就地消费 rm::RoiBatch 中的全部槽位，暂存缓冲区直接作为预处理的读取源，
+     *   识别层与推理层的边界上不产生逐 ROI 的图像拷贝
+     *
+     * @param[in] batch ROI 批量缓冲区，不可为空
+     * @param[in] preop 预处理选项，不同网络有不同的预处理选项
+     * @param[in] postop 后处理选项，不同网络有不同的后处理选项
+     * @return 使用 `std::any` 表示的所有推理结果，槽位个数大于 1 时可使用 `unbatch` 拆分
+     */
+    std::any inference(const RoiBatch &batch, const PreprocessOptions &preop, const PostprocessOptions &postop);
+
+    /**
+     * @brief 绑定持久的输入输出缓冲区，启用 `IoBinding` 推理模式
+     * @brief
+     * - 输出 Tensor 在绑定时一次性分配，后续每次推理复用同一块缓冲区，消除逐次推理的
+     *   Tensor 分配与名称数组构建开销
+     * @brief
+     * - 绑定成功后，传入单张图像的 `inference` 自动经由 `IoBinding` 路径执行，
+     *   批量推理仍走原有路径
+     * @note 要求各输入输出层均为静态形状的 `float` 类型 Tensor，动态批维度按 `1` 处理，
+     *       不满足时绑定失败并保持原有路径
+     * @return 是否绑定成功
+     */
+    RMVL_W bool bindIO() noexcept;
+
+    /**
+     * @brief 预热推理会话
+     * @brief
+     * - 按模型输入层形状构造全零图像并执行若干次推理，使 TensorRT、OpenVINO 等提供者
+     *   在启动阶段完成引擎编译与缓存加载，避免首帧推理出现长时间停顿
+     * @note 要求输入层为 `[N, c, h, w]` 形状且 `c`、`h`、`w` 为静态维度，不满足时不执行任何操作
+     *
+     * @param[in] preop 预处理选项
+     * @param[in] postop 后处理选项
+     * @param[in] times 预热推理次数，默认为 `1`
+     * @return 是否完成预热
+     */
+    RMVL_W bool warmup(const PreprocessOptions &preop, const PostprocessOptions &postop, std::size_t times = 1) noexcept;
+
+    /**
+     * @brief 异步热更新模型
+     * @brief
+     * - 新会话在后台线程完成加载与预热，不阻塞正在进行的推理，加载失败时输出错误信息并
+     *   保留原会话，进程无需重启即可完成赛中模型更新与 A/B 评估
+     * @brief
+     * - 新会话就绪后，下一次 `inference` 调用在两次推理之间完成切换，切换仅为指针交换并
+     *   重建 `IoBinding`，不产生丢帧
+     * @note 本接口需由单一线程调用，与 `inference` 可以并发
+     *
+     * @param[in] model_path 新模型路径
+     */
+    RMVL_W void reload(std::string_view model_path);
+
+    /**
+     * @brief 将批量推理结果拆分为与每张输入图像一一对应的结果列表
+     *
+     * @param[in] result 使用 `std::any` 表示的批量推理结果
+     * @param[in] batch 批量大小
+     * @return 拆分后的结果列表，基类默认仅支持 `batch == 1`，其余情况返回空列表
+     */
+    virtual std::vector<std::any> unbatch(const std::any &result, std::size_t batch) const;
+
+    virtual ~OnnxNet();
+
+protected:
+    //! 热更新切换会话后的回调，派生类可在此刷新与输入输出层相关的缓存
+    virtual void onSessionSwap() {}
 
 private:
+    //! 若热更新的新会话已就绪，在两次推理之间切换至新会话
+    void applyPendingSession();
+
+    //! 后台预热待切换的新会话，使 `CUDA`、`TensorRT` 等提供者在切换前完成首帧初始化
+    void warmupPending(PendingSession &pending);
+
+    /**
+     * @brief 在各可用提供者中实测选出推理最快者
+     * @note 为每个可用提供者构造试探会话并预热（引擎编译在此阶段完成），随后实测单次
+     *       推理耗时，构造或推理失败的提供者直接剔除。选优结果以模型哈希为键经由
+     *       rm::tuner 按机型缓存，命中缓存时跳过全部试探
+     *
+     * @param[in] model_path 模型路径
+     * @return 推理最快的提供者，除 `CPU` 外均不可用时返回 `OrtProvider::CPU`
+     */
+    OrtProvider selectProvider(std::string_view model_path);
+
     /**
      * @brief 预处理
      *
@@ -100,6 +312,15 @@ private:
      */
     virtual std::vector<Ort::Value> preProcess(const std::vector<cv::Mat> &images, const PreprocessOptions &preop);
 
+    /**
+     * @brief 批量缓冲区预处理
+     *
+     * @param[in] batch ROI 批量缓冲区
+     * @param[in] preop 预处理选项，不同网络有不同的预处理选项
+     * @return 模型的输入 Tensors
+     */
+    virtual std::vector<Ort::Value> preProcess(const RoiBatch &batch, const PreprocessOptions &preop);
+
     /**
      * @brief 后处理
      *
@@ -108,19 +329,35 @@ private:
      * @return 使用 `std::any` 表示的所有推理结果，需要根据具体的网络进行解析
      */
     virtual std::any postProcess(const std::vector<Ort::Value> &output_tensors, const PostprocessOptions &postop);
+
+    //! 输入 Tensors 就绪后执行会话调用并完成后处理，单张输入经由 `IoBinding` 路径
+    std::any runSession(std::vector<Ort::Value> &itensors, std::size_t batch, const PostprocessOptions &postop);
 };
 
 /**
  * @brief 分类网络推理类
  * @note 需满足
  * @note
- * - 输入层为 `[1, c, h, w]`，其中 `c` 为输入图像的通道数，可以是 `1` 或者 `3`，`h` 为高度，`w` 为宽度
+ * - 输入层为 `[N, c, h, w]`，其中 `c` 为输入图像的通道数，可以是 `1` 或者 `3`，`h` 为高度，`w` 为宽度
+ * @note
+ * - 输出层为 `[N, n]`，其中 `n` 为类别数
+ * @note
+ * - 传入多张图像时将堆叠为一个批量 Tensor，在单次会话调用内完成全部推理，
+ *   要求模型的批维度 `N` 为动态维度
  * @note
- * - 输出层为 `[1, n]`，其中 `n` 为类别数
+ * - 输入层元素类型可为 `float` 或 `int8`，`int8` 量化模型需先加载量化表，
+ *   参考 rm::ClassificationNet::loadCalibTable
  */
 class RMVL_EXPORTS_W ClassificationNet : public OnnxNet
 {
     std::vector<std::vector<float>> _iarrays; //!< 输入数组
+    std::vector<int8_t> _qarray;              //!< INT8 量化输入数组
+    //! 输入层元素类型
+    ONNXTensorElementDataType _input_type{ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT};
+    float _iscale{};    //!< 输入量化系数
+    int _izero{};       //!< 输入量化零点
+    float _oscale{1.f}; //!< 输出反量化系数
+    int _ozero{};       //!< 输出反量化零点
 
 public:
     /**
@@ -131,6 +368,30 @@ public:
      */
     RMVL_W static std::pair<int, float> cast(const std::any &result) { return std::any_cast<std::pair<int, float>>(result); }
 
+    /**
+     * @brief 批量推理结果转换
+     *
+     * @param[in] result 使用 `std::any` 表示的批量推理结果（传入多于 1 张图像时）
+     * @return 转换后的推理结果列表，与输入图像一一对应
+     */
+    RMVL_W static std::vector<std::pair<int, float>> castBatch(const std::any &result) { return std::any_cast<std::vector<std::pair<int, float>>>(result); }
+
+    /**
+     * @brief top-k 推理结果转换（后处理选项 `topk` 大于 1 时）
+     *
+     * @param[in] result 使用 `std::any` 表示的推理结果
+     * @return 按置信度降序排列的分类结果列表，低于阈值的条目已被过滤
+     */
+    RMVL_W static std::vector<std::pair<int, float>> castTopK(const std::any &result) { return std::any_cast<std::vector<std::pair<int, float>>>(result); }
+
+    /**
+     * @brief 批量 top-k 推理结果转换（传入多于 1 张图像且后处理选项 `topk` 大于 1 时）
+     *
+     * @param[in] result 使用 `std::any` 表示的批量推理结果
+     * @return 转换后的 top-k 结果列表，与输入图像一一对应
+     */
+    RMVL_W static std::vector<std::vector<std::pair<int, float>>> castTopKBatch(const std::any &result) { return std::any_cast<std::vector<std::vector<std::pair<int, float>>>>(result); }
+
     /**
      * @brief 创建分类网络对象
      *
@@ -139,6 +400,33 @@ public:
      */
     RMVL_W ClassificationNet(std::string_view model_path, OrtProvider prov = OrtProvider::CPU);
 
+    /**
+     * @brief 加载 INT8 量化表
+     * @note
+     * - 输入层为 `int8` 的量化模型需在推理前加载量化表，预处理将标准化与量化融合为
+     *   一次乘加，直接生成 `int8` 输入 Tensor，不产生中间的 `float` 平面
+     * @note
+     * - 量化表为文本文件，`input: <scale> <zero_point>` 一行必选，输出层同为 `int8`
+     *   时可增加 `output: <scale> <zero_point>` 一行用于置信度反量化，可由
+     *   rm::ClassificationNet::calibrate 从录制的校准图像集生成
+     *
+     * @param[in] table_path 量化表路径
+     * @return 是否加载成功
+     */
+    RMVL_W bool loadCalibTable(std::string_view table_path);
+
+    /**
+     * @brief INT8 量化校准，由校准图像集生成量化表
+     * @note 对每张图像执行与推理一致的标准化，min-max 扫描激活范围后求取非对称量化参数，
+     *       校准集可使用录制的 `rm::Armor::getNumberROI` 数字 ROI
+     *
+     * @param[in] images 校准图像集，通道数需与模型输入层一致
+     * @param[in] preop 预处理选项，需与推理时一致
+     * @param[in] table_path 量化表写出路径
+     * @return 是否校准成功
+     */
+    RMVL_W static bool calibrate(const std::vector<cv::Mat> &images, const PreprocessOptions &preop, std::string_view table_path);
+
 private:
     /**
      * @brief 预处理
@@ -149,14 +437,113 @@ private:
      */
     std::vector<Ort::Value> preProcess(const std::vector<cv::Mat> &images, const PreprocessOptions &options) override;
 
+    /**
+     * @brief 批量缓冲区预处理
+     * @note 槽位在暂存缓冲区内连续排布，单通道槽位的 `HWC` 与 `CHW` 布局一致，
+     *       整个批量的标准化（量化）在单趟遍历内完成
+     *
+     * @param[in] batch ROI 批量缓冲区
+     * @param[in] options 预处理选项，包含各通道的均值和标准差
+     * @return 模型的输入 Tensors
+     */
+    std::vector<Ort::Value> preProcess(const RoiBatch &batch, const PreprocessOptions &options) override;
+
     /**
      * @brief 后处理
+     * @note
+     * - softmax、top-k 与置信度阈值融合为单趟核在整个输出批量上执行：`topk` 为 `1` 时
+     *   softmax 归一化后的最大置信度由 \f$1/\sum_ie^{x_i-x_{max}}\f$ 直接得出，不写回任何
+     *   中间概率；`topk` 大于 `1` 的 `float` 输出层就地复用 Ort 输出缓冲区存放概率
+     * @note
+     * - 置信度低于阈值时，`topk` 为 `1` 的结果标签置为 `-1`，top-k 列表滤除相应条目
      *
      * @param[in] output_tensors 模型的输出 Tensors
-     * @param[in] postop 无需后处理选项，传入 `{}` 即可
-     * @return 用 `std::any` 表示的分类结果及其置信度，可使用 `rm::ClassificationNet::cast` 函数对返回类型进行转换
+     * @param[in] postop 后处理选项，默认选项 `{}` 下保持 argmax + 原始置信度的行为
+     * @return 用 `std::any` 表示的分类结果及其置信度，可使用 `rm::ClassificationNet::cast`
+     *         （`topk` 大于 `1` 时为 `castTopK`）函数对返回类型进行转换
      */
     std::any postProcess(const std::vector<Ort::Value> &output_tensors, const PostprocessOptions &postop) override;
+
+    //! 热更新切换会话后刷新输入数组与输入层元素类型
+    void onSessionSwap() override;
+
+public:
+    /**
+     * @brief 将批量推理结果拆分为与每张输入图像一一对应的结果列表
+     *
+     * @param[in] result 使用 `std::any` 表示的批量推理结果
+     * @param[in] batch 批量大小
+     * @return 拆分后的结果列表，每个元素均可使用 `rm::ClassificationNet::cast`
+     *         （后处理选项 `topk` 大于 `1` 时为 `castTopK`）进行转换
+     */
+    std::vector<std::any> unbatch(const std::any &result, std::size_t batch) const override;
+};
+
+/**
+ * @brief 多线程推理执行器
+ * @brief
+ * - 拥有唯一的推理会话，多个流水线线程通过 `submit` 提交推理请求
+ * @brief
+ * - 请求在有界的延迟预算内聚合为微批，单次会话调用内完成全部推理，多路相机部署
+ *   可共享同一会话，避免多个会话相互竞争
+ */
+class RMVL_EXPORTS InferenceExecutor final
+{
+public:
+    /**
+     * @brief 创建推理执行器
+     *
+     * @param[in] net 推理网络，执行器接管其所有权
+     * @param[in] preop 预处理选项
+     * @param[in] postop 后处理选项
+     * @param[in] budget 微批聚合的延迟预算，默认 `1ms`
+     * @param[in] max_batch 单个微批的最大请求数，默认 `8`
+     */
+    InferenceExecutor(std::unique_ptr<OnnxNet> net, const PreprocessOptions &preop, const PostprocessOptions &postop,
+                      std::chrono::microseconds budget = std::chrono::milliseconds(1), std::size_t max_batch = 8);
+
+    ~InferenceExecutor();
+
+    InferenceExecutor(const InferenceExecutor &) = delete;
+    InferenceExecutor &operator=(const InferenceExecutor &) = delete;
+
+    /**
+     * @brief 提交推理请求，线程安全
+     *
+     * @param[in] image 输入图像
+     * @return 异步推理结果，可使用对应网络的 `cast` 函数对 `std::any` 进行转换
+     */
+    std::future<std::any> submit(const cv::Mat &image);
+
+    /**
+     * @brief 异步热更新模型，参见 rm::OnnxNet::reload
+     * @note 新会话在后台加载，切换由推理线程在两次微批之间完成，已提交的请求不受影响
+     *
+     * @param[in] model_path 新模型路径
+     */
+    void reload(std::string_view model_path) { _net->reload(model_path); }
+
+private:
+    //! 推理请求
+    struct Request
+    {
+        cv::Mat image;               //!< 输入图像
+        std::promise<std::any> prom; //!< 推理结果
+    };
+
+    //! 推理线程主循环
+    void run();
+
+    std::unique_ptr<OnnxNet> _net;     //!< 推理网络
+    PreprocessOptions _preop;          //!< 预处理选项
+    PostprocessOptions _postop;        //!< 后处理选项
+    std::chrono::microseconds _budget; //!< 微批聚合的延迟预算
+    std::size_t _max_batch;            //!< 单个微批的最大请求数
+    std::mutex _mtx;                   //!< 请求队列互斥锁
+    std::condition_variable _cv;       //!< 请求队列条件变量
+    std::deque<Request> _requests;     //!< 请求队列
+    bool _stop{};                      //!< 停止标志
+    std::thread _worker;               //!< 推理线程
 };
 
 //! @} ml_ort
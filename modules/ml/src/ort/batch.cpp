@@ -0,0 +1,85 @@
+/**
+ * @file batch.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief ROI 批量缓冲区
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "rmvl/core/util.hpp"
+#include "rmvl/ml/ort.h"
+
+#ifdef HAVE_CUDA
+#include "rmvl/algorithm/pretreat.hpp"
+#endif
+
+namespace rm
+{
+
+//! 分配暂存缓冲区，`HAVE_CUDA` 时使用锁页内存，主机到设备的传输经由 DMA 执行
+static uchar *batchAlloc(std::size_t size)
+{
+#ifdef HAVE_CUDA
+    return static_cast<uchar *>(pinnedAlloc(size));
+#else
+    return new uchar[size];
+#endif
+}
+
+//! 释放暂存缓冲区
+static void batchFree(uchar *ptr) noexcept
+{
+#ifdef HAVE_CUDA
+    pinnedFree(ptr);
+#else
+    delete[] ptr;
+#endif
+}
+
+RoiBatch::~RoiBatch() { batchFree(_data); }
+
+std::size_t RoiBatch::stride() const noexcept { return static_cast<std::size_t>(_size.area()) * _channels; }
+
+void RoiBatch::reserve(std::size_t capacity, cv::Size size, int channels)
+{
+    if (size.empty() || (channels != 1 && channels != 3))
+        RMVL_Error_(RMVL_StsBadArg, "Invalid slot specification (%d, %d, %d).", size.width, size.height, channels);
+    // 槽位规格不变且容量满足时不产生任何分配
+    if (size == _size && channels == _channels && capacity <= _capacity)
+        return;
+    batchFree(_data);
+    _size = size, _channels = channels;
+    _capacity = capacity, _count = 0;
+    _data = _capacity > 0 ? batchAlloc(_capacity * stride()) : nullptr;
+}
+
+cv::Mat RoiBatch::acquire()
+{
+    if (_size.empty())
+        RMVL_Error(RMVL_StsError, "\"reserve\" must be called to specify the slot specification before \"acquire\".");
+    // 容量不足时翻倍扩容，已有槽位内容迁移至新缓冲区，已有槽位视图失效
+    if (_count == _capacity)
+    {
+        std::size_t capacity = std::max<std::size_t>(2 * _capacity, 4);
+        uchar *data = batchAlloc(capacity * stride());
+        if (_count > 0)
+            std::memcpy(data, _data, _count * stride());
+        batchFree(_data);
+        _data = data, _capacity = capacity;
+    }
+    return cv::Mat(_size, CV_8UC(_channels), _data + _count++ * stride());
+}
+
+cv::Mat RoiBatch::at(std::size_t idx) const
+{
+    RMVL_Assert(idx < _count);
+    return cv::Mat(_size, CV_8UC(_channels), _data + idx * stride());
+}
+
+} // namespace rm
@@ -9,99 +9,706 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
 #include "rmvl/core/util.hpp"
 #include "rmvl/ml/ort.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace rm
 {
 
 ClassificationNet::ClassificationNet(std::string_view model_path, OrtProvider prov) : OnnxNet(model_path, prov)
 {
-    // 初始化输入数组
+    onSessionSwap();
+    // 绑定持久的输入输出缓冲区，单张图像推理时经由 IoBinding 路径执行
+    bindIO();
+}
+
+void ClassificationNet::onSessionSwap()
+{
+    // 初始化输入数组，并记录输入层元素类型
     _iarrays.resize(_session->GetInputCount());
     for (size_t i = 0; i < _session->GetInputCount(); i++)
     {
         auto shape = _session->GetInputTypeInfo(i).GetTensorTypeAndShapeInfo().GetShape();
         _iarrays[i].resize(shape[1] * shape[2] * shape[3]);
     }
+    if (_session->GetInputCount() == 1)
+        _input_type = _session->GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetElementType();
+}
+
+#if defined(__AVX2__)
+
+/**
+ * @brief 将 16 个 `uchar` 像素转换为 `float` 并完成乘加标准化后写入目标平面
+ *
+ * @param[in] v 16 个像素值
+ * @param[in] s 标准化系数
+ * @param[in] b 标准化偏置
+ * @param[out] dst 目标平面首地址
+ */
+static inline void normalizeStore16(__m128i v, __m256 s, __m256 b, float *dst)
+{
+    __m256 lo = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v));
+    __m256 hi = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+    _mm256_storeu_ps(dst, _mm256_add_ps(_mm256_mul_ps(lo, s), b));
+    _mm256_storeu_ps(dst + 8, _mm256_add_ps(_mm256_mul_ps(hi, s), b));
+}
+
+/**
+ * @brief 将 16 个 `uchar` 像素完成乘加标准化与量化后以 `int8` 写入目标平面
+ *
+ * @param[in] v 16 个像素值
+ * @param[in] s 融合标准化与量化的系数
+ * @param[in] b 融合标准化与量化的偏置
+ * @param[out] dst 目标平面首地址
+ */
+static inline void quantizeStore16(__m128i v, __m256 s, __m256 b, int8_t *dst)
+{
+    __m256 lo = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v));
+    __m256 hi = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+    __m256i qlo = _mm256_cvtps_epi32(_mm256_add_ps(_mm256_mul_ps(lo, s), b));
+    __m256i qhi = _mm256_cvtps_epi32(_mm256_add_ps(_mm256_mul_ps(hi, s), b));
+    // packs 按 128 位通道交织，先恢复像素顺序再两级饱和打包至 int8
+    __m256i q16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(qlo, qhi), 0b11011000);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst),
+                     _mm_packs_epi16(_mm256_castsi256_si128(q16), _mm256_extracti128_si256(q16, 1)));
+}
+
+#elif defined(__ARM_NEON)
+
+/**
+ * @brief 将 16 个 `uchar` 像素转换为 `float` 并完成乘加标准化后写入目标平面
+ *
+ * @param[in] v 16 个像素值
+ * @param[in] s 标准化系数
+ * @param[in] b 标准化偏置
+ * @param[out] dst 目标平面首地址
+ */
+static inline void normalizeStore16(uint8x16_t v, float32x4_t s, float32x4_t b, float *dst)
+{
+    uint16x8_t lo = vmovl_u8(vget_low_u8(v)), hi = vmovl_u8(vget_high_u8(v));
+    vst1q_f32(dst, vmlaq_f32(b, vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), s));
+    vst1q_f32(dst + 4, vmlaq_f32(b, vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), s));
+    vst1q_f32(dst + 8, vmlaq_f32(b, vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), s));
+    vst1q_f32(dst + 12, vmlaq_f32(b, vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), s));
+}
+
+#if defined(__aarch64__)
+
+/**
+ * @brief 将 16 个 `uchar` 像素完成乘加标准化与量化后以 `int8` 写入目标平面
+ * @note 舍入转换 `vcvtnq` 为 AArch64 指令，32 位 ARM 回退至标量路径
+ *
+ * @param[in] v 16 个像素值
+ * @param[in] s 融合标准化与量化的系数
+ * @param[in] b 融合标准化与量化的偏置
+ * @param[out] dst 目标平面首地址
+ */
+static inline void quantizeStore16(uint8x16_t v, float32x4_t s, float32x4_t b, int8_t *dst)
+{
+    uint16x8_t lo = vmovl_u8(vget_low_u8(v)), hi = vmovl_u8(vget_high_u8(v));
+    int32x4_t q0 = vcvtnq_s32_f32(vmlaq_f32(b, vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), s));
+    int32x4_t q1 = vcvtnq_s32_f32(vmlaq_f32(b, vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), s));
+    int32x4_t q2 = vcvtnq_s32_f32(vmlaq_f32(b, vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), s));
+    int32x4_t q3 = vcvtnq_s32_f32(vmlaq_f32(b, vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), s));
+    int8x8_t qa = vqmovn_s16(vcombine_s16(vqmovn_s32(q0), vqmovn_s32(q1)));
+    int8x8_t qb = vqmovn_s16(vcombine_s16(vqmovn_s32(q2), vqmovn_s32(q3)));
+    vst1q_s8(dst, vcombine_s8(qa, qb));
+}
+
+#endif
+
+#endif
+
+#if defined(__AVX2__)
+// 16 像素（48 字节）为一组，3 次 pshufb 拆出 B、G、R 各 16 个像素
+static const __m128i mb_a = _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+static const __m128i mb_b = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1);
+static const __m128i mb_c = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13);
+static const __m128i mg_a = _mm_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+static const __m128i mg_b = _mm_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1);
+static const __m128i mg_c = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14);
+static const __m128i mr_a = _mm_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+static const __m128i mr_b = _mm_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1);
+static const __m128i mr_c = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15);
+#endif
+
+/**
+ * @brief 对一段连续的 `BGR` 交织像素做融合的标准化与平面转置
+ *
+ * @param[in] src 像素数据首地址
+ * @param[in] n 像素个数
+ * @param[in] scales 各通道标准化系数，按 `RGB` 平面顺序排列
+ * @param[in] biases 各通道标准化偏置，按 `RGB` 平面顺序排列
+ * @param[out] pr `R` 平面写入地址
+ * @param[out] pg `G` 平面写入地址
+ * @param[out] pb `B` 平面写入地址
+ */
+static void normalizeRowBGR(const uchar *src, int n, const float *scales, const float *biases, float *pr, float *pg, float *pb)
+{
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256 sr = _mm256_set1_ps(scales[0]), br = _mm256_set1_ps(biases[0]);
+    const __m256 sg = _mm256_set1_ps(scales[1]), bg = _mm256_set1_ps(biases[1]);
+    const __m256 sb = _mm256_set1_ps(scales[2]), bb = _mm256_set1_ps(biases[2]);
+    for (; i + 16 <= n; i += 16, src += 48)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 16));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 32));
+        __m128i vb = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, mb_a), _mm_shuffle_epi8(b, mb_b)), _mm_shuffle_epi8(c, mb_c));
+        __m128i vg = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, mg_a), _mm_shuffle_epi8(b, mg_b)), _mm_shuffle_epi8(c, mg_c));
+        __m128i vr = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, mr_a), _mm_shuffle_epi8(b, mr_b)), _mm_shuffle_epi8(c, mr_c));
+        normalizeStore16(vr, sr, br, pr + i);
+        normalizeStore16(vg, sg, bg, pg + i);
+        normalizeStore16(vb, sb, bb, pb + i);
+    }
+#elif defined(__ARM_NEON)
+    // vld3q_u8 一次交织加载即完成 16 像素的 B、G、R 拆分
+    const float32x4_t sr = vdupq_n_f32(scales[0]), br = vdupq_n_f32(biases[0]);
+    const float32x4_t sg = vdupq_n_f32(scales[1]), bg = vdupq_n_f32(biases[1]);
+    const float32x4_t sb = vdupq_n_f32(scales[2]), bb = vdupq_n_f32(biases[2]);
+    for (; i + 16 <= n; i += 16, src += 48)
+    {
+        uint8x16x3_t bgr = vld3q_u8(src);
+        normalizeStore16(bgr.val[2], sr, br, pr + i);
+        normalizeStore16(bgr.val[1], sg, bg, pg + i);
+        normalizeStore16(bgr.val[0], sb, bb, pb + i);
+    }
+#endif
+    for (; i < n; i++, src += 3)
+    {
+        pr[i] = src[2] * scales[0] + biases[0];
+        pg[i] = src[1] * scales[1] + biases[1];
+        pb[i] = src[0] * scales[2] + biases[2];
+    }
+}
+
+/**
+ * @brief 对一段连续的灰度像素做融合的标准化
+ *
+ * @param[in] src 像素数据首地址
+ * @param[in] n 像素个数
+ * @param[in] scale 标准化系数
+ * @param[in] bias 标准化偏置
+ * @param[out] dst 目标平面写入地址
+ */
+static void normalizeRowGray(const uchar *src, int n, float scale, float bias, float *dst)
+{
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256 s = _mm256_set1_ps(scale), b = _mm256_set1_ps(bias);
+    for (; i + 16 <= n; i += 16)
+        normalizeStore16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)), s, b, dst + i);
+#elif defined(__ARM_NEON)
+    const float32x4_t s = vdupq_n_f32(scale), b = vdupq_n_f32(bias);
+    for (; i + 16 <= n; i += 16)
+        normalizeStore16(vld1q_u8(src + i), s, b, dst + i);
+#endif
+    for (; i < n; i++)
+        dst[i] = src[i] * scale + bias;
 }
 
 /**
  * @brief 从 `NHWC` 格式的 `BGR` 图像生成 `NCHW` 格式的输入 `Tensor`
+ * @note 归一化与标准化合并为一次乘加，与平面转置在单趟遍历内完成，源图像数据就地读取，
+ *       包装相机 SDK 缓冲区的 `cv::Mat` 无需任何中间拷贝
  *
  * @param[in] input_image 输入图像
  * @param[in] means 3 通道各自的均值
  * @param[in] stds 3 通道各自的标准差
- * @param[out] iarray `NCHW` 格式的输入 `Tensor`
+ * @param[out] p_input_array `NCHW` 格式的输入 `Tensor` 数据首地址
  */
-static void imageToVector(const cv::Mat &input_image, const std::vector<float> &means, const std::vector<float> &stds, std::vector<float> &iarray)
+static void imageToVector(const cv::Mat &input_image, const std::vector<float> &means, const std::vector<float> &stds, float *p_input_array)
 {
     int H{input_image.rows}, W{input_image.cols};
-    RMVL_DbgAssert(static_cast<std::size_t>(3 * H * W) == iarray.size());
     RMVL_Assert(means.size() == 3 && stds.size() == 3);
-    // 转 Tensor 的 NCHW 格式，做归一化和标准化
-    float *p_input_array = iarray.data();
+    // (x / 255 - mean) / std 合并为 x * scale + bias
+    float scales[3]{}, biases[3]{};
     for (int c = 0; c < 3; c++)
+        scales[c] = 1.f / (255.f * stds[c]), biases[c] = -means[c] / stds[c];
+    float *pr = p_input_array, *pg = p_input_array + H * W, *pb = p_input_array + 2 * H * W;
+    if (input_image.isContinuous())
+        normalizeRowBGR(input_image.ptr<uchar>(0), H * W, scales, biases, pr, pg, pb);
+    else
         for (int h = 0; h < H; h++)
-            for (int w = 0; w < W; w++)
-                p_input_array[c * H * W + h * W + w] = (input_image.at<uchar>(h, w * 3 + 2 - c) / 255.f - means[c]) / stds[c];
+            normalizeRowBGR(input_image.ptr<uchar>(h), W, scales, biases, pr + h * W, pg + h * W, pb + h * W);
 }
 
 /**
  * @brief 从 `NHWC` 格式的灰度图像生成 `NCHW` 格式的输入 `Tensor`
+ * @note 归一化与标准化合并为一次乘加，源图像数据就地读取，包装相机 SDK 缓冲区的
+ *       `cv::Mat` 无需任何中间拷贝
  *
  * @param[in] input_image 输入图像
  * @param[in] mean 均值
  * @param[in] std 标准差
- * @param[out] iarray `NCHW` 格式的输入 `Tensor`
+ * @param[out] p_input_array `NCHW` 格式的输入 `Tensor` 数据首地址
  */
-static void imageToVector(const cv::Mat &input_image, float mean, float std, std::vector<float> &iarray)
+static void imageToVector(const cv::Mat &input_image, float mean, float std, float *p_input_array)
 {
     int H{input_image.rows}, W{input_image.cols};
-    RMVL_DbgAssert(static_cast<std::size_t>(H * W) == iarray.size());
-    // 转 Tensor 的 NCHW 格式，做归一化和标准化
-    float *p_input_array = iarray.data();
-    for (int h = 0; h < H; h++)
-        for (int w = 0; w < W; w++)
-            p_input_array[h * W + w] = (input_image.at<uchar>(h, w) / 255.f - mean) / std;
+    float scale = 1.f / (255.f * std), bias = -mean / std;
+    if (input_image.isContinuous())
+        normalizeRowGray(input_image.ptr<uchar>(0), H * W, scale, bias, p_input_array);
+    else
+        for (int h = 0; h < H; h++)
+            normalizeRowGray(input_image.ptr<uchar>(h), W, scale, bias, p_input_array + h * W);
+}
+
+/**
+ * @brief 对一段连续的 `BGR` 交织像素做融合的标准化、量化与平面转置
+ *
+ * @param[in] src 像素数据首地址
+ * @param[in] n 像素个数
+ * @param[in] scales 融合标准化与量化的各通道系数，按 `RGB` 平面顺序排列
+ * @param[in] biases 融合标准化与量化的各通道偏置，按 `RGB` 平面顺序排列
+ * @param[out] pr `R` 平面写入地址
+ * @param[out] pg `G` 平面写入地址
+ * @param[out] pb `B` 平面写入地址
+ */
+static void quantizeRowBGR(const uchar *src, int n, const float *scales, const float *biases, int8_t *pr, int8_t *pg, int8_t *pb)
+{
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256 sr = _mm256_set1_ps(scales[0]), br = _mm256_set1_ps(biases[0]);
+    const __m256 sg = _mm256_set1_ps(scales[1]), bg = _mm256_set1_ps(biases[1]);
+    const __m256 sb = _mm256_set1_ps(scales[2]), bb = _mm256_set1_ps(biases[2]);
+    for (; i + 16 <= n; i += 16, src += 48)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 16));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 32));
+        __m128i vb = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, mb_a), _mm_shuffle_epi8(b, mb_b)), _mm_shuffle_epi8(c, mb_c));
+        __m128i vg = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, mg_a), _mm_shuffle_epi8(b, mg_b)), _mm_shuffle_epi8(c, mg_c));
+        __m128i vr = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, mr_a), _mm_shuffle_epi8(b, mr_b)), _mm_shuffle_epi8(c, mr_c));
+        quantizeStore16(vr, sr, br, pr + i);
+        quantizeStore16(vg, sg, bg, pg + i);
+        quantizeStore16(vb, sb, bb, pb + i);
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const float32x4_t sr = vdupq_n_f32(scales[0]), br = vdupq_n_f32(biases[0]);
+    const float32x4_t sg = vdupq_n_f32(scales[1]), bg = vdupq_n_f32(biases[1]);
+    const float32x4_t sb = vdupq_n_f32(scales[2]), bb = vdupq_n_f32(biases[2]);
+    for (; i + 16 <= n; i += 16, src += 48)
+    {
+        uint8x16x3_t bgr = vld3q_u8(src);
+        quantizeStore16(bgr.val[2], sr, br, pr + i);
+        quantizeStore16(bgr.val[1], sg, bg, pg + i);
+        quantizeStore16(bgr.val[0], sb, bb, pb + i);
+    }
+#endif
+    for (; i < n; i++, src += 3)
+    {
+        pr[i] = static_cast<int8_t>(std::clamp<long>(std::lround(src[2] * scales[0] + biases[0]), -128, 127));
+        pg[i] = static_cast<int8_t>(std::clamp<long>(std::lround(src[1] * scales[1] + biases[1]), -128, 127));
+        pb[i] = static_cast<int8_t>(std::clamp<long>(std::lround(src[0] * scales[2] + biases[2]), -128, 127));
+    }
+}
+
+/**
+ * @brief 对一段连续的灰度像素做融合的标准化与量化
+ *
+ * @param[in] src 像素数据首地址
+ * @param[in] n 像素个数
+ * @param[in] scale 融合标准化与量化的系数
+ * @param[in] bias 融合标准化与量化的偏置
+ * @param[out] dst 目标平面写入地址
+ */
+static void quantizeRowGray(const uchar *src, int n, float scale, float bias, int8_t *dst)
+{
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256 s = _mm256_set1_ps(scale), b = _mm256_set1_ps(bias);
+    for (; i + 16 <= n; i += 16)
+        quantizeStore16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)), s, b, dst + i);
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const float32x4_t s = vdupq_n_f32(scale), b = vdupq_n_f32(bias);
+    for (; i + 16 <= n; i += 16)
+        quantizeStore16(vld1q_u8(src + i), s, b, dst + i);
+#endif
+    for (; i < n; i++)
+        dst[i] = static_cast<int8_t>(std::clamp<long>(std::lround(src[i] * scale + bias), -128, 127));
+}
+
+/**
+ * @brief 从 `NHWC` 格式的 `BGR` 图像直接生成 `NCHW` 格式的 `int8` 输入 `Tensor`
+ * @note 归一化、标准化与量化合并为一次乘加，不产生中间的 `float` 平面
+ *
+ * @param[in] input_image 输入图像
+ * @param[in] means 3 通道各自的均值
+ * @param[in] stds 3 通道各自的标准差
+ * @param[in] qscale 输入量化系数
+ * @param[in] qzero 输入量化零点
+ * @param[out] p_input_array `NCHW` 格式的 `int8` 输入 `Tensor` 数据首地址
+ */
+static void imageToQuantVector(const cv::Mat &input_image, const std::vector<float> &means, const std::vector<float> &stds,
+                               float qscale, int qzero, int8_t *p_input_array)
+{
+    int H{input_image.rows}, W{input_image.cols};
+    RMVL_Assert(means.size() == 3 && stds.size() == 3);
+    // ((x / 255 - mean) / std) / qscale + qzero 合并为 x * scale + bias
+    float scales[3]{}, biases[3]{};
+    for (int c = 0; c < 3; c++)
+        scales[c] = 1.f / (255.f * stds[c] * qscale), biases[c] = qzero - means[c] / (stds[c] * qscale);
+    int8_t *pr = p_input_array, *pg = p_input_array + H * W, *pb = p_input_array + 2 * H * W;
+    if (input_image.isContinuous())
+        quantizeRowBGR(input_image.ptr<uchar>(0), H * W, scales, biases, pr, pg, pb);
+    else
+        for (int h = 0; h < H; h++)
+            quantizeRowBGR(input_image.ptr<uchar>(h), W, scales, biases, pr + h * W, pg + h * W, pb + h * W);
+}
+
+/**
+ * @brief 从 `NHWC` 格式的灰度图像直接生成 `NCHW` 格式的 `int8` 输入 `Tensor`
+ * @note 归一化、标准化与量化合并为一次乘加，不产生中间的 `float` 平面
+ *
+ * @param[in] input_image 输入图像
+ * @param[in] mean 均值
+ * @param[in] std 标准差
+ * @param[in] qscale 输入量化系数
+ * @param[in] qzero 输入量化零点
+ * @param[out] p_input_array `NCHW` 格式的 `int8` 输入 `Tensor` 数据首地址
+ */
+static void imageToQuantVector(const cv::Mat &input_image, float mean, float std, float qscale, int qzero, int8_t *p_input_array)
+{
+    int H{input_image.rows}, W{input_image.cols};
+    float scale = 1.f / (255.f * std * qscale), bias = qzero - mean / (std * qscale);
+    if (input_image.isContinuous())
+        quantizeRowGray(input_image.ptr<uchar>(0), H * W, scale, bias, p_input_array);
+    else
+        for (int h = 0; h < H; h++)
+            quantizeRowGray(input_image.ptr<uchar>(h), W, scale, bias, p_input_array + h * W);
 }
 
 std::vector<Ort::Value> ClassificationNet::preProcess(const std::vector<cv::Mat> &images, const PreprocessOptions &options)
 {
     std::size_t input_count = _session->GetInputCount();
-    RMVL_Assert(input_count == 1 && images.size() == 1);
+    RMVL_Assert(input_count == 1 && !images.empty());
     // 获取输入层 Tensor
     std::vector<Ort::Value> input_tensors;
-    const cv::Mat &img = images.front();
     // 合法性检查
     auto shape = _session->GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
     RMVL_Assert(shape.size() == 4);
-    if (shape[1] != img.channels() || shape[2] != img.rows || shape[3] != img.cols)
-        RMVL_Error_(RMVL_StsBadSize, "image (%d, %d, %d) unequal to shape (%d, %d, %d).",
-                    img.channels(), img.rows, img.cols, shape[1], shape[2], shape[3]);
     RMVL_Assert(shape[1] == 3 || shape[1] == 1);
-    shape[0] = 1;
-    // img -> iarray
+    for (const auto &img : images)
+        if (shape[1] != img.channels() || shape[2] != img.rows || shape[3] != img.cols)
+            RMVL_Error_(RMVL_StsBadSize, "image (%d, %d, %d) unequal to shape (%d, %d, %d).",
+                        img.channels(), img.rows, img.cols, shape[1], shape[2], shape[3]);
+    // 多张图像堆叠为一个批量 Tensor，要求模型的批维度为动态维度
+    if (images.size() > 1 && shape[0] > 0 && shape[0] != static_cast<int64_t>(images.size()))
+        RMVL_Error_(RMVL_StsBadArg, "batch size %zu unequal to the fixed batch dimension %d of the model.",
+                    images.size(), static_cast<int>(shape[0]));
+    shape[0] = static_cast<int64_t>(images.size());
+    // images -> iarray
     RMVL_Assert(!options.means.empty() && !options.stds.empty());
-    if (shape[1] == 3)
-        imageToVector(img, options.means, options.stds, _iarrays.front());
-    else
-        imageToVector(img, options.means.front(), options.stds.front(), _iarrays.front());
+    const std::size_t stride = static_cast<std::size_t>(shape[1] * shape[2] * shape[3]);
+    // INT8 量化模型：标准化与量化融合为一次乘加，直接生成 int8 输入 Tensor
+    if (_input_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8)
+    {
+        if (_iscale <= 0.f)
+            RMVL_Error(RMVL_StsBadArg, "INT8 quantized model requires a calibration table, call \"loadCalibTable\" first.");
+        _qarray.resize(stride * images.size());
+        for (std::size_t i = 0; i < images.size(); ++i)
+        {
+            if (shape[1] == 3)
+                imageToQuantVector(images[i], options.means, options.stds, _iscale, _izero, _qarray.data() + i * stride);
+            else
+                imageToQuantVector(images[i], options.means.front(), options.stds.front(), _iscale, _izero, _qarray.data() + i * stride);
+        }
+        input_tensors.emplace_back(Ort::Value::CreateTensor<int8_t>(
+            _memory_info, _qarray.data(), _qarray.size(), shape.data(), shape.size()));
+        return input_tensors;
+    }
+    else if (_input_type != ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT)
+        RMVL_Error(RMVL_StsBadArg, "Unsupported input element type, only \"float\" and \"int8\" are supported.");
+    auto &iarray = _iarrays.front();
+    iarray.resize(stride * images.size());
+    for (std::size_t i = 0; i < images.size(); ++i)
+    {
+        if (shape[1] == 3)
+            imageToVector(images[i], options.means, options.stds, iarray.data() + i * stride);
+        else
+            imageToVector(images[i], options.means.front(), options.stds.front(), iarray.data() + i * stride);
+    }
     // 更新每个输入层的数据
     input_tensors.emplace_back(Ort::Value::CreateTensor<float>(
-        _memory_info, _iarrays.front().data(), _iarrays.front().size(), shape.data(), shape.size()));
+        _memory_info, iarray.data(), iarray.size(), shape.data(), shape.size()));
+
+    return input_tensors;
+}
 
+std::vector<Ort::Value> ClassificationNet::preProcess(const RoiBatch &batch, const PreprocessOptions &options)
+{
+    RMVL_Assert(_session->GetInputCount() == 1 && !batch.empty());
+    std::vector<Ort::Value> input_tensors;
+    // 合法性检查
+    auto shape = _session->GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+    RMVL_Assert(shape.size() == 4);
+    RMVL_Assert(shape[1] == 3 || shape[1] == 1);
+    if (shape[1] != batch.channels() || shape[2] != batch.imageSize().height || shape[3] != batch.imageSize().width)
+        RMVL_Error_(RMVL_StsBadSize, "batch slot (%d, %d, %d) unequal to shape (%d, %d, %d).",
+                    batch.channels(), batch.imageSize().height, batch.imageSize().width,
+                    static_cast<int>(shape[1]), static_cast<int>(shape[2]), static_cast<int>(shape[3]));
+    if (batch.size() > 1 && shape[0] > 0 && shape[0] != static_cast<int64_t>(batch.size()))
+        RMVL_Error_(RMVL_StsBadArg, "batch size %zu unequal to the fixed batch dimension %d of the model.",
+                    batch.size(), static_cast<int>(shape[0]));
+    shape[0] = static_cast<int64_t>(batch.size());
+    RMVL_Assert(!options.means.empty() && !options.stds.empty());
+    const std::size_t stride = static_cast<std::size_t>(shape[1] * shape[2] * shape[3]);
+    // 槽位在暂存缓冲区内连续排布，单通道槽位的 HWC 与 CHW 布局一致，将整个批量包装为
+    // 一幅竖直拼接的图像，标准化（量化）在单趟遍历内完成；3 通道槽位的平面转置按槽位
+    // 视图逐一执行，均不产生中间的图像拷贝
+    cv::Mat stacked(static_cast<int>(batch.size() * shape[2]), static_cast<int>(shape[3]),
+                    CV_8UC1, const_cast<uchar *>(batch.data()));
+    // INT8 量化模型：标准化与量化融合为一次乘加，直接生成 int8 输入 Tensor
+    if (_input_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8)
+    {
+        if (_iscale <= 0.f)
+            RMVL_Error(RMVL_StsBadArg, "INT8 quantized model requires a calibration table, call \"loadCalibTable\" first.");
+        _qarray.resize(stride * batch.size());
+        if (shape[1] == 1)
+            imageToQuantVector(stacked, options.means.front(), options.stds.front(), _iscale, _izero, _qarray.data());
+        else
+            for (std::size_t i = 0; i < batch.size(); ++i)
+                imageToQuantVector(batch.at(i), options.means, options.stds, _iscale, _izero, _qarray.data() + i * stride);
+        input_tensors.emplace_back(Ort::Value::CreateTensor<int8_t>(
+            _memory_info, _qarray.data(), _qarray.size(), shape.data(), shape.size()));
+        return input_tensors;
+    }
+    else if (_input_type != ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT)
+        RMVL_Error(RMVL_StsBadArg, "Unsupported input element type, only \"float\" and \"int8\" are supported.");
+    auto &iarray = _iarrays.front();
+    iarray.resize(stride * batch.size());
+    if (shape[1] == 1)
+        imageToVector(stacked, options.means.front(), options.stds.front(), iarray.data());
+    else
+        for (std::size_t i = 0; i < batch.size(); ++i)
+            imageToVector(batch.at(i), options.means, options.stds, iarray.data() + i * stride);
+    input_tensors.emplace_back(Ort::Value::CreateTensor<float>(
+        _memory_info, iarray.data(), iarray.size(), shape.data(), shape.size()));
     return input_tensors;
 }
 
-std::any ClassificationNet::postProcess(const std::vector<Ort::Value> &output_tensors, const PostprocessOptions &)
+//! 获取指定类别标签的置信度阈值，长度为 1 时作为全局阈值，为空时不做阈值过滤
+static inline float threshAt(const std::vector<float> &thresh, int label)
+{
+    if (thresh.empty())
+        return std::numeric_limits<float>::lowest();
+    return thresh.size() == 1 ? thresh.front() : thresh[static_cast<std::size_t>(label) % thresh.size()];
+}
+
+/**
+ * @brief 对单行输出执行融合的 argmax-softmax-阈值后处理
+ * @note softmax 最大值的归一化结果为 \f$1/\sum_ie^{x_i-x_{max}}\f$，求和与取最大值均为
+ *       单趟遍历，不写回任何中间概率
+ *
+ * @param[in] row 行数据首地址
+ * @param[in] classes 类别数
+ * @param[in] postop 后处理选项
+ * @param[in] dequant 置信度反量化可调用对象，`float` 输出时为恒等映射
+ * @return 分类结果及其置信度，置信度低于阈值时标签置为 `-1`
+ */
+template <typename Tp, typename Dequant>
+static std::pair<int, float> parseRowTop1(const Tp *row, std::size_t classes, const PostprocessOptions &postop, Dequant dequant)
+{
+    auto maxit = std::max_element(row, row + classes);
+    int label = static_cast<int>(maxit - row);
+    float conf = dequant(*maxit);
+    if (postop.softmax)
+    {
+        float sum{};
+        for (std::size_t j = 0; j < classes; ++j)
+            sum += std::exp(dequant(row[j]) - conf);
+        conf = 1.f / sum;
+    }
+    return {conf < threshAt(postop.thresh, label) ? -1 : label, conf};
+}
+
+/**
+ * @brief 对单行输出执行融合的 softmax-top-k-阈值后处理
+ *
+ * @param[in] probs 行概率（或原始置信度）首地址
+ * @param[in] k top-k 的结果个数
+ * @param[in] thresh 置信度阈值向量
+ * @param[in,out] idx 复用的下标数组，长度为类别数
+ * @return 按置信度降序排列的分类结果列表，低于阈值的条目已被滤除
+ */
+static std::vector<std::pair<int, float>> parseRowTopK(const float *probs, std::size_t k,
+                                                       const std::vector<float> &thresh, std::vector<int> &idx)
+{
+    std::iota(idx.begin(), idx.end(), 0);
+    std::partial_sort(idx.begin(), idx.begin() + k, idx.end(), [probs](int lhs, int rhs) { return probs[lhs] > probs[rhs]; });
+    std::vector<std::pair<int, float>> result;
+    result.reserve(k);
+    for (std::size_t j = 0; j < k; ++j)
+        if (probs[idx[j]] >= threshAt(thresh, idx[j]))
+            result.emplace_back(idx[j], probs[idx[j]]);
+    return result;
+}
+
+/**
+ * @brief 输出 Tensor 数据逐行执行融合的后处理核，解析为分类结果
+ *
+ * @param[in] output 输出 Tensor 数据首地址
+ * @param[in] inplace 可写的输出 Tensor 数据首地址，`float` 输出层的 softmax 概率就地
+ *                    写回该缓冲区，传入空指针时经由临时行缓冲区计算
+ * @param[in] size 输出 Tensor 元素总数
+ * @param[in] batch 批量大小
+ * @param[in] postop 后处理选项
+ * @param[in] dequant 置信度反量化可调用对象，`float` 输出时为恒等映射
+ * @return 用 `std::any` 表示的分类结果
+ */
+template <typename Tp, typename Dequant>
+static std::any parseOutput(const Tp *output, float *inplace, std::size_t size, std::size_t batch, const PostprocessOptions &postop, Dequant dequant)
+{
+    const std::size_t rows = batch < 1 ? 1 : batch;
+    const std::size_t classes = size / rows;
+    // top-1 路径无需物化概率，单张图像保持原有的 std::pair 返回形式
+    if (postop.topk <= 1)
+    {
+        if (batch <= 1)
+            return parseRowTop1(output, classes, postop, dequant);
+        std::vector<std::pair<int, float>> results(rows);
+        for (std::size_t i = 0; i < rows; ++i)
+            results[i] = parseRowTop1(output + i * classes, classes, postop, dequant);
+        return results;
+    }
+    // top-k 路径需要整行概率，float 输出层直接以 Ort 输出缓冲区为就地存储
+    const std::size_t k = std::min<std::size_t>(postop.topk, classes);
+    std::vector<float> scratch;
+    if (inplace == nullptr)
+        scratch.resize(classes);
+    std::vector<int> idx(classes);
+    std::vector<std::vector<std::pair<int, float>>> results(rows);
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        const Tp *row = output + i * classes;
+        float *probs = inplace == nullptr ? scratch.data() : inplace + i * classes;
+        if (postop.softmax)
+        {
+            float vmax = dequant(*std::max_element(row, row + classes));
+            float sum{};
+            for (std::size_t j = 0; j < classes; ++j)
+                sum += probs[j] = std::exp(dequant(row[j]) - vmax);
+            float inv_sum = 1.f / sum;
+            for (std::size_t j = 0; j < classes; ++j)
+                probs[j] *= inv_sum;
+        }
+        else
+            for (std::size_t j = 0; j < classes; ++j)
+                probs[j] = dequant(row[j]);
+        results[i] = parseRowTopK(probs, k, postop.thresh, idx);
+    }
+    if (batch <= 1)
+        return results.front();
+    return results;
+}
+
+std::any ClassificationNet::postProcess(const std::vector<Ort::Value> &output_tensors, const PostprocessOptions &postop)
 {
     RMVL_Assert(output_tensors.size() == 1);
     auto &output_tensor = output_tensors.front();
-    const float *output = output_tensor.GetTensorData<float>();
-    std::size_t size{output_tensor.GetTensorTypeAndShapeInfo().GetElementCount()};
-    auto maxit = std::max_element(output, output + size);
-    return std::make_pair(maxit - output, *maxit);
+    auto info = output_tensor.GetTensorTypeAndShapeInfo();
+    auto oshape = info.GetShape();
+    std::size_t size{info.GetElementCount()};
+    std::size_t batch = (!oshape.empty() && oshape.front() > 0) ? static_cast<std::size_t>(oshape.front()) : 1;
+    // 未经反量化的 int8 输出层按输出量化参数恢复置信度，argmax 单调性不受量化影响
+    if (info.GetElementType() == ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8)
+        return parseOutput(output_tensor.GetTensorData<int8_t>(), nullptr, size, batch, postop,
+                           [this](int8_t val) { return _oscale * (val - _ozero); });
+    float *data = const_cast<Ort::Value &>(output_tensor).GetTensorMutableData<float>();
+    return parseOutput(static_cast<const float *>(data), data, size, batch, postop, [](float val) { return val; });
+}
+
+bool ClassificationNet::loadCalibTable(std::string_view table_path)
+{
+    std::ifstream ifs((std::string(table_path)));
+    if (!ifs.is_open())
+        return false;
+    float iscale{}, oscale{1.f};
+    int izero{}, ozero{};
+    std::string tag;
+    while (ifs >> tag)
+    {
+        if (tag == "input:" && !(ifs >> iscale >> izero))
+            return false;
+        else if (tag == "output:" && !(ifs >> oscale >> ozero))
+            return false;
+    }
+    if (iscale <= 0.f)
+        return false;
+    _iscale = iscale, _izero = izero, _oscale = oscale, _ozero = ozero;
+    return true;
+}
+
+bool ClassificationNet::calibrate(const std::vector<cv::Mat> &images, const PreprocessOptions &preop, std::string_view table_path)
+{
+    if (images.empty() || preop.means.empty() || preop.stds.empty())
+        return false;
+    // min-max 扫描标准化后的激活范围
+    float vmin = std::numeric_limits<float>::max(), vmax = std::numeric_limits<float>::lowest();
+    for (const auto &img : images)
+    {
+        if (img.empty() || (img.channels() != 1 && img.channels() != 3))
+            return false;
+        const int cns = img.channels();
+        if (cns == 3 && (preop.means.size() < 3 || preop.stds.size() < 3))
+            return false;
+        for (int h = 0; h < img.rows; ++h)
+        {
+            const uchar *ptr = img.ptr<uchar>(h);
+            for (int w = 0; w < img.cols * cns; ++w)
+            {
+                // BGR 交织存储对应 RGB 预处理选项的通道下标
+                int c = cns == 3 ? 2 - w % 3 : 0;
+                float val = (ptr[w] / 255.f - preop.means[c]) / preop.stds[c];
+                vmin = std::min(vmin, val), vmax = std::max(vmax, val);
+            }
+        }
+    }
+    // 非对称 min-max 量化，范围包含 0 以保证零值可精确表示
+    vmin = std::min(vmin, 0.f), vmax = std::max(vmax, 0.f);
+    float scale = (vmax - vmin) / 255.f;
+    if (scale <= 0.f)
+        return false;
+    int zero = static_cast<int>(std::clamp<long>(std::lround(-128 - vmin / scale), -128, 127));
+    std::ofstream ofs((std::string(table_path)));
+    if (!ofs.is_open())
+        return false;
+    ofs << "input: " << scale << ' ' << zero << '\n';
+    return true;
+}
+
+std::vector<std::any> ClassificationNet::unbatch(const std::any &result, std::size_t batch) const
+{
+    if (batch == 1)
+        return {result};
+    std::vector<std::any> retval;
+    // top-k 批量结果的元素为 top-k 列表，其余为 argmax 结果
+    if (auto topk = std::any_cast<std::vector<std::vector<std::pair<int, float>>>>(&result))
+    {
+        retval.reserve(topk->size());
+        for (const auto &res : *topk)
+            retval.emplace_back(res);
+        return retval;
+    }
+    auto results = castBatch(result);
+    retval.reserve(results.size());
+    for (const auto &res : results)
+        retval.emplace_back(res);
+    return retval;
 }
 
 } // namespace rm
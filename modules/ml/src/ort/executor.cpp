@@ -0,0 +1,97 @@
+/**
+ * @file executor.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 多线程推理执行器
+ * @version 1.0
+ * @date 2026-08-28
+ *
+ * @copyright Copyright 2026 (c), zhaoxi
+ *
+ */
+
+#include <algorithm>
+
+#include "rmvl/core/util.hpp"
+#include "rmvl/ml/ort.h"
+
+namespace rm
+{
+
+InferenceExecutor::InferenceExecutor(std::unique_ptr<OnnxNet> net, const PreprocessOptions &preop, const PostprocessOptions &postop,
+                                     std::chrono::microseconds budget, std::size_t max_batch)
+    : _net(std::move(net)), _preop(preop), _postop(postop), _budget(budget), _max_batch(std::max<std::size_t>(max_batch, 1))
+{
+    if (_net == nullptr)
+        RMVL_Error(RMVL_StsNullPtr, "The inference net is null!");
+    _worker = std::thread(&InferenceExecutor::run, this);
+}
+
+InferenceExecutor::~InferenceExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lk(_mtx);
+        _stop = true;
+    }
+    _cv.notify_all();
+    if (_worker.joinable())
+        _worker.join();
+}
+
+std::future<std::any> InferenceExecutor::submit(const cv::Mat &image)
+{
+    std::future<std::any> retval;
+    {
+        std::lock_guard<std::mutex> lk(_mtx);
+        _requests.emplace_back();
+        _requests.back().image = image;
+        retval = _requests.back().prom.get_future();
+    }
+    _cv.notify_one();
+    return retval;
+}
+
+void InferenceExecutor::run()
+{
+    std::unique_lock<std::mutex> lk(_mtx);
+    while (true)
+    {
+        _cv.wait(lk, [this] { return _stop || !_requests.empty(); });
+        if (_requests.empty())
+            break;
+        // 在延迟预算内聚合微批，直至达到批量上限
+        auto deadline = std::chrono::steady_clock::now() + _budget;
+        _cv.wait_until(lk, deadline, [this] { return _stop || _requests.size() >= _max_batch; });
+        std::vector<Request> batch;
+        std::size_t n = std::min(_requests.size(), _max_batch);
+        batch.reserve(n);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            batch.emplace_back(std::move(_requests.front()));
+            _requests.pop_front();
+        }
+        lk.unlock();
+        std::vector<cv::Mat> images(batch.size());
+        for (std::size_t i = 0; i < batch.size(); i++)
+            images[i] = batch[i].image;
+        try
+        {
+            auto result = _net->inference(images, _preop, _postop);
+            auto results = _net->unbatch(result, images.size());
+            if (results.size() == batch.size())
+                for (std::size_t i = 0; i < batch.size(); i++)
+                    batch[i].prom.set_value(std::move(results[i]));
+            else
+                // 无法拆分批量结果时退化为逐张推理
+                for (auto &req : batch)
+                    req.prom.set_value(_net->inference({req.image}, _preop, _postop));
+        }
+        catch (...)
+        {
+            for (auto &req : batch)
+                req.prom.set_exception(std::current_exception());
+        }
+        lk.lock();
+    }
+}
+
+} // namespace rm
@@ -9,7 +9,22 @@
  *
  */
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "rmvl/ml/ort.h"
+#include "rmvl/core/tuner.hpp"
 #include "rmvl/core/util.hpp"
 
 namespace rm
@@ -18,31 +33,188 @@ namespace rm
 // 默认配置的内存分配器
 static Ort::AllocatorWithDefaultOptions alloc;
 
-OnnxNet::OnnxNet(std::string_view model_path, OrtProvider prov) : _memory_info(Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator, OrtMemType::OrtMemTypeDefault))
+/**
+ * @brief 计算模型文件内容的 FNV-1a 哈希，作为引擎缓存与提供者选优的键
+ *
+ * @param[in] model_path 模型路径
+ * @return 64 位哈希值
+ */
+static uint64_t modelHash(std::string_view model_path)
 {
-    if (model_path.empty())
-        RMVL_Error(RMVL_StsBadArg, "Model path empty!");
+    uint64_t hash = 0xcbf29ce484222325ull;
+    std::ifstream ifs(std::string(model_path), std::ios::binary);
+    char buf[4096];
+    while (true)
+    {
+        ifs.read(buf, sizeof(buf));
+        std::streamsize n = ifs.gcount();
+        if (n <= 0)
+            break;
+        for (std::streamsize i = 0; i < n; i++)
+            hash = (hash ^ static_cast<uint8_t>(buf[i])) * 0x100000001b3ull;
+    }
+    return hash;
+}
 
+/**
+ * @brief 获取引擎缓存路径，以「模型内容哈希 + 提供者配置」为键，模型更新后自动使用新的缓存目录
+ *
+ * @param[in] model_path 模型路径
+ * @param[in] tag 提供者配置标签
+ * @return 引擎缓存路径，目录不存在时自动创建
+ */
+static std::string engineCachePath(std::string_view model_path, std::string_view tag)
+{
+    std::ostringstream oss;
+    oss << tag << '_' << std::hex << std::setw(16) << std::setfill('0') << modelHash(model_path);
+    auto dir = std::filesystem::path(model_path).parent_path() / "ort_engine_cache" / oss.str();
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    return dir.string();
+}
+
+/**
+ * @brief 以只读共享映射方式加载文件
+ *
+ * @param[in] path 文件路径
+ * @retval data, size
+ * @return 文件内容的共享映射及其长度，映射失败或平台不支持时 `data` 为空
+ */
+static std::pair<std::shared_ptr<const void>, std::size_t> mapFile(const std::string &path)
+{
+#if !defined(_WIN32)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return {};
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        ::close(fd);
+        return {};
+    }
+    std::size_t size = static_cast<std::size_t>(st.st_size);
+    void *data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    // 映射建立后文件描述符即可关闭，不影响既有映射
+    ::close(fd);
+    if (data == MAP_FAILED)
+        return {};
+    return {std::shared_ptr<const void>(data, [size](const void *p) { ::munmap(const_cast<void *>(p), size); }), size};
+#else
+    (void)path;
+    return {};
+#endif
+}
+
+/**
+ * @brief 创建推理会话，模型文件经只读共享映射载入
+ * @brief
+ * - 模型内容由内核页缓存直接支撑，多个进程加载同一模型时共享物理页，
+ *   启动时也不产生逐字节读入堆内存的显式拷贝
+ * - 外部权重布局（模型旁存在同名 `.data` 附属文件）的权重文件同样以映射页直接供给会话，
+ *   onnxruntime 版本过低或映射失败时回退至默认的按路径加载
+ *
+ * @param[in] env 环境配置
+ * @param[in] model_path 模型路径
+ * @param[in] options 会话选项
+ * @param[out] maps 模型文件映射，需在会话生命周期内保持有效
+ * @return 推理会话
+ */
+static std::unique_ptr<Ort::Session> makeSession(Ort::Env &env, std::string_view model_path, Ort::SessionOptions &options, std::vector<std::shared_ptr<const void>> &maps)
+{
+    std::string path(model_path);
+    auto [model_data, model_size] = mapFile(path);
+    if (model_data == nullptr)
+        return std::make_unique<Ort::Session>(env, path.c_str(), options);
+    // 外部权重布局：从内存缓冲区创建会话时，模型内记录的相对路径无从解析，
+    // 需将附属权重文件一并映射并以内存缓冲区形式注册
+    auto external = std::filesystem::path(path).concat(".data");
+    std::error_code ec;
+    if (std::filesystem::exists(external, ec))
+    {
+#if ORT_API_VERSION >= 16
+        auto [ext_data, ext_size] = mapFile(external.string());
+        if (ext_data == nullptr)
+            return std::make_unique<Ort::Session>(env, path.c_str(), options);
+        std::vector<std::basic_string<ORTCHAR_T>> names{external.filename().native()};
+        std::vector<char *> buffers{const_cast<char *>(static_cast<const char *>(ext_data.get()))};
+        std::vector<std::size_t> lengths{ext_size};
+        options.AddExternalInitializersFromFilesInMemory(names, buffers, lengths);
+        maps.push_back(std::move(ext_data));
+#else
+        // 旧版 onnxruntime 不支持以内存缓冲区注册外部权重，回退至按路径加载
+        return std::make_unique<Ort::Session>(env, path.c_str(), options);
+#endif
+    }
+    auto session = std::make_unique<Ort::Session>(env, model_data.get(), model_size, options);
+    maps.push_back(std::move(model_data));
+    return session;
+}
+
+//! `OrtProvider::CUDA` 提供者的外部计算流
+static void *cuda_compute_stream{};
+
+void setOrtCudaStream(void *stream) { cuda_compute_stream = stream; }
+
+/**
+ * @brief 将提供者附加至会话选项
+ *
+ * @param[in] options 会话选项
+ * @param[in] prov Ort 提供者，不可为 `OrtProvider::Auto`
+ * @param[in] model_path 模型路径，用于派生引擎缓存路径
+ * @param[out] cache_dir 引擎缓存路径，需在会话构造完成前保持有效
+ */
+static void appendProvider(Ort::SessionOptions &options, OrtProvider prov, std::string_view model_path, std::string &cache_dir)
+{
     switch (prov)
     {
-    case OrtProvider::CUDA:
-        _session_options.AppendExecutionProvider_CUDA({});
+    case OrtProvider::CUDA: {
+        OrtCUDAProviderOptions cuda_options{};
+        if (cuda_compute_stream != nullptr)
+        {
+            // 与外部预处理共流，推理与预处理在同一 CUDA 流上顺序排队，无需设备级同步
+            cuda_options.has_user_compute_stream = 1;
+            cuda_options.user_compute_stream = cuda_compute_stream;
+        }
+        options.AppendExecutionProvider_CUDA(cuda_options);
         break;
-    case OrtProvider::TensorRT:
-        _session_options.AppendExecutionProvider_TensorRT({});
+    }
+    case OrtProvider::TensorRT: {
+        // 启用引擎缓存，避免每次启动重新编译引擎
+        cache_dir = engineCachePath(model_path, "trt");
+        OrtTensorRTProviderOptions trt_options{};
+        trt_options.trt_engine_cache_enable = 1;
+        trt_options.trt_engine_cache_path = cache_dir.c_str();
+        options.AppendExecutionProvider_TensorRT(trt_options);
         break;
+    }
     case OrtProvider::OpenVINO: {
-        OrtOpenVINOProviderOptions options;
-        options.device_type = "CPU_FP32";
-        _session_options.AppendExecutionProvider_OpenVINO(options);
+        OrtOpenVINOProviderOptions vino_options;
+        vino_options.device_type = "CPU_FP32";
+#if ORT_API_VERSION >= 13
+        // 启用已编译网络缓存，避免每次启动重新编译
+        cache_dir = engineCachePath(model_path, "vino");
+        vino_options.cache_dir = cache_dir.c_str();
+#endif
+        options.AppendExecutionProvider_OpenVINO(vino_options);
         break;
     }
     default:
         break;
     }
+}
+
+OnnxNet::OnnxNet(std::string_view model_path, OrtProvider prov) : _memory_info(Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator, OrtMemType::OrtMemTypeDefault))
+{
+    if (model_path.empty())
+        RMVL_Error(RMVL_StsBadArg, "Model path empty!");
+
+    // 自动模式：在各可用提供者中实测选出推理最快者
+    if (prov == OrtProvider::Auto)
+        prov = selectProvider(model_path);
+    appendProvider(_session_options, prov, model_path, _cache_dir);
 
     _session_options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
-    _session = std::make_unique<Ort::Session>(_env, model_path.data(), _session_options);
+    _session = makeSession(_env, model_path, _session_options, _model_maps);
 
     // 定义输入输出节点的名称
 #if ORT_API_VERSION < 12
@@ -58,13 +230,278 @@ OnnxNet::OnnxNet(std::string_view model_path, OrtProvider prov) : _memory_info(O
 #endif
 }
 
+OnnxNet::~OnnxNet()
+{
+    if (_reload_thread.joinable())
+        _reload_thread.join();
+}
+
+void OnnxNet::reload(std::string_view model_path)
+{
+    // 上一次热更新的后台线程先行回收，未被消费的新会话被下面的就绪标志复位丢弃
+    if (_reload_thread.joinable())
+        _reload_thread.join();
+    _pending_ready.store(false, std::memory_order_release);
+    _reload_thread = std::thread([this, path = std::string(model_path)] {
+        try
+        {
+            auto pending = std::make_unique<PendingSession>();
+            pending->session = makeSession(_env, path, _session_options, pending->maps);
+            for (std::size_t i = 0; i < pending->session->GetInputCount(); i++)
+#if ORT_API_VERSION < 12
+                pending->inames.emplace_back(pending->session->GetInputName(i, alloc));
+            for (std::size_t i = 0; i < pending->session->GetOutputCount(); i++)
+                pending->onames.emplace_back(pending->session->GetOutputName(i, alloc));
+#else
+                pending->inames.emplace_back(pending->session->GetInputNameAllocated(i, alloc));
+            for (std::size_t i = 0; i < pending->session->GetOutputCount(); i++)
+                pending->onames.emplace_back(pending->session->GetOutputNameAllocated(i, alloc));
+#endif
+            warmupPending(*pending);
+            std::lock_guard<std::mutex> lock(_pending_mutex);
+            _pending = std::move(pending);
+            _pending_ready.store(true, std::memory_order_release);
+        }
+        catch (const std::exception &e)
+        {
+            ERROR_("Failed to reload the model \"%s\": %s", path.c_str(), e.what());
+        }
+    });
+}
+
+void OnnxNet::warmupPending(PendingSession &pending)
+{
+    auto &session = *pending.session;
+    std::size_t icount = session.GetInputCount();
+    // 按输入层形状构造全零 Tensor 并直接调用新会话，要求各输入层为静态形状的
+    // float 类型 Tensor，动态批维度按 1 处理，不满足时跳过预热，切换不受影响
+    std::vector<std::vector<float>> buffers(icount);
+    std::vector<Ort::Value> itensors;
+    for (std::size_t i = 0; i < icount; i++)
+    {
+        auto info = session.GetInputTypeInfo(i).GetTensorTypeAndShapeInfo();
+        auto shape = info.GetShape();
+        if (shape.empty() || info.GetElementType() != ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT)
+            return;
+        if (shape.front() < 0)
+            shape.front() = 1;
+        if (std::any_of(shape.begin(), shape.end(), [](int64_t dim) { return dim < 0; }))
+            return;
+        std::size_t size = static_cast<std::size_t>(std::accumulate(shape.begin(), shape.end(), int64_t(1), [](int64_t a, int64_t b) { return a * b; }));
+        buffers[i].resize(size);
+        itensors.emplace_back(Ort::Value::CreateTensor<float>(_memory_info, buffers[i].data(), size, shape.data(), shape.size()));
+    }
+    std::vector<const char *> input_names(pending.inames.size());
+    std::vector<const char *> output_names(pending.onames.size());
+#if ORT_API_VERSION < 12
+    for (std::size_t i = 0; i < pending.inames.size(); i++)
+        input_names[i] = pending.inames[i];
+    for (std::size_t i = 0; i < pending.onames.size(); i++)
+        output_names[i] = pending.onames[i];
+#else
+    for (std::size_t i = 0; i < pending.inames.size(); i++)
+        input_names[i] = pending.inames[i].get();
+    for (std::size_t i = 0; i < pending.onames.size(); i++)
+        output_names[i] = pending.onames[i].get();
+#endif
+    session.Run(Ort::RunOptions{nullptr}, input_names.data(), itensors.data(), itensors.size(), output_names.data(), output_names.size());
+}
+
+OrtProvider OnnxNet::selectProvider(std::string_view model_path)
+{
+    // 候选提供者：CPU 始终可用，其余按运行时可用性加入
+    std::vector<std::pair<OrtProvider, std::string>> candidates{{OrtProvider::CPU, "cpu"}};
+    auto available = Ort::GetAvailableProviders();
+    auto has = [&available](std::string_view name) {
+        return std::find(available.begin(), available.end(), name) != available.end();
+    };
+    if (has("CUDAExecutionProvider"))
+        candidates.emplace_back(OrtProvider::CUDA, "cuda");
+    if (has("TensorrtExecutionProvider"))
+        candidates.emplace_back(OrtProvider::TensorRT, "tensorrt");
+    if (has("OpenVINOExecutionProvider"))
+        candidates.emplace_back(OrtProvider::OpenVINO, "openvino");
+    if (candidates.size() == 1)
+        return OrtProvider::CPU;
+    // 为每个候选构造试探会话并预热，引擎编译与缓存加载在此阶段完成，不计入实测耗时，
+    // 构造或预热失败的候选直接剔除
+    std::vector<std::pair<OrtProvider, std::string>> usable;
+    std::vector<std::unique_ptr<PendingSession>> probes;
+    std::deque<std::string> cache_dirs; // 引擎缓存路径需在对应会话构造完成前保持有效
+    for (const auto &[cand_prov, cand_name] : candidates)
+    {
+        try
+        {
+            Ort::SessionOptions options;
+            appendProvider(options, cand_prov, model_path, cache_dirs.emplace_back());
+            options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
+            auto probe = std::make_unique<PendingSession>();
+            probe->session = makeSession(_env, model_path, options, probe->maps);
+            for (std::size_t i = 0; i < probe->session->GetInputCount(); i++)
+#if ORT_API_VERSION < 12
+                probe->inames.emplace_back(probe->session->GetInputName(i, alloc));
+            for (std::size_t i = 0; i < probe->session->GetOutputCount(); i++)
+                probe->onames.emplace_back(probe->session->GetOutputName(i, alloc));
+#else
+                probe->inames.emplace_back(probe->session->GetInputNameAllocated(i, alloc));
+            for (std::size_t i = 0; i < probe->session->GetOutputCount(); i++)
+                probe->onames.emplace_back(probe->session->GetOutputNameAllocated(i, alloc));
+#endif
+            warmupPending(*probe);
+            usable.emplace_back(cand_prov, cand_name);
+            probes.push_back(std::move(probe));
+        }
+        catch (const std::exception &e)
+        {
+            WARNING_("The provider \"%s\" is unavailable for the model \"%s\": %s", cand_name.c_str(),
+                     std::string(model_path).c_str(), e.what());
+        }
+    }
+    if (probes.empty())
+        return OrtProvider::CPU;
+    if (probes.size() == 1)
+        return usable.front().first;
+    // 实测各候选的单次推理耗时，选优结果以模型哈希为键经由 rm::tuner 按机型缓存
+    std::vector<tuner::Variant> variants;
+    variants.reserve(probes.size());
+    for (std::size_t i = 0; i < probes.size(); ++i)
+        variants.push_back({usable[i].second, [this, &probes, i] { warmupPending(*probes[i]); }});
+    std::ostringstream oss;
+    oss << "ml/ort_provider_" << std::hex << std::setw(16) << std::setfill('0') << modelHash(model_path);
+    return usable[tuner::select(oss.str(), variants)].first;
+}
+
+void OnnxNet::applyPendingSession()
+{
+    std::lock_guard<std::mutex> lock(_pending_mutex);
+    if (_pending == nullptr)
+        return;
+    _session = std::move(_pending->session);
+    _inames = std::move(_pending->inames);
+    _onames = std::move(_pending->onames);
+    _model_maps = std::move(_pending->maps);
+    _pending.reset();
+    // 派生类刷新与输入输出层相关的缓存，新会话形状可能变化，重建 IoBinding
+    onSessionSwap();
+    _binding.reset();
+    bindIO();
+}
+
 std::vector<Ort::Value> OnnxNet::preProcess(const std::vector<cv::Mat> &, const PreprocessOptions &) { return {}; }
+
+std::vector<Ort::Value> OnnxNet::preProcess(const RoiBatch &, const PreprocessOptions &) { return {}; }
 std::any OnnxNet::postProcess(const std::vector<Ort::Value> &, const PostprocessOptions &) { return {}; }
+std::vector<std::any> OnnxNet::unbatch(const std::any &result, std::size_t batch) const { return batch == 1 ? std::vector<std::any>{result} : std::vector<std::any>{}; }
+
+bool OnnxNet::bindIO() noexcept
+{
+    if (_session == nullptr)
+        return false;
+    try
+    {
+        // 所有输入输出层均需为静态形状的 float 类型 Tensor，动态批维度按 1 处理
+        std::size_t icount = _session->GetInputCount(), ocount = _session->GetOutputCount();
+        for (std::size_t i = 0; i < icount; i++)
+        {
+            auto info = _session->GetInputTypeInfo(i).GetTensorTypeAndShapeInfo();
+            auto shape = info.GetShape();
+            if (shape.empty() || info.GetElementType() != ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT)
+                return false;
+            if (std::any_of(shape.begin() + 1, shape.end(), [](int64_t dim) { return dim < 0; }))
+                return false;
+        }
+        std::vector<std::vector<int64_t>> oshapes(ocount);
+        for (std::size_t i = 0; i < ocount; i++)
+        {
+            auto info = _session->GetOutputTypeInfo(i).GetTensorTypeAndShapeInfo();
+            oshapes[i] = info.GetShape();
+            if (oshapes[i].empty() || info.GetElementType() != ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT)
+                return false;
+            if (oshapes[i].front() < 0)
+                oshapes[i].front() = 1;
+            if (std::any_of(oshapes[i].begin(), oshapes[i].end(), [](int64_t dim) { return dim < 0; }))
+                return false;
+        }
+        // 一次性分配输出缓冲区并完成绑定
+        auto binding = std::make_unique<Ort::IoBinding>(*_session);
+        _obuffers.resize(ocount);
+        _otensors.clear();
+        for (std::size_t i = 0; i < ocount; i++)
+        {
+            std::size_t size = static_cast<std::size_t>(std::accumulate(oshapes[i].begin(), oshapes[i].end(), int64_t(1), [](int64_t a, int64_t b) { return a * b; }));
+            _obuffers[i].resize(size);
+            _otensors.emplace_back(Ort::Value::CreateTensor<float>(_memory_info, _obuffers[i].data(), size, oshapes[i].data(), oshapes[i].size()));
+#if ORT_API_VERSION < 12
+            binding->BindOutput(_onames[i], _otensors[i]);
+#else
+            binding->BindOutput(_onames[i].get(), _otensors[i]);
+#endif
+        }
+        _binding = std::move(binding);
+        return true;
+    }
+    catch (const Ort::Exception &)
+    {
+        return false;
+    }
+}
+
+bool OnnxNet::warmup(const PreprocessOptions &preop, const PostprocessOptions &postop, std::size_t times) noexcept
+{
+    if (_session == nullptr || _session->GetInputCount() == 0)
+        return false;
+    try
+    {
+        // 按输入层形状构造全零图像
+        auto shape = _session->GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+        if (shape.size() != 4 || (shape[1] != 1 && shape[1] != 3) || shape[2] <= 0 || shape[3] <= 0)
+            return false;
+        cv::Mat dummy = cv::Mat::zeros(static_cast<int>(shape[2]), static_cast<int>(shape[3]),
+                                       shape[1] == 3 ? CV_8UC3 : CV_8UC1);
+        for (std::size_t i = 0; i < times; i++)
+            inference({dummy}, preop, postop);
+        return true;
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+}
 
 std::any OnnxNet::inference(const std::vector<cv::Mat> &images, const PreprocessOptions &preop, const PostprocessOptions &postop)
 {
     RMVL_Assert(_session != nullptr);
+    // 热更新的新会话就绪时在两次推理之间完成切换，仅为指针交换
+    if (_pending_ready.exchange(false, std::memory_order_acq_rel))
+        applyPendingSession();
     auto itensors = preProcess(images, preop);
+    return runSession(itensors, images.size(), postop);
+}
+
+std::any OnnxNet::inference(const RoiBatch &batch, const PreprocessOptions &preop, const PostprocessOptions &postop)
+{
+    RMVL_Assert(_session != nullptr && !batch.empty());
+    // 热更新的新会话就绪时在两次推理之间完成切换，仅为指针交换
+    if (_pending_ready.exchange(false, std::memory_order_acq_rel))
+        applyPendingSession();
+    auto itensors = preProcess(batch, preop);
+    return runSession(itensors, batch.size(), postop);
+}
+
+std::any OnnxNet::runSession(std::vector<Ort::Value> &itensors, std::size_t batch, const PostprocessOptions &postop)
+{
+    // IoBinding 模式下单张输入推理复用持久的输出缓冲区
+    if (_binding != nullptr && batch == 1)
+    {
+        for (std::size_t i = 0; i < itensors.size(); i++)
+#if ORT_API_VERSION < 12
+            _binding->BindInput(_inames[i], itensors[i]);
+#else
+            _binding->BindInput(_inames[i].get(), itensors[i]);
+#endif
+        _session->Run(Ort::RunOptions{nullptr}, *_binding);
+        return postProcess(_otensors, postop);
+    }
 #if ORT_API_VERSION < 12
     return postProcess(_session->Run(Ort::RunOptions{nullptr}, _inames.data(), itensors.data(), itensors.size(), _onames.data(), _onames.size()), postop);
 #else
@@ -27,6 +27,7 @@
 #ifdef HAVE_RMVL_OPCUA
 ////////////////// Client/Server //////////////////
 #include "opcua/client.hpp"
+#include "opcua/path_cache.hpp"
 #include "opcua/server.hpp"
 ///////////////////// Pub/Sub /////////////////////
 #ifdef UA_ENABLE_PUBSUB
@@ -12,6 +12,12 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <future>
+
+#ifdef __cpp_impl_coroutine
+#include <coroutine>
+#endif
 
 #include <open62541/client_subscriptions.h>
 
@@ -93,6 +99,26 @@ public:
      */
     RMVL_W bool write(const NodeId &nd, const Variable &val) const;
 
+    /**
+     * @brief 从指定的变量节点读数据（`noexcept` 快速路径）
+     * @brief
+     * - 以 rm::expected 返回结果，失败诊断经 rm::diagLog 记入环形缓冲，链路抖动期间
+     *   逐帧读取不触发格式化输出
+     *
+     * @param[in] nd 既存的变量节点的 `NodeId`
+     * @return 读出的用 `rm::Variable` 表示的数据，或一种 rm::Errc 错误码
+     */
+    expected<Variable> tryRead(const NodeId &nd) const noexcept;
+
+    /**
+     * @brief 给指定的变量节点写数据（`noexcept` 快速路径） @see tryRead
+     *
+     * @param[in] nd 既存的变量节点的 `NodeId`
+     * @param[in] val 待写入的数据
+     * @return 成功状态，或一种 rm::Errc 错误码
+     */
+    expected<void> tryWrite(const NodeId &nd, const Variable &val) const noexcept;
+
 private:
     UA_Client *_client{nullptr}; //!< 客户端指针
 };
@@ -113,6 +139,40 @@ using DataChangeNotificationCallback = std::function<void(ClientView, const Vari
  */
 using EventNotificationCallback = std::function<void(ClientView, const std::vector<Variable> &)>;
 
+//! OPC UA 客户端连接状态
+enum class ClientState : uint8_t
+{
+    Disconnected, //!< 未连接
+    Connected,    //!< 会话已激活
+    Reconnecting  //!< 链路中断，等待会话重建
+};
+
+//! 数据变更通知的死区类型
+enum class DeadbandType : uint8_t
+{
+    None,     //!< 不使用死区，任何数值变化均产生通知
+    Absolute, //!< 绝对死区，数值变化超过 `deadband` 时才产生通知
+    Percent   //!< 百分比死区，数值变化超过 `EURange` 量程的 `deadband`% 时才产生通知
+};
+
+/**
+ * @brief 变量监视选项
+ * @brief
+ * - 高频更新的变量节点（如 1kHz 的状态量）默认会将每次数值变化都通知到客户端，
+ *   通过服务器侧的死区过滤与采样抽取，可在不修改发布端的前提下削减通知流量与订阅者唤醒次数
+ */
+struct RMVL_EXPORTS_W_AG MonitorOptions final
+{
+    //! 死区类型，死区过滤在服务器侧完成，被过滤的变化不会进入通知队列 @see rm::DeadbandType
+    RMVL_W_RW DeadbandType deadband_type{DeadbandType::None};
+    //! 死区值，`Absolute` 时为绝对量，`Percent` 时为量程百分比，取值 `(0, 100]`
+    RMVL_W_RW double deadband{};
+    //! 服务器采样间隔，单位 `ms`，即通知频率的抽取上限，为 `0` 时使用 `opcua_param.SAMPLING_INTERVAL`
+    RMVL_W_RW double sampling_interval{};
+    //! 通知存放的队列大小，若队列已满，新的通知会覆盖旧的通知
+    RMVL_W_RW uint32_t q_size{10};
+};
+
 //! OPC UA 客户端
 class RMVL_EXPORTS_W Client
 {
@@ -160,6 +220,31 @@ public:
     //! 断开与服务器的连接
     RMVL_W bool shutdown();
 
+    /**
+     * @brief 当前连接状态
+     * @brief
+     * - 无锁读取，可在控制回路中逐帧查询。状态在 `spin()` 或 `spinOnce()` 的事件循环中
+     *   维护，链路中断时转入 `ClientState::Reconnecting`，此间 @ref readCached 仍返回
+     *   最近已知值，控制回路得以按旧数据降级运行而非阻塞等待
+     */
+    RMVL_W ClientState state() const { return _state.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 重建会话并恢复全部监视项
+     * @brief
+     * - 复用同一客户端对象重新连接，实现会优先以既有会话执行 `ActivateSession`（会话恢复），
+     *   随后通过 OPC UA `TransferSubscriptions` 服务将旧会话的订阅迁移至新会话，服务器在
+     *   订阅生存期内保留其通知队列，迁移成功时无通知丢失
+     * @brief
+     * - 迁移失败（服务器不支持该服务或订阅已过期）时，按既有监视项信息整批重建订阅，本地
+     *   缓存槽全程保留，@ref readCached 在重建期间持续可用
+     * @note 相邻两次重建尝试之间有 `opcua_param.RECONNECT_INTERVAL` 的最小间隔，间隔内
+     *       调用立即返回 `false`，不产生任何网络往返，可在控制回路中无条件逐帧调用
+     *
+     * @return 是否成功重建会话并恢复监视项
+     */
+    RMVL_W bool reconnect();
+
     /****************************** 路径搜索 ******************************/
 
     /**
@@ -209,6 +294,69 @@ public:
      */
     RMVL_W bool write(const NodeId &node, const Variable &val) const;
 
+    /**
+     * @brief 从指定的变量节点读数据（`noexcept` 快速路径）
+     * @brief
+     * - 以 rm::expected 返回结果，失败诊断经 rm::diagLog 记入环形缓冲，链路抖动期间
+     *   逐帧读取不触发格式化输出
+     *
+     * @param[in] node 既存的变量节点的 `NodeId`
+     * @return 读出的用 `rm::Variable` 表示的数据，或一种 rm::Errc 错误码
+     */
+    expected<Variable> tryRead(const NodeId &node) const noexcept;
+
+    /**
+     * @brief 给指定的变量节点写数据（`noexcept` 快速路径） @see tryRead
+     *
+     * @param[in] node 既存的变量节点的 `NodeId`
+     * @param[in] val 待写入的数据
+     * @return 成功状态，或一种 rm::Errc 错误码
+     */
+    expected<void> tryWrite(const NodeId &node, const Variable &val) const noexcept;
+
+    /**
+     * @brief 批量从多个变量节点读数据
+     * @brief
+     * - 使用 OPC UA 原生的多节点 `Read` 服务，所有节点在单次网络往返内完成读取，
+     *   适合高频同步大量变量的场合
+     *
+     * @param[in] nodes 既存的变量节点的 `NodeId` 列表
+     * @return 读出的用 `rm::Variable` 表示的数据列表，与 `nodes` 一一对应，未成功读取的项为空
+     */
+    RMVL_W Variables readAll(const std::vector<NodeId> &nodes) const;
+
+    /**
+     * @brief 批量给多个变量节点写数据
+     * @brief
+     * - 使用 OPC UA 原生的多节点 `Write` 服务，所有节点在单次网络往返内完成写入
+     *
+     * @param[in] nodes 既存的变量节点的 `NodeId` 列表
+     * @param[in] vals 待写入的数据列表，与 `nodes` 一一对应
+     * @return 是否全部写入成功
+     */
+    RMVL_W bool writeAll(const std::vector<NodeId> &nodes, const Variables &vals) const;
+
+    /**
+     * @brief 批量从多个变量节点异步读数据
+     * @note 请求立即发出，响应在 `spin()` 或 `spinOnce()` 的事件循环中到达并完成对应的
+     *       `std::future`，等待结果前需保证事件循环正在执行
+     *
+     * @param[in] nodes 既存的变量节点的 `NodeId` 列表
+     * @return 数据列表的 `std::future`，请求发送失败时为无效的 `std::future`
+     */
+    std::future<Variables> readAllAsync(const std::vector<NodeId> &nodes) const;
+
+    /**
+     * @brief 批量给多个变量节点异步写数据
+     * @note 请求立即发出，响应在 `spin()` 或 `spinOnce()` 的事件循环中到达并完成对应的
+     *       `std::future`，等待结果前需保证事件循环正在执行
+     *
+     * @param[in] nodes 既存的变量节点的 `NodeId` 列表
+     * @param[in] vals 待写入的数据列表，与 `nodes` 一一对应
+     * @return 是否全部写入成功的 `std::future`，请求发送失败时为无效的 `std::future`
+     */
+    std::future<bool> writeAllAsync(const std::vector<NodeId> &nodes, const Variables &vals) const;
+
     /**
      * @brief 在客户端调用指定对象节点中的方法
      *
@@ -253,6 +401,82 @@ public:
     template <typename... Args>
     std::pair<bool, Variables> callx(std::string_view name, Args &&...args) const { return call(name, {std::forward<Args>(args)...}); }
 
+#ifdef __cpp_impl_coroutine
+    /**
+     * @brief 异步方法调用的可等待对象（C++20 协程）
+     * @brief
+     * - 由 @ref async_call 创建，`co_await` 时发出异步调用请求并挂起当前协程，
+     *   响应到达后由 `spinOnce()` 的完成队列恢复并返回调用结果
+     */
+    class RMVL_EXPORTS CallAwaiter final
+    {
+    public:
+        //! @cond
+        CallAwaiter(const CallAwaiter &) = delete;
+        CallAwaiter(CallAwaiter &&) = delete;
+
+        CallAwaiter &operator=(const CallAwaiter &) = delete;
+        CallAwaiter &operator=(CallAwaiter &&) = delete;
+
+        void complete(bool res, Variables &&outputs) noexcept;
+        //! @endcond
+
+        //! 方法节点未找到时无需挂起
+        bool await_ready() const noexcept { return _ready; }
+
+        /**
+         * @brief 挂起当前协程并发出异步调用请求
+         *
+         * @param[in] handle 当前协程句柄
+         * @return 是否维持挂起状态，请求发送失败时返回 `false`，立即以失败结果恢复
+         */
+        bool await_suspend(std::coroutine_handle<> handle);
+
+        //! 获取调用结果 `[res, oargs]`
+        std::pair<bool, Variables> await_resume() noexcept { return {_res, std::move(_outputs)}; }
+
+    private:
+        friend class Client;
+
+        CallAwaiter(const Client *cli, const NodeId &obj_nd, const NodeId &method_nd, const Variables &inputs)
+            : _cli(cli), _obj_nd(obj_nd), _method_nd(method_nd), _inputs(inputs), _ready(method_nd.empty()) {}
+
+        const Client *_cli{};            //!< 所属客户端
+        NodeId _obj_nd;                  //!< 对象节点 ID
+        NodeId _method_nd;               //!< 方法节点 ID
+        Variables _inputs;               //!< 输入参数列表
+        std::coroutine_handle<> _handle; //!< 挂起的协程句柄
+        bool _ready{};                   //!< 是否无需挂起
+        bool _res{};                     //!< 是否成功完成调用
+        Variables _outputs;              //!< 输出参数列表
+    };
+
+    /**
+     * @brief 异步调用指定对象节点中的方法（C++20 协程）
+     * @brief
+     * - 请求在 `co_await` 时发出，当前协程随即挂起，方法调用与其他处理得以重叠执行，
+     *   响应在 `spin()` 或 `spinOnce()` 的事件循环中到达并恢复协程
+     * @code{.cpp}
+     * auto [res, oargs] = co_await cli.async_call(obj_nd, "add", {1, 2});
+     * @endcode
+     *
+     * @param[in] obj_nd 对象节点
+     * @param[in] name 方法名
+     * @param[in] inputs 输入参数列表
+     * @return 可等待对象，`co_await` 后得到 `[res, oargs]`
+     */
+    CallAwaiter async_call(const NodeId &obj_nd, std::string_view name, const Variables &inputs) const;
+
+    /**
+     * @brief 异步调用 ObjectsFolder 中的方法（C++20 协程）
+     *
+     * @param[in] name 方法名 `browse_name`
+     * @param[in] inputs 输入参数列表
+     * @return 可等待对象，`co_await` 后得到 `[res, oargs]`
+     */
+    CallAwaiter async_call(std::string_view name, const Variables &inputs) const { return async_call(nodeObjectsFolder, name, inputs); }
+#endif
+
     /**
      * @brief 添加 OPC UA 视图节点 ViewNode 至 `ViewsFolder` 中
      *
@@ -270,12 +494,48 @@ public:
      * - 类似于 ROS 中的订阅话题，这里是订阅变量节点
      *
      * @param[in] nd 待监视节点的 `NodeId`
-     * @param[in] on_change 数据变更可调用对象
+     * @param[in] on_change 数据变更可调用对象，传入空的可调用对象时仅维护本地缓存，可参考 @ref readCached
      * @param[in] q_size 通知存放的队列大小，若队列已满，新的通知会覆盖旧的通知，默认为 `10`
      * @return 变量节点监视创建成功？
      */
     RMVL_W bool monitor(NodeId nd, DataChangeNotificationCallback on_change, uint32_t q_size = 10);
 
+    /**
+     * @brief 创建变量节点监视项，并指定服务器侧的通知过滤选项
+     * @brief
+     * - 死区过滤与采样抽取均在服务器侧完成，例如 1kHz 更新的云台状态节点，设置
+     *   `sampling_interval = 33` 后订阅者唤醒频率即降至约 30Hz，无需修改发布端代码
+     * @code{.cpp}
+     * rm::MonitorOptions options{};
+     * options.deadband_type = rm::DeadbandType::Absolute;
+     * options.deadband = 0.5;          // 变化小于 0.5 的通知被服务器丢弃
+     * options.sampling_interval = 33;  // 采样抽取至约 30Hz
+     * cli.monitor(nd, on_change, options);
+     * @endcode
+     *
+     * @note 死区过滤仅适用于数值类型的标量变量节点，服务器不支持所请求过滤器时监视创建失败
+     * @param[in] nd 待监视节点的 `NodeId`
+     * @param[in] on_change 数据变更可调用对象，传入空的可调用对象时仅维护本地缓存，可参考 @ref readCached
+     * @param[in] options 变量监视选项 @see rm::MonitorOptions
+     * @return 变量节点监视创建成功？
+     */
+    RMVL_W bool monitor(NodeId nd, DataChangeNotificationCallback on_change, const MonitorOptions &options);
+
+    /**
+     * @brief 读取监视变量的本地缓存值
+     * @brief
+     * - 缓存由数据变更通知自动维护，读取时不产生任何网络往返，适合热路径控制代码获取最近已知值，
+     *   冷路径需要最新值时仍可使用 @ref read
+     * @brief
+     * - 读取过程无锁：变量经原子指针交换发布，变更序号可用于判断两次读取之间数据是否更新
+     *
+     * @note 监视项需在并发读取开始前通过 @ref monitor 创建完毕
+     * @param[in] nd 既存的已监视变量节点的 `NodeId`
+     * @retval val, seq
+     * @return 最近一次数据变更通知的变量及其变更序号，未监视该节点或尚未收到任何通知时变量为空、序号为 `0`
+     */
+    RMVL_W std::pair<Variable, uint32_t> readCached(const NodeId &nd) const;
+
     /**
      * @brief 创建事件监视项，以实现事件的订阅功能
      *
@@ -294,10 +554,56 @@ public:
     RMVL_W bool remove(NodeId nd);
 
 private:
+    //! 监视变量的本地缓存槽，由数据变更通知自动维护
+    struct MonitorCache
+    {
+        std::shared_ptr<const Variable> value; //!< 最近一次通知的变量（原子指针交换发布）
+        std::atomic_uint32_t seq{};            //!< 数据变更序号
+    };
+
+    //! 变量监视项的重建信息，会话重建时用于恢复订阅
+    struct VarMonitorInfo
+    {
+        NodeId nd;                                //!< 被监视的变量节点
+        DataChangeNotificationCallback *context{}; //!< 数据变更通知上下文（生命周期由 `_dccb_gc` 管理）
+        MonitorOptions options{};                 //!< 变量监视选项
+    };
+
+    //! 事件监视项的重建信息，会话重建时用于恢复订阅
+    struct EventMonitorInfo
+    {
+        std::vector<std::string> names;      //!< 关注的事件属性名列表
+        EventNotificationCallback *context{}; //!< 事件通知上下文（生命周期由 `_encb_gc` 管理）
+    };
+
+    //! 创建变量监视项（订阅 + 监视项），并登记至监视项映射表
+    bool createVariableMonitor(const NodeId &nd, DataChangeNotificationCallback *context, const MonitorOptions &options);
+
+    //! 创建事件监视项（订阅 + 监视项）
+    bool createEventMonitor(const std::vector<std::string> &names, EventNotificationCallback *context);
+
     //! 客户端指针
     UA_Client *_client{nullptr};
+    //! 连接地址，会话重建时复用
+    std::string _address;
+    //! 用户信息，会话重建时复用
+    UserConfig _user;
+    //! 连接状态，事件循环中维护
+    mutable std::atomic<ClientState> _state{ClientState::Disconnected};
+    //! 最近一次会话重建尝试的时刻（单位：s），用于重建限速
+    double _last_attempt{};
+    //! 变量监视项重建信息列表
+    std::vector<VarMonitorInfo> _var_monitors;
+    //! 事件监视项重建信息列表
+    std::vector<EventMonitorInfo> _event_monitors;
     //! 节点号监视项映射表 `[NodeId : [SubId, MonitorId]]`
     std::unordered_map<UA_UInt32, std::array<UA_UInt32, 2>> _monitor_map;
+    //! 监视变量本地缓存映射表 `[NodeId : MonitorCache]`
+    std::unordered_map<UA_UInt32, std::unique_ptr<MonitorCache>> _cache_map;
+#ifdef __cpp_impl_coroutine
+    //! 异步方法调用完成队列，存放待恢复的协程句柄
+    mutable std::vector<std::coroutine_handle<>> _ready_calls;
+#endif
     //! 数据变更通知回调函数
     std::vector<std::unique_ptr<DataChangeNotificationCallback>> _dccb_gc{};
     //! 事件通知回调函数
@@ -317,6 +623,22 @@ public:
      */
     RMVL_W ClientTimer(ClientView cv, double period, std::function<void(ClientView)> callback);
 
+    /**
+     * @brief 创建自适应周期的 OPC UA 客户端定时器
+     * @brief
+     * - 回调函数返回本周期内数据是否发生变化：无变化时周期按二倍退避直至 `max_period`，
+     *   有变化时立即收紧至基准周期 `period`
+     * @brief
+     * - 二倍退避使各定时器的周期保持谐波关系，相邻的到期时刻在事件循环中合并为一次唤醒，
+     *   数据静态时的唤醒次数大幅减少
+     *
+     * @param[in] cv 客户端视图
+     * @param[in] period 基准定时器周期，单位：毫秒 `ms`
+     * @param[in] max_period 退避的最大周期，单位：毫秒 `ms`
+     * @param[in] callback 定时器回调函数，返回数据是否发生变化
+     */
+    RMVL_W ClientTimer(ClientView cv, double period, double max_period, std::function<bool(ClientView)> callback);
+
     //! @cond
     ClientTimer(const ClientTimer &) = delete;
     ClientTimer(ClientTimer &&) = default;
@@ -331,6 +653,13 @@ public:
     //! 取消定时器
     RMVL_W void cancel();
 
+    /**
+     * @brief 修改定时器周期
+     *
+     * @param[in] period 新的定时器周期，单位：毫秒 `ms`
+     */
+    RMVL_W void setPeriod(double period);
+
 private:
     ClientView _cv;                      //!< 客户端视图
     std::function<void(ClientView)> _cb; //!< 定时器回调函数
@@ -0,0 +1,156 @@
+/**
+ * @file path_cache.hpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 浏览路径解析结果的驻留缓存
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#include "utilities.hpp"
+
+namespace rm
+{
+
+//! @addtogroup opcua
+//! @{
+
+/**
+ * @brief 浏览路径解析结果的驻留缓存
+ * @brief
+ * - `Client::find` 与 `Server::find` 每次调用都要经由服务器的命名空间逐级解析浏览路径，
+ *   相同路径的重复解析（如控制桥接每周期固定访问的几十个节点）是纯粹的浪费。本缓存以
+ *   浏览路径为键驻留解析出的 `NodeId`，命中时不再发起解析
+ * @brief
+ * - 周期性访问的路径可通过 `compile` 预编译为句柄，稳态的 `at` 查找退化为一次数组下标
+ *   访问，无字符串哈希与比较开销
+ * @brief
+ * - 地址空间变更（节点增删）后调用 `invalidate`，已驻留的解析结果全部失效，句柄保持
+ *   有效并在下次访问时重新解析；解析失败的路径不会驻留，节点就绪后的访问自动重试
+ * @code{.cpp}
+ * rm::Client cli("opc.tcp://127.0.0.1:4840");
+ * rm::NodePathCache cache([&cli](std::string_view path, const rm::NodeId &src) { return cli.find(path, src); });
+ * auto handle = cache.compile("person/name");
+ * // 每周期的稳态查找仅为一次数组下标访问
+ * auto value = cli.read(cache.at(handle));
+ * @endcode
+ */
+class NodePathCache final
+{
+public:
+    //! 预编译路径句柄
+    using PathHandle = std::size_t;
+    //! 浏览路径解析函数，一般绑定到 `Client::find` 或 `Server::find`
+    using Resolver = std::function<NodeId(std::string_view, const NodeId &)>;
+
+    /**
+     * @brief 创建浏览路径驻留缓存
+     *
+     * @param[in] resolver 浏览路径解析函数
+     */
+    explicit NodePathCache(Resolver resolver) : _resolver(std::move(resolver)) {}
+
+    //! @cond
+    NodePathCache(const NodePathCache &) = delete;
+    NodePathCache(NodePathCache &&) = default;
+    NodePathCache &operator=(const NodePathCache &) = delete;
+    NodePathCache &operator=(NodePathCache &&) = default;
+    //! @endcond
+
+    /**
+     * @brief 通过 BrowseName 的路径搜索节点，解析结果驻留缓存
+     *
+     * @param[in] browse_path BrowseName 路径，使用 `/` 分隔
+     * @param[in] src_nd 源节点 ID，默认为 `rm::nodeObjectsFolder`
+     * @return 节点 ID，解析失败时为空且不驻留
+     */
+    NodeId find(std::string_view browse_path, const NodeId &src_nd = nodeObjectsFolder)
+    {
+        auto key = makeKey(browse_path, src_nd);
+        auto it = _cache.find(key);
+        if (it != _cache.end())
+            return it->second;
+        NodeId nd = _resolver(browse_path, src_nd);
+        if (!nd.empty())
+            _cache.emplace(std::move(key), nd);
+        return nd;
+    }
+
+    /**
+     * @brief 预编译浏览路径，获取稳态查找句柄
+     * @note 相同路径重复编译返回同一句柄，句柄在 `invalidate` 后保持有效
+     *
+     * @param[in] browse_path BrowseName 路径，使用 `/` 分隔
+     * @param[in] src_nd 源节点 ID，默认为 `rm::nodeObjectsFolder`
+     * @return 预编译路径句柄
+     */
+    PathHandle compile(std::string_view browse_path, const NodeId &src_nd = nodeObjectsFolder)
+    {
+        auto key = makeKey(browse_path, src_nd);
+        auto it = _handles.find(key);
+        if (it != _handles.end())
+            return it->second;
+        _paths.push_back({std::string(browse_path), src_nd, {}});
+        return _handles.emplace(std::move(key), _paths.size() - 1).first->second;
+    }
+
+    /**
+     * @brief 通过预编译路径句柄查找节点
+     * @note 解析结果有效时仅为一次数组下标访问，首次访问或 `invalidate` 后重新解析
+     *
+     * @param[in] handle 预编译路径句柄
+     * @return 节点 ID，解析失败时为空并在下次访问时重试
+     */
+    const NodeId &at(PathHandle handle)
+    {
+        auto &path = _paths[handle];
+        if (path.nd.empty())
+            path.nd = _resolver(path.browse_path, path.src_nd);
+        return path.nd;
+    }
+
+    //! 地址空间变更后使全部驻留的解析结果失效，句柄保持有效
+    void invalidate()
+    {
+        _cache.clear();
+        for (auto &path : _paths)
+            path.nd.clear();
+    }
+
+    //! 已驻留的解析结果条数
+    std::size_t size() const { return _cache.size(); }
+
+private:
+    //! 预编译路径
+    struct CompiledPath
+    {
+        std::string browse_path; //!< BrowseName 路径
+        NodeId src_nd;           //!< 源节点 ID
+        NodeId nd;               //!< 解析出的节点 ID，为空表示待解析
+    };
+
+    //! 由源节点与浏览路径构成缓存键
+    static std::string makeKey(std::string_view browse_path, const NodeId &src_nd)
+    {
+        std::string key = std::to_string(src_nd.ns) + ':' + std::to_string(src_nd.id) + '/';
+        key += browse_path;
+        return key;
+    }
+
+    Resolver _resolver;                                      //!< 浏览路径解析函数
+    std::map<std::string, NodeId, std::less<>> _cache;       //!< 驻留缓存
+    std::map<std::string, PathHandle, std::less<>> _handles; //!< 预编译路径句柄注册表
+    std::vector<CompiledPath> _paths;                        //!< 预编译路径表，句柄为下标
+};
+
+//! @} opcua
+
+} // namespace rm
@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <memory>
+
+#include "rmvl/core/io.hpp"
+
 #include "server.hpp"
 
 #ifdef UA_ENABLE_PUBSUB
@@ -40,7 +44,9 @@ public:
      * @brief 创建 OPC UA 发布者
      *
      * @param[in] pub_name 发布者名称
-     * @param[in] addr 不加端口的网络多播 IP 地址，形如 `opc.udp://224.0.1.22`
+     * @param[in] addr 不加端口的网络多播 IP 地址，形如 `opc.udp://224.0.1.22`，
+     *                 指定环回地址（形如 `opc.udp://127.0.0.1`）时视为同主机发布，
+     *                 改用共享内存快速通道交换数据集，端到端时延可降至微秒级
      * @param[in] port 端口号，并且作为多播 IP 地址的端口号，与 @ref Server::Server 的端口号概念一致，默认为 `4840U`
      * @param[in] users 用户列表，默认为空，可参考 @ref UserConfig
      */
@@ -49,6 +55,7 @@ public:
     /**
      * @brief 发布数据集
      *
+     * @note 同主机发布时，以 `duration` 为周期将数据集快照写入顺序锁保护的共享内存通道
      * @param[in] datas 待发布的数据集列表
      * @param[in] duration 发布周期，单位为 `ms`
      * @return 是否发布成功
@@ -63,6 +70,11 @@ private:
 
     std::string _name;               //!< 发布者名称
     std::hash<std::string> _strhash; //!< 字符串哈希函数
+
+    bool _shm_lane{};                        //!< 是否启用同主机共享内存快速通道
+    std::unique_ptr<ShmServer> _shm;         //!< 共享内存通道（发布端）
+    std::unique_ptr<ServerTimer> _shm_timer; //!< 数据集快照发布定时器
+    std::vector<NodeId> _shm_nodes;          //!< 待发布的变量节点 ID 列表
 };
 
 //! @} opcua
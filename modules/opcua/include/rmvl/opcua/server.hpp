@@ -12,6 +12,9 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "event.hpp"
@@ -26,6 +29,34 @@ namespace rm
 
 //! @example samples/opcua/opcua_server.cpp OPC UA 服务器例程
 
+/**
+ * @brief 预编译事件模板
+ * @brief
+ * - 缓存事件类型节点与各非默认属性字段的解析结果，突发触发时不再为每个事件执行路径搜索
+ *   与字段存在性检查，参见 rm::Server::compileEvent 与 rm::Server::triggerEvents
+ */
+class RMVL_EXPORTS_W EventTemplate final
+{
+public:
+    RMVL_W EventTemplate() = default;
+
+    //! 模板是否有效，即事件类型节点是否已成功解析
+    RMVL_W inline bool valid() const { return !_type_id.empty(); }
+    //! 获取事件类型节点 ID
+    RMVL_W inline const NodeId &type() const { return _type_id; }
+    //! 获取已通过存在性检查的非默认属性字段浏览名列表
+    RMVL_W inline const std::vector<std::string> &fields() const { return _fields; }
+
+private:
+    friend class Server;
+    friend class ServerView;
+
+    EventTemplate(const NodeId &type_id, std::vector<std::string> &&fields) : _type_id(type_id), _fields(std::move(fields)) {}
+
+    NodeId _type_id{};                //!< 事件类型节点 ID
+    std::vector<std::string> _fields; //!< 非默认属性字段浏览名列表
+};
+
 //! OPC UA 服务器视图
 class RMVL_EXPORTS_W ServerView final
 {
@@ -101,6 +132,23 @@ public:
      */
     RMVL_W bool triggerEvent(const Event &event) const;
 
+    /**
+     * @brief 预编译事件模板，参见 rm::Server::compileEvent
+     *
+     * @param[in] etype `rm::EventType` 表示的事件类型
+     * @return 预编译的事件模板，解析失败时返回无效模板
+     */
+    RMVL_W EventTemplate compileEvent(const EventType &etype) const;
+
+    /**
+     * @brief 按预编译的事件模板批量触发事件，参见 rm::Server::triggerEvents
+     *
+     * @param[in] tpl 预编译的事件模板
+     * @param[in] events 待触发的事件列表
+     * @return 是否全部创建并触发成功
+     */
+    RMVL_W bool triggerEvents(const EventTemplate &tpl, const std::vector<Event> &events) const;
+
 private:
     UA_Server *_server{nullptr}; //!< OPC UA 服务器指针
 };
@@ -182,6 +230,19 @@ public:
      */
     RMVL_W void spinOnce();
 
+    /**
+     * @brief 启动内部执行器线程处理网络事件，立即返回
+     * @note
+     * - 事件循环由服务器自有的后台线程驱动，等待时长根据定时回调的到期时刻与网络事件
+     *   自适应计算，空闲时阻塞于网络层而非轮询，无需外部线程反复调用 `spinOnce()`
+     * @note
+     * - 与 `spin()` 互斥，二者择一使用，使用 `stop()` 停止内部执行器
+     */
+    RMVL_W void runAsync();
+
+    //! 停止服务器，并等待内部执行器线程退出
+    RMVL_W void stop();
+
     //! 停止服务器
     RMVL_W inline void shutdown() { _running = false; }
 
@@ -275,6 +336,33 @@ public:
      */
     RMVL_W bool write(const NodeId &node, const Variable &val);
 
+    /**
+     * @brief 添加高频遥测变量节点至指定父节点中
+     * @brief
+     * - 遥测节点在地址空间中与普通变量节点一致，但额外配备单写单读的无锁环形缓冲，
+     *   供 @ref writeTelemetry 无锁入队使用。事件循环在每个 spin 周期批量取出缓冲中的样本，
+     *   仅将最新样本写入地址空间并触发一次监视项评估，高频写入不再逐次锁住服务器
+     *
+     * @note 遥测节点需在并发写入开始前创建完毕
+     * @param[in] val `rm::Variable` 表示的变量
+     * @param[in] capacity 环形缓冲容量（样本数），默认为 `256`
+     * @param[in] parent_nd 指定父节点的 `NodeId`，默认为 `rm::nodeObjectsFolder`
+     * @return 添加至服务器后，对应变量节点的唯一标识 `NodeId`
+     */
+    RMVL_W NodeId addTelemetryNode(const Variable &val, uint32_t capacity = 256, const NodeId &parent_nd = nodeObjectsFolder) noexcept;
+
+    /**
+     * @brief 给指定的遥测变量节点写数据（无锁）
+     * @brief
+     * - 数据仅存入环形缓冲后立即返回，不触碰服务器内部锁，适合逐帧发布位姿、预测等遥测数据
+     *
+     * @note 每个遥测节点仅支持单个写入线程
+     * @param[in] node 既存的遥测变量节点的 `NodeId`，可参考 @ref addTelemetryNode
+     * @param[in] val 待写入的数据
+     * @return 是否入队成功，环形缓冲已满时返回 `false` 并丢弃当前样本
+     */
+    RMVL_W bool writeTelemetry(const NodeId &node, const Variable &val);
+
     /**
      * @brief 添加方法节点 MethodNode 至指定父节点中
      *
@@ -334,16 +422,95 @@ public:
      */
     RMVL_W bool triggerEvent(const Event &event) const;
 
+    /**
+     * @brief 预编译事件模板
+     * @brief
+     * - 一次性解析事件类型节点，并经由探测事件实例检查各非默认属性字段的存在性，
+     *   解析结果缓存于模板中供 @ref triggerEvents 复用，需在对应的事件类型节点
+     *   添加完毕后调用
+     *
+     * @param[in] etype `rm::EventType` 表示的事件类型
+     * @return 预编译的事件模板，解析失败时返回无效模板
+     */
+    RMVL_W EventTemplate compileEvent(const EventType &etype) const;
+
+    /**
+     * @brief 按预编译的事件模板批量触发事件
+     * @brief
+     * - 整个突发在单次调用内完成装配与触发，逐事件的路径搜索与字段存在性检查
+     *   由模板的缓存代替，适合单帧内集中触发数十个事件的场景
+     * @note 突发中的各事件共享同一触发时间戳
+     *
+     * @param[in] tpl 预编译的事件模板，参见 @ref compileEvent
+     * @param[in] events 待触发的事件列表，非默认属性按模板缓存的字段列表写入
+     * @return 是否全部创建并触发成功
+     */
+    RMVL_W bool triggerEvents(const EventTemplate &tpl, const std::vector<Event> &events) const;
+
+    /**
+     * @brief 将地址空间保存为二进制快照
+     * @brief
+     * - 递归遍历 `ObjectsFolder` 下命名空间为 `1` 的对象与变量节点，将层级结构与当前值序列化为紧凑的二进制快照文件，
+     *   配合 @ref loadSnapshot 可在进程重启时跳过逐节点构建，缩短冷启动时间
+     *
+     * @warning 方法节点、数据源变量节点、对象类型引用与各类回调无法序列化，需在恢复后重新注册
+     * @param[in] path 快照文件路径
+     * @return 是否保存成功
+     */
+    RMVL_W bool saveSnapshot(std::string_view path) const;
+
+    /**
+     * @brief 从二进制快照恢复地址空间
+     *
+     * @note 需在事件循环启动与其他节点添加之前调用，快照可参考 @ref saveSnapshot
+     * @param[in] path 快照文件路径
+     * @return 是否恢复成功
+     */
+    RMVL_W bool loadSnapshot(std::string_view path);
+
 protected:
     UA_Server *_server;          //!< OPC UA 服务器指针
     std::atomic_bool _running{}; //!< 服务器运行状态
 
 private:
+    //! 遥测节点的单写单读无锁环形缓冲
+    struct TelemetryRing
+    {
+        TelemetryRing(const NodeId &nd, uint32_t capacity) : node(nd), slots(capacity) {}
+
+        NodeId node;                 //!< 遥测变量节点 ID
+        std::vector<Variable> slots; //!< 样本槽位
+        std::atomic_uint32_t head{}; //!< 写入位置（仅写入线程修改）
+        std::atomic_uint32_t tail{}; //!< 取出位置（仅事件循环修改）
+    };
+
+    //! 批量取出各遥测环形缓冲中的样本，并将最新样本写入地址空间
+    void drainTelemetry();
+
+    std::thread _executor; //!< 内部执行器线程
+    //! 遥测节点环形缓冲映射表 `[NodeId : TelemetryRing]`
+    std::unordered_map<UA_UInt32, std::unique_ptr<TelemetryRing>> _telemetry_map;
     mutable std::vector<std::unique_ptr<ValueCallbackWrapper>> _vcb_gc;       //!< 值回调函数
     mutable std::vector<std::unique_ptr<DataSourceCallbackWrapper>> _dscb_gc; //!< 数据源回调函数
     mutable std::vector<std::unique_ptr<MethodCallback>> _mcb_gc;             //!< 方法回调函数
 };
 
+/**
+ * @brief 将内存分配统计注册表发布至 OPC UA 服务器
+ * @note
+ * - 为 rm::memstat 注册表中的每个统计通道添加一个数据源变量节点，值为
+ *   `[alloc_count, free_count, alloc_bytes, live_bytes, peak_bytes, pool_hits, pool_misses]`
+ *   的 `UInt64` 数组，每次读取时实时从注册表拉取
+ * @note
+ * - 浏览名称由通道名称将 `/` 替换为 `.` 得到，仅发布调用时已存在的通道，
+ *   后续新建的通道可再次调用本函数发布
+ *
+ * @param[in] srv OPC UA 服务器
+ * @param[in] parent_nd 指定父节点的 `NodeId`，默认为 `rm::nodeObjectsFolder`
+ * @return 各统计通道对应的变量节点的唯一标识 `NodeId` 列表
+ */
+std::vector<NodeId> publishMemStats(Server &srv, const NodeId &parent_nd = nodeObjectsFolder);
+
 //! OPC UA 服务器定时器
 class RMVL_EXPORTS_W ServerTimer final
 {
@@ -357,6 +524,22 @@ public:
      */
     RMVL_W ServerTimer(ServerView sv, double period, std::function<void(ServerView)> callback);
 
+    /**
+     * @brief 创建自适应周期的 OPC UA 服务器定时器
+     * @brief
+     * - 回调函数返回本周期内数据是否发生变化：无变化时周期按二倍退避直至 `max_period`，
+     *   有变化时立即收紧至基准周期 `period`
+     * @brief
+     * - 二倍退避使各定时器的周期保持谐波关系，相邻的到期时刻在事件循环中合并为一次唤醒，
+     *   数据静态时的唤醒次数大幅减少
+     *
+     * @param[in] sv 服务器视图
+     * @param[in] period 基准定时器周期，单位：毫秒 `ms`
+     * @param[in] max_period 退避的最大周期，单位：毫秒 `ms`
+     * @param[in] callback 定时器回调函数，返回数据是否发生变化
+     */
+    RMVL_W ServerTimer(ServerView sv, double period, double max_period, std::function<bool(ServerView)> callback);
+
     //! @cond
     ServerTimer(const ServerTimer &) = delete;
     ServerTimer(ServerTimer &&) = default;
@@ -371,6 +554,13 @@ public:
     //! 取消定时器
     RMVL_W void cancel();
 
+    /**
+     * @brief 修改定时器周期
+     *
+     * @param[in] period 新的定时器周期，单位：毫秒 `ms`
+     */
+    RMVL_W void setPeriod(double period);
+
 private:
     ServerView _sv;                      //!< 服务器视图
     std::function<void(ServerView)> _cb; //!< 定时器回调函数
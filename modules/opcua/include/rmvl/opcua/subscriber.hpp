@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <memory>
+
+#include "rmvl/core/io.hpp"
+
 #include "server.hpp"
 
 #ifdef UA_ENABLE_PUBSUB
@@ -63,7 +67,9 @@ public:
      * @brief 创建 OPC UA 订阅者
      *
      * @param[in] sub_name 订阅者名称
-     * @param[in] addr 订阅地址，形如 `opc.udp://224.0.0.22:4840`
+     * @param[in] addr 订阅地址，形如 `opc.udp://224.0.0.22:4840`，
+     *                 指定环回地址（形如 `opc.udp://127.0.0.1:4840`）时视为同主机订阅，
+     *                 改从发布者的共享内存快速通道读取数据集
      * @param[in] port 端口号，与 @ref Server::Server 的端口号概念一致，默认为 4850
      * @param[in] users 用户列表，默认为空，可参考 @ref UserConfig
      */
@@ -72,6 +78,7 @@ public:
     /**
      * @brief 订阅数据集
      *
+     * @note 同主机订阅时，发布者需先于此调用完成构造，否则共享内存通道尚未建立
      * @param[in] pub_name 发布者名称
      * @param[in] fields 数据集字段元数据列表
      * @return 订阅的变量对应的 `NodeId` 列表，每个 `NodeId` 均存在于订阅者自身的服务器中
@@ -85,6 +92,11 @@ private:
 
     std::string _name;               //!< 订阅者名称
     std::hash<std::string> _strhash; //!< 字符串哈希函数
+
+    bool _shm_lane{};                        //!< 是否启用同主机共享内存快速通道
+    std::unique_ptr<ShmClient> _shm;         //!< 共享内存通道（订阅端）
+    std::unique_ptr<ServerTimer> _shm_timer; //!< 数据集快照轮询定时器
+    std::vector<NodeId> _shm_nodes;          //!< 镜像变量节点 ID 列表
 };
 
 //! @} opcua
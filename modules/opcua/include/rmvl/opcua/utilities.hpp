@@ -59,8 +59,8 @@ public:
      */
     NodeId(const UA_NodeId &nd) : ns{nd.namespaceIndex}, id{nd.identifier.numeric} {}
 
-    NodeId(const NodeId &nd) : id(nd.id) {}
-    NodeId(NodeId &&nd) noexcept : id(nd.id) {}
+    NodeId(const NodeId &nd) : ns(nd.ns), id(nd.id) {}
+    NodeId(NodeId &&nd) noexcept : ns(nd.ns), id(nd.id) {}
 
     inline void operator=(const NodeId &nd) { ns = nd.ns, id = nd.id; }
     inline void operator=(NodeId &&nd) noexcept { ns = nd.ns, id = nd.id; }
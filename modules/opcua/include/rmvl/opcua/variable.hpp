@@ -12,6 +12,7 @@
 #pragma once
 
 #include <any>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -61,7 +62,16 @@ public:
      */
     template <typename Tp, typename Enable = std::enable_if_t<std::is_fundamental_v<Tp> && !std::is_same_v<bool, Tp>>>
     RMVL_W_SUBST("VT_List")
-    VariableType(const std::vector<Tp> &arr) : _value(arr), _data_type(DataType(typeid(Tp))), _size(arr.size()) {}
+    VariableType(const std::vector<Tp> &arr) : _value(arr), _data_type(DataType(typeid(Tp))), _size(static_cast<uint32_t>(arr.size())) {}
+
+    /**
+     * @brief 列表移动构造，设置默认值，负载所有权直接转移，不发生逐元素拷贝
+     *
+     * @tparam Tp 变量的存储数据类型，必须是非 `bool` 的基础类型
+     * @param[in] arr 列表、数组
+     */
+    template <typename Tp, typename Enable = std::enable_if_t<std::is_fundamental_v<Tp> && !std::is_same_v<bool, Tp>>>
+    VariableType(std::vector<Tp> &&arr) : _data_type(DataType(typeid(Tp))), _size(static_cast<uint32_t>(arr.size())) { _value.emplace<std::vector<Tp>>(std::move(arr)); }
 
     /**
      * @brief 将变量类型节点转化为指定类型的数据
@@ -150,6 +160,13 @@ public:
      */
     RMVL_W Variable(std::string_view str) : access_level(3U), _value(std::string(str)), _data_type(DataType(typeid(std::string))), _size(1) {}
 
+    /**
+     * @brief 字符串移动构造，负载所有权直接转移
+     *
+     * @param[in] str 字符串
+     */
+    Variable(std::string &&str) : access_level(3U), _value(std::in_place_type<std::string>, std::move(str)), _data_type(DataType(typeid(std::string))), _size(1) {}
+
     /**
      * @brief 列表构造
      *
@@ -160,6 +177,28 @@ public:
     RMVL_W_SUBST("V_List")
     Variable(const std::vector<Tp> &arr) : access_level(3U), _value(arr), _data_type(DataType(typeid(Tp))), _size(static_cast<UA_UInt32>(arr.size())) {}
 
+    /**
+     * @brief 列表移动构造，负载所有权直接转移，不发生逐元素拷贝
+     * @note 周期性更新的数组变量以此构造可避免每次更新的负载拷贝，标量负载由
+     *       `std::any` 的小对象优化存放于内部缓冲区，本就不涉及堆分配
+     *
+     * @tparam Tp 变量的存储数据类型，必须是非 `bool` 的基础类型
+     * @param[in] arr 列表、数组
+     */
+    template <typename Tp, typename Enable = std::enable_if_t<std::is_fundamental_v<Tp> && !std::is_same_v<bool, Tp>>>
+    Variable(std::vector<Tp> &&arr) : access_level(3U), _data_type(DataType(typeid(Tp))), _size(static_cast<UA_UInt32>(arr.size())) { _value.emplace<std::vector<Tp>>(std::move(arr)); }
+
+    /**
+     * @brief 区间原位构造，负载在内部存储中直接构造，不产生临时列表
+     *
+     * @tparam Tp 变量的存储数据类型，必须是非 `bool` 的基础类型
+     * @param[in] data 数据首地址
+     * @param[in] size 数据个数
+     */
+    template <typename Tp, typename Enable = std::enable_if_t<std::is_fundamental_v<Tp> && !std::is_same_v<bool, Tp>>>
+    Variable(const Tp *data, std::size_t size) : access_level(3U), _value(std::in_place_type<std::vector<Tp>>, data, data + size),
+                                                 _data_type(DataType(typeid(Tp))), _size(static_cast<UA_UInt32>(size)) {}
+
     /**
      * @brief 从变量类型创建新的变量节点
      *
@@ -168,6 +207,44 @@ public:
      */
     RMVL_W static inline Variable makeFrom(const VariableType &vtype) { return Variable(vtype); }
 
+    /**
+     * @brief 将平凡可拷贝的结构体打包为变量节点
+     * @brief
+     * - 结构体整体按字节序列一次性 `memcpy` 至 `Byte` 数组负载，多字段状态量的发布仅需一次节点写入，
+     *   无需为每个字段单独创建变量节点并逐一转换
+     * @brief
+     * - 对端使用 `rm::Variable::unpack` 以相同的结构体类型还原数据
+     *
+     * @warning 负载按本机内存布局传输，通信双方需使用相同的结构体定义、对齐方式与字节序
+     *
+     * @tparam Tp 平凡可拷贝的结构体类型
+     * @param[in] status 待打包的结构体数据
+     * @return 打包后的变量节点
+     */
+    template <typename Tp, typename Enable = std::enable_if_t<std::is_trivially_copyable_v<Tp> && !std::is_fundamental_v<Tp>>>
+    static inline Variable pack(const Tp &status)
+    {
+        // 字节负载经区间原位构造直接写入内部存储，不产生临时列表及其拷贝
+        return Variable(reinterpret_cast<const uint8_t *>(&status), sizeof(Tp));
+    }
+
+    /**
+     * @brief 将 `rm::Variable::pack` 打包的变量节点还原为结构体
+     *
+     * @tparam Tp 平凡可拷贝的结构体类型，需与打包时的类型一致
+     * @param[in] val 待还原的变量节点
+     * @return 还原后的结构体数据 @note 负载字节数与结构体大小不一致时返回默认构造的结构体
+     */
+    template <typename Tp, typename Enable = std::enable_if_t<std::is_trivially_copyable_v<Tp> && !std::is_fundamental_v<Tp>>>
+    static inline Tp unpack(const Variable &val)
+    {
+        Tp retval{};
+        const auto &bytes = std::any_cast<const std::vector<uint8_t> &>(val.data());
+        if (bytes.size() == sizeof(Tp))
+            std::memcpy(&retval, bytes.data(), sizeof(Tp));
+        return retval;
+    }
+
     /**
      * @brief 比较两个变量是否相等，当且仅当两个变量的数据类型、维数、数据值均相等时返回
      *        `true`，而不考虑变量的名称、描述等信息
@@ -227,7 +304,7 @@ public:
      *
      * @return 变量类型
      */
-    RMVL_W inline const VariableType type() const { return _type; }
+    RMVL_W inline const VariableType &type() const { return _type; }
 
     //! 获取数据
     inline const auto &data() const { return _value; }
@@ -0,0 +1,75 @@
+/**
+ * @file perf_opcua.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief OPC UA PubSub 基准测试
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <thread>
+
+#include "rmvl/opcua/publisher.hpp"
+#include "rmvl/opcua/subscriber.hpp"
+
+#ifdef UA_ENABLE_PUBSUB
+
+#include <benchmark/benchmark.h>
+
+namespace rm_test
+{
+
+// 发布端单次写入：从变量写入到数据集发布路径的单次开销
+static void pubsub_write(benchmark::State &state)
+{
+    rm::Publisher pub("PerfNumberPub", "opc.udp://127.0.0.1", 8020);
+    uaCreateVariable(perf_double, 1.0);
+    auto node_id = pub.addVariableNode(perf_double);
+    std::thread t(&rm::Publisher::spin, &pub);
+    pub.publish({{"DoubleDemo", node_id}}, 10);
+
+    double val{};
+    for (auto _ : state)
+        pub.write(node_id, ++val);
+
+    pub.shutdown();
+    t.join();
+}
+
+// 发布-订阅往返：发布端写入后订阅端读取镜像变量
+static void pubsub_round_trip(benchmark::State &state)
+{
+    rm::Publisher pub("PerfRTNumberPub", "opc.udp://127.0.0.1", 8030);
+    uaCreateVariable(perf_double, 1.0);
+    auto node_id = pub.addVariableNode(perf_double);
+    std::thread t1(&rm::Publisher::spin, &pub);
+    pub.publish({{"DoubleDemo", node_id}}, 10);
+
+    rm::Subscriber sub("PerfRTNumberSub", "opc.udp://127.0.0.1:8030", 8031);
+    std::thread t2(&rm::Subscriber::spin, &sub);
+    rm::Variable double_demo_var = 0.0;
+    double_demo_var.browse_name = "DoubleDemo";
+    auto nodes = sub.subscribe("PerfRTNumberPub", {rm::FieldMetaData::makeFrom(double_demo_var)});
+
+    double val{};
+    for (auto _ : state)
+    {
+        pub.write(node_id, ++val);
+        auto sub_val = sub.read(nodes.front());
+        benchmark::DoNotOptimize(sub_val);
+    }
+
+    pub.shutdown();
+    sub.shutdown();
+    t1.join();
+    t2.join();
+}
+
+BENCHMARK(pubsub_write)->Name("opcua pubsub write - by rmvl");
+BENCHMARK(pubsub_round_trip)->Name("opcua pubsub round trip - by rmvl");
+
+} // namespace rm_test
+
+#endif // UA_ENABLE_PUBSUB
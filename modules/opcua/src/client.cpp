@@ -9,12 +9,16 @@
  *
  */
 
+#include <algorithm>
+
 #include <open62541/client.h>
 #include <open62541/client_config_default.h>
 #include <open62541/client_highlevel.h>
+#include <open62541/client_highlevel_async.h>
 #include <open62541/plugin/log_stdout.h>
 
 #include "rmvl/core/str.hpp"
+#include "rmvl/core/timer.hpp"
 #include "rmvl/core/util.hpp"
 #include "rmvl/opcua/client.hpp"
 #include "rmvlpara/opcua.hpp"
@@ -64,7 +68,12 @@ Client::Client(std::string_view address, const UserConfig &usr)
         ERROR_("Failed to connect to the server: %s", address.data());
         UA_Client_delete(_client);
         _client = nullptr;
+        return;
     }
+    // 保存连接信息用于会话重建
+    _address = address;
+    _user = usr;
+    _state.store(ClientState::Connected, std::memory_order_relaxed);
 }
 
 bool Client::shutdown()
@@ -79,6 +88,7 @@ bool Client::shutdown()
     }
     UA_Client_delete(_client);
     _client = nullptr;
+    _state.store(ClientState::Disconnected, std::memory_order_relaxed);
     return true;
 }
 
@@ -88,24 +98,56 @@ Client::~Client()
         shutdown();
 }
 
+//! 由底层会话状态解算连接状态
+static ClientState sessionState(UA_Client *p_client)
+{
+    UA_SecureChannelState ch_state{};
+    UA_SessionState ss_state{};
+    UA_StatusCode conn_status{};
+    UA_Client_getState(p_client, &ch_state, &ss_state, &conn_status);
+    return ss_state == UA_SESSIONSTATE_ACTIVATED ? ClientState::Connected : ClientState::Reconnecting;
+}
+
 void Client::spin() const
 {
     bool warning{};
     while (true)
     {
         auto status = UA_Client_run_iterate(_client, para::opcua_param.CLIENT_WAIT_TIMEOUT);
+        _state.store(sessionState(_client), std::memory_order_relaxed);
         if (!warning && status != UA_STATUSCODE_GOOD)
         {
             WARNING_("No events and message received, spinning indefinitely, error status: %s", UA_StatusCode_name(status));
             warning = true;
         }
         warning = (status == UA_STATUSCODE_GOOD) ? false : warning;
+#ifdef __cpp_impl_coroutine
+        // 恢复完成队列中已就绪的异步调用协程
+        while (!_ready_calls.empty())
+        {
+            auto ready = std::move(_ready_calls);
+            _ready_calls.clear();
+            for (auto &handle : ready)
+                handle.resume();
+        }
+#endif
     }
 }
 
 void Client::spinOnce() const
 {
     UA_Client_run_iterate(_client, para::opcua_param.CLIENT_WAIT_TIMEOUT);
+    _state.store(sessionState(_client), std::memory_order_relaxed);
+#ifdef __cpp_impl_coroutine
+    // 恢复完成队列中已就绪的异步调用协程
+    while (!_ready_calls.empty())
+    {
+        auto ready = std::move(_ready_calls);
+        _ready_calls.clear();
+        for (auto &handle : ready)
+            handle.resume();
+    }
+#endif
 }
 
 ////////////////////////// 功能配置 //////////////////////////
@@ -114,14 +156,17 @@ static NodeId clientFindNode(UA_Client *p_cli, std::string_view browse_path, con
 {
     RMVL_DbgAssert(p_cli != nullptr);
 
-    auto paths = str::split(browse_path, "/");
-    if (paths.empty())
+    // 浏览路径层级有限，分割结果置于栈上，避免每次查找的堆分配
+    std::string_view paths[32];
+    std::size_t path_num = str::split(browse_path, "/", paths, std::size(paths));
+    RMVL_Assert(path_num <= std::size(paths));
+    if (path_num == 0)
         return src_nd;
     ClientView cv{p_cli};
     NodeId retval = src_nd;
-    for (const auto &path : paths)
+    for (std::size_t i = 0; i < path_num; ++i)
     {
-        retval = retval | cv.node(path);
+        retval = retval | cv.node(paths[i]);
         if (retval.empty())
             break;
     }
@@ -146,7 +191,8 @@ static bool clientWrite(UA_Client *p_client, const NodeId &node, const Variable
 {
     RMVL_DbgAssert(p_client != nullptr);
 
-    UA_Variant new_variant = helper::cvtVariable(val);
+    // 数组负载借用 val 的内部存储，请求在发送时编码，写入过程不发生负载拷贝
+    UA_Variant new_variant = helper::cvtVariableBorrowed(val);
     auto status = UA_Client_writeValueAttribute(p_client, node, &new_variant);
     UA_Variant_clear(&new_variant);
     if (status != UA_STATUSCODE_GOOD)
@@ -157,12 +203,233 @@ static bool clientWrite(UA_Client *p_client, const NodeId &node, const Variable
     return true;
 }
 
+//! 读数据的 `noexcept` 快速路径，失败诊断记入环形缓冲
+static expected<Variable> clientTryRead(UA_Client *p_client, const NodeId &node) noexcept
+{
+    if (p_client == nullptr)
+        return (diagLog(Errc::NullPtr, "opcua tryRead"), unexpected{Errc::NullPtr});
+    UA_Variant p_val;
+    UA_Variant_init(&p_val);
+    if (UA_Client_readValueAttribute(p_client, node, &p_val) != UA_STATUSCODE_GOOD)
+        return (diagLog(Errc::IOError, "opcua tryRead"), unexpected{Errc::IOError});
+    Variable retval = helper::cvtVariable(p_val);
+    UA_Variant_clear(&p_val);
+    return retval;
+}
+
+//! 写数据的 `noexcept` 快速路径，失败诊断记入环形缓冲
+static expected<void> clientTryWrite(UA_Client *p_client, const NodeId &node, const Variable &val) noexcept
+{
+    if (p_client == nullptr)
+        return (diagLog(Errc::NullPtr, "opcua tryWrite"), unexpected{Errc::NullPtr});
+    // 数组负载借用 val 的内部存储，请求在发送时编码，写入过程不发生负载拷贝
+    UA_Variant new_variant = helper::cvtVariableBorrowed(val);
+    auto status = UA_Client_writeValueAttribute(p_client, node, &new_variant);
+    UA_Variant_clear(&new_variant);
+    if (status != UA_STATUSCODE_GOOD)
+        return (diagLog(Errc::IOError, "opcua tryWrite"), unexpected{Errc::IOError});
+    return {};
+}
+
 NodeId Client::find(std::string_view browse_path, const NodeId &src_nd) const noexcept { return clientFindNode(_client, browse_path, src_nd); }
 
 Variable Client::read(const NodeId &nd) const { return clientRead(_client, nd); }
 
 bool Client::write(const NodeId &nd, const Variable &val) const { return clientWrite(_client, nd, val); }
 
+expected<Variable> Client::tryRead(const NodeId &nd) const noexcept { return clientTryRead(_client, nd); }
+
+expected<void> Client::tryWrite(const NodeId &nd, const Variable &val) const noexcept { return clientTryWrite(_client, nd, val); }
+
+/**
+ * @brief 构造多节点 `Read` 服务请求
+ *
+ * @param[in] nodes 变量节点列表
+ * @param[out] rvids 读取项列表，生命周期需覆盖请求的发送
+ * @return `Read` 服务请求，读取项为浅拷贝，无需清理
+ */
+static UA_ReadRequest makeReadRequest(const std::vector<NodeId> &nodes, std::vector<UA_ReadValueId> &rvids)
+{
+    rvids.resize(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        UA_ReadValueId_init(&rvids[i]);
+        rvids[i].nodeId = nodes[i];
+        rvids[i].attributeId = UA_ATTRIBUTEID_VALUE;
+    }
+    UA_ReadRequest request;
+    UA_ReadRequest_init(&request);
+    request.nodesToRead = rvids.data();
+    request.nodesToReadSize = rvids.size();
+    return request;
+}
+
+/**
+ * @brief 构造多节点 `Write` 服务请求
+ *
+ * @param[in] nodes 变量节点列表
+ * @param[in] vals 待写入的数据列表
+ * @param[out] wvs 写入项列表，生命周期需覆盖请求的发送，写入值统一使用 `UA_Variant_clear` 逐项清理
+ * @return `Write` 服务请求
+ */
+static UA_WriteRequest makeWriteRequest(const std::vector<NodeId> &nodes, const Variables &vals, std::vector<UA_WriteValue> &wvs)
+{
+    wvs.resize(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        UA_WriteValue_init(&wvs[i]);
+        wvs[i].nodeId = nodes[i];
+        wvs[i].attributeId = UA_ATTRIBUTEID_VALUE;
+        wvs[i].value.hasValue = true;
+        // 数组负载借用 vals 的内部存储，请求在发送时编码，构造过程不发生负载拷贝
+        wvs[i].value.value = helper::cvtVariableBorrowed(vals[i]);
+    }
+    UA_WriteRequest request;
+    UA_WriteRequest_init(&request);
+    request.nodesToWrite = wvs.data();
+    request.nodesToWriteSize = wvs.size();
+    return request;
+}
+
+//! 将 `Read` 服务响应转换为数据列表，未成功读取的项为空
+static Variables cvtReadResponse(const UA_ReadResponse &response, size_t expected_size)
+{
+    if (response.responseHeader.serviceResult != UA_STATUSCODE_GOOD || response.resultsSize != expected_size)
+    {
+        ERROR_("Failed to read values from the nodes, error: %s", UA_StatusCode_name(response.responseHeader.serviceResult));
+        return {};
+    }
+    Variables retval;
+    retval.reserve(expected_size);
+    for (size_t i = 0; i < expected_size; ++i)
+        retval.push_back(response.results[i].hasValue ? helper::cvtVariable(response.results[i].value) : Variable{});
+    return retval;
+}
+
+//! 检查 `Write` 服务响应，所有节点均写入成功时返回 `true`
+static bool checkWriteResponse(const UA_WriteResponse &response, size_t expected_size)
+{
+    if (response.responseHeader.serviceResult != UA_STATUSCODE_GOOD || response.resultsSize != expected_size)
+    {
+        ERROR_("Failed to write values to the nodes, error: %s", UA_StatusCode_name(response.responseHeader.serviceResult));
+        return false;
+    }
+    for (size_t i = 0; i < expected_size; ++i)
+        if (response.results[i] != UA_STATUSCODE_GOOD)
+        {
+            ERROR_("Failed to write value to the node at index %zu, error: %s", i, UA_StatusCode_name(response.results[i]));
+            return false;
+        }
+    return true;
+}
+
+Variables Client::readAll(const std::vector<NodeId> &nodes) const
+{
+    RMVL_DbgAssert(_client != nullptr);
+
+    if (nodes.empty())
+        return {};
+    std::vector<UA_ReadValueId> rvids;
+    UA_ReadRequest request = makeReadRequest(nodes, rvids);
+    UA_ReadResponse response = UA_Client_Service_read(_client, request);
+    Variables retval = cvtReadResponse(response, nodes.size());
+    UA_ReadResponse_clear(&response);
+    return retval;
+}
+
+bool Client::writeAll(const std::vector<NodeId> &nodes, const Variables &vals) const
+{
+    RMVL_DbgAssert(_client != nullptr);
+
+    if (nodes.size() != vals.size())
+    {
+        ERROR_("The size of \"nodes\" (%zu) is not equal to the size of \"vals\" (%zu)", nodes.size(), vals.size());
+        return false;
+    }
+    if (nodes.empty())
+        return true;
+    std::vector<UA_WriteValue> wvs;
+    UA_WriteRequest request = makeWriteRequest(nodes, vals, wvs);
+    UA_WriteResponse response = UA_Client_Service_write(_client, request);
+    bool retval = checkWriteResponse(response, nodes.size());
+    for (auto &wv : wvs)
+        UA_Variant_clear(&wv.value.value);
+    UA_WriteResponse_clear(&response);
+    return retval;
+}
+
+//! 异步批量读请求上下文，响应到达时完成 `std::future` 并自行销毁
+struct AsyncReadContext
+{
+    std::promise<Variables> promise; //!< 数据列表的 `std::promise`
+    size_t expected_size{};          //!< 读取项数量
+};
+
+static void async_read_cb(UA_Client *, void *userdata, UA_UInt32, UA_ReadResponse *response)
+{
+    std::unique_ptr<AsyncReadContext> context(reinterpret_cast<AsyncReadContext *>(userdata));
+    context->promise.set_value(cvtReadResponse(*response, context->expected_size));
+}
+
+std::future<Variables> Client::readAllAsync(const std::vector<NodeId> &nodes) const
+{
+    RMVL_DbgAssert(_client != nullptr);
+
+    std::vector<UA_ReadValueId> rvids;
+    UA_ReadRequest request = makeReadRequest(nodes, rvids);
+    auto context = std::make_unique<AsyncReadContext>();
+    context->expected_size = nodes.size();
+    auto retval = context->promise.get_future();
+    auto status = UA_Client_sendAsyncReadRequest(_client, &request, async_read_cb, context.get(), nullptr);
+    if (status != UA_STATUSCODE_GOOD)
+    {
+        ERROR_("Failed to send the async read request, error: %s", UA_StatusCode_name(status));
+        return {};
+    }
+    // 请求发送成功后，上下文的所有权移交回调函数
+    context.release();
+    return retval;
+}
+
+//! 异步批量写请求上下文，响应到达时完成 `std::future` 并自行销毁
+struct AsyncWriteContext
+{
+    std::promise<bool> promise; //!< 是否全部写入成功的 `std::promise`
+    size_t expected_size{};     //!< 写入项数量
+};
+
+static void async_write_cb(UA_Client *, void *userdata, UA_UInt32, UA_WriteResponse *response)
+{
+    std::unique_ptr<AsyncWriteContext> context(reinterpret_cast<AsyncWriteContext *>(userdata));
+    context->promise.set_value(checkWriteResponse(*response, context->expected_size));
+}
+
+std::future<bool> Client::writeAllAsync(const std::vector<NodeId> &nodes, const Variables &vals) const
+{
+    RMVL_DbgAssert(_client != nullptr);
+
+    if (nodes.size() != vals.size())
+    {
+        ERROR_("The size of \"nodes\" (%zu) is not equal to the size of \"vals\" (%zu)", nodes.size(), vals.size());
+        return {};
+    }
+    std::vector<UA_WriteValue> wvs;
+    UA_WriteRequest request = makeWriteRequest(nodes, vals, wvs);
+    auto context = std::make_unique<AsyncWriteContext>();
+    context->expected_size = nodes.size();
+    auto retval = context->promise.get_future();
+    auto status = UA_Client_sendAsyncWriteRequest(_client, &request, async_write_cb, context.get(), nullptr);
+    for (auto &wv : wvs)
+        UA_Variant_clear(&wv.value.value);
+    if (status != UA_STATUSCODE_GOOD)
+    {
+        ERROR_("Failed to send the async write request, error: %s", UA_StatusCode_name(status));
+        return {};
+    }
+    context.release();
+    return retval;
+}
+
 std::pair<bool, Variables> Client::call(const NodeId &obj_nd, std::string_view name, const Variables &inputs) const
 {
     RMVL_DbgAssert(_client != nullptr);
@@ -201,6 +468,69 @@ std::pair<bool, Variables> Client::call(const NodeId &obj_nd, std::string_view n
     return {true, outputs};
 }
 
+#ifdef __cpp_impl_coroutine
+
+static void async_call_cb(UA_Client *, void *userdata, UA_UInt32, UA_CallResponse *response)
+{
+    auto awaiter = reinterpret_cast<Client::CallAwaiter *>(userdata);
+    bool res{};
+    Variables outputs;
+    if (response->responseHeader.serviceResult != UA_STATUSCODE_GOOD)
+        ERROR_("Failed to call the method asynchronously, error: %s", UA_StatusCode_name(response->responseHeader.serviceResult));
+    else if (response->resultsSize != 1 || response->results[0].statusCode != UA_STATUSCODE_GOOD)
+        ERROR_("Failed to call the method asynchronously, error: %s",
+               UA_StatusCode_name(response->resultsSize == 1 ? response->results[0].statusCode : UA_STATUSCODE_BADUNKNOWNRESPONSE));
+    else
+    {
+        res = true;
+        outputs.reserve(response->results[0].outputArgumentsSize);
+        for (size_t i = 0; i < response->results[0].outputArgumentsSize; ++i)
+            outputs.push_back(helper::cvtVariable(response->results[0].outputArguments[i]));
+    }
+    awaiter->complete(res, std::move(outputs));
+}
+
+bool Client::CallAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    _handle = handle;
+    std::vector<UA_Variant> input_variants;
+    input_variants.reserve(_inputs.size());
+    for (const auto &input : _inputs)
+        input_variants.emplace_back(helper::cvtVariable(input));
+    auto status = UA_Client_call_async(_cli->_client, _obj_nd, _method_nd, input_variants.size(),
+                                       input_variants.data(), async_call_cb, this, nullptr);
+    for (auto &input_variant : input_variants)
+        UA_Variant_clear(&input_variant);
+    if (status != UA_STATUSCODE_GOOD)
+    {
+        ERROR_("Failed to send the async call request, error: %s", UA_StatusCode_name(status));
+        // 发送失败时无需维持挂起状态，立即以失败结果恢复
+        return false;
+    }
+    return true;
+}
+
+void Client::CallAwaiter::complete(bool res, Variables &&outputs) noexcept
+{
+    _res = res;
+    _outputs = std::move(outputs);
+    // 加入完成队列，由事件循环在本轮事件处理完毕后统一恢复
+    _cli->_ready_calls.push_back(_handle);
+}
+
+Client::CallAwaiter Client::async_call(const NodeId &obj_nd, std::string_view name, const Variables &inputs) const
+{
+    RMVL_DbgAssert(_client != nullptr);
+
+    // 获取方法节点
+    NodeId method_node = obj_nd | node(name);
+    if (method_node.empty())
+        ERROR_("Failed to find the method node: %s", name.data());
+    return {this, obj_nd, method_node, inputs};
+}
+
+#endif // __cpp_impl_coroutine
+
 NodeId Client::addViewNode(const View &view) const
 {
     RMVL_DbgAssert(_client != nullptr);
@@ -262,33 +592,76 @@ static void data_change_notify_cb(UA_Client *client, UA_UInt32, void *, UA_UInt3
     on_change(client, helper::cvtVariable(value->value));
 }
 
-bool Client::monitor(NodeId nd, DataChangeNotificationCallback on_change, uint32_t q_size)
+bool Client::createVariableMonitor(const NodeId &nd, DataChangeNotificationCallback *context, const MonitorOptions &options)
 {
-    RMVL_DbgAssert(_client != nullptr);
-
     // 创建订阅
     UA_CreateSubscriptionResponse resp;
     if (!createSubscription(_client, resp))
         return false;
     // 创建监视项请求
     UA_MonitoredItemCreateRequest request = UA_MonitoredItemCreateRequest_default(nd);
-    request.requestedParameters.samplingInterval = para::opcua_param.SAMPLING_INTERVAL;
+    request.requestedParameters.samplingInterval = options.sampling_interval > 0. ? options.sampling_interval : para::opcua_param.SAMPLING_INTERVAL;
     request.requestedParameters.discardOldest = true;
-    request.requestedParameters.queueSize = q_size;
+    request.requestedParameters.queueSize = options.q_size;
+    // 服务器侧死区过滤，被过滤的变化不会进入通知队列
+    UA_DataChangeFilter filter;
+    UA_DataChangeFilter_init(&filter);
+    if (options.deadband_type != DeadbandType::None)
+    {
+        if (options.deadband <= 0. || (options.deadband_type == DeadbandType::Percent && options.deadband > 100.))
+        {
+            ERROR_("Invalid deadband value: %g", options.deadband);
+            return false;
+        }
+        filter.trigger = UA_DATACHANGETRIGGER_STATUSVALUE;
+        filter.deadbandType = options.deadband_type == DeadbandType::Absolute ? UA_DEADBANDTYPE_ABSOLUTE : UA_DEADBANDTYPE_PERCENT;
+        filter.deadbandValue = options.deadband;
+        request.requestedParameters.filter.encoding = UA_EXTENSIONOBJECT_DECODED_NODELETE;
+        request.requestedParameters.filter.content.decoded.type = &UA_TYPES[UA_TYPES_DATACHANGEFILTER];
+        request.requestedParameters.filter.content.decoded.data = &filter;
+    }
     // 创建监视器
-    auto context = std::make_unique<DataChangeNotificationCallback>(on_change);
     UA_MonitoredItemCreateResult result = UA_Client_MonitoredItems_createDataChange(
-        _client, resp.subscriptionId, UA_TIMESTAMPSTORETURN_BOTH, request, context.get(), data_change_notify_cb, nullptr);
+        _client, resp.subscriptionId, UA_TIMESTAMPSTORETURN_BOTH, request, context, data_change_notify_cb, nullptr);
     if (result.statusCode != UA_STATUSCODE_GOOD)
     {
         ERROR_("Failed to create variable monitor, error: %s", UA_StatusCode_name(result.statusCode));
         return false;
     }
-    _dccb_gc.push_back(std::move(context));
     _monitor_map[nd.data().identifier.numeric] = {resp.subscriptionId, result.monitoredItemId};
     return true;
 }
 
+bool Client::monitor(NodeId nd, DataChangeNotificationCallback on_change, uint32_t q_size)
+{
+    MonitorOptions options{};
+    options.q_size = q_size;
+    return monitor(nd, std::move(on_change), options);
+}
+
+bool Client::monitor(NodeId nd, DataChangeNotificationCallback on_change, const MonitorOptions &options)
+{
+    RMVL_DbgAssert(_client != nullptr);
+
+    // 创建本地缓存槽，数据变更通知到达时同步更新缓存
+    auto &cache = _cache_map[nd.data().identifier.numeric];
+    if (cache == nullptr)
+        cache = std::make_unique<MonitorCache>();
+    auto context = std::make_unique<DataChangeNotificationCallback>(
+        [p_cache = cache.get(), f = std::move(on_change)](ClientView cv, const Variable &val) {
+            std::atomic_store_explicit(&p_cache->value, std::make_shared<const Variable>(val), std::memory_order_release);
+            p_cache->seq.fetch_add(1, std::memory_order_release);
+            if (f)
+                f(cv, val);
+        });
+    if (!createVariableMonitor(nd, context.get(), options))
+        return false;
+    // 记录监视信息，会话重建且订阅转移失败时用于批量重建监视项
+    _var_monitors.push_back({nd, context.get(), options});
+    _dccb_gc.push_back(std::move(context));
+    return true;
+}
+
 static void event_notify_cb(UA_Client *client, UA_UInt32, void *, UA_UInt32, void *context, size_t events_num, UA_Variant *event_fields)
 {
     auto &on_event = *reinterpret_cast<EventNotificationCallback *>(context);
@@ -298,9 +671,8 @@ static void event_notify_cb(UA_Client *client, UA_UInt32, void *, UA_UInt32, voi
     on_event(client, datas);
 }
 
-bool Client::monitor(const std::vector<std::string> &names, EventNotificationCallback on_event)
+bool Client::createEventMonitor(const std::vector<std::string> &names, EventNotificationCallback *context)
 {
-    RMVL_DbgAssert(_client != nullptr);
     // 创建订阅
     UA_CreateSubscriptionResponse sub_resp;
     if (!createSubscription(_client, sub_resp))
@@ -338,14 +710,25 @@ bool Client::monitor(const std::vector<std::string> &names, EventNotificationCal
     request_item.requestedParameters.filter.content.decoded.data = &filter;
     request_item.requestedParameters.filter.content.decoded.type = &UA_TYPES[UA_TYPES_EVENTFILTER];
     // 创建事件监视器
-    auto context = std::make_unique<EventNotificationCallback>(on_event);
     UA_MonitoredItemCreateResult result = UA_Client_MonitoredItems_createEvent(
-        _client, sub_resp.subscriptionId, UA_TIMESTAMPSTORETURN_BOTH, request_item, context.get(), event_notify_cb, nullptr);
+        _client, sub_resp.subscriptionId, UA_TIMESTAMPSTORETURN_BOTH, request_item, context, event_notify_cb, nullptr);
     if (result.statusCode != UA_STATUSCODE_GOOD)
     {
         ERROR_("Failed to create event monitor, error: %s", UA_StatusCode_name(result.statusCode));
         return false;
     }
+    return true;
+}
+
+bool Client::monitor(const std::vector<std::string> &names, EventNotificationCallback on_event)
+{
+    RMVL_DbgAssert(_client != nullptr);
+
+    auto context = std::make_unique<EventNotificationCallback>(on_event);
+    if (!createEventMonitor(names, context.get()))
+        return false;
+    // 记录监视信息，会话重建且订阅转移失败时用于批量重建监视项
+    _event_monitors.push_back({names, context.get()});
     _encb_gc.push_back(std::move(context));
     return true;
 }
@@ -365,14 +748,98 @@ bool Client::remove(NodeId nd)
         return false;
     }
     _monitor_map.erase(nd.data().identifier.numeric);
+    _var_monitors.erase(std::remove_if(_var_monitors.begin(), _var_monitors.end(),
+                                       [id = nd.data().identifier.numeric](const VarMonitorInfo &info) {
+                                           return info.nd.data().identifier.numeric == id;
+                                       }),
+                        _var_monitors.end());
+    return true;
+}
+
+bool Client::reconnect()
+{
+    if (_client == nullptr)
+        return false;
+    // 限制会话重建尝试频率，允许在主循环中逐帧调用
+    double now = Timer::now();
+    if (now - _last_attempt < para::opcua_param.RECONNECT_INTERVAL * 1e-3)
+        return false;
+    _last_attempt = now;
+    _state.store(ClientState::Reconnecting, std::memory_order_relaxed);
+    // 复用原客户端对象重建连接，服务端会话未超时的场合将直接激活原会话（快速路径），
+    // 原会话的订阅与监视项随之恢复，无需任何转移或重建操作
+    UA_StatusCode status{};
+    if (_user.id.empty() || _user.passwd.empty())
+        status = UA_Client_connect(_client, _address.c_str());
+    else
+        status = UA_Client_connectUsername(_client, _address.c_str(), _user.id.c_str(), _user.passwd.c_str());
+    if (status != UA_STATUSCODE_GOOD)
+    {
+        ERROR_("Failed to reconnect to the server \"%s\", error: %s", _address.c_str(), UA_StatusCode_name(status));
+        return false;
+    }
+    // 会话被重新创建的场合，优先尝试 TransferSubscriptions 服务将旧会话的订阅整体转移至新会话
+    bool transferred{true};
+    if (!_monitor_map.empty())
+    {
+        std::vector<UA_UInt32> sub_ids;
+        sub_ids.reserve(_monitor_map.size());
+        for (const auto &[id, sub_mon] : _monitor_map)
+            if (std::find(sub_ids.begin(), sub_ids.end(), sub_mon[0]) == sub_ids.end())
+                sub_ids.push_back(sub_mon[0]);
+        UA_TransferSubscriptionsRequest request;
+        UA_TransferSubscriptionsRequest_init(&request);
+        request.subscriptionIds = sub_ids.data();
+        request.subscriptionIdsSize = sub_ids.size();
+        request.sendInitialValues = true;
+        UA_TransferSubscriptionsResponse response = UA_Client_Service_transferSubscriptions(_client, request);
+        if (response.responseHeader.serviceResult != UA_STATUSCODE_GOOD || response.resultsSize != sub_ids.size())
+            transferred = false;
+        else
+            for (size_t i = 0; i < response.resultsSize; ++i)
+                if (response.results[i].statusCode != UA_STATUSCODE_GOOD)
+                    transferred = false;
+        UA_TransferSubscriptionsResponse_clear(&response);
+    }
+    // 订阅转移失败（如服务端不支持该服务或旧会话已被清理）的场合，按记录的监视信息批量重建，
+    // 回调上下文与本地缓存槽均被保留，readCached 在重建期间始终可用
+    if (!transferred)
+    {
+        _monitor_map.clear();
+        for (const auto &info : _var_monitors)
+            if (!createVariableMonitor(info.nd, info.context, info.options))
+                WARNING_("Failed to recreate variable monitor, node id: %d", info.nd.data().identifier.numeric);
+        for (const auto &info : _event_monitors)
+            if (!createEventMonitor(info.names, info.context))
+                WARNING_("Failed to recreate event monitor");
+    }
+    _state.store(ClientState::Connected, std::memory_order_relaxed);
     return true;
 }
 
+std::pair<Variable, uint32_t> Client::readCached(const NodeId &nd) const
+{
+    RMVL_DbgAssert(_client != nullptr);
+
+    auto it = _cache_map.find(nd.data().identifier.numeric);
+    if (it == _cache_map.end())
+        return {Variable{}, 0};
+    const auto &cache = *it->second;
+    // 先取变更序号，再以原子方式获取已发布的变量，两者均为 acquire 语义
+    uint32_t seq = cache.seq.load(std::memory_order_acquire);
+    auto p_val = std::atomic_load_explicit(&cache.value, std::memory_order_acquire);
+    if (p_val == nullptr)
+        return {Variable{}, 0};
+    return {*p_val, seq};
+}
+
 //////////////////////// 客户端视图 ////////////////////////
 
 NodeId ClientView::find(std::string_view browse_path, const NodeId &src_nd) const noexcept { return clientFindNode(_client, browse_path, src_nd); }
 Variable ClientView::read(const NodeId &nd) const { return clientRead(_client, nd); }
 bool ClientView::write(const NodeId &nd, const Variable &val) const { return clientWrite(_client, nd, val); }
+expected<Variable> ClientView::tryRead(const NodeId &nd) const noexcept { return clientTryRead(_client, nd); }
+expected<void> ClientView::tryWrite(const NodeId &nd, const Variable &val) const noexcept { return clientTryWrite(_client, nd, val); }
 
 /////////////////////// 客户端定时器 ///////////////////////
 
@@ -392,6 +859,41 @@ ClientTimer::ClientTimer(ClientView cv, double period, std::function<void(Client
     }
 }
 
+ClientTimer::ClientTimer(ClientView cv, double period, double max_period, std::function<bool(ClientView)> callback) : _cv(cv)
+{
+    //! 自适应周期状态
+    struct State
+    {
+        double base;   //!< 基准周期
+        double max;    //!< 退避的最大周期
+        double cur;    //!< 当前周期
+        uint64_t id{}; //!< 定时器 ID
+    };
+    auto state = std::make_shared<State>(State{period, max_period, period, 0});
+    _cb = [state, f = std::move(callback)](ClientView view) {
+        // 无变化时二倍退避，有变化时立即收紧至基准周期
+        double next = f(view) ? state->base : std::min(state->cur * 2, state->max);
+        if (next != state->cur)
+        {
+            state->cur = next;
+            UA_Client_changeRepeatedCallbackInterval(view.get(), state->id, next);
+        }
+    };
+    auto status = UA_Client_addRepeatedCallback(_cv.get(), timer_cb, &_cb, period, &_id);
+    if (status != UA_STATUSCODE_GOOD)
+    {
+        ERROR_("Failed to add repeated callback: %s", UA_StatusCode_name(status));
+        _id = 0;
+    }
+    state->id = _id;
+}
+
+void ClientTimer::setPeriod(double period)
+{
+    if (_id != 0)
+        UA_Client_changeRepeatedCallbackInterval(_cv.get(), _id, period);
+}
+
 void ClientTimer::cancel()
 {
     if (_id != 0)
@@ -26,6 +26,21 @@ namespace rm::helper
  */
 UA_Variant cvtVariable(const Variable &val) noexcept;
 
+/**
+ * @brief `rm::Variable` 转化为借用内部存储的 `UA_Variant`（零拷贝）
+ * @brief
+ * - 数组负载不发生任何数据拷贝，返回的 `UA_Variant` 直接引用 `val` 内部的数组存储，
+ *   存储方式为 `UA_VARIANT_DATA_NODELETE`，`UA_Variant_clear` 对其不产生释放行为
+ * @brief
+ * - 标量与字符串负载仍走深拷贝路径，二者的清理行为与 @ref cvtVariable 一致，
+ *   调用方统一使用 `UA_Variant_clear` 清理即可
+ *
+ * @warning `val` 的生命周期需覆盖返回值的全部使用过程
+ * @param[in] val `rm::Variable` 表示的变量
+ * @return `UA_Variant` 表示变量节点的内置数据
+ */
+UA_Variant cvtVariableBorrowed(const Variable &val) noexcept;
+
 /**
  * @brief `UA_Variant` 转化为 `rm::Variable`
  *
@@ -35,6 +50,26 @@ UA_Variant cvtVariable(const Variable &val) noexcept;
  */
 Variable cvtVariable(const UA_Variant &p_val) noexcept;
 
+/**
+ * @brief 将 `rm::Variable` 序列化为字节流
+ * @brief
+ * - 按照「类型标志 + 元素个数 + 负载」的自描述布局追加写入 `buf`，
+ *   供同主机共享内存快速通道交换数据集快照使用
+ *
+ * @param[in] val `rm::Variable` 表示的变量
+ * @param[in,out] buf 追加写入的目标缓冲区
+ */
+void encodeVariable(const Variable &val, std::string &buf) noexcept;
+
+/**
+ * @brief 从字节流中反序列化 `rm::Variable`
+ *
+ * @param[in] data 字节流，布局与 @ref encodeVariable 一致
+ * @param[in,out] pos 读取位置，解析成功后移动至下一个变量的起始位置
+ * @return 用 `rm::Variable` 表示的变量，解析失败时返回空变量
+ */
+Variable decodeVariable(std::string_view data, std::size_t &pos) noexcept;
+
 /**
  * @brief `rm::VariableType` 转化为 `UA_Variant`
  *
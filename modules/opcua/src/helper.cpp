@@ -9,6 +9,8 @@
  *
  */
 
+#include <cstring>
+
 #include <open62541/client.h>
 #include <open62541/plugin/log_stdout.h>
 #include <open62541/server.h>
@@ -36,12 +38,21 @@ const std::unordered_map<std::type_index, UA_UInt32> DataType::_map =
      {std::type_index(typeid(const char *)), UA_TYPES_STRING},
      {std::type_index(typeid(std::string)), UA_TYPES_STRING}};
 
+//! 由字符串视图构造 `UA_QualifiedName`，长度取自视图本身，浏览名无需以 `\0` 结尾
+static inline UA_QualifiedName makeQualifiedName(uint16_t ns, std::string_view browse_name)
+{
+    UA_QualifiedName retval;
+    retval.namespaceIndex = ns;
+    retval.name = {browse_name.size(), reinterpret_cast<UA_Byte *>(helper::to_char(browse_name))};
+    return retval;
+}
+
 NodeId operator|(NodeId origin, FindNodeInServer &&fnis)
 {
     if (origin.empty())
         return origin;
     const auto &[p_server, browse_name, ns] = fnis;
-    auto qualified_name = UA_QUALIFIEDNAME(ns, helper::to_char(browse_name));
+    auto qualified_name = makeQualifiedName(ns, browse_name);
     auto bpr = UA_Server_browseSimplifiedBrowsePath(p_server, origin, 1, &qualified_name);
     NodeId retval;
     if (bpr.statusCode == UA_STATUSCODE_GOOD && bpr.targetsSize >= 1)
@@ -61,7 +72,7 @@ NodeId operator|(NodeId origin, FindNodeInClient &&fnic)
     browse_path.relativePath.elementsSize = 1;
 
     auto &&[p_client, browse_name, ns] = fnic;
-    elem->targetName = UA_QUALIFIEDNAME(ns, helper::to_char(browse_name));
+    elem->targetName = makeQualifiedName(ns, browse_name);
 
     UA_TranslateBrowsePathsToNodeIdsRequest request;
     UA_TranslateBrowsePathsToNodeIdsRequest_init(&request);
@@ -74,7 +85,7 @@ NodeId operator|(NodeId origin, FindNodeInClient &&fnic)
         if (response.resultsSize == 1 && response.results[0].targetsSize == 1)
             return response.results[0].targets[0].targetId.nodeId;
 
-    ERROR_("Failed to find node, name: %s, error code: %s",
+    ERROR_("Failed to find node, name: %.*s, error code: %s", static_cast<int>(browse_name.size()),
            browse_name.data(), UA_StatusCode_name(response.responseHeader.serviceResult));
     return {};
 }
@@ -291,6 +302,215 @@ UA_Variant cvtVariable(const Variable &val) noexcept
     return p_val;
 }
 
+/**
+ * @brief 以借用存储的方式将数组负载设置到 `UA_Variant` 中
+ *
+ * @tparam Tp 数组元素的数据类型
+ * @param[out] variant 待设置的 `UA_Variant`
+ * @param[in] data 内含 `std::vector<Tp>` 的数组负载
+ * @param[in] type_flag 数据类型标志
+ */
+template <typename Tp>
+static inline void setArrayBorrowed(UA_Variant &variant, const std::any &data, UA_UInt32 type_flag) noexcept
+{
+    const auto &rawval = std::any_cast<const std::vector<Tp> &>(data);
+    UA_Variant_setArray(&variant, const_cast<Tp *>(rawval.data()), rawval.size(), &UA_TYPES[type_flag]);
+    // 借用存储，UA_Variant_clear 不产生释放行为
+    variant.storageType = UA_VARIANT_DATA_NODELETE;
+}
+
+UA_Variant cvtVariableBorrowed(const Variable &val) noexcept
+{
+    // 标量与字符串负载仍走深拷贝路径
+    if (val.size() == 1)
+        return cvtVariable(val);
+    const std::any &data = val.data();
+    UA_Variant p_val;
+    UA_Variant_init(&p_val);
+    switch (val.getDataType())
+    {
+    case UA_TYPES_SBYTE:
+        setArrayBorrowed<UA_SByte>(p_val, data, UA_TYPES_SBYTE);
+        break;
+    case UA_TYPES_BYTE:
+        setArrayBorrowed<UA_Byte>(p_val, data, UA_TYPES_BYTE);
+        break;
+    case UA_TYPES_INT16:
+        setArrayBorrowed<UA_Int16>(p_val, data, UA_TYPES_INT16);
+        break;
+    case UA_TYPES_UINT16:
+        setArrayBorrowed<UA_UInt16>(p_val, data, UA_TYPES_UINT16);
+        break;
+    case UA_TYPES_INT32:
+        setArrayBorrowed<UA_Int32>(p_val, data, UA_TYPES_INT32);
+        break;
+    case UA_TYPES_UINT32:
+        setArrayBorrowed<UA_UInt32>(p_val, data, UA_TYPES_UINT32);
+        break;
+    case UA_TYPES_INT64:
+        setArrayBorrowed<UA_Int64>(p_val, data, UA_TYPES_INT64);
+        break;
+    case UA_TYPES_UINT64:
+        setArrayBorrowed<UA_UInt64>(p_val, data, UA_TYPES_UINT64);
+        break;
+    case UA_TYPES_FLOAT:
+        setArrayBorrowed<UA_Float>(p_val, data, UA_TYPES_FLOAT);
+        break;
+    case UA_TYPES_DOUBLE:
+        setArrayBorrowed<UA_Double>(p_val, data, UA_TYPES_DOUBLE);
+        break;
+    default:
+        return cvtVariable(val);
+    }
+    return p_val;
+}
+
+//! 向字节流追加平凡可拷贝的对象
+template <typename Tp>
+static inline void appendRaw(std::string &buf, const Tp &val)
+{
+    buf.append(reinterpret_cast<const char *>(&val), sizeof(Tp));
+}
+
+//! 从字节流指定位置读取平凡可拷贝的对象
+template <typename Tp>
+static inline bool fetchRaw(std::string_view data, std::size_t &pos, Tp &val)
+{
+    if (pos + sizeof(Tp) > data.size())
+        return false;
+    std::memcpy(&val, data.data() + pos, sizeof(Tp));
+    pos += sizeof(Tp);
+    return true;
+}
+
+//! 序列化数值类型负载
+template <typename Tp>
+static inline void encodeNumeric(const Variable &val, std::string &buf)
+{
+    if (val.size() == 1)
+        appendRaw(buf, std::any_cast<Tp>(val.data()));
+    else
+    {
+        const auto &rawval = std::any_cast<const std::vector<Tp> &>(val.data());
+        buf.append(reinterpret_cast<const char *>(rawval.data()), rawval.size() * sizeof(Tp));
+    }
+}
+
+//! 反序列化数值类型负载
+template <typename Tp>
+static inline Variable decodeNumeric(std::string_view data, std::size_t &pos, uint32_t size)
+{
+    if (pos + size * sizeof(Tp) > data.size())
+        return {};
+    if (size == 1)
+    {
+        Tp val{};
+        std::memcpy(&val, data.data() + pos, sizeof(Tp));
+        pos += sizeof(Tp);
+        return val;
+    }
+    std::vector<Tp> arr(size);
+    std::memcpy(arr.data(), data.data() + pos, size * sizeof(Tp));
+    pos += size * sizeof(Tp);
+    return arr;
+}
+
+void encodeVariable(const Variable &val, std::string &buf) noexcept
+{
+    appendRaw(buf, static_cast<uint32_t>(val.getDataType()));
+    appendRaw(buf, val.size());
+    switch (val.getDataType())
+    {
+    case UA_TYPES_STRING: {
+        const auto &str = std::any_cast<const std::string &>(val.data());
+        appendRaw(buf, static_cast<uint32_t>(str.size()));
+        buf.append(str);
+        break;
+    }
+    case UA_TYPES_BOOLEAN:
+        appendRaw(buf, std::any_cast<UA_Boolean>(val.data()));
+        break;
+    case UA_TYPES_SBYTE:
+        encodeNumeric<UA_SByte>(val, buf);
+        break;
+    case UA_TYPES_BYTE:
+        encodeNumeric<UA_Byte>(val, buf);
+        break;
+    case UA_TYPES_INT16:
+        encodeNumeric<UA_Int16>(val, buf);
+        break;
+    case UA_TYPES_UINT16:
+        encodeNumeric<UA_UInt16>(val, buf);
+        break;
+    case UA_TYPES_INT32:
+        encodeNumeric<UA_Int32>(val, buf);
+        break;
+    case UA_TYPES_UINT32:
+        encodeNumeric<UA_UInt32>(val, buf);
+        break;
+    case UA_TYPES_INT64:
+        encodeNumeric<UA_Int64>(val, buf);
+        break;
+    case UA_TYPES_UINT64:
+        encodeNumeric<UA_UInt64>(val, buf);
+        break;
+    case UA_TYPES_FLOAT:
+        encodeNumeric<UA_Float>(val, buf);
+        break;
+    case UA_TYPES_DOUBLE:
+        encodeNumeric<UA_Double>(val, buf);
+        break;
+    default:
+        break;
+    }
+}
+
+Variable decodeVariable(std::string_view data, std::size_t &pos) noexcept
+{
+    uint32_t type_flag{}, size{};
+    if (!fetchRaw(data, pos, type_flag) || !fetchRaw(data, pos, size) || size == 0)
+        return {};
+    switch (type_flag)
+    {
+    case UA_TYPES_STRING: {
+        uint32_t len{};
+        if (!fetchRaw(data, pos, len) || pos + len > data.size())
+            return {};
+        std::string str(data.substr(pos, len));
+        pos += len;
+        return str;
+    }
+    case UA_TYPES_BOOLEAN: {
+        UA_Boolean rawval{};
+        if (!fetchRaw(data, pos, rawval))
+            return {};
+        return rawval;
+    }
+    case UA_TYPES_SBYTE:
+        return decodeNumeric<UA_SByte>(data, pos, size);
+    case UA_TYPES_BYTE:
+        return decodeNumeric<UA_Byte>(data, pos, size);
+    case UA_TYPES_INT16:
+        return decodeNumeric<UA_Int16>(data, pos, size);
+    case UA_TYPES_UINT16:
+        return decodeNumeric<UA_UInt16>(data, pos, size);
+    case UA_TYPES_INT32:
+        return decodeNumeric<UA_Int32>(data, pos, size);
+    case UA_TYPES_UINT32:
+        return decodeNumeric<UA_UInt32>(data, pos, size);
+    case UA_TYPES_INT64:
+        return decodeNumeric<UA_Int64>(data, pos, size);
+    case UA_TYPES_UINT64:
+        return decodeNumeric<UA_UInt64>(data, pos, size);
+    case UA_TYPES_FLOAT:
+        return decodeNumeric<UA_Float>(data, pos, size);
+    case UA_TYPES_DOUBLE:
+        return decodeNumeric<UA_Double>(data, pos, size);
+    default:
+        return {};
+    }
+}
+
 Variable cvtVariable(const UA_Variant &p_val) noexcept
 {
     UA_UInt32 dims = (p_val.arrayLength == 0 ? 1 : static_cast<UA_UInt32>(p_val.arrayLength));
@@ -336,25 +556,25 @@ Variable cvtVariable(const UA_Variant &p_val) noexcept
         switch (type_flag)
         {
         case UA_TYPES_SBYTE:
-            return std::vector<UA_SByte>(reinterpret_cast<UA_SByte *>(data), reinterpret_cast<UA_SByte *>(data) + dims);
+            return {reinterpret_cast<UA_SByte *>(data), dims};
         case UA_TYPES_BYTE:
-            return std::vector<UA_Byte>(reinterpret_cast<UA_Byte *>(data), reinterpret_cast<UA_Byte *>(data) + dims);
+            return {reinterpret_cast<UA_Byte *>(data), dims};
         case UA_TYPES_INT16:
-            return std::vector<UA_Int16>(reinterpret_cast<UA_Int16 *>(data), reinterpret_cast<UA_Int16 *>(data) + dims);
+            return {reinterpret_cast<UA_Int16 *>(data), dims};
         case UA_TYPES_UINT16:
-            return std::vector<UA_UInt16>(reinterpret_cast<UA_UInt16 *>(data), reinterpret_cast<UA_UInt16 *>(data) + dims);
+            return {reinterpret_cast<UA_UInt16 *>(data), dims};
         case UA_TYPES_INT32:
-            return std::vector<UA_Int32>(reinterpret_cast<UA_Int32 *>(data), reinterpret_cast<UA_Int32 *>(data) + dims);
+            return {reinterpret_cast<UA_Int32 *>(data), dims};
         case UA_TYPES_UINT32:
-            return std::vector<UA_UInt32>(reinterpret_cast<UA_UInt32 *>(data), reinterpret_cast<UA_UInt32 *>(data) + dims);
+            return {reinterpret_cast<UA_UInt32 *>(data), dims};
         case UA_TYPES_INT64:
-            return std::vector<UA_Int64>(reinterpret_cast<UA_Int64 *>(data), reinterpret_cast<UA_Int64 *>(data) + dims);
+            return {reinterpret_cast<UA_Int64 *>(data), dims};
         case UA_TYPES_UINT64:
-            return std::vector<UA_UInt64>(reinterpret_cast<UA_UInt64 *>(data), reinterpret_cast<UA_UInt64 *>(data) + dims);
+            return {reinterpret_cast<UA_UInt64 *>(data), dims};
         case UA_TYPES_FLOAT:
-            return std::vector<UA_Float>(reinterpret_cast<UA_Float *>(data), reinterpret_cast<UA_Float *>(data) + dims);
+            return {reinterpret_cast<UA_Float *>(data), dims};
         case UA_TYPES_DOUBLE:
-            return std::vector<UA_Double>(reinterpret_cast<UA_Double *>(data), reinterpret_cast<UA_Double *>(data) + dims);
+            return {reinterpret_cast<UA_Double *>(data), dims};
         default:
             return {};
         }
@@ -25,6 +25,8 @@
 
 #include "rmvlpara/opcua.hpp"
 
+#include "cvt.hpp"
+
 namespace rm
 {
 
@@ -34,6 +36,14 @@ namespace rm
 Publisher::Publisher(std::string_view pub_name, const std::string &addr, uint16_t port,
                      const std::vector<UserConfig> &users) : Server(port, pub_name, users), _name(pub_name)
 {
+    /////////////// 同主机共享内存快速通道 ///////////////
+    // 环回地址表示发布与订阅双方位于同一主机，数据集改经共享内存交换，不再经过 UDP 协议栈
+    _shm_lane = addr.find("//127.") != std::string::npos || addr.find("//localhost") != std::string::npos;
+    if (_shm_lane)
+    {
+        _shm = std::make_unique<ShmServer>(_name + "PubSub");
+        return;
+    }
     //////////////////// 添加连接配置 ////////////////////
     UA_PubSubConnectionConfig connect_config{};
     std::string cn_name_str = _name + "Connection";
@@ -82,6 +92,28 @@ bool Publisher::publish(const std::vector<PublishedDataSet> &datas, double durat
     ////////////////////// 前置条件 //////////////////////
     if (_server == nullptr)
         RMVL_Error(RMVL_StsNullPtr, "Server is nullptr.");
+    ////////////// 同主机共享内存快速通道 ////////////////
+    if (_shm_lane)
+    {
+        for (const auto &pds : datas)
+            _shm_nodes.push_back(pds.node_id);
+        // 以发布周期将数据集快照序列化后写入顺序锁保护的共享内存通道
+        _shm_timer = std::make_unique<ServerTimer>(*this, duration, [this](ServerView sv) {
+            std::string buf;
+            buf.reserve(256);
+            auto num = static_cast<uint32_t>(_shm_nodes.size());
+            buf.append(reinterpret_cast<const char *>(&num), sizeof(num));
+            for (const auto &node : _shm_nodes)
+            {
+                auto val = sv.read(node);
+                if (val.empty())
+                    return;
+                helper::encodeVariable(val, buf);
+            }
+            _shm->write(buf);
+        });
+        return true;
+    }
     if (UA_NodeId_isNull(&_connection_id))
         return false;
 
@@ -9,12 +9,16 @@
  *
  */
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
 #include <stack>
 
 #include <open62541/plugin/accesscontrol_default.h>
 #include <open62541/plugin/log_stdout.h>
 #include <open62541/server_config_default.h>
 
+#include "rmvl/core/memstat.hpp"
 #include "rmvl/core/str.hpp"
 #include "rmvl/core/util.hpp"
 #include "rmvl/opcua/server.hpp"
@@ -95,18 +99,48 @@ Server::Server(UA_StatusCode (*on_config)(UA_Server *), uint16_t port, std::stri
         on_config(_server);
 }
 
-void Server::spinOnce() { UA_Server_run_iterate(_server, para::opcua_param.SERVER_WAIT); }
+void Server::spinOnce()
+{
+    drainTelemetry();
+    UA_Server_run_iterate(_server, para::opcua_param.SERVER_WAIT);
+}
 
 void Server::spin()
 {
     _running = true;
     while (_running)
+    {
+        drainTelemetry();
         UA_Server_run_iterate(_server, para::opcua_param.SERVER_WAIT);
+    }
 }
 
-Server::~Server()
+void Server::runAsync()
+{
+    if (_executor.joinable())
+        return;
+    _running = true;
+    _executor = std::thread([this] {
+        // 内部等待时长由网络层根据下一个定时回调的到期时刻自适应计算，
+        // 空闲时阻塞于网络事件，定时回调在到期时刻被精确唤醒
+        while (_running)
+        {
+            drainTelemetry();
+            UA_Server_run_iterate(_server, true);
+        }
+    });
+}
+
+void Server::stop()
 {
     shutdown();
+    if (_executor.joinable())
+        _executor.join();
+}
+
+Server::~Server()
+{
+    stop();
     UA_Server_run_shutdown(_server);
     UA_Server_delete(_server);
 }
@@ -115,14 +149,17 @@ static NodeId serverFindNode(UA_Server *p_server, std::string_view browse_path,
 {
     RMVL_DbgAssert(p_server != nullptr);
 
-    auto paths = str::split(browse_path, "/");
-    if (paths.empty())
+    // 浏览路径层级有限，分割结果置于栈上，避免每次查找的堆分配
+    std::string_view paths[32];
+    std::size_t path_num = str::split(browse_path, "/", paths, std::size(paths));
+    RMVL_Assert(path_num <= std::size(paths));
+    if (path_num == 0)
         return src_nd;
     ServerView sv{p_server};
     NodeId retval = src_nd;
-    for (const auto &path : paths)
+    for (std::size_t i = 0; i < path_num; ++i)
     {
-        retval = retval | sv.node(path);
+        retval = retval | sv.node(paths[i]);
         if (retval.empty())
             break;
     }
@@ -147,7 +184,8 @@ static bool serverWrite(UA_Server *p_server, const NodeId &nd, const Variable &v
 {
     RMVL_DbgAssert(p_server != nullptr);
 
-    auto variant = helper::cvtVariable(val);
+    // 数组负载借用 val 的内部存储，写入过程不发生负载拷贝
+    auto variant = helper::cvtVariableBorrowed(val);
     auto status = UA_Server_writeValue(p_server, nd, variant);
     UA_Variant_clear(&variant);
     if (status != UA_STATUSCODE_GOOD)
@@ -202,6 +240,84 @@ static bool serverTriggerEvent(UA_Server *server, const Event &event)
     return true;
 }
 
+static bool serverCompileEvent(UA_Server *server, const EventType &etype, NodeId &type_id, std::vector<std::string> &fields)
+{
+    RMVL_DbgAssert(server != nullptr);
+
+    ServerView sv{server};
+    type_id = nodeBaseEventType | sv.node(etype.browse_name);
+    if (type_id.empty())
+    {
+        ERROR_("Failed to find the event type ID during compiling the event template");
+        return false;
+    }
+    // 创建探测事件实例，逐字段检查存在性后删除，触发时无需再逐事件查找
+    UA_NodeId event_id;
+    auto status = UA_Server_createEvent(server, type_id, &event_id);
+    if (status != UA_STATUSCODE_GOOD)
+    {
+        ERROR_("Failed to create event: %s", UA_StatusCode_name(status));
+        return false;
+    }
+    fields.reserve(etype.data().size());
+    for (const auto &[browse_name, prop] : etype.data())
+    {
+        NodeId sub_nd = event_id | sv.node(browse_name);
+        if (!sub_nd.empty())
+            fields.push_back(browse_name);
+    }
+    UA_Server_deleteNode(server, event_id, true);
+    return true;
+}
+
+static bool serverTriggerEvents(UA_Server *server, const EventTemplate &tpl, const std::vector<Event> &events)
+{
+    RMVL_DbgAssert(server != nullptr);
+
+    if (!tpl.valid())
+    {
+        ERROR_("Failed to trigger events: invalid event template");
+        return false;
+    }
+    // 突发中的各事件共享同一触发时间戳
+    UA_DateTime time = UA_DateTime_now();
+    bool retval = true;
+    for (const auto &event : events)
+    {
+        UA_NodeId event_id;
+        auto status = UA_Server_createEvent(server, tpl.type(), &event_id);
+        if (status != UA_STATUSCODE_GOOD)
+        {
+            ERROR_("Failed to create event: %s", UA_StatusCode_name(status));
+            retval = false;
+            continue;
+        }
+        // 设置事件默认属性
+        UA_String source_name = UA_STRING(helper::to_char(event.source_name));
+        UA_LocalizedText evt_msg = UA_LOCALIZEDTEXT(helper::en_US(), helper::to_char(event.message));
+        UA_Server_writeObjectProperty_scalar(server, event_id, UA_QUALIFIEDNAME(0, const_cast<char *>("Time")), &time, &UA_TYPES[UA_TYPES_DATETIME]);
+        UA_Server_writeObjectProperty_scalar(server, event_id, UA_QUALIFIEDNAME(0, const_cast<char *>("SourceName")), &source_name, &UA_TYPES[UA_TYPES_STRING]);
+        UA_Server_writeObjectProperty_scalar(server, event_id, UA_QUALIFIEDNAME(0, const_cast<char *>("Severity")), &event.severity, &UA_TYPES[UA_TYPES_UINT16]);
+        UA_Server_writeObjectProperty_scalar(server, event_id, UA_QUALIFIEDNAME(0, const_cast<char *>("Message")), &evt_msg, &UA_TYPES[UA_TYPES_LOCALIZEDTEXT]);
+        // 设置事件自定义属性，字段存在性已在模板编译期确认
+        for (const auto &browse_name : tpl.fields())
+        {
+            auto it = event.data().find(browse_name);
+            if (it != event.data().end())
+                UA_Server_writeObjectProperty_scalar(server, event_id, UA_QUALIFIEDNAME(event.ns, helper::to_char(browse_name)),
+                                                     &it->second, &UA_TYPES[UA_TYPES_INT32]);
+        }
+        // 触发事件
+        status = UA_Server_triggerEvent(server, event_id, nodeServer, nullptr, true);
+        if (status != UA_STATUSCODE_GOOD)
+        {
+            ERROR_("Failed to trigger event: %s", UA_StatusCode_name(status));
+            retval = false;
+        }
+    }
+    return retval;
+}
+
 ///////////////////////// 节点配置 /////////////////////////
 
 NodeId Server::find(std::string_view browse_path, const NodeId &src_nd) const noexcept { return serverFindNode(_server, browse_path, src_nd); }
@@ -287,6 +403,51 @@ NodeId Server::addVariableNode(const Variable &val, const NodeId &parent_nd) noe
 Variable Server::read(const NodeId &node) const { return serverRead(_server, node); }
 bool Server::write(const NodeId &node, const Variable &val) { return serverWrite(_server, node, val); }
 
+NodeId Server::addTelemetryNode(const Variable &val, uint32_t capacity, const NodeId &parent_nd) noexcept
+{
+    auto nd = addVariableNode(val, parent_nd);
+    if (!nd.empty() && capacity > 1)
+        _telemetry_map[nd.data().identifier.numeric] = std::make_unique<TelemetryRing>(nd, capacity);
+    return nd;
+}
+
+bool Server::writeTelemetry(const NodeId &node, const Variable &val)
+{
+    auto it = _telemetry_map.find(node.data().identifier.numeric);
+    if (it == _telemetry_map.end())
+    {
+        ERROR_("Failed to find the telemetry node, node id: %d", node.data().identifier.numeric);
+        return false;
+    }
+    auto &ring = *it->second;
+    auto head = ring.head.load(std::memory_order_relaxed);
+    auto next = (head + 1) % static_cast<uint32_t>(ring.slots.size());
+    // 环形缓冲已满时丢弃当前样本，写入线程不产生任何阻塞
+    if (next == ring.tail.load(std::memory_order_acquire))
+        return false;
+    ring.slots[head] = val;
+    ring.head.store(next, std::memory_order_release);
+    return true;
+}
+
+void Server::drainTelemetry()
+{
+    for (auto &item : _telemetry_map)
+    {
+        auto &ring = *item.second;
+        auto tail = ring.tail.load(std::memory_order_relaxed);
+        auto head = ring.head.load(std::memory_order_acquire);
+        if (tail == head)
+            continue;
+        // 批量取出本周期内到达的全部样本，仅将最新样本写入地址空间（服务端抽取），
+        // 监视项评估在每个 spin 周期至多触发一次
+        auto last = (head + static_cast<uint32_t>(ring.slots.size()) - 1) % static_cast<uint32_t>(ring.slots.size());
+        Variable latest = std::move(ring.slots[last]);
+        ring.tail.store(head, std::memory_order_release);
+        serverWrite(_server, ring.node, latest);
+    }
+}
+
 static void value_cb_before_read(UA_Server *server, const UA_NodeId *, void *, const UA_NodeId *nodeid,
                                  void *context, const UA_NumericRange *, const UA_DataValue *value)
 {
@@ -674,12 +835,231 @@ NodeId Server::addEventTypeNode(const EventType &etype)
 
 bool Server::triggerEvent(const Event &event) const { return serverTriggerEvent(_server, event); }
 
+EventTemplate Server::compileEvent(const EventType &etype) const
+{
+    NodeId type_id;
+    std::vector<std::string> fields;
+    if (!serverCompileEvent(_server, etype, type_id, fields))
+        return {};
+    return {type_id, std::move(fields)};
+}
+
+bool Server::triggerEvents(const EventTemplate &tpl, const std::vector<Event> &events) const { return serverTriggerEvents(_server, tpl, events); }
+
+///////////////////// 地址空间二进制快照 /////////////////////
+
+//! 快照文件标识
+constexpr char SNAPSHOT_MAGIC[8] = {'R', 'M', 'V', 'L', 'S', 'N', 'A', 'P'};
+//! 快照文件版本
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+//! 父节点为 `ObjectsFolder` 的标记
+constexpr uint32_t SNAPSHOT_ROOT = 0xffffffffu;
+
+//! 向快照缓冲区追加平凡可拷贝的对象
+template <typename Tp>
+static inline void snapAppend(std::string &buf, const Tp &val) { buf.append(reinterpret_cast<const char *>(&val), sizeof(Tp)); }
+
+//! 向快照缓冲区追加带长度前缀的字符串
+static inline void snapAppendStr(std::string &buf, std::string_view str)
+{
+    snapAppend(buf, static_cast<uint32_t>(str.size()));
+    buf.append(str);
+}
+
+//! 从快照缓冲区指定位置读取平凡可拷贝的对象
+template <typename Tp>
+static inline bool snapFetch(std::string_view data, std::size_t &pos, Tp &val)
+{
+    if (pos + sizeof(Tp) > data.size())
+        return false;
+    std::memcpy(&val, data.data() + pos, sizeof(Tp));
+    pos += sizeof(Tp);
+    return true;
+}
+
+//! 从快照缓冲区指定位置读取带长度前缀的字符串
+static inline bool snapFetchStr(std::string_view data, std::size_t &pos, std::string &str)
+{
+    uint32_t len{};
+    if (!snapFetch(data, pos, len) || pos + len > data.size())
+        return false;
+    str.assign(data.substr(pos, len));
+    pos += len;
+    return true;
+}
+
+/**
+ * @brief 深度优先遍历指定父节点下命名空间为 `1` 的对象与变量节点，并序列化至快照缓冲区
+ *
+ * @param[in] p_server 服务器指针
+ * @param[in] parent 父节点 ID
+ * @param[in] parent_idx 父节点在快照中的记录序号，`SNAPSHOT_ROOT` 表示 `ObjectsFolder`
+ * @param[in,out] count 已序列化的节点记录数
+ * @param[in,out] buf 快照缓冲区
+ */
+static void snapshotBrowse(UA_Server *p_server, const UA_NodeId &parent, uint32_t parent_idx, uint32_t &count, std::string &buf)
+{
+    UA_BrowseDescription bd;
+    UA_BrowseDescription_init(&bd);
+    bd.nodeId = parent;
+    bd.browseDirection = UA_BROWSEDIRECTION_FORWARD;
+    bd.referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_HIERARCHICALREFERENCES);
+    bd.includeSubtypes = true;
+    bd.nodeClassMask = UA_NODECLASS_OBJECT | UA_NODECLASS_VARIABLE;
+    bd.resultMask = UA_BROWSERESULTMASK_BROWSENAME | UA_BROWSERESULTMASK_DISPLAYNAME | UA_BROWSERESULTMASK_NODECLASS;
+    UA_BrowseResult br = UA_Server_browse(p_server, 0, &bd);
+    if (br.statusCode != UA_STATUSCODE_GOOD)
+    {
+        UA_BrowseResult_clear(&br);
+        return;
+    }
+    for (size_t i = 0; i < br.referencesSize; ++i)
+    {
+        const auto &ref = br.references[i];
+        // 仅序列化命名空间为 1 的节点，跳过 NS0 的标准节点
+        if (ref.browseName.namespaceIndex != 1)
+            continue;
+        uint32_t idx = count++;
+        buf.push_back(ref.nodeClass == UA_NODECLASS_OBJECT ? char(0) : char(1));
+        snapAppend(buf, parent_idx);
+        snapAppendStr(buf, {reinterpret_cast<const char *>(ref.browseName.name.data), ref.browseName.name.length});
+        snapAppendStr(buf, {reinterpret_cast<const char *>(ref.displayName.text.data), ref.displayName.text.length});
+        UA_LocalizedText desc;
+        UA_LocalizedText_init(&desc);
+        UA_Server_readDescription(p_server, ref.nodeId.nodeId, &desc);
+        snapAppendStr(buf, {reinterpret_cast<const char *>(desc.text.data), desc.text.length});
+        UA_LocalizedText_clear(&desc);
+        if (ref.nodeClass == UA_NODECLASS_VARIABLE)
+        {
+            UA_Byte access_level{};
+            UA_Server_readAccessLevel(p_server, ref.nodeId.nodeId, &access_level);
+            snapAppend(buf, access_level);
+            UA_Variant variant;
+            UA_Variant_init(&variant);
+            UA_Server_readValue(p_server, ref.nodeId.nodeId, &variant);
+            helper::encodeVariable(helper::cvtVariable(variant), buf);
+            UA_Variant_clear(&variant);
+        }
+        else
+            snapshotBrowse(p_server, ref.nodeId.nodeId, idx, count, buf);
+    }
+    UA_BrowseResult_clear(&br);
+}
+
+bool Server::saveSnapshot(std::string_view path) const
+{
+    RMVL_DbgAssert(_server != nullptr);
+
+    std::string buf;
+    buf.append(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    snapAppend(buf, SNAPSHOT_VERSION);
+    snapAppend(buf, uint32_t(0)); // 节点记录数占位，遍历结束后回填
+    uint32_t count{};
+    snapshotBrowse(_server, nodeObjectsFolder, SNAPSHOT_ROOT, count, buf);
+    std::memcpy(buf.data() + sizeof(SNAPSHOT_MAGIC) + sizeof(uint32_t), &count, sizeof(count));
+    std::ofstream ofs(std::string(path), std::ios::binary | std::ios::trunc);
+    if (!ofs)
+    {
+        ERROR_("Failed to open the snapshot file: %s", path.data());
+        return false;
+    }
+    ofs.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+    return ofs.good();
+}
+
+bool Server::loadSnapshot(std::string_view path)
+{
+    RMVL_DbgAssert(_server != nullptr);
+
+    std::ifstream ifs(std::string(path), std::ios::binary);
+    if (!ifs)
+    {
+        ERROR_("Failed to open the snapshot file: %s", path.data());
+        return false;
+    }
+    std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    if (content.size() < sizeof(SNAPSHOT_MAGIC) + 2 * sizeof(uint32_t) ||
+        std::memcmp(content.data(), SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0)
+    {
+        ERROR_("Invalid snapshot file: %s", path.data());
+        return false;
+    }
+    std::size_t pos{sizeof(SNAPSHOT_MAGIC)};
+    uint32_t version{}, count{};
+    snapFetch(content, pos, version);
+    snapFetch(content, pos, count);
+    if (version != SNAPSHOT_VERSION)
+    {
+        ERROR_("Unsupported snapshot version: %u", version);
+        return false;
+    }
+    std::vector<NodeId> nodes;
+    nodes.reserve(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint8_t node_class{};
+        uint32_t parent_idx{};
+        std::string browse, display, desc;
+        if (!snapFetch(content, pos, node_class) || !snapFetch(content, pos, parent_idx) ||
+            !snapFetchStr(content, pos, browse) || !snapFetchStr(content, pos, display) ||
+            !snapFetchStr(content, pos, desc) || (parent_idx != SNAPSHOT_ROOT && parent_idx >= nodes.size()))
+        {
+            ERROR_("Broken snapshot file: %s", path.data());
+            return false;
+        }
+        NodeId parent_nd = (parent_idx == SNAPSHOT_ROOT) ? NodeId(nodeObjectsFolder) : nodes[parent_idx];
+        if (node_class == 0)
+        {
+            Object obj;
+            obj.browse_name = browse;
+            obj.display_name = display;
+            obj.description = desc;
+            nodes.push_back(addObjectNode(obj, parent_nd));
+        }
+        else
+        {
+            uint8_t access_level{};
+            if (!snapFetch(content, pos, access_level))
+            {
+                ERROR_("Broken snapshot file: %s", path.data());
+                return false;
+            }
+            Variable val = helper::decodeVariable(content, pos);
+            if (val.empty())
+            {
+                ERROR_("Broken snapshot file: %s", path.data());
+                return false;
+            }
+            val.browse_name = browse;
+            val.display_name = display;
+            val.description = desc;
+            val.access_level = access_level;
+            nodes.push_back(addVariableNode(val, parent_nd));
+        }
+        if (nodes.back().empty())
+        {
+            ERROR_("Failed to restore the node \"%s\" from snapshot", browse.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
 //////////////////////// 服务端视图 ////////////////////////
 
 NodeId ServerView::find(std::string_view browse_path, const NodeId &src_nd) const noexcept { return serverFindNode(_server, browse_path, src_nd); }
 Variable ServerView::read(const NodeId &nd) const { return serverRead(_server, nd); }
 bool ServerView::write(const NodeId &nd, const Variable &val) const { return serverWrite(_server, nd, val); }
 bool ServerView::triggerEvent(const Event &event) const { return serverTriggerEvent(_server, event); }
+EventTemplate ServerView::compileEvent(const EventType &etype) const
+{
+    NodeId type_id;
+    std::vector<std::string> fields;
+    if (!serverCompileEvent(_server, etype, type_id, fields))
+        return {};
+    return {type_id, std::move(fields)};
+}
+bool ServerView::triggerEvents(const EventTemplate &tpl, const std::vector<Event> &events) const { return serverTriggerEvents(_server, tpl, events); }
 
 /////////////////////// 服务器定时器 ///////////////////////
 
@@ -699,6 +1079,41 @@ ServerTimer::ServerTimer(ServerView sv, double period, std::function<void(Server
     }
 }
 
+ServerTimer::ServerTimer(ServerView sv, double period, double max_period, std::function<bool(ServerView)> callback) : _sv(sv)
+{
+    //! 自适应周期状态
+    struct State
+    {
+        double base;   //!< 基准周期
+        double max;    //!< 退避的最大周期
+        double cur;    //!< 当前周期
+        uint64_t id{}; //!< 定时器 ID
+    };
+    auto state = std::make_shared<State>(State{period, max_period, period, 0});
+    _cb = [state, f = std::move(callback)](ServerView view) {
+        // 无变化时二倍退避，有变化时立即收紧至基准周期
+        double next = f(view) ? state->base : std::min(state->cur * 2, state->max);
+        if (next != state->cur)
+        {
+            state->cur = next;
+            UA_Server_changeRepeatedCallbackInterval(view.get(), state->id, next);
+        }
+    };
+    auto status = UA_Server_addRepeatedCallback(_sv.get(), timer_cb, &_cb, period, &_id);
+    if (status != UA_STATUSCODE_GOOD)
+    {
+        ERROR_("Failed to add repeated callback: %s", UA_StatusCode_name(status));
+        _id = 0;
+    }
+    state->id = _id;
+}
+
+void ServerTimer::setPeriod(double period)
+{
+    if (_id != 0)
+        UA_Server_changeRepeatedCallbackInterval(_sv.get(), _id, period);
+}
+
 void ServerTimer::cancel()
 {
     if (_id != 0)
@@ -708,4 +1123,28 @@ void ServerTimer::cancel()
     }
 }
 
+std::vector<NodeId> publishMemStats(Server &srv, const NodeId &parent_nd)
+{
+    std::vector<NodeId> retval;
+    for (const auto &[name, chn_summary] : memstat::exportAll())
+    {
+        // 浏览名称中的 `/` 替换为 `.`，避免与路径搜索的分隔符冲突
+        std::string browse_name = name;
+        std::replace(browse_name.begin(), browse_name.end(), '/', '.');
+        DataSourceVariable dsv;
+        dsv.browse_name = browse_name;
+        dsv.display_name = name;
+        dsv.description = "Memory stats: [alloc_count, free_count, alloc_bytes, live_bytes, peak_bytes, pool_hits, pool_misses]";
+        dsv.access_level = 1U;
+        // 读取时实时从注册表拉取当前计数
+        dsv.on_read = [name = name](const NodeId &) -> Variable {
+            auto chn_summary = memstat::summary(name);
+            return std::vector<uint64_t>{chn_summary.alloc_count, chn_summary.free_count, chn_summary.alloc_bytes,
+                                         chn_summary.live_bytes, chn_summary.peak_bytes, chn_summary.pool_hits, chn_summary.pool_misses};
+        };
+        retval.push_back(srv.addDataSourceVariableNode(dsv, parent_nd));
+    }
+    return retval;
+}
+
 } // namespace rm
@@ -20,17 +20,26 @@
 #include <open62541/plugin/pubsub_mqtt.h>
 #endif // UA_ENABLE_PUBSUB_MQTT
 
+#include <cstring>
+
 #include "rmvl/core/util.hpp"
 #include "rmvl/opcua/utilities.hpp"
 
 #include "rmvlpara/opcua.hpp"
 
+#include "cvt.hpp"
+
 namespace rm
 {
 
 Subscriber::Subscriber(std::string_view sub_name, const std::string &addr, uint16_t port,
                        const std::vector<UserConfig> &users) : Server(port, sub_name, users), _name(sub_name)
 {
+    /////////////// 同主机共享内存快速通道 ///////////////
+    // 环回地址表示发布与订阅双方位于同一主机，数据集改经共享内存交换，不再经过 UDP 协议栈
+    _shm_lane = addr.find("//127.") != std::string::npos || addr.find("//localhost") != std::string::npos;
+    if (_shm_lane)
+        return;
     //////////////////// 添加连接配置 ////////////////////
     UA_PubSubConnectionConfig connect_config{};
     std::string cn_name_str = _name + "Connection";
@@ -50,6 +59,65 @@ Subscriber::Subscriber(std::string_view sub_name, const std::string &addr, uint1
 
 std::vector<NodeId> Subscriber::subscribe(const std::string &pub_name, const std::vector<FieldMetaData> &fields)
 {
+    ////////////// 同主机共享内存快速通道 ////////////////
+    if (_shm_lane)
+    {
+        // 创建与 UDP 路径一致的镜像变量节点，数据集快照经共享内存轮询后写入这些节点
+        Object sub_obj;
+        sub_obj.browse_name = sub_obj.description = sub_obj.display_name = _name + "DataSetMetaData";
+        auto obj_id = addObjectNode(sub_obj);
+        if (obj_id.empty())
+        {
+            ERROR_("Failed to add object node");
+            return {};
+        }
+        std::vector<NodeId> retval;
+        retval.reserve(fields.size());
+        for (const auto &field : fields)
+        {
+            UA_VariableAttributes attr = UA_VariableAttributes_default;
+            attr.displayName = UA_LOCALIZEDTEXT(helper::en_US(), helper::to_char(field.name));
+            attr.description = UA_LOCALIZEDTEXT(helper::zh_CN(), helper::to_char(field.name));
+            attr.dataType = UA_TYPES[field.type].typeId;
+            attr.valueRank = field.value_rank;
+            attr.accessLevel = UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE;
+            UA_NodeId node_id;
+            auto status = UA_Server_addVariableNode(
+                _server, UA_NODEID_NULL, obj_id, nodeHasComponent,
+                UA_QUALIFIEDNAME(field.ns, helper::to_char(field.name)),
+                nodeBaseDataVariableType, attr, nullptr, &node_id);
+            if (status != UA_STATUSCODE_GOOD)
+            {
+                ERROR_("Failed to add variable node, \"%s\"", UA_StatusCode_name(status));
+                return {};
+            }
+            retval.push_back(node_id);
+        }
+        _shm_nodes = retval;
+        _shm = std::make_unique<ShmClient>(pub_name + "PubSub");
+        // 以采样间隔轮询共享内存通道，仅在新的数据集快照到达时写入镜像变量节点
+        _shm_timer = std::make_unique<ServerTimer>(*this, para::opcua_param.SAMPLING_INTERVAL, [this](ServerView sv) {
+            std::string buf;
+            if (!_shm->read(buf))
+                return;
+            uint32_t num{};
+            if (buf.size() < sizeof(num))
+                return;
+            std::memcpy(&num, buf.data(), sizeof(num));
+            if (num != _shm_nodes.size())
+                return;
+            std::size_t pos{sizeof(num)};
+            for (const auto &node : _shm_nodes)
+            {
+                auto val = helper::decodeVariable(buf, pos);
+                if (val.empty())
+                    return;
+                sv.write(node, val);
+            }
+        });
+        return retval;
+    }
+
     //////////////// 添加 ReaderGroup (RG) ///////////////
     UA_ReaderGroupConfig rg_config{};
     std::string pub_name_str = pub_name + "ReaderGroup";
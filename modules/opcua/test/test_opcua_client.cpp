@@ -14,6 +14,7 @@
 #include <gtest/gtest.h>
 
 #include "rmvl/opcua/client.hpp"
+#include "rmvl/opcua/path_cache.hpp"
 #include "rmvl/opcua/server.hpp"
 
 #include "rmvlpara/opcua.hpp"
@@ -99,6 +100,94 @@ TEST(OPC_UA_ClientTest, path_search)
     t.join();
 }
 
+// 变量批量读写
+TEST(OPC_UA_ClientTest, batch_variable_IO)
+{
+    rm::Server srv(5025);
+    configServer(srv);
+    std::thread t(&rm::Server::spin, &srv);
+    rm::Client cli("opc.tcp://127.0.0.1:5025");
+    std::vector<rm::NodeId> nodes = {cli.find("single"), cli.find("data_source")};
+    // 单次服务调用批量写入
+    EXPECT_TRUE(cli.writeAll(nodes, {11, 22}));
+    // 单次服务调用批量读取
+    auto variables = cli.readAll(nodes);
+    ASSERT_EQ(variables.size(), 2u);
+    EXPECT_EQ(rm::Variable::cast<int>(variables[0]), 11);
+    EXPECT_EQ(rm::Variable::cast<int>(variables[1]), 22);
+    // 列表长度不一致时写入失败
+    EXPECT_FALSE(cli.writeAll(nodes, {1}));
+
+    cli.shutdown();
+    srv.shutdown();
+    t.join();
+}
+
+// 变量异步批量读写
+TEST(OPC_UA_ClientTest, async_batch_variable_IO)
+{
+    rm::Server srv(5026);
+    configServer(srv);
+    std::thread t(&rm::Server::spin, &srv);
+    rm::Client cli("opc.tcp://127.0.0.1:5026");
+    std::vector<rm::NodeId> nodes = {cli.find("single"), cli.find("array")};
+    // 异步批量读取，响应在事件循环中到达
+    auto future = cli.readAllAsync(nodes);
+    ASSERT_TRUE(future.valid());
+    while (future.wait_for(0ms) != std::future_status::ready)
+        cli.spinOnce();
+    auto variables = future.get();
+    ASSERT_EQ(variables.size(), 2u);
+    EXPECT_EQ(rm::Variable::cast<int>(variables[0]), 42);
+    std::vector<int> vec = variables[1];
+    EXPECT_EQ(vec.size(), 5u);
+    // 异步批量写入
+    auto wfuture = cli.writeAllAsync({nodes.front()}, {55});
+    ASSERT_TRUE(wfuture.valid());
+    while (wfuture.wait_for(0ms) != std::future_status::ready)
+        cli.spinOnce();
+    EXPECT_TRUE(wfuture.get());
+    EXPECT_EQ(rm::Variable::cast<int>(cli.read(nodes.front())), 55);
+
+    cli.shutdown();
+    srv.shutdown();
+    t.join();
+}
+
+// 监视变量本地缓存读取
+TEST(OPC_UA_ClientTest, cached_variable_read)
+{
+    rm::Server srv(5027);
+    configServer(srv);
+    std::thread t(&rm::Server::spin, &srv);
+    rm::Client cli("opc.tcp://127.0.0.1:5027");
+    auto node_id = cli.find("single");
+    // 未监视的节点无缓存
+    auto [miss, miss_seq] = cli.readCached(node_id);
+    EXPECT_TRUE(miss.empty());
+    EXPECT_EQ(miss_seq, 0u);
+    // 传入空的可调用对象，仅维护本地缓存
+    EXPECT_TRUE(cli.monitor(node_id, {}, 5));
+    EXPECT_TRUE(cli.write(node_id, 77));
+    std::this_thread::sleep_for(10ms);
+    cli.spinOnce();
+    auto [val, seq] = cli.readCached(node_id);
+    ASSERT_FALSE(val.empty());
+    EXPECT_EQ(rm::Variable::cast<int>(val), 77);
+    EXPECT_GE(seq, 1u);
+    // 数据再次变更后，缓存值更新且变更序号递增
+    EXPECT_TRUE(cli.write(node_id, 78));
+    std::this_thread::sleep_for(10ms);
+    cli.spinOnce();
+    auto [val2, seq2] = cli.readCached(node_id);
+    EXPECT_EQ(rm::Variable::cast<int>(val2), 78);
+    EXPECT_GT(seq2, seq);
+
+    cli.shutdown();
+    srv.shutdown();
+    t.join();
+}
+
 // 变量读写
 TEST(OPC_UA_ClientTest, variable_IO)
 {
@@ -113,6 +202,11 @@ TEST(OPC_UA_ClientTest, variable_IO)
     EXPECT_FALSE(variable.empty());
     int single_value = rm::Variable::cast<int>(variable);
     EXPECT_EQ(single_value, 99);
+    // 数组变量写入，覆盖借用存储的零拷贝转换路径
+    auto arr_id = cli.find("array");
+    EXPECT_TRUE(cli.write(arr_id, std::vector{9, 8, 7, 6, 5}));
+    std::vector<int> arr = cli.read(arr_id);
+    EXPECT_EQ(arr, (std::vector{9, 8, 7, 6, 5}));
 
     cli.shutdown();
     srv.shutdown();
@@ -137,6 +231,61 @@ TEST(OPC_UA_ClientTest, call)
     t.join();
 }
 
+#ifdef __cpp_impl_coroutine
+
+//! 用于测试的简易协程任务类型
+struct TestTask
+{
+    struct promise_type
+    {
+        TestTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() {}
+    };
+};
+
+// 协程异步方法调用
+TEST(OPC_UA_ClientTest, coroutine_async_call)
+{
+    rm::Server srv(5028);
+    configServer(srv);
+    std::thread t(&rm::Server::spin, &srv);
+    rm::Client cli("opc.tcp://127.0.0.1:5028");
+    int sum1{}, sum2{};
+    bool done1{}, done2{};
+    auto task = [&cli](int a, int b, int &sum, bool &done) -> TestTask {
+        auto [res, oargs] = co_await cli.async_call("add", {a, b});
+        EXPECT_TRUE(res);
+        sum = oargs[0];
+        done = true;
+    };
+    // 两次调用同时在途，由 spinOnce 的完成队列恢复，而非串行等待
+    task(1, 2, sum1, done1);
+    task(10, 20, sum2, done2);
+    while (!done1 || !done2)
+        cli.spinOnce();
+    EXPECT_EQ(sum1, 3);
+    EXPECT_EQ(sum2, 30);
+    // 方法节点不存在时立即以失败结果恢复
+    bool done3{};
+    auto fail_task = [&cli, &done3]() -> TestTask {
+        auto [res, oargs] = co_await cli.async_call("not_exist", {});
+        EXPECT_FALSE(res);
+        EXPECT_TRUE(oargs.empty());
+        done3 = true;
+    };
+    fail_task();
+    EXPECT_TRUE(done3);
+
+    cli.shutdown();
+    srv.shutdown();
+    t.join();
+}
+
+#endif // __cpp_impl_coroutine
+
 // 高级方法调用
 TEST(OPC_UA_ClientTest, callx)
 {
@@ -259,4 +408,47 @@ TEST(OPC_UA_ClientTest, data_source_variable_IO)
     t.join();
 }
 
+// 浏览路径驻留缓存：命中时不再发起解析
+TEST(OPC_UA_PathCacheTest, interned_find)
+{
+    std::size_t resolved{};
+    rm::NodePathCache cache([&resolved](std::string_view path, const rm::NodeId &) -> rm::NodeId {
+        ++resolved;
+        return path == "not_exist" ? rm::NodeId{} : rm::NodeId{1, 1000};
+    });
+    EXPECT_EQ(cache.find("person/name"), rm::NodeId(1, 1000));
+    EXPECT_EQ(cache.find("person/name"), rm::NodeId(1, 1000));
+    EXPECT_EQ(resolved, 1u);
+    // 源节点不同的相同路径不混淆
+    EXPECT_EQ(cache.find("person/name", {1, 2000}), rm::NodeId(1, 1000));
+    EXPECT_EQ(resolved, 2u);
+    // 解析失败的路径不驻留，下次访问自动重试
+    EXPECT_TRUE(cache.find("not_exist").empty());
+    EXPECT_TRUE(cache.find("not_exist").empty());
+    EXPECT_EQ(resolved, 4u);
+    EXPECT_EQ(cache.size(), 2u);
+}
+
+// 预编译路径句柄与失效重解析
+TEST(OPC_UA_PathCacheTest, compiled_handle)
+{
+    std::size_t resolved{};
+    rm::NodePathCache cache([&resolved](std::string_view, const rm::NodeId &) -> rm::NodeId {
+        ++resolved;
+        return {1, static_cast<uint32_t>(1000 + resolved)};
+    });
+    auto handle = cache.compile("person/name");
+    // 相同路径重复编译返回同一句柄
+    EXPECT_EQ(cache.compile("person/name"), handle);
+    EXPECT_EQ(resolved, 0u);
+    // 首次访问解析，稳态访问仅为数组下标访问
+    EXPECT_EQ(cache.at(handle), rm::NodeId(1, 1001));
+    EXPECT_EQ(cache.at(handle), rm::NodeId(1, 1001));
+    EXPECT_EQ(resolved, 1u);
+    // 地址空间变更后句柄保持有效，下次访问重新解析
+    cache.invalidate();
+    EXPECT_EQ(cache.at(handle), rm::NodeId(1, 1002));
+    EXPECT_EQ(resolved, 2u);
+}
+
 } // namespace rm_test
@@ -52,6 +52,36 @@ TEST(OPC_UA_PubSub, pubsub_config)
     t2.join();
 }
 
+// 同主机共享内存快速通道
+TEST(OPC_UA_PubSub, pubsub_shm_fast_lane)
+{
+    // 环回地址触发共享内存快速通道，数据集不经过 UDP 协议栈
+    rm::Publisher pub("FastNumberPub", "opc.udp://127.0.0.1", 8010);
+    uaCreateVariable(test_double, 3.1);
+    auto node_id = pub.addVariableNode(test_double);
+    std::thread t1(&rm::Publisher::spin, &pub);
+    EXPECT_TRUE(pub.publish({{"DoubleDemo", node_id}}, 10));
+
+    // 创建订阅者，镜像变量节点的行为与 UDP 路径一致
+    rm::Subscriber sub("FastNumberSub", "opc.udp://127.0.0.1:8010", 8011);
+    std::thread t2(&rm::Subscriber::spin, &sub);
+    rm::Variable double_demo_var = 0.0;
+    double_demo_var.browse_name = "DoubleDemo";
+    auto meta_data = rm::FieldMetaData::makeFrom(double_demo_var);
+    auto nodes = sub.subscribe("FastNumberPub", {meta_data});
+    EXPECT_EQ(nodes.size(), 1);
+
+    pub.write(node_id, 3.4);
+    std::this_thread::sleep_for(100ms);
+    auto sub_val = sub.read(nodes[0]);
+    EXPECT_EQ(sub_val.cast<double>(), 3.4);
+
+    pub.shutdown();
+    sub.shutdown();
+    t1.join();
+    t2.join();
+}
+
 } // namespace rm_test
 
 #endif // UA_ENABLE_PUBSUB
@@ -325,4 +325,143 @@ TEST(OPC_UA_Server, timer_test)
     EXPECT_EQ(srv.read(nd).cast<int>(), 50);
 }
 
+// 内部执行器
+TEST(OPC_UA_Server, run_async)
+{
+    rm::Server srv(4880);
+    uaCreateVariable(val, 0);
+    auto nd = srv.addVariableNode(val);
+    // 事件循环由内部执行器线程驱动，定时回调无需外部调用 spinOnce
+    srv.runAsync();
+
+    std::atomic_int times{};
+    auto timer = rm::ServerTimer(srv, 10, [&](rm::ServerView sv) {
+        int num = sv.read(nd).cast<int>() + 10;
+        sv.write(nd, num);
+        times++;
+    });
+
+    while (times < 5)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    srv.stop();
+    EXPECT_GE(srv.read(nd).cast<int>(), 50);
+    // 重复停止无副作用
+    srv.stop();
+}
+
+TEST(OPC_UA_Server, adaptive_timer)
+{
+    rm::Server srv(4895);
+    srv.runAsync();
+    std::atomic_int static_times{}, active_times{};
+    // 数据静态时周期二倍退避直至最大周期
+    auto static_timer = rm::ServerTimer(srv, 5, 80, [&](rm::ServerView) { static_times++; return false; });
+    // 数据持续变化时维持基准周期
+    auto active_timer = rm::ServerTimer(srv, 5, 80, [&](rm::ServerView) { active_times++; return true; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    srv.stop();
+    // 300ms 内基准周期触发约 60 次，退避后的触发次数应明显减少
+    EXPECT_GE(active_times, 20);
+    EXPECT_LT(static_times, active_times / 2);
+}
+
+TEST(OPC_UA_Server, address_space_snapshot)
+{
+    const char *path = "ts_snapshot.bin";
+    // 构建地址空间并保存快照
+    {
+        rm::Server srv(4890);
+        uaCreateVariable(snap_value, 42);
+        srv.addVariableNode(snap_value);
+        uaCreateVariable(snap_array, std::vector{1.1, 2.2, 3.3});
+        srv.addVariableNode(snap_array);
+        rm::Object obj;
+        obj.browse_name = obj.display_name = obj.description = "snap_obj";
+        uaCreateVariable(inner, 3.5);
+        obj.add(inner);
+        srv.addObjectNode(obj);
+        EXPECT_TRUE(srv.saveSnapshot(path));
+        srv.shutdown();
+    }
+    // 从快照恢复地址空间，层级结构与节点值保持一致
+    rm::Server dst(4891);
+    EXPECT_TRUE(dst.loadSnapshot(path));
+    auto nd = dst.find("snap_value");
+    ASSERT_FALSE(nd.empty());
+    EXPECT_EQ(dst.read(nd).cast<int>(), 42);
+    std::vector<double> arr = dst.read(dst.find("snap_array"));
+    EXPECT_EQ(arr, (std::vector{1.1, 2.2, 3.3}));
+    auto inner_nd = dst.find("snap_obj/inner");
+    ASSERT_FALSE(inner_nd.empty());
+    EXPECT_EQ(dst.read(inner_nd).cast<double>(), 3.5);
+    // 无效快照文件恢复失败
+    rm::Server bad(4892);
+    EXPECT_FALSE(bad.loadSnapshot("not_exist_snapshot.bin"));
+    bad.shutdown();
+    dst.shutdown();
+}
+
+TEST(OPC_UA_Server, telemetry_node)
+{
+    rm::Server srv(4885);
+    uaCreateVariable(telemetry, 0);
+    auto nd = srv.addTelemetryNode(telemetry);
+    EXPECT_FALSE(nd.empty());
+    // 写入线程高频无锁入队，事件循环批量取出后仅将最新样本写入地址空间
+    std::thread writer([&] {
+        for (int i = 1; i <= 100; ++i)
+            EXPECT_TRUE(srv.writeTelemetry(nd, i));
+    });
+    writer.join();
+    srv.spinOnce();
+    EXPECT_EQ(srv.read(nd).cast<int>(), 100);
+    // 环形缓冲已满时丢弃当前样本
+    uaCreateVariable(small_telemetry, 0);
+    auto small_nd = srv.addTelemetryNode(small_telemetry, 4);
+    EXPECT_TRUE(srv.writeTelemetry(small_nd, 1));
+    EXPECT_TRUE(srv.writeTelemetry(small_nd, 2));
+    EXPECT_TRUE(srv.writeTelemetry(small_nd, 3));
+    EXPECT_FALSE(srv.writeTelemetry(small_nd, 4));
+    srv.spinOnce();
+    EXPECT_EQ(srv.read(small_nd).cast<int>(), 3);
+    // 普通变量节点不支持遥测写入
+    uaCreateVariable(normal, 0);
+    auto normal_nd = srv.addVariableNode(normal);
+    EXPECT_FALSE(srv.writeTelemetry(normal_nd, 1));
+    srv.shutdown();
+}
+
+// 结构体打包的变量节点
+TEST(OPC_UA_Server, struct_packed_variable)
+{
+    struct GimbalStatus
+    {
+        float yaw{}, pitch{}, roll{};
+        float yaw_speed{}, pitch_speed{}, roll_speed{};
+        float bullet_speed{};
+        uint32_t shoot_count{};
+        uint8_t mode{};
+    };
+
+    rm::Server srv(4896);
+    GimbalStatus status{1.5f, -0.5f, 0.f, 10.f, -2.f, 0.f, 28.f, 42, 3};
+    rm::Variable packed = rm::Variable::pack(status);
+    packed.browse_name = packed.display_name = "gimbal_status";
+    packed.description = "this is gimbal status";
+    auto nd = srv.addVariableNode(packed);
+    EXPECT_FALSE(nd.empty());
+    srv.spinOnce();
+    // 整个结构体状态仅通过一次节点写入完成更新
+    status.yaw = 2.5f, status.shoot_count = 43;
+    EXPECT_TRUE(srv.write(nd, rm::Variable::pack(status)));
+    srv.spinOnce();
+    auto result = rm::Variable::unpack<GimbalStatus>(srv.read(nd));
+    EXPECT_EQ(result.yaw, 2.5f);
+    EXPECT_EQ(result.pitch, -0.5f);
+    EXPECT_EQ(result.bullet_speed, 28.f);
+    EXPECT_EQ(result.shoot_count, 43u);
+    EXPECT_EQ(result.mode, 3);
+    srv.shutdown();
+}
+
 } // namespace rm_test
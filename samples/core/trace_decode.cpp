@@ -0,0 +1,45 @@
+/**
+ * @file trace_decode.cpp
+ * @author zhaoxi (535394140@qq.com)
+ * @brief 跟踪文件解码示例程序
+ * @version 1.0
+ * @date 2025-08-28
+ *
+ * @copyright Copyright 2025 (c), zhaoxi
+ *
+ */
+
+#include <cstdio>
+
+#include "rmvl/core/trace.hpp"
+#include "rmvl/core/util.hpp"
+
+static void program_help()
+{
+    constexpr const char *usage = "Program Usage:\n"
+                                  "  rmvl_trace_decode <trace_file>\n";
+    printf("%s\n", usage);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        program_help();
+        return -1;
+    }
+
+    std::vector<rm::trace::TraceEvent> events{};
+    try
+    {
+        events = rm::trace::read(argv[1]);
+    }
+    catch (const rm::Exception &e)
+    {
+        ERROR_("%s", e.err.c_str());
+        return -1;
+    }
+    for (const auto &ev : events)
+        printf("%s\n", rm::trace::format(ev).c_str());
+    return 0;
+}
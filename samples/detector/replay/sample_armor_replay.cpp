@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include <opencv2/imgcodecs.hpp>
+
+#include "rmvl/compensator/gravity_compensator.h"
+#include "rmvl/core/io.hpp"
+#include "rmvl/core/timer.hpp"
+#include "rmvl/decider/translation_decider.h"
+#include "rmvl/detector/armor_detector.h"
+#include "rmvl/predictor/armor_predictor.h"
+
+//! 单阶段耗时直方图
+class StageHistogram
+{
+    const char *_name;
+    std::vector<double> _samples; //!< 单位：ms
+
+public:
+    explicit StageHistogram(const char *name) : _name(name) {}
+
+    //! 记录一次耗时（单位：s）
+    inline void add(double t) { _samples.push_back(t * 1e3); }
+
+    //! 打印直方图与分位数
+    void print()
+    {
+        if (_samples.empty())
+            return;
+        std::sort(_samples.begin(), _samples.end());
+        auto quantile = [&](double q) { return _samples[static_cast<std::size_t>(q * static_cast<double>(_samples.size() - 1))]; };
+        double sum{};
+        for (auto val : _samples)
+            sum += val;
+        printf("\n\033[34;1m%s\033[0m  mean = %.3f ms, p50 = %.3f ms, p90 = %.3f ms, p99 = %.3f ms, max = %.3f ms\n",
+               _name, sum / static_cast<double>(_samples.size()), quantile(0.5), quantile(0.9), quantile(0.99), _samples.back());
+        // 固定边界分桶
+        constexpr double bounds[] = {0.05, 0.1, 0.2, 0.5, 1, 2, 5, 10};
+        constexpr std::size_t bucket_num = sizeof(bounds) / sizeof(bounds[0]) + 1;
+        std::size_t counts[bucket_num]{};
+        for (auto val : _samples)
+        {
+            std::size_t idx = std::lower_bound(bounds, bounds + bucket_num - 1, val) - bounds;
+            counts[idx]++;
+        }
+        std::size_t max_count = *std::max_element(counts, counts + bucket_num);
+        for (std::size_t i = 0; i < bucket_num; ++i)
+        {
+            if (i == 0)
+                printf("  <  %5.2f ms │", bounds[0]);
+            else if (i == bucket_num - 1)
+                printf("  >= %5.2f ms │", bounds[bucket_num - 2]);
+            else
+                printf("  <  %5.2f ms │", bounds[i]);
+            int bar = max_count == 0 ? 0 : static_cast<int>(40 * counts[i] / max_count);
+            for (int j = 0; j < bar; ++j)
+                printf("█");
+            printf(" %zu\n", counts[i]);
+        }
+    }
+};
+
+const char *keys = "{ ? h help |    | 帮助信息 }"
+                   "{ @record  |    | rm::RecordWriter 生成的二进制记录文件，帧数据负载需为编码图像 }"
+                   "{ c color  |0   | 识别装甲板颜色 '\033[33m0\033[0m': 识别蓝色，"
+                   "'\033[33m1\033[0m': 识别红色 }"
+                   "{ l loop   |1   | 记录文件重放的遍数 }"
+                   "{ s speed  |15  | 子弹射速（单位：m/s） }";
+
+const char *help = "                      \033[34;1m使用说明\033[0m\n"
+                   "本程序为装甲板离线重放例程，从二进制记录文件读取帧数据与 IMU 数\n"
+                   "据，以最大速度依次通过识别、补偿、预测、决策模块，并在结束后打\n"
+                   "印各阶段的耗时直方图，可用于离线性能分析与参数 A/B 对比，重放过\n"
+                   "程使用记录的时间戳与 IMU 数据，结果可确定性复现";
+
+int main(int argc, char *argv[])
+{
+    // 命令行参数初始化
+    cv::CommandLineParser parser(argc, argv, keys);
+    if (parser.has("help") || !parser.has("@record"))
+    {
+        parser.printMessage();
+        printf("%s\n", help);
+        return 0;
+    }
+
+    auto record_path = parser.get<std::string>("@record");
+    auto color = parser.get<int>("color") == 0 ? rm::PixChannel::BLUE : rm::PixChannel::RED;
+    auto loop = parser.get<int>("loop");
+    auto shoot_speed = parser.get<float>("speed");
+
+    // 打开记录文件
+    rm::RecordReader reader(record_path);
+    if (reader.size() == 0)
+    {
+        printf("记录文件 \033[33m\"%s\"\033[0m 为空\n", record_path.c_str());
+        return -1;
+    }
+    printf("已打开记录文件 \033[33m\"%s\"\033[0m，共 %zu 条记录\n", record_path.c_str(), reader.size());
+
+    // 功能模块初始化
+    auto p_detector = rm::ArmorDetector::make_detector();
+    auto p_compensator = rm::GravityCompensator::make_compensator();
+    auto p_predictor = rm::ArmorPredictor::make_predictor();
+    auto p_decider = rm::TranslationDecider::make_decider();
+    std::vector<rm::group::ptr> groups;
+    rm::tracker::ptr last_target{};
+
+    StageHistogram detect_hist("detect"), compensate_hist("compensate"),
+        predict_hist("predict"), decide_hist("decide");
+    std::size_t frame_num{}, decode_fail_num{};
+
+    double start = rm::Timer::now();
+    for (int i = 0; i < loop; ++i)
+    {
+        for (std::size_t idx = 0; idx < reader.size(); ++idx)
+        {
+            auto rec = reader.at(idx);
+            if (rec.payload == nullptr || rec.payload_size == 0)
+                continue;
+            cv::Mat buf(1, static_cast<int>(rec.payload_size), CV_8U, const_cast<uint8_t *>(rec.payload));
+            cv::Mat src = cv::imdecode(buf, cv::IMREAD_COLOR);
+            if (src.empty())
+            {
+                decode_fail_num++;
+                continue;
+            }
+            // 程序处理 I: 识别，使用记录的时间戳与 IMU 数据以保证确定性
+            double t0 = rm::Timer::now();
+            rm::DetectInfo detect_info{};
+            try
+            {
+                detect_info = p_detector->detect(groups, src, color, rec.imu, rec.tick);
+            }
+            catch (const rm::Exception &e)
+            {
+                ERROR_("Occurred an exception! %s", e.err.c_str());
+                groups.clear();
+                continue;
+            }
+            // 程序处理 II: 补偿
+            double t1 = rm::Timer::now();
+            auto compensate_info = p_compensator->compensate(groups, shoot_speed, rm::CompensateType::UNKNOWN);
+            // 程序处理 III: 预测
+            double t2 = rm::Timer::now();
+            auto predict_info = p_predictor->predict(groups, compensate_info.tof);
+            // 程序处理 IV: 决策
+            double t3 = rm::Timer::now();
+            auto decide_info = p_decider->decide(groups, {}, last_target, detect_info, compensate_info, predict_info);
+            double t4 = rm::Timer::now();
+            last_target = decide_info.target;
+
+            detect_hist.add(t1 - t0);
+            compensate_hist.add(t2 - t1);
+            predict_hist.add(t3 - t2);
+            decide_hist.add(t4 - t3);
+            frame_num++;
+        }
+    }
+    double total = rm::Timer::now() - start;
+
+    if (decode_fail_num != 0)
+        WARNING_("%zu 条记录的帧数据负载无法解码为图像", decode_fail_num);
+    printf("\n共重放 %zu 帧，耗时 %.3f s，平均 %.1f fps\n", frame_num, total,
+           total > 0 ? static_cast<double>(frame_num) / total : 0);
+    detect_hist.print();
+    compensate_hist.print();
+    predict_hist.print();
+    decide_hist.print();
+    return 0;
+}
@@ -35,7 +35,9 @@ static void cmd_help()
                                   "  open            \033[32m# open all the channels\033[0m\n"
                                   "  close           \033[32m# close all the channels\033[0m\n"
                                   "  get <chn>       \033[32m# get the brightness of the specified channel\033[0m\n"
-                                  "  set <chn> <val> \033[32m# set the brightness of the specified channel\033[0m\n";
+                                  "  set <chn> <val> \033[32m# set the brightness of the specified channel\033[0m\n"
+                                  "  strobe <chn> <trig> <width> <val> \033[32m# bind the channel to the hardware trigger\n"
+                                  "                  # input <trig> with pulse width <width> (0.1ms) and brightness <val>\033[0m\n";
     std::cout << usage << std::endl;
 }
 
@@ -70,8 +72,13 @@ static void parametersCtl(std::vector<std::string> &cmds)
             if (cmds[2] == "delay")
             {
                 uint32_t val = static_cast<uint32_t>(std::stoi(cmds[3]));
+#ifdef RMVL_PARA_BAKED_HIK_LIGHT_CONTROL
+                (void)val;
+                std::cout << "'Failure', parameter is baked as a compile-time constant\n";
+#else
                 rm::para::hik_light_control_param.DELAY_AFTER_WRITE = val;
                 std::cout << "'Success'\n";
+#endif
             }
             else
                 warning();
@@ -136,6 +143,23 @@ static void functionCtl(rm::HikLightController &lc, bool &stop, std::vector<std:
         else
             warning();
     }
+    else if (cmds.size() == 5)
+    {
+        if (cmds[0] == "strobe")
+        {
+            int chn = std::stoi(cmds[1]);
+            rm::LightStrobeConfig cfg{};
+            cfg.trigger_channel = static_cast<rm::LightTriggerChannel>(std::stoi(cmds[2]));
+            cfg.pulse_width = static_cast<uint32_t>(std::stoi(cmds[3]));
+            cfg.intensity = static_cast<uint8_t>(std::stoi(cmds[4]));
+            if (!lc.setStrobe(chn, cfg))
+                std::cout << "'Failed to set the strobe mode of channel " << chn << "'\n";
+            else
+                std::cout << "'Success'\n";
+        }
+        else
+            warning();
+    }
     else if (cmds.size() > 3)
         warning();
 }